@@ -29,9 +29,53 @@ struct kiss_fft_state{
     int nfft;
     int inverse;
     int factors[2*MAXFACTORS];
-    kiss_fft_cpx twiddles[1];
+    int nswaps;                         /* number of index pairs in swaps */
+    const kiss_fft_index * swaps;       /* input permutation as a list of in-place swaps */
+    const kiss_fft_cpx * twiddles;      /* either placed after the state or a const table in flash */
+    int twiddle_stride;                 /* twiddles holds the (nfft*twiddle_stride)-th roots of unity */
+    kiss_fft_codelet codelet;           /* size-specific butterfly stages, NULL to use kf_work_inplace */
+#ifdef KISS_FFT_STAGE_TWIDDLES
+    const kiss_fft_cpx * stage_twiddles; /* per-stage packed twiddles, innermost stage first */
+#endif
+};
+
+/*
+ * KISS_FFT_STAGE_TWIDDLES: instead of striding through twiddles (tw += fstride*q),
+ * the radix 2-5 butterflies read a packed table per stage sequentially.  Stage s
+ * with radix p and length m stores twiddles[q*u*fstride] for u=0..m-1, q=1..p-1
+ * (u major), innermost stage first.  Generic radix stages have no entries.
+ * The entries telescope to at most nfft-1.
+ */
+#ifdef KISS_FFT_STAGE_TWIDDLES
+# define KISS_FFT_STAGE_TWIDDLE_BYTES(nfft) (sizeof(kiss_fft_cpx)*((nfft)-1))
+#else
+# define KISS_FFT_STAGE_TWIDDLE_BYTES(nfft) 0
+#endif
+
+/* bytes needed by kiss_fft_alloc: state, nfft twiddles, stage twiddles and at most nfft-1 swap pairs */
+#define KISS_FFT_CFG_BYTES(nfft) \
+    (sizeof(struct kiss_fft_state) + sizeof(kiss_fft_cpx)*(nfft) + KISS_FFT_STAGE_TWIDDLE_BYTES(nfft) + \
+     sizeof(kiss_fft_index)*2*((nfft)-1))
+
+/* bytes needed by kiss_fft_alloc_tables: only the state, the tables stay where they are */
+#define KISS_FFT_CFG_TABLES_BYTES (sizeof(struct kiss_fft_state))
+
+struct kiss_fftr_state{
+    kiss_fft_cfg substate;
+    const kiss_fft_cpx * super_twiddles;
+    int super_stride;       /* super_twiddles[k*super_stride-1] is the twiddle of bin k */
+#ifdef USE_SIMD    
+    void * pad;
+#endif    
 };
 
+/* bytes needed by kiss_fftr_alloc: state, nfft/2-point complex substate and nfft/4 super twiddles */
+#define KISS_FFTR_CFG_BYTES(nfft) \
+    (sizeof(struct kiss_fftr_state) + KISS_FFT_CFG_BYTES((nfft)/2) + sizeof(kiss_fft_cpx)*((nfft)/4))
+
+/* bytes needed by kiss_fftr_alloc_tables */
+#define KISS_FFTR_CFG_TABLES_BYTES (sizeof(struct kiss_fftr_state) + KISS_FFT_CFG_TABLES_BYTES)
+
 /*
   Explanation of macros dealing with complex math:
 
@@ -152,9 +196,8 @@ struct kiss_fft_state{
 
 #ifdef KISS_FFT_USE_ALLOCA
 // define this to allow use of alloca instead of malloc for temporary buffers
-// Temporary buffers are used in two case: 
-// 1. FFT sizes that have "bad" factors. i.e. not 2,3 and 5
-// 2. "in-place" FFTs.  Notice the quotes, since kissfft does not really do an in-place transform.
+// Temporary buffers are only used for FFT sizes that have "bad" factors. i.e. not 2,3 and 5
+// (in-place FFTs are done truly in place by the iterative engine)
 #include <alloca.h>
 #define  KISS_FFT_TMP_ALLOC(nbytes) alloca(nbytes)
 #define  KISS_FFT_TMP_FREE(ptr) 
@@ -0,0 +1,312 @@
+/*
+ * _kiss_fft_simd.h
+ *
+ * Vectorized radix-2 and radix-4 butterflies that speed up a single transform
+ * (USE_SIMD instead runs four transforms in lockstep).  Included by kiss_fft.c
+ * after the scalar butterflies; define at most one backend:
+ *
+ *   KISS_FFT_SIMD_SSE   float build, x86 SSE3: 2 complex points per vector
+ *   KISS_FFT_SIMD_AVX   float build, x86 AVX: 4 complex points per vector
+ *   KISS_FFT_SIMD_DSP   Q15 build, Cortex-M4 packed 16-bit DSP instructions:
+ *                       one complex point per word, the complex multiply in
+ *                       two dual 16x16 multiply-accumulates.  On other targets
+ *                       the instructions are emulated in C, so the backend can
+ *                       be checked on a host.
+ *
+ * Every backend does the scalar butterfly's arithmetic in the same order, so
+ * the output is identical to the scalar code (float builds: as long as the
+ * compiler does not contract the scalar code into fused multiply-adds).
+ * Stages whose length is not a multiple of the vector width use the scalar
+ * butterfly.
+ */
+
+#ifndef _KISS_FFT_SIMD_H
+#define _KISS_FFT_SIMD_H
+
+#if (defined(KISS_FFT_SIMD_SSE) + defined(KISS_FFT_SIMD_AVX) + defined(KISS_FFT_SIMD_DSP)) > 1
+# error "define only one of KISS_FFT_SIMD_SSE, KISS_FFT_SIMD_AVX and KISS_FFT_SIMD_DSP"
+#endif
+
+#if defined(KISS_FFT_SIMD_SSE) || defined(KISS_FFT_SIMD_AVX)
+
+#if defined(FIXED_POINT) || defined(USE_SIMD)
+# error "the SSE/AVX butterflies are for the float build"
+#endif
+
+#ifdef KISS_FFT_SIMD_AVX
+# ifndef __AVX__
+#  error "KISS_FFT_SIMD_AVX needs an AVX target (-mavx)"
+# endif
+# include <immintrin.h>
+# define KF_LANES 4                         /* complex points per vector */
+# define kf_vec __m256
+# define kf_load(p) _mm256_loadu_ps(&(p)->r)
+# define kf_store(p,v) _mm256_storeu_ps(&(p)->r,v)
+# define kf_add _mm256_add_ps
+# define kf_sub _mm256_sub_ps
+# define kf_xor _mm256_xor_ps
+# define kf_mul _mm256_mul_ps
+# define kf_addsub _mm256_addsub_ps
+# define kf_dup_re _mm256_moveldup_ps
+# define kf_dup_im _mm256_movehdup_ps
+# define kf_swap_ri(v) _mm256_permute_ps(v,_MM_SHUFFLE(2,3,0,1))
+# define kf_neg_im() _mm256_set_ps(-0.f,0.f,-0.f,0.f,-0.f,0.f,-0.f,0.f)
+
+/* gathers tw[0], tw[step], tw[2*step], tw[3*step] */
+static inline __m256 kf_load_tw(const kiss_fft_cpx * tw,size_t step)
+{
+    __m128 lo = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(),(const __m64*)tw),(const __m64*)(tw+step));
+    __m128 hi = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(),(const __m64*)(tw+2*step)),(const __m64*)(tw+3*step));
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo),hi,1);
+}
+#else
+# ifndef __SSE3__
+#  error "KISS_FFT_SIMD_SSE needs an SSE3 target (-msse3)"
+# endif
+# include <pmmintrin.h>
+# define KF_LANES 2
+# define kf_vec __m128
+# define kf_load(p) _mm_loadu_ps(&(p)->r)
+# define kf_store(p,v) _mm_storeu_ps(&(p)->r,v)
+# define kf_add _mm_add_ps
+# define kf_sub _mm_sub_ps
+# define kf_xor _mm_xor_ps
+# define kf_mul _mm_mul_ps
+# define kf_addsub _mm_addsub_ps
+# define kf_dup_re _mm_moveldup_ps
+# define kf_dup_im _mm_movehdup_ps
+# define kf_swap_ri(v) _mm_shuffle_ps(v,v,_MM_SHUFFLE(2,3,0,1))
+# define kf_neg_im() _mm_set_ps(-0.f,0.f,-0.f,0.f)
+
+/* gathers tw[0], tw[step] */
+static inline __m128 kf_load_tw(const kiss_fft_cpx * tw,size_t step)
+{
+    return _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(),(const __m64*)tw),(const __m64*)(tw+step));
+}
+#endif
+
+/* a*w per complex lane: (ar*wr - ai*wi, ai*wr + ar*wi), the products and sums of C_MUL */
+static inline kf_vec kf_cmul(kf_vec a,kf_vec w)
+{
+    return kf_addsub(kf_mul(a,kf_dup_re(w)),kf_mul(kf_swap_ri(a),kf_dup_im(w)));
+}
+
+static void kf_bfly2_simd(
+        kiss_fft_cpx * Fout,
+        const size_t fstride,
+        const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
+        int m
+        )
+{
+    const kiss_fft_cpx * tw1 = TW_START(1,2);
+    const size_t step1 = TW_STEP(1,2);
+    int k;
+
+    if (m % KF_LANES) {
+        kf_bfly2(Fout,fstride,st,stw,m);
+        return;
+    }
+    for (k=0;k<m;k+=KF_LANES) {
+        kf_vec f = kf_load(Fout+k);
+        kf_vec t = kf_cmul(kf_load(Fout+m+k),kf_load_tw(tw1,step1));
+        tw1 += KF_LANES*step1;
+        kf_store(Fout+m+k,kf_sub(f,t));
+        kf_store(Fout+k,kf_add(f,t));
+    }
+}
+
+static void kf_bfly4_simd(
+        kiss_fft_cpx * Fout,
+        const size_t fstride,
+        const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
+        const size_t m
+        )
+{
+    const kiss_fft_cpx * tw1 = TW_START(1,4);
+    const kiss_fft_cpx * tw2 = TW_START(2,4);
+    const kiss_fft_cpx * tw3 = TW_START(3,4);
+    const size_t step1 = TW_STEP(1,4), step2 = TW_STEP(2,4), step3 = TW_STEP(3,4);
+    const kf_vec neg_im = kf_neg_im();
+    size_t k;
+
+    if (m % KF_LANES) {
+        kf_bfly4(Fout,fstride,st,stw,m);
+        return;
+    }
+    for (k=0;k<m;k+=KF_LANES) {
+        kiss_fft_cpx * F = Fout + k;
+        kf_vec f0 = kf_load(F);
+        kf_vec s0 = kf_cmul(kf_load(F+m),kf_load_tw(tw1,step1));
+        kf_vec s1 = kf_cmul(kf_load(F+2*m),kf_load_tw(tw2,step2));
+        kf_vec s2 = kf_cmul(kf_load(F+3*m),kf_load_tw(tw3,step3));
+        kf_vec s3,s4,s5;
+        tw1 += KF_LANES*step1;
+        tw2 += KF_LANES*step2;
+        tw3 += KF_LANES*step3;
+
+        s5 = kf_sub(f0,s1);
+        f0 = kf_add(f0,s1);
+        s3 = kf_add(s0,s2);
+        s4 = kf_sub(s0,s2);
+        kf_store(F+2*m,kf_sub(f0,s3));
+        kf_store(F,kf_add(f0,s3));
+
+        s4 = kf_xor(kf_swap_ri(s4),neg_im);     /* (s4.i, -s4.r) */
+        if (st->inverse) {
+            kf_store(F+m,kf_sub(s5,s4));
+            kf_store(F+3*m,kf_add(s5,s4));
+        } else {
+            kf_store(F+m,kf_add(s5,s4));
+            kf_store(F+3*m,kf_sub(s5,s4));
+        }
+    }
+}
+
+#define KF_BFLY2 kf_bfly2_simd
+#define KF_BFLY4 kf_bfly4_simd
+
+#elif defined(KISS_FFT_SIMD_DSP)
+
+#if !defined(FIXED_POINT) || (FIXED_POINT != 16)
+# error "KISS_FFT_SIMD_DSP is for the Q15 build (FIXED_POINT=16)"
+#endif
+
+#include <stdint.h>
+
+/* a Q15 complex point packed in one word, real part in the low halfword */
+typedef int32_t kf_q15x2;
+
+#if defined(__TI_ARM__)
+# define kf_smusd _smusd                    /* lo*lo - hi*hi */
+# define kf_smuadx _smuadx                  /* lo*hi + hi*lo */
+# define kf_smulbb _smulbb                  /* lo*lo */
+# define kf_smultb _smultb                  /* hi*lo */
+# define kf_sadd16 _sadd16                  /* lo+lo, hi+hi (wrapping) */
+# define kf_ssub16 _ssub16                  /* lo-lo, hi-hi */
+# define kf_sasx _sasx                      /* lo-hi, hi+lo */
+# define kf_ssax _ssax                      /* lo+hi, hi-lo */
+#elif defined(__ARM_FEATURE_SIMD32)
+# include <arm_acle.h>
+# define kf_smusd __smusd
+# define kf_smuadx __smuadx
+# define kf_smulbb __smulbb
+# define kf_smultb __smultb
+# define kf_sadd16(a,b) ((kf_q15x2)__sadd16(a,b))
+# define kf_ssub16(a,b) ((kf_q15x2)__ssub16(a,b))
+# define kf_sasx(a,b) ((kf_q15x2)__sasx(a,b))
+# define kf_ssax(a,b) ((kf_q15x2)__ssax(a,b))
+#else
+/* C emulation of the M4 instructions for host builds */
+# define KF_LO(x) ((int32_t)(int16_t)(uint16_t)(uint32_t)(x))
+# define KF_HI(x) ((int32_t)(int16_t)(uint16_t)((uint32_t)(x) >> 16))
+# define KF_PACK(lo,hi) ((kf_q15x2)(((uint32_t)(uint16_t)(lo)) | ((uint32_t)(uint16_t)(hi) << 16)))
+# define kf_smusd(a,b) (KF_LO(a)*KF_LO(b) - KF_HI(a)*KF_HI(b))
+# define kf_smuadx(a,b) (KF_LO(a)*KF_HI(b) + KF_HI(a)*KF_LO(b))
+# define kf_smulbb(a,b) (KF_LO(a)*KF_LO(b))
+# define kf_smultb(a,b) (KF_HI(a)*KF_LO(b))
+# define kf_sadd16(a,b) KF_PACK(KF_LO(a) + KF_LO(b),KF_HI(a) + KF_HI(b))
+# define kf_ssub16(a,b) KF_PACK(KF_LO(a) - KF_LO(b),KF_HI(a) - KF_HI(b))
+# define kf_sasx(a,b) KF_PACK(KF_LO(a) - KF_HI(b),KF_HI(a) + KF_LO(b))
+# define kf_ssax(a,b) KF_PACK(KF_LO(a) + KF_HI(b),KF_HI(a) - KF_LO(b))
+#endif
+
+#define kf_sround(x) (((x) + (1<<(FRACBITS-1))) >> FRACBITS)
+#define kf_pack(lo,hi) ((kf_q15x2)(((uint32_t)(uint16_t)(lo)) | ((uint32_t)(hi) << 16)))
+
+static inline kf_q15x2 kf_ld(const kiss_fft_cpx * p)
+{
+    kf_q15x2 x;
+    memcpy(&x,p,sizeof(x));
+    return x;
+}
+
+static inline void kf_st(kiss_fft_cpx * p,kf_q15x2 x)
+{
+    memcpy(p,&x,sizeof(x));
+}
+
+/* a*w with C_MUL's rounding: two dual multiplies instead of four multiplies */
+static inline kf_q15x2 kf_cmul(kf_q15x2 a,kf_q15x2 w)
+{
+    return kf_pack(kf_sround(kf_smusd(a,w)),kf_sround(kf_smuadx(a,w)));
+}
+
+/* C_FIXDIV of both halves, d = SAMP_MAX/div */
+static inline kf_q15x2 kf_fixdiv(kf_q15x2 a,int32_t d)
+{
+    return kf_pack(kf_sround(kf_smulbb(a,d)),kf_sround(kf_smultb(a,d)));
+}
+
+static void kf_bfly2_simd(
+        kiss_fft_cpx * Fout,
+        const size_t fstride,
+        const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
+        int m
+        )
+{
+    const kiss_fft_cpx * tw1 = TW_START(1,2);
+    const int32_t d = SAMP_MAX/2;
+    int k;
+
+    TW_UNUSED();
+    for (k=0;k<m;++k) {
+        kf_q15x2 f = kf_fixdiv(kf_ld(Fout+k),d);
+        kf_q15x2 t = kf_cmul(kf_fixdiv(kf_ld(Fout+m+k),d),kf_ld(tw1));
+        tw1 += TW_STEP(1,2);
+        kf_st(Fout+m+k,kf_ssub16(f,t));
+        kf_st(Fout+k,kf_sadd16(f,t));
+    }
+}
+
+static void kf_bfly4_simd(
+        kiss_fft_cpx * Fout,
+        const size_t fstride,
+        const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
+        const size_t m
+        )
+{
+    const kiss_fft_cpx * tw1 = TW_START(1,4);
+    const kiss_fft_cpx * tw2 = TW_START(2,4);
+    const kiss_fft_cpx * tw3 = TW_START(3,4);
+    const int32_t d = SAMP_MAX/4;
+    size_t k;
+
+    TW_UNUSED();
+    for (k=0;k<m;++k) {
+        kiss_fft_cpx * F = Fout + k;
+        kf_q15x2 f0 = kf_fixdiv(kf_ld(F),d);
+        kf_q15x2 s0 = kf_cmul(kf_fixdiv(kf_ld(F+m),d),kf_ld(tw1));
+        kf_q15x2 s1 = kf_cmul(kf_fixdiv(kf_ld(F+2*m),d),kf_ld(tw2));
+        kf_q15x2 s2 = kf_cmul(kf_fixdiv(kf_ld(F+3*m),d),kf_ld(tw3));
+        kf_q15x2 s3,s4,s5;
+        tw1 += TW_STEP(1,4);
+        tw2 += TW_STEP(2,4);
+        tw3 += TW_STEP(3,4);
+
+        s5 = kf_ssub16(f0,s1);
+        f0 = kf_sadd16(f0,s1);
+        s3 = kf_sadd16(s0,s2);
+        s4 = kf_ssub16(s0,s2);
+        kf_st(F+2*m,kf_ssub16(f0,s3));
+        kf_st(F,kf_sadd16(f0,s3));
+
+        if (st->inverse) {
+            kf_st(F+m,kf_sasx(s5,s4));          /* (s5.r - s4.i, s5.i + s4.r) */
+            kf_st(F+3*m,kf_ssax(s5,s4));        /* (s5.r + s4.i, s5.i - s4.r) */
+        } else {
+            kf_st(F+m,kf_ssax(s5,s4));
+            kf_st(F+3*m,kf_sasx(s5,s4));
+        }
+    }
+}
+
+#define KF_BFLY2 kf_bfly2_simd
+#define KF_BFLY4 kf_bfly4_simd
+
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * adc_block.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Block ADC acquisition: a single-producer ring of samples the driver fills
+ * block by block, with a 64-bit write sequence that only moves by whole blocks,
+ * and lock-free snapshot and borrow reads that detect overwritten samples
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "adc_block.h"
+#include "adc_summary.h"
+#include "trigger.h"
+
+// empty ring
+void adc_block_init(adc_block_ring *r, volatile uint16_t *buffer, uint32_t size, uint32_t block)
+{
+    r->buffer = buffer;
+    r->size = size;
+    r->block = block;
+    r->count = 0;
+    r->count_hi = 0;
+    r->lock = 0;
+    r->errors = 0;
+    r->summary = NULL;
+    r->trigger = NULL;
+}
+
+// destination of a block in flight
+volatile uint16_t *adc_block_dest(const adc_block_ring *r, uint32_t n)
+{
+    return &r->buffer[(r->count + n*r->block) & (r->size - 1)];
+}
+
+// one more block complete
+void adc_block_publish(adc_block_ring *r)
+{
+    uint32_t count = r->count + r->block;
+
+    if (r->summary != NULL)
+        adc_summary_add(r->summary, r->buffer, r->count, r->block); // summarized before it is published
+    if (r->trigger != NULL)
+        trigger_stream_block(r->trigger, adc_block_dest(r, 0), (uint64_t)r->count_hi << 32 | r->count, r->block); // compared too
+    r->lock++; // odd: the sequence is changing
+    ADC_BLOCK_BARRIER(); // the samples, then the lock, are in place before the sequence moves
+    r->count = count;
+    if (count < r->block)
+        r->count_hi++; // the low word wrapped
+    ADC_BLOCK_BARRIER();
+    r->lock++;
+}
+
+// oldest sample safe to read
+uint32_t adc_block_oldest(const adc_block_ring *r, uint32_t count)
+{
+    return count - (r->size - ADC_BLOCKS_IN_FLIGHT*r->block); // the blocks in flight overwrite the oldest ones
+}
+
+// 64-bit sequence
+uint64_t adc_block_sequence(const adc_block_ring *r)
+{
+    uint32_t lock, lo, hi;
+
+    do { // again if the producer updated the sequence meanwhile
+        lock = r->lock;
+        ADC_BLOCK_BARRIER();
+        lo = r->count;
+        hi = r->count_hi;
+        ADC_BLOCK_BARRIER();
+    } while ((lock & 1) || lock != r->lock);
+    return (uint64_t)hi << 32 | lo;
+}
+
+// samples from first on not overwritten
+bool adc_block_valid(const adc_block_ring *r, uint64_t first)
+{
+    ADC_BLOCK_BARRIER(); // the sample reads are done before the sequence is read
+    uint64_t sequence = adc_block_sequence(r);
+
+    // sample first is overwritten once the blocks in flight reach first + size
+    return first + r->size >= sequence + ADC_BLOCKS_IN_FLIGHT*r->block;
+}
+
+// copy, then validate
+bool adc_block_snapshot(const adc_block_ring *r, uint64_t end, uint32_t n, uint16_t *dest)
+{
+    adc_span span;
+    uint32_t i, j;
+
+    if (!adc_block_borrow(r, end, n, &span))
+        return false;
+    for (j = 0; j < 2; j++)
+        for (i = 0; i < span.len[j]; i++)
+            *dest++ = span.part[j][i];
+    return adc_block_release(r, &span);
+}
+
+// lend in place
+bool adc_block_borrow(const adc_block_ring *r, uint64_t end, uint32_t n, adc_span *span)
+{
+    uint32_t start = (uint32_t)(end - n) & (r->size - 1);
+
+    span->first = end - n;
+    span->part[0] = &r->buffer[start];
+    span->len[0] = n < r->size - start ? n : r->size - start;
+    span->part[1] = r->buffer;
+    span->len[1] = n - span->len[0];
+    return n <= end && end <= adc_block_sequence(r) && adc_block_valid(r, span->first);
+}
+
+// validate a borrow
+bool adc_block_release(const adc_block_ring *r, const adc_span *span)
+{
+    return adc_block_valid(r, span->first);
+}
@@ -0,0 +1,90 @@
+/*
+ * adc_block.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Block ADC acquisition: a single-producer ring of samples the driver fills
+ * block by block, with a 64-bit write sequence that only moves by whole blocks,
+ * and lock-free snapshot and borrow reads that detect overwritten samples
+ */
+
+#ifndef ADC_BLOCK_H_
+#define ADC_BLOCK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ADC_BLOCKS_IN_FLIGHT 2  // blocks the driver may be writing at once (ping and pong)
+
+// orders the sample reads of a consumer against its reads of the sequence, and the producer's writes
+#if defined(__TI_COMPILER_VERSION__)
+#define ADC_BLOCK_BARRIER() __asm(" dmb")
+#else
+#define ADC_BLOCK_BARRIER() __sync_synchronize()
+#endif
+
+// orders a producer's writes before the one that publishes them, a release fence: no instruction on x86
+#if defined(__TI_COMPILER_VERSION__)
+#define ADC_BLOCK_RELEASE() __asm(" dmb")
+#else
+#define ADC_BLOCK_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+// ring of samples, sample n (counted from the start of the acquisition, wrapping at 2^32) at buffer[n & (size - 1)]
+typedef struct {
+    volatile uint16_t *buffer;  // the ring
+    uint32_t size;              // ring size, a power of 2
+    uint32_t block;             // block size, a power of 2 dividing size
+    volatile uint32_t count;    // samples published (low word of the sequence), a multiple of block: samples
+                                // before it are complete. one load, for consumers comparing modulo 2^32
+    volatile uint32_t count_hi; // high word of the sequence
+    volatile uint32_t lock;     // seqlock of the sequence, odd while the producer updates it
+    volatile uint32_t errors;   // blocks the hardware lost or overran
+    struct adc_summary *summary; // min/max summary kept up to date by adc_block_publish(), NULL for none
+    struct trigger_stream *trigger; // trigger comparator adc_block_publish() runs on every block, NULL for none
+} adc_block_ring;
+
+// samples of the ring borrowed in place, in at most two parts split where the ring wraps
+typedef struct {
+    uint64_t first;                     // sequence number of the first sample
+    const volatile uint16_t *part[2];   // the parts, oldest first
+    uint32_t len[2];                    // samples in each part, len[1] = 0 when the span does not wrap
+} adc_span;
+
+// sets up an empty ring of size samples in blocks of block samples
+void adc_block_init(adc_block_ring *r, volatile uint16_t *buffer, uint32_t size, uint32_t block);
+
+// start of the n-th block after the published ones: 0 is the block being filled, 1 the one after it
+volatile uint16_t *adc_block_dest(const adc_block_ring *r, uint32_t n);
+
+// publishes the block being filled, from the driver interrupt once its last sample is written, summarizing it and
+// running the trigger comparator on it first
+void adc_block_publish(adc_block_ring *r);
+
+// oldest sample the driver cannot overwrite before count moves on, for consumers reading at sample count
+uint32_t adc_block_oldest(const adc_block_ring *r, uint32_t count);
+
+// samples published so far as a 64-bit sequence that never wraps, read consistently under the seqlock
+uint64_t adc_block_sequence(const adc_block_ring *r);
+
+// whether the samples from sequence number first on are still intact, checked after reading them: the
+// seqlock-style validate of a read straight from the ring
+bool adc_block_valid(const adc_block_ring *r, uint64_t first);
+
+// copies the n samples before sequence number end into dest, false if any was not yet published or was
+// overwritten during the copy (dest is then partly stale)
+bool adc_block_snapshot(const adc_block_ring *r, uint64_t end, uint32_t n, uint16_t *dest);
+
+// lends the n samples before sequence number end in place, for a consumer that finishes before the ring wraps.
+// false if any is not yet published or already overwritten. adc_block_release() tells whether they stayed intact
+bool adc_block_borrow(const adc_block_ring *r, uint64_t end, uint32_t n, adc_span *span);
+
+// ends a borrow, false if the driver overwrote any of the samples meanwhile
+bool adc_block_release(const adc_block_ring *r, const adc_span *span);
+
+// acquisition driver, adc_tm4c.c on the TM4C1294 and tools/adc_host.c on a host: sets up the sampling into
+// buffer of size samples and starts it, returns the actual sampling rate in Hz
+uint32_t adc_driver_init(adc_block_ring *r, volatile uint16_t *buffer, uint32_t size);
+
+#endif /* ADC_BLOCK_H_ */
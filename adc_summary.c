@@ -0,0 +1,137 @@
+/*
+ * adc_summary.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Min/max summary of the ADC ring: the minimum, maximum and sum of every
+ * 64-sample block, kept by the acquisition side as blocks are published, and a
+ * tree over the blocks for the min, max and mean of any recent window
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_block.h"
+#include "adc_summary.h"
+
+// a node covering the runs of a and b
+static void merge(adc_summary_node *to, const adc_summary_node *a, const adc_summary_node *b)
+{
+    to->min = a->min < b->min ? a->min : b->min;
+    to->max = a->max > b->max ? a->max : b->max;
+    to->sum = a->sum + b->sum;
+}
+
+// summarizes leaves a to b (no wrap) from the samples, then their ancestors level by level
+static void update(adc_summary *s, const volatile uint16_t *buffer, uint32_t a, uint32_t b)
+{
+    uint32_t lo = s->leaves + a, hi = s->leaves + b;
+    uint32_t i, j;
+
+    for (i = a; i <= b; i++) {
+        const volatile uint16_t *x = &buffer[i*ADC_SUMMARY_BLOCK];
+        uint32_t min = 0xffff, max = 0, sum = 0;
+        for (j = 0; j < ADC_SUMMARY_BLOCK; j++) {
+            uint32_t v = x[j];
+            min = v < min ? v : min;
+            max = v > max ? v : max;
+            sum += v;
+        }
+        s->node[s->leaves + i].min = (uint16_t)min;
+        s->node[s->leaves + i].max = (uint16_t)max;
+        s->node[s->leaves + i].sum = sum;
+    }
+    while (lo > 1) {
+        lo >>= 1;
+        hi >>= 1;
+        for (i = lo; i <= hi; i++)
+            merge(&s->node[i], &s->node[2*i], &s->node[2*i + 1]);
+    }
+}
+
+// leaves a to b - 1 (no wrap) into acc, bottom-up
+static void query(const adc_summary *s, uint32_t a, uint32_t b, adc_summary_node *acc)
+{
+    uint32_t lo = s->leaves + a, hi = s->leaves + b;
+
+    for (; lo < hi; lo >>= 1, hi >>= 1) {
+        if (lo & 1)
+            merge(acc, acc, &s->node[lo++]);
+        if (hi & 1)
+            merge(acc, acc, &s->node[--hi]);
+    }
+}
+
+// empty summary, then hooked into publishing
+void adc_summary_attach(adc_summary *s, adc_block_ring *r)
+{
+    uint32_t i;
+
+    s->leaves = r->size/ADC_SUMMARY_BLOCK;
+    s->start = (adc_block_sequence(r) + ADC_SUMMARY_BLOCK - 1) & ~(uint64_t)(ADC_SUMMARY_BLOCK - 1);
+    for (i = 0; i < 2*s->leaves; i++) {
+        s->node[i].min = 0xffff;
+        s->node[i].max = 0;
+        s->node[i].sum = 0;
+    }
+    ADC_BLOCK_BARRIER(); // the summary is set up before the interrupt can see it
+    r->summary = s;
+}
+
+// the summary blocks ending in (first, first + n]
+void adc_summary_add(adc_summary *s, const volatile uint16_t *buffer, uint32_t first, uint32_t n)
+{
+    uint32_t mask = s->leaves - 1;
+    uint32_t k = (((first + n) & ~(ADC_SUMMARY_BLOCK - 1)) - (first & ~(ADC_SUMMARY_BLOCK - 1)))/ADC_SUMMARY_BLOCK;
+    uint32_t a;
+
+    if (k == 0)
+        return; // the summary block is not complete yet
+    if (k > s->leaves)
+        k = s->leaves;
+    a = ((first + n)/ADC_SUMMARY_BLOCK - k) & mask;
+    if (a + k <= s->leaves) {
+        update(s, buffer, a, a + k - 1);
+    } else { // split where the ring wraps
+        update(s, buffer, a, s->leaves - 1);
+        update(s, buffer, 0, a + k - s->leaves - 1);
+    }
+}
+
+// whole leaves of the window
+bool adc_summary_window(const adc_summary *s, const adc_block_ring *r, uint64_t end, uint32_t n, adc_window *w)
+{
+    adc_summary_node acc = {0xffff, 0, 0};
+    uint64_t last = end & ~(uint64_t)(ADC_SUMMARY_BLOCK - 1);
+    uint64_t first = n <= end ? (end - n + ADC_SUMMARY_BLOCK - 1) & ~(uint64_t)(ADC_SUMMARY_BLOCK - 1) : 0;
+    uint32_t a, k;
+
+    if (end > adc_block_sequence(r))
+        return false; // not published yet
+    if (first < s->start)
+        first = s->start;
+    if (first >= last) { // no whole summary block in the window
+        w->first = end;
+        w->n = 0;
+        w->min = w->max = 0;
+        w->mean = 0;
+        return true;
+    }
+    k = (uint32_t)((last - first)/ADC_SUMMARY_BLOCK);
+    if (k > s->leaves)
+        return false; // longer than the ring
+    a = (uint32_t)(first/ADC_SUMMARY_BLOCK) & (s->leaves - 1);
+    if (a + k <= s->leaves) {
+        query(s, a, a + k, &acc);
+    } else { // split where the ring wraps
+        query(s, a, s->leaves, &acc);
+        query(s, 0, a + k - s->leaves, &acc);
+    }
+
+    w->first = first;
+    w->n = k*ADC_SUMMARY_BLOCK;
+    w->min = acc.min;
+    w->max = acc.max;
+    w->mean = (float)acc.sum/w->n;
+    return adc_block_valid(r, first); // the leaves are rewritten only when their samples are
+}
@@ -0,0 +1,55 @@
+/*
+ * adc_summary.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Min/max summary of the ADC ring: the minimum, maximum and sum of every
+ * 64-sample block, kept by the acquisition side as blocks are published, and a
+ * tree over the blocks for the min, max and mean of any recent window
+ */
+
+#ifndef ADC_SUMMARY_H_
+#define ADC_SUMMARY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_block.h"
+
+#define ADC_SUMMARY_BLOCK 64        // samples per summary block, a power of 2
+#define ADC_SUMMARY_MAX_LEAVES 256  // most summary blocks, for a ring of up to 16384 samples
+
+// min, max and sum of a run of samples
+typedef struct {
+    uint16_t min, max;
+    uint32_t sum;
+} adc_summary_node;
+
+// summary of the ring, one leaf per summary block and sample n in leaf (n/ADC_SUMMARY_BLOCK) mod leaves
+typedef struct adc_summary {
+    uint32_t leaves;    // ring size/ADC_SUMMARY_BLOCK, a power of 2
+    uint64_t start;     // sequence number of the first sample summarized, a multiple of ADC_SUMMARY_BLOCK
+    adc_summary_node node[2*ADC_SUMMARY_MAX_LEAVES]; // node 1 is the root, node i covers nodes 2i and 2i + 1,
+                                                     // the leaves are nodes leaves to 2*leaves - 1
+} adc_summary;
+
+// min, max and mean of a window of samples
+typedef struct {
+    uint64_t first;     // sequence number of the first sample
+    uint32_t n;         // samples, whole summary blocks (0 when none was summarized)
+    uint16_t min, max;  // [ADC counts]
+    float mean;         // [ADC counts]
+} adc_window;
+
+// starts summarizing r in s from the next whole summary block on, before the driver interrupt runs
+void adc_summary_attach(adc_summary *s, adc_block_ring *r);
+
+// summarizes the summary blocks completed by samples first to first + n - 1 of buffer (a ring of leaves
+// summary blocks), from adc_block_publish() before the sequence moves past them
+void adc_summary_add(adc_summary *s, const volatile uint16_t *buffer, uint32_t first, uint32_t n);
+
+// min, max and mean of the whole summary blocks among the n samples before sequence number end, in O(log n)
+// without reading the samples. false if any was overwritten meanwhile (w is then meaningless)
+bool adc_summary_window(const adc_summary *s, const adc_block_ring *r, uint64_t end, uint32_t n, adc_window *w);
+
+#endif /* ADC_SUMMARY_H_ */
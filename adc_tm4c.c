@@ -0,0 +1,137 @@
+/*
+ * adc_tm4c.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * ADC1 acquisition driver on the TM4C1294: AIN3 sampled continuously into an
+ * adc_block_ring, one interrupt per block
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/adc.h"
+#include "driverlib/udma.h"
+#include "inc/tm4c1294ncpdt.h"
+#include "peripherals.h"
+#include "adc_block.h"
+
+#ifndef ADC_UDMA
+#define ADC_UDMA 1          // 1: uDMA ping-pong into blocks of ADC_DMA_BLOCK, 0: one interrupt per full sequencer FIFO
+#endif
+#define ADC_DMA_BLOCK 1024  // [samples] uDMA block, the largest transfer of one control structure
+// the one-step sequence raises a uDMA request per conversion with one word in the FIFO, so every request
+// moves exactly one sample: a burst of 4 would read 3 words from an empty FIFO and shift the ring
+#define ADC_DMA_ARB UDMA_ARB_1
+#define ADC_FIFO_BLOCK 8    // [samples] steps of sequence 0, the depth of its FIFO
+#define ADC_DMA_CHANNEL UDMA_SEC_CHANNEL_ADC10 // uDMA channel 24, ADC1 sequence 0
+
+static adc_block_ring *ring; // ring the interrupt fills
+
+#if ADC_UDMA
+#pragma DATA_ALIGN(dma_control, 1024)
+static tDMAControlTable dma_control[64];    // uDMA channel control structures, primary then alternate
+static bool dma_primary = true;             // the control structure whose block completes next
+#endif
+
+// set up ADC1 sequence 0 on AIN3 and start it
+uint32_t adc_driver_init(adc_block_ring *r, volatile uint16_t *buffer, uint32_t size)
+{
+    uint32_t fs;
+
+    // GPIO setup for analog input AIN3
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
+    GPIOPinTypeADC(GPIO_PORTE_BASE, GPIO_PIN_0);
+
+    // initialize ADC1 peripheral
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC1);
+    uint32_t pll_frequency = SysCtlFrequencyGet(CRYSTAL_FREQUENCY);
+    uint32_t pll_divisor = (pll_frequency - 1) / (16 * ADC_SAMPLING_RATE) + 1;  // round divisor up
+    fs = pll_frequency / (16 * pll_divisor);                                    // actual sampling rate may differ from ADC_SAMPLING_RATE
+    ADCClockConfigSet(ADC1_BASE, ADC_CLOCK_SRC_PLL | ADC_CLOCK_RATE_FULL, pll_divisor);
+
+    ring = r;
+    ADCSequenceDisable(ADC1_BASE, 0);                           // choose ADC1 sequence 0; disable before configuring
+    ADCSequenceConfigure(ADC1_BASE, 0, ADC_TRIGGER_ALWAYS, 0);  // specify the "timer" trigger
+
+#if ADC_UDMA
+    adc_block_init(r, buffer, size, ADC_DMA_BLOCK);
+
+    // one step per conversion, the uDMA moves each FIFO word into the ring as it arrives (ADC_DMA_ARB)
+    ADCSequenceStepConfigure(ADC1_BASE, 0, 0, ADC_CTL_IE | ADC_CTL_END | ADC_CTL_CH3);
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    uDMAEnable();
+    uDMAControlBaseSet(dma_control);
+    uDMAChannelAssign(UDMA_CH24_ADC1_0);
+    uDMAChannelAttributeDisable(ADC_DMA_CHANNEL, UDMA_ATTR_ALL);
+
+    // ping-pong: the primary structure fills the first block, the alternate one the second
+    uDMAChannelControlSet(ADC_DMA_CHANNEL | UDMA_PRI_SELECT, UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16 | ADC_DMA_ARB);
+    uDMAChannelControlSet(ADC_DMA_CHANNEL | UDMA_ALT_SELECT, UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16 | ADC_DMA_ARB);
+    uDMAChannelTransferSet(ADC_DMA_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_PINGPONG,
+                           (void *)&ADC1_SSFIFO0_R, (void *)adc_block_dest(r, 0), ADC_DMA_BLOCK);
+    uDMAChannelTransferSet(ADC_DMA_CHANNEL | UDMA_ALT_SELECT, UDMA_MODE_PINGPONG,
+                           (void *)&ADC1_SSFIFO0_R, (void *)adc_block_dest(r, 1), ADC_DMA_BLOCK);
+    dma_primary = true;
+    uDMAChannelAttributeEnable(ADC_DMA_CHANNEL, UDMA_ATTR_HIGH_PRIORITY);
+    uDMAChannelEnable(ADC_DMA_CHANNEL);
+
+    // interrupt when a control structure completes its block
+    ADCSequenceDMAEnable(ADC1_BASE, 0);
+    ADCSequenceEnable(ADC1_BASE, 0);            // enable the sequence.  it is now sampling
+    ADCIntEnableEx(ADC1_BASE, ADC_INT_DMA_SS0); // enable the sequence 0 uDMA interrupt in the ADC1 peripheral
+#else
+    int step;
+    adc_block_init(r, buffer, size, ADC_FIFO_BLOCK);
+
+    // every step on AIN3, the last one interrupts with the FIFO full
+    for (step = 0; step < ADC_FIFO_BLOCK - 1; step++)
+        ADCSequenceStepConfigure(ADC1_BASE, 0, step, ADC_CTL_CH3);
+    ADCSequenceStepConfigure(ADC1_BASE, 0, step, ADC_CTL_IE | ADC_CTL_END | ADC_CTL_CH3);
+
+    ADCSequenceEnable(ADC1_BASE, 0);    // enable the sequence.  it is now sampling
+    ADCIntEnable(ADC1_BASE, 0);         // enable sequence 0 interrupt in the ADC1 peripheral
+#endif
+    return fs;
+}
+
+// ADC interrupt service routine, one per block
+void ADC_ISR(void)
+{
+#if ADC_UDMA
+    ADCIntClearEx(ADC1_BASE, ADC_INT_DMA_SS0); // clears ADC interrupt flag
+
+    // publish every block completed since the last interrupt in order, and re-arm its structure one block
+    // past the one the other structure is filling
+    while (true) {
+        uint32_t select = dma_primary ? UDMA_PRI_SELECT : UDMA_ALT_SELECT;
+        if (uDMAChannelModeGet(ADC_DMA_CHANNEL | select) != UDMA_MODE_STOP)
+            break;
+        adc_block_publish(ring);
+        uDMAChannelTransferSet(ADC_DMA_CHANNEL | select, UDMA_MODE_PINGPONG,
+                               (void *)&ADC1_SSFIFO0_R, (void *)adc_block_dest(ring, 1), ADC_DMA_BLOCK);
+        dma_primary = !dma_primary;
+    }
+    if (!uDMAChannelIsEnabled(ADC_DMA_CHANNEL)) { // both blocks completed before the interrupt ran, samples were lost
+        ring->errors++;
+        uDMAChannelEnable(ADC_DMA_CHANNEL);
+    }
+#else
+    int i;
+    volatile uint16_t *dest = adc_block_dest(ring, 0);
+
+    ADC1_ISC_R = ADC_ISC_IN0;           // clears ADC interrupt flag
+    for (i = 0; i < ADC_FIFO_BLOCK; i++)
+        dest[i] = ADC1_SSFIFO0_R;       // read the sequence 0 FIFO
+    adc_block_publish(ring);            // the block is in place
+#endif
+
+    if (ADC1_OSTAT_R & ADC_OSTAT_OV0) { // check for ADC FIFO overflow
+        ring->errors++;                 // count errors
+        ADC1_OSTAT_R = ADC_OSTAT_OV0;   // clear overflow condition
+    }
+}
@@ -0,0 +1,182 @@
+/*
+ * analysis.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Dynamic-performance measurement on the FFT bins: fundamental, harmonics,
+ * noise floor, THD, SNR, SINAD, SFDR and ENOB
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "window.h"
+#include "analysis.h"
+
+#define ANALYSIS_NOISE_PASSES 3     // noise floor estimates, each ignoring the bins far above the one before
+#define ANALYSIS_NOISE_CLIP 10.0f   // bins 10 dB above the mean noise are not noise; exponentially distributed
+                                    // noise bins exceed this once in e^10, which biases the mean by -0.002 dB
+#ifdef FIXED_POINT
+#define ANALYSIS_NOISE_MIN (1.0f/6) // [LSB^2] mean noise bin at most the rounding of the bin itself, 1/12 in re and im
+#else
+#define ANALYSIS_NOISE_MIN 0.0f
+#endif
+
+// a run of bins taken by a tone, inclusive
+typedef struct {
+    int lo, hi;
+} bin_range;
+
+// a tone of peak amplitude A puts nfft^2*A^2*cg^2*enbw/4 into the sum of its one-sided bins |X|^2, and white
+// noise of variance s^2 puts nfft*s^2*cg^2*enbw into each bin, so one scale turns both into ADC counts^2:
+// the tone power A^2/2 and the noise power in one bin width. the ratios below do not depend on the window
+
+// |bin k|^2
+static float bin_power(const kiss_fft_cpx *bins, int k)
+{
+    float re = bins[k].r, im = bins[k].i;
+    return re*re + im*im;
+}
+
+// whether bin k is in one of the ranges
+static bool in_ranges(const bin_range *ranges, int n, int k)
+{
+    int i;
+    for (i = 0; i < n; i++)
+        if (k >= ranges[i].lo && k <= ranges[i].hi)
+            return true;
+    return false;
+}
+
+// 10*log10(num/den), clamped to +-200 dB so an empty sum stays printable
+static float db_ratio(float num, float den)
+{
+    if (num <= 0)
+        return ANALYSIS_DB_NONE;
+    if (den <= 0 || num > den*1e20f)
+        return -ANALYSIS_DB_NONE;
+    float db = 10*log10f(num/den);
+    return db < ANALYSIS_DB_NONE ? ANALYSIS_DB_NONE : db;
+}
+
+// frequency f in bins folded back into 0 to nfft/2, where a harmonic above fs/2 aliases
+static float fold(float f, int nfft)
+{
+    f = fmodf(f, (float)nfft);
+    return f > nfft/2 ? nfft - f : f;
+}
+
+// measures one spectrum
+void analysis_run(analysis_result *r, const kiss_fft_cpx *bins, int kmin, int kmax, int nfft, uint32_t fs,
+                  const window_table *wt, float power_scale)
+{
+    bin_range taken[ANALYSIS_HARMONICS + 1];    // dc, the fundamental and the harmonics, left out of the noise
+    int ntaken = 0;
+    int lobe = window_lobe_bins(wt) + 1;        // a tone between bins spreads one bin further than the main lobe
+    float tone_scale = 2*power_scale/((float)nfft*nfft*wt->coherent_gain*wt->coherent_gain*wt->enbw);
+    float p0 = 0, p1 = 0, m1 = 0, ph = 0, pn, spur = 0;
+    int k, k0 = -1, h, nn, pass;
+
+    r->valid = r->noise_valid = false;
+    r->harmonics = 0;
+    for (h = 2; h <= ANALYSIS_HARMONICS; h++)
+        r->harmonic_dbc[h - 2] = ANALYSIS_DB_NONE;
+
+    // dc lobe, what is left of the offset after the dc removal
+    taken[ntaken].lo = 0;
+    taken[ntaken++].hi = lobe;
+
+    // fundamental: the strongest bin clear of dc, summed over its lobe
+    for (k = kmin > lobe ? kmin : lobe + 1; k <= kmax; k++) {
+        float p = bin_power(bins, k);
+        if (p > p0) {
+            p0 = p;
+            k0 = k;
+        }
+    }
+    if (k0 < 0)
+        return; // nothing above dc
+
+    taken[ntaken].lo = k0 - lobe > kmin ? k0 - lobe : kmin;
+    taken[ntaken].hi = k0 + lobe < kmax ? k0 + lobe : kmax;
+    for (k = taken[ntaken].lo; k <= taken[ntaken].hi; k++) {
+        float p = bin_power(bins, k);
+        p1 += p;
+        m1 += p*k;
+    }
+    ntaken++;
+    float f0 = m1/p1; // [bins] between bins, unlike the peak
+
+    // harmonics: the strongest bin within one bin of h*f0, summed over its lobe without bins already taken
+    for (h = 2; h <= ANALYSIS_HARMONICS; h++) {
+        int kh = (int)(fold(h*f0, nfft) + 0.5f), best = -1;
+        float sum = 0;
+
+        for (k = kh - 1; k <= kh + 1; k++)
+            if (k >= kmin && k <= kmax && (best < 0 || bin_power(bins, k) > bin_power(bins, best)))
+                best = k;
+        if (best < 0 || in_ranges(taken, ntaken, best))
+            continue; // outside the bins, or on dc, the fundamental or a lower harmonic
+
+        int lo = best - lobe > kmin ? best - lobe : kmin;
+        int hi = best + lobe < kmax ? best + lobe : kmax;
+        for (k = lo; k <= hi; k++)
+            if (!in_ranges(taken, ntaken, k))
+                sum += bin_power(bins, k);
+        taken[ntaken].lo = lo;
+        taken[ntaken++].hi = hi;
+
+        r->harmonic_dbc[h - 2] = db_ratio(sum, p1);
+        r->harmonics++;
+        ph += sum;
+    }
+
+    // spurs: the largest bin outside dc and the fundamental
+    for (k = kmin; k <= kmax; k++) {
+        float p = bin_power(bins, k);
+        if (k > lobe && (k < taken[1].lo || k > taken[1].hi) && p > spur)
+            spur = p;
+    }
+
+    // noise floor: the mean of the bins not taken by a tone, again without the bins well above the last mean,
+    // which are spurs and the window sidelobes of strong tones rather than noise. a pass that leaves out most
+    // bins is not clipping outliers (e.g. a noise floor below the fixed-point LSB), the last mean stands
+    float noise_bin = 0, limit = -1;    // mean noise of one bin, no limit in the first pass
+    int nfirst = 0;                     // bins of the first pass
+    for (pass = 0; pass < ANALYSIS_NOISE_PASSES; pass++) {
+        pn = 0;
+        nn = 0;
+        for (k = kmin; k <= kmax; k++) {
+            float p = bin_power(bins, k);
+            if ((limit < 0 || p < limit) && !in_ranges(taken, ntaken, k)) {
+                pn += p;
+                nn++;
+            }
+        }
+        if (pass == 0)
+            nfirst = nn;
+        if (nn == 0 || 2*nn < nfirst)
+            break;
+        noise_bin = pn/nn;
+        limit = noise_bin*ANALYSIS_NOISE_CLIP;
+    }
+    float noise = noise_bin*(nfft/2);       // over the Nyquist band, where the bins not measured are assumed alike
+
+    r->f0_hz = f0*fs/nfft;
+    r->amplitude = sqrtf(2*p1*tone_scale);
+    r->noise_rms = sqrtf(noise*tone_scale);
+    r->thd_db = db_ratio(ph, p1);
+    r->sfdr_db = db_ratio(p0, spur);
+    r->noise_valid = noise_bin > ANALYSIS_NOISE_MIN; // else the FFT rounded the noise away, the ratios would be bogus
+    if (r->noise_valid) {
+        r->noise_dbc_hz = db_ratio(noise_bin*nfft, p1*fs);
+        r->snr_db = db_ratio(p1, noise);
+        r->sinad_db = db_ratio(p1, noise + ph);
+        r->enob = (r->sinad_db - 1.76f)/6.02f;
+    } else {
+        r->noise_dbc_hz = r->snr_db = r->sinad_db = r->enob = ANALYSIS_DB_NONE;
+    }
+    r->valid = true;
+}
@@ -0,0 +1,50 @@
+/*
+ * analysis.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Dynamic-performance measurement on the FFT bins: fundamental, harmonics,
+ * noise floor, THD, SNR, SINAD, SFDR and ENOB
+ */
+
+#ifndef ANALYSIS_H_
+#define ANALYSIS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "kiss_fft.h"
+#include "window.h"
+
+#define ANALYSIS_HARMONICS 6        // highest harmonic measured, the fundamental is the first
+#define ANALYSIS_DB_NONE (-200.0f)  // [dB] level reported for nothing measured, e.g. a harmonic outside the bins
+
+// results of one spectrum, ratios in dB relative to the fundamental
+typedef struct {
+    bool valid;                                 // a fundamental was found, the rest is meaningless otherwise
+    bool noise_valid;                           // a noise floor was measured, else SNR, SINAD and ENOB are not
+    float f0_hz;                                // [Hz] fundamental frequency, power-weighted over its main lobe
+    float amplitude;                            // [ADC counts] fundamental peak amplitude
+    int harmonics;                              // harmonics measured, 2 to ANALYSIS_HARMONICS
+    float harmonic_dbc[ANALYSIS_HARMONICS - 1]; // [dBc] harmonics 2, 3, ..., ANALYSIS_DB_NONE when not measured
+    float noise_dbc_hz;                         // [dBc/Hz] noise floor density, tones and spurs excluded
+    float noise_rms;                            // [ADC counts] rms noise over the Nyquist band
+    float thd_db;                               // [dBc] total power of the measured harmonics
+    float snr_db;                               // [dB] fundamental to noise over the Nyquist band
+    float sinad_db;                             // [dB] fundamental to noise plus harmonics
+    float sfdr_db;                              // [dB] fundamental peak bin to the largest other peak bin
+    float enob;                                 // [bits] (SINAD - 1.76 dB)/6.02 dB, ANALYSIS_DB_NONE with SINAD
+} analysis_result;
+
+// measures bins kmin to kmax (inclusive) of an nfft-point real FFT at sampling rate fs, windowed by wt.
+// power_scale turns |bin|^2 into |DFT of the windowed ADC counts|^2 (1 in the float build).
+// the fundamental is the strongest peak clear of dc; each tone is summed over its main lobe plus one bin,
+// harmonics are searched around multiples of the fundamental folded back below fs/2. the noise floor is the
+// mean of the remaining bins without spurs and window sidelobes, scaled to the Nyquist band, so a span narrower
+// than Nyquist assumes white noise, and harmonics beyond kmax are left out of THD. spurs that are not
+// harmonics count against SFDR only. a noise floor at or below the rounding of the bins (zero in the float
+// build) was not measured: noise_valid is false and SNR, SINAD, ENOB and the noise density are ANALYSIS_DB_NONE
+void analysis_run(analysis_result *r, const kiss_fft_cpx *bins, int kmin, int kmax, int nfft, uint32_t fs,
+                  const window_table *wt, float power_scale);
+
+#endif /* ANALYSIS_H_ */
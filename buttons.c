@@ -35,6 +35,15 @@
 #include "Crystalfontz128x128_ST7735.h"
 #include "math.h"
 #include "peripherals.h"
+#include "window.h"
+#include "spectrum.h"
+#include "fft_plan.h"
+#include "markers.h"
+#include "zoom.h"
+#include "welch.h"
+#include "trigger.h"
+
+#define TRIGGER_PRE_STEP 16 // [samples] joystick step of the trigger column
 
 // clock globals
 extern uint32_t gSystemClock; // [Hz] system clock frequency
@@ -50,7 +59,6 @@ volatile uint32_t stateVperDiv = 4; // 5 states
 // ADC globals
 uint32_t gADCSamplingRate;      // [Hz] actual ADC sampling rate
 extern volatile uint16_t gADCBuffer[ADC_BUFFER_SIZE];           // circular buffer
-extern volatile int32_t gADCBufferIndex;    // latest sample index
 
 // CPU load globals
 extern uint32_t countUnloaded;
@@ -219,6 +227,18 @@ void buttonTask_func(UArg arg1, UArg arg2)
         presses |= ButtonAutoRepeat();              // autorepeat presses if a button is held long enough
         char button_char;
 
+        if (presses & 1) { // button 0 pressed
+            // next FFT window
+            button_char = 'w';
+            Mailbox_post(mailbox0, &button_char, TIMEOUT);
+        }
+
+        if (presses & 16) { // joystick select pressed
+            // next FFT length (resolution bandwidth)
+            button_char = 'r';
+            Mailbox_post(mailbox0, &button_char, TIMEOUT);
+        }
+
         if (presses & 2) { // button 1 pressed
             // trigger slope change
             button_char = 't';
@@ -232,10 +252,34 @@ void buttonTask_func(UArg arg1, UArg arg2)
         }
 
         if (presses & 8) { // boosterpack button 2 pressed
-            // spectrum mode
+            // next spectrum trace, then the waterfall, then oscilloscope mode
             button_char = 's';
             Mailbox_post(mailbox0, &button_char, TIMEOUT);
         }
+
+        if (presses & 32) { // joystick right
+            // zoom center up, or more overlap
+            button_char = '>';
+            Mailbox_post(mailbox0, &button_char, TIMEOUT);
+        }
+
+        if (presses & 64) { // joystick left
+            // zoom center down, or less overlap
+            button_char = '<';
+            Mailbox_post(mailbox0, &button_char, TIMEOUT);
+        }
+
+        if (presses & 128) { // joystick up
+            // zoom in
+            button_char = '+';
+            Mailbox_post(mailbox0, &button_char, TIMEOUT);
+        }
+
+        if (presses & 256) { // joystick down
+            // zoom out
+            button_char = '-';
+            Mailbox_post(mailbox0, &button_char, TIMEOUT);
+        }
     }
 }
 
@@ -250,20 +294,87 @@ void userInputTask_func(UArg arg1, UArg arg2)
         // read bpresses and change stats
         if (Mailbox_pend(mailbox0, &bpresses, TIMEOUT)) {
             int i;
+            uint32_t window = stateWindow, nfft = stateNfft;        // requested spectrum settings
+            uint32_t zoom = stateZoom, center = stateZoomCenter;    // requested zoom settings
 
             Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
 
             for (i = 0; i < 10; i++){
                 if (bpresses[i]==('u') && gButtons == 4) {          // increment state
-                    stateVperDiv = (++stateVperDiv) % 5;
+                    if (spectrumMode)
+                        stateSpan = (stateSpan + 1) % SPECTRUM_SPAN_COUNT;
+                    else
+                        stateVperDiv = (++stateVperDiv) % 5;
                 } else if (bpresses[i]==('t') && gButtons == 2) {   // trigger
-                    risingSlope = !risingSlope;
-                } else if (bpresses[i]==('s') && gButtons == 8) {   // spectrum mode
-                    spectrumMode = !spectrumMode;
+                    if (spectrumMode && stateMarkers && zoom == 0)
+                        stateMarkerCommand = MARKER_DELTA;
+                    else if (spectrumMode)
+                        stateDetector = (stateDetector + 1) % DETECTOR_COUNT;
+                    else
+                        risingSlope = !risingSlope;
+                } else if (bpresses[i]==('s') && gButtons == 8) {   // spectrum mode, trace, measurement, markers and waterfall
+                    if (!spectrumMode) {
+                        spectrumMode = true;
+                        stateTrace = TRACE_LIVE;
+                    } else if (stateWaterfall) {
+                        stateWaterfall = false;
+                        spectrumMode = false;
+                    } else if (stateTrace == TRACE_LIVE && !stateAnalysis && !stateMarkers) {
+                        stateAnalysis = true; // live trace with the distortion measurement
+                    } else if (stateAnalysis) {
+                        stateAnalysis = false;
+                        stateMarkers = true; // live trace with the markers
+                    } else if (stateTrace + 1 < TRACE_COUNT) {
+                        stateMarkers = false;
+                        stateTrace++;
+                    } else {
+                        stateTrace = TRACE_LIVE; // waterfall of the live spectrum
+                        stateWaterfall = true;
+                    }
+                } else if (bpresses[i]==('w') && gButtons == 1) {   // next FFT window
+                    window = (window + 1) % WINDOW_COUNT;
+                } else if (bpresses[i]==('r') && gButtons == 16) {  // next FFT length
+                    nfft = nfft < FFT_PLAN_MAX_NFFT ? nfft*2 : FFT_PLAN_MIN_NFFT;
+                } else if (bpresses[i]==('+') && gButtons == 128) { // zoom in, or the next trigger mode
+                    if (spectrumMode && zoom < ZOOM_FACTOR_COUNT) {
+                        zoom++;
+                    } else if (!spectrumMode) {
+                        stateTriggerMode = (stateTriggerMode + 1) % TRIGGER_MODE_COUNT;
+                        stateTriggerArm = stateTriggerMode == TRIGGER_SINGLE;
+                    }
+                } else if (bpresses[i]==('-') && gButtons == 256) { // zoom out, back to the full span, or rearm single
+                    if (spectrumMode && zoom > 0)
+                        zoom--;
+                    else if (!spectrumMode)
+                        stateTriggerArm = true;
+                } else if ((bpresses[i]==('>') && gButtons == 32) || (bpresses[i]==('<') && gButtons == 64)) { // zoom center or marker
+                    if (spectrumMode && zoom > 0) {
+                        uint32_t step = ZOOM_NCO_SIZE/(8*(ZOOM_FACTOR_MIN << (zoom - 1))); // about one division
+                        if (bpresses[i] == '>')
+                            center = center + step < ZOOM_NCO_SIZE/2 ? center + step : ZOOM_NCO_SIZE/2;
+                        else
+                            center = center > step ? center - step : 0;
+                    } else if (spectrumMode && stateMarkers) { // next peak left or right
+                        stateMarkerCommand = bpresses[i] == '>' ? MARKER_RIGHT : MARKER_LEFT;
+                    } else if (spectrumMode) { // overlap of the averaged segments
+                        if (bpresses[i] == '>' && stateOverlap + 1 < WELCH_OVERLAP_COUNT)
+                            stateOverlap++;
+                        else if (bpresses[i] == '<' && stateOverlap > 0)
+                            stateOverlap--;
+                    } else { // trigger column, about one division
+                        if (bpresses[i] == '>')
+                            stateTriggerPre = stateTriggerPre + TRIGGER_PRE_STEP < ADC_TRIGGER_SIZE ?
+                                    stateTriggerPre + TRIGGER_PRE_STEP : ADC_TRIGGER_SIZE - 1;
+                        else
+                            stateTriggerPre = stateTriggerPre > TRIGGER_PRE_STEP ? stateTriggerPre - TRIGGER_PRE_STEP : 0;
+                    }
                 }
             }
 
             Semaphore_post(sem_cs);
+
+            if (window != stateWindow || nfft != stateNfft || zoom != stateZoom || center != stateZoomCenter)
+                spectrumSelect(window, nfft, zoom, center); // builds the window and plans outside the critical section
         }
 
         Semaphore_post(semDisplay); // to display
@@ -0,0 +1,111 @@
+/*
+ * counter.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Frequency counter: the strongest FFT peak interpolated between bins,
+ * cross-checked by timing zero crossings of the ADC samples
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "window.h"
+#include "counter.h"
+
+#define COUNTER_STEP 1e-3f  // [bins] step of the numeric derivative of the Newton fit
+
+// |bin k|
+static float bin_magnitude(const kiss_fft_cpx *bins, int k)
+{
+    float re = bins[k].r, im = bins[k].i;
+    return sqrtf(re*re + im*im);
+}
+
+// log of the ratio of the bins after and before the peak for a tone delta bins past the peak bin
+static float neighbour_log_ratio(const window_table *wt, float delta)
+{
+    return logf(window_response(wt, 1 - delta)) - logf(window_response(wt, 1 + delta));
+}
+
+// interpolated FFT peak
+void counter_fft(counter_result *r, const kiss_fft_cpx *bins, int kmin, int kmax, int nfft, uint32_t fs,
+                 const window_table *wt, float power_scale)
+{
+    int lobe = window_lobe_bins(wt);
+    int k, k0 = -1, i;
+    float m0 = 0;
+
+    r->valid = false;
+
+    // strongest bin clear of dc, with a neighbour either side
+    for (k = (kmin > lobe ? kmin : lobe + 1) + 1; k < kmax; k++) {
+        float m = bin_magnitude(bins, k);
+        if (m > m0) {
+            m0 = m;
+            k0 = k;
+        }
+    }
+    float lo = k0 < 0 ? 0 : bin_magnitude(bins, k0 - 1);
+    float hi = k0 < 0 ? 0 : bin_magnitude(bins, k0 + 1);
+    if (k0 < 0 || lo <= 0 || hi <= 0)
+        return; // no peak, or a neighbour too weak to interpolate
+
+    // start from a parabola through the log magnitudes, then fit the window response to the neighbours
+    float target = logf(hi/lo);
+    float delta = target/(2*(2*logf(m0) - logf(lo) - logf(hi)));
+    for (i = 0; i < COUNTER_ITERATIONS; i++) {
+        if (delta > 0.5f) delta = 0.5f;
+        if (delta < -0.5f) delta = -0.5f;
+        float g = neighbour_log_ratio(wt, delta) - target;
+        float slope = (neighbour_log_ratio(wt, delta + COUNTER_STEP) - neighbour_log_ratio(wt, delta - COUNTER_STEP))/(2*COUNTER_STEP);
+        if (slope == 0)
+            break;
+        delta -= g/slope;
+    }
+    if (delta > 0.5f) delta = 0.5f;
+    if (delta < -0.5f) delta = -0.5f;
+
+    // a tone of peak amplitude A gives |X| = nfft*A*cg/2 on its bin, times the response off the bin
+    r->delta = delta;
+    r->fft_hz = (k0 + delta)*fs/nfft;
+    r->amplitude = 2*m0*sqrtf(power_scale)/(nfft*wt->coherent_gain*window_response(wt, delta));
+    r->valid = true;
+}
+
+// zero-crossing period counter
+void counter_zero_cross(counter_result *r, const volatile uint16_t *ring, uint32_t ring_size, uint32_t first,
+                        int n, int32_t level, int32_t hysteresis, uint32_t fs)
+{
+    uint32_t mask = ring_size - 1;
+    int32_t prev = ring[first & mask];
+    bool armed = prev < level - hysteresis;     // below the hysteresis band since the last crossing
+    int i, crossings = 0, first_i = 0, last_i = 0;
+    float first_frac = 0, last_frac = 0;        // [samples] crossing times past first_i and last_i
+
+    for (i = 1; i < n; i++) {
+        int32_t x = ring[(first + i) & mask];
+        if (x < level - hysteresis) {
+            armed = true;
+        } else if (armed && x >= level) {
+            // rising through level between the sample before, which is below it, and this one
+            float frac = (float)(level - prev)/(x - prev);
+            if (crossings == 0) {
+                first_i = i - 1;
+                first_frac = frac;
+            }
+            last_i = i - 1;
+            last_frac = frac;
+            crossings++;
+            armed = false;
+        }
+        prev = x;
+    }
+
+    r->zc_periods = crossings > 1 ? crossings - 1 : 0;
+    r->zc_valid = r->zc_periods > 0;
+    if (r->zc_valid) // whole samples and fractions apart, so the span keeps its precision
+        r->zc_hz = r->zc_periods*(float)fs/((last_i - first_i) + (last_frac - first_frac));
+}
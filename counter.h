@@ -0,0 +1,46 @@
+/*
+ * counter.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Frequency counter: the strongest FFT peak interpolated between bins,
+ * cross-checked by timing zero crossings of the ADC samples
+ */
+
+#ifndef COUNTER_H_
+#define COUNTER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "kiss_fft.h"
+#include "window.h"
+
+#define COUNTER_ITERATIONS 4    // Newton steps fitting the window response to the bins either side of the peak
+
+// one reading
+typedef struct {
+    bool valid;                 // a peak was found, fft_hz and amplitude are meaningful
+    float fft_hz;               // [Hz] frequency of the strongest peak, interpolated between bins
+    float delta;                // [bins] offset of the peak from its strongest bin, -0.5 to 0.5
+    float amplitude;            // [ADC counts] peak amplitude, corrected for the offset from the bin
+    bool zc_valid;              // at least one whole period was timed, zc_hz is meaningful
+    float zc_hz;                // [Hz] frequency from the zero-crossing period counter
+    int zc_periods;             // whole periods timed
+} counter_result;
+
+// finds the strongest bin of kmin to kmax (inclusive) clear of dc in an nfft-point real FFT at sampling rate fs,
+// windowed by wt, and fits the window response to it and its neighbours for the tone frequency and amplitude.
+// power_scale turns |bin|^2 into |DFT of the windowed ADC counts|^2 (1 in the float build).
+// sets the FFT fields of r and leaves the zero-crossing fields alone
+void counter_fft(counter_result *r, const kiss_fft_cpx *bins, int kmin, int kmax, int nfft, uint32_t fs,
+                 const window_table *wt, float power_scale);
+
+// times rising crossings of level over n samples of a circular buffer of ring_size (a power of 2), starting at
+// sample first, at sampling rate fs: a crossing counts once the signal was below level - hysteresis, and its time
+// is interpolated between the samples either side. the frequency is the whole periods between the first and last
+// crossings over their time. sets the zero-crossing fields of r and leaves the FFT fields alone
+void counter_zero_cross(counter_result *r, const volatile uint16_t *ring, uint32_t ring_size, uint32_t first,
+                        int n, int32_t level, int32_t hysteresis, uint32_t fs);
+
+#endif /* COUNTER_H_ */
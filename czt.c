@@ -0,0 +1,162 @@
+/*
+ * czt.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Chirp-z transform (Bluestein's algorithm) on the power-of-2 FFT: M bins at any
+ * start frequency and spacing from N samples, or a DFT of any length
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "fft_codelets.h"
+#include "czt.h"
+
+#ifndef FIXED_POINT // the chirps and the 1/l scaled filter need floating point: a float-build library
+
+#define PI 3.14159265358979323846
+#define CZT_ROUND(n) (((n) + 7) & ~(size_t)7) // keeps the tables after the FFT state 8-byte aligned
+
+// convolution FFT length: smallest power of 2 >= n + m - 1, at least CZT_MIN_L
+static int czt_length(int n, int m)
+{
+    int l = CZT_MIN_L;
+    while (l < n + m - 1)
+        l <<= 1;
+    return l;
+}
+
+// bytes of mem for n samples and m bins
+size_t czt_mem_size(int n, int m)
+{
+    if (n < 1 || m < 1 || n + m - 1 > CZT_MAX_L)
+        return 0;
+    int l = czt_length(n, m);
+    return CZT_ROUND(KISS_FFT_CFG_TABLES_BYTES) + sizeof(kiss_fft_cpx)*(n + m + 2*l);
+}
+
+// m bins evenly covering f_lo to f_hi
+bool czt_init_span(czt_plan *plan, int n, int m, float fs, float f_lo, float f_hi, void *mem, size_t len)
+{
+    double step = m > 1 ? ((double)f_hi - f_lo)/(m - 1) : 0;
+    return czt_init(plan, n, m, f_lo/(double)fs, step/fs, mem, len);
+}
+
+// DFT of any length
+bool czt_init_dft(czt_plan *plan, int n, void *mem, size_t len)
+{
+    return czt_init(plan, n, n, 0, 1.0/n, mem, len);
+}
+
+
+// exp(-2*pi*j*t), t in cycles reduced to [0, 1) first so large chirp phases stay exact
+static kiss_fft_cpx cexp_cycles(double t)
+{
+    kiss_fft_cpx c;
+    t -= floor(t);
+    c.r = (kiss_fft_scalar)cos(2*PI*t);
+    c.i = (kiss_fft_scalar)-sin(2*PI*t);
+    return c;
+}
+
+// builds the chirps and the filter spectrum
+bool czt_init(czt_plan *plan, int n, int m, double f_start, double f_step, void *mem, size_t len)
+{
+    size_t need = czt_mem_size(n, m);
+    if (need == 0 || mem == NULL || len < need)
+        return false;
+
+    int l = czt_length(n, m);
+    const fft_table_entry *t = fft_table_find(2*l); // tables of the l-point complex sub-FFT
+    size_t cfg_len = KISS_FFT_CFG_TABLES_BYTES;
+    plan->cfg = kiss_fft_alloc_tables(l, fft_twiddles, FFT_TABLE_MAX_NFFT/2, t->swaps, t->nswaps,
+                                      t->stage_twiddles, mem, &cfg_len);
+    if (plan->cfg == NULL)
+        return false;
+    kiss_fft_set_codelet(plan->cfg, fft_codelet_find(l));
+
+    plan->n = n;
+    plan->m = m;
+    plan->l = l;
+    plan->f_start = f_start;
+    plan->f_step = f_step;
+    plan->pre = (kiss_fft_cpx *)((char *)mem + CZT_ROUND(KISS_FFT_CFG_TABLES_BYTES));
+    plan->post = plan->pre + n;
+    plan->filter = plan->post + m;
+    plan->buf = plan->filter + l;
+
+    // i*k = (i^2 + k^2 - (k - i)^2)/2 turns the transform into a convolution with the chirp W^(-j^2/2)
+    int i;
+    for (i = 0; i < n; i++)
+        plan->pre[i] = cexp_cycles(i*f_start + 0.5*(double)i*i*f_step);
+    for (i = 0; i < m; i++)
+        plan->post[i] = cexp_cycles(0.5*(double)i*i*f_step);
+
+    for (i = 0; i < l; i++)
+        plan->filter[i].r = plan->filter[i].i = 0;
+    for (i = 0; i < m; i++)
+        plan->filter[i] = cexp_cycles(-0.5*(double)i*i*f_step);
+    for (i = 1; i < n; i++)
+        plan->filter[l - i] = cexp_cycles(-0.5*(double)i*i*f_step); // negative lags wrap around
+    kiss_fft(plan->cfg, plan->filter, plan->filter);
+    for (i = 0; i < l; i++) {
+        plan->filter[i].r /= l; // folds in the 1/l of the inverse FFT
+        plan->filter[i].i /= l;
+    }
+    return true;
+}
+
+// filters the premultiplied input in plan->buf and writes the postmultiplied bins
+static void czt_convolve(const czt_plan *plan, kiss_fft_cpx *out)
+{
+    kiss_fft_cpx *buf = plan->buf, t;
+    int i;
+
+    kiss_fft(plan->cfg, buf, buf);
+    for (i = 0; i < plan->l; i++) {
+        C_MUL(t, buf[i], plan->filter[i]);
+        buf[i].r = t.r; // conjugated: the forward FFT of the conjugate is the conjugated inverse FFT
+        buf[i].i = -t.i;
+    }
+    kiss_fft(plan->cfg, buf, buf);
+    for (i = 0; i < plan->m; i++) {
+        buf[i].i = -buf[i].i;
+        C_MUL(out[i], buf[i], plan->post[i]);
+    }
+}
+
+// transforms complex samples
+void czt_execute(const czt_plan *plan, const kiss_fft_cpx *in, kiss_fft_cpx *out)
+{
+    kiss_fft_cpx *buf = plan->buf;
+    int i;
+
+    for (i = 0; i < plan->n; i++)
+        C_MUL(buf[i], in[i], plan->pre[i]);
+    for (; i < plan->l; i++)
+        buf[i].r = buf[i].i = 0;
+    czt_convolve(plan, out);
+}
+
+// transforms real samples
+void czt_execute_real(const czt_plan *plan, const kiss_fft_scalar *in, kiss_fft_cpx *out)
+{
+    kiss_fft_cpx *buf = plan->buf;
+    int i;
+
+    for (i = 0; i < plan->n; i++) {
+        buf[i].r = in[i]*plan->pre[i].r;
+        buf[i].i = in[i]*plan->pre[i].i;
+    }
+    for (; i < plan->l; i++)
+        buf[i].r = buf[i].i = 0;
+    czt_convolve(plan, out);
+}
+
+#endif /* FIXED_POINT */
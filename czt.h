@@ -0,0 +1,56 @@
+/*
+ * czt.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Chirp-z transform (Bluestein's algorithm) on the power-of-2 FFT: M bins at any
+ * start frequency and spacing from N samples, or a DFT of any length. A library
+ * for the float build, not called by the display path: the live spectrum zooms
+ * with zoom.c, whose decimated FFT is cheaper per frame for a contiguous band
+ */
+
+#ifndef CZT_H_
+#define CZT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "kiss_fft.h"
+
+#define CZT_MIN_L 64    // smallest convolution FFT (smallest complex FFT with flash tables)
+#define CZT_MAX_L 4096  // largest convolution FFT, so n + m - 1 <= CZT_MAX_L
+
+// transform of n samples into m bins at f_start + k*f_step cycles/sample
+typedef struct {
+    int n, m;                   // input samples and output bins
+    int l;                      // convolution FFT length, a power of 2 >= n + m - 1
+    double f_start, f_step;     // frequency of bin 0 and bin spacing, cycles/sample
+    kiss_fft_cfg cfg;           // l-point forward complex FFT, flash tables
+    kiss_fft_cpx *pre;          // input chirp A^-i W^(i^2/2), i < n
+    kiss_fft_cpx *post;         // output chirp W^(k^2/2), k < m
+    kiss_fft_cpx *filter;       // FFT of the chirp filter W^(-j^2/2), scaled by 1/l for the inverse FFT
+    kiss_fft_cpx *buf;          // l-point work buffer
+} czt_plan;
+
+// bytes of mem czt_init needs for n samples and m bins, 0 if n + m - 1 > CZT_MAX_L
+size_t czt_mem_size(int n, int m);
+
+// builds the transform of n samples into m bins starting at f_start with spacing f_step (both in
+// cycles/sample, i.e. Hz/fs), with its tables in mem. returns false if the sizes are not supported or
+// mem is too small. not compiled in FIXED_POINT builds, not meant for the per-frame path
+bool czt_init(czt_plan *plan, int n, int m, double f_start, double f_step, void *mem, size_t len);
+
+// same for m bins evenly covering f_lo to f_hi Hz of a signal sampled at fs Hz
+bool czt_init_span(czt_plan *plan, int n, int m, float fs, float f_lo, float f_hi, void *mem, size_t len);
+
+// n-point DFT of any length n (Bluestein), the same output as kiss_fft of an n-point config
+bool czt_init_dft(czt_plan *plan, int n, void *mem, size_t len);
+
+// transforms n complex samples into m bins, X[k] = sum x[i] exp(-2*pi*j*(f_start + k*f_step)*i)
+void czt_execute(const czt_plan *plan, const kiss_fft_cpx *in, kiss_fft_cpx *out);
+
+// same for n real samples (e.g. a windowed frame)
+void czt_execute_real(const czt_plan *plan, const kiss_fft_scalar *in, kiss_fft_cpx *out);
+
+#endif /* CZT_H_ */
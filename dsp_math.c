@@ -0,0 +1,86 @@
+/*
+ * dsp_math.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Integer math kernels for the spectrum pipeline
+ */
+
+#include <stdint.h>
+#include "dsp_math.h"
+
+// log2(1 + i/32) in Q16, i = 0..32
+static const int32_t log2_mant_q16[33] = {
+    0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+    27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904,
+    47705, 49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534,
+    64047, 65536
+};
+
+// log2(1 + m) in Q16 for a left-aligned 32-bit mantissa fraction m
+static inline int32_t log2_mant(uint32_t m)
+{
+    uint32_t idx = m >> 27;                 // top 5 bits select the table segment
+    uint32_t frac = (m >> 11) & 0xffff;     // next 16 bits interpolate within the segment
+
+    int32_t y0 = log2_mant_q16[idx];
+    int32_t y1 = log2_mant_q16[idx + 1];
+    return y0 + (int32_t)(((y1 - y0) * frac) >> 16);
+}
+
+// returns log2(x) in Q16
+int32_t ilog2_q16(uint32_t x)
+{
+    if (x == 0)
+        return LOG2_Q16_ZERO;
+
+    int e = 31 - dsp_clz32(x);              // integer part of log2(x)
+    uint32_t m = (x << (31 - e)) << 1;      // mantissa fraction, left aligned, leading 1 removed
+    return (e << 16) + log2_mant(m);
+}
+
+// returns log2(x) in Q16 for 64-bit arguments
+int32_t ilog2_q16_u64(uint64_t x)
+{
+    uint32_t hi = (uint32_t)(x >> 32);
+    if (hi == 0)
+        return ilog2_q16((uint32_t)x);
+
+    int shift = dsp_bits32(hi);             // bring the top bits into 32-bit range
+    return ilog2_q16((uint32_t)(x >> shift)) + (shift << 16);
+}
+
+// returns log2(x) in Q16 of a float
+int32_t fast_log2_q16(float x)
+{
+    union { float f; uint32_t u; } v;
+    v.f = x;
+
+    int32_t e = (int32_t)(v.u >> 23) - 127;  // unbiased exponent, the sign bit puts negatives out of range
+    if (e < -126 || e > 128)
+        return LOG2_Q16_ZERO_F;             // 0, denormal or negative (inf/nan give e = 128)
+    return e*LOG2_Q16_ONE + log2_mant(v.u << 9);
+}
+
+// converts FFT bins to display rows
+void power_to_db(const kiss_fft_cpx *in, int16_t *out, int n, int32_t ref_db_q16)
+{
+    int i;
+    int32_t ref = ref_db_q16 + (1 << 15); // round to nearest row
+
+    for (i = 0; i < n; i++) {
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+        uint64_t power = (uint64_t)((int64_t)in[i].r*in[i].r) + (uint64_t)((int64_t)in[i].i*in[i].i);
+        int32_t log2_q16 = ilog2_q16_u64(power);
+# else
+        uint32_t power = (uint32_t)((int32_t)in[i].r*in[i].r) + (uint32_t)((int32_t)in[i].i*in[i].i);
+        int32_t log2_q16 = ilog2_q16(power);
+# endif
+#else
+        int32_t log2_q16 = fast_log2_q16(in[i].r*in[i].r + in[i].i*in[i].i);
+#endif
+        out[i] = (int16_t)((ref - log2_q16_to_db_q16(log2_q16)) >> 16);
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * dsp_math.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Integer and fast approximate math kernels for the spectrum pipeline
+ */
+
+#ifndef DSP_MATH_H_
+#define DSP_MATH_H_
+
+#include <stdint.h>
+#include "kiss_fft.h"
+
+#define LOG2_Q16_ONE 65536          // 1.0 in Q16
+#define DB_PER_LOG2_Q16 197283      // 10*log10(2) in Q16
+#define LOG2_Q16_ZERO (-LOG2_Q16_ONE) // value returned for log2(0), one LSB below log2(1)
+#define LOG2_Q16_ZERO_F (-128*LOG2_Q16_ONE) // value returned by fast_log2_q16() for 0 and denormals, below log2(FLT_MIN)
+#define DB_PER_LOG2 3.01029996f     // 10*log10(2)
+
+// alpha-max-beta-min magnitude constants (alpha = 0.96043, beta = 0.39782), peak error 3.96% (0.34 dB), 4% with the Q15 rounding
+#define AMB_ALPHA_Q15 31472
+#define AMB_BETA_Q15 13036
+#define AMB_ALPHA 0.960433870f
+#define AMB_BETA 0.397824735f
+
+// count leading zeros of a 32-bit word, returns 32 for x = 0
+static inline int dsp_clz32(uint32_t x)
+{
+#if defined(__TI_ARM__)
+    return x ? _norm(x) : 32;
+#elif defined(__GNUC__)
+    return x ? __builtin_clz(x) : 32;
+#else
+    int n = 0;
+    if (!x) return 32;
+    while (!(x & 0x80000000u)) { x <<= 1; n++; }
+    return n;
+#endif
+}
+
+// number of significant bits of x, 0 for x = 0
+static inline int dsp_bits32(uint32_t x)
+{
+    return 32 - dsp_clz32(x);
+}
+
+// log2(x) in Q16 using a 33-entry mantissa table with linear interpolation, |error| < 2^-12
+int32_t ilog2_q16(uint32_t x);
+
+// log2(x) in Q16 for 64-bit arguments (Q31 power values)
+int32_t ilog2_q16_u64(uint64_t x);
+
+// converts a Q16 log2 value to dB (10*log10) in Q16
+static inline int32_t log2_q16_to_db_q16(int32_t log2_q16)
+{
+    return (int32_t)(((int64_t)log2_q16 * DB_PER_LOG2_Q16) >> 16);
+}
+
+// log2(x) in Q16 of a positive float, from its exponent bits and the same mantissa table as ilog2_q16
+// |error| < 2^-12 (0.0008 dB after DB_PER_LOG2). returns LOG2_Q16_ZERO_F for 0, denormals and negative x
+int32_t fast_log2_q16(float x);
+
+// log2(x), |error| < 2^-12
+static inline float fast_log2(float x)
+{
+    return fast_log2_q16(x)*(1.0f/LOG2_Q16_ONE);
+}
+
+// 10*log10(x) of a power value, |error| < 0.001 dB
+static inline float fast_db(float x)
+{
+    return fast_log2(x)*DB_PER_LOG2;
+}
+
+// |re + j*im| estimate, within 4% of the true magnitude plus 1 for the truncation, no square root
+static inline uint32_t amb_mag(int32_t re, int32_t im)
+{
+    uint32_t a = re < 0 ? -(uint32_t)re : (uint32_t)re;
+    uint32_t b = im < 0 ? -(uint32_t)im : (uint32_t)im;
+    uint32_t mx = a > b ? a : b;
+    uint32_t mn = a > b ? b : a;
+    return (uint32_t)(((uint64_t)mx*AMB_ALPHA_Q15 + (uint64_t)mn*AMB_BETA_Q15) >> 15);
+}
+
+// |re + j*im| estimate, within 3.96% of the true magnitude
+static inline float amb_magf(float re, float im)
+{
+    float a = re < 0 ? -re : re;
+    float b = im < 0 ? -im : im;
+    return a > b ? AMB_ALPHA*a + AMB_BETA*b : AMB_ALPHA*b + AMB_BETA*a;
+}
+
+// batch conversion of FFT bins to display rows: out[i] = round(ref_db_q16/2^16 - 10*log10(|in[i]|^2)).
+// ref_db_q16 is the dB (Q16) that maps to row 0 plus any fixed-point output scaling. |error| < 0.5 row + 0.001 dB
+void power_to_db(const kiss_fft_cpx *in, int16_t *out, int n, int32_t ref_db_q16);
+
+#endif /* DSP_MATH_H_ */
@@ -0,0 +1,300 @@
+/*
+ * fft_codelets.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Size-specific complex FFT codelets (generated by tools/gen_fft_codelets.py, do not edit)
+ */
+
+#include <stdint.h>
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "fft_codelets.h"
+
+// table values are exact doubles; convert them the way kiss_fft_alloc does for the build's scalar type
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define TW_FIX(x) ((kiss_fft_scalar)((long long)(0.5 + 2147483647.0*(x) + 4294967296.0) - 4294967296LL))
+# else
+#  define TW_FIX(x) ((kiss_fft_scalar)((long)(0.5 + 32767.0*(x) + 65536.0) - 65536L))
+# endif
+# define TW(c, s) {TW_FIX(c), TW_FIX(s)}          // floor(.5 + SAMP_MAX*x), as KISS_FFT_COS/SIN
+# define WIN(x) ((fft_window_t)(32767.0*(x) + 0.5)) // Q15, x >= 0
+#else
+# define TW(c, s) {(kiss_fft_scalar)(c), (kiss_fft_scalar)(s)}
+# define WIN(x) ((fft_window_t)(x))
+#endif
+
+// exp(-2*pi*i*k/64), the same values as fft_twiddles[k*(FFT_TABLE_MAX_NFFT/2)/64]
+static const kiss_fft_cpx leaf_tw[64] = {
+    TW(1.0, -0.0), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.4713967368259978, -0.8819212643483549),
+    TW(0.38268343236508984, -0.9238795325112867), TW(0.29028467725446233, -0.9569403357322089),
+    TW(0.19509032201612833, -0.9807852804032304), TW(0.09801714032956077, -0.9951847266721968),
+    TW(6.123233995736766e-17, -1.0), TW(-0.09801714032956065, -0.9951847266721969),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.29028467725446216, -0.9569403357322089),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.4713967368259977, -0.881921264348355),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.6343932841636454, -0.7730104533627371),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.773010453362737, -0.6343932841636455),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.9569403357322088, -0.2902846772544624),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.9951847266721968, -0.09801714032956083),
+    TW(-1.0, -1.2246467991473532e-16), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(-0.9807852804032304, 0.19509032201612836), TW(-0.9569403357322089, 0.2902846772544621),
+    TW(-0.9238795325112868, 0.38268343236508967), TW(-0.881921264348355, 0.47139673682599764),
+    TW(-0.8314696123025455, 0.555570233019602), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(-0.7071067811865477, 0.7071067811865475), TW(-0.6343932841636459, 0.7730104533627367),
+    TW(-0.5555702330196022, 0.8314696123025452), TW(-0.47139673682599786, 0.8819212643483549),
+    TW(-0.38268343236509034, 0.9238795325112865), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(-0.19509032201612866, 0.9807852804032303), TW(-0.09801714032956045, 0.9951847266721969),
+    TW(-1.8369701987210297e-16, 1.0), TW(0.09801714032956009, 0.9951847266721969),
+    TW(0.1950903220161283, 0.9807852804032304), TW(0.29028467725446205, 0.9569403357322089),
+    TW(0.38268343236509, 0.9238795325112866), TW(0.4713967368259976, 0.881921264348355),
+    TW(0.5555702330196018, 0.8314696123025455), TW(0.6343932841636456, 0.7730104533627369),
+    TW(0.7071067811865474, 0.7071067811865477), TW(0.7730104533627367, 0.6343932841636459),
+    TW(0.8314696123025452, 0.5555702330196022), TW(0.8819212643483548, 0.4713967368259979),
+    TW(0.9238795325112865, 0.3826834323650904), TW(0.9569403357322088, 0.2902846772544625),
+    TW(0.9807852804032303, 0.19509032201612872), TW(0.9951847266721969, 0.0980171403295605),
+};
+
+#ifdef FIXED_POINT
+# define C_MUL_W0(m, a) C_MUL(m, a, leaf_tw[0])  // rounds like kiss_fft's multiply by 1
+#else
+# define C_MUL_W0(m, a) ((m) = (a))              // a*(1 + 0i)
+#endif
+
+// forward kf_bfly4 on F[a], F[b], F[c], F[d], given the three twiddle products
+#define BFLY4_MUL(a, b, c, d, MUL1, MUL2, MUL3) do { \
+        C_FIXDIV(F[a], 4); C_FIXDIV(F[b], 4); C_FIXDIV(F[c], 4); C_FIXDIV(F[d], 4); \
+        MUL1; MUL2; MUL3; \
+        C_SUB(s5, F[a], s1); \
+        C_ADDTO(F[a], s1); \
+        C_ADD(s3, s0, s2); \
+        C_SUB(s4, s0, s2); \
+        C_SUB(F[c], F[a], s3); \
+        C_ADDTO(F[a], s3); \
+        F[b].r = s5.r + s4.i; \
+        F[b].i = s5.i - s4.r; \
+        F[d].r = s5.r - s4.i; \
+        F[d].i = s5.i + s4.r; \
+    } while (0)
+#define BFLY4(a, b, c, d, w1, w2, w3) \
+    BFLY4_MUL(a, b, c, d, C_MUL(s0, F[b], w1), C_MUL(s1, F[c], w2), C_MUL(s2, F[d], w3))
+#define BFLY4_W0(a, b, c, d) \
+    BFLY4_MUL(a, b, c, d, C_MUL_W0(s0, F[b]), C_MUL_W0(s1, F[c]), C_MUL_W0(s2, F[d]))
+
+// kf_bfly2 on F[a], F[b], given the twiddle product
+#define BFLY2_MUL(a, b, MUL) do { \
+        C_FIXDIV(F[a], 2); C_FIXDIV(F[b], 2); \
+        MUL; \
+        C_SUB(F[b], F[a], s0); \
+        C_ADDTO(F[a], s0); \
+    } while (0)
+#define BFLY2(a, b, w) BFLY2_MUL(a, b, C_MUL(s0, F[b], w))
+#define BFLY2_W0(a, b) BFLY2_MUL(a, b, C_MUL_W0(s0, F[b]))
+
+// forward kf_bfly4 over every 4*m-point block of n points, twiddles from the flash table
+static inline void stage4(kiss_fft_cpx *F, int n, int m)
+{
+    const int fstride = (FFT_TABLE_MAX_NFFT/2)/(4*m);
+    kiss_fft_cpx s0, s1, s2, s3, s4, s5;
+    int b, u;
+
+    for (b = 0; b < n; b += 4*m) {
+        const kiss_fft_cpx *tw1 = fft_twiddles, *tw2 = fft_twiddles, *tw3 = fft_twiddles;
+        for (u = b; u < b + m; u++) {
+            BFLY4(u, u + m, u + 2*m, u + 3*m, *tw1, *tw2, *tw3);
+            tw1 += fstride;
+            tw2 += 2*fstride;
+            tw3 += 3*fstride;
+        }
+    }
+}
+
+// 32-point leaf: the stages 2, 4, 4 unrolled
+static void leaf_32(kiss_fft_cpx *F)
+{
+    kiss_fft_cpx s0, s1, s2, s3, s4, s5;
+    BFLY2_W0(0, 1);
+    BFLY2_W0(2, 3);
+    BFLY2_W0(4, 5);
+    BFLY2_W0(6, 7);
+    BFLY2_W0(8, 9);
+    BFLY2_W0(10, 11);
+    BFLY2_W0(12, 13);
+    BFLY2_W0(14, 15);
+    BFLY2_W0(16, 17);
+    BFLY2_W0(18, 19);
+    BFLY2_W0(20, 21);
+    BFLY2_W0(22, 23);
+    BFLY2_W0(24, 25);
+    BFLY2_W0(26, 27);
+    BFLY2_W0(28, 29);
+    BFLY2_W0(30, 31);
+    BFLY4_W0(0, 2, 4, 6);
+    BFLY4(1, 3, 5, 7, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4_W0(8, 10, 12, 14);
+    BFLY4(9, 11, 13, 15, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4_W0(16, 18, 20, 22);
+    BFLY4(17, 19, 21, 23, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4_W0(24, 26, 28, 30);
+    BFLY4(25, 27, 29, 31, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4_W0(0, 8, 16, 24);
+    BFLY4(1, 9, 17, 25, leaf_tw[2], leaf_tw[4], leaf_tw[6]);
+    BFLY4(2, 10, 18, 26, leaf_tw[4], leaf_tw[8], leaf_tw[12]);
+    BFLY4(3, 11, 19, 27, leaf_tw[6], leaf_tw[12], leaf_tw[18]);
+    BFLY4(4, 12, 20, 28, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4(5, 13, 21, 29, leaf_tw[10], leaf_tw[20], leaf_tw[30]);
+    BFLY4(6, 14, 22, 30, leaf_tw[12], leaf_tw[24], leaf_tw[36]);
+    BFLY4(7, 15, 23, 31, leaf_tw[14], leaf_tw[28], leaf_tw[42]);
+}
+
+// 64-point leaf: the stages 4, 4, 4 unrolled
+static void leaf_64(kiss_fft_cpx *F)
+{
+    kiss_fft_cpx s0, s1, s2, s3, s4, s5;
+    BFLY4_W0(0, 1, 2, 3);
+    BFLY4_W0(4, 5, 6, 7);
+    BFLY4_W0(8, 9, 10, 11);
+    BFLY4_W0(12, 13, 14, 15);
+    BFLY4_W0(16, 17, 18, 19);
+    BFLY4_W0(20, 21, 22, 23);
+    BFLY4_W0(24, 25, 26, 27);
+    BFLY4_W0(28, 29, 30, 31);
+    BFLY4_W0(32, 33, 34, 35);
+    BFLY4_W0(36, 37, 38, 39);
+    BFLY4_W0(40, 41, 42, 43);
+    BFLY4_W0(44, 45, 46, 47);
+    BFLY4_W0(48, 49, 50, 51);
+    BFLY4_W0(52, 53, 54, 55);
+    BFLY4_W0(56, 57, 58, 59);
+    BFLY4_W0(60, 61, 62, 63);
+    BFLY4_W0(0, 4, 8, 12);
+    BFLY4(1, 5, 9, 13, leaf_tw[4], leaf_tw[8], leaf_tw[12]);
+    BFLY4(2, 6, 10, 14, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4(3, 7, 11, 15, leaf_tw[12], leaf_tw[24], leaf_tw[36]);
+    BFLY4_W0(16, 20, 24, 28);
+    BFLY4(17, 21, 25, 29, leaf_tw[4], leaf_tw[8], leaf_tw[12]);
+    BFLY4(18, 22, 26, 30, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4(19, 23, 27, 31, leaf_tw[12], leaf_tw[24], leaf_tw[36]);
+    BFLY4_W0(32, 36, 40, 44);
+    BFLY4(33, 37, 41, 45, leaf_tw[4], leaf_tw[8], leaf_tw[12]);
+    BFLY4(34, 38, 42, 46, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4(35, 39, 43, 47, leaf_tw[12], leaf_tw[24], leaf_tw[36]);
+    BFLY4_W0(48, 52, 56, 60);
+    BFLY4(49, 53, 57, 61, leaf_tw[4], leaf_tw[8], leaf_tw[12]);
+    BFLY4(50, 54, 58, 62, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4(51, 55, 59, 63, leaf_tw[12], leaf_tw[24], leaf_tw[36]);
+    BFLY4_W0(0, 16, 32, 48);
+    BFLY4(1, 17, 33, 49, leaf_tw[1], leaf_tw[2], leaf_tw[3]);
+    BFLY4(2, 18, 34, 50, leaf_tw[2], leaf_tw[4], leaf_tw[6]);
+    BFLY4(3, 19, 35, 51, leaf_tw[3], leaf_tw[6], leaf_tw[9]);
+    BFLY4(4, 20, 36, 52, leaf_tw[4], leaf_tw[8], leaf_tw[12]);
+    BFLY4(5, 21, 37, 53, leaf_tw[5], leaf_tw[10], leaf_tw[15]);
+    BFLY4(6, 22, 38, 54, leaf_tw[6], leaf_tw[12], leaf_tw[18]);
+    BFLY4(7, 23, 39, 55, leaf_tw[7], leaf_tw[14], leaf_tw[21]);
+    BFLY4(8, 24, 40, 56, leaf_tw[8], leaf_tw[16], leaf_tw[24]);
+    BFLY4(9, 25, 41, 57, leaf_tw[9], leaf_tw[18], leaf_tw[27]);
+    BFLY4(10, 26, 42, 58, leaf_tw[10], leaf_tw[20], leaf_tw[30]);
+    BFLY4(11, 27, 43, 59, leaf_tw[11], leaf_tw[22], leaf_tw[33]);
+    BFLY4(12, 28, 44, 60, leaf_tw[12], leaf_tw[24], leaf_tw[36]);
+    BFLY4(13, 29, 45, 61, leaf_tw[13], leaf_tw[26], leaf_tw[39]);
+    BFLY4(14, 30, 46, 62, leaf_tw[14], leaf_tw[28], leaf_tw[42]);
+    BFLY4(15, 31, 47, 63, leaf_tw[15], leaf_tw[30], leaf_tw[45]);
+}
+
+// 64-point forward FFT of the permuted input
+static void codelet_64(kiss_fft_cpx *F)
+{
+    leaf_64(F);
+}
+
+// 128-point forward FFT of the permuted input
+static void codelet_128(kiss_fft_cpx *F)
+{
+    int b;
+    for (b = 0; b < 128; b += 32)
+        leaf_32(F + b);
+    stage4(F, 128, 32);
+}
+
+// 256-point forward FFT of the permuted input
+static void codelet_256(kiss_fft_cpx *F)
+{
+    int b;
+    for (b = 0; b < 256; b += 64)
+        leaf_64(F + b);
+    stage4(F, 256, 64);
+}
+
+// 512-point forward FFT of the permuted input
+static void codelet_512(kiss_fft_cpx *F)
+{
+    int b;
+    for (b = 0; b < 512; b += 32)
+        leaf_32(F + b);
+    stage4(F, 512, 32);
+    stage4(F, 512, 128);
+}
+
+// 1024-point forward FFT of the permuted input
+static void codelet_1024(kiss_fft_cpx *F)
+{
+    int b;
+    for (b = 0; b < 1024; b += 64)
+        leaf_64(F + b);
+    stage4(F, 1024, 64);
+    stage4(F, 1024, 256);
+}
+
+// 2048-point forward FFT of the permuted input
+static void codelet_2048(kiss_fft_cpx *F)
+{
+    int b;
+    for (b = 0; b < 2048; b += 32)
+        leaf_32(F + b);
+    stage4(F, 2048, 32);
+    stage4(F, 2048, 128);
+    stage4(F, 2048, 512);
+}
+
+// 4096-point forward FFT of the permuted input
+static void codelet_4096(kiss_fft_cpx *F)
+{
+    int b;
+    for (b = 0; b < 4096; b += 64)
+        leaf_64(F + b);
+    stage4(F, 4096, 64);
+    stage4(F, 4096, 256);
+    stage4(F, 4096, 1024);
+}
+
+static const struct {
+    int nfft;
+    kiss_fft_codelet codelet;
+} codelets[] = {
+    {64, codelet_64},
+    {128, codelet_128},
+    {256, codelet_256},
+    {512, codelet_512},
+    {1024, codelet_1024},
+    {2048, codelet_2048},
+    {4096, codelet_4096},
+};
+
+// returns the forward codelet of a complex FFT size, or NULL
+kiss_fft_codelet fft_codelet_find(int ncfft)
+{
+    int i;
+    for (i = 0; i < (int)(sizeof(codelets)/sizeof(codelets[0])); i++) {
+        if (codelets[i].nfft == ncfft)
+            return codelets[i].codelet;
+    }
+    return NULL;
+}
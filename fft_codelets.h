@@ -0,0 +1,22 @@
+/*
+ * fft_codelets.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Size-specific complex FFT codelets (generated by tools/gen_fft_codelets.py, do not edit)
+ */
+
+#ifndef FFT_CODELETS_H_
+#define FFT_CODELETS_H_
+
+#include "kiss_fft.h"
+
+#define FFT_CODELET_MIN_NFFT 64 // smallest complex FFT size with a codelet
+#define FFT_CODELET_MAX_NFFT 4096 // largest complex FFT size with a codelet
+
+// returns the forward codelet of a complex FFT size for kiss_fft_set_codelet, or NULL if there is none.
+// the codelets use the flash twiddles and match a config from the flash tables exactly
+kiss_fft_codelet fft_codelet_find(int ncfft);
+
+#endif /* FFT_CODELETS_H_ */
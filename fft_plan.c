@@ -0,0 +1,98 @@
+/*
+ * fft_plan.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * FFT plan cache in a static arena, one plan per supported FFT size
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "fft_prune.h"
+#include "fft_codelets.h"
+#include "fft_plan.h"
+
+#define ARENA_ALIGN 8                                           // alignment of every arena allocation
+#define ARENA_ROUND(n) (((n) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+// one plan of every size fits, so creation can only fail for unsupported sizes
+#define ARENA_SIZE (FFT_PLAN_SIZES*(ARENA_ROUND(KISS_FFTR_CFG_TABLES_BYTES) + ARENA_ROUND(sizeof(fft_prune_plan))))
+
+static uint64_t arena[ARENA_SIZE/sizeof(uint64_t)];   // plan memory, 8-byte aligned
+static size_t arena_used = 0;                       // bump allocator position
+static fft_plan plans[FFT_PLAN_SIZES];              // plan of each size, nfft = 0 until created
+
+// allocates from the arena, NULL when it is full
+static void *arena_alloc(size_t bytes)
+{
+    void *p;
+    bytes = ARENA_ROUND(bytes);
+    if (arena_used + bytes > sizeof(arena))
+        return NULL;
+    p = (char *)arena + arena_used;
+    arena_used += bytes;
+    return p;
+}
+
+// index of nfft in plans[], or -1
+static int plan_index(int nfft)
+{
+    int i, n = FFT_PLAN_MIN_NFFT;
+    for (i = 0; i < FFT_PLAN_SIZES; i++, n <<= 1) {
+        if (n == nfft)
+            return i;
+    }
+    return -1;
+}
+
+// returns the plan for nfft if it was already created
+fft_plan *fft_plan_find(int nfft)
+{
+    int i = plan_index(nfft);
+    if (i < 0 || plans[i].nfft == 0)
+        return NULL;
+    return &plans[i];
+}
+
+// returns the plan for nfft, creating it on first use
+fft_plan *fft_plan_get(int nfft)
+{
+    int i = plan_index(nfft);
+    if (i < 0)
+        return NULL;
+
+    fft_plan *p = &plans[i];
+    if (p->nfft != 0)
+        return p; // cached
+
+    size_t cfg_size = KISS_FFTR_CFG_TABLES_BYTES;
+    void *cfg_mem = arena_alloc(cfg_size);
+    fft_prune_plan *prune = (fft_prune_plan *)arena_alloc(sizeof(fft_prune_plan));
+    if (cfg_mem == NULL || prune == NULL)
+        return NULL;
+
+    p->cfg = fft_table_fftr_alloc(nfft, cfg_mem, &cfg_size);
+    kiss_fft_set_codelet(p->cfg->substate, fft_codelet_find(nfft/2)); // unrolled sub-FFT when one exists
+    p->tables = fft_table_find(nfft);
+    p->prune = prune;
+    fft_prune_plan_init(prune, p->cfg, 0, nfft/2, NULL); // whole spectrum until a span is set, full FFT
+    p->nfft = nfft;
+    return p;
+}
+
+// bytes of the arena in use
+size_t fft_plan_arena_used(void)
+{
+    return arena_used;
+}
+
+// bytes of the arena
+size_t fft_plan_arena_size(void)
+{
+    return sizeof(arena);
+}
@@ -0,0 +1,43 @@
+/*
+ * fft_plan.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * FFT plan cache in a static arena, one plan per supported FFT size
+ */
+
+#ifndef FFT_PLAN_H_
+#define FFT_PLAN_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "fft_tables.h"
+#include "fft_prune.h"
+
+#define FFT_PLAN_MIN_NFFT FFT_TABLE_MIN_NFFT    // smallest FFT size with a plan
+#define FFT_PLAN_MAX_NFFT FFT_TABLE_MAX_NFFT    // largest FFT size with a plan
+#define FFT_PLAN_SIZES 7                        // number of power-of-2 sizes from FFT_PLAN_MIN_NFFT to FFT_PLAN_MAX_NFFT
+
+// everything the spectrum pipeline needs for one FFT size
+typedef struct {
+    int nfft;                       // real FFT size
+    kiss_fftr_cfg cfg;              // real FFT config, tables in flash
+    const fft_table_entry *tables;  // flash tables of this size (Blackman window)
+    fft_prune_plan *prune;          // pruned FFT plan and its scratch
+} fft_plan;
+
+// returns the plan for nfft, creating it in the arena on first use; NULL if nfft is not supported.
+// creating a plan is not meant for the per-frame path, later calls only look it up
+fft_plan *fft_plan_get(int nfft);
+
+// returns the plan for nfft if it was already created, otherwise NULL
+fft_plan *fft_plan_find(int nfft);
+
+// bytes of the arena in use (its high-water mark, plans are never freed) and its size
+size_t fft_plan_arena_used(void);
+size_t fft_plan_arena_size(void);
+
+#endif /* FFT_PLAN_H_ */
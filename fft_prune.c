@@ -0,0 +1,322 @@
+/*
+ * fft_prune.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Output-pruned real FFT: computes only the bins of a span
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "_kiss_fft_guts.h"
+#include "fft_prune.h"
+
+#define PI 3.14159265358979
+
+#ifdef FIXED_POINT
+# define GOERTZEL_Q 30                          // coefficient fraction bits
+# define GOERTZEL_SHIFT (FRACBITS > 19 ? FRACBITS - 19 : 0) // Q31 input is reduced to Q19 so the state fits 64 bits
+#endif
+
+// rough Cortex-M4F cycle costs of the building blocks, used only to rank the modes
+#define CYCLES_PER_POINT 6      // load and store of one complex point in a stage
+#define CYCLES_PER_CMUL 6       // complex twiddle multiply
+#define CYCLES_PER_CMAC 8       // complex multiply-accumulate of the direct combination, with its loads
+#define CYCLES_PER_SPLIT 20     // real split of one bin
+#define CYCLES_PER_SAMPLE 6     // one Goertzel step: load, multiply and three adds in a dependent chain
+
+// estimated cycles of one stage of radix p over n points
+static uint32_t stage_cost(int n, int p)
+{
+    return (uint32_t)n*CYCLES_PER_POINT + (uint32_t)(n/p)*(p - 1)*CYCLES_PER_CMUL;
+}
+
+// modes being timed, the ones with a nonzero timed[]
+static int candidates(const fft_prune_plan *plan)
+{
+    int m, n = 0;
+    for (m = 0; m < FFT_PRUNE_MODE_COUNT; m++)
+        n += plan->timed[m] != 0;
+    return n;
+}
+
+// the i-th mode being timed
+static fft_prune_mode candidate(const fft_prune_plan *plan, int i)
+{
+    int m;
+    for (m = 0; m < FFT_PRUNE_MODE_COUNT - 1; m++)
+        if (plan->timed[m] != 0 && i-- == 0)
+            break;
+    return (fft_prune_mode)m;
+}
+
+// builds the plan
+void fft_prune_plan_init(fft_prune_plan *plan, kiss_fftr_cfg cfg, int kmin, int kmax, fft_prune_clock clock)
+{
+    const kiss_fft_cfg sub = cfg->substate;
+    const int ncfft = sub->nfft;
+    const int nbins = kmax - kmin + 1;
+    uint32_t stages[MAXFACTORS];
+    int nstages, s, L, b, j;
+
+    plan->nfft = 2*ncfft;
+    plan->kmin = kmin;
+    plan->kmax = kmax;
+    plan->outer = 0;
+    plan->P = 1;
+    plan->Q = ncfft;
+
+    // full transform: every stage of the complex FFT plus the real split
+    uint32_t full = (uint32_t)(ncfft/2)*CYCLES_PER_SPLIT;
+    for (s = 0; s == 0 || sub->factors[2*s - 1] > 1; s++) {
+        stages[s] = stage_cost(ncfft, sub->factors[2*s]);
+        full += stages[s];
+    }
+    nstages = s;
+    plan->cost[FFT_PRUNE_FULL] = full;
+    plan->cost[FFT_PRUNE_DECOMP] = 0;
+    plan->cost[FFT_PRUNE_GOERTZEL] = 0;
+    plan->mode = FFT_PRUNE_FULL;
+    plan->clock = NULL;
+    plan->trial = 0;
+
+    if (nbins > FFT_PRUNE_MAX_BINS)
+        return;
+
+    // transform decomposition: drop the L outermost stages, combine P sub-FFTs for each of the 2*nbins outputs
+    uint32_t inner = full, best = 0;
+    int P = 1;
+    for (L = 1; L < nstages; L++) {
+        inner -= stages[L - 1];
+        P *= sub->factors[2*(L - 1)];
+        if (P > FFT_PRUNE_MAX_P)
+            break;
+        uint32_t c = inner - (uint32_t)(ncfft/2)*CYCLES_PER_SPLIT + (uint32_t)nbins*(2*P*CYCLES_PER_CMAC + CYCLES_PER_SPLIT);
+        if (best == 0 || c < best) {
+            best = c;
+            plan->outer = L;
+            plan->P = P;
+            plan->Q = ncfft/P;
+        }
+    }
+    plan->cost[FFT_PRUNE_DECOMP] = best;
+
+    // Goertzel: one filter step per sample and bin
+    plan->cost[FFT_PRUNE_GOERTZEL] = (uint32_t)nbins*(plan->nfft*CYCLES_PER_SAMPLE + CYCLES_PER_SPLIT);
+
+    for (s = FFT_PRUNE_DECOMP; s < FFT_PRUNE_MODE_COUNT; s++) {
+        if (plan->cost[s] != 0 && plan->cost[s] < plan->cost[plan->mode])
+            plan->mode = (fft_prune_mode)s;
+    }
+
+    // the estimate ranks the modes only roughly: time those within twice the cheapest on the first transforms
+    for (s = 0; s < FFT_PRUNE_MODE_COUNT; s++)
+        plan->timed[s] = plan->cost[s] != 0 && plan->cost[s]/2 <= plan->cost[plan->mode] ? UINT32_MAX : 0;
+    if (candidates(plan) > 1)
+        plan->clock = clock;
+
+    // decimation offset of each sub-FFT block, the mixed-radix digit reversal of the block index
+    for (b = 0; b < plan->P; b++) {
+        int rem = b*plan->Q, r = 0, scale = 1;
+        for (s = 0; s < plan->outer; s++) {
+            const int p = sub->factors[2*s];
+            const int m = sub->factors[2*s + 1];
+            r += (rem/m)*scale;
+            rem %= m;
+            scale *= p;
+        }
+        plan->block_r[b] = (kiss_fft_index)r;
+    }
+
+    // Reinsch-modified Goertzel coefficients, stable for bins near 0 and near Nyquist
+    for (j = 0; j < nbins; j++) {
+        double w = 2*PI*(kmin + j)/plan->nfft;
+        double k = w <= PI/2 ? 4*sin(w/2)*sin(w/2) : 4*cos(w/2)*cos(w/2);
+#ifdef FIXED_POINT
+        plan->gk[j] = (fft_prune_coef)floor(k*(1 << GOERTZEL_Q) + 0.5);
+        plan->gs[j] = (fft_prune_coef)floor(sin(w)*(1 << GOERTZEL_Q) + 0.5);
+#else
+        plan->gk[j] = (fft_prune_coef)k;
+        plan->gs[j] = (fft_prune_coef)sin(w);
+#endif
+    }
+}
+
+// output k of the complex FFT from the P sub-FFTs left in buf by kiss_fft_partial
+static kiss_fft_cpx decomp_output(const fft_prune_plan *plan, const kiss_fft_cfg sub, const kiss_fft_cpx *buf, int k)
+{
+    const int ncfft = sub->nfft;
+    const kiss_fft_cpx *y = buf + k % plan->Q;
+    kiss_fft_cpx acc, t;
+    int b;
+
+#ifdef FIXED_POINT
+    // accumulate wide and divide by P once at the end, like the 1/p of each skipped stage
+    SAMPPROD ar = 0, ai = 0;
+    for (b = 0; b < plan->P; b++) {
+        C_MUL(t, y[b*plan->Q], sub->twiddles[(plan->block_r[b]*k % ncfft)*sub->twiddle_stride]);
+        ar += t.r;
+        ai += t.i;
+    }
+    acc.r = (kiss_fft_scalar)((ar + (ar >= 0 ? plan->P/2 : -plan->P/2))/plan->P);
+    acc.i = (kiss_fft_scalar)((ai + (ai >= 0 ? plan->P/2 : -plan->P/2))/plan->P);
+#else
+    acc.r = acc.i = 0;
+    for (b = 0; b < plan->P; b++) {
+        C_MUL(t, y[b*plan->Q], sub->twiddles[(plan->block_r[b]*k % ncfft)*sub->twiddle_stride]);
+        C_ADDTO(acc, t);
+    }
+#endif
+    return acc;
+}
+
+// real FFT bin k from complex outputs zk = Z[k] and znk = Z[ncfft-k], the same arithmetic as kiss_fftr
+static kiss_fft_cpx split_bin(kiss_fftr_cfg cfg, kiss_fft_cpx zk, kiss_fft_cpx znk, int k)
+{
+    const int ncfft = cfg->substate->nfft;
+    kiss_fft_cpx out, fpk, fpnk, f1k, f2k, tw;
+
+    if (k == 0 || k == ncfft) {
+        kiss_fft_cpx tdc = zk;
+        C_FIXDIV(tdc, 2);
+        out.r = k == 0 ? tdc.r + tdc.i : tdc.r - tdc.i;
+        out.i = 0;
+        return out;
+    }
+
+    int kk = k < ncfft/2 ? k : ncfft - k; // kiss_fftr computes bins above ncfft/2 from their mirror
+    fpk = k < ncfft/2 ? zk : znk;
+    fpnk = k < ncfft/2 ? znk : zk;
+    fpnk.i = -fpnk.i;
+    C_FIXDIV(fpk, 2);
+    C_FIXDIV(fpnk, 2);
+    C_ADD(f1k, fpk, fpnk);
+    C_SUB(f2k, fpk, fpnk);
+    C_MUL(tw, f2k, cfg->super_twiddles[kk*cfg->super_stride - 1]);
+
+    if (k < ncfft/2) {
+        out.r = HALF_OF(f1k.r + tw.r);
+        out.i = HALF_OF(f1k.i + tw.i);
+    } else {
+        out.r = HALF_OF(f1k.r - tw.r);
+        out.i = HALF_OF(tw.i - f1k.i);
+    }
+    return out;
+}
+
+// Goertzel filter for bin j of the plan over the real input x
+static kiss_fft_cpx goertzel_bin(const fft_prune_plan *plan, const kiss_fft_scalar *x, int j)
+{
+    const int n = plan->nfft;
+    const int low = 4*(plan->kmin + j) <= n; // w <= pi/2
+    kiss_fft_cpx out;
+    int i;
+
+#ifdef FIXED_POINT
+    const int64_t k = plan->gk[j];
+    int64_t s = 0, d = 0, re, im;
+    if (low) {
+        for (i = 0; i < n; i++) {
+            d += (x[i] >> GOERTZEL_SHIFT) - ((k*s) >> GOERTZEL_Q);
+            s += d;
+        }
+        re = d - ((k*s) >> (GOERTZEL_Q + 1));
+    } else {
+        for (i = 0; i < n; i++) {
+            d = (x[i] >> GOERTZEL_SHIFT) + ((k*s) >> GOERTZEL_Q) - d;
+            s = d - s;
+        }
+        re = ((k*s) >> (GOERTZEL_Q + 1)) - d;
+    }
+    im = (plan->gs[j]*s) >> GOERTZEL_Q;
+    out.r = (kiss_fft_scalar)(re*(1 << GOERTZEL_SHIFT)/n); // kiss_fftr output is scaled by 1/nfft
+    out.i = (kiss_fft_scalar)(im*(1 << GOERTZEL_SHIFT)/n);
+#else
+    const float k = plan->gk[j];
+    float s = 0, d = 0;
+    if (low) {
+        for (i = 0; i < n; i++) {
+            d += x[i] - k*s;
+            s += d;
+        }
+        out.r = d - 0.5f*k*s;
+    } else {
+        for (i = 0; i < n; i++) {
+            d = x[i] + k*s - d;
+            s = d - s;
+        }
+        out.r = 0.5f*k*s - d;
+    }
+    out.i = plan->gs[j]*s;
+#endif
+    return out;
+}
+
+// computes bins kmin to kmax of buf in place with one mode
+static void prune_run(fft_prune_plan *plan, kiss_fftr_cfg cfg, kiss_fft_cpx *buf, fft_prune_mode mode)
+{
+    const kiss_fft_cfg sub = cfg->substate;
+    const int ncfft = sub->nfft;
+    const int nbins = plan->kmax - plan->kmin + 1;
+    int j;
+
+    switch (mode) {
+    case FFT_PRUNE_DECOMP:
+        kiss_fft_partial(sub, buf, plan->outer);
+        for (j = 0; j < nbins; j++) { // every output is read from the sub-FFTs before any bin is written
+            int k = plan->kmin + j;
+            plan->z[2*j] = decomp_output(plan, sub, buf, k % ncfft);
+            plan->z[2*j + 1] = decomp_output(plan, sub, buf, (ncfft - k) % ncfft);
+        }
+        for (j = 0; j < nbins; j++)
+            buf[plan->kmin + j] = split_bin(cfg, plan->z[2*j], plan->z[2*j + 1], plan->kmin + j);
+        break;
+    case FFT_PRUNE_GOERTZEL:
+        for (j = 0; j < nbins; j++)
+            plan->z[j] = goertzel_bin(plan, (const kiss_fft_scalar *)buf, j);
+        for (j = 0; j < nbins; j++)
+            buf[plan->kmin + j] = plan->z[j];
+        break;
+    default:
+        kiss_fftr(cfg, (const kiss_fft_scalar *)buf, buf);
+        break;
+    }
+}
+
+// whether the mode is settled
+bool fft_prune_plan_settled(const fft_prune_plan *plan)
+{
+    return plan->clock == NULL || plan->trial >= candidates(plan)*(FFT_PRUNE_TRIALS + 1);
+}
+
+// computes bins kmin to kmax of buf in place, timing the candidate modes in turn until the plan settles
+void fft_prune_execute(fft_prune_plan *plan, kiss_fftr_cfg cfg, kiss_fft_cpx *buf)
+{
+    if (fft_prune_plan_settled(plan)) {
+        prune_run(plan, cfg, buf, plan->mode);
+        return;
+    }
+
+    int n = candidates(plan), m;
+    fft_prune_mode mode = candidate(plan, plan->trial % n);
+    uint32_t t0 = plan->clock();
+    prune_run(plan, cfg, buf, mode);
+    uint32_t cycles = plan->clock() - t0;
+    if (plan->trial >= n && cycles < plan->timed[mode]) // the first round warms the caches
+        plan->timed[mode] = cycles ? cycles : 1; // nonzero, still a candidate
+
+    if (++plan->trial == n*(FFT_PRUNE_TRIALS + 1)) {
+        for (m = 0; m < FFT_PRUNE_MODE_COUNT; m++) {
+            if (plan->timed[m] != 0) {
+                plan->cost[m] = plan->timed[m];
+                if (plan->timed[m] < plan->timed[plan->mode]) // the estimated mode is a candidate
+                    plan->mode = (fft_prune_mode)m;
+            }
+        }
+    }
+}
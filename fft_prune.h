@@ -0,0 +1,69 @@
+/*
+ * fft_prune.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Output-pruned real FFT: computes only the bins of a span
+ */
+
+#ifndef FFT_PRUNE_H_
+#define FFT_PRUNE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+
+#define FFT_PRUNE_MAX_BINS 64   // largest bin range the pruned modes handle
+#define FFT_PRUNE_MAX_P 256     // largest number of sub-FFTs the decomposition combines
+#ifndef FFT_PRUNE_TRIALS
+#define FFT_PRUNE_TRIALS 3      // timed transforms per mode after one to warm up, the fastest counts
+#endif
+
+typedef enum {
+    FFT_PRUNE_FULL,         // full kiss_fftr
+    FFT_PRUNE_DECOMP,       // inner stages as sub-FFTs, then only the needed outputs (transform decomposition)
+    FFT_PRUNE_GOERTZEL,     // one Goertzel filter per bin
+    FFT_PRUNE_MODE_COUNT
+} fft_prune_mode;
+
+#ifdef FIXED_POINT
+typedef int64_t fft_prune_coef;  // Q30 Goertzel coefficient
+#else
+typedef float fft_prune_coef;
+#endif
+
+// free-running cycle counter for timing the modes, wraps modulo 2^32
+typedef uint32_t (*fft_prune_clock)(void);
+
+// plan for the bins kmin to kmax of one real FFT config
+typedef struct {
+    fft_prune_mode mode;                        // cheapest mode, by cost estimate until the modes are timed
+    int nfft;                                   // real FFT size
+    int kmin, kmax;                             // computed bin range, inclusive
+    int outer;                                  // outer stages replaced by the direct combination
+    int P, Q;                                   // number and length of the sub-FFTs
+    uint32_t cost[FFT_PRUNE_MODE_COUNT];        // estimated, then measured cycles per mode (0 = not possible)
+    fft_prune_clock clock;                      // times the modes, NULL to keep the estimate
+    int trial;                                  // transforms timed so far, FFT_PRUNE_TRIALS + 1 per mode timed
+    uint32_t timed[FFT_PRUNE_MODE_COUNT];       // fastest transform of each mode timed so far
+    kiss_fft_index block_r[FFT_PRUNE_MAX_P];    // decimation offset of each sub-FFT block
+    fft_prune_coef gk[FFT_PRUNE_MAX_BINS];      // Goertzel (Reinsch) feedback coefficient per bin
+    fft_prune_coef gs[FFT_PRUNE_MAX_BINS];      // sin(w) per bin
+    kiss_fft_cpx z[2*FFT_PRUNE_MAX_BINS];       // scratch for the computed outputs
+} fft_prune_plan;
+
+// picks the cheapest way to compute bins kmin to kmax of the real FFT cfg by cost estimate, not meant for the
+// per-frame path. with a clock, the next transforms time every mode within twice the cheapest estimate (each
+// gives the same bins) and the plan keeps the fastest, so the choice holds on any core and build
+void fft_prune_plan_init(fft_prune_plan *plan, kiss_fftr_cfg cfg, int kmin, int kmax, fft_prune_clock clock);
+
+// transforms buf (nfft reals in, nfft/2+1 bins out, in place) like kiss_fftr, except that only
+// bins kmin to kmax are valid afterwards
+void fft_prune_execute(fft_prune_plan *plan, kiss_fftr_cfg cfg, kiss_fft_cpx *buf);
+
+// whether the plan has settled on its mode: estimated without a clock, or every candidate timed
+bool fft_prune_plan_settled(const fft_prune_plan *plan);
+
+#endif /* FFT_PRUNE_H_ */
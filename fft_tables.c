@@ -0,0 +1,9950 @@
+/*
+ * fft_tables.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Precomputed FFT tables in flash (generated by tools/gen_fft_tables.py, do not edit)
+ */
+
+#include <stdint.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "fft_tables.h"
+
+// table values are exact doubles; convert them the way kiss_fft_alloc does for the build's scalar type
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define TW_FIX(x) ((kiss_fft_scalar)((long long)(0.5 + 2147483647.0*(x) + 4294967296.0) - 4294967296LL))
+# else
+#  define TW_FIX(x) ((kiss_fft_scalar)((long)(0.5 + 32767.0*(x) + 65536.0) - 65536L))
+# endif
+# define TW(c, s) {TW_FIX(c), TW_FIX(s)}          // floor(.5 + SAMP_MAX*x), as KISS_FFT_COS/SIN
+# define WIN(x) ((fft_window_t)(32767.0*(x) + 0.5)) // Q15, x >= 0
+#else
+# define TW(c, s) {(kiss_fft_scalar)(c), (kiss_fft_scalar)(s)}
+# define WIN(x) ((fft_window_t)(x))
+#endif
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+# define STAGE_TW(t) (t)
+#else
+# define STAGE_TW(t) NULL   // the packed tables are only built with KISS_FFT_STAGE_TWIDDLES
+#endif
+
+const kiss_fft_cpx fft_twiddles[FFT_TABLE_MAX_NFFT/2] = {
+    TW(1.0, -0.0), TW(0.9999988234517019, -0.0015339801862847655),
+    TW(0.9999952938095762, -0.003067956762965976), TW(0.9999894110819284, -0.0046019261204485705),
+    TW(0.9999811752826011, -0.006135884649154475), TW(0.9999705864309741, -0.007669828739531097),
+    TW(0.9999576445519639, -0.00920375478205982), TW(0.9999423496760239, -0.01073765916726449),
+    TW(0.9999247018391445, -0.012271538285719925), TW(0.9999047010828529, -0.01380538852806039),
+    TW(0.9998823474542126, -0.0153392062849881), TW(0.9998576410058239, -0.01687298794728171),
+    TW(0.9998305817958234, -0.01840672990580482), TW(0.9998011698878843, -0.01994042855151444),
+    TW(0.9997694053512153, -0.021474080275469508), TW(0.9997352882605617, -0.02300768146883937),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9996599967439592, -0.0260747178291039),
+    TW(0.9996188224951786, -0.02760814577896574), TW(0.9995752960467492, -0.029141508764193722),
+    TW(0.9995294175010931, -0.030674803176636626), TW(0.999481186966167, -0.032208025408304586),
+    TW(0.9994306045554617, -0.03374117185137758), TW(0.9993776703880028, -0.03527423889821395),
+    TW(0.9993223845883495, -0.03680722294135883), TW(0.9992647472865944, -0.038340120373552694),
+    TW(0.9992047586183639, -0.03987292758773981), TW(0.9991424187248169, -0.04140564097707674),
+    TW(0.9990777277526454, -0.04293825693494082), TW(0.9990106858540734, -0.04447077185493867),
+    TW(0.9989412931868569, -0.04600318213091462), TW(0.9988695499142836, -0.0475354841569593),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9987190122338729, -0.05059974903689928),
+    TW(0.9986402181802653, -0.052131704680283324), TW(0.9985590742297593, -0.05366353765273052),
+    TW(0.9984755805732948, -0.055195244349689934), TW(0.9983897374073402, -0.05672682116690775),
+    TW(0.9983015449338929, -0.05825826450043575), TW(0.9982110033604782, -0.05978957074663987),
+    TW(0.9981181129001492, -0.06132073630220858), TW(0.9980228737714862, -0.0628517575641614),
+    TW(0.997925286198596, -0.06438263092985747), TW(0.9978253504111116, -0.0659133527970038),
+    TW(0.9977230666441916, -0.06744391956366405), TW(0.9976184351385196, -0.06897432762826675),
+    TW(0.9975114561403035, -0.07050457338961386), TW(0.9974021299012753, -0.07203465324688933),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9971764367353262, -0.0750943008479213),
+    TW(0.997060070339483, -0.07662386139203149), TW(0.9969413577649822, -0.07815324163279423),
+    TW(0.9968202992911657, -0.07968243797143013), TW(0.9966968952028961, -0.08121144680959244),
+    TW(0.9965711457905548, -0.08274026454937569), TW(0.9964430513500426, -0.08426888759332407),
+    TW(0.996312612182778, -0.0857973123444399), TW(0.996179828595697, -0.08732553520619206),
+    TW(0.996044700901252, -0.0888535525825246), TW(0.9959072294174117, -0.09038136087786498),
+    TW(0.9957674144676598, -0.09190895649713272), TW(0.9956252563809943, -0.09343633584574779),
+    TW(0.9954807554919269, -0.09496349532963899), TW(0.9953339121404823, -0.09649043135525259),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.9950331994381186, -0.09954361866006932),
+    TW(0.9948793307948056, -0.10106986275482782), TW(0.9947231211043257, -0.10259586902243628),
+    TW(0.9945645707342554, -0.10412163387205459), TW(0.9944036800576791, -0.10564715371341062),
+    TW(0.9942404494531879, -0.10717242495680884), TW(0.9940748793048794, -0.10869744401313872),
+    TW(0.9939069700023561, -0.11022220729388306), TW(0.9937367219407246, -0.11174671121112659),
+    TW(0.9935641355205953, -0.11327095217756435), TW(0.9933892111480807, -0.11479492660651008),
+    TW(0.9932119492347945, -0.11631863091190475), TW(0.9930323501978514, -0.11784206150832498),
+    TW(0.9928504144598651, -0.11936521481099135), TW(0.992666142448948, -0.12088808723577708),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.9922905913482574, -0.12393297511851216),
+    TW(0.9920993131421918, -0.12545498341154623), TW(0.9919057004306093, -0.12697669649688587),
+    TW(0.9917097536690995, -0.12849811079379317), TW(0.9915114733187439, -0.13001922272223335),
+    TW(0.9913108598461154, -0.13154002870288312), TW(0.9911079137232769, -0.13306052515713906),
+    TW(0.99090263542778, -0.13458070850712617), TW(0.9906950254426646, -0.1361005751757062),
+    TW(0.9904850842564571, -0.13762012158648604), TW(0.9902728123631691, -0.1391393441638262),
+    TW(0.9900582102622971, -0.1406582393328492), TW(0.9898412784588205, -0.14217680351944803),
+    TW(0.9896220174632009, -0.14369503315029447), TW(0.9894004277913804, -0.14521292465284746),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.988950264510303, -0.14824767898689603),
+    TW(0.9887216919603238, -0.1497645346773215), TW(0.9884907928526966, -0.15128103795733022),
+    TW(0.9882575677307495, -0.15279718525844344), TW(0.9880220171432835, -0.1543129730130201),
+    TW(0.9877841416445722, -0.15582839765426523), TW(0.9875439417943592, -0.15734345561623825),
+    TW(0.9873014181578584, -0.15885814333386145), TW(0.987056571305751, -0.16037245724292828),
+    TW(0.9868094018141855, -0.16188639378011183), TW(0.9865599102647754, -0.16339994938297323),
+    TW(0.9863080972445987, -0.16491312048996992), TW(0.9860539633461954, -0.1664259035404641),
+    TW(0.9857975091675675, -0.16793829497473117), TW(0.9855387353121761, -0.16945029123396796),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9850142310122398, -0.17247308399679595),
+    TW(0.9847485018019042, -0.17398387338746382), TW(0.9844804553832209, -0.17549425337727143),
+    TW(0.984210092386929, -0.17700422041214875), TW(0.9839374134492189, -0.1785137709389975),
+    TW(0.9836624192117303, -0.18002290140569951), TW(0.9833851103215512, -0.18153160826112497),
+    TW(0.9831054874312163, -0.18303988795514095), TW(0.9828235511987052, -0.18454773693861962),
+    TW(0.9825393022874412, -0.18605515166344663), TW(0.9822527413662894, -0.1875621285825296),
+    TW(0.9819638691095552, -0.1890686641498062), TW(0.9816726861969831, -0.19057475482025274),
+    TW(0.9813791933137546, -0.19208039704989244), TW(0.9810833911504867, -0.1935855872958036),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9804848617734694, -0.19659459767008022),
+    TW(0.9801821359681174, -0.19809841071795356), TW(0.9798771036995176, -0.19960175762113097),
+    TW(0.9795697656854405, -0.2011046348420919), TW(0.979260122649082, -0.20260703884442113),
+    TW(0.9789481753190622, -0.20410896609281687), TW(0.9786339244294232, -0.20561041305309924),
+    TW(0.9783173707196277, -0.20711137619221856), TW(0.9779985149345571, -0.20861185197826349),
+    TW(0.9776773578245099, -0.2101118368804696), TW(0.9773539001452, -0.21161132736922755),
+    TW(0.9770281426577544, -0.21311031991609136), TW(0.9767000861287118, -0.21460881099378676),
+    TW(0.9763697313300211, -0.21610679707621952), TW(0.976037079039039, -0.21760427463848364),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.975364885116657, -0.2205976901088735),
+    TW(0.9750253450669941, -0.2220936209732035), TW(0.9746835106885107, -0.22358902922979),
+    TW(0.9743393827855759, -0.22508391135979283), TW(0.9739929621679558, -0.22657826384561),
+    TW(0.973644249650812, -0.22807208317088573), TW(0.9732932460546982, -0.22956536582051887),
+    TW(0.9729399522055602, -0.2310581082806711), TW(0.9725843689347322, -0.23255030703877524),
+    TW(0.9722264970789363, -0.23404195858354343), TW(0.9718663374802794, -0.2355330594049755),
+    TW(0.9715038909862518, -0.2370236059943672), TW(0.9711391584497251, -0.23851359484431842),
+    TW(0.9707721407289504, -0.2400030224487415), TW(0.9704028386875555, -0.24149188530286933),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.9696573851242924, -0.24446790274782415),
+    TW(0.9692812353565485, -0.2459550503357946), TW(0.9689028047764289, -0.24744161916777327),
+    TW(0.9685220942744174, -0.24892760574572015), TW(0.9681391047463624, -0.2504130065729652),
+    TW(0.9677538370934755, -0.25189781815421697), TW(0.9673662922223285, -0.25338203699557016),
+    TW(0.9669764710448521, -0.25486565960451457), TW(0.9665843744783331, -0.2563486824899429),
+    TW(0.9661900034454125, -0.257831102162159), TW(0.9657933588740837, -0.25931291513288623),
+    TW(0.9653944416976894, -0.2607941179152755), TW(0.9649932528549203, -0.2622747070239136),
+    TW(0.9645897932898128, -0.26375467897483135), TW(0.9641840639517458, -0.2652340302855118),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.963365799780954, -0.2681908570634032),
+    TW(0.9629532668736839, -0.2696683255729151), TW(0.9625384680443592, -0.271145159526808),
+    TW(0.9621214042690416, -0.272621355449949), TW(0.9617020765291225, -0.2740969098687064),
+    TW(0.9612804858113206, -0.27557181931095814), TW(0.9608566331076797, -0.2770460803060999),
+    TW(0.9604305194155658, -0.27851968938505306), TW(0.960002145737666, -0.2799926430802732),
+    TW(0.9595715130819845, -0.28146493792575794), TW(0.9591386224618419, -0.2829365704570554),
+    TW(0.9587034748958716, -0.2844075372112719), TW(0.9582660714080177, -0.2858778347270806),
+    TW(0.9578264130275329, -0.2873474595447295), TW(0.9573845007889759, -0.2888164082060495),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9564939189023951, -0.29175226323498926),
+    TW(0.9560452513499964, -0.29321916269425863), TW(0.9555943341307711, -0.2946853721805143),
+    TW(0.9551411683057708, -0.2961508882436238), TW(0.9546857549413383, -0.2976157074350862),
+    TW(0.9542280951091057, -0.2990798263080405), TW(0.9537681898859903, -0.30054324141727345),
+    TW(0.9533060403541939, -0.3020059493192281), TW(0.9528416476011987, -0.3034679465720113),
+    TW(0.9523750127197659, -0.3049292297354024), TW(0.9519061368079323, -0.3063897953708609),
+    TW(0.9514350209690083, -0.30784964004153487), TW(0.9509616663115751, -0.3093087603122687),
+    TW(0.9504860739494817, -0.3107671527496115), TW(0.950008245001843, -0.3122248139218249),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.9490458818527006, -0.31513792875252244),
+    TW(0.9485613499157303, -0.31659337555616585), TW(0.9480745859222762, -0.31804807738501495),
+    TW(0.9475855910177411, -0.3195020308160157), TW(0.9470943663527772, -0.3209552324278752),
+    TW(0.9466009130832835, -0.32240767880106985), TW(0.9461052323704034, -0.32385936651785285),
+    TW(0.9456073253805213, -0.3253102921622629), TW(0.9451071932852606, -0.32676045232013173),
+    TW(0.9446048372614803, -0.3282098435790925), TW(0.9441002584912727, -0.3296584625285875),
+    TW(0.9435934581619604, -0.33110630575987643), TW(0.9430844374660935, -0.3325533698660442),
+    TW(0.9425731976014469, -0.3339996514420094), TW(0.9420597397710173, -0.3354451470845316),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.9410261750508893, -0.3383337669655411),
+    TW(0.9405060705932683, -0.33977688440682685), TW(0.939983753034014, -0.34121920232028236),
+    TW(0.9394592236021899, -0.3426607173119944), TW(0.9389324835320646, -0.3441014259899388),
+    TW(0.9384035340631081, -0.3455413249639891), TW(0.9378723764399899, -0.3469804108459237),
+    TW(0.937339011912575, -0.34841868024943456), TW(0.9368034417359216, -0.3498561297901349),
+    TW(0.9362656671702783, -0.3512927560855671), TW(0.9357256894810804, -0.3527285557552107),
+    TW(0.9351835099389476, -0.35416352542049034), TW(0.9346391298196808, -0.35559766170478385),
+    TW(0.934092550404259, -0.35703096123343), TW(0.9335437729788362, -0.35846342063373654),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.9324396292684624, -0.3613258055684543),
+    TW(0.9318842655816681, -0.3627557243673972), TW(0.9313267090811804, -0.3641847895670799),
+    TW(0.9307669610789837, -0.36561299780477385), TW(0.9302050228922191, -0.3670403457197672),
+    TW(0.9296408958431813, -0.3684668299533723), TW(0.9290745812593159, -0.3698924471489341),
+    TW(0.9285060804732156, -0.37131719395183754), TW(0.9279353948226179, -0.37274106700951576),
+    TW(0.9273625256504011, -0.37416406297145793), TW(0.9267874743045817, -0.3755861784892172),
+    TW(0.9262102421383114, -0.37700741021641826), TW(0.9256308305098727, -0.37842775480876556),
+    TW(0.9250492407826776, -0.37984720892405116), TW(0.9244654743252626, -0.3812657692221624),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.9232914167195276, -0.38410019501693504),
+    TW(0.9227011283338786, -0.38551605384391885), TW(0.9221086687433452, -0.3869310055143886),
+    TW(0.921514039342042, -0.38834504669882625), TW(0.9209172415291895, -0.3897581740698564),
+    TW(0.9203182767091106, -0.39117038430225387), TW(0.9197171462912274, -0.39258167407295147),
+    TW(0.9191138516900578, -0.3939920400610481), TW(0.9185083943252123, -0.39540147894781635),
+    TW(0.9179007756213905, -0.3968099874167103), TW(0.9172909970083779, -0.39821756215337356),
+    TW(0.9166790599210427, -0.3996241998456468), TW(0.9160649657993317, -0.4010298971835756),
+    TW(0.9154487160882678, -0.40243465085941843), TW(0.9148303122379462, -0.4038384575676541),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.9135870479452508, -0.40664321687036903),
+    TW(0.9129621904283982, -0.4080441628649787), TW(0.9123351846233227, -0.4094441486922576),
+    TW(0.9117060320054299, -0.4108431710579039), TW(0.9110747340551764, -0.4122412266698829),
+    TW(0.9104412922580672, -0.4136383122384345), TW(0.9098057081046522, -0.41503442447608163),
+    TW(0.9091679830905224, -0.41642956009763715), TW(0.9085281187163061, -0.41782371582021227),
+    TW(0.9078861164876663, -0.4192168883632239), TW(0.9072419779152958, -0.4206090744484025),
+    TW(0.9065957045149153, -0.4220002707997997), TW(0.9059472978072685, -0.42339047414379605),
+    TW(0.9052967593181188, -0.4247796812091088), TW(0.9046440905782462, -0.4261678887267996),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.9033323684945118, -0.4289412920553295),
+    TW(0.9026733182372588, -0.4303264813400826), TW(0.9020121439024932, -0.43171065802505726),
+    TW(0.901348847046022, -0.43309381885315196), TW(0.900683429228647, -0.43447596056965565),
+    TW(0.9000158920161603, -0.4358570799222555), TW(0.8993462369793416, -0.4372371736610441),
+    TW(0.8986744656939538, -0.43861623853852766), TW(0.8980005797407399, -0.43999427130963326),
+    TW(0.8973245807054183, -0.44137126873171667), TW(0.8966464701786802, -0.44274722756457),
+    TW(0.8959662497561852, -0.4441221445704292), TW(0.8952839210385576, -0.44549601651398174),
+    TW(0.8945994856313827, -0.44686884016237416), TW(0.8939129451452033, -0.4482406122852199),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.8925335554027646, -0.45098098904510386),
+    TW(0.8918407093923427, -0.4523495872337709), TW(0.8911457647945832, -0.45371712100016387),
+    TW(0.8904487232447579, -0.45508358712634384), TW(0.8897495863830728, -0.4564489823968839),
+    TW(0.8890483558546646, -0.4578133035988772), TW(0.8883450333095964, -0.4591765475219441),
+    TW(0.8876396204028539, -0.46053871095824), TW(0.8869321187943422, -0.46189979070246273),
+    TW(0.8862225301488806, -0.46325978355186015), TW(0.8855108561362, -0.4646186863062378),
+    TW(0.8847970984309378, -0.4659764957679662), TW(0.884081258712635, -0.4673332087419884),
+    TW(0.8833633386657316, -0.4686888220358279), TW(0.8826433399795628, -0.4700433324595956),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.8811971134712221, -0.4727490319503428),
+    TW(0.8804708890521608, -0.47410021465054997), TW(0.8797425928000474, -0.47545028174715587),
+    TW(0.8790122264286335, -0.4767992300633221), TW(0.8782797916565416, -0.478147056424843),
+    TW(0.8775452902072614, -0.479493757660153), TW(0.8768087238091457, -0.48083933060033396),
+    TW(0.8760700941954066, -0.4821837720791227), TW(0.8753294031041109, -0.48352707893291874),
+    TW(0.8745866522781761, -0.48486924800079106), TW(0.8738418434653669, -0.4862102761244864),
+    TW(0.8730949784182901, -0.487550160148436), TW(0.8723460588943915, -0.48888889691976317),
+    TW(0.871595086655951, -0.49022648328829116), TW(0.870842063470079, -0.4915629161065499),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.8693298713486068, -0.4942323085159597),
+    TW(0.8685707059713409, -0.49556526182577254), TW(0.8678094967633033, -0.49689704902265447),
+    TW(0.8670462455156926, -0.49822766697278187), TW(0.866280954024513, -0.49955711254508184),
+    TW(0.8655136240905691, -0.5008853826112407), TW(0.8647442575194624, -0.5022124740457108),
+    TW(0.8639728561215868, -0.5035383837257176), TW(0.8631994217121242, -0.5048631085312676),
+    TW(0.8624239561110406, -0.5061866453451552), TW(0.8616464611430813, -0.5075089910529709),
+    TW(0.8608669386377673, -0.508830142543107), TW(0.8600853904293901, -0.5101500967067668),
+    TW(0.8593018183570085, -0.5114688504379703), TW(0.8585162242644427, -0.512786400633563),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.8569389774178288, -0.5154178780194629),
+    TW(0.8561473283751945, -0.5167317990176499), TW(0.855353664735196, -0.5180445040959993),
+    TW(0.8545579883654005, -0.5193559901655896), TW(0.8537603011381114, -0.5206662541403672),
+    TW(0.8529606049303636, -0.5219752929371544), TW(0.8521589016239198, -0.5232831034756564),
+    TW(0.8513551931052652, -0.524589682678469), TW(0.8505494812656035, -0.5258950274710846),
+    TW(0.8497417680008525, -0.5271991347819013), TW(0.8489320552116396, -0.5285020015422285),
+    TW(0.8481203448032972, -0.5298036246862946), TW(0.8473066386858583, -0.531104001151255),
+    TW(0.8464909387740521, -0.5324031278771979), TW(0.8456732469872991, -0.533701001807153),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.8440318954900664, -0.5362929790659632),
+    TW(0.8432082396418454, -0.5375870762956454), TW(0.8423825996431858, -0.5388799085310084),
+    TW(0.8415549774368984, -0.5401714727298929), TW(0.8407253749704581, -0.5414617658531234),
+    TW(0.8398937941959995, -0.5427507848645159), TW(0.8390602370703127, -0.5440385267308838),
+    TW(0.8382247055548381, -0.5453249884220465), TW(0.8373872016156619, -0.5466101669108349),
+    TW(0.836547727223512, -0.5478940591731002), TW(0.8357062843537526, -0.5491766621877197),
+    TW(0.83486287498638, -0.5504579729366048), TW(0.8340175011060181, -0.5517379884047073),
+    TW(0.8331701647019132, -0.5530167055800275), TW(0.8323208677679297, -0.55429412145362),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.8306164003088463, -0.5568450372751601),
+    TW(0.829761233794523, -0.5581185312205561), TW(0.8289041147718649, -0.5593907118591361),
+    TW(0.8280450452577558, -0.560661576197336), TW(0.8271840272736691, -0.5619311212446895),
+    TW(0.8263210628456635, -0.5631993440138341), TW(0.8254561540043776, -0.5644662415205195),
+    TW(0.8245893027850253, -0.5657318107836131), TW(0.8237205112273914, -0.5669960488251087),
+    TW(0.8228497813758264, -0.5682589526701315), TW(0.8219771152792416, -0.5695205193469471),
+    TW(0.8211025149911046, -0.5707807458869673), TW(0.8202259825694347, -0.572039629324757),
+    TW(0.8193475200767969, -0.5732971666980422), TW(0.8184671295802987, -0.5745533550477158),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.8167005728668278, -0.5770616728556794),
+    TW(0.8158144108067338, -0.5783137964116556), TW(0.8149263290565266, -0.5795645591394056),
+    TW(0.8140363297059484, -0.5808139580957645), TW(0.8131444148492536, -0.5820619903407754),
+    TW(0.8122505865852039, -0.5833086529376983), TW(0.8113548470170637, -0.5845539429530153),
+    TW(0.8104571982525948, -0.5857978574564389), TW(0.8095576424040513, -0.587040393520918),
+    TW(0.808656181588175, -0.5882815482226452), TW(0.8077528179261904, -0.5895213186410639),
+    TW(0.8068475535437993, -0.5907597018588742), TW(0.8059403905711763, -0.591996694962041),
+    TW(0.8050313311429637, -0.5932322950397998), TW(0.8041203773982658, -0.5944664991846644),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.8022927955381157, -0.5969307080621965),
+    TW(0.8013761717231402, -0.5981607069963423), TW(0.8004576621926228, -0.5993892984005645),
+    TW(0.799537269107905, -0.600616479383869), TW(0.7986149946347608, -0.60184224705858),
+    TW(0.7976908409433912, -0.6030665985403482), TW(0.7967648102084188, -0.604289530948156),
+    TW(0.7958369046088836, -0.6055110414043255), TW(0.794907126328237, -0.6067311270345245),
+    TW(0.7939754775543372, -0.6079497849677736), TW(0.7930419604794436, -0.6091670123364532),
+    TW(0.7921065773002124, -0.6103828062763095), TW(0.7911693302176902, -0.6115971639264619),
+    TW(0.79023022143731, -0.6128100824294097), TW(0.7892892531688857, -0.6140215589310384),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.7874017470290314, -0.6164401745308536),
+    TW(0.7864552135990858, -0.6176473079378039), TW(0.7855068295640539, -0.6188529879609763),
+    TW(0.7845565971555752, -0.6200572117632891), TW(0.7836045186096382, -0.6212599765110876),
+    TW(0.7826505961665757, -0.62246127937415), TW(0.7816948320710594, -0.6236611175256945),
+    TW(0.7807372285720945, -0.6248594881423863), TW(0.7797777879230146, -0.6260563884043435),
+    TW(0.778816512381476, -0.6272518154951441), TW(0.7778534042094531, -0.6284457666018327),
+    TW(0.7768884656732324, -0.629638238914927), TW(0.7759216990434077, -0.6308292296284245),
+    TW(0.7749531065948739, -0.6320187359398091), TW(0.7739826906068229, -0.6332067550500572),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.7720363971503845, -0.6355783204885561),
+    TW(0.7710605242618138, -0.6367618612362842), TW(0.7700828369933479, -0.637943903621844),
+    TW(0.7691033376455797, -0.6391244448637757), TW(0.7681220285233654, -0.6403034821841517),
+    TW(0.7671389119358204, -0.6414810128085832), TW(0.7661539901963129, -0.6426570339662269),
+    TW(0.765167265622459, -0.6438315428897914), TW(0.7641787405361167, -0.6450045368155439),
+    TW(0.7631884172633813, -0.6461760129833163), TW(0.7621962981345789, -0.6473459686365121),
+    TW(0.7612023854842618, -0.6485144010221124), TW(0.7602066816512024, -0.6496813073906832),
+    TW(0.7592091889783881, -0.6508466849963809), TW(0.7582099098130153, -0.6520105310969595),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.7562060014143945, -0.6543336178318004),
+    TW(0.7552013768965365, -0.6554928529996153), TW(0.7541949753168892, -0.6566505457294289),
+    TW(0.7531867990436125, -0.6578066932970786), TW(0.7521768504490428, -0.6589612929820373),
+    TW(0.7511651319096865, -0.6601143420674205), TW(0.7501516458062151, -0.6612658378399923),
+    TW(0.7491363945234594, -0.6624157775901718), TW(0.7481193804504036, -0.6635641586120398),
+    TW(0.7471006059801801, -0.6647109782033448), TW(0.7460800735100638, -0.6658562336655097),
+    TW(0.7450577854414661, -0.6669999223036375), TW(0.7440337441799293, -0.6681420414265185),
+    TW(0.7430079521351217, -0.669282588346636), TW(0.7419804117208311, -0.6704215603801731),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.7399200954595162, -0.6726947690707729),
+    TW(0.7388873244606151, -0.673829000378756), TW(0.737852814788466, -0.6749616461020119),
+    TW(0.7368165688773699, -0.6760927035753159), TW(0.7357785891657136, -0.6772221701371803),
+    TW(0.7347388780959635, -0.6783500431298615), TW(0.7336974381146604, -0.679476319899365),
+    TW(0.7326542716724128, -0.680600997795453), TW(0.7316093812238926, -0.6817240741716497),
+    TW(0.7305627692278276, -0.6828455463852481), TW(0.729514438146997, -0.6839654117973154),
+    TW(0.7284643904482252, -0.6850836677727004), TW(0.7274126286023758, -0.6862003116800386),
+    TW(0.726359155084346, -0.687315340891759), TW(0.7253039723730608, -0.6884287527840904),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.7231884893065275, -0.6906507141345346),
+    TW(0.7221281939292153, -0.6917592583641577), TW(0.7210661993145081, -0.6928661748174246),
+    TW(0.7200025079613817, -0.693971460889654), TW(0.7189371223728045, -0.6950751139800009),
+    TW(0.7178700450557317, -0.696177131491463), TW(0.7168012785210995, -0.6972775108308865),
+    TW(0.7157308252838186, -0.6983762494089729), TW(0.7146586878627691, -0.6994733446402838),
+    TW(0.7135848687807936, -0.7005687939432483), TW(0.7125093705646923, -0.7016625947401685),
+    TW(0.7114321957452164, -0.7027547444572253), TW(0.7103533468570624, -0.7038452405244849),
+    TW(0.7092728264388657, -0.7049340803759049), TW(0.7081906370331954, -0.7060212614493397),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.7060212614493397, -0.7081906370331953),
+    TW(0.704934080375905, -0.7092728264388656), TW(0.7038452405244849, -0.7103533468570623),
+    TW(0.7027547444572253, -0.7114321957452164), TW(0.7016625947401686, -0.7125093705646923),
+    TW(0.7005687939432484, -0.7135848687807935), TW(0.6994733446402838, -0.714658687862769),
+    TW(0.6983762494089729, -0.7157308252838186), TW(0.6972775108308866, -0.7168012785210995),
+    TW(0.696177131491463, -0.7178700450557317), TW(0.6950751139800009, -0.7189371223728044),
+    TW(0.693971460889654, -0.7200025079613817), TW(0.6928661748174247, -0.7210661993145081),
+    TW(0.6917592583641577, -0.7221281939292153), TW(0.6906507141345347, -0.7231884893065273),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.6884287527840905, -0.7253039723730607),
+    TW(0.6873153408917592, -0.726359155084346), TW(0.6862003116800387, -0.7274126286023758),
+    TW(0.6850836677727004, -0.7284643904482252), TW(0.6839654117973155, -0.7295144381469969),
+    TW(0.6828455463852481, -0.7305627692278276), TW(0.6817240741716498, -0.7316093812238925),
+    TW(0.6806009977954531, -0.7326542716724128), TW(0.6794763198993651, -0.7336974381146603),
+    TW(0.6783500431298616, -0.7347388780959634), TW(0.6772221701371804, -0.7357785891657135),
+    TW(0.676092703575316, -0.7368165688773698), TW(0.674961646102012, -0.737852814788466),
+    TW(0.6738290003787561, -0.7388873244606151), TW(0.672694769070773, -0.7399200954595161),
+    TW(0.6715589548470183, -0.7409511253549591), TW(0.6704215603801731, -0.741980411720831),
+    TW(0.669282588346636, -0.7430079521351217), TW(0.6681420414265186, -0.7440337441799292),
+    TW(0.6669999223036375, -0.745057785441466), TW(0.6658562336655097, -0.7460800735100638),
+    TW(0.6647109782033449, -0.7471006059801801), TW(0.6635641586120399, -0.7481193804504035),
+    TW(0.6624157775901718, -0.7491363945234593), TW(0.6612658378399923, -0.750151645806215),
+    TW(0.6601143420674205, -0.7511651319096864), TW(0.6589612929820373, -0.7521768504490427),
+    TW(0.6578066932970786, -0.7531867990436124), TW(0.656650545729429, -0.7541949753168892),
+    TW(0.6554928529996155, -0.7552013768965365), TW(0.6543336178318006, -0.7562060014143945),
+    TW(0.6531728429537768, -0.7572088465064845), TW(0.6520105310969595, -0.7582099098130153),
+    TW(0.650846684996381, -0.759209188978388), TW(0.6496813073906832, -0.7602066816512024),
+    TW(0.6485144010221126, -0.7612023854842618), TW(0.6473459686365121, -0.7621962981345789),
+    TW(0.6461760129833164, -0.7631884172633813), TW(0.645004536815544, -0.7641787405361167),
+    TW(0.6438315428897915, -0.765167265622459), TW(0.6426570339662269, -0.7661539901963128),
+    TW(0.6414810128085832, -0.7671389119358204), TW(0.6403034821841517, -0.7681220285233653),
+    TW(0.6391244448637757, -0.7691033376455796), TW(0.6379439036218442, -0.7700828369933479),
+    TW(0.6367618612362842, -0.7710605242618137), TW(0.6355783204885562, -0.7720363971503844),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.6332067550500572, -0.7739826906068228),
+    TW(0.6320187359398091, -0.7749531065948738), TW(0.6308292296284245, -0.7759216990434076),
+    TW(0.6296382389149271, -0.7768884656732324), TW(0.6284457666018327, -0.777853404209453),
+    TW(0.6272518154951442, -0.7788165123814759), TW(0.6260563884043435, -0.7797777879230144),
+    TW(0.6248594881423865, -0.7807372285720944), TW(0.6236611175256946, -0.7816948320710594),
+    TW(0.6224612793741501, -0.7826505961665757), TW(0.6212599765110877, -0.7836045186096382),
+    TW(0.6200572117632892, -0.7845565971555752), TW(0.6188529879609763, -0.7855068295640539),
+    TW(0.617647307937804, -0.7864552135990858), TW(0.6164401745308536, -0.7874017470290313),
+    TW(0.6152315905806268, -0.7883464276266062), TW(0.6140215589310385, -0.7892892531688857),
+    TW(0.6128100824294097, -0.79023022143731), TW(0.611597163926462, -0.7911693302176901),
+    TW(0.6103828062763095, -0.7921065773002124), TW(0.6091670123364532, -0.7930419604794436),
+    TW(0.6079497849677737, -0.7939754775543372), TW(0.6067311270345245, -0.794907126328237),
+    TW(0.6055110414043255, -0.7958369046088835), TW(0.6042895309481561, -0.7967648102084187),
+    TW(0.6030665985403483, -0.797690840943391), TW(0.60184224705858, -0.7986149946347608),
+    TW(0.600616479383869, -0.799537269107905), TW(0.5993892984005645, -0.8004576621926227),
+    TW(0.5981607069963424, -0.8013761717231401), TW(0.5969307080621965, -0.8022927955381157),
+    TW(0.5956993044924335, -0.8032075314806448), TW(0.5944664991846645, -0.8041203773982657),
+    TW(0.5932322950397998, -0.8050313311429637), TW(0.591996694962041, -0.8059403905711763),
+    TW(0.5907597018588743, -0.8068475535437992), TW(0.5895213186410639, -0.8077528179261904),
+    TW(0.5882815482226453, -0.808656181588175), TW(0.5870403935209181, -0.8095576424040513),
+    TW(0.5857978574564389, -0.8104571982525948), TW(0.5845539429530153, -0.8113548470170637),
+    TW(0.5833086529376983, -0.8122505865852039), TW(0.5820619903407755, -0.8131444148492536),
+    TW(0.5808139580957645, -0.8140363297059483), TW(0.5795645591394057, -0.8149263290565266),
+    TW(0.5783137964116556, -0.8158144108067338), TW(0.5770616728556796, -0.8167005728668278),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.5745533550477158, -0.8184671295802987),
+    TW(0.5732971666980423, -0.8193475200767969), TW(0.572039629324757, -0.8202259825694347),
+    TW(0.5707807458869674, -0.8211025149911046), TW(0.5695205193469473, -0.8219771152792416),
+    TW(0.5682589526701315, -0.8228497813758263), TW(0.5669960488251087, -0.8237205112273913),
+    TW(0.5657318107836132, -0.8245893027850253), TW(0.5644662415205195, -0.8254561540043774),
+    TW(0.5631993440138341, -0.8263210628456634), TW(0.5619311212446895, -0.827184027273669),
+    TW(0.560661576197336, -0.8280450452577558), TW(0.5593907118591361, -0.8289041147718649),
+    TW(0.5581185312205561, -0.829761233794523), TW(0.5568450372751601, -0.8306164003088462),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.5542941214536201, -0.8323208677679297),
+    TW(0.5530167055800276, -0.8331701647019132), TW(0.5517379884047074, -0.8340175011060181),
+    TW(0.5504579729366048, -0.83486287498638), TW(0.5491766621877198, -0.8357062843537526),
+    TW(0.5478940591731002, -0.8365477272235119), TW(0.5466101669108349, -0.8373872016156619),
+    TW(0.5453249884220465, -0.838224705554838), TW(0.5440385267308839, -0.8390602370703126),
+    TW(0.542750784864516, -0.8398937941959994), TW(0.5414617658531236, -0.8407253749704581),
+    TW(0.540171472729893, -0.8415549774368983), TW(0.5388799085310084, -0.842382599643186),
+    TW(0.5375870762956455, -0.8432082396418454), TW(0.5362929790659632, -0.8440318954900664),
+    TW(0.5349976198870973, -0.844853565249707), TW(0.533701001807153, -0.8456732469872991),
+    TW(0.532403127877198, -0.846490938774052), TW(0.531104001151255, -0.8473066386858583),
+    TW(0.5298036246862948, -0.8481203448032971), TW(0.5285020015422285, -0.8489320552116396),
+    TW(0.5271991347819014, -0.8497417680008524), TW(0.5258950274710847, -0.8505494812656034),
+    TW(0.5245896826784688, -0.8513551931052652), TW(0.5232831034756564, -0.8521589016239198),
+    TW(0.5219752929371544, -0.8529606049303636), TW(0.5206662541403673, -0.8537603011381113),
+    TW(0.5193559901655895, -0.8545579883654005), TW(0.5180445040959993, -0.855353664735196),
+    TW(0.51673179901765, -0.8561473283751945), TW(0.5154178780194631, -0.8569389774178287),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.5127864006335631, -0.8585162242644427),
+    TW(0.5114688504379705, -0.8593018183570084), TW(0.5101500967067667, -0.8600853904293901),
+    TW(0.508830142543107, -0.8608669386377673), TW(0.5075089910529709, -0.8616464611430813),
+    TW(0.5061866453451555, -0.8624239561110405), TW(0.5048631085312675, -0.8631994217121242),
+    TW(0.5035383837257176, -0.8639728561215867), TW(0.5022124740457109, -0.8647442575194624),
+    TW(0.5008853826112409, -0.865513624090569), TW(0.4995571125450819, -0.866280954024513),
+    TW(0.49822766697278187, -0.8670462455156926), TW(0.49689704902265464, -0.8678094967633032),
+    TW(0.4955652618257725, -0.8685707059713409), TW(0.49423230851595973, -0.8693298713486067),
+    TW(0.4928981922297841, -0.8700869911087113), TW(0.49156291610655006, -0.8708420634700789),
+    TW(0.4902264832882911, -0.8715950866559511), TW(0.4888888969197632, -0.8723460588943915),
+    TW(0.48755016014843605, -0.8730949784182901), TW(0.48621027612448653, -0.8738418434653668),
+    TW(0.4848692480007911, -0.8745866522781761), TW(0.48352707893291874, -0.8753294031041108),
+    TW(0.48218377207912283, -0.8760700941954066), TW(0.4808393306003339, -0.8768087238091458),
+    TW(0.479493757660153, -0.8775452902072612), TW(0.4781470564248431, -0.8782797916565415),
+    TW(0.47679923006332225, -0.8790122264286334), TW(0.47545028174715587, -0.8797425928000474),
+    TW(0.47410021465055, -0.8804708890521608), TW(0.4727490319503429, -0.881197113471222),
+    TW(0.4713967368259978, -0.8819212643483549), TW(0.4700433324595956, -0.8826433399795628),
+    TW(0.46868882203582796, -0.8833633386657316), TW(0.4673332087419885, -0.884081258712635),
+    TW(0.4659764957679661, -0.8847970984309378), TW(0.4646186863062378, -0.8855108561362),
+    TW(0.46325978355186026, -0.8862225301488806), TW(0.46189979070246284, -0.8869321187943421),
+    TW(0.46053871095824, -0.8876396204028539), TW(0.45917654752194415, -0.8883450333095962),
+    TW(0.4578133035988773, -0.8890483558546646), TW(0.45644898239688386, -0.8897495863830729),
+    TW(0.45508358712634384, -0.8904487232447579), TW(0.4537171210001639, -0.8911457647945832),
+    TW(0.452349587233771, -0.8918407093923427), TW(0.4509809890451038, -0.8925335554027647),
+    TW(0.4496113296546066, -0.8932243011955153), TW(0.44824061228522, -0.8939129451452033),
+    TW(0.4468688401623743, -0.8945994856313826), TW(0.44549601651398174, -0.8952839210385576),
+    TW(0.44412214457042926, -0.8959662497561851), TW(0.44274722756457013, -0.8966464701786802),
+    TW(0.4413712687317166, -0.8973245807054183), TW(0.43999427130963326, -0.8980005797407399),
+    TW(0.4386162385385277, -0.8986744656939538), TW(0.4372371736610442, -0.8993462369793415),
+    TW(0.4358570799222555, -0.9000158920161603), TW(0.4344759605696557, -0.9006834292286469),
+    TW(0.433093818853152, -0.901348847046022), TW(0.43171065802505737, -0.9020121439024931),
+    TW(0.4303264813400826, -0.9026733182372588), TW(0.42894129205532955, -0.9033323684945118),
+    TW(0.4275550934302822, -0.9039892931234433), TW(0.4261678887267996, -0.9046440905782462),
+    TW(0.4247796812091088, -0.9052967593181188), TW(0.4233904741437961, -0.9059472978072685),
+    TW(0.4220002707997998, -0.9065957045149153), TW(0.4206090744484025, -0.9072419779152959),
+    TW(0.41921688836322396, -0.9078861164876662), TW(0.4178237158202124, -0.9085281187163061),
+    TW(0.4164295600976373, -0.9091679830905223), TW(0.41503442447608163, -0.9098057081046522),
+    TW(0.41363831223843456, -0.9104412922580671), TW(0.412241226669883, -0.9110747340551762),
+    TW(0.4108431710579039, -0.9117060320054299), TW(0.4094441486922576, -0.9123351846233227),
+    TW(0.40804416286497874, -0.9129621904283981), TW(0.40664321687036914, -0.9135870479452508),
+    TW(0.40524131400498986, -0.9142097557035307), TW(0.40383845756765413, -0.9148303122379461),
+    TW(0.40243465085941854, -0.9154487160882678), TW(0.4010298971835758, -0.9160649657993316),
+    TW(0.3996241998456468, -0.9166790599210427), TW(0.3982175621533736, -0.9172909970083779),
+    TW(0.3968099874167104, -0.9179007756213904), TW(0.3954014789478163, -0.9185083943252123),
+    TW(0.3939920400610481, -0.9191138516900578), TW(0.3925816740729515, -0.9197171462912274),
+    TW(0.391170384302254, -0.9203182767091105), TW(0.3897581740698564, -0.9209172415291895),
+    TW(0.3883450466988263, -0.9215140393420419), TW(0.3869310055143887, -0.9221086687433451),
+    TW(0.385516053843919, -0.9227011283338785), TW(0.38410019501693504, -0.9232914167195276),
+    TW(0.38268343236508984, -0.9238795325112867), TW(0.3812657692221625, -0.9244654743252626),
+    TW(0.3798472089240511, -0.9250492407826776), TW(0.3784277548087656, -0.9256308305098727),
+    TW(0.3770074102164183, -0.9262102421383113), TW(0.3755861784892173, -0.9267874743045817),
+    TW(0.374164062971458, -0.9273625256504011), TW(0.3727410670095158, -0.9279353948226179),
+    TW(0.3713171939518376, -0.9285060804732155), TW(0.36989244714893427, -0.9290745812593157),
+    TW(0.3684668299533723, -0.9296408958431813), TW(0.36704034571976724, -0.9302050228922191),
+    TW(0.36561299780477396, -0.9307669610789837), TW(0.36418478956707984, -0.9313267090811804),
+    TW(0.3627557243673972, -0.9318842655816681), TW(0.36132580556845434, -0.9324396292684624),
+    TW(0.3598950365349883, -0.9329927988347388), TW(0.35846342063373654, -0.9335437729788362),
+    TW(0.35703096123343003, -0.9340925504042589), TW(0.35559766170478396, -0.9346391298196808),
+    TW(0.3541635254204905, -0.9351835099389475), TW(0.3527285557552107, -0.9357256894810804),
+    TW(0.35129275608556715, -0.9362656671702783), TW(0.34985612979013503, -0.9368034417359216),
+    TW(0.3484186802494345, -0.937339011912575), TW(0.3469804108459237, -0.9378723764399899),
+    TW(0.34554132496398915, -0.9384035340631081), TW(0.344101425989939, -0.9389324835320645),
+    TW(0.3426607173119944, -0.9394592236021899), TW(0.3412192023202824, -0.9399837530340139),
+    TW(0.33977688440682696, -0.9405060705932683), TW(0.3383337669655413, -0.9410261750508893),
+    TW(0.33688985339222005, -0.9415440651830208), TW(0.33544514708453166, -0.9420597397710173),
+    TW(0.3339996514420095, -0.9425731976014469), TW(0.3325533698660442, -0.9430844374660935),
+    TW(0.33110630575987643, -0.9435934581619604), TW(0.32965846252858755, -0.9441002584912727),
+    TW(0.32820984357909266, -0.9446048372614803), TW(0.3267604523201318, -0.9451071932852606),
+    TW(0.325310292162263, -0.9456073253805213), TW(0.32385936651785296, -0.9461052323704033),
+    TW(0.32240767880107, -0.9466009130832835), TW(0.3209552324278752, -0.9470943663527772),
+    TW(0.31950203081601575, -0.9475855910177411), TW(0.31804807738501506, -0.9480745859222762),
+    TW(0.31659337555616585, -0.9485613499157303), TW(0.31513792875252244, -0.9490458818527006),
+    TW(0.3136817403988916, -0.9495281805930367), TW(0.31222481392182505, -0.950008245001843),
+    TW(0.3107671527496115, -0.9504860739494817), TW(0.3093087603122688, -0.9509616663115751),
+    TW(0.307849640041535, -0.9514350209690083), TW(0.3063897953708611, -0.9519061368079322),
+    TW(0.30492922973540243, -0.9523750127197659), TW(0.30346794657201137, -0.9528416476011987),
+    TW(0.3020059493192282, -0.9533060403541938), TW(0.3005432414172734, -0.9537681898859903),
+    TW(0.2990798263080405, -0.9542280951091057), TW(0.2976157074350863, -0.9546857549413383),
+    TW(0.29615088824362396, -0.9551411683057707), TW(0.2946853721805143, -0.9555943341307711),
+    TW(0.2932191626942587, -0.9560452513499964), TW(0.2917522632349894, -0.956493918902395),
+    TW(0.29028467725446233, -0.9569403357322089), TW(0.2888164082060495, -0.9573845007889759),
+    TW(0.28734745954472957, -0.9578264130275329), TW(0.2858778347270807, -0.9582660714080177),
+    TW(0.2844075372112718, -0.9587034748958716), TW(0.2829365704570554, -0.9591386224618419),
+    TW(0.28146493792575805, -0.9595715130819845), TW(0.2799926430802734, -0.9600021457376658),
+    TW(0.27851968938505306, -0.9604305194155658), TW(0.27704608030609995, -0.9608566331076797),
+    TW(0.27557181931095825, -0.9612804858113206), TW(0.27409690986870633, -0.9617020765291225),
+    TW(0.272621355449949, -0.9621214042690416), TW(0.27114515952680807, -0.9625384680443592),
+    TW(0.2696683255729152, -0.9629532668736839), TW(0.2681908570634032, -0.963365799780954),
+    TW(0.2667127574748984, -0.9637760657954398), TW(0.2652340302855119, -0.9641840639517457),
+    TW(0.2637546789748315, -0.9645897932898126), TW(0.2622747070239136, -0.9649932528549203),
+    TW(0.26079411791527557, -0.9653944416976894), TW(0.25931291513288635, -0.9657933588740836),
+    TW(0.25783110216215893, -0.9661900034454126), TW(0.2563486824899429, -0.9665843744783331),
+    TW(0.2548656596045146, -0.9669764710448521), TW(0.25338203699557027, -0.9673662922223285),
+    TW(0.2518978181542169, -0.9677538370934755), TW(0.2504130065729653, -0.9681391047463623),
+    TW(0.24892760574572026, -0.9685220942744173), TW(0.24744161916777344, -0.9689028047764289),
+    TW(0.2459550503357946, -0.9692812353565485), TW(0.2444679027478242, -0.9696573851242924),
+    TW(0.24298017990326398, -0.970031253194544), TW(0.2414918853028693, -0.9704028386875555),
+    TW(0.2400030224487415, -0.9707721407289504), TW(0.2385135948443185, -0.9711391584497251),
+    TW(0.23702360599436734, -0.9715038909862518), TW(0.23553305940497546, -0.9718663374802794),
+    TW(0.23404195858354346, -0.9722264970789363), TW(0.23255030703877533, -0.9725843689347322),
+    TW(0.23105810828067128, -0.9729399522055601), TW(0.22956536582051887, -0.9732932460546982),
+    TW(0.2280720831708858, -0.9736442496508119), TW(0.2265782638456101, -0.9739929621679558),
+    TW(0.22508391135979278, -0.9743393827855759), TW(0.22358902922979002, -0.9746835106885107),
+    TW(0.2220936209732036, -0.9750253450669941), TW(0.22059769010887365, -0.9753648851166569),
+    TW(0.21910124015686977, -0.9757021300385286), TW(0.21760427463848367, -0.976037079039039),
+    TW(0.2161067970762196, -0.9763697313300211), TW(0.21460881099378692, -0.9767000861287118),
+    TW(0.21311031991609136, -0.9770281426577544), TW(0.2116113273692276, -0.9773539001452),
+    TW(0.21011183688046972, -0.9776773578245099), TW(0.20861185197826346, -0.9779985149345571),
+    TW(0.20711137619221856, -0.9783173707196277), TW(0.20561041305309932, -0.9786339244294231),
+    TW(0.204108966092817, -0.9789481753190622), TW(0.2026070388444211, -0.979260122649082),
+    TW(0.20110463484209196, -0.9795697656854405), TW(0.19960175762113105, -0.9798771036995176),
+    TW(0.19809841071795373, -0.9801821359681173), TW(0.19659459767008022, -0.9804848617734694),
+    TW(0.19509032201612833, -0.9807852804032304), TW(0.19358558729580375, -0.9810833911504866),
+    TW(0.19208039704989238, -0.9813791933137546), TW(0.1905747548202528, -0.9816726861969831),
+    TW(0.18906866414980628, -0.9819638691095552), TW(0.18756212858252974, -0.9822527413662894),
+    TW(0.18605515166344663, -0.9825393022874412), TW(0.18454773693861964, -0.9828235511987052),
+    TW(0.18303988795514106, -0.9831054874312163), TW(0.18153160826112513, -0.9833851103215512),
+    TW(0.18002290140569951, -0.9836624192117303), TW(0.1785137709389976, -0.9839374134492189),
+    TW(0.17700422041214886, -0.984210092386929), TW(0.17549425337727137, -0.9844804553832209),
+    TW(0.17398387338746385, -0.9847485018019042), TW(0.17247308399679603, -0.9850142310122398),
+    TW(0.17096188876030136, -0.9852776423889412), TW(0.16945029123396793, -0.9855387353121761),
+    TW(0.16793829497473123, -0.9857975091675674), TW(0.16642590354046422, -0.9860539633461954),
+    TW(0.1649131204899701, -0.9863080972445987), TW(0.16339994938297323, -0.9865599102647754),
+    TW(0.16188639378011188, -0.9868094018141854), TW(0.1603724572429284, -0.987056571305751),
+    TW(0.1588581433338614, -0.9873014181578584), TW(0.15734345561623828, -0.9875439417943592),
+    TW(0.15582839765426532, -0.9877841416445722), TW(0.15431297301302024, -0.9880220171432835),
+    TW(0.1527971852584434, -0.9882575677307495), TW(0.15128103795733025, -0.9884907928526966),
+    TW(0.14976453467732162, -0.9887216919603238), TW(0.1482476789868962, -0.988950264510303),
+    TW(0.14673047445536175, -0.989176509964781), TW(0.14521292465284752, -0.9894004277913804),
+    TW(0.14369503315029458, -0.9896220174632008), TW(0.142176803519448, -0.9898412784588205),
+    TW(0.14065823933284924, -0.9900582102622971), TW(0.13913934416382628, -0.9902728123631691),
+    TW(0.13762012158648618, -0.990485084256457), TW(0.1361005751757062, -0.9906950254426646),
+    TW(0.13458070850712622, -0.99090263542778), TW(0.13306052515713918, -0.9911079137232768),
+    TW(0.13154002870288328, -0.9913108598461154), TW(0.13001922272223335, -0.9915114733187439),
+    TW(0.12849811079379322, -0.9917097536690995), TW(0.12697669649688598, -0.9919057004306093),
+    TW(0.1254549834115462, -0.9920993131421918), TW(0.1239329751185122, -0.9922905913482574),
+    TW(0.12241067519921628, -0.99247953459871), TW(0.12088808723577722, -0.992666142448948),
+    TW(0.11936521481099135, -0.9928504144598651), TW(0.11784206150832502, -0.9930323501978514),
+    TW(0.11631863091190488, -0.9932119492347945), TW(0.11479492660651025, -0.9933892111480807),
+    TW(0.11327095217756436, -0.9935641355205953), TW(0.11174671121112666, -0.9937367219407246),
+    TW(0.11022220729388318, -0.9939069700023561), TW(0.10869744401313867, -0.9940748793048794),
+    TW(0.10717242495680887, -0.9942404494531879), TW(0.1056471537134107, -0.9944036800576791),
+    TW(0.10412163387205473, -0.9945645707342554), TW(0.10259586902243628, -0.9947231211043257),
+    TW(0.10106986275482788, -0.9948793307948056), TW(0.09954361866006944, -0.9950331994381186),
+    TW(0.09801714032956077, -0.9951847266721968), TW(0.0964904313552526, -0.9953339121404823),
+    TW(0.09496349532963906, -0.9954807554919269), TW(0.09343633584574791, -0.9956252563809943),
+    TW(0.0919089564971327, -0.9957674144676598), TW(0.09038136087786501, -0.9959072294174117),
+    TW(0.08885355258252468, -0.996044700901252), TW(0.08732553520619223, -0.9961798285956969),
+    TW(0.08579731234443988, -0.996312612182778), TW(0.08426888759332413, -0.9964430513500426),
+    TW(0.0827402645493758, -0.9965711457905548), TW(0.08121144680959239, -0.9966968952028961),
+    TW(0.07968243797143013, -0.9968202992911657), TW(0.07815324163279432, -0.9969413577649822),
+    TW(0.07662386139203162, -0.997060070339483), TW(0.07509430084792129, -0.9971764367353262),
+    TW(0.07356456359966745, -0.9972904566786902), TW(0.07203465324688942, -0.9974021299012753),
+    TW(0.07050457338961401, -0.9975114561403035), TW(0.06897432762826673, -0.9976184351385196),
+    TW(0.0674439195636641, -0.9977230666441916), TW(0.06591335279700393, -0.9978253504111116),
+    TW(0.06438263092985741, -0.997925286198596), TW(0.06285175756416142, -0.9980228737714862),
+    TW(0.06132073630220865, -0.9981181129001492), TW(0.05978957074664001, -0.9982110033604782),
+    TW(0.05825826450043573, -0.9983015449338929), TW(0.05672682116690778, -0.9983897374073402),
+    TW(0.05519524434969003, -0.9984755805732948), TW(0.05366353765273068, -0.9985590742297593),
+    TW(0.05213170468028332, -0.9986402181802653), TW(0.05059974903689934, -0.9987190122338729),
+    TW(0.049067674327418126, -0.9987954562051724), TW(0.04753548415695926, -0.9988695499142836),
+    TW(0.046003182130914644, -0.9989412931868569), TW(0.044470771854938744, -0.9990106858540734),
+    TW(0.04293825693494096, -0.9990777277526454), TW(0.04140564097707671, -0.9991424187248169),
+    TW(0.039872927587739845, -0.9992047586183639), TW(0.03834012037355279, -0.9992647472865944),
+    TW(0.03680722294135899, -0.9993223845883495), TW(0.03527423889821395, -0.9993776703880028),
+    TW(0.03374117185137764, -0.9994306045554617), TW(0.032208025408304704, -0.999481186966167),
+    TW(0.03067480317663658, -0.9995294175010931), TW(0.02914150876419374, -0.9995752960467492),
+    TW(0.02760814577896582, -0.9996188224951786), TW(0.02607471782910404, -0.9996599967439592),
+    TW(0.024541228522912264, -0.9996988186962042), TW(0.02300768146883941, -0.9997352882605617),
+    TW(0.021474080275469605, -0.9997694053512153), TW(0.019940428551514598, -0.9998011698878843),
+    TW(0.01840672990580482, -0.9998305817958234), TW(0.016872987947281773, -0.9998576410058239),
+    TW(0.01533920628498822, -0.9998823474542126), TW(0.013805388528060349, -0.9999047010828529),
+    TW(0.012271538285719944, -0.9999247018391445), TW(0.010737659167264572, -0.9999423496760239),
+    TW(0.00920375478205996, -0.9999576445519639), TW(0.007669828739531077, -0.9999705864309741),
+    TW(0.006135884649154515, -0.9999811752826011), TW(0.004601926120448672, -0.9999894110819284),
+    TW(0.003067956762966138, -0.9999952938095762), TW(0.0015339801862847662, -0.9999988234517019),
+    TW(6.123233995736766e-17, -1.0), TW(-0.0015339801862846436, -0.9999988234517019),
+    TW(-0.0030679567629660156, -0.9999952938095762), TW(-0.00460192612044855, -0.9999894110819284),
+    TW(-0.006135884649154393, -0.9999811752826011), TW(-0.007669828739530955, -0.9999705864309741),
+    TW(-0.009203754782059837, -0.9999576445519639), TW(-0.010737659167264449, -0.9999423496760239),
+    TW(-0.012271538285719823, -0.9999247018391445), TW(-0.013805388528060226, -0.9999047010828529),
+    TW(-0.015339206284988098, -0.9998823474542126), TW(-0.01687298794728165, -0.9998576410058239),
+    TW(-0.018406729905804695, -0.9998305817958234), TW(-0.019940428551514476, -0.9998011698878843),
+    TW(-0.021474080275469484, -0.9997694053512153), TW(-0.02300768146883929, -0.9997352882605617),
+    TW(-0.024541228522912142, -0.9996988186962042), TW(-0.026074717829103915, -0.9996599967439592),
+    TW(-0.027608145778965698, -0.9996188224951786), TW(-0.029141508764193618, -0.9995752960467492),
+    TW(-0.03067480317663646, -0.9995294175010931), TW(-0.03220802540830458, -0.999481186966167),
+    TW(-0.03374117185137752, -0.9994306045554617), TW(-0.03527423889821382, -0.9993776703880028),
+    TW(-0.036807222941358866, -0.9993223845883495), TW(-0.038340120373552666, -0.9992647472865944),
+    TW(-0.03987292758773973, -0.9992047586183639), TW(-0.041405640977076594, -0.9991424187248169),
+    TW(-0.042938256934940834, -0.9990777277526454), TW(-0.04447077185493862, -0.9990106858540734),
+    TW(-0.04600318213091452, -0.9989412931868569), TW(-0.047535484156959136, -0.9988695499142836),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(-0.05059974903689921, -0.9987190122338729),
+    TW(-0.05213170468028319, -0.9986402181802653), TW(-0.053663537652730554, -0.9985590742297593),
+    TW(-0.05519524434968991, -0.9984755805732948), TW(-0.05672682116690766, -0.9983897374073402),
+    TW(-0.05825826450043561, -0.9983015449338929), TW(-0.05978957074663988, -0.9982110033604782),
+    TW(-0.06132073630220853, -0.9981181129001492), TW(-0.06285175756416131, -0.9980228737714862),
+    TW(-0.06438263092985728, -0.997925286198596), TW(-0.0659133527970038, -0.9978253504111116),
+    TW(-0.06744391956366398, -0.9977230666441916), TW(-0.06897432762826661, -0.9976184351385196),
+    TW(-0.0705045733896139, -0.9975114561403035), TW(-0.07203465324688929, -0.9974021299012753),
+    TW(-0.07356456359966733, -0.9972904566786902), TW(-0.07509430084792117, -0.9971764367353262),
+    TW(-0.0766238613920315, -0.997060070339483), TW(-0.07815324163279419, -0.9969413577649822),
+    TW(-0.07968243797143001, -0.9968202992911658), TW(-0.08121144680959226, -0.9966968952028961),
+    TW(-0.08274026454937568, -0.9965711457905548), TW(-0.084268887593324, -0.9964430513500426),
+    TW(-0.08579731234443976, -0.996312612182778), TW(-0.0873255352061921, -0.9961798285956969),
+    TW(-0.08885355258252456, -0.996044700901252), TW(-0.09038136087786489, -0.9959072294174117),
+    TW(-0.09190895649713257, -0.9957674144676598), TW(-0.09343633584574779, -0.9956252563809943),
+    TW(-0.09496349532963895, -0.9954807554919269), TW(-0.09649043135525248, -0.9953339121404823),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.09954361866006932, -0.9950331994381186),
+    TW(-0.10106986275482775, -0.9948793307948056), TW(-0.10259586902243616, -0.9947231211043257),
+    TW(-0.1041216338720546, -0.9945645707342554), TW(-0.10564715371341057, -0.9944036800576791),
+    TW(-0.10717242495680876, -0.9942404494531879), TW(-0.10869744401313856, -0.9940748793048795),
+    TW(-0.11022220729388306, -0.9939069700023561), TW(-0.11174671121112655, -0.9937367219407246),
+    TW(-0.11327095217756424, -0.9935641355205953), TW(-0.11479492660651013, -0.9933892111480807),
+    TW(-0.11631863091190475, -0.9932119492347945), TW(-0.1178420615083249, -0.9930323501978514),
+    TW(-0.11936521481099123, -0.9928504144598651), TW(-0.1208880872357771, -0.992666142448948),
+    TW(-0.12241067519921615, -0.99247953459871), TW(-0.12393297511851208, -0.9922905913482574),
+    TW(-0.12545498341154607, -0.9920993131421918), TW(-0.12697669649688587, -0.9919057004306093),
+    TW(-0.1284981107937931, -0.9917097536690995), TW(-0.13001922272223324, -0.991511473318744),
+    TW(-0.13154002870288314, -0.9913108598461154), TW(-0.13306052515713904, -0.9911079137232769),
+    TW(-0.1345807085071261, -0.99090263542778), TW(-0.13610057517570606, -0.9906950254426646),
+    TW(-0.13762012158648607, -0.990485084256457), TW(-0.13913934416382617, -0.9902728123631691),
+    TW(-0.14065823933284913, -0.9900582102622971), TW(-0.1421768035194479, -0.9898412784588205),
+    TW(-0.14369503315029444, -0.9896220174632009), TW(-0.1452129246528474, -0.9894004277913804),
+    TW(-0.14673047445536164, -0.989176509964781), TW(-0.1482476789868961, -0.988950264510303),
+    TW(-0.1497645346773215, -0.9887216919603238), TW(-0.15128103795733014, -0.9884907928526967),
+    TW(-0.1527971852584433, -0.9882575677307495), TW(-0.15431297301302013, -0.9880220171432835),
+    TW(-0.1558283976542652, -0.9877841416445722), TW(-0.15734345561623816, -0.9875439417943593),
+    TW(-0.15885814333386128, -0.9873014181578584), TW(-0.16037245724292826, -0.987056571305751),
+    TW(-0.16188639378011177, -0.9868094018141855), TW(-0.16339994938297311, -0.9865599102647755),
+    TW(-0.16491312048996995, -0.9863080972445987), TW(-0.1664259035404641, -0.9860539633461954),
+    TW(-0.1679382949747311, -0.9857975091675675), TW(-0.16945029123396782, -0.9855387353121761),
+    TW(-0.17096188876030124, -0.9852776423889412), TW(-0.17247308399679592, -0.9850142310122398),
+    TW(-0.1739838733874637, -0.9847485018019042), TW(-0.17549425337727126, -0.9844804553832209),
+    TW(-0.17700422041214875, -0.984210092386929), TW(-0.17851377093899745, -0.9839374134492189),
+    TW(-0.1800229014056994, -0.9836624192117303), TW(-0.18153160826112502, -0.9833851103215512),
+    TW(-0.18303988795514092, -0.9831054874312163), TW(-0.18454773693861953, -0.9828235511987053),
+    TW(-0.1860551516634465, -0.9825393022874412), TW(-0.1875621285825296, -0.9822527413662894),
+    TW(-0.18906866414980616, -0.9819638691095552), TW(-0.19057475482025266, -0.9816726861969831),
+    TW(-0.19208039704989227, -0.9813791933137546), TW(-0.1935855872958036, -0.9810833911504867),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.1965945976700801, -0.9804848617734694),
+    TW(-0.19809841071795362, -0.9801821359681174), TW(-0.19960175762113094, -0.9798771036995176),
+    TW(-0.20110463484209182, -0.9795697656854405), TW(-0.20260703884442097, -0.9792601226490821),
+    TW(-0.2041089660928169, -0.9789481753190622), TW(-0.2056104130530992, -0.9786339244294232),
+    TW(-0.20711137619221845, -0.9783173707196277), TW(-0.20861185197826332, -0.9779985149345571),
+    TW(-0.2101118368804696, -0.9776773578245099), TW(-0.2116113273692275, -0.9773539001452001),
+    TW(-0.21311031991609125, -0.9770281426577544), TW(-0.2146088109937868, -0.9767000861287118),
+    TW(-0.2161067970762195, -0.9763697313300211), TW(-0.21760427463848356, -0.9760370790390391),
+    TW(-0.21910124015686966, -0.9757021300385286), TW(-0.22059769010887353, -0.975364885116657),
+    TW(-0.22209362097320348, -0.9750253450669941), TW(-0.22358902922978988, -0.9746835106885107),
+    TW(-0.22508391135979267, -0.9743393827855759), TW(-0.22657826384561, -0.9739929621679558),
+    TW(-0.22807208317088568, -0.973644249650812), TW(-0.22956536582051876, -0.9732932460546982),
+    TW(-0.23105810828067114, -0.9729399522055602), TW(-0.23255030703877522, -0.9725843689347322),
+    TW(-0.23404195858354332, -0.9722264970789364), TW(-0.23553305940497535, -0.9718663374802794),
+    TW(-0.23702360599436723, -0.9715038909862518), TW(-0.2385135948443184, -0.9711391584497251),
+    TW(-0.2400030224487414, -0.9707721407289504), TW(-0.24149188530286916, -0.9704028386875555),
+    TW(-0.24298017990326387, -0.970031253194544), TW(-0.2444679027478241, -0.9696573851242924),
+    TW(-0.24595505033579448, -0.9692812353565485), TW(-0.24744161916777332, -0.9689028047764289),
+    TW(-0.24892760574572012, -0.9685220942744174), TW(-0.25041300657296517, -0.9681391047463624),
+    TW(-0.2518978181542168, -0.9677538370934755), TW(-0.25338203699557016, -0.9673662922223285),
+    TW(-0.2548656596045145, -0.9669764710448521), TW(-0.2563486824899428, -0.9665843744783331),
+    TW(-0.2578311021621588, -0.9661900034454126), TW(-0.25931291513288623, -0.9657933588740837),
+    TW(-0.26079411791527546, -0.9653944416976894), TW(-0.2622747070239135, -0.9649932528549204),
+    TW(-0.2637546789748314, -0.9645897932898128), TW(-0.2652340302855118, -0.9641840639517458),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(-0.268190857063403, -0.963365799780954),
+    TW(-0.2696683255729151, -0.9629532668736839), TW(-0.27114515952680796, -0.9625384680443592),
+    TW(-0.27262135544994887, -0.9621214042690416), TW(-0.2740969098687062, -0.9617020765291225),
+    TW(-0.27557181931095814, -0.9612804858113206), TW(-0.27704608030609984, -0.9608566331076797),
+    TW(-0.27851968938505295, -0.9604305194155659), TW(-0.2799926430802733, -0.9600021457376658),
+    TW(-0.28146493792575794, -0.9595715130819845), TW(-0.2829365704570553, -0.959138622461842),
+    TW(-0.2844075372112717, -0.9587034748958716), TW(-0.2858778347270806, -0.9582660714080177),
+    TW(-0.28734745954472946, -0.9578264130275329), TW(-0.28881640820604937, -0.957384500788976),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.29175226323498926, -0.9564939189023951),
+    TW(-0.2932191626942586, -0.9560452513499965), TW(-0.2946853721805142, -0.9555943341307711),
+    TW(-0.29615088824362384, -0.9551411683057707), TW(-0.2976157074350862, -0.9546857549413383),
+    TW(-0.29907982630804036, -0.9542280951091057), TW(-0.3005432414172733, -0.9537681898859903),
+    TW(-0.3020059493192281, -0.9533060403541939), TW(-0.30346794657201126, -0.9528416476011987),
+    TW(-0.30492922973540226, -0.9523750127197659), TW(-0.306389795370861, -0.9519061368079323),
+    TW(-0.30784964004153487, -0.9514350209690083), TW(-0.3093087603122686, -0.9509616663115751),
+    TW(-0.31076715274961136, -0.9504860739494818), TW(-0.31222481392182494, -0.950008245001843),
+    TW(-0.3136817403988914, -0.9495281805930367), TW(-0.31513792875252233, -0.9490458818527007),
+    TW(-0.31659337555616573, -0.9485613499157304), TW(-0.31804807738501495, -0.9480745859222762),
+    TW(-0.31950203081601564, -0.9475855910177412), TW(-0.3209552324278751, -0.9470943663527772),
+    TW(-0.32240767880106985, -0.9466009130832835), TW(-0.32385936651785285, -0.9461052323704034),
+    TW(-0.32531029216226287, -0.9456073253805214), TW(-0.3267604523201316, -0.9451071932852606),
+    TW(-0.32820984357909255, -0.9446048372614803), TW(-0.32965846252858744, -0.9441002584912727),
+    TW(-0.3311063057598763, -0.9435934581619604), TW(-0.33255336986604406, -0.9430844374660935),
+    TW(-0.3339996514420094, -0.9425731976014469), TW(-0.33544514708453155, -0.9420597397710174),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(-0.3383337669655412, -0.9410261750508893),
+    TW(-0.33977688440682685, -0.9405060705932683), TW(-0.3412192023202823, -0.939983753034014),
+    TW(-0.34266071731199427, -0.9394592236021899), TW(-0.34410142598993887, -0.9389324835320645),
+    TW(-0.34554132496398904, -0.9384035340631082), TW(-0.34698041084592357, -0.9378723764399899),
+    TW(-0.3484186802494344, -0.937339011912575), TW(-0.3498561297901349, -0.9368034417359216),
+    TW(-0.35129275608556704, -0.9362656671702783), TW(-0.3527285557552106, -0.9357256894810804),
+    TW(-0.3541635254204904, -0.9351835099389476), TW(-0.35559766170478385, -0.9346391298196808),
+    TW(-0.3570309612334299, -0.934092550404259), TW(-0.35846342063373643, -0.9335437729788363),
+    TW(-0.35989503653498817, -0.9329927988347388), TW(-0.36132580556845423, -0.9324396292684624),
+    TW(-0.3627557243673971, -0.9318842655816681), TW(-0.3641847895670797, -0.9313267090811805),
+    TW(-0.36561299780477385, -0.9307669610789837), TW(-0.3670403457197671, -0.9302050228922191),
+    TW(-0.3684668299533722, -0.9296408958431813), TW(-0.36989244714893416, -0.9290745812593157),
+    TW(-0.3713171939518375, -0.9285060804732156), TW(-0.3727410670095157, -0.9279353948226179),
+    TW(-0.3741640629714579, -0.9273625256504011), TW(-0.3755861784892172, -0.9267874743045817),
+    TW(-0.3770074102164182, -0.9262102421383114), TW(-0.37842775480876545, -0.9256308305098728),
+    TW(-0.379847208924051, -0.9250492407826777), TW(-0.3812657692221624, -0.9244654743252626),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.38410019501693493, -0.9232914167195277),
+    TW(-0.3855160538439189, -0.9227011283338785), TW(-0.3869310055143886, -0.9221086687433452),
+    TW(-0.3883450466988262, -0.921514039342042), TW(-0.3897581740698563, -0.9209172415291895),
+    TW(-0.39117038430225387, -0.9203182767091106), TW(-0.3925816740729514, -0.9197171462912274),
+    TW(-0.393992040061048, -0.9191138516900578), TW(-0.3954014789478162, -0.9185083943252123),
+    TW(-0.3968099874167103, -0.9179007756213905), TW(-0.3982175621533735, -0.917290997008378),
+    TW(-0.3996241998456467, -0.9166790599210427), TW(-0.4010298971835757, -0.9160649657993317),
+    TW(-0.40243465085941843, -0.9154487160882678), TW(-0.403838457567654, -0.9148303122379462),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(-0.40664321687036903, -0.9135870479452508),
+    TW(-0.40804416286497863, -0.9129621904283982), TW(-0.4094441486922575, -0.9123351846233229),
+    TW(-0.4108431710579038, -0.9117060320054299), TW(-0.4122412266698829, -0.9110747340551764),
+    TW(-0.41363831223843445, -0.9104412922580672), TW(-0.4150344244760815, -0.9098057081046523),
+    TW(-0.416429560097637, -0.9091679830905225), TW(-0.41782371582021227, -0.9085281187163061),
+    TW(-0.41921688836322407, -0.9078861164876662), TW(-0.4206090744484024, -0.9072419779152959),
+    TW(-0.4220002707997997, -0.9065957045149153), TW(-0.42339047414379577, -0.9059472978072686),
+    TW(-0.4247796812091087, -0.9052967593181188), TW(-0.42616788872679967, -0.9046440905782461),
+    TW(-0.42755509343028186, -0.9039892931234434), TW(-0.42894129205532944, -0.9033323684945118),
+    TW(-0.4303264813400827, -0.9026733182372588), TW(-0.4317106580250571, -0.9020121439024933),
+    TW(-0.4330938188531519, -0.901348847046022), TW(-0.4344759605696558, -0.9006834292286469),
+    TW(-0.43585707992225536, -0.9000158920161603), TW(-0.4372371736610441, -0.8993462369793416),
+    TW(-0.4386162385385274, -0.8986744656939539), TW(-0.43999427130963314, -0.8980005797407399),
+    TW(-0.4413712687317167, -0.8973245807054183), TW(-0.4427472275645698, -0.8966464701786803),
+    TW(-0.44412214457042914, -0.8959662497561852), TW(-0.4454960165139818, -0.8952839210385575),
+    TW(-0.446868840162374, -0.8945994856313828), TW(-0.4482406122852199, -0.8939129451452033),
+    TW(-0.4496113296546067, -0.8932243011955152), TW(-0.4509809890451037, -0.8925335554027647),
+    TW(-0.4523495872337709, -0.8918407093923427), TW(-0.4537171210001636, -0.8911457647945834),
+    TW(-0.4550835871263437, -0.890448723244758), TW(-0.456448982396884, -0.8897495863830728),
+    TW(-0.457813303598877, -0.8890483558546647), TW(-0.45917654752194403, -0.8883450333095964),
+    TW(-0.46053871095824006, -0.8876396204028539), TW(-0.46189979070246256, -0.8869321187943423),
+    TW(-0.46325978355186015, -0.8862225301488806), TW(-0.4646186863062379, -0.8855108561361998),
+    TW(-0.465976495767966, -0.8847970984309379), TW(-0.4673332087419884, -0.884081258712635),
+    TW(-0.4686888220358277, -0.8833633386657317), TW(-0.4700433324595955, -0.8826433399795629),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.47274903195034257, -0.8811971134712222),
+    TW(-0.4741002146505499, -0.8804708890521609), TW(-0.475450281747156, -0.8797425928000474),
+    TW(-0.4767992300633219, -0.8790122264286335), TW(-0.478147056424843, -0.8782797916565416),
+    TW(-0.4794937576601531, -0.8775452902072612), TW(-0.4808393306003338, -0.8768087238091458),
+    TW(-0.4821837720791227, -0.8760700941954066), TW(-0.48352707893291846, -0.875329403104111),
+    TW(-0.484869248000791, -0.8745866522781762), TW(-0.4862102761244864, -0.8738418434653669),
+    TW(-0.4875501601484357, -0.8730949784182902), TW(-0.4888888969197631, -0.8723460588943915),
+    TW(-0.4902264832882912, -0.871595086655951), TW(-0.4915629161065498, -0.870842063470079),
+    TW(-0.492898192229784, -0.8700869911087115), TW(-0.49423230851595984, -0.8693298713486067),
+    TW(-0.4955652618257724, -0.868570705971341), TW(-0.4968970490226545, -0.8678094967633032),
+    TW(-0.4982276669727816, -0.8670462455156928), TW(-0.4995571125450818, -0.8662809540245131),
+    TW(-0.5008853826112408, -0.8655136240905691), TW(-0.5022124740457106, -0.8647442575194625),
+    TW(-0.5035383837257175, -0.8639728561215868), TW(-0.5048631085312676, -0.8631994217121242),
+    TW(-0.5061866453451551, -0.8624239561110406), TW(-0.5075089910529708, -0.8616464611430813),
+    TW(-0.5088301425431071, -0.8608669386377672), TW(-0.5101500967067666, -0.8600853904293903),
+    TW(-0.5114688504379704, -0.8593018183570084), TW(-0.5127864006335627, -0.858516224264443),
+    TW(-0.5141027441932217, -0.8577286100002721), TW(-0.515417878019463, -0.8569389774178288),
+    TW(-0.5167317990176497, -0.8561473283751946), TW(-0.5180445040959992, -0.855353664735196),
+    TW(-0.5193559901655896, -0.8545579883654005), TW(-0.5206662541403669, -0.8537603011381115),
+    TW(-0.5219752929371543, -0.8529606049303637), TW(-0.5232831034756565, -0.8521589016239197),
+    TW(-0.5245896826784687, -0.8513551931052652), TW(-0.5258950274710846, -0.8505494812656035),
+    TW(-0.5271991347819011, -0.8497417680008527), TW(-0.5285020015422284, -0.8489320552116397),
+    TW(-0.5298036246862947, -0.8481203448032972), TW(-0.5311040011512548, -0.8473066386858585),
+    TW(-0.5324031278771979, -0.8464909387740521), TW(-0.533701001807153, -0.8456732469872991),
+    TW(-0.534997619887097, -0.8448535652497072), TW(-0.5362929790659631, -0.8440318954900664),
+    TW(-0.5375870762956456, -0.8432082396418454), TW(-0.5388799085310083, -0.842382599643186),
+    TW(-0.5401714727298929, -0.8415549774368984), TW(-0.5414617658531232, -0.8407253749704582),
+    TW(-0.5427507848645158, -0.8398937941959996), TW(-0.5440385267308839, -0.8390602370703126),
+    TW(-0.5453249884220462, -0.8382247055548382), TW(-0.5466101669108349, -0.8373872016156619),
+    TW(-0.5478940591731002, -0.836547727223512), TW(-0.5491766621877195, -0.8357062843537527),
+    TW(-0.5504579729366047, -0.8348628749863801), TW(-0.5517379884047074, -0.834017501106018),
+    TW(-0.5530167055800274, -0.8331701647019133), TW(-0.5542941214536201, -0.8323208677679297),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.55684503727516, -0.8306164003088463),
+    TW(-0.5581185312205561, -0.829761233794523), TW(-0.5593907118591358, -0.8289041147718651),
+    TW(-0.5606615761973359, -0.8280450452577558), TW(-0.5619311212446895, -0.8271840272736691),
+    TW(-0.563199344013834, -0.8263210628456636), TW(-0.5644662415205194, -0.8254561540043776),
+    TW(-0.5657318107836132, -0.8245893027850252), TW(-0.5669960488251085, -0.8237205112273915),
+    TW(-0.5682589526701315, -0.8228497813758263), TW(-0.5695205193469473, -0.8219771152792414),
+    TW(-0.5707807458869671, -0.8211025149911048), TW(-0.572039629324757, -0.8202259825694347),
+    TW(-0.573297166698042, -0.8193475200767971), TW(-0.5745533550477158, -0.8184671295802988),
+    TW(-0.5758081914178453, -0.8175848131515837), TW(-0.5770616728556793, -0.816700572866828),
+    TW(-0.5783137964116555, -0.8158144108067338), TW(-0.5795645591394059, -0.8149263290565265),
+    TW(-0.5808139580957644, -0.8140363297059485), TW(-0.5820619903407755, -0.8131444148492536),
+    TW(-0.5833086529376984, -0.8122505865852039), TW(-0.5845539429530152, -0.8113548470170638),
+    TW(-0.5857978574564389, -0.8104571982525948), TW(-0.5870403935209177, -0.8095576424040515),
+    TW(-0.5882815482226452, -0.8086561815881751), TW(-0.5895213186410639, -0.8077528179261904),
+    TW(-0.590759701858874, -0.8068475535437994), TW(-0.5919966949620409, -0.8059403905711764),
+    TW(-0.5932322950397999, -0.8050313311429635), TW(-0.5944664991846643, -0.8041203773982658),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(-0.5969307080621966, -0.8022927955381156),
+    TW(-0.5981607069963422, -0.8013761717231404), TW(-0.5993892984005645, -0.8004576621926228),
+    TW(-0.6006164793838688, -0.7995372691079052), TW(-0.6018422470585799, -0.7986149946347609),
+    TW(-0.6030665985403483, -0.797690840943391), TW(-0.6042895309481559, -0.7967648102084189),
+    TW(-0.6055110414043254, -0.7958369046088836), TW(-0.6067311270345246, -0.7949071263282369),
+    TW(-0.6079497849677735, -0.7939754775543373), TW(-0.6091670123364532, -0.7930419604794436),
+    TW(-0.6103828062763096, -0.7921065773002123), TW(-0.6115971639264618, -0.7911693302176903),
+    TW(-0.6128100824294097, -0.79023022143731), TW(-0.6140215589310382, -0.7892892531688859),
+    TW(-0.6152315905806267, -0.7883464276266063), TW(-0.6164401745308536, -0.7874017470290313),
+    TW(-0.6176473079378038, -0.7864552135990859), TW(-0.6188529879609762, -0.785506829564054),
+    TW(-0.6200572117632892, -0.7845565971555751), TW(-0.6212599765110874, -0.7836045186096383),
+    TW(-0.62246127937415, -0.7826505961665757), TW(-0.6236611175256946, -0.7816948320710593),
+    TW(-0.6248594881423862, -0.7807372285720946), TW(-0.6260563884043435, -0.7797777879230144),
+    TW(-0.6272518154951439, -0.7788165123814761), TW(-0.6284457666018326, -0.7778534042094531),
+    TW(-0.6296382389149271, -0.7768884656732324), TW(-0.6308292296284244, -0.7759216990434078),
+    TW(-0.632018735939809, -0.7749531065948739), TW(-0.6332067550500573, -0.7739826906068228),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.6355783204885561, -0.7720363971503845),
+    TW(-0.6367618612362843, -0.7710605242618137), TW(-0.6379439036218439, -0.770082836993348),
+    TW(-0.6391244448637757, -0.7691033376455796), TW(-0.6403034821841515, -0.7681220285233655),
+    TW(-0.641481012808583, -0.7671389119358205), TW(-0.6426570339662269, -0.7661539901963129),
+    TW(-0.6438315428897913, -0.7651672656224591), TW(-0.6450045368155439, -0.7641787405361168),
+    TW(-0.6461760129833164, -0.7631884172633813), TW(-0.647345968636512, -0.762196298134579),
+    TW(-0.6485144010221124, -0.7612023854842619), TW(-0.6496813073906833, -0.7602066816512023),
+    TW(-0.6508466849963808, -0.7592091889783882), TW(-0.6520105310969595, -0.7582099098130153),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(-0.6543336178318004, -0.7562060014143945),
+    TW(-0.6554928529996155, -0.7552013768965365), TW(-0.6566505457294288, -0.7541949753168893),
+    TW(-0.6578066932970786, -0.7531867990436125), TW(-0.6589612929820374, -0.7521768504490427),
+    TW(-0.6601143420674204, -0.7511651319096866), TW(-0.6612658378399922, -0.7501516458062151),
+    TW(-0.6624157775901719, -0.7491363945234593), TW(-0.6635641586120397, -0.7481193804504037),
+    TW(-0.6647109782033449, -0.7471006059801801), TW(-0.6658562336655095, -0.746080073510064),
+    TW(-0.6669999223036374, -0.7450577854414661), TW(-0.6681420414265186, -0.7440337441799293),
+    TW(-0.6692825883466359, -0.7430079521351218), TW(-0.6704215603801731, -0.7419804117208311),
+    TW(-0.6715589548470184, -0.740951125354959), TW(-0.6726947690707727, -0.7399200954595163),
+    TW(-0.673829000378756, -0.7388873244606152), TW(-0.6749616461020121, -0.7378528147884659),
+    TW(-0.6760927035753158, -0.73681656887737), TW(-0.6772221701371804, -0.7357785891657135),
+    TW(-0.6783500431298612, -0.7347388780959636), TW(-0.679476319899365, -0.7336974381146604),
+    TW(-0.680600997795453, -0.7326542716724128), TW(-0.6817240741716496, -0.7316093812238927),
+    TW(-0.682845546385248, -0.7305627692278276), TW(-0.6839654117973155, -0.729514438146997),
+    TW(-0.6850836677727002, -0.7284643904482253), TW(-0.6862003116800386, -0.7274126286023758),
+    TW(-0.6873153408917592, -0.7263591550843459), TW(-0.6884287527840903, -0.7253039723730609),
+    TW(-0.6895405447370669, -0.7242470829514669), TW(-0.6906507141345344, -0.7231884893065276),
+    TW(-0.6917592583641576, -0.7221281939292155), TW(-0.6928661748174247, -0.7210661993145081),
+    TW(-0.6939714608896538, -0.7200025079613818), TW(-0.6950751139800008, -0.7189371223728045),
+    TW(-0.696177131491463, -0.7178700450557317), TW(-0.6972775108308864, -0.7168012785210996),
+    TW(-0.6983762494089728, -0.7157308252838187), TW(-0.6994733446402839, -0.714658687862769),
+    TW(-0.7005687939432482, -0.7135848687807937), TW(-0.7016625947401685, -0.7125093705646923),
+    TW(-0.7027547444572251, -0.7114321957452167), TW(-0.7038452405244848, -0.7103533468570624),
+    TW(-0.7049340803759049, -0.7092728264388656), TW(-0.7060212614493396, -0.7081906370331955),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.7081906370331954, -0.7060212614493397),
+    TW(-0.7092728264388655, -0.7049340803759051), TW(-0.7103533468570623, -0.703845240524485),
+    TW(-0.7114321957452165, -0.7027547444572252), TW(-0.7125093705646922, -0.7016625947401687),
+    TW(-0.7135848687807936, -0.7005687939432483), TW(-0.7146586878627689, -0.699473344640284),
+    TW(-0.7157308252838186, -0.6983762494089729), TW(-0.7168012785210995, -0.6972775108308865),
+    TW(-0.7178700450557316, -0.6961771314914631), TW(-0.7189371223728044, -0.695075113980001),
+    TW(-0.7200025079613817, -0.693971460889654), TW(-0.721066199314508, -0.6928661748174249),
+    TW(-0.7221281939292152, -0.6917592583641579), TW(-0.7231884893065275, -0.6906507141345346),
+    TW(-0.7242470829514668, -0.689540544737067), TW(-0.7253039723730608, -0.6884287527840904),
+    TW(-0.7263591550843458, -0.6873153408917593), TW(-0.7274126286023757, -0.6862003116800387),
+    TW(-0.7284643904482252, -0.6850836677727004), TW(-0.7295144381469968, -0.6839654117973156),
+    TW(-0.7305627692278275, -0.6828455463852482), TW(-0.7316093812238926, -0.6817240741716497),
+    TW(-0.7326542716724127, -0.6806009977954532), TW(-0.7336974381146603, -0.6794763198993651),
+    TW(-0.7347388780959635, -0.6783500431298614), TW(-0.7357785891657134, -0.6772221701371806),
+    TW(-0.7368165688773699, -0.6760927035753159), TW(-0.7378528147884658, -0.6749616461020123),
+    TW(-0.738887324460615, -0.6738290003787561), TW(-0.7399200954595162, -0.6726947690707729),
+    TW(-0.7409511253549589, -0.6715589548470186), TW(-0.741980411720831, -0.6704215603801732),
+    TW(-0.7430079521351217, -0.669282588346636), TW(-0.7440337441799291, -0.6681420414265187),
+    TW(-0.745057785441466, -0.6669999223036376), TW(-0.7460800735100639, -0.6658562336655096),
+    TW(-0.74710060598018, -0.664710978203345), TW(-0.7481193804504036, -0.6635641586120398),
+    TW(-0.7491363945234591, -0.662415777590172), TW(-0.750151645806215, -0.6612658378399924),
+    TW(-0.7511651319096865, -0.6601143420674205), TW(-0.7521768504490425, -0.6589612929820375),
+    TW(-0.7531867990436124, -0.6578066932970787), TW(-0.7541949753168892, -0.656650545729429),
+    TW(-0.7552013768965364, -0.6554928529996156), TW(-0.7562060014143944, -0.6543336178318006),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(-0.7582099098130152, -0.6520105310969597),
+    TW(-0.7592091889783881, -0.650846684996381), TW(-0.7602066816512022, -0.6496813073906834),
+    TW(-0.7612023854842617, -0.6485144010221126), TW(-0.7621962981345789, -0.6473459686365121),
+    TW(-0.763188417263381, -0.6461760129833166), TW(-0.7641787405361167, -0.645004536815544),
+    TW(-0.765167265622459, -0.6438315428897914), TW(-0.7661539901963127, -0.6426570339662271),
+    TW(-0.7671389119358203, -0.6414810128085832), TW(-0.7681220285233654, -0.6403034821841516),
+    TW(-0.7691033376455795, -0.6391244448637758), TW(-0.7700828369933479, -0.637943903621844),
+    TW(-0.7710605242618136, -0.6367618612362844), TW(-0.7720363971503844, -0.6355783204885562),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.7739826906068227, -0.6332067550500574),
+    TW(-0.7749531065948738, -0.6320187359398091), TW(-0.7759216990434077, -0.6308292296284245),
+    TW(-0.7768884656732323, -0.6296382389149272), TW(-0.777853404209453, -0.6284457666018327),
+    TW(-0.778816512381476, -0.6272518154951441), TW(-0.7797777879230143, -0.6260563884043436),
+    TW(-0.7807372285720945, -0.6248594881423863), TW(-0.7816948320710592, -0.6236611175256949),
+    TW(-0.7826505961665756, -0.6224612793741501), TW(-0.7836045186096382, -0.6212599765110876),
+    TW(-0.784556597155575, -0.6200572117632894), TW(-0.7855068295640539, -0.6188529879609764),
+    TW(-0.7864552135990858, -0.6176473079378039), TW(-0.7874017470290312, -0.6164401745308538),
+    TW(-0.7883464276266062, -0.6152315905806269), TW(-0.7892892531688858, -0.6140215589310384),
+    TW(-0.7902302214373099, -0.6128100824294098), TW(-0.7911693302176902, -0.6115971639264619),
+    TW(-0.7921065773002122, -0.6103828062763097), TW(-0.7930419604794435, -0.6091670123364533),
+    TW(-0.7939754775543372, -0.6079497849677736), TW(-0.7949071263282368, -0.6067311270345247),
+    TW(-0.7958369046088835, -0.6055110414043257), TW(-0.7967648102084188, -0.604289530948156),
+    TW(-0.7976908409433909, -0.6030665985403484), TW(-0.7986149946347608, -0.6018422470585801),
+    TW(-0.7995372691079051, -0.6006164793838689), TW(-0.8004576621926227, -0.5993892984005647),
+    TW(-0.8013761717231402, -0.5981607069963424), TW(-0.8022927955381155, -0.5969307080621967),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(-0.8041203773982657, -0.5944664991846644),
+    TW(-0.8050313311429634, -0.5932322950398), TW(-0.8059403905711763, -0.591996694962041),
+    TW(-0.8068475535437993, -0.5907597018588742), TW(-0.8077528179261902, -0.589521318641064),
+    TW(-0.808656181588175, -0.5882815482226453), TW(-0.8095576424040514, -0.587040393520918),
+    TW(-0.8104571982525947, -0.585797857456439), TW(-0.8113548470170637, -0.5845539429530153),
+    TW(-0.8122505865852038, -0.5833086529376985), TW(-0.8131444148492535, -0.5820619903407757),
+    TW(-0.8140363297059484, -0.5808139580957645), TW(-0.8149263290565264, -0.579564559139406),
+    TW(-0.8158144108067337, -0.5783137964116557), TW(-0.8167005728668278, -0.5770616728556794),
+    TW(-0.8175848131515836, -0.5758081914178454), TW(-0.8184671295802987, -0.5745533550477159),
+    TW(-0.819347520076797, -0.5732971666980421), TW(-0.8202259825694346, -0.5720396293247573),
+    TW(-0.8211025149911046, -0.5707807458869673), TW(-0.8219771152792413, -0.5695205193469475),
+    TW(-0.8228497813758262, -0.5682589526701317), TW(-0.8237205112273914, -0.5669960488251087),
+    TW(-0.8245893027850251, -0.5657318107836135), TW(-0.8254561540043774, -0.5644662415205195),
+    TW(-0.8263210628456635, -0.5631993440138341), TW(-0.827184027273669, -0.5619311212446896),
+    TW(-0.8280450452577557, -0.5606615761973361), TW(-0.828904114771865, -0.559390711859136),
+    TW(-0.8297612337945229, -0.5581185312205563), TW(-0.8306164003088463, -0.5568450372751601),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.8323208677679296, -0.5542941214536202),
+    TW(-0.8331701647019132, -0.5530167055800276), TW(-0.834017501106018, -0.5517379884047077),
+    TW(-0.83486287498638, -0.5504579729366049), TW(-0.8357062843537526, -0.5491766621877197),
+    TW(-0.8365477272235119, -0.5478940591731004), TW(-0.8373872016156618, -0.546610166910835),
+    TW(-0.8382247055548381, -0.5453249884220464), TW(-0.8390602370703126, -0.544038526730884),
+    TW(-0.8398937941959995, -0.5427507848645159), TW(-0.8407253749704581, -0.5414617658531233),
+    TW(-0.8415549774368983, -0.540171472729893), TW(-0.8423825996431858, -0.5388799085310084),
+    TW(-0.8432082396418453, -0.5375870762956457), TW(-0.8440318954900664, -0.5362929790659633),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(-0.845673246987299, -0.5337010018071532),
+    TW(-0.846490938774052, -0.532403127877198), TW(-0.8473066386858584, -0.5311040011512549),
+    TW(-0.8481203448032971, -0.5298036246862948), TW(-0.8489320552116396, -0.5285020015422285),
+    TW(-0.8497417680008525, -0.5271991347819013), TW(-0.8505494812656034, -0.5258950274710849),
+    TW(-0.8513551931052652, -0.524589682678469), TW(-0.8521589016239196, -0.5232831034756567),
+    TW(-0.8529606049303636, -0.5219752929371545), TW(-0.8537603011381114, -0.5206662541403672),
+    TW(-0.8545579883654004, -0.5193559901655898), TW(-0.8553536647351959, -0.5180445040959994),
+    TW(-0.8561473283751945, -0.5167317990176498), TW(-0.8569389774178287, -0.5154178780194631),
+    TW(-0.857728610000272, -0.5141027441932218), TW(-0.8585162242644429, -0.512786400633563),
+    TW(-0.8593018183570084, -0.5114688504379705), TW(-0.8600853904293901, -0.5101500967067668),
+    TW(-0.8608669386377671, -0.5088301425431073), TW(-0.8616464611430813, -0.507508991052971),
+    TW(-0.8624239561110405, -0.5061866453451552), TW(-0.863199421712124, -0.5048631085312677),
+    TW(-0.8639728561215867, -0.5035383837257177), TW(-0.8647442575194624, -0.5022124740457107),
+    TW(-0.865513624090569, -0.5008853826112409), TW(-0.866280954024513, -0.49955711254508195),
+    TW(-0.8670462455156928, -0.49822766697278176), TW(-0.8678094967633032, -0.4968970490226547),
+    TW(-0.8685707059713409, -0.49556526182577254), TW(-0.8693298713486066, -0.49423230851596),
+    TW(-0.8700869911087113, -0.49289819222978415), TW(-0.870842063470079, -0.4915629161065499),
+    TW(-0.8715950866559509, -0.4902264832882914), TW(-0.8723460588943914, -0.4888888969197633),
+    TW(-0.8730949784182901, -0.4875501601484359), TW(-0.8738418434653668, -0.4862102761244866),
+    TW(-0.8745866522781761, -0.4848692480007911), TW(-0.8753294031041109, -0.48352707893291863),
+    TW(-0.8760700941954065, -0.4821837720791229), TW(-0.8768087238091457, -0.48083933060033396),
+    TW(-0.8775452902072611, -0.4794937576601533), TW(-0.8782797916565415, -0.4781470564248432),
+    TW(-0.8790122264286335, -0.4767992300633221), TW(-0.8797425928000473, -0.4754502817471561),
+    TW(-0.8804708890521608, -0.4741002146505501), TW(-0.8811971134712221, -0.47274903195034274),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.8826433399795628, -0.4700433324595957),
+    TW(-0.8833633386657317, -0.46868882203582785), TW(-0.8840812587126349, -0.4673332087419886),
+    TW(-0.8847970984309378, -0.4659764957679662), TW(-0.8855108561361998, -0.4646186863062381),
+    TW(-0.8862225301488805, -0.4632597835518603), TW(-0.8869321187943422, -0.46189979070246273),
+    TW(-0.8876396204028538, -0.4605387109582402), TW(-0.8883450333095962, -0.4591765475219442),
+    TW(-0.8890483558546646, -0.4578133035988772), TW(-0.8897495863830727, -0.45644898239688414),
+    TW(-0.8904487232447579, -0.4550835871263439), TW(-0.8911457647945833, -0.45371712100016376),
+    TW(-0.8918407093923426, -0.45234958723377106), TW(-0.8925335554027646, -0.45098098904510386),
+    TW(-0.8932243011955152, -0.4496113296546069), TW(-0.8939129451452031, -0.44824061228522005),
+    TW(-0.8945994856313827, -0.44686884016237416), TW(-0.8952839210385574, -0.44549601651398196),
+    TW(-0.8959662497561851, -0.4441221445704293), TW(-0.8966464701786803, -0.44274722756456997),
+    TW(-0.8973245807054182, -0.4413712687317169), TW(-0.8980005797407398, -0.4399942713096333),
+    TW(-0.8986744656939539, -0.43861623853852755), TW(-0.8993462369793415, -0.43723717366104425),
+    TW(-0.9000158920161602, -0.43585707992225553), TW(-0.9006834292286467, -0.434475960569656),
+    TW(-0.9013488470460219, -0.43309381885315207), TW(-0.9020121439024932, -0.43171065802505726),
+    TW(-0.9026733182372587, -0.4303264813400829), TW(-0.9033323684945118, -0.4289412920553296),
+    TW(-0.9039892931234433, -0.42755509343028203), TW(-0.9046440905782461, -0.42616788872679984),
+    TW(-0.9052967593181187, -0.42477968120910886), TW(-0.9059472978072685, -0.42339047414379594),
+    TW(-0.9065957045149153, -0.42200027079979985), TW(-0.9072419779152958, -0.42060907444840256),
+    TW(-0.907886116487666, -0.41921688836322424), TW(-0.9085281187163061, -0.41782371582021244),
+    TW(-0.9091679830905224, -0.41642956009763715), TW(-0.9098057081046521, -0.41503442447608185),
+    TW(-0.9104412922580671, -0.4136383122384346), TW(-0.9110747340551764, -0.41224122666988283),
+    TW(-0.9117060320054298, -0.41084317105790413), TW(-0.9123351846233227, -0.40944414869225765),
+    TW(-0.9129621904283982, -0.4080441628649786), TW(-0.9135870479452508, -0.4066432168703692),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(-0.914830312237946, -0.4038384575676544),
+    TW(-0.9154487160882677, -0.4024346508594186), TW(-0.9160649657993317, -0.4010298971835756),
+    TW(-0.9166790599210426, -0.39962419984564707), TW(-0.9172909970083779, -0.39821756215337367),
+    TW(-0.9179007756213905, -0.39680998741671025), TW(-0.9185083943252121, -0.3954014789478165),
+    TW(-0.9191138516900578, -0.39399204006104815), TW(-0.9197171462912274, -0.3925816740729514),
+    TW(-0.9203182767091105, -0.39117038430225404), TW(-0.9209172415291894, -0.38975817406985647),
+    TW(-0.9215140393420418, -0.3883450466988266), TW(-0.9221086687433451, -0.38693100551438875),
+    TW(-0.9227011283338786, -0.38551605384391885), TW(-0.9232914167195275, -0.3841001950169353),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.9244654743252626, -0.3812657692221623),
+    TW(-0.9250492407826775, -0.3798472089240514), TW(-0.9256308305098727, -0.37842775480876567),
+    TW(-0.9262102421383114, -0.37700741021641815), TW(-0.9267874743045817, -0.3755861784892174),
+    TW(-0.9273625256504011, -0.37416406297145804), TW(-0.9279353948226178, -0.3727410670095161),
+    TW(-0.9285060804732155, -0.3713171939518377), TW(-0.9290745812593157, -0.3698924471489341),
+    TW(-0.9296408958431812, -0.3684668299533726), TW(-0.9302050228922191, -0.3670403457197673),
+    TW(-0.9307669610789837, -0.3656129978047738), TW(-0.9313267090811803, -0.3641847895670801),
+    TW(-0.931884265581668, -0.3627557243673973), TW(-0.9324396292684625, -0.3613258055684542),
+    TW(-0.9329927988347388, -0.35989503653498833), TW(-0.9335437729788362, -0.3584634206337366),
+    TW(-0.9340925504042588, -0.3570309612334303), TW(-0.9346391298196807, -0.355597661704784),
+    TW(-0.9351835099389476, -0.3541635254204904), TW(-0.9357256894810803, -0.35272855575521095),
+    TW(-0.9362656671702783, -0.3512927560855672), TW(-0.9368034417359217, -0.34985612979013486),
+    TW(-0.9373390119125748, -0.3484186802494348), TW(-0.9378723764399898, -0.34698041084592374),
+    TW(-0.9384035340631082, -0.345541324963989), TW(-0.9389324835320645, -0.34410142598993904),
+    TW(-0.9394592236021899, -0.34266071731199443), TW(-0.9399837530340138, -0.3412192023202827),
+    TW(-0.9405060705932683, -0.339776884406827), TW(-0.9410261750508893, -0.3383337669655412),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(-0.9420597397710173, -0.3354451470845317),
+    TW(-0.9425731976014469, -0.3339996514420094), TW(-0.9430844374660934, -0.33255336986604445),
+    TW(-0.9435934581619604, -0.3311063057598765), TW(-0.9441002584912727, -0.32965846252858744),
+    TW(-0.9446048372614801, -0.3282098435790927), TW(-0.9451071932852606, -0.32676045232013184),
+    TW(-0.9456073253805212, -0.32531029216226326), TW(-0.9461052323704033, -0.323859366517853),
+    TW(-0.9466009130832835, -0.32240767880106985), TW(-0.9470943663527771, -0.3209552324278755),
+    TW(-0.9475855910177411, -0.3195020308160158), TW(-0.9480745859222762, -0.3180480773850149),
+    TW(-0.9485613499157303, -0.31659337555616607), TW(-0.9490458818527006, -0.3151379287525225),
+    TW(-0.9495281805930367, -0.3136817403988914), TW(-0.950008245001843, -0.3122248139218251),
+    TW(-0.9504860739494817, -0.31076715274961153), TW(-0.950961666311575, -0.309308760312269),
+    TW(-0.9514350209690083, -0.30784964004153503), TW(-0.9519061368079323, -0.3063897953708609),
+    TW(-0.9523750127197658, -0.30492922973540265), TW(-0.9528416476011986, -0.3034679465720114),
+    TW(-0.9533060403541939, -0.30200594931922803), TW(-0.9537681898859902, -0.3005432414172737),
+    TW(-0.9542280951091056, -0.29907982630804053), TW(-0.9546857549413383, -0.29761570743508614),
+    TW(-0.9551411683057707, -0.296150888243624), TW(-0.9555943341307711, -0.2946853721805144),
+    TW(-0.9560452513499963, -0.29321916269425896), TW(-0.956493918902395, -0.29175226323498943),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.9573845007889759, -0.28881640820604976),
+    TW(-0.9578264130275329, -0.2873474595447296), TW(-0.9582660714080177, -0.28587783472708056),
+    TW(-0.9587034748958715, -0.2844075372112721), TW(-0.9591386224618419, -0.28293657045705545),
+    TW(-0.9595715130819845, -0.2814649379257579), TW(-0.9600021457376658, -0.27999264308027344),
+    TW(-0.9604305194155658, -0.27851968938505317), TW(-0.9608566331076795, -0.27704608030610023),
+    TW(-0.9612804858113206, -0.2755718193109583), TW(-0.9617020765291225, -0.2740969098687064),
+    TW(-0.9621214042690415, -0.27262135544994925), TW(-0.9625384680443592, -0.2711451595268081),
+    TW(-0.9629532668736839, -0.2696683255729151), TW(-0.9633657997809539, -0.2681908570634034),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(-0.9641840639517458, -0.26523403028551173),
+    TW(-0.9645897932898126, -0.26375467897483157), TW(-0.9649932528549203, -0.2622747070239137),
+    TW(-0.9653944416976893, -0.26079411791527585), TW(-0.9657933588740836, -0.2593129151328864),
+    TW(-0.9661900034454125, -0.257831102162159), TW(-0.966584374478333, -0.2563486824899432),
+    TW(-0.9669764710448521, -0.2548656596045147), TW(-0.9673662922223285, -0.2533820369955701),
+    TW(-0.9677538370934754, -0.2518978181542172), TW(-0.9681391047463623, -0.25041300657296534),
+    TW(-0.9685220942744174, -0.2489276057457201), TW(-0.9689028047764289, -0.2474416191677735),
+    TW(-0.9692812353565484, -0.24595505033579465), TW(-0.9696573851242923, -0.24446790274782448),
+    TW(-0.970031253194544, -0.24298017990326407), TW(-0.9704028386875555, -0.24149188530286936),
+    TW(-0.9707721407289502, -0.24000302244874178), TW(-0.9711391584497251, -0.23851359484431855),
+    TW(-0.9715038909862518, -0.23702360599436717), TW(-0.9718663374802793, -0.23553305940497574),
+    TW(-0.9722264970789363, -0.2340419585835435), TW(-0.9725843689347322, -0.23255030703877516),
+    TW(-0.9729399522055601, -0.23105810828067133), TW(-0.9732932460546982, -0.22956536582051892),
+    TW(-0.9736442496508119, -0.22807208317088606), TW(-0.9739929621679558, -0.22657826384561017),
+    TW(-0.9743393827855759, -0.22508391135979283), TW(-0.9746835106885107, -0.2235890292297903),
+    TW(-0.9750253450669941, -0.22209362097320365), TW(-0.975364885116657, -0.2205976901088735),
+    TW(-0.9757021300385285, -0.21910124015687005), TW(-0.976037079039039, -0.21760427463848372),
+    TW(-0.9763697313300211, -0.21610679707621944), TW(-0.9767000861287117, -0.21460881099378698),
+    TW(-0.9770281426577544, -0.21311031991609142), TW(-0.9773539001452, -0.2116113273692279),
+    TW(-0.9776773578245099, -0.2101118368804698), TW(-0.9779985149345571, -0.2086118519782635),
+    TW(-0.9783173707196275, -0.20711137619221884), TW(-0.9786339244294231, -0.20561041305309938),
+    TW(-0.9789481753190622, -0.20410896609281684), TW(-0.979260122649082, -0.20260703884442138),
+    TW(-0.9795697656854405, -0.201104634842092), TW(-0.9798771036995176, -0.19960175762113092),
+    TW(-0.9801821359681173, -0.1980984107179538), TW(-0.9804848617734694, -0.19659459767008028),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.9810833911504866, -0.1935855872958038),
+    TW(-0.9813791933137546, -0.19208039704989247), TW(-0.9816726861969831, -0.19057475482025307),
+    TW(-0.9819638691095552, -0.18906866414980636), TW(-0.9822527413662894, -0.18756212858252957),
+    TW(-0.9825393022874412, -0.1860551516634469), TW(-0.9828235511987052, -0.1845477369386197),
+    TW(-0.9831054874312163, -0.1830398879551409), TW(-0.9833851103215512, -0.18153160826112522),
+    TW(-0.9836624192117303, -0.18002290140569957), TW(-0.9839374134492189, -0.17851377093899742),
+    TW(-0.984210092386929, -0.17700422041214894), TW(-0.9844804553832209, -0.17549425337727145),
+    TW(-0.9847485018019042, -0.17398387338746413), TW(-0.9850142310122398, -0.17247308399679612),
+    TW(-0.9852776423889412, -0.17096188876030122), TW(-0.9855387353121761, -0.1694502912339682),
+    TW(-0.9857975091675674, -0.16793829497473128), TW(-0.9860539633461954, -0.16642590354046405),
+    TW(-0.9863080972445986, -0.16491312048997014), TW(-0.9865599102647754, -0.16339994938297328),
+    TW(-0.9868094018141855, -0.16188639378011174), TW(-0.987056571305751, -0.16037245724292845),
+    TW(-0.9873014181578584, -0.15885814333386147), TW(-0.9875439417943592, -0.15734345561623855),
+    TW(-0.9877841416445722, -0.15582839765426537), TW(-0.9880220171432835, -0.15431297301302008),
+    TW(-0.9882575677307495, -0.15279718525844369), TW(-0.9884907928526966, -0.1512810379573303),
+    TW(-0.9887216919603238, -0.14976453467732145), TW(-0.988950264510303, -0.14824767898689625),
+    TW(-0.989176509964781, -0.1467304744553618), TW(-0.9894004277913804, -0.14521292465284735),
+    TW(-0.9896220174632008, -0.14369503315029464), TW(-0.9898412784588205, -0.1421768035194481),
+    TW(-0.990058210262297, -0.14065823933284954), TW(-0.9902728123631691, -0.13913934416382634),
+    TW(-0.9904850842564571, -0.13762012158648604), TW(-0.9906950254426646, -0.13610057517570648),
+    TW(-0.99090263542778, -0.13458070850712628), TW(-0.9911079137232769, -0.133060525157139),
+    TW(-0.9913108598461154, -0.13154002870288334), TW(-0.9915114733187439, -0.13001922272223343),
+    TW(-0.9917097536690995, -0.12849811079379309), TW(-0.9919057004306093, -0.12697669649688606),
+    TW(-0.9920993131421918, -0.12545498341154626), TW(-0.9922905913482573, -0.12393297511851248),
+    TW(-0.99247953459871, -0.12241067519921635), TW(-0.992666142448948, -0.12088808723577706),
+    TW(-0.9928504144598651, -0.11936521481099163), TW(-0.9930323501978514, -0.11784206150832509),
+    TW(-0.9932119492347945, -0.11631863091190471), TW(-0.9933892111480807, -0.1147949266065103),
+    TW(-0.9935641355205953, -0.11327095217756442), TW(-0.9937367219407246, -0.1117467112111265),
+    TW(-0.9939069700023561, -0.11022220729388324), TW(-0.9940748793048794, -0.10869744401313874),
+    TW(-0.9942404494531879, -0.10717242495680916), TW(-0.9944036800576791, -0.10564715371341075),
+    TW(-0.9945645707342554, -0.10412163387205457), TW(-0.9947231211043257, -0.10259586902243656),
+    TW(-0.9948793307948056, -0.10106986275482793), TW(-0.9950331994381186, -0.09954361866006928),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.9953339121404823, -0.09649043135525266),
+    TW(-0.9954807554919269, -0.09496349532963891), TW(-0.9956252563809943, -0.09343633584574797),
+    TW(-0.9957674144676598, -0.09190895649713275), TW(-0.9959072294174117, -0.09038136087786529),
+    TW(-0.996044700901252, -0.08885355258252475), TW(-0.996179828595697, -0.08732553520619206),
+    TW(-0.996312612182778, -0.08579731234444016), TW(-0.9964430513500426, -0.08426888759332418),
+    TW(-0.9965711457905548, -0.08274026454937564), TW(-0.9966968952028961, -0.08121144680959266),
+    TW(-0.9968202992911657, -0.0796824379714302), TW(-0.9969413577649822, -0.07815324163279415),
+    TW(-0.997060070339483, -0.07662386139203169), TW(-0.9971764367353261, -0.07509430084792135),
+    TW(-0.9972904566786902, -0.07356456359966773), TW(-0.9974021299012753, -0.07203465324688947),
+    TW(-0.9975114561403035, -0.07050457338961386), TW(-0.9976184351385196, -0.06897432762826702),
+    TW(-0.9977230666441916, -0.06744391956366418), TW(-0.9978253504111116, -0.06591335279700376),
+    TW(-0.997925286198596, -0.0643826309298577), TW(-0.9980228737714862, -0.06285175756416149),
+    TW(-0.9981181129001492, -0.06132073630220849), TW(-0.9982110033604782, -0.05978957074664007),
+    TW(-0.9983015449338929, -0.058258264500435794), TW(-0.9983897374073402, -0.05672682116690807),
+    TW(-0.9984755805732948, -0.055195244349690094), TW(-0.9985590742297593, -0.05366353765273052),
+    TW(-0.9986402181802652, -0.052131704680283594), TW(-0.9987190122338729, -0.05059974903689939),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(-0.9988695499142836, -0.04753548415695954),
+    TW(-0.9989412931868569, -0.046003182130914706), TW(-0.9990106858540734, -0.044470771854938584),
+    TW(-0.9990777277526454, -0.04293825693494102), TW(-0.9991424187248169, -0.041405640977076774),
+    TW(-0.9992047586183639, -0.03987292758774013), TW(-0.9992647472865944, -0.038340120373552854),
+    TW(-0.9993223845883495, -0.03680722294135883), TW(-0.9993776703880028, -0.03527423889821423),
+    TW(-0.9994306045554617, -0.033741171851377705), TW(-0.999481186966167, -0.032208025408304544),
+    TW(-0.9995294175010931, -0.030674803176636865), TW(-0.9995752960467492, -0.029141508764193802),
+    TW(-0.9996188224951786, -0.02760814577896566), TW(-0.9996599967439592, -0.0260747178291041),
+    TW(-0.9996988186962042, -0.024541228522912326), TW(-0.9997352882605617, -0.023007681468839695),
+    TW(-0.9997694053512153, -0.021474080275469667), TW(-0.9998011698878843, -0.019940428551514438),
+    TW(-0.9998305817958234, -0.0184067299058051), TW(-0.9998576410058239, -0.016872987947281835),
+    TW(-0.9998823474542126, -0.01533920628498806), TW(-0.9999047010828528, -0.013805388528060632),
+    TW(-0.9999247018391445, -0.012271538285720007), TW(-0.9999423496760239, -0.01073765916726441),
+    TW(-0.9999576445519639, -0.00920375478206002), TW(-0.9999705864309741, -0.007669828739531138),
+    TW(-0.9999811752826011, -0.006135884649154799), TW(-0.9999894110819284, -0.004601926120448733),
+    TW(-0.9999952938095762, -0.003067956762965977), TW(-0.9999988234517019, -0.0015339801862850493),
+    TW(-1.0, -1.2246467991473532e-16), TW(-0.9999988234517019, 0.0015339801862848043),
+    TW(-0.9999952938095762, 0.0030679567629657324), TW(-0.9999894110819284, 0.004601926120448488),
+    TW(-0.9999811752826011, 0.006135884649154554), TW(-0.9999705864309741, 0.007669828739530893),
+    TW(-0.9999576445519639, 0.009203754782059776), TW(-0.9999423496760239, 0.010737659167264166),
+    TW(-0.9999247018391445, 0.012271538285719762), TW(-0.9999047010828529, 0.013805388528060387),
+    TW(-0.9998823474542126, 0.015339206284987816), TW(-0.9998576410058239, 0.01687298794728159),
+    TW(-0.9998305817958234, 0.01840672990580486), TW(-0.9998011698878843, 0.01994042855151419),
+    TW(-0.9997694053512153, 0.02147408027546942), TW(-0.9997352882605617, 0.02300768146883945),
+    TW(-0.9996988186962042, 0.02454122852291208), TW(-0.9996599967439592, 0.026074717829103856),
+    TW(-0.9996188224951786, 0.027608145778965414), TW(-0.9995752960467492, 0.029141508764193556),
+    TW(-0.9995294175010931, 0.03067480317663662), TW(-0.999481186966167, 0.032208025408304294),
+    TW(-0.9994306045554617, 0.033741171851377455), TW(-0.9993776703880028, 0.03527423889821398),
+    TW(-0.9993223845883495, 0.03680722294135858), TW(-0.9992647472865944, 0.03834012037355261),
+    TW(-0.9992047586183639, 0.03987292758773989), TW(-0.9991424187248169, 0.04140564097707653),
+    TW(-0.9990777277526454, 0.04293825693494078), TW(-0.9990106858540734, 0.044470771854938335),
+    TW(-0.9989412931868569, 0.046003182130914456), TW(-0.9988695499142836, 0.047535484156959296),
+    TW(-0.9987954562051724, 0.049067674327417724), TW(-0.9987190122338729, 0.05059974903689915),
+    TW(-0.9986402181802653, 0.05213170468028335), TW(-0.9985590742297593, 0.05366353765273028),
+    TW(-0.9984755805732948, 0.05519524434968985), TW(-0.9983897374073402, 0.05672682116690782),
+    TW(-0.9983015449338929, 0.05825826450043555), TW(-0.9982110033604782, 0.05978957074663983),
+    TW(-0.9981181129001492, 0.061320736302208245), TW(-0.9980228737714862, 0.06285175756416124),
+    TW(-0.997925286198596, 0.06438263092985745), TW(-0.9978253504111116, 0.06591335279700353),
+    TW(-0.9977230666441916, 0.06744391956366393), TW(-0.9976184351385196, 0.06897432762826677),
+    TW(-0.9975114561403035, 0.0705045733896136), TW(-0.9974021299012753, 0.07203465324688924),
+    TW(-0.9972904566786902, 0.0735645635996675), TW(-0.9971764367353262, 0.0750943008479211),
+    TW(-0.997060070339483, 0.07662386139203144), TW(-0.9969413577649822, 0.0781532416327939),
+    TW(-0.9968202992911658, 0.07968243797142995), TW(-0.9966968952028961, 0.08121144680959243),
+    TW(-0.9965711457905548, 0.0827402645493754), TW(-0.9964430513500426, 0.08426888759332393),
+    TW(-0.996312612182778, 0.08579731234443992), TW(-0.996179828595697, 0.08732553520619181),
+    TW(-0.996044700901252, 0.0888535525825245), TW(-0.9959072294174117, 0.09038136087786505),
+    TW(-0.9957674144676598, 0.09190895649713252), TW(-0.9956252563809943, 0.09343633584574773),
+    TW(-0.9954807554919269, 0.09496349532963866), TW(-0.9953339121404823, 0.09649043135525241),
+    TW(-0.9951847266721969, 0.09801714032956059), TW(-0.9950331994381186, 0.09954361866006904),
+    TW(-0.9948793307948056, 0.10106986275482768), TW(-0.9947231211043257, 0.10259586902243631),
+    TW(-0.9945645707342555, 0.10412163387205432), TW(-0.9944036800576791, 0.10564715371341052),
+    TW(-0.9942404494531879, 0.10717242495680891), TW(-0.9940748793048795, 0.1086974440131385),
+    TW(-0.9939069700023561, 0.110222207293883), TW(-0.9937367219407247, 0.11174671121112625),
+    TW(-0.9935641355205953, 0.11327095217756417), TW(-0.9933892111480807, 0.11479492660651007),
+    TW(-0.9932119492347946, 0.11631863091190447), TW(-0.9930323501978514, 0.11784206150832484),
+    TW(-0.9928504144598651, 0.11936521481099138), TW(-0.992666142448948, 0.12088808723577682),
+    TW(-0.99247953459871, 0.1224106751992161), TW(-0.9922905913482574, 0.12393297511851223),
+    TW(-0.9920993131421918, 0.125454983411546), TW(-0.9919057004306093, 0.1269766964968858),
+    TW(-0.9917097536690995, 0.12849811079379284), TW(-0.991511473318744, 0.13001922272223318),
+    TW(-0.9913108598461154, 0.1315400287028831), TW(-0.9911079137232769, 0.13306052515713876),
+    TW(-0.99090263542778, 0.13458070850712606), TW(-0.9906950254426646, 0.13610057517570623),
+    TW(-0.9904850842564571, 0.1376201215864858), TW(-0.9902728123631691, 0.13913934416382612),
+    TW(-0.9900582102622971, 0.1406582393328493), TW(-0.9898412784588205, 0.14217680351944784),
+    TW(-0.9896220174632009, 0.1436950331502944), TW(-0.9894004277913804, 0.14521292465284713),
+    TW(-0.989176509964781, 0.14673047445536158), TW(-0.988950264510303, 0.14824767898689603),
+    TW(-0.9887216919603238, 0.1497645346773212), TW(-0.9884907928526967, 0.15128103795733008),
+    TW(-0.9882575677307495, 0.15279718525844344), TW(-0.9880220171432836, 0.15431297301301983),
+    TW(-0.9877841416445722, 0.15582839765426512), TW(-0.9875439417943592, 0.1573434556162383),
+    TW(-0.9873014181578584, 0.15885814333386122), TW(-0.987056571305751, 0.1603724572429282),
+    TW(-0.9868094018141855, 0.1618863937801115), TW(-0.9865599102647755, 0.16339994938297306),
+    TW(-0.9863080972445987, 0.1649131204899699), TW(-0.9860539633461954, 0.16642590354046383),
+    TW(-0.9857975091675675, 0.16793829497473103), TW(-0.9855387353121761, 0.169450291233968),
+    TW(-0.9852776423889413, 0.17096188876030097), TW(-0.9850142310122398, 0.17247308399679587),
+    TW(-0.9847485018019042, 0.17398387338746388), TW(-0.9844804553832209, 0.1754942533772712),
+    TW(-0.9842100923869291, 0.1770042204121487), TW(-0.9839374134492189, 0.17851377093899717),
+    TW(-0.9836624192117303, 0.18002290140569935), TW(-0.9833851103215512, 0.18153160826112497),
+    TW(-0.9831054874312164, 0.18303988795514065), TW(-0.9828235511987053, 0.18454773693861948),
+    TW(-0.9825393022874412, 0.18605515166344666), TW(-0.9822527413662895, 0.18756212858252932),
+    TW(-0.9819638691095552, 0.1890686641498061), TW(-0.9816726861969831, 0.19057475482025282),
+    TW(-0.9813791933137547, 0.19208039704989222), TW(-0.9810833911504867, 0.19358558729580355),
+    TW(-0.9807852804032304, 0.19509032201612836), TW(-0.9804848617734694, 0.19659459767008003),
+    TW(-0.9801821359681174, 0.19809841071795356), TW(-0.9798771036995177, 0.19960175762113067),
+    TW(-0.9795697656854405, 0.20110463484209176), TW(-0.979260122649082, 0.20260703884442113),
+    TW(-0.9789481753190622, 0.20410896609281662), TW(-0.9786339244294232, 0.20561041305309916),
+    TW(-0.9783173707196277, 0.2071113761922186), TW(-0.9779985149345571, 0.20861185197826326),
+    TW(-0.97767735782451, 0.21011183688046955), TW(-0.9773539001452, 0.21161132736922766),
+    TW(-0.9770281426577544, 0.2131103199160912), TW(-0.9767000861287118, 0.21460881099378673),
+    TW(-0.9763697313300213, 0.21610679707621921), TW(-0.9760370790390391, 0.21760427463848347),
+    TW(-0.9757021300385286, 0.2191012401568698), TW(-0.975364885116657, 0.22059769010887326),
+    TW(-0.9750253450669941, 0.22209362097320343), TW(-0.9746835106885107, 0.22358902922979004),
+    TW(-0.9743393827855759, 0.2250839113597926), TW(-0.973992962167956, 0.22657826384560992),
+    TW(-0.9736442496508119, 0.22807208317088581), TW(-0.9732932460546982, 0.2295653658205187),
+    TW(-0.9729399522055602, 0.23105810828067108), TW(-0.9725843689347323, 0.23255030703877494),
+    TW(-0.9722264970789364, 0.23404195858354326), TW(-0.9718663374802794, 0.23553305940497551),
+    TW(-0.9715038909862519, 0.23702360599436695), TW(-0.9711391584497252, 0.23851359484431833),
+    TW(-0.9707721407289502, 0.24000302244874153), TW(-0.9704028386875555, 0.2414918853028691),
+    TW(-0.970031253194544, 0.24298017990326382), TW(-0.9696573851242924, 0.24446790274782426),
+    TW(-0.9692812353565485, 0.24595505033579443), TW(-0.9689028047764289, 0.24744161916777327),
+    TW(-0.9685220942744174, 0.24892760574571987), TW(-0.9681391047463624, 0.2504130065729651),
+    TW(-0.9677538370934755, 0.25189781815421697), TW(-0.9673662922223286, 0.2533820369955699),
+    TW(-0.9669764710448522, 0.25486565960451446), TW(-0.9665843744783331, 0.2563486824899429),
+    TW(-0.9661900034454126, 0.25783110216215877), TW(-0.9657933588740837, 0.2593129151328862),
+    TW(-0.9653944416976894, 0.2607941179152756), TW(-0.9649932528549204, 0.2622747070239134),
+    TW(-0.9645897932898128, 0.26375467897483135), TW(-0.9641840639517458, 0.2652340302855115),
+    TW(-0.96377606579544, 0.26671275747489825), TW(-0.963365799780954, 0.2681908570634032),
+    TW(-0.962953266873684, 0.2696683255729148), TW(-0.9625384680443592, 0.2711451595268079),
+    TW(-0.9621214042690416, 0.27262135544994903), TW(-0.9617020765291225, 0.27409690986870616),
+    TW(-0.9612804858113206, 0.2755718193109581), TW(-0.9608566331076795, 0.2770460803061),
+    TW(-0.9604305194155659, 0.2785196893850529), TW(-0.960002145737666, 0.2799926430802732),
+    TW(-0.9595715130819846, 0.28146493792575766), TW(-0.959138622461842, 0.28293657045705517),
+    TW(-0.9587034748958716, 0.2844075372112718), TW(-0.9582660714080178, 0.28587783472708034),
+    TW(-0.9578264130275329, 0.2873474595447294), TW(-0.9573845007889759, 0.28881640820604954),
+    TW(-0.9569403357322089, 0.2902846772544621), TW(-0.9564939189023951, 0.2917522632349892),
+    TW(-0.9560452513499964, 0.29321916269425874), TW(-0.9555943341307711, 0.29468537218051416),
+    TW(-0.9551411683057708, 0.2961508882436238), TW(-0.9546857549413384, 0.2976157074350859),
+    TW(-0.9542280951091057, 0.2990798263080403), TW(-0.9537681898859903, 0.30054324141727345),
+    TW(-0.953306040354194, 0.3020059493192278), TW(-0.9528416476011987, 0.3034679465720112),
+    TW(-0.9523750127197659, 0.30492922973540243), TW(-0.9519061368079323, 0.3063897953708607),
+    TW(-0.9514350209690084, 0.3078496400415348), TW(-0.9509616663115751, 0.3093087603122688),
+    TW(-0.9504860739494818, 0.3107671527496113), TW(-0.950008245001843, 0.3122248139218249),
+    TW(-0.9495281805930368, 0.3136817403988912), TW(-0.9490458818527007, 0.3151379287525222),
+    TW(-0.9485613499157303, 0.31659337555616585), TW(-0.9480745859222763, 0.31804807738501467),
+    TW(-0.9475855910177412, 0.3195020308160156), TW(-0.9470943663527772, 0.32095523242787527),
+    TW(-0.9466009130832836, 0.32240767880106963), TW(-0.9461052323704034, 0.3238593665178528),
+    TW(-0.9456073253805213, 0.325310292162263), TW(-0.9451071932852606, 0.32676045232013157),
+    TW(-0.9446048372614803, 0.3282098435790925), TW(-0.9441002584912728, 0.3296584625285872),
+    TW(-0.9435934581619604, 0.33110630575987626), TW(-0.9430844374660935, 0.3325533698660442),
+    TW(-0.942573197601447, 0.3339996514420091), TW(-0.9420597397710174, 0.3354451470845315),
+    TW(-0.9415440651830208, 0.3368898533922201), TW(-0.9410261750508894, 0.3383337669655409),
+    TW(-0.9405060705932684, 0.3397768844068268), TW(-0.9399837530340139, 0.34121920232028247),
+    TW(-0.93945922360219, 0.3426607173119942), TW(-0.9389324835320646, 0.3441014259899388),
+    TW(-0.9384035340631083, 0.34554132496398876), TW(-0.9378723764399899, 0.3469804108459235),
+    TW(-0.937339011912575, 0.34841868024943456), TW(-0.9368034417359217, 0.34985612979013464),
+    TW(-0.9362656671702783, 0.351292756085567), TW(-0.9357256894810804, 0.3527285557552107),
+    TW(-0.9351835099389477, 0.3541635254204901), TW(-0.9346391298196808, 0.3555976617047838),
+    TW(-0.9340925504042589, 0.3570309612334301), TW(-0.9335437729788363, 0.3584634206337364),
+    TW(-0.932992798834739, 0.3598950365349881), TW(-0.9324396292684625, 0.36132580556845395),
+    TW(-0.9318842655816681, 0.36275572436739706), TW(-0.9313267090811804, 0.3641847895670799),
+    TW(-0.9307669610789838, 0.3656129978047736), TW(-0.9302050228922191, 0.36704034571976707),
+    TW(-0.9296408958431812, 0.3684668299533724), TW(-0.9290745812593159, 0.3698924471489339),
+    TW(-0.9285060804732156, 0.37131719395183743), TW(-0.9279353948226178, 0.37274106700951587),
+    TW(-0.9273625256504011, 0.3741640629714578), TW(-0.9267874743045819, 0.37558617848921716),
+    TW(-0.9262102421383115, 0.3770074102164179), TW(-0.9256308305098728, 0.3784277548087654),
+    TW(-0.9250492407826776, 0.37984720892405116), TW(-0.9244654743252627, 0.3812657692221621),
+    TW(-0.9238795325112868, 0.38268343236508967), TW(-0.9232914167195276, 0.3841001950169351),
+    TW(-0.9227011283338786, 0.3855160538439186), TW(-0.9221086687433452, 0.3869310055143885),
+    TW(-0.9215140393420419, 0.38834504669882636), TW(-0.9209172415291895, 0.38975817406985624),
+    TW(-0.9203182767091106, 0.3911703843022538), TW(-0.9197171462912275, 0.3925816740729512),
+    TW(-0.9191138516900578, 0.39399204006104793), TW(-0.9185083943252123, 0.3954014789478163),
+    TW(-0.9179007756213906, 0.39680998741671003), TW(-0.917290997008378, 0.39821756215337345),
+    TW(-0.9166790599210427, 0.39962419984564684), TW(-0.9160649657993318, 0.4010298971835754),
+    TW(-0.9154487160882678, 0.4024346508594184), TW(-0.9148303122379461, 0.4038384575676542),
+    TW(-0.9142097557035307, 0.4052413140049897), TW(-0.9135870479452508, 0.406643216870369),
+    TW(-0.9129621904283983, 0.40804416286497835), TW(-0.9123351846233229, 0.4094441486922574),
+    TW(-0.9117060320054299, 0.4108431710579039), TW(-0.9110747340551765, 0.4122412266698826),
+    TW(-0.9104412922580672, 0.4136383122384344), TW(-0.9098057081046522, 0.41503442447608163),
+    TW(-0.9091679830905225, 0.41642956009763693), TW(-0.9085281187163062, 0.4178237158202122),
+    TW(-0.9078861164876662, 0.419216888363224), TW(-0.9072419779152959, 0.42060907444840234),
+    TW(-0.9065957045149154, 0.4220002707997996), TW(-0.9059472978072686, 0.4233904741437957),
+    TW(-0.9052967593181188, 0.42477968120910864), TW(-0.9046440905782462, 0.4261678887267996),
+    TW(-0.9039892931234434, 0.4275550934302818), TW(-0.9033323684945119, 0.4289412920553294),
+    TW(-0.9026733182372588, 0.43032648134008267), TW(-0.9020121439024933, 0.43171065802505704),
+    TW(-0.901348847046022, 0.43309381885315185), TW(-0.9006834292286469, 0.43447596056965576),
+    TW(-0.9000158920161603, 0.4358570799222553), TW(-0.8993462369793416, 0.43723717366104403),
+    TW(-0.898674465693954, 0.4386162385385273), TW(-0.8980005797407399, 0.4399942713096331),
+    TW(-0.8973245807054183, 0.44137126873171667), TW(-0.8966464701786804, 0.44274722756456975),
+    TW(-0.8959662497561852, 0.4441221445704291), TW(-0.8952839210385575, 0.44549601651398174),
+    TW(-0.8945994856313828, 0.44686884016237394), TW(-0.8939129451452033, 0.44824061228521983),
+    TW(-0.8932243011955153, 0.44961132965460665), TW(-0.8925335554027647, 0.45098098904510364),
+    TW(-0.8918407093923427, 0.45234958723377083), TW(-0.8911457647945834, 0.45371712100016354),
+    TW(-0.890448723244758, 0.45508358712634367), TW(-0.8897495863830728, 0.4564489823968839),
+    TW(-0.8890483558546647, 0.45781330359887695), TW(-0.8883450333095964, 0.459176547521944),
+    TW(-0.8876396204028539, 0.46053871095824006), TW(-0.8869321187943423, 0.4618997907024625),
+    TW(-0.8862225301488806, 0.4632597835518601), TW(-0.8855108561362, 0.46461868630623787),
+    TW(-0.8847970984309379, 0.46597649576796596), TW(-0.884081258712635, 0.46733320874198836),
+    TW(-0.8833633386657318, 0.4686888220358276), TW(-0.8826433399795629, 0.47004333245959545),
+    TW(-0.881921264348355, 0.47139673682599764), TW(-0.8811971134712222, 0.4727490319503425),
+    TW(-0.8804708890521609, 0.47410021465054986), TW(-0.8797425928000474, 0.4754502817471559),
+    TW(-0.8790122264286336, 0.47679923006332187), TW(-0.8782797916565416, 0.47814705642484295),
+    TW(-0.8775452902072612, 0.47949375766015306), TW(-0.8768087238091458, 0.48083933060033374),
+    TW(-0.8760700941954066, 0.48218377207912266), TW(-0.875329403104111, 0.4835270789329184),
+    TW(-0.8745866522781762, 0.48486924800079095), TW(-0.8738418434653669, 0.48621027612448636),
+    TW(-0.8730949784182902, 0.48755016014843566), TW(-0.8723460588943915, 0.48888889691976306),
+    TW(-0.871595086655951, 0.49022648328829116), TW(-0.8708420634700791, 0.49156291610654973),
+    TW(-0.8700869911087115, 0.4928981922297839), TW(-0.8693298713486067, 0.4942323085159598),
+    TW(-0.868570705971341, 0.4955652618257723), TW(-0.8678094967633033, 0.49689704902265447),
+    TW(-0.8670462455156929, 0.49822766697278154), TW(-0.8662809540245131, 0.4995571125450817),
+    TW(-0.8655136240905691, 0.5008853826112407), TW(-0.8647442575194625, 0.5022124740457106),
+    TW(-0.8639728561215868, 0.5035383837257175), TW(-0.8631994217121242, 0.5048631085312676),
+    TW(-0.8624239561110407, 0.506186645345155), TW(-0.8616464611430814, 0.5075089910529708),
+    TW(-0.8608669386377673, 0.5088301425431071), TW(-0.8600853904293903, 0.5101500967067666),
+    TW(-0.8593018183570085, 0.5114688504379703), TW(-0.858516224264443, 0.5127864006335627),
+    TW(-0.8577286100002721, 0.5141027441932216), TW(-0.8569389774178288, 0.5154178780194629),
+    TW(-0.8561473283751947, 0.5167317990176497), TW(-0.8553536647351961, 0.5180445040959992),
+    TW(-0.8545579883654005, 0.5193559901655896), TW(-0.8537603011381115, 0.5206662541403669),
+    TW(-0.8529606049303637, 0.5219752929371543), TW(-0.8521589016239198, 0.5232831034756564),
+    TW(-0.8513551931052653, 0.5245896826784687), TW(-0.8505494812656035, 0.5258950274710846),
+    TW(-0.8497417680008527, 0.5271991347819011), TW(-0.8489320552116397, 0.5285020015422283),
+    TW(-0.8481203448032972, 0.5298036246862946), TW(-0.8473066386858585, 0.5311040011512547),
+    TW(-0.8464909387740521, 0.5324031278771978), TW(-0.8456732469872991, 0.533701001807153),
+    TW(-0.8448535652497072, 0.5349976198870969), TW(-0.8440318954900665, 0.5362929790659631),
+    TW(-0.8432082396418454, 0.5375870762956455), TW(-0.842382599643186, 0.5388799085310082),
+    TW(-0.8415549774368984, 0.5401714727298929), TW(-0.8407253749704582, 0.5414617658531232),
+    TW(-0.8398937941959996, 0.5427507848645158), TW(-0.8390602370703127, 0.5440385267308838),
+    TW(-0.8382247055548382, 0.5453249884220461), TW(-0.837387201615662, 0.5466101669108347),
+    TW(-0.836547727223512, 0.5478940591731002), TW(-0.8357062843537527, 0.5491766621877195),
+    TW(-0.8348628749863801, 0.5504579729366047), TW(-0.8340175011060181, 0.5517379884047074),
+    TW(-0.8331701647019133, 0.5530167055800274), TW(-0.8323208677679297, 0.55429412145362),
+    TW(-0.8314696123025455, 0.555570233019602), TW(-0.8306164003088464, 0.5568450372751599),
+    TW(-0.829761233794523, 0.5581185312205561), TW(-0.8289041147718651, 0.5593907118591358),
+    TW(-0.8280450452577558, 0.5606615761973359), TW(-0.8271840272736691, 0.5619311212446894),
+    TW(-0.8263210628456636, 0.5631993440138339), TW(-0.8254561540043776, 0.5644662415205194),
+    TW(-0.8245893027850253, 0.5657318107836132), TW(-0.8237205112273915, 0.5669960488251085),
+    TW(-0.8228497813758264, 0.5682589526701315), TW(-0.8219771152792416, 0.5695205193469473),
+    TW(-0.8211025149911048, 0.5707807458869671), TW(-0.8202259825694347, 0.572039629324757),
+    TW(-0.8193475200767971, 0.573297166698042), TW(-0.8184671295802988, 0.5745533550477157),
+    TW(-0.8175848131515837, 0.5758081914178453), TW(-0.816700572866828, 0.5770616728556793),
+    TW(-0.8158144108067339, 0.5783137964116555), TW(-0.8149263290565266, 0.5795645591394057),
+    TW(-0.8140363297059485, 0.5808139580957643), TW(-0.8131444148492536, 0.5820619903407754),
+    TW(-0.8122505865852039, 0.5833086529376984), TW(-0.8113548470170638, 0.5845539429530151),
+    TW(-0.8104571982525948, 0.5857978574564389), TW(-0.8095576424040515, 0.5870403935209177),
+    TW(-0.8086561815881751, 0.5882815482226451), TW(-0.8077528179261904, 0.5895213186410639),
+    TW(-0.8068475535437994, 0.5907597018588739), TW(-0.8059403905711764, 0.5919966949620409),
+    TW(-0.8050313311429635, 0.5932322950397998), TW(-0.8041203773982659, 0.5944664991846642),
+    TW(-0.8032075314806449, 0.5956993044924332), TW(-0.8022927955381157, 0.5969307080621965),
+    TW(-0.8013761717231404, 0.5981607069963422), TW(-0.8004576621926228, 0.5993892984005645),
+    TW(-0.7995372691079052, 0.6006164793838686), TW(-0.7986149946347609, 0.6018422470585799),
+    TW(-0.7976908409433912, 0.6030665985403482), TW(-0.7967648102084189, 0.6042895309481559),
+    TW(-0.7958369046088836, 0.6055110414043254), TW(-0.7949071263282369, 0.6067311270345245),
+    TW(-0.7939754775543373, 0.6079497849677734), TW(-0.7930419604794438, 0.6091670123364531),
+    TW(-0.7921065773002123, 0.6103828062763095), TW(-0.7911693302176903, 0.6115971639264618),
+    TW(-0.7902302214373101, 0.6128100824294097), TW(-0.7892892531688859, 0.6140215589310382),
+    TW(-0.7883464276266063, 0.6152315905806267), TW(-0.7874017470290314, 0.6164401745308536),
+    TW(-0.786455213599086, 0.6176473079378036), TW(-0.785506829564054, 0.6188529879609762),
+    TW(-0.7845565971555752, 0.6200572117632892), TW(-0.7836045186096384, 0.6212599765110874),
+    TW(-0.7826505961665758, 0.6224612793741499), TW(-0.7816948320710594, 0.6236611175256946),
+    TW(-0.7807372285720946, 0.6248594881423862), TW(-0.7797777879230146, 0.6260563884043435),
+    TW(-0.7788165123814762, 0.6272518154951439), TW(-0.7778534042094531, 0.6284457666018326),
+    TW(-0.7768884656732324, 0.629638238914927), TW(-0.7759216990434078, 0.6308292296284242),
+    TW(-0.7749531065948739, 0.632018735939809), TW(-0.7739826906068228, 0.6332067550500573),
+    TW(-0.7730104533627371, 0.6343932841636453), TW(-0.7720363971503845, 0.6355783204885561),
+    TW(-0.7710605242618137, 0.6367618612362843), TW(-0.7700828369933481, 0.6379439036218439),
+    TW(-0.7691033376455797, 0.6391244448637757), TW(-0.7681220285233656, 0.6403034821841515),
+    TW(-0.7671389119358205, 0.641481012808583), TW(-0.7661539901963129, 0.6426570339662269),
+    TW(-0.7651672656224591, 0.6438315428897913), TW(-0.7641787405361168, 0.6450045368155438),
+    TW(-0.7631884172633813, 0.6461760129833164), TW(-0.7621962981345791, 0.6473459686365118),
+    TW(-0.7612023854842619, 0.6485144010221123), TW(-0.7602066816512024, 0.6496813073906832),
+    TW(-0.7592091889783882, 0.6508466849963808), TW(-0.7582099098130153, 0.6520105310969595),
+    TW(-0.7572088465064848, 0.6531728429537765), TW(-0.7562060014143946, 0.6543336178318003),
+    TW(-0.7552013768965365, 0.6554928529996153), TW(-0.7541949753168894, 0.6566505457294288),
+    TW(-0.7531867990436126, 0.6578066932970785), TW(-0.7521768504490427, 0.6589612929820373),
+    TW(-0.7511651319096866, 0.6601143420674203), TW(-0.7501516458062151, 0.6612658378399922),
+    TW(-0.7491363945234593, 0.6624157775901718), TW(-0.7481193804504037, 0.6635641586120397),
+    TW(-0.7471006059801801, 0.6647109782033448), TW(-0.746080073510064, 0.6658562336655094),
+    TW(-0.7450577854414661, 0.6669999223036374), TW(-0.7440337441799293, 0.6681420414265185),
+    TW(-0.7430079521351219, 0.6692825883466358), TW(-0.7419804117208311, 0.670421560380173),
+    TW(-0.7409511253549591, 0.6715589548470184), TW(-0.7399200954595163, 0.6726947690707727),
+    TW(-0.7388873244606152, 0.6738290003787559), TW(-0.737852814788466, 0.674961646102012),
+    TW(-0.73681656887737, 0.6760927035753158), TW(-0.7357785891657136, 0.6772221701371803),
+    TW(-0.7347388780959637, 0.6783500431298612), TW(-0.7336974381146604, 0.6794763198993649),
+    TW(-0.7326542716724128, 0.680600997795453), TW(-0.7316093812238927, 0.6817240741716496),
+    TW(-0.7305627692278277, 0.682845546385248), TW(-0.729514438146997, 0.6839654117973154),
+    TW(-0.7284643904482254, 0.6850836677727001), TW(-0.7274126286023759, 0.6862003116800385),
+    TW(-0.7263591550843459, 0.6873153408917592), TW(-0.7253039723730609, 0.6884287527840903),
+    TW(-0.724247082951467, 0.6895405447370668), TW(-0.7231884893065277, 0.6906507141345344),
+    TW(-0.7221281939292155, 0.6917592583641576), TW(-0.7210661993145081, 0.6928661748174246),
+    TW(-0.7200025079613819, 0.6939714608896538), TW(-0.7189371223728045, 0.6950751139800008),
+    TW(-0.7178700450557317, 0.696177131491463), TW(-0.7168012785210996, 0.6972775108308864),
+    TW(-0.7157308252838187, 0.6983762494089728), TW(-0.714658687862769, 0.6994733446402839),
+    TW(-0.7135848687807937, 0.7005687939432482), TW(-0.7125093705646923, 0.7016625947401685),
+    TW(-0.7114321957452167, 0.7027547444572251), TW(-0.7103533468570624, 0.7038452405244848),
+    TW(-0.7092728264388657, 0.7049340803759049), TW(-0.7081906370331955, 0.7060212614493395),
+    TW(-0.7071067811865477, 0.7071067811865475), TW(-0.7060212614493397, 0.7081906370331953),
+    TW(-0.7049340803759051, 0.7092728264388655), TW(-0.703845240524485, 0.7103533468570623),
+    TW(-0.7027547444572253, 0.7114321957452164), TW(-0.7016625947401687, 0.7125093705646922),
+    TW(-0.7005687939432484, 0.7135848687807935), TW(-0.6994733446402841, 0.7146586878627688),
+    TW(-0.698376249408973, 0.7157308252838185), TW(-0.6972775108308866, 0.7168012785210995),
+    TW(-0.6961771314914632, 0.7178700450557315), TW(-0.695075113980001, 0.7189371223728044),
+    TW(-0.693971460889654, 0.7200025079613817), TW(-0.6928661748174249, 0.7210661993145079),
+    TW(-0.6917592583641579, 0.7221281939292152), TW(-0.6906507141345346, 0.7231884893065275),
+    TW(-0.689540544737067, 0.7242470829514668), TW(-0.6884287527840905, 0.7253039723730607),
+    TW(-0.6873153408917594, 0.7263591550843457), TW(-0.6862003116800387, 0.7274126286023757),
+    TW(-0.6850836677727004, 0.7284643904482252), TW(-0.6839654117973156, 0.7295144381469968),
+    TW(-0.6828455463852482, 0.7305627692278275), TW(-0.6817240741716498, 0.7316093812238925),
+    TW(-0.6806009977954532, 0.7326542716724126), TW(-0.6794763198993651, 0.7336974381146601),
+    TW(-0.6783500431298615, 0.7347388780959635), TW(-0.6772221701371806, 0.7357785891657134),
+    TW(-0.676092703575316, 0.7368165688773698), TW(-0.6749616461020123, 0.7378528147884658),
+    TW(-0.6738290003787563, 0.738887324460615), TW(-0.672694769070773, 0.7399200954595161),
+    TW(-0.6715589548470187, 0.7409511253549589), TW(-0.6704215603801732, 0.741980411720831),
+    TW(-0.6692825883466361, 0.7430079521351217), TW(-0.6681420414265187, 0.7440337441799291),
+    TW(-0.6669999223036376, 0.7450577854414658), TW(-0.6658562336655096, 0.7460800735100638),
+    TW(-0.664710978203345, 0.74710060598018), TW(-0.6635641586120399, 0.7481193804504035),
+    TW(-0.662415777590172, 0.749136394523459), TW(-0.6612658378399924, 0.750151645806215),
+    TW(-0.6601143420674205, 0.7511651319096864), TW(-0.6589612929820375, 0.7521768504490425),
+    TW(-0.6578066932970787, 0.7531867990436124), TW(-0.656650545729429, 0.7541949753168892),
+    TW(-0.6554928529996156, 0.7552013768965363), TW(-0.6543336178318007, 0.7562060014143944),
+    TW(-0.6531728429537771, 0.7572088465064842), TW(-0.6520105310969597, 0.7582099098130152),
+    TW(-0.650846684996381, 0.759209188978388), TW(-0.6496813073906831, 0.7602066816512024),
+    TW(-0.6485144010221122, 0.761202385484262), TW(-0.6473459686365125, 0.7621962981345786),
+    TW(-0.6461760129833166, 0.763188417263381), TW(-0.645004536815544, 0.7641787405361166),
+    TW(-0.6438315428897915, 0.765167265622459), TW(-0.6426570339662268, 0.766153990196313),
+    TW(-0.6414810128085836, 0.7671389119358201), TW(-0.640303482184152, 0.7681220285233651),
+    TW(-0.639124444863776, 0.7691033376455795), TW(-0.6379439036218442, 0.7700828369933479),
+    TW(-0.6367618612362842, 0.7710605242618138), TW(-0.635578320488556, 0.7720363971503846),
+    TW(-0.6343932841636459, 0.7730104533627367), TW(-0.6332067550500575, 0.7739826906068226),
+    TW(-0.6320187359398092, 0.7749531065948738), TW(-0.6308292296284246, 0.7759216990434076),
+    TW(-0.6296382389149269, 0.7768884656732326), TW(-0.6284457666018332, 0.7778534042094527),
+    TW(-0.6272518154951444, 0.7788165123814756), TW(-0.6260563884043437, 0.7797777879230143),
+    TW(-0.6248594881423865, 0.7807372285720944), TW(-0.6236611175256945, 0.7816948320710595),
+    TW(-0.6224612793741497, 0.7826505961665758), TW(-0.621259976511088, 0.783604518609638),
+    TW(-0.6200572117632894, 0.784556597155575), TW(-0.6188529879609764, 0.7855068295640538),
+    TW(-0.617647307937804, 0.7864552135990858), TW(-0.6164401745308535, 0.7874017470290314),
+    TW(-0.6152315905806273, 0.7883464276266059), TW(-0.6140215589310387, 0.7892892531688854),
+    TW(-0.6128100824294099, 0.7902302214373099), TW(-0.611597163926462, 0.7911693302176901),
+    TW(-0.6103828062763094, 0.7921065773002124), TW(-0.609167012336453, 0.7930419604794439),
+    TW(-0.6079497849677741, 0.7939754775543368), TW(-0.6067311270345248, 0.7949071263282368),
+    TW(-0.6055110414043257, 0.7958369046088835), TW(-0.6042895309481561, 0.7967648102084187),
+    TW(-0.603066598540348, 0.7976908409433912), TW(-0.6018422470585805, 0.7986149946347605),
+    TW(-0.6006164793838693, 0.7995372691079048), TW(-0.5993892984005648, 0.8004576621926226),
+    TW(-0.5981607069963424, 0.8013761717231401), TW(-0.5969307080621964, 0.8022927955381157),
+    TW(-0.5956993044924331, 0.803207531480645), TW(-0.5944664991846649, 0.8041203773982655),
+    TW(-0.5932322950398001, 0.8050313311429634), TW(-0.5919966949620411, 0.8059403905711762),
+    TW(-0.5907597018588743, 0.8068475535437992), TW(-0.5895213186410638, 0.8077528179261905),
+    TW(-0.5882815482226458, 0.8086561815881746), TW(-0.5870403935209183, 0.809557642404051),
+    TW(-0.5857978574564391, 0.8104571982525947), TW(-0.5845539429530153, 0.8113548470170637),
+    TW(-0.5833086529376983, 0.812250586585204), TW(-0.5820619903407753, 0.8131444148492537),
+    TW(-0.580813958095765, 0.8140363297059481), TW(-0.579564559139406, 0.8149263290565264),
+    TW(-0.5783137964116557, 0.8158144108067337), TW(-0.5770616728556796, 0.8167005728668277),
+    TW(-0.5758081914178452, 0.8175848131515838), TW(-0.5745533550477163, 0.8184671295802983),
+    TW(-0.5732971666980425, 0.8193475200767967), TW(-0.5720396293247573, 0.8202259825694345),
+    TW(-0.5707807458869674, 0.8211025149911046), TW(-0.5695205193469471, 0.8219771152792416),
+    TW(-0.5682589526701314, 0.8228497813758264), TW(-0.566996048825109, 0.8237205112273911),
+    TW(-0.5657318107836135, 0.8245893027850251), TW(-0.5644662415205196, 0.8254561540043774),
+    TW(-0.5631993440138341, 0.8263210628456634), TW(-0.5619311212446892, 0.8271840272736692),
+    TW(-0.5606615761973365, 0.8280450452577555), TW(-0.5593907118591365, 0.8289041147718647),
+    TW(-0.5581185312205563, 0.8297612337945229), TW(-0.5568450372751601, 0.8306164003088462),
+    TW(-0.5555702330196022, 0.8314696123025452), TW(-0.5542941214536199, 0.8323208677679298),
+    TW(-0.5530167055800279, 0.8331701647019129), TW(-0.5517379884047077, 0.8340175011060179),
+    TW(-0.5504579729366049, 0.83486287498638), TW(-0.5491766621877198, 0.8357062843537526),
+    TW(-0.5478940591731001, 0.8365477272235121), TW(-0.5466101669108354, 0.8373872016156616),
+    TW(-0.5453249884220468, 0.8382247055548379), TW(-0.5440385267308842, 0.8390602370703125),
+    TW(-0.542750784864516, 0.8398937941959994), TW(-0.5414617658531234, 0.8407253749704581),
+    TW(-0.5401714727298927, 0.8415549774368986), TW(-0.5388799085310089, 0.8423825996431856),
+    TW(-0.5375870762956457, 0.8432082396418452), TW(-0.5362929790659633, 0.8440318954900663),
+    TW(-0.5349976198870973, 0.844853565249707), TW(-0.5337010018071529, 0.8456732469872992),
+    TW(-0.5324031278771985, 0.8464909387740518), TW(-0.5311040011512553, 0.8473066386858581),
+    TW(-0.5298036246862949, 0.8481203448032971), TW(-0.5285020015422286, 0.8489320552116396),
+    TW(-0.5271991347819013, 0.8497417680008525), TW(-0.5258950274710845, 0.8505494812656036),
+    TW(-0.5245896826784694, 0.8513551931052649), TW(-0.5232831034756568, 0.8521589016239196),
+    TW(-0.5219752929371545, 0.8529606049303635), TW(-0.5206662541403672, 0.8537603011381114),
+    TW(-0.5193559901655894, 0.8545579883654006), TW(-0.5180445040959999, 0.8553536647351957),
+    TW(-0.5167317990176502, 0.8561473283751942), TW(-0.5154178780194633, 0.8569389774178285),
+    TW(-0.5141027441932218, 0.857728610000272), TW(-0.512786400633563, 0.8585162242644429),
+    TW(-0.5114688504379702, 0.8593018183570085), TW(-0.5101500967067673, 0.8600853904293899),
+    TW(-0.5088301425431073, 0.8608669386377671), TW(-0.507508991052971, 0.8616464611430812),
+    TW(-0.5061866453451553, 0.8624239561110405), TW(-0.5048631085312674, 0.8631994217121243),
+    TW(-0.503538383725718, 0.8639728561215865), TW(-0.5022124740457111, 0.8647442575194622),
+    TW(-0.500885382611241, 0.865513624090569), TW(-0.499557112545082, 0.8662809540245129),
+    TW(-0.4982276669727818, 0.8670462455156926), TW(-0.49689704902265436, 0.8678094967633033),
+    TW(-0.495565261825773, 0.8685707059713407), TW(-0.49423230851596006, 0.8693298713486066),
+    TW(-0.4928981922297842, 0.8700869911087113), TW(-0.49156291610654995, 0.8708420634700789),
+    TW(-0.49022648328829105, 0.8715950866559511), TW(-0.4888888969197637, 0.8723460588943912),
+    TW(-0.48755016014843633, 0.8730949784182899), TW(-0.48621027612448664, 0.8738418434653668),
+    TW(-0.4848692480007912, 0.8745866522781761), TW(-0.4835270789329187, 0.8753294031041109),
+    TW(-0.48218377207912255, 0.8760700941954067), TW(-0.4808393306003344, 0.8768087238091454),
+    TW(-0.47949375766015334, 0.8775452902072611), TW(-0.47814705642484323, 0.8782797916565415),
+    TW(-0.47679923006332214, 0.8790122264286334), TW(-0.47545028174715576, 0.8797425928000475),
+    TW(-0.4741002146505505, 0.8804708890521605), TW(-0.4727490319503432, 0.8811971134712219),
+    TW(-0.47139673682599786, 0.8819212643483549), TW(-0.47004333245959573, 0.8826433399795627),
+    TW(-0.4686888220358279, 0.8833633386657316), TW(-0.46733320874198825, 0.8840812587126351),
+    TW(-0.4659764957679666, 0.8847970984309376), TW(-0.46461868630623815, 0.8855108561361997),
+    TW(-0.46325978355186037, 0.8862225301488805), TW(-0.4618997907024628, 0.8869321187943422),
+    TW(-0.4605387109582399, 0.887639620402854), TW(-0.45917654752194464, 0.888345033309596),
+    TW(-0.4578133035988776, 0.8890483558546644), TW(-0.4564489823968842, 0.8897495863830727),
+    TW(-0.45508358712634395, 0.8904487232447579), TW(-0.4537171210001638, 0.8911457647945833),
+    TW(-0.45234958723377067, 0.8918407093923428), TW(-0.4509809890451043, 0.8925335554027644),
+    TW(-0.44961132965460693, 0.8932243011955152), TW(-0.4482406122852201, 0.8939129451452031),
+    TW(-0.4468688401623742, 0.8945994856313827), TW(-0.44549601651398163, 0.8952839210385576),
+    TW(-0.44412214457042976, 0.8959662497561849), TW(-0.4427472275645704, 0.89664647017868),
+    TW(-0.44137126873171695, 0.8973245807054182), TW(-0.43999427130963337, 0.8980005797407398),
+    TW(-0.4386162385385276, 0.8986744656939538), TW(-0.4372371736610439, 0.8993462369793417),
+    TW(-0.435857079922256, 0.90001589201616), TW(-0.43447596056965604, 0.9006834292286467),
+    TW(-0.4330938188531521, 0.9013488470460219), TW(-0.4317106580250573, 0.9020121439024932),
+    TW(-0.4303264813400825, 0.9026733182372588), TW(-0.42894129205533005, 0.9033323684945116),
+    TW(-0.4275550934302825, 0.9039892931234431), TW(-0.4261678887267999, 0.9046440905782461),
+    TW(-0.4247796812091089, 0.9052967593181187), TW(-0.423390474143796, 0.9059472978072685),
+    TW(-0.4220002707997995, 0.9065957045149154), TW(-0.420609074448403, 0.9072419779152956),
+    TW(-0.4192168883632243, 0.907886116487666), TW(-0.4178237158202125, 0.908528118716306),
+    TW(-0.4164295600976372, 0.9091679830905224), TW(-0.4150344244760815, 0.9098057081046523),
+    TW(-0.4136383122384351, 0.9104412922580669), TW(-0.4122412266698833, 0.9110747340551761),
+    TW(-0.4108431710579042, 0.9117060320054298), TW(-0.40944414869225776, 0.9123351846233227),
+    TW(-0.40804416286497863, 0.9129621904283982), TW(-0.4066432168703688, 0.9135870479452509),
+    TW(-0.40524131400499036, 0.9142097557035305), TW(-0.40383845756765446, 0.914830312237946),
+    TW(-0.40243465085941865, 0.9154487160882677), TW(-0.4010298971835757, 0.9160649657993317),
+    TW(-0.39962419984564673, 0.9166790599210427), TW(-0.39821756215337417, 0.9172909970083777),
+    TW(-0.39680998741671075, 0.9179007756213903), TW(-0.3954014789478166, 0.9185083943252121),
+    TW(-0.3939920400610482, 0.9191138516900577), TW(-0.39258167407295147, 0.9197171462912274),
+    TW(-0.3911703843022537, 0.9203182767091106), TW(-0.38975817406985697, 0.9209172415291893),
+    TW(-0.38834504669882663, 0.9215140393420418), TW(-0.3869310055143888, 0.9221086687433451),
+    TW(-0.3855160538439189, 0.9227011283338785), TW(-0.38410019501693493, 0.9232914167195276),
+    TW(-0.38268343236509034, 0.9238795325112865), TW(-0.38126576922216276, 0.9244654743252625),
+    TW(-0.37984720892405144, 0.9250492407826775), TW(-0.3784277548087657, 0.9256308305098727),
+    TW(-0.3770074102164182, 0.9262102421383114), TW(-0.37558617848921705, 0.9267874743045819),
+    TW(-0.3741640629714585, 0.9273625256504009), TW(-0.37274106700951615, 0.9279353948226177),
+    TW(-0.37131719395183777, 0.9285060804732155), TW(-0.36989244714893416, 0.9290745812593157),
+    TW(-0.3684668299533722, 0.9296408958431813), TW(-0.36704034571976696, 0.9302050228922192),
+    TW(-0.3656129978047743, 0.9307669610789836), TW(-0.36418478956708017, 0.9313267090811803),
+    TW(-0.36275572436739734, 0.931884265581668), TW(-0.36132580556845423, 0.9324396292684624),
+    TW(-0.35989503653498794, 0.932992798834739), TW(-0.35846342063373704, 0.933543772978836),
+    TW(-0.35703096123343037, 0.9340925504042588), TW(-0.3555976617047841, 0.9346391298196807),
+    TW(-0.35416352542049045, 0.9351835099389476), TW(-0.3527285557552106, 0.9357256894810804),
+    TW(-0.35129275608556687, 0.9362656671702784), TW(-0.34985612979013536, 0.9368034417359214),
+    TW(-0.34841868024943484, 0.9373390119125748), TW(-0.3469804108459238, 0.9378723764399898),
+    TW(-0.34554132496398904, 0.9384035340631082), TW(-0.34410142598993865, 0.9389324835320646),
+    TW(-0.3426607173119949, 0.9394592236021897), TW(-0.34121920232028274, 0.9399837530340138),
+    TW(-0.3397768844068271, 0.9405060705932683), TW(-0.33833376696554124, 0.9410261750508893),
+    TW(-0.33688985339221994, 0.9415440651830208), TW(-0.3354451470845314, 0.9420597397710174),
+    TW(-0.3339996514420098, 0.9425731976014468), TW(-0.3325533698660445, 0.9430844374660934),
+    TW(-0.33110630575987654, 0.9435934581619603), TW(-0.3296584625285875, 0.9441002584912727),
+    TW(-0.32820984357909233, 0.9446048372614804), TW(-0.3267604523201323, 0.9451071932852604),
+    TW(-0.3253102921622633, 0.9456073253805212), TW(-0.3238593665178531, 0.9461052323704033),
+    TW(-0.3224076788010699, 0.9466009130832835), TW(-0.32095523242787516, 0.9470943663527772),
+    TW(-0.3195020308160154, 0.9475855910177412), TW(-0.3180480773850154, 0.9480745859222761),
+    TW(-0.3165933755561662, 0.9485613499157302), TW(-0.31513792875252256, 0.9490458818527006),
+    TW(-0.31368174039889146, 0.9495281805930367), TW(-0.3122248139218248, 0.9500082450018431),
+    TW(-0.31076715274961203, 0.9504860739494816), TW(-0.30930876031226906, 0.950961666311575),
+    TW(-0.3078496400415351, 0.9514350209690083), TW(-0.30638979537086103, 0.9519061368079323),
+    TW(-0.3049292297354023, 0.9523750127197659), TW(-0.30346794657201104, 0.9528416476011987),
+    TW(-0.30200594931922853, 0.9533060403541938), TW(-0.30054324141727373, 0.9537681898859902),
+    TW(-0.2990798263080406, 0.9542280951091056), TW(-0.2976157074350862, 0.9546857549413383),
+    TW(-0.2961508882436237, 0.9551411683057708), TW(-0.2946853721805149, 0.9555943341307709),
+    TW(-0.293219162694259, 0.9560452513499963), TW(-0.2917522632349895, 0.956493918902395),
+    TW(-0.29028467725446244, 0.9569403357322088), TW(-0.28881640820604937, 0.957384500788976),
+    TW(-0.2873474595447293, 0.957826413027533), TW(-0.28587783472708106, 0.9582660714080176),
+    TW(-0.28440753721127215, 0.9587034748958715), TW(-0.2829365704570555, 0.9591386224618419),
+    TW(-0.28146493792575794, 0.9595715130819845), TW(-0.27999264308027305, 0.960002145737666),
+    TW(-0.2785196893850536, 0.9604305194155657), TW(-0.2770460803061003, 0.9608566331076795),
+    TW(-0.27557181931095837, 0.9612804858113205), TW(-0.27409690986870644, 0.9617020765291225),
+    TW(-0.27262135544994887, 0.9621214042690416), TW(-0.2711451595268078, 0.9625384680443593),
+    TW(-0.26966832557291553, 0.9629532668736838), TW(-0.2681908570634035, 0.9633657997809539),
+    TW(-0.26671275747489853, 0.9637760657954398), TW(-0.2652340302855118, 0.9641840639517458),
+    TW(-0.26375467897483124, 0.9645897932898128), TW(-0.26227470702391414, 0.9649932528549202),
+    TW(-0.2607941179152759, 0.9653944416976893), TW(-0.25931291513288646, 0.9657933588740836),
+    TW(-0.25783110216215904, 0.9661900034454125), TW(-0.2563486824899428, 0.9665843744783331),
+    TW(-0.25486565960451435, 0.9669764710448522), TW(-0.2533820369955706, 0.9673662922223284),
+    TW(-0.25189781815421725, 0.9677538370934754), TW(-0.2504130065729654, 0.9681391047463623),
+    TW(-0.24892760574572015, 0.9685220942744173), TW(-0.24744161916777313, 0.9689028047764289),
+    TW(-0.24595505033579515, 0.9692812353565483), TW(-0.24446790274782454, 0.9696573851242923),
+    TW(-0.24298017990326412, 0.970031253194544), TW(-0.2414918853028694, 0.9704028386875555),
+    TW(-0.2400030224487414, 0.9707721407289504), TW(-0.2385135948443182, 0.9711391584497252),
+    TW(-0.23702360599436767, 0.9715038909862517), TW(-0.2355330594049758, 0.9718663374802793),
+    TW(-0.23404195858354357, 0.9722264970789363), TW(-0.23255030703877522, 0.9725843689347322),
+    TW(-0.23105810828067094, 0.9729399522055602), TW(-0.22956536582051942, 0.9732932460546981),
+    TW(-0.22807208317088612, 0.9736442496508119), TW(-0.22657826384561022, 0.9739929621679558),
+    TW(-0.22508391135979292, 0.9743393827855759), TW(-0.2235890292297899, 0.9746835106885107),
+    TW(-0.2220936209732033, 0.9750253450669942), TW(-0.22059769010887398, 0.9753648851166569),
+    TW(-0.2191012401568701, 0.9757021300385285), TW(-0.21760427463848378, 0.976037079039039),
+    TW(-0.2161067970762195, 0.9763697313300211), TW(-0.21460881099378662, 0.9767000861287118),
+    TW(-0.21311031991609192, 0.9770281426577543), TW(-0.21161132736922797, 0.9773539001452),
+    TW(-0.21011183688046986, 0.9776773578245099), TW(-0.20861185197826357, 0.977998514934557),
+    TW(-0.20711137619221848, 0.9783173707196277), TW(-0.20561041305309902, 0.9786339244294232),
+    TW(-0.20410896609281734, 0.9789481753190621), TW(-0.20260703884442144, 0.979260122649082),
+    TW(-0.20110463484209207, 0.9795697656854405), TW(-0.19960175762113097, 0.9798771036995176),
+    TW(-0.19809841071795342, 0.9801821359681174), TW(-0.19659459767008078, 0.9804848617734693),
+    TW(-0.19509032201612866, 0.9807852804032303), TW(-0.19358558729580386, 0.9810833911504866),
+    TW(-0.19208039704989252, 0.9813791933137546), TW(-0.19057475482025268, 0.9816726861969831),
+    TW(-0.18906866414980597, 0.9819638691095554), TW(-0.18756212858253007, 0.9822527413662894),
+    TW(-0.18605515166344697, 0.9825393022874412), TW(-0.18454773693861978, 0.9828235511987052),
+    TW(-0.18303988795514095, 0.9831054874312163), TW(-0.18153160826112483, 0.9833851103215513),
+    TW(-0.18002290140570007, 0.9836624192117301), TW(-0.17851377093899792, 0.9839374134492188),
+    TW(-0.177004220412149, 0.984210092386929), TW(-0.1754942533772715, 0.9844804553832209),
+    TW(-0.17398387338746374, 0.9847485018019042), TW(-0.17247308399679573, 0.9850142310122398),
+    TW(-0.1709618887603017, 0.9852776423889411), TW(-0.1694502912339683, 0.9855387353121761),
+    TW(-0.16793829497473134, 0.9857975091675674), TW(-0.1664259035404641, 0.9860539633461954),
+    TW(-0.16491312048996976, 0.9863080972445987), TW(-0.16339994938297378, 0.9865599102647754),
+    TW(-0.16188639378011224, 0.9868094018141854), TW(-0.1603724572429285, 0.987056571305751),
+    TW(-0.15885814333386153, 0.9873014181578583), TW(-0.1573434556162382, 0.9875439417943593),
+    TW(-0.15582839765426498, 0.9877841416445722), TW(-0.15431297301302058, 0.9880220171432835),
+    TW(-0.15279718525844374, 0.9882575677307495), TW(-0.1512810379573304, 0.9884907928526966),
+    TW(-0.1497645346773215, 0.9887216919603238), TW(-0.1482476789868959, 0.988950264510303),
+    TW(-0.1467304744553623, 0.9891765099647809), TW(-0.14521292465284785, 0.9894004277913803),
+    TW(-0.1436950331502947, 0.9896220174632008), TW(-0.14217680351944814, 0.9898412784588205),
+    TW(-0.14065823933284916, 0.9900582102622971), TW(-0.13913934416382598, 0.9902728123631691),
+    TW(-0.13762012158648654, 0.990485084256457), TW(-0.13610057517570653, 0.9906950254426646),
+    TW(-0.13458070850712636, 0.99090263542778), TW(-0.13306052515713906, 0.9911079137232769),
+    TW(-0.13154002870288295, 0.9913108598461154), TW(-0.13001922272223393, 0.9915114733187439),
+    TW(-0.12849811079379359, 0.9917097536690995), TW(-0.12697669649688612, 0.9919057004306093),
+    TW(-0.12545498341154632, 0.9920993131421918), TW(-0.12393297511851209, 0.9922905913482574),
+    TW(-0.12241067519921596, 0.9924795345987101), TW(-0.12088808723577757, 0.9926661424489479),
+    TW(-0.11936521481099169, 0.9928504144598651), TW(-0.11784206150832514, 0.9930323501978514),
+    TW(-0.11631863091190477, 0.9932119492347945), TW(-0.11479492660650993, 0.9933892111480807),
+    TW(-0.11327095217756492, 0.9935641355205953), TW(-0.111746711211127, 0.9937367219407246),
+    TW(-0.11022220729388331, 0.9939069700023561), TW(-0.1086974440131388, 0.9940748793048794),
+    TW(-0.10717242495680877, 0.9942404494531879), TW(-0.10564715371341038, 0.9944036800576791),
+    TW(-0.10412163387205507, 0.9945645707342554), TW(-0.10259586902243661, 0.9947231211043257),
+    TW(-0.10106986275482799, 0.9948793307948056), TW(-0.09954361866006935, 0.9950331994381186),
+    TW(-0.09801714032956045, 0.9951847266721969), TW(-0.09649043135525316, 0.9953339121404822),
+    TW(-0.09496349532963941, 0.9954807554919269), TW(-0.09343633584574804, 0.9956252563809943),
+    TW(-0.09190895649713282, 0.9957674144676598), TW(-0.09038136087786491, 0.9959072294174117),
+    TW(-0.08885355258252436, 0.996044700901252), TW(-0.08732553520619256, 0.9961798285956969),
+    TW(-0.08579731234444023, 0.996312612182778), TW(-0.08426888759332424, 0.9964430513500426),
+    TW(-0.0827402645493757, 0.9965711457905548), TW(-0.08121144680959229, 0.9966968952028961),
+    TW(-0.0796824379714307, 0.9968202992911657), TW(-0.07815324163279465, 0.996941357764982),
+    TW(-0.07662386139203174, 0.997060070339483), TW(-0.0750943008479214, 0.9971764367353261),
+    TW(-0.07356456359966736, 0.9972904566786902), TW(-0.0720346532468891, 0.9974021299012753),
+    TW(-0.07050457338961436, 0.9975114561403035), TW(-0.06897432762826708, 0.9976184351385196),
+    TW(-0.06744391956366423, 0.9977230666441916), TW(-0.06591335279700383, 0.9978253504111116),
+    TW(-0.06438263092985731, 0.997925286198596), TW(-0.06285175756416199, 0.9980228737714861),
+    TW(-0.061320736302208995, 0.9981181129001492), TW(-0.05978957074664013, 0.9982110033604782),
+    TW(-0.058258264500435857, 0.9983015449338928), TW(-0.056726821166907686, 0.9983897374073402),
+    TW(-0.05519524434968971, 0.9984755805732948), TW(-0.053663537652731026, 0.9985590742297593),
+    TW(-0.05213170468028366, 0.9986402181802652), TW(-0.050599749036899455, 0.9987190122338729),
+    TW(-0.04906767432741803, 0.9987954562051724), TW(-0.04753548415695916, 0.9988695499142836),
+    TW(-0.046003182130915206, 0.9989412931868569), TW(-0.044470771854939084, 0.9990106858540733),
+    TW(-0.042938256934941084, 0.9990777277526454), TW(-0.04140564097707684, 0.9991424187248169),
+    TW(-0.03987292758773975, 0.9992047586183639), TW(-0.03834012037355247, 0.9992647472865944),
+    TW(-0.03680722294135933, 0.9993223845883494), TW(-0.035274238898214294, 0.9993776703880028),
+    TW(-0.03374117185137776, 0.9994306045554617), TW(-0.0322080254083046, 0.999481186966167),
+    TW(-0.030674803176636484, 0.9995294175010931), TW(-0.02914150876419431, 0.9995752960467492),
+    TW(-0.027608145778966163, 0.9996188224951786), TW(-0.02607471782910416, 0.9996599967439592),
+    TW(-0.02454122852291239, 0.9996988186962042), TW(-0.02300768146883931, 0.9997352882605617),
+    TW(-0.021474080275469286, 0.9997694053512153), TW(-0.019940428551514944, 0.9998011698878843),
+    TW(-0.018406729905805164, 0.9998305817958234), TW(-0.016872987947281894, 0.9998576410058239),
+    TW(-0.015339206284988121, 0.9998823474542126), TW(-0.01380538852806025, 0.9999047010828529),
+    TW(-0.012271538285720512, 0.9999247018391445), TW(-0.010737659167264916, 0.9999423496760239),
+    TW(-0.009203754782060083, 0.9999576445519639), TW(-0.007669828739531199, 0.9999705864309741),
+    TW(-0.006135884649154416, 0.9999811752826011), TW(-0.00460192612044835, 0.9999894110819284),
+    TW(-0.0030679567629664827, 0.9999952938095762), TW(-0.0015339801862851105, 0.9999988234517019),
+    TW(-1.8369701987210297e-16, 1.0), TW(0.0015339801862847432, 0.9999988234517019),
+    TW(0.003067956762966115, 0.9999952938095762), TW(0.004601926120447982, 0.9999894110819284),
+    TW(0.0061358846491540485, 0.9999811752826011), TW(0.007669828739530832, 0.9999705864309741),
+    TW(0.009203754782059715, 0.9999576445519639), TW(0.010737659167264548, 0.9999423496760239),
+    TW(0.012271538285720144, 0.9999247018391445), TW(0.013805388528059882, 0.9999047010828529),
+    TW(0.015339206284987753, 0.9998823474542126), TW(0.016872987947281527, 0.9998576410058239),
+    TW(0.018406729905804796, 0.9998305817958234), TW(0.019940428551514577, 0.9998011698878843),
+    TW(0.021474080275468918, 0.9997694053512153), TW(0.023007681468838945, 0.9997352882605617),
+    TW(0.02454122852291202, 0.9996988186962042), TW(0.026074717829103793, 0.9996599967439592),
+    TW(0.027608145778965795, 0.9996188224951786), TW(0.02914150876419394, 0.9995752960467492),
+    TW(0.030674803176636116, 0.9995294175010931), TW(0.03220802540830423, 0.999481186966167),
+    TW(0.0337411718513774, 0.9994306045554617), TW(0.035274238898213926, 0.9993776703880028),
+    TW(0.036807222941358964, 0.9993223845883495), TW(0.038340120373552104, 0.9992647472865945),
+    TW(0.03987292758773938, 0.9992047586183639), TW(0.04140564097707647, 0.9991424187248169),
+    TW(0.042938256934940716, 0.9990777277526454), TW(0.044470771854938716, 0.9990106858540734),
+    TW(0.046003182130914845, 0.9989412931868569), TW(0.04753548415695879, 0.9988695499142836),
+    TW(0.04906767432741766, 0.9987954562051724), TW(0.05059974903689909, 0.9987190122338729),
+    TW(0.05213170468028329, 0.9986402181802653), TW(0.05366353765273066, 0.9985590742297593),
+    TW(0.055195244349689344, 0.9984755805732948), TW(0.05672682116690732, 0.9983897374073402),
+    TW(0.05825826450043549, 0.9983015449338929), TW(0.059789570746639764, 0.9982110033604782),
+    TW(0.06132073630220863, 0.9981181129001492), TW(0.06285175756416163, 0.9980228737714862),
+    TW(0.06438263092985695, 0.997925286198596), TW(0.06591335279700346, 0.9978253504111116),
+    TW(0.06744391956366387, 0.9977230666441916), TW(0.06897432762826672, 0.9976184351385196),
+    TW(0.070504573389614, 0.9975114561403035), TW(0.07203465324688872, 0.9974021299012753),
+    TW(0.07356456359966698, 0.9972904566786902), TW(0.07509430084792104, 0.9971764367353262),
+    TW(0.07662386139203138, 0.997060070339483), TW(0.07815324163279429, 0.9969413577649822),
+    TW(0.07968243797143033, 0.9968202992911657), TW(0.08121144680959191, 0.9966968952028961),
+    TW(0.08274026454937533, 0.9965711457905548), TW(0.08426888759332388, 0.9964430513500426),
+    TW(0.08579731234443985, 0.996312612182778), TW(0.0873255352061922, 0.9961798285956969),
+    TW(0.088853552582524, 0.9960447009012521), TW(0.09038136087786454, 0.9959072294174117),
+    TW(0.09190895649713245, 0.9957674144676598), TW(0.09343633584574766, 0.9956252563809943),
+    TW(0.09496349532963905, 0.9954807554919269), TW(0.0964904313552528, 0.9953339121404823),
+    TW(0.09801714032956009, 0.9951847266721969), TW(0.09954361866006897, 0.9950331994381186),
+    TW(0.10106986275482763, 0.9948793307948056), TW(0.10259586902243625, 0.9947231211043257),
+    TW(0.1041216338720547, 0.9945645707342554), TW(0.10564715371341002, 0.9944036800576791),
+    TW(0.10717242495680841, 0.994240449453188), TW(0.10869744401313844, 0.9940748793048795),
+    TW(0.11022220729388293, 0.9939069700023561), TW(0.11174671121112664, 0.9937367219407246),
+    TW(0.11327095217756455, 0.9935641355205953), TW(0.11479492660650957, 0.9933892111480808),
+    TW(0.1163186309119044, 0.9932119492347946), TW(0.11784206150832478, 0.9930323501978514),
+    TW(0.11936521481099133, 0.9928504144598651), TW(0.1208880872357772, 0.992666142448948),
+    TW(0.1224106751992156, 0.9924795345987101), TW(0.12393297511851173, 0.9922905913482574),
+    TW(0.12545498341154596, 0.9920993131421918), TW(0.12697669649688575, 0.9919057004306093),
+    TW(0.12849811079379322, 0.9917097536690995), TW(0.13001922272223354, 0.9915114733187439),
+    TW(0.1315400287028826, 0.9913108598461154), TW(0.1330605251571387, 0.9911079137232769),
+    TW(0.13458070850712597, 0.99090263542778), TW(0.13610057517570617, 0.9906950254426646),
+    TW(0.13762012158648618, 0.990485084256457), TW(0.13913934416382562, 0.9902728123631692),
+    TW(0.1406582393328488, 0.9900582102622971), TW(0.14217680351944778, 0.9898412784588205),
+    TW(0.14369503315029433, 0.9896220174632009), TW(0.1452129246528475, 0.9894004277913804),
+    TW(0.14673047445536194, 0.9891765099647809), TW(0.14824767898689553, 0.9889502645103031),
+    TW(0.14976453467732115, 0.9887216919603238), TW(0.15128103795733, 0.9884907928526967),
+    TW(0.15279718525844338, 0.9882575677307495), TW(0.15431297301302022, 0.9880220171432835),
+    TW(0.15582839765426462, 0.9877841416445723), TW(0.1573434556162378, 0.9875439417943593),
+    TW(0.15885814333386117, 0.9873014181578584), TW(0.16037245724292815, 0.9870565713057511),
+    TW(0.16188639378011188, 0.9868094018141854), TW(0.16339994938297342, 0.9865599102647754),
+    TW(0.1649131204899694, 0.9863080972445988), TW(0.16642590354046374, 0.9860539633461955),
+    TW(0.16793829497473098, 0.9857975091675675), TW(0.16945029123396793, 0.9855387353121761),
+    TW(0.17096188876030133, 0.9852776423889412), TW(0.17247308399679537, 0.98501423101224),
+    TW(0.17398387338746338, 0.9847485018019043), TW(0.17549425337727115, 0.9844804553832209),
+    TW(0.17700422041214864, 0.9842100923869291), TW(0.17851377093899756, 0.9839374134492189),
+    TW(0.1800229014056997, 0.9836624192117303), TW(0.18153160826112447, 0.9833851103215513),
+    TW(0.1830398879551406, 0.9831054874312164), TW(0.18454773693861942, 0.9828235511987053),
+    TW(0.1860551516634466, 0.9825393022874412), TW(0.1875621285825297, 0.9822527413662894),
+    TW(0.1890686641498056, 0.9819638691095554), TW(0.19057475482025232, 0.9816726861969832),
+    TW(0.19208039704989216, 0.9813791933137547), TW(0.1935855872958035, 0.9810833911504867),
+    TW(0.1950903220161283, 0.9807852804032304), TW(0.19659459767008042, 0.9804848617734693),
+    TW(0.19809841071795306, 0.9801821359681175), TW(0.1996017576211306, 0.9798771036995177),
+    TW(0.2011046348420917, 0.9795697656854406), TW(0.20260703884442108, 0.979260122649082),
+    TW(0.20410896609281698, 0.9789481753190622), TW(0.20561041305309866, 0.9786339244294233),
+    TW(0.20711137619221812, 0.9783173707196278), TW(0.2086118519782632, 0.9779985149345571),
+    TW(0.2101118368804695, 0.97767735782451), TW(0.2116113273692276, 0.9773539001452),
+    TW(0.21311031991609156, 0.9770281426577543), TW(0.21460881099378626, 0.976700086128712),
+    TW(0.21610679707621913, 0.9763697313300213), TW(0.21760427463848342, 0.9760370790390391),
+    TW(0.21910124015686974, 0.9757021300385286), TW(0.22059769010887362, 0.975364885116657),
+    TW(0.22209362097320293, 0.9750253450669942), TW(0.22358902922978954, 0.9746835106885108),
+    TW(0.22508391135979255, 0.974339382785576), TW(0.22657826384560986, 0.973992962167956),
+    TW(0.22807208317088576, 0.9736442496508119), TW(0.22956536582051906, 0.9732932460546981),
+    TW(0.23105810828067058, 0.9729399522055603), TW(0.23255030703877488, 0.9725843689347323),
+    TW(0.2340419585835432, 0.9722264970789364), TW(0.23553305940497546, 0.9718663374802794),
+    TW(0.2370236059943673, 0.9715038909862518), TW(0.23851359484431783, 0.9711391584497253),
+    TW(0.24000302244874103, 0.9707721407289505), TW(0.24149188530286905, 0.9704028386875555),
+    TW(0.24298017990326376, 0.970031253194544), TW(0.24446790274782418, 0.9696573851242924),
+    TW(0.2459550503357948, 0.9692812353565484), TW(0.24744161916777277, 0.968902804776429),
+    TW(0.2489276057457198, 0.9685220942744174), TW(0.25041300657296506, 0.9681391047463624),
+    TW(0.2518978181542169, 0.9677538370934755), TW(0.25338203699557027, 0.9673662922223285),
+    TW(0.25486565960451396, 0.9669764710448523), TW(0.25634868248994247, 0.9665843744783332),
+    TW(0.2578311021621587, 0.9661900034454126), TW(0.2593129151328861, 0.9657933588740837),
+    TW(0.2607941179152755, 0.9653944416976894), TW(0.2622747070239138, 0.9649932528549203),
+    TW(0.26375467897483085, 0.9645897932898129), TW(0.26523403028551146, 0.9641840639517459),
+    TW(0.2667127574748982, 0.96377606579544), TW(0.2681908570634031, 0.963365799780954),
+    TW(0.2696683255729152, 0.9629532668736839), TW(0.2711451595268074, 0.9625384680443594),
+    TW(0.27262135544994853, 0.9621214042690417), TW(0.2740969098687061, 0.9617020765291227),
+    TW(0.27557181931095803, 0.9612804858113206), TW(0.27704608030609995, 0.9608566331076797),
+    TW(0.2785196893850533, 0.9604305194155658), TW(0.2799926430802727, 0.9600021457376661),
+    TW(0.2814649379257576, 0.9595715130819846), TW(0.2829365704570551, 0.959138622461842),
+    TW(0.28440753721127177, 0.9587034748958716), TW(0.28587783472708067, 0.9582660714080177),
+    TW(0.2873474595447289, 0.957826413027533), TW(0.28881640820604904, 0.9573845007889761),
+    TW(0.29028467725446205, 0.9569403357322089), TW(0.29175226323498915, 0.9564939189023951),
+    TW(0.2932191626942587, 0.9560452513499964), TW(0.2946853721805145, 0.955594334130771),
+    TW(0.2961508882436233, 0.9551411683057709), TW(0.29761570743508586, 0.9546857549413384),
+    TW(0.29907982630804025, 0.9542280951091057), TW(0.3005432414172734, 0.9537681898859903),
+    TW(0.30200594931922814, 0.9533060403541939), TW(0.3034679465720107, 0.9528416476011988),
+    TW(0.304929229735402, 0.952375012719766), TW(0.30638979537086064, 0.9519061368079325),
+    TW(0.30784964004153476, 0.9514350209690084), TW(0.3093087603122687, 0.9509616663115751),
+    TW(0.31076715274961164, 0.9504860739494817), TW(0.3122248139218244, 0.9500082450018432),
+    TW(0.31368174039889113, 0.9495281805930368), TW(0.31513792875252217, 0.9490458818527007),
+    TW(0.3165933755561658, 0.9485613499157303), TW(0.318048077385015, 0.9480745859222762),
+    TW(0.3195020308160151, 0.9475855910177413), TW(0.32095523242787477, 0.9470943663527773),
+    TW(0.3224076788010696, 0.9466009130832836), TW(0.32385936651785274, 0.9461052323704034),
+    TW(0.3253102921622629, 0.9456073253805213), TW(0.32676045232013196, 0.9451071932852605),
+    TW(0.328209843579092, 0.9446048372614805), TW(0.32965846252858716, 0.9441002584912728),
+    TW(0.3311063057598762, 0.9435934581619604), TW(0.33255336986604417, 0.9430844374660935),
+    TW(0.3339996514420095, 0.9425731976014469), TW(0.33544514708453105, 0.9420597397710175),
+    TW(0.3368898533922196, 0.9415440651830209), TW(0.33833376696554085, 0.9410261750508894),
+    TW(0.33977688440682674, 0.9405060705932684), TW(0.3412192023202824, 0.9399837530340139),
+    TW(0.34266071731199454, 0.9394592236021898), TW(0.3441014259899383, 0.9389324835320647),
+    TW(0.3455413249639887, 0.9384035340631083), TW(0.34698041084592346, 0.9378723764399899),
+    TW(0.3484186802494345, 0.937339011912575), TW(0.34985612979013503, 0.9368034417359216),
+    TW(0.35129275608556654, 0.9362656671702785), TW(0.3527285557552103, 0.9357256894810805),
+    TW(0.35416352542049007, 0.9351835099389477), TW(0.35559766170478374, 0.9346391298196808),
+    TW(0.35703096123343003, 0.9340925504042589), TW(0.3584634206337367, 0.9335437729788362),
+    TW(0.3598950365349876, 0.9329927988347391), TW(0.3613258055684539, 0.9324396292684626),
+    TW(0.362755724367397, 0.9318842655816681), TW(0.36418478956707984, 0.9313267090811805),
+    TW(0.36561299780477396, 0.9307669610789837), TW(0.36704034571976657, 0.9302050228922193),
+    TW(0.3684668299533719, 0.9296408958431814), TW(0.3698924471489338, 0.929074581259316),
+    TW(0.3713171939518374, 0.9285060804732156), TW(0.3727410670095158, 0.9279353948226179),
+    TW(0.37416406297145816, 0.927362525650401), TW(0.3755861784892167, 0.926787474304582),
+    TW(0.37700741021641787, 0.9262102421383115), TW(0.37842775480876534, 0.9256308305098728),
+    TW(0.3798472089240511, 0.9250492407826776), TW(0.38126576922216243, 0.9244654743252626),
+    TW(0.38268343236509, 0.9238795325112866), TW(0.3841001950169346, 0.9232914167195279),
+    TW(0.38551605384391857, 0.9227011283338787), TW(0.38693100551438847, 0.9221086687433452),
+    TW(0.3883450466988263, 0.9215140393420419), TW(0.38975817406985663, 0.9209172415291894),
+    TW(0.39117038430225337, 0.9203182767091108), TW(0.39258167407295114, 0.9197171462912275),
+    TW(0.3939920400610479, 0.9191138516900579), TW(0.39540147894781624, 0.9185083943252123),
+    TW(0.3968099874167104, 0.9179007756213904), TW(0.39821756215337384, 0.9172909970083778),
+    TW(0.3996241998456464, 0.9166790599210428), TW(0.40102989718357535, 0.9160649657993318),
+    TW(0.4024346508594183, 0.9154487160882678), TW(0.40383845756765413, 0.9148303122379462),
+    TW(0.40524131400499, 0.9142097557035306), TW(0.4066432168703685, 0.913587047945251),
+    TW(0.4080441628649783, 0.9129621904283983), TW(0.40944414869225737, 0.9123351846233229),
+    TW(0.41084317105790386, 0.9117060320054299), TW(0.41224122666988294, 0.9110747340551762),
+    TW(0.4136383122384348, 0.9104412922580671), TW(0.4150344244760812, 0.9098057081046524),
+    TW(0.4164295600976369, 0.9091679830905225), TW(0.41782371582021216, 0.9085281187163062),
+    TW(0.41921688836322396, 0.9078861164876663), TW(0.4206090744484027, 0.9072419779152958),
+    TW(0.4220002707997992, 0.9065957045149156), TW(0.42339047414379566, 0.9059472978072687),
+    TW(0.4247796812091086, 0.9052967593181189), TW(0.42616788872679956, 0.9046440905782462),
+    TW(0.42755509343028214, 0.9039892931234433), TW(0.4289412920553297, 0.9033323684945117),
+    TW(0.43032648134008217, 0.902673318237259), TW(0.431710658025057, 0.9020121439024933),
+    TW(0.4330938188531518, 0.9013488470460221), TW(0.4344759605696557, 0.9006834292286469),
+    TW(0.43585707992225564, 0.9000158920161602), TW(0.4372371736610436, 0.8993462369793418),
+    TW(0.43861623853852727, 0.898674465693954), TW(0.43999427130963303, 0.89800057974074),
+    TW(0.4413712687317166, 0.8973245807054183), TW(0.4427472275645701, 0.8966464701786802),
+    TW(0.4441221445704294, 0.895966249756185), TW(0.4454960165139813, 0.8952839210385577),
+    TW(0.4468688401623739, 0.8945994856313828), TW(0.4482406122852198, 0.8939129451452034),
+    TW(0.4496113296546066, 0.8932243011955153), TW(0.45098098904510403, 0.8925335554027646),
+    TW(0.4523495872337704, 0.891840709392343), TW(0.4537171210001635, 0.8911457647945834),
+    TW(0.4550835871263436, 0.890448723244758), TW(0.45644898239688386, 0.8897495863830729),
+    TW(0.4578133035988773, 0.8890483558546646), TW(0.45917654752194437, 0.8883450333095962),
+    TW(0.46053871095823956, 0.8876396204028542), TW(0.46189979070246245, 0.8869321187943423),
+    TW(0.46325978355186004, 0.8862225301488807), TW(0.4646186863062378, 0.8855108561362),
+    TW(0.4659764957679663, 0.8847970984309377), TW(0.4673332087419879, 0.8840812587126353),
+    TW(0.46868882203582757, 0.8833633386657318), TW(0.4700433324595954, 0.8826433399795629),
+    TW(0.4713967368259976, 0.881921264348355), TW(0.47274903195034285, 0.881197113471222),
+    TW(0.47410021465055024, 0.8804708890521606), TW(0.4754502817471555, 0.8797425928000476),
+    TW(0.47679923006332187, 0.8790122264286336), TW(0.4781470564248429, 0.8782797916565416),
+    TW(0.479493757660153, 0.8775452902072614), TW(0.48083933060033407, 0.8768087238091457),
+    TW(0.4821837720791222, 0.8760700941954069), TW(0.48352707893291835, 0.875329403104111),
+    TW(0.4848692480007909, 0.8745866522781762), TW(0.4862102761244863, 0.8738418434653669),
+    TW(0.487550160148436, 0.8730949784182901), TW(0.4888888969197634, 0.8723460588943914),
+    TW(0.4902264832882907, 0.8715950866559513), TW(0.4915629161065497, 0.8708420634700791),
+    TW(0.49289819222978387, 0.8700869911087115), TW(0.49423230851595973, 0.8693298713486067),
+    TW(0.49556526182577265, 0.8685707059713408), TW(0.496897049022654, 0.8678094967633035),
+    TW(0.4982276669727815, 0.8670462455156929), TW(0.49955711254508167, 0.8662809540245131),
+    TW(0.5008853826112407, 0.8655136240905691), TW(0.5022124740457109, 0.8647442575194624),
+    TW(0.5035383837257178, 0.8639728561215866), TW(0.5048631085312671, 0.8631994217121244),
+    TW(0.506186645345155, 0.8624239561110407), TW(0.5075089910529706, 0.8616464611430814),
+    TW(0.508830142543107, 0.8608669386377673), TW(0.5101500967067669, 0.8600853904293901),
+    TW(0.5114688504379699, 0.8593018183570087), TW(0.5127864006335626, 0.858516224264443),
+    TW(0.5141027441932216, 0.8577286100002722), TW(0.5154178780194629, 0.8569389774178288),
+    TW(0.51673179901765, 0.8561473283751945), TW(0.5180445040959996, 0.8553536647351959),
+    TW(0.5193559901655892, 0.8545579883654008), TW(0.5206662541403668, 0.8537603011381115),
+    TW(0.5219752929371542, 0.8529606049303637), TW(0.5232831034756564, 0.8521589016239198),
+    TW(0.5245896826784691, 0.8513551931052651), TW(0.5258950274710842, 0.8505494812656037),
+    TW(0.527199134781901, 0.8497417680008527), TW(0.5285020015422283, 0.8489320552116397),
+    TW(0.5298036246862946, 0.8481203448032973), TW(0.531104001151255, 0.8473066386858583),
+    TW(0.5324031278771981, 0.846490938774052), TW(0.5337010018071525, 0.8456732469872993),
+    TW(0.5349976198870969, 0.8448535652497072), TW(0.536292979065963, 0.8440318954900665),
+    TW(0.5375870762956455, 0.8432082396418454), TW(0.5388799085310085, 0.8423825996431858),
+    TW(0.5401714727298924, 0.8415549774368988), TW(0.5414617658531231, 0.8407253749704583),
+    TW(0.5427507848645157, 0.8398937941959996), TW(0.5440385267308838, 0.8390602370703127),
+    TW(0.5453249884220465, 0.838224705554838), TW(0.5466101669108351, 0.8373872016156618),
+    TW(0.5478940591730997, 0.8365477272235122), TW(0.5491766621877194, 0.8357062843537527),
+    TW(0.5504579729366047, 0.8348628749863801), TW(0.5517379884047074, 0.8340175011060181),
+    TW(0.5530167055800277, 0.8331701647019131), TW(0.5542941214536197, 0.83232086776793),
+    TW(0.5555702330196018, 0.8314696123025455), TW(0.5568450372751599, 0.8306164003088464),
+    TW(0.558118531220556, 0.8297612337945232), TW(0.5593907118591361, 0.8289041147718649),
+    TW(0.5606615761973363, 0.8280450452577557), TW(0.561931121244689, 0.8271840272736694),
+    TW(0.5631993440138339, 0.8263210628456636), TW(0.5644662415205193, 0.8254561540043777),
+    TW(0.5657318107836131, 0.8245893027850253), TW(0.5669960488251088, 0.8237205112273913),
+    TW(0.568258952670131, 0.8228497813758266), TW(0.5695205193469468, 0.8219771152792418),
+    TW(0.570780745886967, 0.8211025149911049), TW(0.5720396293247569, 0.8202259825694347),
+    TW(0.5732971666980422, 0.8193475200767969), TW(0.574553355047716, 0.8184671295802985),
+    TW(0.5758081914178449, 0.817584813151584), TW(0.5770616728556792, 0.816700572866828),
+    TW(0.5783137964116554, 0.8158144108067339), TW(0.5795645591394057, 0.8149263290565266),
+    TW(0.5808139580957646, 0.8140363297059483), TW(0.5820619903407751, 0.8131444148492539),
+    TW(0.583308652937698, 0.8122505865852042), TW(0.5845539429530151, 0.811354847017064),
+    TW(0.5857978574564388, 0.8104571982525949), TW(0.5870403935209181, 0.8095576424040513),
+    TW(0.5882815482226454, 0.8086561815881749), TW(0.5895213186410635, 0.8077528179261907),
+    TW(0.5907597018588739, 0.8068475535437994), TW(0.5919966949620408, 0.8059403905711764),
+    TW(0.5932322950397998, 0.8050313311429637), TW(0.5944664991846645, 0.8041203773982657),
+    TW(0.5956993044924329, 0.8032075314806453), TW(0.5969307080621962, 0.8022927955381159),
+    TW(0.598160706996342, 0.8013761717231404), TW(0.5993892984005644, 0.8004576621926228),
+    TW(0.600616479383869, 0.799537269107905), TW(0.6018422470585802, 0.7986149946347607),
+    TW(0.6030665985403478, 0.7976908409433914), TW(0.6042895309481557, 0.7967648102084189),
+    TW(0.6055110414043253, 0.7958369046088837), TW(0.6067311270345245, 0.794907126328237),
+    TW(0.6079497849677737, 0.7939754775543371), TW(0.6091670123364527, 0.7930419604794441),
+    TW(0.6103828062763091, 0.7921065773002126), TW(0.6115971639264617, 0.7911693302176903),
+    TW(0.6128100824294096, 0.7902302214373101), TW(0.6140215589310385, 0.7892892531688857),
+    TW(0.615231590580627, 0.7883464276266061), TW(0.6164401745308532, 0.7874017470290318),
+    TW(0.6176473079378036, 0.786455213599086), TW(0.6188529879609762, 0.785506829564054),
+    TW(0.6200572117632891, 0.7845565971555752), TW(0.6212599765110877, 0.7836045186096382),
+    TW(0.6224612793741495, 0.7826505961665761), TW(0.6236611175256942, 0.7816948320710597),
+    TW(0.6248594881423861, 0.7807372285720946), TW(0.6260563884043434, 0.7797777879230146),
+    TW(0.6272518154951442, 0.778816512381476), TW(0.6284457666018328, 0.7778534042094529),
+    TW(0.6296382389149267, 0.7768884656732328), TW(0.6308292296284242, 0.7759216990434078),
+    TW(0.6320187359398088, 0.774953106594874), TW(0.6332067550500572, 0.7739826906068228),
+    TW(0.6343932841636456, 0.7730104533627369), TW(0.6355783204885557, 0.7720363971503849),
+    TW(0.6367618612362839, 0.771060524261814), TW(0.6379439036218438, 0.7700828369933481),
+    TW(0.6391244448637756, 0.7691033376455797), TW(0.6403034821841517, 0.7681220285233654),
+    TW(0.6414810128085833, 0.7671389119358203), TW(0.6426570339662264, 0.7661539901963133),
+    TW(0.6438315428897912, 0.7651672656224592), TW(0.6450045368155438, 0.7641787405361169),
+    TW(0.6461760129833163, 0.7631884172633813), TW(0.6473459686365122, 0.7621962981345789),
+    TW(0.648514401022112, 0.7612023854842622), TW(0.6496813073906829, 0.7602066816512028),
+    TW(0.6508466849963807, 0.7592091889783882), TW(0.6520105310969595, 0.7582099098130154),
+    TW(0.6531728429537768, 0.7572088465064846), TW(0.6543336178318007, 0.7562060014143944),
+    TW(0.655492852999615, 0.7552013768965369), TW(0.6566505457294287, 0.7541949753168894),
+    TW(0.6578066932970785, 0.7531867990436126), TW(0.6589612929820373, 0.7521768504490427),
+    TW(0.6601143420674206, 0.7511651319096864), TW(0.6612658378399917, 0.7501516458062154),
+    TW(0.6624157775901715, 0.7491363945234596), TW(0.6635641586120395, 0.7481193804504037),
+    TW(0.6647109782033448, 0.7471006059801802), TW(0.6658562336655097, 0.7460800735100638),
+    TW(0.6669999223036377, 0.7450577854414658), TW(0.6681420414265181, 0.7440337441799296),
+    TW(0.6692825883466358, 0.7430079521351219), TW(0.670421560380173, 0.7419804117208312),
+    TW(0.6715589548470183, 0.7409511253549591), TW(0.672694769070773, 0.7399200954595161),
+    TW(0.6738290003787556, 0.7388873244606156), TW(0.6749616461020117, 0.7378528147884663),
+    TW(0.6760927035753157, 0.73681656887737), TW(0.6772221701371803, 0.7357785891657136),
+    TW(0.6783500431298615, 0.7347388780959634), TW(0.6794763198993652, 0.7336974381146601),
+    TW(0.6806009977954527, 0.7326542716724131), TW(0.6817240741716495, 0.7316093812238929),
+    TW(0.682845546385248, 0.7305627692278277), TW(0.6839654117973154, 0.729514438146997),
+    TW(0.6850836677727005, 0.7284643904482251), TW(0.6862003116800381, 0.7274126286023762),
+    TW(0.6873153408917588, 0.7263591550843463), TW(0.6884287527840902, 0.725303972373061),
+    TW(0.6895405447370668, 0.724247082951467), TW(0.6906507141345347, 0.7231884893065273),
+    TW(0.6917592583641579, 0.7221281939292152), TW(0.6928661748174243, 0.7210661993145084),
+    TW(0.6939714608896538, 0.7200025079613819), TW(0.6950751139800008, 0.7189371223728046),
+    TW(0.6961771314914629, 0.7178700450557318), TW(0.6972775108308866, 0.7168012785210994),
+    TW(0.6983762494089724, 0.715730825283819), TW(0.6994733446402834, 0.7146586878627693),
+    TW(0.7005687939432481, 0.7135848687807937), TW(0.7016625947401685, 0.7125093705646924),
+    TW(0.7027547444572253, 0.7114321957452164), TW(0.703845240524485, 0.7103533468570622),
+    TW(0.7049340803759045, 0.709272826438866), TW(0.7060212614493395, 0.7081906370331956),
+    TW(0.7071067811865474, 0.7071067811865477), TW(0.7081906370331953, 0.7060212614493399),
+    TW(0.7092728264388657, 0.7049340803759049), TW(0.7103533468570619, 0.7038452405244854),
+    TW(0.7114321957452161, 0.7027547444572256), TW(0.7125093705646921, 0.7016625947401687),
+    TW(0.7135848687807935, 0.7005687939432484), TW(0.7146586878627691, 0.6994733446402838),
+    TW(0.7157308252838188, 0.6983762494089727), TW(0.7168012785210991, 0.697277510830887),
+    TW(0.7178700450557315, 0.6961771314914632), TW(0.7189371223728043, 0.695075113980001),
+    TW(0.7200025079613815, 0.693971460889654), TW(0.7210661993145082, 0.6928661748174246),
+    TW(0.7221281939292149, 0.6917592583641582), TW(0.7231884893065271, 0.6906507141345349),
+    TW(0.7242470829514667, 0.6895405447370672), TW(0.7253039723730607, 0.6884287527840905),
+    TW(0.726359155084346, 0.687315340891759), TW(0.7274126286023759, 0.6862003116800385),
+    TW(0.7284643904482249, 0.6850836677727008), TW(0.7295144381469968, 0.6839654117973157),
+    TW(0.7305627692278274, 0.6828455463852482), TW(0.7316093812238925, 0.6817240741716498),
+    TW(0.7326542716724129, 0.680600997795453), TW(0.7336974381146598, 0.6794763198993655),
+    TW(0.7347388780959632, 0.6783500431298618), TW(0.7357785891657134, 0.6772221701371807),
+    TW(0.7368165688773698, 0.676092703575316), TW(0.737852814788466, 0.674961646102012),
+    TW(0.7388873244606152, 0.6738290003787559), TW(0.7399200954595158, 0.6726947690707733),
+    TW(0.7409511253549589, 0.6715589548470187), TW(0.7419804117208308, 0.6704215603801733),
+    TW(0.7430079521351216, 0.6692825883466361), TW(0.7440337441799293, 0.6681420414265185),
+    TW(0.7450577854414655, 0.666999922303638), TW(0.7460800735100634, 0.6658562336655101),
+    TW(0.7471006059801799, 0.6647109782033451), TW(0.7481193804504035, 0.6635641586120399),
+    TW(0.7491363945234594, 0.6624157775901718), TW(0.7501516458062152, 0.661265837839992),
+    TW(0.751165131909686, 0.6601143420674209), TW(0.7521768504490425, 0.6589612929820376),
+    TW(0.7531867990436123, 0.6578066932970789), TW(0.7541949753168891, 0.656650545729429),
+    TW(0.7552013768965365, 0.6554928529996153), TW(0.7562060014143941, 0.654333617831801),
+    TW(0.7572088465064842, 0.6531728429537771), TW(0.7582099098130151, 0.6520105310969597),
+    TW(0.759209188978388, 0.650846684996381), TW(0.7602066816512024, 0.6496813073906832),
+    TW(0.7612023854842619, 0.6485144010221123), TW(0.7621962981345786, 0.6473459686365125),
+    TW(0.763188417263381, 0.6461760129833166), TW(0.7641787405361166, 0.6450045368155441),
+    TW(0.7651672656224588, 0.6438315428897915), TW(0.7661539901963129, 0.6426570339662268),
+    TW(0.76713891193582, 0.6414810128085836), TW(0.7681220285233651, 0.640303482184152),
+    TW(0.7691033376455795, 0.639124444863776), TW(0.7700828369933479, 0.6379439036218442),
+    TW(0.7710605242618138, 0.6367618612362842), TW(0.7720363971503846, 0.635578320488556),
+    TW(0.7730104533627367, 0.6343932841636459), TW(0.7739826906068226, 0.6332067550500575),
+    TW(0.7749531065948737, 0.6320187359398092), TW(0.7759216990434076, 0.6308292296284246),
+    TW(0.7768884656732326, 0.629638238914927), TW(0.7778534042094527, 0.6284457666018332),
+    TW(0.7788165123814756, 0.6272518154951445), TW(0.7797777879230143, 0.6260563884043437),
+    TW(0.7807372285720944, 0.6248594881423865), TW(0.7816948320710594, 0.6236611175256945),
+    TW(0.7826505961665758, 0.6224612793741499), TW(0.7836045186096379, 0.621259976511088),
+    TW(0.784556597155575, 0.6200572117632895), TW(0.7855068295640538, 0.6188529879609765),
+    TW(0.7864552135990858, 0.617647307937804), TW(0.7874017470290314, 0.6164401745308535),
+    TW(0.7883464276266059, 0.6152315905806274), TW(0.7892892531688854, 0.6140215589310388),
+    TW(0.7902302214373098, 0.6128100824294099), TW(0.7911693302176901, 0.611597163926462),
+    TW(0.7921065773002124, 0.6103828062763095), TW(0.7930419604794438, 0.6091670123364531),
+    TW(0.7939754775543368, 0.6079497849677741), TW(0.7949071263282367, 0.6067311270345248),
+    TW(0.7958369046088833, 0.6055110414043257), TW(0.7967648102084187, 0.6042895309481561),
+    TW(0.7976908409433912, 0.6030665985403482), TW(0.7986149946347605, 0.6018422470585806),
+    TW(0.7995372691079048, 0.6006164793838693), TW(0.8004576621926226, 0.5993892984005648),
+    TW(0.8013761717231401, 0.5981607069963424), TW(0.8022927955381157, 0.5969307080621965),
+    TW(0.803207531480645, 0.5956993044924332), TW(0.8041203773982654, 0.5944664991846649),
+    TW(0.8050313311429633, 0.5932322950398001), TW(0.8059403905711762, 0.5919966949620411),
+    TW(0.8068475535437992, 0.5907597018588743), TW(0.8077528179261904, 0.5895213186410638),
+    TW(0.8086561815881746, 0.5882815482226458), TW(0.809557642404051, 0.5870403935209184),
+    TW(0.8104571982525947, 0.5857978574564391), TW(0.8113548470170636, 0.5845539429530154),
+    TW(0.8122505865852039, 0.5833086529376983), TW(0.8131444148492536, 0.5820619903407754),
+    TW(0.8140363297059481, 0.580813958095765), TW(0.8149263290565264, 0.5795645591394061),
+    TW(0.8158144108067337, 0.5783137964116558), TW(0.8167005728668277, 0.5770616728556796),
+    TW(0.8175848131515837, 0.5758081914178452), TW(0.8184671295802983, 0.5745533550477163),
+    TW(0.8193475200767967, 0.5732971666980426), TW(0.8202259825694345, 0.5720396293247574),
+    TW(0.8211025149911045, 0.5707807458869674), TW(0.8219771152792416, 0.5695205193469471),
+    TW(0.8228497813758264, 0.5682589526701314), TW(0.8237205112273911, 0.5669960488251091),
+    TW(0.8245893027850251, 0.5657318107836136), TW(0.8254561540043773, 0.5644662415205196),
+    TW(0.8263210628456634, 0.5631993440138342), TW(0.8271840272736691, 0.5619311212446894),
+    TW(0.8280450452577554, 0.5606615761973366), TW(0.8289041147718647, 0.5593907118591365),
+    TW(0.8297612337945228, 0.5581185312205564), TW(0.8306164003088462, 0.5568450372751602),
+    TW(0.8314696123025452, 0.5555702330196022), TW(0.8323208677679297, 0.55429412145362),
+    TW(0.8331701647019129, 0.553016705580028), TW(0.8340175011060179, 0.5517379884047078),
+    TW(0.8348628749863799, 0.550457972936605), TW(0.8357062843537525, 0.5491766621877198),
+    TW(0.836547727223512, 0.5478940591731001), TW(0.8373872016156616, 0.5466101669108354),
+    TW(0.8382247055548377, 0.5453249884220468), TW(0.8390602370703125, 0.5440385267308842),
+    TW(0.8398937941959994, 0.542750784864516), TW(0.8407253749704581, 0.5414617658531234),
+    TW(0.8415549774368984, 0.5401714727298927), TW(0.8423825996431855, 0.5388799085310089),
+    TW(0.8432082396418452, 0.5375870762956458), TW(0.8440318954900663, 0.5362929790659634),
+    TW(0.844853565249707, 0.5349976198870973), TW(0.8456732469872991, 0.5337010018071529),
+    TW(0.8464909387740517, 0.5324031278771986), TW(0.8473066386858581, 0.5311040011512554),
+    TW(0.8481203448032971, 0.5298036246862949), TW(0.8489320552116395, 0.5285020015422286),
+    TW(0.8497417680008524, 0.5271991347819014), TW(0.8505494812656035, 0.5258950274710845),
+    TW(0.8513551931052649, 0.5245896826784694), TW(0.8521589016239196, 0.5232831034756568),
+    TW(0.8529606049303635, 0.5219752929371545), TW(0.8537603011381113, 0.5206662541403673),
+    TW(0.8545579883654005, 0.5193559901655895), TW(0.8553536647351957, 0.5180445040959999),
+    TW(0.8561473283751942, 0.5167317990176503), TW(0.8569389774178285, 0.5154178780194633),
+    TW(0.857728610000272, 0.5141027441932219), TW(0.8585162242644427, 0.5127864006335631),
+    TW(0.8593018183570085, 0.5114688504379703), TW(0.8600853904293899, 0.5101500967067673),
+    TW(0.8608669386377671, 0.5088301425431074), TW(0.8616464611430812, 0.5075089910529711),
+    TW(0.8624239561110405, 0.5061866453451553), TW(0.8631994217121242, 0.5048631085312675),
+    TW(0.8639728561215864, 0.5035383837257181), TW(0.8647442575194622, 0.5022124740457112),
+    TW(0.8655136240905689, 0.500885382611241), TW(0.8662809540245129, 0.499557112545082),
+    TW(0.8670462455156926, 0.49822766697278187), TW(0.8678094967633033, 0.4968970490226544),
+    TW(0.8685707059713406, 0.49556526182577304), TW(0.8693298713486066, 0.4942323085159601),
+    TW(0.8700869911087113, 0.49289819222978426), TW(0.8708420634700789, 0.49156291610655),
+    TW(0.8715950866559511, 0.4902264832882911), TW(0.8723460588943912, 0.4888888969197637),
+    TW(0.8730949784182899, 0.4875501601484364), TW(0.8738418434653666, 0.4862102761244867),
+    TW(0.874586652278176, 0.48486924800079123), TW(0.8753294031041109, 0.48352707893291874),
+    TW(0.8760700941954067, 0.4821837720791226), TW(0.8768087238091454, 0.48083933060033446),
+    TW(0.8775452902072611, 0.4794937576601534), TW(0.8782797916565414, 0.4781470564248433),
+    TW(0.8790122264286334, 0.4767992300633222), TW(0.8797425928000475, 0.4754502817471558),
+    TW(0.8804708890521604, 0.4741002146505506), TW(0.8811971134712218, 0.47274903195034323),
+    TW(0.8819212643483548, 0.4713967368259979), TW(0.8826433399795627, 0.4700433324595958),
+    TW(0.8833633386657316, 0.46868882203582796), TW(0.8840812587126351, 0.4673332087419883),
+    TW(0.8847970984309375, 0.4659764957679667), TW(0.8855108561361997, 0.4646186863062382),
+    TW(0.8862225301488805, 0.4632597835518604), TW(0.8869321187943421, 0.46189979070246284),
+    TW(0.8876396204028539, 0.46053871095823995), TW(0.888345033309596, 0.4591765475219447),
+    TW(0.8890483558546644, 0.4578133035988777), TW(0.8897495863830727, 0.45644898239688425),
+    TW(0.8904487232447578, 0.455083587126344), TW(0.8911457647945832, 0.45371712100016387),
+    TW(0.8918407093923428, 0.4523495872337707), TW(0.8925335554027644, 0.45098098904510436),
+    TW(0.8932243011955151, 0.449611329654607), TW(0.8939129451452031, 0.44824061228522016),
+    TW(0.8945994856313826, 0.44686884016237427), TW(0.8952839210385576, 0.4454960165139817),
+    TW(0.8959662497561849, 0.4441221445704298), TW(0.8966464701786799, 0.44274722756457047),
+    TW(0.8973245807054181, 0.441371268731717), TW(0.8980005797407398, 0.4399942713096334),
+    TW(0.8986744656939538, 0.43861623853852766), TW(0.8993462369793416, 0.437237173661044),
+    TW(0.90001589201616, 0.43585707992225603), TW(0.9006834292286467, 0.4344759605696561),
+    TW(0.9013488470460219, 0.4330938188531522), TW(0.9020121439024932, 0.43171065802505737),
+    TW(0.9026733182372588, 0.43032648134008256), TW(0.9033323684945116, 0.4289412920553301),
+    TW(0.9039892931234431, 0.42755509343028253), TW(0.904644090578246, 0.42616788872679995),
+    TW(0.9052967593181187, 0.424779681209109), TW(0.9059472978072685, 0.42339047414379605),
+    TW(0.9065957045149154, 0.42200027079979957), TW(0.9072419779152956, 0.42060907444840306),
+    TW(0.907886116487666, 0.41921688836322435), TW(0.908528118716306, 0.41782371582021255),
+    TW(0.9091679830905224, 0.41642956009763726), TW(0.9098057081046522, 0.4150344244760816),
+    TW(0.9104412922580669, 0.41363831223843517), TW(0.9110747340551761, 0.41224122666988333),
+    TW(0.9117060320054297, 0.41084317105790424), TW(0.9123351846233226, 0.4094441486922578),
+    TW(0.9129621904283981, 0.4080441628649787), TW(0.9135870479452509, 0.40664321687036886),
+    TW(0.9142097557035305, 0.4052413140049904), TW(0.914830312237946, 0.4038384575676545),
+    TW(0.9154487160882677, 0.4024346508594187), TW(0.9160649657993316, 0.40102989718357573),
+    TW(0.9166790599210427, 0.3996241998456468), TW(0.9172909970083777, 0.3982175621533742),
+    TW(0.9179007756213903, 0.3968099874167108), TW(0.9185083943252121, 0.39540147894781663),
+    TW(0.9191138516900577, 0.39399204006104827), TW(0.9197171462912274, 0.3925816740729515),
+    TW(0.9203182767091106, 0.39117038430225376), TW(0.9209172415291892, 0.389758174069857),
+    TW(0.9215140393420418, 0.3883450466988267), TW(0.922108668743345, 0.38693100551438886),
+    TW(0.9227011283338785, 0.38551605384391896), TW(0.9232914167195276, 0.384100195016935),
+    TW(0.9238795325112865, 0.3826834323650904), TW(0.9244654743252625, 0.3812657692221628),
+    TW(0.9250492407826775, 0.3798472089240515), TW(0.9256308305098727, 0.3784277548087658),
+    TW(0.9262102421383114, 0.37700741021641826), TW(0.9267874743045819, 0.3755861784892171),
+    TW(0.9273625256504009, 0.37416406297145854), TW(0.9279353948226177, 0.3727410670095162),
+    TW(0.9285060804732155, 0.3713171939518378), TW(0.9290745812593157, 0.3698924471489342),
+    TW(0.9296408958431813, 0.36846682995337227), TW(0.9302050228922192, 0.367040345719767),
+    TW(0.9307669610789835, 0.36561299780477435), TW(0.9313267090811803, 0.3641847895670802),
+    TW(0.931884265581668, 0.3627557243673974), TW(0.9324396292684624, 0.3613258055684543),
+    TW(0.932992798834739, 0.359895036534988), TW(0.933543772978836, 0.3584634206337371),
+    TW(0.9340925504042588, 0.3570309612334304), TW(0.9346391298196807, 0.35559766170478413),
+    TW(0.9351835099389475, 0.3541635254204905), TW(0.9357256894810804, 0.35272855575521067),
+    TW(0.9362656671702784, 0.3512927560855669), TW(0.9368034417359214, 0.3498561297901354),
+    TW(0.9373390119125748, 0.3484186802494349), TW(0.9378723764399898, 0.34698041084592385),
+    TW(0.9384035340631081, 0.3455413249639891), TW(0.9389324835320646, 0.3441014259899387),
+    TW(0.9394592236021897, 0.34266071731199493), TW(0.9399837530340138, 0.3412192023202828),
+    TW(0.9405060705932682, 0.33977688440682713), TW(0.9410261750508893, 0.3383337669655413),
+    TW(0.9415440651830208, 0.33688985339222), TW(0.9420597397710174, 0.33544514708453144),
+    TW(0.9425731976014468, 0.3339996514420099), TW(0.9430844374660934, 0.33255336986604456),
+    TW(0.9435934581619603, 0.3311063057598766), TW(0.9441002584912727, 0.32965846252858755),
+    TW(0.9446048372614803, 0.3282098435790924), TW(0.9451071932852604, 0.32676045232013234),
+    TW(0.9456073253805212, 0.32531029216226337), TW(0.9461052323704033, 0.32385936651785313),
+    TW(0.9466009130832835, 0.32240767880106996), TW(0.9470943663527772, 0.3209552324278752),
+    TW(0.9475855910177412, 0.31950203081601547), TW(0.9480745859222761, 0.31804807738501545),
+    TW(0.9485613499157302, 0.31659337555616623), TW(0.9490458818527006, 0.3151379287525226),
+    TW(0.9495281805930367, 0.3136817403988915), TW(0.9500082450018431, 0.31222481392182483),
+    TW(0.9504860739494815, 0.3107671527496121), TW(0.950961666311575, 0.30930876031226917),
+    TW(0.9514350209690083, 0.30784964004153514), TW(0.9519061368079322, 0.3063897953708611),
+    TW(0.9523750127197659, 0.3049292297354024), TW(0.9528416476011987, 0.3034679465720111),
+    TW(0.9533060403541936, 0.3020059493192286), TW(0.9537681898859902, 0.3005432414172738),
+    TW(0.9542280951091056, 0.29907982630804064), TW(0.9546857549413383, 0.29761570743508625),
+    TW(0.9551411683057708, 0.29615088824362373), TW(0.9555943341307709, 0.29468537218051494),
+    TW(0.9560452513499963, 0.2932191626942591), TW(0.956493918902395, 0.29175226323498954),
+    TW(0.9569403357322088, 0.2902846772544625), TW(0.9573845007889759, 0.2888164082060494),
+    TW(0.9578264130275329, 0.28734745954472934), TW(0.9582660714080175, 0.2858778347270811),
+    TW(0.9587034748958715, 0.2844075372112722), TW(0.9591386224618419, 0.28293657045705556),
+    TW(0.9595715130819845, 0.28146493792575805), TW(0.960002145737666, 0.2799926430802731),
+    TW(0.9604305194155657, 0.27851968938505367), TW(0.9608566331076795, 0.27704608030610034),
+    TW(0.9612804858113205, 0.2755718193109584), TW(0.9617020765291225, 0.2740969098687065),
+    TW(0.9621214042690416, 0.272621355449949), TW(0.9625384680443592, 0.27114515952680784),
+    TW(0.9629532668736838, 0.2696683255729156), TW(0.9633657997809539, 0.26819085706340356),
+    TW(0.9637760657954398, 0.2667127574748986), TW(0.9641840639517457, 0.26523403028551185),
+    TW(0.9645897932898128, 0.2637546789748313), TW(0.9649932528549202, 0.2622747070239142),
+    TW(0.9653944416976893, 0.26079411791527596), TW(0.9657933588740836, 0.2593129151328865),
+    TW(0.9661900034454125, 0.25783110216215915), TW(0.9665843744783331, 0.25634868248994286),
+    TW(0.9669764710448522, 0.2548656596045144), TW(0.9673662922223284, 0.25338203699557066),
+    TW(0.9677538370934754, 0.2518978181542173), TW(0.9681391047463623, 0.25041300657296545),
+    TW(0.9685220942744173, 0.2489276057457202), TW(0.9689028047764289, 0.24744161916777319),
+    TW(0.9692812353565483, 0.2459550503357952), TW(0.9696573851242923, 0.2444679027478246),
+    TW(0.970031253194544, 0.24298017990326418), TW(0.9704028386875554, 0.24149188530286947),
+    TW(0.9707721407289504, 0.24000302244874144), TW(0.9711391584497252, 0.23851359484431825),
+    TW(0.9715038909862517, 0.23702360599436773), TW(0.9718663374802793, 0.23553305940497588),
+    TW(0.9722264970789363, 0.23404195858354362), TW(0.9725843689347322, 0.2325503070387753),
+    TW(0.9729399522055602, 0.231058108280671), TW(0.9732932460546981, 0.22956536582051948),
+    TW(0.9736442496508119, 0.22807208317088618), TW(0.9739929621679558, 0.22657826384561028),
+    TW(0.9743393827855759, 0.22508391135979297), TW(0.9746835106885107, 0.22358902922978996),
+    TW(0.9750253450669942, 0.22209362097320334), TW(0.9753648851166569, 0.22059769010887406),
+    TW(0.9757021300385285, 0.21910124015687016), TW(0.976037079039039, 0.21760427463848384),
+    TW(0.9763697313300211, 0.21610679707621955), TW(0.9767000861287118, 0.21460881099378668),
+    TW(0.9770281426577542, 0.21311031991609197), TW(0.9773539001452, 0.21161132736922802),
+    TW(0.9776773578245099, 0.21011183688046992), TW(0.977998514934557, 0.20861185197826362),
+    TW(0.9783173707196277, 0.20711137619221853), TW(0.9786339244294232, 0.20561041305309907),
+    TW(0.9789481753190621, 0.2041089660928174), TW(0.979260122649082, 0.2026070388444215),
+    TW(0.9795697656854405, 0.20110463484209212), TW(0.9798771036995176, 0.19960175762113103),
+    TW(0.9801821359681174, 0.19809841071795348), TW(0.9804848617734693, 0.19659459767008083),
+    TW(0.9807852804032303, 0.19509032201612872), TW(0.9810833911504866, 0.1935855872958039),
+    TW(0.9813791933137546, 0.19208039704989258), TW(0.9816726861969831, 0.19057475482025274),
+    TW(0.9819638691095554, 0.18906866414980603), TW(0.9822527413662893, 0.18756212858253013),
+    TW(0.9825393022874411, 0.18605515166344702), TW(0.9828235511987052, 0.18454773693861984),
+    TW(0.9831054874312163, 0.183039887955141), TW(0.9833851103215512, 0.18153160826112488),
+    TW(0.9836624192117301, 0.18002290140570013), TW(0.9839374134492188, 0.17851377093899798),
+    TW(0.984210092386929, 0.17700422041214905), TW(0.9844804553832209, 0.17549425337727156),
+    TW(0.9847485018019042, 0.1739838733874638), TW(0.9850142310122398, 0.17247308399679578),
+    TW(0.9852776423889411, 0.17096188876030177), TW(0.985538735312176, 0.16945029123396835),
+    TW(0.9857975091675674, 0.1679382949747314), TW(0.9860539633461954, 0.1664259035404642),
+    TW(0.9863080972445987, 0.1649131204899698), TW(0.9865599102647753, 0.16339994938297386),
+    TW(0.9868094018141854, 0.1618863937801123), TW(0.987056571305751, 0.16037245724292856),
+    TW(0.9873014181578583, 0.15885814333386158), TW(0.9875439417943592, 0.15734345561623825),
+    TW(0.9877841416445722, 0.15582839765426507), TW(0.9880220171432835, 0.15431297301302063),
+    TW(0.9882575677307495, 0.1527971852584438), TW(0.9884907928526966, 0.15128103795733044),
+    TW(0.9887216919603238, 0.1497645346773216), TW(0.988950264510303, 0.14824767898689595),
+    TW(0.9891765099647809, 0.1467304744553624), TW(0.9894004277913803, 0.14521292465284794),
+    TW(0.9896220174632008, 0.14369503315029475), TW(0.9898412784588205, 0.1421768035194482),
+    TW(0.9900582102622971, 0.1406582393328492), TW(0.9902728123631691, 0.13913934416382603),
+    TW(0.990485084256457, 0.1376201215864866), TW(0.9906950254426646, 0.1361005751757066),
+    TW(0.99090263542778, 0.13458070850712642), TW(0.9911079137232768, 0.13306052515713912),
+    TW(0.9913108598461154, 0.131540028702883), TW(0.9915114733187439, 0.13001922272223398),
+    TW(0.9917097536690994, 0.12849811079379364), TW(0.9919057004306093, 0.12697669649688617),
+    TW(0.9920993131421917, 0.12545498341154637), TW(0.9922905913482574, 0.12393297511851216),
+    TW(0.99247953459871, 0.12241067519921603), TW(0.9926661424489479, 0.12088808723577762),
+    TW(0.992850414459865, 0.11936521481099176), TW(0.9930323501978514, 0.1178420615083252),
+    TW(0.9932119492347945, 0.11631863091190484), TW(0.9933892111480807, 0.11479492660650999),
+    TW(0.9935641355205953, 0.11327095217756497), TW(0.9937367219407246, 0.11174671121112706),
+    TW(0.9939069700023561, 0.11022220729388336), TW(0.9940748793048794, 0.10869744401313887),
+    TW(0.9942404494531879, 0.10717242495680884), TW(0.9944036800576791, 0.10564715371341044),
+    TW(0.9945645707342554, 0.10412163387205513), TW(0.9947231211043257, 0.10259586902243668),
+    TW(0.9948793307948056, 0.10106986275482806), TW(0.9950331994381186, 0.0995436186600694),
+    TW(0.9951847266721969, 0.0980171403295605), TW(0.9953339121404822, 0.09649043135525323),
+    TW(0.9954807554919269, 0.09496349532963948), TW(0.9956252563809943, 0.09343633584574809),
+    TW(0.9957674144676598, 0.09190895649713288), TW(0.9959072294174117, 0.09038136087786497),
+    TW(0.996044700901252, 0.08885355258252442), TW(0.9961798285956969, 0.08732553520619263),
+    TW(0.996312612182778, 0.08579731234444028), TW(0.9964430513500426, 0.08426888759332431),
+    TW(0.9965711457905548, 0.08274026454937576), TW(0.9966968952028961, 0.08121144680959234),
+    TW(0.9968202992911657, 0.07968243797143075), TW(0.996941357764982, 0.07815324163279472),
+    TW(0.997060070339483, 0.07662386139203181), TW(0.9971764367353261, 0.07509430084792147),
+    TW(0.9972904566786902, 0.07356456359966741), TW(0.9974021299012753, 0.07203465324688915),
+    TW(0.9975114561403035, 0.07050457338961442), TW(0.9976184351385196, 0.06897432762826713),
+    TW(0.9977230666441916, 0.06744391956366429), TW(0.9978253504111116, 0.06591335279700389),
+    TW(0.997925286198596, 0.06438263092985737), TW(0.9980228737714861, 0.06285175756416206),
+    TW(0.9981181129001492, 0.06132073630220906), TW(0.9982110033604782, 0.05978957074664019),
+    TW(0.9983015449338928, 0.05825826450043591), TW(0.9983897374073402, 0.05672682116690774),
+    TW(0.9984755805732948, 0.055195244349689775), TW(0.9985590742297593, 0.05366353765273108),
+    TW(0.9986402181802652, 0.05213170468028372), TW(0.9987190122338729, 0.05059974903689952),
+    TW(0.9987954562051724, 0.04906767432741809), TW(0.9988695499142836, 0.04753548415695922),
+    TW(0.9989412931868569, 0.04600318213091527), TW(0.9990106858540733, 0.044470771854939146),
+    TW(0.9990777277526454, 0.04293825693494114), TW(0.9991424187248169, 0.0414056409770769),
+    TW(0.9992047586183639, 0.03987292758773981), TW(0.9992647472865944, 0.038340120373552534),
+    TW(0.9993223845883494, 0.036807222941359394), TW(0.9993776703880028, 0.03527423889821435),
+    TW(0.9994306045554617, 0.03374117185137782), TW(0.999481186966167, 0.03220802540830466),
+    TW(0.9995294175010931, 0.030674803176636543), TW(0.9995752960467492, 0.029141508764194368),
+    TW(0.9996188224951786, 0.027608145778966225), TW(0.9996599967439592, 0.02607471782910422),
+    TW(0.9996988186962042, 0.024541228522912448), TW(0.9997352882605617, 0.023007681468839372),
+    TW(0.9997694053512153, 0.021474080275469345), TW(0.9998011698878843, 0.019940428551515003),
+    TW(0.9998305817958234, 0.018406729905805226), TW(0.9998576410058239, 0.016872987947281957),
+    TW(0.9998823474542126, 0.015339206284988182), TW(0.9999047010828529, 0.01380538852806031),
+    TW(0.9999247018391445, 0.012271538285720572), TW(0.9999423496760239, 0.010737659167264976),
+    TW(0.9999576445519639, 0.009203754782060144), TW(0.9999705864309741, 0.007669828739531261),
+    TW(0.9999811752826011, 0.006135884649154477), TW(0.9999894110819284, 0.004601926120448411),
+    TW(0.9999952938095762, 0.003067956762966544), TW(0.9999988234517019, 0.0015339801862851719),
+};
+
+const kiss_fft_cpx fft_super_twiddles[FFT_TABLE_MAX_NFFT/4] = {
+    TW(-0.0007669903187427239, -0.9999997058628822), TW(-0.0015339801862846436, -0.9999988234517019),
+    TW(-0.002300969151425764, -0.9999973527669782), TW(-0.0030679567629660156, -0.9999952938095762),
+    TW(-0.0038349425697061256, -0.9999926465807072), TW(-0.00460192612044855, -0.9999894110819284),
+    TW(-0.00536890696399618, -0.9999855873151432), TW(-0.006135884649154393, -0.9999811752826011),
+    TW(-0.006902858724729754, -0.9999761749868976), TW(-0.007669828739530955, -0.9999705864309741),
+    TW(-0.008436794242369738, -0.9999644096181183), TW(-0.009203754782059837, -0.9999576445519639),
+    TW(-0.009970709907417906, -0.9999502912364905), TW(-0.010737659167264449, -0.9999423496760239),
+    TW(-0.011504602110422753, -0.999933819875236), TW(-0.012271538285719823, -0.9999247018391445),
+    TW(-0.01303846724198731, -0.9999149955731135), TW(-0.013805388528060226, -0.9999047010828529),
+    TW(-0.014572301692778981, -0.9998938183744185), TW(-0.015339206284988098, -0.9998823474542126),
+    TW(-0.01610610185353714, -0.999870288328983), TW(-0.01687298794728165, -0.9998576410058239),
+    TW(-0.017639864115082074, -0.9998444054921752), TW(-0.018406729905804695, -0.9998305817958234),
+    TW(-0.019173584868322577, -0.9998161699249004), TW(-0.019940428551514476, -0.9998011698878843),
+    TW(-0.02070726050426579, -0.9997855816935992), TW(-0.021474080275469484, -0.9997694053512153),
+    TW(-0.022240887414024794, -0.9997526408702488), TW(-0.02300768146883929, -0.9997352882605617),
+    TW(-0.02377446198882755, -0.9997173475323622), TW(-0.024541228522912142, -0.9996988186962042),
+    TW(-0.025307980620024505, -0.9996797017629879), TW(-0.026074717829103915, -0.9996599967439592),
+    TW(-0.026841439699098406, -0.9996397036507102), TW(-0.027608145778965698, -0.9996188224951786),
+    TW(-0.028374835617672133, -0.9995973532896484), TW(-0.029141508764193618, -0.9995752960467492),
+    TW(-0.029908164767516534, -0.999552650779457), TW(-0.03067480317663646, -0.9995294175010931),
+    TW(-0.03144142354056022, -0.9995055962253253), TW(-0.03220802540830458, -0.999481186966167),
+    TW(-0.03297460832889719, -0.9994561897379773), TW(-0.03374117185137752, -0.9994306045554617),
+    TW(-0.03450771552479577, -0.9994044314336713), TW(-0.03527423889821382, -0.9993776703880028),
+    TW(-0.03604074152070618, -0.9993503214341994), TW(-0.036807222941358866, -0.9993223845883495),
+    TW(-0.037573682709270396, -0.9992938598668878), TW(-0.038340120373552666, -0.9992647472865944),
+    TW(-0.03910653548332972, -0.9992350468645959), TW(-0.03987292758773973, -0.9992047586183639),
+    TW(-0.04063929623593373, -0.9991738825657164), TW(-0.041405640977076594, -0.9991424187248169),
+    TW(-0.04217196136034788, -0.9991103671141749), TW(-0.042938256934940834, -0.9990777277526454),
+    TW(-0.043704527250063296, -0.9990445006594293), TW(-0.04447077185493862, -0.9990106858540734),
+    TW(-0.045236990298804625, -0.9989762833564698), TW(-0.04600318213091452, -0.9989412931868569),
+    TW(-0.046769346900537835, -0.9989057153658183), TW(-0.047535484156959136, -0.9988695499142836),
+    TW(-0.048301593449480054, -0.998832796853528), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(-0.04983372634010713, -0.9987575279911833), TW(-0.05059974903689921, -0.9987190122338729),
+    TW(-0.051365741967162606, -0.9986799089558991), TW(-0.05213170468028319, -0.9986402181802653),
+    TW(-0.052897636725665276, -0.9985999399303204), TW(-0.053663537652730554, -0.9985590742297593),
+    TW(-0.05442940701091902, -0.9985176211026222), TW(-0.05519524434968991, -0.9984755805732948),
+    TW(-0.0559610492185204, -0.9984329526665084), TW(-0.05672682116690766, -0.9983897374073402),
+    TW(-0.057492559744367566, -0.9983459348212124), TW(-0.05825826450043561, -0.9983015449338929),
+    TW(-0.05902393498466786, -0.9982565677714952), TW(-0.05978957074663988, -0.9982110033604782),
+    TW(-0.060555171335947656, -0.9981648517276462), TW(-0.06132073630220853, -0.9981181129001492),
+    TW(-0.06208626519506012, -0.9980707869054823), TW(-0.06285175756416131, -0.9980228737714862),
+    TW(-0.06361721295919306, -0.997974373526347), TW(-0.06438263092985728, -0.997925286198596),
+    TW(-0.06514801102587874, -0.9978756118171102), TW(-0.0659133527970038, -0.9978253504111116),
+    TW(-0.06667865579300142, -0.9977745020101678), TW(-0.06744391956366398, -0.9977230666441916),
+    TW(-0.06820914365880633, -0.997671044343441), TW(-0.06897432762826661, -0.9976184351385196),
+    TW(-0.06973947102190725, -0.9975652390603758), TW(-0.0705045733896139, -0.9975114561403035),
+    TW(-0.07126963428129629, -0.9974570864099419), TW(-0.07203465324688929, -0.9974021299012753),
+    TW(-0.07279962983635149, -0.9973465866466332), TW(-0.07356456359966733, -0.9972904566786902),
+    TW(-0.07432945408684576, -0.9972337400304663), TW(-0.07509430084792117, -0.9971764367353262),
+    TW(-0.07585910343295438, -0.99711854682698), TW(-0.0766238613920315, -0.997060070339483),
+    TW(-0.07738857427526492, -0.9970010073072353), TW(-0.07815324163279419, -0.9969413577649822),
+    TW(-0.07891786301478498, -0.9968811217478138), TW(-0.07968243797143001, -0.9968202992911658),
+    TW(-0.08044696605294997, -0.996758890430818), TW(-0.08121144680959226, -0.9966968952028961),
+    TW(-0.08197587979163298, -0.9966343136438699), TW(-0.08274026454937568, -0.9965711457905548),
+    TW(-0.08350460063315228, -0.9965073916801108), TW(-0.084268887593324, -0.9964430513500426),
+    TW(-0.08503312498028029, -0.9963781248382002), TW(-0.08579731234443976, -0.996312612182778),
+    TW(-0.08656144923625111, -0.9962465134223155), TW(-0.0873255352061921, -0.9961798285956969),
+    TW(-0.08808956980477038, -0.9961125577421512), TW(-0.08885355258252456, -0.996044700901252),
+    TW(-0.08961748309002279, -0.9959762581129178), TW(-0.09038136087786489, -0.9959072294174117),
+    TW(-0.091145185496681, -0.9958376148553416), TW(-0.09190895649713257, -0.9957674144676598),
+    TW(-0.09267267342991324, -0.9956966282956635), TW(-0.09343633584574779, -0.9956252563809943),
+    TW(-0.09419994329539308, -0.9955532987656386), TW(-0.09496349532963895, -0.9954807554919269),
+    TW(-0.09572699149930719, -0.9954076266025349), TW(-0.09649043135525248, -0.9953339121404823),
+    TW(-0.09725381444836324, -0.9952596121491334), TW(-0.09801714032956065, -0.9951847266721969),
+    TW(-0.09878040854979954, -0.9951092557537261), TW(-0.09954361866006932, -0.9950331994381186),
+    TW(-0.10030677021139271, -0.9949565577701164), TW(-0.10106986275482775, -0.9948793307948056),
+    TW(-0.10183289584146654, -0.9948015185576171), TW(-0.10259586902243616, -0.9947231211043257),
+    TW(-0.10335878184889957, -0.9946441384810507), TW(-0.1041216338720546, -0.9945645707342554),
+    TW(-0.10488442464313484, -0.9944844179107476), TW(-0.10564715371341057, -0.9944036800576791),
+    TW(-0.10640982063418772, -0.9943223572225458), TW(-0.10717242495680876, -0.9942404494531879),
+    TW(-0.10793496623265364, -0.9941579567977897), TW(-0.10869744401313856, -0.9940748793048795),
+    TW(-0.10945985784971791, -0.9939912170233294), TW(-0.11022220729388306, -0.9939069700023561),
+    TW(-0.11098449189716325, -0.9938221382915197), TW(-0.11174671121112655, -0.9937367219407246),
+    TW(-0.1125088647873787, -0.9936507210002191), TW(-0.11327095217756424, -0.9935641355205953),
+    TW(-0.11403297293336717, -0.9934769655527892), TW(-0.11479492660651013, -0.9933892111480807),
+    TW(-0.11555681274875518, -0.9933008723580933), TW(-0.11631863091190475, -0.9932119492347945),
+    TW(-0.11708038064780042, -0.9931224418304956), TW(-0.1178420615083249, -0.9930323501978514),
+    TW(-0.11860367304540072, -0.9929416743898605), TW(-0.11936521481099123, -0.9928504144598651),
+    TW(-0.12012668635710146, -0.9927585704615511), TW(-0.1208880872357771, -0.992666142448948),
+    TW(-0.12164941699910542, -0.9925731304764288), TW(-0.12241067519921615, -0.99247953459871),
+    TW(-0.12317186138828053, -0.9923853548708517), TW(-0.12393297511851208, -0.9922905913482574),
+    TW(-0.12469401594216764, -0.9921952440866739), TW(-0.12545498341154607, -0.9920993131421918),
+    TW(-0.12621587707899026, -0.9920027985712445), TW(-0.12697669649688587, -0.9919057004306093),
+    TW(-0.12773744121766217, -0.9918080187774065), TW(-0.1284981107937931, -0.9917097536690995),
+    TW(-0.12925870477779616, -0.9916109051634954), TW(-0.13001922272223324, -0.991511473318744),
+    TW(-0.13077966417971168, -0.9914114581933385), TW(-0.13154002870288314, -0.9913108598461154),
+    TW(-0.13230031584444457, -0.9912096783362541), TW(-0.13306052515713904, -0.9911079137232769),
+    TW(-0.13382065619375458, -0.9910055660670494), TW(-0.1345807085071261, -0.99090263542778),
+    TW(-0.13534068165013421, -0.9907991218660204), TW(-0.13610057517570606, -0.9906950254426646),
+    TW(-0.13686038863681632, -0.9905903462189501), TW(-0.13762012158648607, -0.990485084256457),
+    TW(-0.13837977357778378, -0.9903792396171082), TW(-0.13913934416382617, -0.9902728123631691),
+    TW(-0.13989883289777724, -0.9901658025572484), TW(-0.14065823933284913, -0.9900582102622971),
+    TW(-0.14141756302230302, -0.989950035541609), TW(-0.1421768035194479, -0.9898412784588205),
+    TW(-0.14293596037764258, -0.9897319390779106), TW(-0.14369503315029444, -0.9896220174632009),
+    TW(-0.14445402139086033, -0.9895115136793553), TW(-0.1452129246528474, -0.9894004277913804),
+    TW(-0.14597174248981223, -0.9892887598646252), TW(-0.14673047445536164, -0.989176509964781),
+    TW(-0.14748912010315354, -0.9890636781578815), TW(-0.1482476789868961, -0.988950264510303),
+    TW(-0.14900615066034836, -0.9888362690887635), TW(-0.1497645346773215, -0.9887216919603238),
+    TW(-0.15052283059167726, -0.9886065331923866), TW(-0.15128103795733014, -0.9884907928526967),
+    TW(-0.15203915632824605, -0.9883744710093413), TW(-0.1527971852584433, -0.9882575677307495),
+    TW(-0.1535551243019934, -0.9881400830856926), TW(-0.15431297301302013, -0.9880220171432835),
+    TW(-0.1550707309457004, -0.9879033699729778), TW(-0.1558283976542652, -0.9877841416445722),
+    TW(-0.15658597269299848, -0.9876643322282057), TW(-0.15734345561623816, -0.9875439417943593),
+    TW(-0.15810084597837698, -0.9874229704138554), TW(-0.15885814333386128, -0.9873014181578584),
+    TW(-0.15961534723719295, -0.9871792850978743), TW(-0.16037245724292826, -0.987056571305751),
+    TW(-0.16112947290567867, -0.9869332768536778), TW(-0.16188639378011177, -0.9868094018141855),
+    TW(-0.16264321942095034, -0.9866849462601467), TW(-0.16339994938297311, -0.9865599102647755),
+    TW(-0.16415658322101578, -0.9864342939016272), TW(-0.16491312048996995, -0.9863080972445987),
+    TW(-0.165669560744784, -0.9861813203679283), TW(-0.1664259035404641, -0.9860539633461954),
+    TW(-0.16718214843207277, -0.9859260262543211), TW(-0.1679382949747311, -0.9857975091675675),
+    TW(-0.16869434272361733, -0.9856684121615376), TW(-0.16945029123396782, -0.9855387353121761),
+    TW(-0.170206140061078, -0.9854084786957684), TW(-0.17096188876030124, -0.9852776423889412),
+    TW(-0.17171753688704985, -0.9851462264686622), TW(-0.17247308399679592, -0.9850142310122398),
+    TW(-0.17322852964507035, -0.9848816560973237), TW(-0.1739838733874637, -0.9847485018019042),
+    TW(-0.1747391147796272, -0.9846147682043126), TW(-0.17549425337727126, -0.9844804553832209),
+    TW(-0.1762492887361678, -0.9843455634176419), TW(-0.17700422041214875, -0.984210092386929),
+    TW(-0.17775904796110703, -0.9840740423707766), TW(-0.17851377093899745, -0.9839374134492189),
+    TW(-0.17926838890183575, -0.9838002057026316), TW(-0.1800229014056994, -0.9836624192117303),
+    TW(-0.18077730800672856, -0.9835240540575713), TW(-0.18153160826112502, -0.9833851103215512),
+    TW(-0.1822858017251532, -0.9832455880854072), TW(-0.18303988795514092, -0.9831054874312163),
+    TW(-0.18379386650747828, -0.9829648084413964), TW(-0.18454773693861953, -0.9828235511987053),
+    TW(-0.1853014988050819, -0.9826817157862409), TW(-0.1860551516634465, -0.9825393022874412),
+    TW(-0.18680869507035922, -0.9823963107860847), TW(-0.1875621285825296, -0.9822527413662894),
+    TW(-0.188315451756732, -0.9821085941125136), TW(-0.18906866414980616, -0.9819638691095552),
+    TW(-0.18982176531865647, -0.9818185664425525), TW(-0.19057475482025266, -0.9816726861969831),
+    TW(-0.19132763221163088, -0.9815262284586648), TW(-0.19208039704989227, -0.9813791933137546),
+    TW(-0.19283304889220515, -0.9812315808487497), TW(-0.1935855872958036, -0.9810833911504867),
+    TW(-0.19433801181798846, -0.9809346243061418), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(-0.19584251744765788, -0.9806353595296081), TW(-0.1965945976700801, -0.9804848617734694),
+    TW(-0.1973465622409659, -0.980333787223348), TW(-0.19809841071795362, -0.9801821359681174),
+    TW(-0.19885014265875, -0.9800299080969901), TW(-0.19960175762113094, -0.9798771036995176),
+    TW(-0.20035325516294028, -0.9797237228655912), TW(-0.20110463484209182, -0.9795697656854405),
+    TW(-0.20185589621656802, -0.9794152322496348), TW(-0.20260703884442097, -0.9792601226490821),
+    TW(-0.20335806228377326, -0.9791044369750292), TW(-0.2041089660928169, -0.9789481753190622),
+    TW(-0.2048597498298143, -0.9787913377731057), TW(-0.2056104130530992, -0.9786339244294232),
+    TW(-0.20636095532107557, -0.9784759353806168), TW(-0.20711137619221845, -0.9783173707196277),
+    TW(-0.20786167522507504, -0.978158230539735), TW(-0.20861185197826332, -0.9779985149345571),
+    TW(-0.20936190601047408, -0.9778382239980504), TW(-0.2101118368804696, -0.9776773578245099),
+    TW(-0.21086164414708472, -0.9775159165085693), TW(-0.2116113273692275, -0.9773539001452001),
+    TW(-0.21236088610587844, -0.9771913088297123), TW(-0.21311031991609125, -0.9770281426577544),
+    TW(-0.21385962835899372, -0.9768644017253126), TW(-0.2146088109937868, -0.9767000861287118),
+    TW(-0.21535786737974544, -0.9765351959646145), TW(-0.2161067970762195, -0.9763697313300211),
+    TW(-0.21685559964263246, -0.9762036923222706), TW(-0.21760427463848356, -0.9760370790390391),
+    TW(-0.21835282162334632, -0.975869891578341), TW(-0.21910124015686966, -0.9757021300385286),
+    TW(-0.21984952979877864, -0.9755337945182914), TW(-0.22059769010887353, -0.975364885116657),
+    TW(-0.2213457206470307, -0.9751954019329904), TW(-0.22209362097320348, -0.9750253450669941),
+    TW(-0.22284139064742117, -0.9748547146187084), TW(-0.22358902922978988, -0.9746835106885107),
+    TW(-0.22433653628049358, -0.9745117333771158), TW(-0.22508391135979267, -0.9743393827855759),
+    TW(-0.2258311540280261, -0.9741664590152804), TW(-0.22657826384561, -0.9739929621679558),
+    TW(-0.22732524037303872, -0.9738188923456662), TW(-0.22807208317088568, -0.973644249650812),
+    TW(-0.22881879179980225, -0.9734690341861311), TW(-0.22956536582051876, -0.9732932460546982),
+    TW(-0.23031180479384541, -0.9731168853599251), TW(-0.23105810828067114, -0.9729399522055602),
+    TW(-0.23180427584196464, -0.9727624466956886), TW(-0.23255030703877522, -0.9725843689347322),
+    TW(-0.23329620143223143, -0.9724057190274499), TW(-0.23404195858354332, -0.9722264970789364),
+    TW(-0.23478757805400094, -0.9720467031946235), TW(-0.23553305940497535, -0.9718663374802794),
+    TW(-0.23627840219791948, -0.9716854000420085), TW(-0.23702360599436723, -0.9715038909862518),
+    TW(-0.23776867035593408, -0.9713218104197863), TW(-0.2385135948443184, -0.9711391584497251),
+    TW(-0.23925837902129998, -0.970955935183518), TW(-0.2400030224487414, -0.9707721407289504),
+    TW(-0.2407475246885884, -0.9705877751941436), TW(-0.24149188530286916, -0.9704028386875555),
+    TW(-0.24223610385369593, -0.9702173313179792), TW(-0.24298017990326387, -0.970031253194544),
+    TW(-0.24372411301385202, -0.9698446044267149), TW(-0.2444679027478241, -0.9696573851242924),
+    TW(-0.24521154866762757, -0.9694695953974131), TW(-0.24595505033579448, -0.9692812353565485),
+    TW(-0.2466984073149424, -0.9690923051125062), TW(-0.24744161916777332, -0.9689028047764289),
+    TW(-0.24818468545707467, -0.9687127344597948), TW(-0.24892760574572012, -0.9685220942744174),
+    TW(-0.24967037959666838, -0.9683308843324453), TW(-0.25041300657296517, -0.9681391047463624),
+    TW(-0.2511554862377419, -0.9679467556289878), TW(-0.2518978181542168, -0.9677538370934755),
+    TW(-0.25264000188569546, -0.9675603492533145), TW(-0.25338203699557016, -0.9673662922223285),
+    TW(-0.2541239230473205, -0.9671716661146766), TW(-0.2548656596045145, -0.9669764710448521),
+    TW(-0.25560724623080744, -0.9667807071276833), TW(-0.2563486824899428, -0.9665843744783331),
+    TW(-0.2570899679457531, -0.9663874732122989), TW(-0.2578311021621588, -0.9661900034454126),
+    TW(-0.2585720847031703, -0.9659919652938406), TW(-0.25931291513288623, -0.9657933588740837),
+    TW(-0.260053593015495, -0.9655941843029768), TW(-0.26079411791527546, -0.9653944416976894),
+    TW(-0.2615344893965955, -0.9651941311757247), TW(-0.2622747070239135, -0.9649932528549204),
+    TW(-0.26301477036177895, -0.9647918068534479), TW(-0.2637546789748314, -0.9645897932898128),
+    TW(-0.2644944324278015, -0.9643872122828543), TW(-0.2652340302855118, -0.9641840639517458),
+    TW(-0.2659734721128754, -0.9639803484159941), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(-0.2674518859366776, -0.9635712162102573), TW(-0.268190857063403, -0.963365799780954),
+    TW(-0.2689296704203572, -0.9631598166283715), TW(-0.2696683255729151, -0.9629532668736839),
+    TW(-0.2704068220865447, -0.9627461506383994), TW(-0.27114515952680796, -0.9625384680443592),
+    TW(-0.2718833374593598, -0.9623302192137374), TW(-0.27262135544994887, -0.9621214042690416),
+    TW(-0.2733592130644187, -0.9619120233331122), TW(-0.2740969098687062, -0.9617020765291225),
+    TW(-0.27483444542884383, -0.961491563980579), TW(-0.27557181931095814, -0.9612804858113206),
+    TW(-0.2763090310812709, -0.9610688421455194), TW(-0.27704608030609984, -0.9608566331076797),
+    TW(-0.27778296655185764, -0.9606438588226386), TW(-0.27851968938505295, -0.9604305194155659),
+    TW(-0.2792562483722911, -0.9602166150119634), TW(-0.2799926430802733, -0.9600021457376658),
+    TW(-0.2807288730757971, -0.95978711171884), TW(-0.28146493792575794, -0.9595715130819845),
+    TW(-0.2822008371971474, -0.9593553499539308), TW(-0.2829365704570553, -0.959138622461842),
+    TW(-0.28367213727266843, -0.9589213307332132), TW(-0.2844075372112717, -0.9587034748958716),
+    TW(-0.2851427698402486, -0.9584850550779762), TW(-0.2858778347270806, -0.9582660714080177),
+    TW(-0.2866127314393477, -0.9580465240148186), TW(-0.28734745954472946, -0.9578264130275329),
+    TW(-0.2880820186110042, -0.9576057385756463), TW(-0.28881640820604937, -0.957384500788976),
+    TW(-0.289550627897843, -0.9571626997976702), TW(-0.29028467725446216, -0.9569403357322089),
+    TW(-0.291018555844085, -0.9567174087234032), TW(-0.29175226323498926, -0.9564939189023951),
+    TW(-0.2924857989955537, -0.9562698664006581), TW(-0.2932191626942586, -0.9560452513499965),
+    TW(-0.29395235389968466, -0.9558200738825454), TW(-0.2946853721805142, -0.9555943341307711),
+    TW(-0.29541821710553196, -0.9553680322274704), TW(-0.29615088824362384, -0.9551411683057707),
+    TW(-0.29688338516377816, -0.9549137424991305), TW(-0.2976157074350862, -0.9546857549413383),
+    TW(-0.29834785462674146, -0.9544572057665135), TW(-0.29907982630804036, -0.9542280951091057),
+    TW(-0.29981162204838335, -0.9539984231038945), TW(-0.3005432414172733, -0.9537681898859903),
+    TW(-0.3012746839843179, -0.9535373955908334), TW(-0.3020059493192281, -0.9533060403541939),
+    TW(-0.30273703699181903, -0.9530741243121723), TW(-0.30346794657201126, -0.9528416476011987),
+    TW(-0.30419867762982916, -0.9526086103580332), TW(-0.30492922973540226, -0.9523750127197659),
+    TW(-0.3056596024589661, -0.9521408548238158), TW(-0.306389795370861, -0.9519061368079323),
+    TW(-0.307119808041533, -0.9516708588101939), TW(-0.30784964004153487, -0.9514350209690083),
+    TW(-0.3085792909415249, -0.9511986234231133), TW(-0.3093087603122686, -0.9509616663115751),
+    TW(-0.3100380477246379, -0.9507241497737896), TW(-0.31076715274961136, -0.9504860739494818),
+    TW(-0.31149607495827586, -0.9502474389787052), TW(-0.31222481392182494, -0.950008245001843),
+    TW(-0.3129533692115601, -0.9497684921596067), TW(-0.3136817403988914, -0.9495281805930367),
+    TW(-0.3144099270553367, -0.949287310443502), TW(-0.31513792875252233, -0.9490458818527007),
+    TW(-0.31586574506218396, -0.9488038949626585), TW(-0.31659337555616573, -0.9485613499157304),
+    TW(-0.3173208198064217, -0.9483182468545992), TW(-0.31804807738501495, -0.9480745859222762),
+    TW(-0.31877514786411837, -0.9478303672621011), TW(-0.31950203081601564, -0.9475855910177412),
+    TW(-0.3202287258130999, -0.947340257333192), TW(-0.3209552324278751, -0.9470943663527772),
+    TW(-0.3216815502329565, -0.946847918221148), TW(-0.32240767880106985, -0.9466009130832835),
+    TW(-0.3231336177050522, -0.9463533510844906), TW(-0.32385936651785285, -0.9461052323704034),
+    TW(-0.32458492481253204, -0.9458565570869839), TW(-0.32531029216226287, -0.9456073253805214),
+    TW(-0.32603546814033024, -0.9453575373976323), TW(-0.3267604523201316, -0.9451071932852606),
+    TW(-0.32748524427517794, -0.9448562931906772), TW(-0.32820984357909255, -0.9446048372614803),
+    TW(-0.3289342498056121, -0.9443528256455949), TW(-0.32965846252858744, -0.9441002584912727),
+    TW(-0.3303824813219828, -0.9438471359470927), TW(-0.3311063057598763, -0.9435934581619604),
+    TW(-0.3318299354164611, -0.9433392252851077), TW(-0.33255336986604406, -0.9430844374660935),
+    TW(-0.3332766086830478, -0.9428290948548027), TW(-0.3339996514420094, -0.9425731976014469),
+    TW(-0.3347224977175811, -0.9423167458565638), TW(-0.33544514708453155, -0.9420597397710174),
+    TW(-0.3361675991177446, -0.9418021794959976), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(-0.33761190948307457, -0.9412853969839288), TW(-0.3383337669655412, -0.9410261750508893),
+    TW(-0.3390554254149695, -0.9407663995363961), TW(-0.33977688440682685, -0.9405060705932683),
+    TW(-0.340498143516697, -0.9402451883746509), TW(-0.3412192023202823, -0.939983753034014),
+    TW(-0.3419400603934022, -0.9397217647251533), TW(-0.34266071731199427, -0.9394592236021899),
+    TW(-0.343381172652115, -0.9391961298195699), TW(-0.34410142598993887, -0.9389324835320645),
+    TW(-0.3448214769017592, -0.9386682848947703), TW(-0.34554132496398904, -0.9384035340631082),
+    TW(-0.34626096975316006, -0.9381382311928244), TW(-0.34698041084592357, -0.9378723764399899),
+    TW(-0.3476996478190513, -0.937605969961), TW(-0.3484186802494344, -0.937339011912575),
+    TW(-0.3491375077140849, -0.9370715024517592), TW(-0.3498561297901349, -0.9368034417359216),
+    TW(-0.35057454605483745, -0.9365348299227556), TW(-0.35129275608556704, -0.9362656671702783),
+    TW(-0.35201075945981913, -0.9359959536368313), TW(-0.3527285557552106, -0.9357256894810804),
+    TW(-0.35344614454948076, -0.9354548748620147), TW(-0.3541635254204904, -0.9351835099389476),
+    TW(-0.3548806979462227, -0.9349115948715161), TW(-0.35559766170478385, -0.9346391298196808),
+    TW(-0.35631441627440225, -0.9343661149437259), TW(-0.3570309612334299, -0.934092550404259),
+    TW(-0.3577472961603419, -0.933818436362211), TW(-0.35846342063373643, -0.9335437729788363),
+    TW(-0.35917933423233644, -0.933268560415712), TW(-0.35989503653498817, -0.9329927988347388),
+    TW(-0.36061052712066216, -0.9327164883981403), TW(-0.36132580556845423, -0.9324396292684624),
+    TW(-0.36204087145758423, -0.9321622216085744), TW(-0.3627557243673971, -0.9318842655816681),
+    TW(-0.36347036387736376, -0.9316057613512578), TW(-0.3641847895670797, -0.9313267090811805),
+    TW(-0.3648990010162672, -0.9310471089355953), TW(-0.36561299780477385, -0.9307669610789837),
+    TW(-0.3663267795125735, -0.9304862656761498), TW(-0.3670403457197671, -0.9302050228922191),
+    TW(-0.367753696006582, -0.9299232328926397), TW(-0.3684668299533722, -0.9296408958431813),
+    TW(-0.36917974714061996, -0.9293580119099356), TW(-0.36989244714893416, -0.9290745812593157),
+    TW(-0.37060492955905155, -0.928790604058057), TW(-0.3713171939518375, -0.9285060804732156),
+    TW(-0.37202923990828485, -0.9282210106721696), TW(-0.3727410670095157, -0.9279353948226179),
+    TW(-0.3734526748367803, -0.9276492330925812), TW(-0.3741640629714579, -0.9273625256504011),
+    TW(-0.3748752309950575, -0.9270752726647401), TW(-0.3755861784892172, -0.9267874743045817),
+    TW(-0.3762969050357047, -0.9264991307392305), TW(-0.3770074102164182, -0.9262102421383114),
+    TW(-0.3777176936133857, -0.92592080867177), TW(-0.37842775480876545, -0.9256308305098728),
+    TW(-0.3791375933848473, -0.9253403078232063), TW(-0.379847208924051, -0.9250492407826777),
+    TW(-0.38055660100892846, -0.9247576295595139), TW(-0.3812657692221624, -0.9244654743252626),
+    TW(-0.3819747131465671, -0.9241727752517912), TW(-0.3826834323650897, -0.9238795325112867),
+    TW(-0.38339192646080866, -0.9235857462762567), TW(-0.38410019501693493, -0.9232914167195277),
+    TW(-0.3848082376168128, -0.9229965440142464), TW(-0.3855160538439189, -0.9227011283338785),
+    TW(-0.38622364328186287, -0.92240516985221), TW(-0.3869310055143886, -0.9221086687433452),
+    TW(-0.38763814012537257, -0.9218116251817081), TW(-0.3883450466988262, -0.921514039342042),
+    TW(-0.3890517248188944, -0.9212159113994087), TW(-0.3897581740698563, -0.9209172415291895),
+    TW(-0.39046439403612654, -0.920618029907084), TW(-0.39117038430225387, -0.9203182767091106),
+    TW(-0.39187614445292224, -0.9200179821116066), TW(-0.3925816740729514, -0.9197171462912274),
+    TW(-0.39328697274729646, -0.919415769424947), TW(-0.393992040061048, -0.9191138516900578),
+    TW(-0.39469687559943356, -0.91881139326417), TW(-0.3954014789478162, -0.9185083943252123),
+    TW(-0.3961058496916962, -0.918204855051431), TW(-0.3968099874167103, -0.9179007756213905),
+    TW(-0.3975138917086322, -0.917596156213973), TW(-0.3982175621533735, -0.917290997008378),
+    TW(-0.3989209983369829, -0.916985298184123), TW(-0.3996241998456467, -0.9166790599210427),
+    TW(-0.40032716626569004, -0.9163722823992891), TW(-0.4010298971835757, -0.9160649657993317),
+    TW(-0.4017323921859049, -0.9157571103019568), TW(-0.40243465085941843, -0.9154487160882678),
+    TW(-0.40313667279099513, -0.9151397833396853), TW(-0.403838457567654, -0.9148303122379462),
+    TW(-0.404540004776553, -0.9145203029651044), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(-0.40594238484040246, -0.9138986706359117), TW(-0.40664321687036903, -0.9135870479452508),
+    TW(-0.40734380968260786, -0.9132748878148678), TW(-0.40804416286497863, -0.9129621904283982),
+    TW(-0.4087442760054814, -0.9126489559697939), TW(-0.4094441486922575, -0.9123351846233229),
+    TW(-0.41014378051359024, -0.9120208765735683), TW(-0.4108431710579038, -0.9117060320054299),
+    TW(-0.41154231991376516, -0.9113906511041224), TW(-0.4122412266698829, -0.9110747340551764),
+    TW(-0.4129398909151079, -0.9107582810444376), TW(-0.41363831223843445, -0.9104412922580672),
+    TW(-0.4143364902289991, -0.9101237678825417), TW(-0.4150344244760815, -0.9098057081046523),
+    TW(-0.4157321145691053, -0.9094871131115054), TW(-0.416429560097637, -0.9091679830905225),
+    TW(-0.41712676065138776, -0.9088483182294391), TW(-0.41782371582021227, -0.9085281187163061),
+    TW(-0.41852042519410976, -0.9082073847394887), TW(-0.41921688836322407, -0.9078861164876662),
+    TW(-0.4199131049178434, -0.9075643141498327), TW(-0.4206090744484024, -0.9072419779152959),
+    TW(-0.4213047965454796, -0.9069191079736781), TW(-0.4220002707997997, -0.9065957045149153),
+    TW(-0.42269549680223306, -0.9062717677292575), TW(-0.42339047414379577, -0.9059472978072686),
+    TW(-0.4240852024156514, -0.9056222949398254), TW(-0.4247796812091087, -0.9052967593181188),
+    TW(-0.4254739101156238, -0.9049706911336532), TW(-0.42616788872679967, -0.9046440905782461),
+    TW(-0.4268616166343866, -0.9043169578440282), TW(-0.42755509343028186, -0.9039892931234434),
+    TW(-0.4282483187065318, -0.9036610966092481), TW(-0.42894129205532944, -0.9033323684945118),
+    TW(-0.4296340130690164, -0.9030031089726172), TW(-0.4303264813400827, -0.9026733182372588),
+    TW(-0.4310186964611668, -0.9023429964824443), TW(-0.4317106580250571, -0.9020121439024933),
+    TW(-0.43240236562469003, -0.9016807606920377), TW(-0.4330938188531519, -0.901348847046022),
+    TW(-0.4337850173036786, -0.9010164031597023), TW(-0.4344759605696558, -0.9006834292286469),
+    TW(-0.43516664824461904, -0.9003499254487357), TW(-0.43585707992225536, -0.9000158920161603),
+    TW(-0.43654725519640114, -0.899681329127424), TW(-0.4372371736610441, -0.8993462369793416),
+    TW(-0.43792683491032297, -0.8990106157690391), TW(-0.4386162385385274, -0.8986744656939539),
+    TW(-0.4393053841400998, -0.8983377869518344), TW(-0.43999427130963314, -0.8980005797407399),
+    TW(-0.4406828996418729, -0.8976628442590409), TW(-0.4413712687317167, -0.8973245807054183),
+    TW(-0.44205937817421487, -0.896985789278864), TW(-0.4427472275645698, -0.8966464701786803),
+    TW(-0.4434348164981383, -0.8963066236044797), TW(-0.44412214457042914, -0.8959662497561852),
+    TW(-0.4448092113771049, -0.8956253488340301), TW(-0.4454960165139818, -0.8952839210385575),
+    TW(-0.4461825595770298, -0.8949419665706209), TW(-0.446868840162374, -0.8945994856313828),
+    TW(-0.4475548578662929, -0.8942564784223161), TW(-0.4482406122852199, -0.8939129451452033),
+    TW(-0.4489261030157433, -0.8935688860021359), TW(-0.4496113296546067, -0.8932243011955152),
+    TW(-0.45029629179870845, -0.8928791909280518), TW(-0.4509809890451037, -0.8925335554027647),
+    TW(-0.45166542099100243, -0.8921873948229826), TW(-0.4523495872337709, -0.8918407093923427),
+    TW(-0.4530334873709317, -0.8914934993147914), TW(-0.4537171210001636, -0.8911457647945834),
+    TW(-0.4544004877193034, -0.8907975060362816), TW(-0.4550835871263437, -0.890448723244758),
+    TW(-0.45576641881943464, -0.8900994166251923), TW(-0.456448982396884, -0.8897495863830728),
+    TW(-0.4571312774571571, -0.8893992327241955), TW(-0.457813303598877, -0.8890483558546647),
+    TW(-0.4584950604208261, -0.8886969559808917), TW(-0.45917654752194403, -0.8883450333095964),
+    TW(-0.45985776450132954, -0.8879925880478056), TW(-0.46053871095824006, -0.8876396204028539),
+    TW(-0.46121938649209215, -0.8872861305823833), TW(-0.46189979070246256, -0.8869321187943423),
+    TW(-0.4625799231890867, -0.886577585246987), TW(-0.46325978355186015, -0.8862225301488806),
+    TW(-0.4639393713908386, -0.8858669537088928), TW(-0.4646186863062379, -0.8855108561361998),
+    TW(-0.4652977278984344, -0.8851542376402852), TW(-0.465976495767966, -0.8847970984309379),
+    TW(-0.46665498951553086, -0.8844394387182538), TW(-0.4673332087419884, -0.884081258712635),
+    TW(-0.4680111530483599, -0.8837225586247895), TW(-0.4686888220358277, -0.8833633386657317),
+    TW(-0.46936621530573736, -0.8830035990467809), TW(-0.4700433324595955, -0.8826433399795629),
+    TW(-0.4707201730990716, -0.8822825616760087), TW(-0.4713967368259977, -0.881921264348355),
+    TW(-0.47207302324236877, -0.8815594482091438), TW(-0.47274903195034257, -0.8811971134712222),
+    TW(-0.4734247625522414, -0.880834260347742), TW(-0.4741002146505499, -0.8804708890521609),
+    TW(-0.4747753878479171, -0.8801069997982404), TW(-0.475450281747156, -0.8797425928000474),
+    TW(-0.47612489595124335, -0.8793776682719534), TW(-0.4767992300633219, -0.8790122264286335),
+    TW(-0.47747328368669795, -0.8786462674850682), TW(-0.478147056424843, -0.8782797916565416),
+    TW(-0.47882054788139394, -0.8779127991586418), TW(-0.4794937576601531, -0.8775452902072612),
+    TW(-0.48016668536508816, -0.8771772650185962), TW(-0.4808393306003338, -0.8768087238091458),
+    TW(-0.4815116929701898, -0.8764396667957137), TW(-0.4821837720791227, -0.8760700941954066),
+    TW(-0.48285556753176573, -0.8757000062256346), TW(-0.48352707893291846, -0.875329403104111),
+    TW(-0.48419830588754886, -0.8749582850488518), TW(-0.484869248000791, -0.8745866522781762),
+    TW(-0.4855399048779469, -0.8742145050107063), TW(-0.4862102761244864, -0.8738418434653669),
+    TW(-0.48688036134604745, -0.8734686678613849), TW(-0.4875501601484357, -0.8730949784182902),
+    TW(-0.4882196721376266, -0.8727207753559144), TW(-0.4888888969197631, -0.8723460588943915),
+    TW(-0.48955783410115744, -0.8719708292541578), TW(-0.4902264832882912, -0.871595086655951),
+    TW(-0.49089484408781486, -0.8712188313208111), TW(-0.4915629161065498, -0.870842063470079),
+    TW(-0.49223069895148597, -0.8704647833253977), TW(-0.492898192229784, -0.8700869911087115),
+    TW(-0.49356539554877477, -0.8697086870422656), TW(-0.49423230851595984, -0.8693298713486067),
+    TW(-0.494898930739011, -0.8689505442505825), TW(-0.4955652618257724, -0.868570705971341),
+    TW(-0.4962313013842582, -0.8681903567343313), TW(-0.4968970490226545, -0.8678094967633032),
+    TW(-0.4975625043493192, -0.8674281262823069), TW(-0.4982276669727816, -0.8670462455156928),
+    TW(-0.4988925365017445, -0.8666638546881112), TW(-0.4995571125450818, -0.8662809540245131),
+    TW(-0.5002213947118406, -0.8658975437501488), TW(-0.5008853826112408, -0.8655136240905691),
+    TW(-0.5015490758526755, -0.8651291952716237), TW(-0.5022124740457106, -0.8647442575194625),
+    TW(-0.5028755768000868, -0.864358811060534), TW(-0.5035383837257175, -0.8639728561215868),
+    TW(-0.5042008944326904, -0.863586392929668), TW(-0.5048631085312676, -0.8631994217121242),
+    TW(-0.5055250256318852, -0.8628119426966006), TW(-0.5061866453451551, -0.8624239561110406),
+    TW(-0.5068479672818632, -0.8620354621836873), TW(-0.5075089910529708, -0.8616464611430813),
+    TW(-0.5081697162696146, -0.8612569532180622), TW(-0.5088301425431071, -0.8608669386377672),
+    TW(-0.509490269484936, -0.8604764176316323), TW(-0.5101500967067666, -0.8600853904293903),
+    TW(-0.510809623820439, -0.8596938572610727), TW(-0.5114688504379704, -0.8593018183570084),
+    TW(-0.5121277761715548, -0.8589092739478238), TW(-0.5127864006335627, -0.858516224264443),
+    TW(-0.5134447234365432, -0.8581226695380862), TW(-0.5141027441932217, -0.8577286100002721),
+    TW(-0.5147604625165011, -0.8573340458828157), TW(-0.515417878019463, -0.8569389774178288),
+    TW(-0.5160749903153667, -0.8565434048377198), TW(-0.5167317990176497, -0.8561473283751946),
+    TW(-0.517388303739929, -0.8557507482632539), TW(-0.5180445040959992, -0.855353664735196),
+    TW(-0.5187003996998351, -0.8549560780246149), TW(-0.5193559901655896, -0.8545579883654005),
+    TW(-0.5200112751075958, -0.854159395991739), TW(-0.5206662541403669, -0.8537603011381115),
+    TW(-0.5213209268785955, -0.8533607040392955), TW(-0.5219752929371543, -0.8529606049303637),
+    TW(-0.5226293519310966, -0.8525600040466841), TW(-0.5232831034756565, -0.8521589016239197),
+    TW(-0.5239365471862484, -0.8517572978980292), TW(-0.5245896826784687, -0.8513551931052652),
+    TW(-0.5252425095680946, -0.8509525874821758), TW(-0.5258950274710846, -0.8505494812656035),
+    TW(-0.5265472360035794, -0.8501458746926852), TW(-0.5271991347819011, -0.8497417680008527),
+    TW(-0.5278507234225551, -0.8493371614278309), TW(-0.5285020015422284, -0.8489320552116397),
+    TW(-0.5291529687577906, -0.8485264495905928), TW(-0.5298036246862947, -0.8481203448032972),
+    TW(-0.5304539689449764, -0.8477137410886543), TW(-0.5311040011512548, -0.8473066386858585),
+    TW(-0.5317537209227332, -0.8468990378343974), TW(-0.5324031278771979, -0.8464909387740521),
+    TW(-0.5330522216326196, -0.8460823417448969), TW(-0.533701001807153, -0.8456732469872991),
+    TW(-0.5343494680191372, -0.8452636547419184), TW(-0.534997619887097, -0.8448535652497072),
+    TW(-0.535645457029741, -0.8444429787519108), TW(-0.5362929790659631, -0.8440318954900664),
+    TW(-0.5369401856148429, -0.843620315706004), TW(-0.5375870762956456, -0.8432082396418454),
+    TW(-0.5382336507278215, -0.8427956675400043), TW(-0.5388799085310083, -0.842382599643186),
+    TW(-0.5395258493250289, -0.8419690361943878), TW(-0.5401714727298929, -0.8415549774368984),
+    TW(-0.5408167783657967, -0.8411404236142981), TW(-0.5414617658531232, -0.8407253749704582),
+    TW(-0.5421064348124438, -0.8403098317495409), TW(-0.5427507848645158, -0.8398937941959996),
+    TW(-0.5433948156302847, -0.8394772625545786), TW(-0.5440385267308839, -0.8390602370703126),
+    TW(-0.5446819177876346, -0.8386427179885272), TW(-0.5453249884220462, -0.8382247055548382),
+    TW(-0.5459677382558175, -0.837806200015151), TW(-0.5466101669108349, -0.8373872016156619),
+    TW(-0.5472522740091741, -0.836967710602857), TW(-0.5478940591731002, -0.836547727223512),
+    TW(-0.5485355220250672, -0.8361272517246924), TW(-0.5491766621877195, -0.8357062843537527),
+    TW(-0.5498174792838908, -0.8352848253583375), TW(-0.5504579729366047, -0.8348628749863801),
+    TW(-0.5510981427690754, -0.8344404334861032), TW(-0.5517379884047074, -0.834017501106018),
+    TW(-0.5523775094670959, -0.8335940780949254), TW(-0.5530167055800274, -0.8331701647019133),
+    TW(-0.5536555763674792, -0.8327457611763596), TW(-0.5542941214536201, -0.8323208677679297),
+    TW(-0.5549323404628104, -0.8318954847265776), TW(-0.555570233019602, -0.8314696123025455),
+    TW(-0.5562077987487398, -0.8310432507463624), TW(-0.55684503727516, -0.8306164003088463),
+    TW(-0.5574819482239916, -0.8301890612411024), TW(-0.5581185312205561, -0.829761233794523),
+    TW(-0.5587547858903684, -0.8293329182207881), TW(-0.5593907118591358, -0.8289041147718651),
+    TW(-0.5600263087527603, -0.8284748237000072), TW(-0.5606615761973359, -0.8280450452577558),
+    TW(-0.5612965138191515, -0.8276147796979384), TW(-0.5619311212446895, -0.8271840272736691),
+    TW(-0.5625653981006267, -0.8267527882383485), TW(-0.563199344013834, -0.8263210628456636),
+    TW(-0.563832958611378, -0.8258888513495869), TW(-0.5644662415205194, -0.8254561540043776),
+    TW(-0.5650991923687141, -0.8250229710645802), TW(-0.5657318107836132, -0.8245893027850252),
+    TW(-0.5663640963930636, -0.8241551494208287), TW(-0.5669960488251085, -0.8237205112273915),
+    TW(-0.5676276677079861, -0.8232853884604002), TW(-0.5682589526701315, -0.8228497813758263),
+    TW(-0.5688899033401759, -0.8224136902299264), TW(-0.5695205193469473, -0.8219771152792414),
+    TW(-0.5701508003194702, -0.8215400567805977), TW(-0.5707807458869671, -0.8211025149911048),
+    TW(-0.5714103556788572, -0.8206644901681575), TW(-0.572039629324757, -0.8202259825694347),
+    TW(-0.5726685664544813, -0.8197869924528989), TW(-0.573297166698042, -0.8193475200767971),
+    TW(-0.5739254296856505, -0.8189075656996591), TW(-0.5745533550477158, -0.8184671295802988),
+    TW(-0.5751809424148452, -0.8180262119778134), TW(-0.5758081914178453, -0.8175848131515837),
+    TW(-0.5764351016877219, -0.8171429333612729), TW(-0.5770616728556793, -0.816700572866828),
+    TW(-0.5776879045531227, -0.8162577319284775), TW(-0.5783137964116555, -0.8158144108067338),
+    TW(-0.5789393480630819, -0.8153706097623913), TW(-0.5795645591394059, -0.8149263290565265),
+    TW(-0.5801894292728315, -0.8144815689504988), TW(-0.5808139580957644, -0.8140363297059485),
+    TW(-0.5814381452408102, -0.8135906115847985), TW(-0.5820619903407755, -0.8131444148492536),
+    TW(-0.5826854930286685, -0.8126977397617995), TW(-0.5833086529376984, -0.8122505865852039),
+    TW(-0.5839314697012761, -0.8118029555825156), TW(-0.5845539429530152, -0.8113548470170638),
+    TW(-0.5851760723267303, -0.8109062611524598), TW(-0.5857978574564389, -0.8104571982525948),
+    TW(-0.5864192979763606, -0.810007658581641), TW(-0.5870403935209177, -0.8095576424040515),
+    TW(-0.5876611437247365, -0.8091071499845583), TW(-0.5882815482226452, -0.8086561815881751),
+    TW(-0.5889016066496758, -0.8082047374801947), TW(-0.5895213186410639, -0.8077528179261904),
+    TW(-0.590140683832249, -0.8073004231920143), TW(-0.590759701858874, -0.8068475535437994),
+    TW(-0.5913783723567875, -0.8063942092479564), TW(-0.5919966949620409, -0.8059403905711764),
+    TW(-0.5926146693108911, -0.8054860977804291), TW(-0.5932322950397999, -0.8050313311429635),
+    TW(-0.5938495717854334, -0.8045760909263072), TW(-0.5944664991846643, -0.8041203773982658),
+    TW(-0.5950830768745698, -0.8036641908269242), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(-0.5963151816757438, -0.8027503996280692), TW(-0.5969307080621966, -0.8022927955381156),
+    TW(-0.597545883289693, -0.8018347194799814), TW(-0.5981607069963422, -0.8013761717231404),
+    TW(-0.5987751788204587, -0.8009171525373444), TW(-0.5993892984005645, -0.8004576621926228),
+    TW(-0.6000030653753892, -0.7999977009592818), TW(-0.6006164793838688, -0.7995372691079052),
+    TW(-0.6012295400651484, -0.7990763669093525), TW(-0.6018422470585799, -0.7986149946347609),
+    TW(-0.6024546000037238, -0.7981531525555439), TW(-0.6030665985403483, -0.797690840943391),
+    TW(-0.6036782423084305, -0.7972280600702687), TW(-0.6042895309481559, -0.7967648102084189),
+    TW(-0.6049004640999197, -0.7963010916303592), TW(-0.6055110414043254, -0.7958369046088836),
+    TW(-0.6061212625021862, -0.7953722494170613), TW(-0.6067311270345246, -0.7949071263282369),
+    TW(-0.6073406346425726, -0.7944415356160308), TW(-0.6079497849677735, -0.7939754775543373),
+    TW(-0.6085585776517793, -0.7935089524173267), TW(-0.6091670123364532, -0.7930419604794436),
+    TW(-0.6097750886638684, -0.7925745020154076), TW(-0.6103828062763096, -0.7921065773002123),
+    TW(-0.6109901648162716, -0.791638186609126), TW(-0.6115971639264618, -0.7911693302176903),
+    TW(-0.612203803249798, -0.7907000084017216), TW(-0.6128100824294097, -0.79023022143731),
+    TW(-0.6134160011086387, -0.789759969600819), TW(-0.6140215589310382, -0.7892892531688859),
+    TW(-0.6146267555403748, -0.7888180724184204), TW(-0.6152315905806267, -0.7883464276266063),
+    TW(-0.615836063695985, -0.7878743190709002), TW(-0.6164401745308536, -0.7874017470290313),
+    TW(-0.6170439227298499, -0.7869287117790017), TW(-0.6176473079378038, -0.7864552135990859),
+    TW(-0.61825032979976, -0.7859812527678303), TW(-0.6188529879609762, -0.785506829564054),
+    TW(-0.619455282066924, -0.7850319442668481), TW(-0.6200572117632892, -0.7845565971555751),
+    TW(-0.6206587766959719, -0.7840807885098702), TW(-0.6212599765110874, -0.7836045186096383),
+    TW(-0.6218608108549653, -0.7831277877350574), TW(-0.62246127937415, -0.7826505961665757),
+    TW(-0.6230613817154014, -0.7821729441849129), TW(-0.6236611175256946, -0.7816948320710593),
+    TW(-0.6242604864522205, -0.7812162601062762), TW(-0.6248594881423862, -0.7807372285720946),
+    TW(-0.6254581222438143, -0.7802577377503166), TW(-0.6260563884043435, -0.7797777879230144),
+    TW(-0.6266542862720295, -0.7792973793725302), TW(-0.6272518154951439, -0.7788165123814761),
+    TW(-0.6278489757221764, -0.7783351872327333), TW(-0.6284457666018326, -0.7778534042094531),
+    TW(-0.6290421877830359, -0.7773711635950563), TW(-0.6296382389149271, -0.7768884656732324),
+    TW(-0.6302339196468645, -0.7764053107279403), TW(-0.6308292296284244, -0.7759216990434078),
+    TW(-0.6314241685094016, -0.7754376309041306), TW(-0.632018735939809, -0.7749531065948739),
+    TW(-0.6326129315698775, -0.7744681264006709), TW(-0.6332067550500573, -0.7739826906068228),
+    TW(-0.633800206031017, -0.7734967994988993), TW(-0.6343932841636454, -0.7730104533627371),
+    TW(-0.6349859890990494, -0.7725236524844413), TW(-0.6355783204885561, -0.7720363971503845),
+    TW(-0.6361702779837122, -0.7715486876472063), TW(-0.6367618612362843, -0.7710605242618137),
+    TW(-0.6373530698982589, -0.7705719072813809), TW(-0.6379439036218439, -0.770082836993348),
+    TW(-0.6385343620594667, -0.769593313685423), TW(-0.6391244448637757, -0.7691033376455796),
+    TW(-0.6397141516876406, -0.7686129091620583), TW(-0.6403034821841515, -0.7681220285233655),
+    TW(-0.6408924360066212, -0.7676306960182735), TW(-0.641481012808583, -0.7671389119358205),
+    TW(-0.6420692122437925, -0.7666466765653105), TW(-0.6426570339662269, -0.7661539901963129),
+    TW(-0.643244477630086, -0.7656608531186624), TW(-0.6438315428897913, -0.7651672656224591),
+    TW(-0.6444182293999883, -0.7646732279980673), TW(-0.6450045368155439, -0.7641787405361168),
+    TW(-0.6455904647915488, -0.7636838035275019), TW(-0.6461760129833164, -0.7631884172633813),
+    TW(-0.6467611810463837, -0.7626925820351781), TW(-0.647345968636512, -0.762196298134579),
+    TW(-0.6479303754096853, -0.7616995658535354), TW(-0.6485144010221124, -0.7612023854842619),
+    TW(-0.649098045130226, -0.7607047573192369), TW(-0.6496813073906833, -0.7602066816512023),
+    TW(-0.6502641874603657, -0.7597081587731636), TW(-0.6508466849963808, -0.7592091889783882),
+    TW(-0.6514287996560597, -0.7587097725604074), TW(-0.6520105310969595, -0.7582099098130153),
+    TW(-0.6525918789768625, -0.7577096010302681), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(-0.653753422685936, -0.7567076465362458), TW(-0.6543336178318004, -0.7562060014143945),
+    TW(-0.654913428050056, -0.755703911436036), TW(-0.6554928529996155, -0.7552013768965365),
+    TW(-0.6560718923396178, -0.7546983980915244), TW(-0.6566505457294288, -0.7541949753168893),
+    TW(-0.6572288128286424, -0.7536911088687814), TW(-0.6578066932970786, -0.7531867990436125),
+    TW(-0.658384186794785, -0.7526820461380552), TW(-0.6589612929820374, -0.7521768504490427),
+    TW(-0.6595380115193384, -0.7516712122737687), TW(-0.6601143420674204, -0.7511651319096866),
+    TW(-0.6606902842872422, -0.7506586096545107), TW(-0.6612658378399922, -0.7501516458062151),
+    TW(-0.6618410023870869, -0.7496442406630335), TW(-0.6624157775901719, -0.7491363945234593),
+    TW(-0.6629901631111212, -0.7486281076862455), TW(-0.6635641586120397, -0.7481193804504037),
+    TW(-0.6641377637552599, -0.7476102131152053), TW(-0.6647109782033449, -0.7471006059801801),
+    TW(-0.6652838016190873, -0.7465905593451172), TW(-0.6658562336655095, -0.746080073510064),
+    TW(-0.6664282740058651, -0.7455691487753255), TW(-0.6669999223036374, -0.7450577854414661),
+    TW(-0.6675711782225402, -0.7445459838093074), TW(-0.6681420414265186, -0.7440337441799293),
+    TW(-0.6687125115797482, -0.743521066854669), TW(-0.6692825883466359, -0.7430079521351218),
+    TW(-0.6698522713918209, -0.7424944003231393), TW(-0.6704215603801731, -0.7419804117208311),
+    TW(-0.6709904549767942, -0.7414659866305633), TW(-0.6715589548470184, -0.740951125354959),
+    TW(-0.6721270596564115, -0.7404358281968982), TW(-0.6726947690707727, -0.7399200954595163),
+    TW(-0.673262082756133, -0.7394039274462059), TW(-0.673829000378756, -0.7388873244606152),
+    TW(-0.674395521605139, -0.7383702868066485), TW(-0.6749616461020121, -0.7378528147884659),
+    TW(-0.6755273735363384, -0.737334908710483), TW(-0.6760927035753158, -0.73681656887737),
+    TW(-0.6766576358863748, -0.7362977955940532), TW(-0.6772221701371804, -0.7357785891657135),
+    TW(-0.6777863059956315, -0.7352589498977868), TW(-0.6783500431298612, -0.7347388780959636),
+    TW(-0.6789133812082383, -0.7342183740661884), TW(-0.679476319899365, -0.7336974381146604),
+    TW(-0.6800388588720789, -0.7331760705478328), TW(-0.680600997795453, -0.7326542716724128),
+    TW(-0.6811627363387955, -0.7321320417953612), TW(-0.6817240741716496, -0.7316093812238927),
+    TW(-0.6822850109637955, -0.7310862902654744), TW(-0.682845546385248, -0.7305627692278276),
+    TW(-0.6834056801062588, -0.7300388184189263), TW(-0.6839654117973155, -0.729514438146997),
+    TW(-0.6845247411291421, -0.7289896287205195), TW(-0.6850836677727002, -0.7284643904482253),
+    TW(-0.6856421913991874, -0.7279387236390986), TW(-0.6862003116800386, -0.7274126286023758),
+    TW(-0.6867580282869259, -0.726886105647545), TW(-0.6873153408917592, -0.7263591550843459),
+    TW(-0.6878722491666853, -0.7258317772227705), TW(-0.6884287527840903, -0.7253039723730609),
+    TW(-0.688984851416597, -0.7247757408457114), TW(-0.6895405447370669, -0.7242470829514669),
+    TW(-0.6900958324186, -0.7237179990013234), TW(-0.6906507141345344, -0.7231884893065276),
+    TW(-0.6912051895584483, -0.7226585541785758), TW(-0.6917592583641576, -0.7221281939292155),
+    TW(-0.6923129202257181, -0.7215974088704438), TW(-0.6928661748174247, -0.7210661993145081),
+    TW(-0.6934190218138119, -0.7205345655739052), TW(-0.6939714608896538, -0.7200025079613818),
+    TW(-0.6945234917199654, -0.7194700267899332), TW(-0.6950751139800008, -0.7189371223728045),
+    TW(-0.6956263273452549, -0.7184037950234897), TW(-0.696177131491463, -0.7178700450557317),
+    TW(-0.696727526094601, -0.717335872783522), TW(-0.6972775108308864, -0.7168012785210996),
+    TW(-0.6978270853767772, -0.7162662625829532), TW(-0.6983762494089728, -0.7157308252838187),
+    TW(-0.6989250026044141, -0.71519496693868), TW(-0.6994733446402839, -0.714658687862769),
+    TW(-0.7000212751940061, -0.7141219883715649), TW(-0.7005687939432482, -0.7135848687807937),
+    TW(-0.7011159005659185, -0.7130473294064293), TW(-0.7016625947401685, -0.7125093705646923),
+    TW(-0.7022088761443919, -0.71197099257205), TW(-0.7027547444572251, -0.7114321957452167),
+    TW(-0.7033001993575485, -0.7108929804011519), TW(-0.7038452405244848, -0.7103533468570624),
+    TW(-0.7043898676374004, -0.709813295430401), TW(-0.7049340803759049, -0.7092728264388656),
+    TW(-0.7054778784198522, -0.7087319402004005), TW(-0.7060212614493396, -0.7081906370331955),
+    TW(-0.7065642291447094, -0.7076489172556845), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(-0.7076489172556844, -0.7065642291447095), TW(-0.7081906370331954, -0.7060212614493397),
+    TW(-0.7087319402004004, -0.7054778784198523), TW(-0.7092728264388655, -0.7049340803759051),
+    TW(-0.7098132954304007, -0.7043898676374005), TW(-0.7103533468570623, -0.703845240524485),
+    TW(-0.7108929804011517, -0.7033001993575487), TW(-0.7114321957452165, -0.7027547444572252),
+    TW(-0.7119709925720499, -0.702208876144392), TW(-0.7125093705646922, -0.7016625947401687),
+    TW(-0.7130473294064292, -0.7011159005659188), TW(-0.7135848687807936, -0.7005687939432483),
+    TW(-0.7141219883715648, -0.7000212751940063), TW(-0.7146586878627689, -0.699473344640284),
+    TW(-0.7151949669386799, -0.6989250026044143), TW(-0.7157308252838186, -0.6983762494089729),
+    TW(-0.7162662625829531, -0.6978270853767774), TW(-0.7168012785210995, -0.6972775108308865),
+    TW(-0.7173358727835218, -0.6967275260946011), TW(-0.7178700450557316, -0.6961771314914631),
+    TW(-0.7184037950234896, -0.695626327345255), TW(-0.7189371223728044, -0.695075113980001),
+    TW(-0.719470026789933, -0.6945234917199655), TW(-0.7200025079613817, -0.693971460889654),
+    TW(-0.720534565573905, -0.6934190218138121), TW(-0.721066199314508, -0.6928661748174249),
+    TW(-0.7215974088704437, -0.6923129202257183), TW(-0.7221281939292152, -0.6917592583641579),
+    TW(-0.7226585541785756, -0.6912051895584485), TW(-0.7231884893065275, -0.6906507141345346),
+    TW(-0.7237179990013233, -0.6900958324186001), TW(-0.7242470829514668, -0.689540544737067),
+    TW(-0.7247757408457112, -0.6889848514165972), TW(-0.7253039723730608, -0.6884287527840904),
+    TW(-0.7258317772227704, -0.6878722491666855), TW(-0.7263591550843458, -0.6873153408917593),
+    TW(-0.7268861056475447, -0.6867580282869261), TW(-0.7274126286023757, -0.6862003116800387),
+    TW(-0.7279387236390985, -0.6856421913991876), TW(-0.7284643904482252, -0.6850836677727004),
+    TW(-0.7289896287205194, -0.6845247411291422), TW(-0.7295144381469968, -0.6839654117973156),
+    TW(-0.730038818418926, -0.6834056801062589), TW(-0.7305627692278275, -0.6828455463852482),
+    TW(-0.7310862902654743, -0.6822850109637956), TW(-0.7316093812238926, -0.6817240741716497),
+    TW(-0.7321320417953611, -0.6811627363387956), TW(-0.7326542716724127, -0.6806009977954532),
+    TW(-0.7331760705478326, -0.680038858872079), TW(-0.7336974381146603, -0.6794763198993651),
+    TW(-0.7342183740661883, -0.6789133812082384), TW(-0.7347388780959635, -0.6783500431298614),
+    TW(-0.7352589498977866, -0.6777863059956316), TW(-0.7357785891657134, -0.6772221701371806),
+    TW(-0.7362977955940531, -0.6766576358863751), TW(-0.7368165688773699, -0.6760927035753159),
+    TW(-0.7373349087104829, -0.6755273735363386), TW(-0.7378528147884658, -0.6749616461020123),
+    TW(-0.7383702868066484, -0.6743955216051392), TW(-0.738887324460615, -0.6738290003787561),
+    TW(-0.7394039274462058, -0.6732620827561331), TW(-0.7399200954595162, -0.6726947690707729),
+    TW(-0.7404358281968981, -0.6721270596564117), TW(-0.7409511253549589, -0.6715589548470186),
+    TW(-0.7414659866305632, -0.6709904549767943), TW(-0.741980411720831, -0.6704215603801732),
+    TW(-0.7424944003231392, -0.669852271391821), TW(-0.7430079521351217, -0.669282588346636),
+    TW(-0.7435210668546689, -0.6687125115797483), TW(-0.7440337441799291, -0.6681420414265187),
+    TW(-0.7445459838093073, -0.6675711782225404), TW(-0.745057785441466, -0.6669999223036376),
+    TW(-0.7455691487753254, -0.6664282740058654), TW(-0.7460800735100639, -0.6658562336655096),
+    TW(-0.7465905593451171, -0.6652838016190874), TW(-0.74710060598018, -0.664710978203345),
+    TW(-0.7476102131152051, -0.66413776375526), TW(-0.7481193804504036, -0.6635641586120398),
+    TW(-0.7486281076862453, -0.6629901631111215), TW(-0.7491363945234591, -0.662415777590172),
+    TW(-0.7496442406630334, -0.661841002387087), TW(-0.750151645806215, -0.6612658378399924),
+    TW(-0.7506586096545106, -0.6606902842872424), TW(-0.7511651319096865, -0.6601143420674205),
+    TW(-0.7516712122737685, -0.6595380115193386), TW(-0.7521768504490425, -0.6589612929820375),
+    TW(-0.7526820461380551, -0.6583841867947853), TW(-0.7531867990436124, -0.6578066932970787),
+    TW(-0.7536911088687812, -0.6572288128286425), TW(-0.7541949753168892, -0.656650545729429),
+    TW(-0.7546983980915243, -0.6560718923396179), TW(-0.7552013768965364, -0.6554928529996156),
+    TW(-0.7557039114360359, -0.6549134280500561), TW(-0.7562060014143944, -0.6543336178318006),
+    TW(-0.7567076465362457, -0.6537534226859362), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(-0.7577096010302679, -0.6525918789768628), TW(-0.7582099098130152, -0.6520105310969597),
+    TW(-0.7587097725604073, -0.6514287996560598), TW(-0.7592091889783881, -0.650846684996381),
+    TW(-0.7597081587731634, -0.6502641874603659), TW(-0.7602066816512022, -0.6496813073906834),
+    TW(-0.7607047573192368, -0.6490980451302262), TW(-0.7612023854842617, -0.6485144010221126),
+    TW(-0.7616995658535353, -0.6479303754096855), TW(-0.7621962981345789, -0.6473459686365121),
+    TW(-0.762692582035178, -0.6467611810463838), TW(-0.763188417263381, -0.6461760129833166),
+    TW(-0.7636838035275018, -0.6455904647915489), TW(-0.7641787405361167, -0.645004536815544),
+    TW(-0.7646732279980671, -0.6444182293999884), TW(-0.765167265622459, -0.6438315428897914),
+    TW(-0.7656608531186623, -0.6432444776300861), TW(-0.7661539901963127, -0.6426570339662271),
+    TW(-0.7666466765653104, -0.6420692122437927), TW(-0.7671389119358203, -0.6414810128085832),
+    TW(-0.7676306960182734, -0.6408924360066214), TW(-0.7681220285233654, -0.6403034821841516),
+    TW(-0.7686129091620582, -0.6397141516876407), TW(-0.7691033376455795, -0.6391244448637758),
+    TW(-0.7695933136854228, -0.6385343620594669), TW(-0.7700828369933479, -0.637943903621844),
+    TW(-0.7705719072813808, -0.6373530698982591), TW(-0.7710605242618136, -0.6367618612362844),
+    TW(-0.7715486876472062, -0.6361702779837124), TW(-0.7720363971503844, -0.6355783204885562),
+    TW(-0.7725236524844412, -0.6349859890990496), TW(-0.773010453362737, -0.6343932841636455),
+    TW(-0.7734967994988992, -0.6338002060310172), TW(-0.7739826906068227, -0.6332067550500574),
+    TW(-0.7744681264006708, -0.6326129315698776), TW(-0.7749531065948738, -0.6320187359398091),
+    TW(-0.7754376309041305, -0.6314241685094019), TW(-0.7759216990434077, -0.6308292296284245),
+    TW(-0.7764053107279402, -0.6302339196468647), TW(-0.7768884656732323, -0.6296382389149272),
+    TW(-0.7773711635950562, -0.6290421877830361), TW(-0.777853404209453, -0.6284457666018327),
+    TW(-0.7783351872327332, -0.6278489757221766), TW(-0.778816512381476, -0.6272518154951441),
+    TW(-0.7792973793725301, -0.6266542862720297), TW(-0.7797777879230143, -0.6260563884043436),
+    TW(-0.7802577377503165, -0.6254581222438144), TW(-0.7807372285720945, -0.6248594881423863),
+    TW(-0.7812162601062761, -0.6242604864522207), TW(-0.7816948320710592, -0.6236611175256949),
+    TW(-0.7821729441849128, -0.6230613817154015), TW(-0.7826505961665756, -0.6224612793741501),
+    TW(-0.7831277877350573, -0.6218608108549654), TW(-0.7836045186096382, -0.6212599765110876),
+    TW(-0.7840807885098701, -0.620658776695972), TW(-0.784556597155575, -0.6200572117632894),
+    TW(-0.785031944266848, -0.6194552820669241), TW(-0.7855068295640539, -0.6188529879609764),
+    TW(-0.7859812527678302, -0.6182503297997602), TW(-0.7864552135990858, -0.6176473079378039),
+    TW(-0.7869287117790016, -0.61704392272985), TW(-0.7874017470290312, -0.6164401745308538),
+    TW(-0.7878743190709001, -0.6158360636959851), TW(-0.7883464276266062, -0.6152315905806269),
+    TW(-0.7888180724184203, -0.614626755540375), TW(-0.7892892531688858, -0.6140215589310384),
+    TW(-0.7897599696008188, -0.6134160011086388), TW(-0.7902302214373099, -0.6128100824294098),
+    TW(-0.7907000084017215, -0.6122038032497981), TW(-0.7911693302176902, -0.6115971639264619),
+    TW(-0.7916381866091259, -0.6109901648162717), TW(-0.7921065773002122, -0.6103828062763097),
+    TW(-0.7925745020154075, -0.6097750886638685), TW(-0.7930419604794435, -0.6091670123364533),
+    TW(-0.7935089524173266, -0.6085585776517796), TW(-0.7939754775543372, -0.6079497849677736),
+    TW(-0.7944415356160307, -0.6073406346425728), TW(-0.7949071263282368, -0.6067311270345247),
+    TW(-0.7953722494170612, -0.6061212625021863), TW(-0.7958369046088835, -0.6055110414043257),
+    TW(-0.7963010916303591, -0.6049004640999198), TW(-0.7967648102084188, -0.604289530948156),
+    TW(-0.7972280600702686, -0.6036782423084306), TW(-0.7976908409433909, -0.6030665985403484),
+    TW(-0.7981531525555438, -0.6024546000037239), TW(-0.7986149946347608, -0.6018422470585801),
+    TW(-0.7990763669093524, -0.6012295400651485), TW(-0.7995372691079051, -0.6006164793838689),
+    TW(-0.7999977009592817, -0.6000030653753893), TW(-0.8004576621926227, -0.5993892984005647),
+    TW(-0.8009171525373443, -0.5987751788204588), TW(-0.8013761717231402, -0.5981607069963424),
+    TW(-0.8018347194799813, -0.5975458832896932), TW(-0.8022927955381155, -0.5969307080621967),
+    TW(-0.802750399628069, -0.5963151816757439), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(-0.8036641908269241, -0.5950830768745701), TW(-0.8041203773982657, -0.5944664991846644),
+    TW(-0.8045760909263071, -0.5938495717854335), TW(-0.8050313311429634, -0.5932322950398),
+    TW(-0.805486097780429, -0.5926146693108914), TW(-0.8059403905711763, -0.591996694962041),
+    TW(-0.8063942092479562, -0.5913783723567876), TW(-0.8068475535437993, -0.5907597018588742),
+    TW(-0.8073004231920142, -0.5901406838322492), TW(-0.8077528179261902, -0.589521318641064),
+    TW(-0.8082047374801946, -0.588901606649676), TW(-0.808656181588175, -0.5882815482226453),
+    TW(-0.8091071499845582, -0.5876611437247367), TW(-0.8095576424040514, -0.587040393520918),
+    TW(-0.8100076585816409, -0.5864192979763607), TW(-0.8104571982525947, -0.585797857456439),
+    TW(-0.8109062611524597, -0.5851760723267305), TW(-0.8113548470170637, -0.5845539429530153),
+    TW(-0.8118029555825155, -0.5839314697012762), TW(-0.8122505865852038, -0.5833086529376985),
+    TW(-0.8126977397617994, -0.5826854930286686), TW(-0.8131444148492535, -0.5820619903407757),
+    TW(-0.8135906115847984, -0.5814381452408103), TW(-0.8140363297059484, -0.5808139580957645),
+    TW(-0.8144815689504987, -0.5801894292728316), TW(-0.8149263290565264, -0.579564559139406),
+    TW(-0.8153706097623912, -0.578939348063082), TW(-0.8158144108067337, -0.5783137964116557),
+    TW(-0.8162577319284774, -0.5776879045531228), TW(-0.8167005728668278, -0.5770616728556794),
+    TW(-0.8171429333612727, -0.576435101687722), TW(-0.8175848131515836, -0.5758081914178454),
+    TW(-0.8180262119778133, -0.5751809424148453), TW(-0.8184671295802987, -0.5745533550477159),
+    TW(-0.818907565699659, -0.5739254296856507), TW(-0.819347520076797, -0.5732971666980421),
+    TW(-0.8197869924528988, -0.5726685664544815), TW(-0.8202259825694346, -0.5720396293247573),
+    TW(-0.8206644901681575, -0.5714103556788573), TW(-0.8211025149911046, -0.5707807458869673),
+    TW(-0.8215400567805976, -0.5701508003194703), TW(-0.8219771152792413, -0.5695205193469475),
+    TW(-0.8224136902299263, -0.5688899033401761), TW(-0.8228497813758262, -0.5682589526701317),
+    TW(-0.8232853884604001, -0.5676276677079863), TW(-0.8237205112273914, -0.5669960488251087),
+    TW(-0.8241551494208287, -0.5663640963930637), TW(-0.8245893027850251, -0.5657318107836135),
+    TW(-0.8250229710645801, -0.5650991923687142), TW(-0.8254561540043774, -0.5644662415205195),
+    TW(-0.8258888513495868, -0.5638329586113782), TW(-0.8263210628456635, -0.5631993440138341),
+    TW(-0.8267527882383484, -0.5625653981006268), TW(-0.827184027273669, -0.5619311212446896),
+    TW(-0.8276147796979383, -0.5612965138191517), TW(-0.8280450452577557, -0.5606615761973361),
+    TW(-0.8284748237000071, -0.5600263087527604), TW(-0.828904114771865, -0.559390711859136),
+    TW(-0.829332918220788, -0.5587547858903686), TW(-0.8297612337945229, -0.5581185312205563),
+    TW(-0.8301890612411023, -0.5574819482239917), TW(-0.8306164003088463, -0.5568450372751601),
+    TW(-0.8310432507463623, -0.5562077987487399), TW(-0.8314696123025453, -0.5555702330196022),
+    TW(-0.8318954847265775, -0.5549323404628106), TW(-0.8323208677679296, -0.5542941214536202),
+    TW(-0.8327457611763595, -0.5536555763674794), TW(-0.8331701647019132, -0.5530167055800276),
+    TW(-0.8335940780949253, -0.552377509467096), TW(-0.834017501106018, -0.5517379884047077),
+    TW(-0.8344404334861031, -0.5510981427690756), TW(-0.83486287498638, -0.5504579729366049),
+    TW(-0.8352848253583374, -0.5498174792838909), TW(-0.8357062843537526, -0.5491766621877197),
+    TW(-0.8361272517246923, -0.5485355220250673), TW(-0.8365477272235119, -0.5478940591731004),
+    TW(-0.8369677106028569, -0.5472522740091742), TW(-0.8373872016156618, -0.546610166910835),
+    TW(-0.8378062000151509, -0.5459677382558176), TW(-0.8382247055548381, -0.5453249884220464),
+    TW(-0.8386427179885272, -0.5446819177876348), TW(-0.8390602370703126, -0.544038526730884),
+    TW(-0.8394772625545784, -0.5433948156302849), TW(-0.8398937941959995, -0.5427507848645159),
+    TW(-0.8403098317495408, -0.5421064348124439), TW(-0.8407253749704581, -0.5414617658531233),
+    TW(-0.841140423614298, -0.5408167783657968), TW(-0.8415549774368983, -0.540171472729893),
+    TW(-0.8419690361943877, -0.539525849325029), TW(-0.8423825996431858, -0.5388799085310084),
+    TW(-0.8427956675400042, -0.5382336507278216), TW(-0.8432082396418453, -0.5375870762956457),
+    TW(-0.8436203157060039, -0.5369401856148431), TW(-0.8440318954900664, -0.5362929790659633),
+    TW(-0.8444429787519107, -0.5356454570297411), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(-0.8452636547419183, -0.5343494680191374), TW(-0.845673246987299, -0.5337010018071532),
+    TW(-0.8460823417448969, -0.5330522216326197), TW(-0.846490938774052, -0.532403127877198),
+    TW(-0.8468990378343972, -0.5317537209227333), TW(-0.8473066386858584, -0.5311040011512549),
+    TW(-0.8477137410886542, -0.5304539689449767), TW(-0.8481203448032971, -0.5298036246862948),
+    TW(-0.8485264495905926, -0.5291529687577907), TW(-0.8489320552116396, -0.5285020015422285),
+    TW(-0.8493371614278308, -0.5278507234225552), TW(-0.8497417680008525, -0.5271991347819013),
+    TW(-0.8501458746926851, -0.5265472360035796), TW(-0.8505494812656034, -0.5258950274710849),
+    TW(-0.8509525874821757, -0.5252425095680947), TW(-0.8513551931052652, -0.524589682678469),
+    TW(-0.8517572978980291, -0.5239365471862485), TW(-0.8521589016239196, -0.5232831034756567),
+    TW(-0.852560004046684, -0.5226293519310968), TW(-0.8529606049303636, -0.5219752929371545),
+    TW(-0.8533607040392954, -0.5213209268785957), TW(-0.8537603011381114, -0.5206662541403672),
+    TW(-0.8541593959917388, -0.5200112751075959), TW(-0.8545579883654004, -0.5193559901655898),
+    TW(-0.8549560780246148, -0.5187003996998352), TW(-0.8553536647351959, -0.5180445040959994),
+    TW(-0.8557507482632539, -0.5173883037399291), TW(-0.8561473283751945, -0.5167317990176498),
+    TW(-0.8565434048377198, -0.5160749903153669), TW(-0.8569389774178287, -0.5154178780194631),
+    TW(-0.8573340458828156, -0.5147604625165012), TW(-0.857728610000272, -0.5141027441932218),
+    TW(-0.8581226695380861, -0.5134447234365435), TW(-0.8585162242644429, -0.512786400633563),
+    TW(-0.8589092739478238, -0.5121277761715549), TW(-0.8593018183570084, -0.5114688504379705),
+    TW(-0.8596938572610726, -0.5108096238204392), TW(-0.8600853904293901, -0.5101500967067668),
+    TW(-0.8604764176316322, -0.5094902694849363), TW(-0.8608669386377671, -0.5088301425431073),
+    TW(-0.8612569532180621, -0.5081697162696148), TW(-0.8616464611430813, -0.507508991052971),
+    TW(-0.8620354621836872, -0.5068479672818633), TW(-0.8624239561110405, -0.5061866453451552),
+    TW(-0.8628119426966004, -0.5055250256318853), TW(-0.863199421712124, -0.5048631085312677),
+    TW(-0.863586392929668, -0.5042008944326906), TW(-0.8639728561215867, -0.5035383837257177),
+    TW(-0.8643588110605339, -0.502875576800087), TW(-0.8647442575194624, -0.5022124740457107),
+    TW(-0.8651291952716236, -0.5015490758526756), TW(-0.865513624090569, -0.5008853826112409),
+    TW(-0.8658975437501488, -0.5002213947118408), TW(-0.866280954024513, -0.49955711254508195),
+    TW(-0.8666638546881111, -0.4988925365017446), TW(-0.8670462455156928, -0.49822766697278176),
+    TW(-0.8674281262823068, -0.49756250434931937), TW(-0.8678094967633032, -0.4968970490226547),
+    TW(-0.8681903567343312, -0.49623130138425836), TW(-0.8685707059713409, -0.49556526182577254),
+    TW(-0.8689505442505825, -0.49489893073901114), TW(-0.8693298713486066, -0.49423230851596),
+    TW(-0.8697086870422656, -0.49356539554877493), TW(-0.8700869911087113, -0.49289819222978415),
+    TW(-0.8704647833253977, -0.49223069895148613), TW(-0.870842063470079, -0.4915629161065499),
+    TW(-0.871218831320811, -0.49089484408781503), TW(-0.8715950866559509, -0.4902264832882914),
+    TW(-0.8719708292541577, -0.4895578341011576), TW(-0.8723460588943914, -0.4888888969197633),
+    TW(-0.8727207753559143, -0.4882196721376268), TW(-0.8730949784182901, -0.4875501601484359),
+    TW(-0.8734686678613848, -0.4868803613460476), TW(-0.8738418434653668, -0.4862102761244866),
+    TW(-0.8742145050107062, -0.48553990487794707), TW(-0.8745866522781761, -0.4848692480007911),
+    TW(-0.8749582850488516, -0.48419830588754903), TW(-0.8753294031041109, -0.48352707893291863),
+    TW(-0.8757000062256345, -0.4828555675317659), TW(-0.8760700941954065, -0.4821837720791229),
+    TW(-0.8764396667957136, -0.48151169297019), TW(-0.8768087238091457, -0.48083933060033396),
+    TW(-0.877177265018596, -0.48016668536508833), TW(-0.8775452902072611, -0.4794937576601533),
+    TW(-0.8779127991586417, -0.4788205478813941), TW(-0.8782797916565415, -0.4781470564248432),
+    TW(-0.8786462674850681, -0.4774732836866981), TW(-0.8790122264286335, -0.4767992300633221),
+    TW(-0.8793776682719533, -0.4761248959512435), TW(-0.8797425928000473, -0.4754502817471561),
+    TW(-0.8801069997982403, -0.4747753878479173), TW(-0.8804708890521608, -0.4741002146505501),
+    TW(-0.8808342603477419, -0.4734247625522416), TW(-0.8811971134712221, -0.47274903195034274),
+    TW(-0.8815594482091437, -0.47207302324236894), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(-0.8822825616760086, -0.47072017309907177), TW(-0.8826433399795628, -0.4700433324595957),
+    TW(-0.8830035990467808, -0.4693662153057375), TW(-0.8833633386657317, -0.46868882203582785),
+    TW(-0.8837225586247894, -0.46801115304836005), TW(-0.8840812587126349, -0.4673332087419886),
+    TW(-0.8844394387182537, -0.466654989515531), TW(-0.8847970984309378, -0.4659764957679662),
+    TW(-0.8851542376402851, -0.46529772789843454), TW(-0.8855108561361998, -0.4646186863062381),
+    TW(-0.8858669537088927, -0.46393937139083874), TW(-0.8862225301488805, -0.4632597835518603),
+    TW(-0.886577585246987, -0.46257992318908686), TW(-0.8869321187943422, -0.46189979070246273),
+    TW(-0.8872861305823833, -0.4612193864920923), TW(-0.8876396204028538, -0.4605387109582402),
+    TW(-0.8879925880478055, -0.45985776450132965), TW(-0.8883450333095962, -0.4591765475219442),
+    TW(-0.8886969559808916, -0.4584950604208263), TW(-0.8890483558546646, -0.4578133035988772),
+    TW(-0.8893992327241954, -0.45713127745715726), TW(-0.8897495863830727, -0.45644898239688414),
+    TW(-0.8900994166251922, -0.4557664188194348), TW(-0.8904487232447579, -0.4550835871263439),
+    TW(-0.8907975060362815, -0.4544004877193036), TW(-0.8911457647945833, -0.45371712100016376),
+    TW(-0.8914934993147913, -0.45303348737093185), TW(-0.8918407093923426, -0.45234958723377106),
+    TW(-0.8921873948229825, -0.4516654209910026), TW(-0.8925335554027646, -0.45098098904510386),
+    TW(-0.8928791909280518, -0.4502962917987086), TW(-0.8932243011955152, -0.4496113296546069),
+    TW(-0.8935688860021359, -0.4489261030157435), TW(-0.8939129451452031, -0.44824061228522005),
+    TW(-0.894256478422316, -0.44755485786629307), TW(-0.8945994856313827, -0.44686884016237416),
+    TW(-0.8949419665706208, -0.44618255957702996), TW(-0.8952839210385574, -0.44549601651398196),
+    TW(-0.89562534883403, -0.44480921137710505), TW(-0.8959662497561851, -0.4441221445704293),
+    TW(-0.8963066236044795, -0.4434348164981385), TW(-0.8966464701786803, -0.44274722756456997),
+    TW(-0.8969857892788639, -0.44205937817421503), TW(-0.8973245807054182, -0.4413712687317169),
+    TW(-0.8976628442590407, -0.44068289964187307), TW(-0.8980005797407398, -0.4399942713096333),
+    TW(-0.8983377869518343, -0.43930538414009995), TW(-0.8986744656939539, -0.43861623853852755),
+    TW(-0.899010615769039, -0.43792683491032314), TW(-0.8993462369793415, -0.43723717366104425),
+    TW(-0.8996813291274239, -0.4365472551964013), TW(-0.9000158920161602, -0.43585707992225553),
+    TW(-0.9003499254487357, -0.4351666482446192), TW(-0.9006834292286467, -0.434475960569656),
+    TW(-0.9010164031597022, -0.43378501730367874), TW(-0.9013488470460219, -0.43309381885315207),
+    TW(-0.9016807606920377, -0.4324023656246902), TW(-0.9020121439024932, -0.43171065802505726),
+    TW(-0.9023429964824443, -0.431018696461167), TW(-0.9026733182372587, -0.4303264813400829),
+    TW(-0.903003108972617, -0.42963401306901655), TW(-0.9033323684945118, -0.4289412920553296),
+    TW(-0.903661096609248, -0.42824831870653196), TW(-0.9039892931234433, -0.42755509343028203),
+    TW(-0.9043169578440282, -0.42686161663438676), TW(-0.9046440905782461, -0.42616788872679984),
+    TW(-0.9049706911336532, -0.42547391011562397), TW(-0.9052967593181187, -0.42477968120910886),
+    TW(-0.9056222949398253, -0.42408520241565156), TW(-0.9059472978072685, -0.42339047414379594),
+    TW(-0.9062717677292574, -0.42269549680223323), TW(-0.9065957045149153, -0.42200027079979985),
+    TW(-0.906919107973678, -0.42130479654547975), TW(-0.9072419779152958, -0.42060907444840256),
+    TW(-0.9075643141498326, -0.41991310491784356), TW(-0.907886116487666, -0.41921688836322424),
+    TW(-0.9082073847394886, -0.4185204251941099), TW(-0.9085281187163061, -0.41782371582021244),
+    TW(-0.908848318229439, -0.41712676065138793), TW(-0.9091679830905224, -0.41642956009763715),
+    TW(-0.9094871131115054, -0.41573211456910525), TW(-0.9098057081046521, -0.41503442447608185),
+    TW(-0.9101237678825416, -0.41433649022899927), TW(-0.9104412922580671, -0.4136383122384346),
+    TW(-0.9107582810444376, -0.4129398909151081), TW(-0.9110747340551764, -0.41224122666988283),
+    TW(-0.9113906511041222, -0.4115423199137655), TW(-0.9117060320054298, -0.41084317105790413),
+    TW(-0.9120208765735682, -0.4101437805135904), TW(-0.9123351846233227, -0.40944414869225765),
+    TW(-0.9126489559697939, -0.4087442760054814), TW(-0.9129621904283982, -0.4080441628649786),
+    TW(-0.9132748878148677, -0.4073438096826082), TW(-0.9135870479452508, -0.4066432168703692),
+    TW(-0.9138986706359116, -0.4059423848404026), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(-0.9145203029651044, -0.404540004776553), TW(-0.914830312237946, -0.4038384575676544),
+    TW(-0.9151397833396852, -0.40313667279099547), TW(-0.9154487160882677, -0.4024346508594186),
+    TW(-0.9157571103019567, -0.40173239218590506), TW(-0.9160649657993317, -0.4010298971835756),
+    TW(-0.9163722823992891, -0.40032716626569), TW(-0.9166790599210426, -0.39962419984564707),
+    TW(-0.9169852981841229, -0.3989209983369831), TW(-0.9172909970083779, -0.39821756215337367),
+    TW(-0.9175961562139728, -0.3975138917086324), TW(-0.9179007756213905, -0.39680998741671025),
+    TW(-0.9182048550514308, -0.3961058496916966), TW(-0.9185083943252121, -0.3954014789478165),
+    TW(-0.9188113932641699, -0.3946968755994337), TW(-0.9191138516900578, -0.39399204006104815),
+    TW(-0.919415769424947, -0.3932869727472964), TW(-0.9197171462912274, -0.3925816740729514),
+    TW(-0.9200179821116065, -0.39187614445292257), TW(-0.9203182767091105, -0.39117038430225404),
+    TW(-0.9206180299070839, -0.3904643940361267), TW(-0.9209172415291894, -0.38975817406985647),
+    TW(-0.9212159113994087, -0.38905172481889433), TW(-0.9215140393420418, -0.3883450466988266),
+    TW(-0.921811625181708, -0.38763814012537295), TW(-0.9221086687433451, -0.38693100551438875),
+    TW(-0.9224051698522099, -0.38622364328186304), TW(-0.9227011283338786, -0.38551605384391885),
+    TW(-0.9229965440142464, -0.38480823761681276), TW(-0.9232914167195275, -0.3841001950169353),
+    TW(-0.9235857462762566, -0.38339192646080883), TW(-0.9238795325112867, -0.3826834323650899),
+    TW(-0.9241727752517911, -0.3819747131465673), TW(-0.9244654743252626, -0.3812657692221623),
+    TW(-0.9247576295595138, -0.38055660100892885), TW(-0.9250492407826775, -0.3798472089240514),
+    TW(-0.9253403078232062, -0.3791375933848475), TW(-0.9256308305098727, -0.37842775480876567),
+    TW(-0.9259208086717701, -0.37771769361338564), TW(-0.9262102421383114, -0.37700741021641815),
+    TW(-0.9264991307392304, -0.37629690503570506), TW(-0.9267874743045817, -0.3755861784892174),
+    TW(-0.9270752726647401, -0.37487523099505765), TW(-0.9273625256504011, -0.37416406297145804),
+    TW(-0.9276492330925812, -0.37345267483678024), TW(-0.9279353948226178, -0.3727410670095161),
+    TW(-0.9282210106721693, -0.37202923990828524), TW(-0.9285060804732155, -0.3713171939518377),
+    TW(-0.9287906040580569, -0.3706049295590517), TW(-0.9290745812593157, -0.3698924471489341),
+    TW(-0.9293580119099356, -0.3691797471406199), TW(-0.9296408958431812, -0.3684668299533726),
+    TW(-0.9299232328926396, -0.36775369600658214), TW(-0.9302050228922191, -0.3670403457197673),
+    TW(-0.9304862656761497, -0.36632677951257364), TW(-0.9307669610789837, -0.3656129978047738),
+    TW(-0.9310471089355952, -0.3648990010162676), TW(-0.9313267090811803, -0.3641847895670801),
+    TW(-0.9316057613512578, -0.3634703638773639), TW(-0.931884265581668, -0.3627557243673973),
+    TW(-0.9321622216085744, -0.3620408714575842), TW(-0.9324396292684625, -0.3613258055684542),
+    TW(-0.9327164883981401, -0.36061052712066255), TW(-0.9329927988347388, -0.35989503653498833),
+    TW(-0.9332685604157119, -0.3591793342323366), TW(-0.9335437729788362, -0.3584634206337366),
+    TW(-0.933818436362211, -0.35774729616034184), TW(-0.9340925504042588, -0.3570309612334303),
+    TW(-0.9343661149437258, -0.3563144162744026), TW(-0.9346391298196807, -0.355597661704784),
+    TW(-0.9349115948715161, -0.35488069794622285), TW(-0.9351835099389476, -0.3541635254204904),
+    TW(-0.9354548748620147, -0.3534461445494807), TW(-0.9357256894810803, -0.35272855575521095),
+    TW(-0.9359959536368313, -0.3520107594598193), TW(-0.9362656671702783, -0.3512927560855672),
+    TW(-0.9365348299227555, -0.3505745460548376), TW(-0.9368034417359217, -0.34985612979013486),
+    TW(-0.9370715024517591, -0.34913750771408525), TW(-0.9373390119125748, -0.3484186802494348),
+    TW(-0.937605969961, -0.34769964781905155), TW(-0.9378723764399898, -0.34698041084592374),
+    TW(-0.9381382311928244, -0.34626096975316), TW(-0.9384035340631082, -0.345541324963989),
+    TW(-0.93866828489477, -0.34482147690175957), TW(-0.9389324835320645, -0.34410142598993904),
+    TW(-0.9391961298195698, -0.34338117265211515), TW(-0.9394592236021899, -0.34266071731199443),
+    TW(-0.9397217647251533, -0.3419400603934022), TW(-0.9399837530340138, -0.3412192023202827),
+    TW(-0.9402451883746508, -0.3404981435166974), TW(-0.9405060705932683, -0.339776884406827),
+    TW(-0.9407663995363961, -0.3390554254149697), TW(-0.9410261750508893, -0.3383337669655412),
+    TW(-0.9412853969839288, -0.3376119094830745), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(-0.9418021794959976, -0.33616759911774474), TW(-0.9420597397710173, -0.3354451470845317),
+    TW(-0.9423167458565638, -0.3347224977175813), TW(-0.9425731976014469, -0.3339996514420094),
+    TW(-0.9428290948548026, -0.3332766086830482), TW(-0.9430844374660934, -0.33255336986604445),
+    TW(-0.9433392252851077, -0.3318299354164613), TW(-0.9435934581619604, -0.3311063057598765),
+    TW(-0.9438471359470927, -0.3303824813219828), TW(-0.9441002584912727, -0.32965846252858744),
+    TW(-0.9443528256455946, -0.3289342498056125), TW(-0.9446048372614801, -0.3282098435790927),
+    TW(-0.9448562931906772, -0.3274852442751781), TW(-0.9451071932852606, -0.32676045232013184),
+    TW(-0.9453575373976323, -0.3260354681403302), TW(-0.9456073253805212, -0.32531029216226326),
+    TW(-0.9458565570869838, -0.32458492481253237), TW(-0.9461052323704033, -0.323859366517853),
+    TW(-0.9463533510844906, -0.3231336177050524), TW(-0.9466009130832835, -0.32240767880106985),
+    TW(-0.9468479182211481, -0.32168155023295647), TW(-0.9470943663527771, -0.3209552324278755),
+    TW(-0.9473402573331919, -0.3202287258131001), TW(-0.9475855910177411, -0.3195020308160158),
+    TW(-0.947830367262101, -0.31877514786411854), TW(-0.9480745859222762, -0.3180480773850149),
+    TW(-0.948318246854599, -0.31732081980642207), TW(-0.9485613499157303, -0.31659337555616607),
+    TW(-0.9488038949626584, -0.3158657450621841), TW(-0.9490458818527006, -0.3151379287525225),
+    TW(-0.9492873104435021, -0.31440992705533666), TW(-0.9495281805930367, -0.3136817403988914),
+    TW(-0.9497684921596066, -0.3129533692115605), TW(-0.950008245001843, -0.3122248139218251),
+    TW(-0.9502474389787052, -0.311496074958276), TW(-0.9504860739494817, -0.31076715274961153),
+    TW(-0.9507241497737896, -0.31003804772463783), TW(-0.950961666311575, -0.309308760312269),
+    TW(-0.9511986234231132, -0.3085792909415253), TW(-0.9514350209690083, -0.30784964004153503),
+    TW(-0.9516708588101938, -0.30711980804153316), TW(-0.9519061368079323, -0.3063897953708609),
+    TW(-0.9521408548238158, -0.30565960245896606), TW(-0.9523750127197658, -0.30492922973540265),
+    TW(-0.9526086103580332, -0.30419867762982933), TW(-0.9528416476011986, -0.3034679465720114),
+    TW(-0.9530741243121722, -0.30273703699181925), TW(-0.9533060403541939, -0.30200594931922803),
+    TW(-0.9535373955908332, -0.3012746839843183), TW(-0.9537681898859902, -0.3005432414172737),
+    TW(-0.9539984231038945, -0.2998116220483835), TW(-0.9542280951091056, -0.29907982630804053),
+    TW(-0.9544572057665135, -0.2983478546267414), TW(-0.9546857549413383, -0.29761570743508614),
+    TW(-0.9549137424991304, -0.29688338516377855), TW(-0.9551411683057707, -0.296150888243624),
+    TW(-0.9553680322274702, -0.2954182171055321), TW(-0.9555943341307711, -0.2946853721805144),
+    TW(-0.9558200738825454, -0.2939523538996846), TW(-0.9560452513499963, -0.29321916269425896),
+    TW(-0.956269866400658, -0.2924857989955541), TW(-0.956493918902395, -0.29175226323498943),
+    TW(-0.956717408723403, -0.29101855584408515), TW(-0.9569403357322088, -0.2902846772544624),
+    TW(-0.9571626997976702, -0.28955062789784297), TW(-0.9573845007889759, -0.28881640820604976),
+    TW(-0.9576057385756462, -0.28808201861100435), TW(-0.9578264130275329, -0.2873474595447296),
+    TW(-0.9580465240148185, -0.28661273143934785), TW(-0.9582660714080177, -0.28587783472708056),
+    TW(-0.9584850550779761, -0.285142769840249), TW(-0.9587034748958715, -0.2844075372112721),
+    TW(-0.9589213307332131, -0.2836721372726686), TW(-0.9591386224618419, -0.28293657045705545),
+    TW(-0.9593553499539308, -0.28220083719714756), TW(-0.9595715130819845, -0.2814649379257579),
+    TW(-0.9597871117188399, -0.28072887307579747), TW(-0.9600021457376658, -0.27999264308027344),
+    TW(-0.9602166150119634, -0.2792562483722913), TW(-0.9604305194155658, -0.27851968938505317),
+    TW(-0.9606438588226386, -0.27778296655185764), TW(-0.9608566331076795, -0.27704608030610023),
+    TW(-0.9610688421455192, -0.2763090310812713), TW(-0.9612804858113206, -0.2755718193109583),
+    TW(-0.961491563980579, -0.274834445428844), TW(-0.9617020765291225, -0.2740969098687064),
+    TW(-0.9619120233331122, -0.2733592130644187), TW(-0.9621214042690415, -0.27262135544994925),
+    TW(-0.9623302192137374, -0.27188333745935994), TW(-0.9625384680443592, -0.2711451595268081),
+    TW(-0.9627461506383994, -0.2704068220865449), TW(-0.9629532668736839, -0.2696683255729151),
+    TW(-0.9631598166283714, -0.2689296704203576), TW(-0.9633657997809539, -0.2681908570634034),
+    TW(-0.9635712162102572, -0.26745188593667785), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(-0.9639803484159941, -0.2659734721128756), TW(-0.9641840639517458, -0.26523403028551173),
+    TW(-0.9643872122828542, -0.2644944324278019), TW(-0.9645897932898126, -0.26375467897483157),
+    TW(-0.9647918068534478, -0.2630147703617791), TW(-0.9649932528549203, -0.2622747070239137),
+    TW(-0.9651941311757247, -0.26153448939659546), TW(-0.9653944416976893, -0.26079411791527585),
+    TW(-0.9655941843029767, -0.2600535930154954), TW(-0.9657933588740836, -0.2593129151328864),
+    TW(-0.9659919652938406, -0.25857208470317045), TW(-0.9661900034454125, -0.257831102162159),
+    TW(-0.9663874732122989, -0.25708996794575306), TW(-0.966584374478333, -0.2563486824899432),
+    TW(-0.9667807071276833, -0.2556072462308076), TW(-0.9669764710448521, -0.2548656596045147),
+    TW(-0.9671716661146765, -0.2541239230473207), TW(-0.9673662922223285, -0.2533820369955701),
+    TW(-0.9675603492533144, -0.25264000188569585), TW(-0.9677538370934754, -0.2518978181542172),
+    TW(-0.9679467556289878, -0.2511554862377421), TW(-0.9681391047463623, -0.25041300657296534),
+    TW(-0.9683308843324452, -0.24967037959666857), TW(-0.9685220942744174, -0.2489276057457201),
+    TW(-0.9687127344597947, -0.24818468545707506), TW(-0.9689028047764289, -0.2474416191677735),
+    TW(-0.9690923051125061, -0.24669840731494258), TW(-0.9692812353565484, -0.24595505033579465),
+    TW(-0.9694695953974131, -0.24521154866762754), TW(-0.9696573851242923, -0.24446790274782448),
+    TW(-0.9698446044267148, -0.2437241130138524), TW(-0.970031253194544, -0.24298017990326407),
+    TW(-0.9702173313179792, -0.24223610385369612), TW(-0.9704028386875555, -0.24149188530286936),
+    TW(-0.9705877751941436, -0.24074752468858837), TW(-0.9707721407289502, -0.24000302244874178),
+    TW(-0.970955935183518, -0.23925837902130018), TW(-0.9711391584497251, -0.23851359484431855),
+    TW(-0.9713218104197862, -0.23776867035593427), TW(-0.9715038909862518, -0.23702360599436717),
+    TW(-0.9716854000420084, -0.2362784021979199), TW(-0.9718663374802793, -0.23553305940497574),
+    TW(-0.9720467031946234, -0.23478757805400113), TW(-0.9722264970789363, -0.2340419585835435),
+    TW(-0.9724057190274498, -0.23329620143223162), TW(-0.9725843689347322, -0.23255030703877516),
+    TW(-0.9727624466956885, -0.23180427584196506), TW(-0.9729399522055601, -0.23105810828067133),
+    TW(-0.9731168853599251, -0.23031180479384558), TW(-0.9732932460546982, -0.22956536582051892),
+    TW(-0.9734690341861311, -0.2288187917998022), TW(-0.9736442496508119, -0.22807208317088606),
+    TW(-0.9738188923456661, -0.2273252403730391), TW(-0.9739929621679558, -0.22657826384561017),
+    TW(-0.9741664590152803, -0.22583115402802625), TW(-0.9743393827855759, -0.22508391135979283),
+    TW(-0.9745117333771158, -0.22433653628049355), TW(-0.9746835106885107, -0.2235890292297903),
+    TW(-0.9748547146187084, -0.22284139064742134), TW(-0.9750253450669941, -0.22209362097320365),
+    TW(-0.9751954019329904, -0.2213457206470309), TW(-0.975364885116657, -0.2205976901088735),
+    TW(-0.9755337945182913, -0.21984952979877903), TW(-0.9757021300385285, -0.21910124015687005),
+    TW(-0.975869891578341, -0.2183528216233465), TW(-0.976037079039039, -0.21760427463848372),
+    TW(-0.9762036923222706, -0.21685559964263262), TW(-0.9763697313300211, -0.21610679707621944),
+    TW(-0.9765351959646144, -0.21535786737974583), TW(-0.9767000861287117, -0.21460881099378698),
+    TW(-0.9768644017253126, -0.2138596283589939), TW(-0.9770281426577544, -0.21311031991609142),
+    TW(-0.9771913088297123, -0.21236088610587842), TW(-0.9773539001452, -0.2116113273692279),
+    TW(-0.9775159165085692, -0.2108616441470851), TW(-0.9776773578245099, -0.2101118368804698),
+    TW(-0.9778382239980504, -0.20936190601047425), TW(-0.9779985149345571, -0.2086118519782635),
+    TW(-0.978158230539735, -0.207861675225075), TW(-0.9783173707196275, -0.20711137619221884),
+    TW(-0.9784759353806168, -0.20636095532107573), TW(-0.9786339244294231, -0.20561041305309938),
+    TW(-0.9787913377731057, -0.20485974982981447), TW(-0.9789481753190622, -0.20410896609281684),
+    TW(-0.9791044369750291, -0.20335806228377365), TW(-0.979260122649082, -0.20260703884442138),
+    TW(-0.9794152322496348, -0.20185589621656821), TW(-0.9795697656854405, -0.201104634842092),
+    TW(-0.9797237228655912, -0.20035325516294047), TW(-0.9798771036995176, -0.19960175762113092),
+    TW(-0.98002990809699, -0.1988501426587504), TW(-0.9801821359681173, -0.1980984107179538),
+    TW(-0.980333787223348, -0.19734656224096606), TW(-0.9804848617734694, -0.19659459767008028),
+    TW(-0.9806353595296081, -0.19584251744765785), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(-0.9809346243061416, -0.19433801181798888), TW(-0.9810833911504866, -0.1935855872958038),
+    TW(-0.9812315808487496, -0.19283304889220534), TW(-0.9813791933137546, -0.19208039704989247),
+    TW(-0.9815262284586648, -0.19132763221163082), TW(-0.9816726861969831, -0.19057475482025307),
+    TW(-0.9818185664425525, -0.18982176531865666), TW(-0.9819638691095552, -0.18906866414980636),
+    TW(-0.9821085941125135, -0.18831545175673217), TW(-0.9822527413662894, -0.18756212858252957),
+    TW(-0.9823963107860847, -0.18680869507035916), TW(-0.9825393022874412, -0.1860551516634469),
+    TW(-0.9826817157862409, -0.1853014988050821), TW(-0.9828235511987052, -0.1845477369386197),
+    TW(-0.9829648084413964, -0.18379386650747848), TW(-0.9831054874312163, -0.1830398879551409),
+    TW(-0.9832455880854071, -0.1822858017251536), TW(-0.9833851103215512, -0.18153160826112522),
+    TW(-0.9835240540575713, -0.18077730800672873), TW(-0.9836624192117303, -0.18002290140569957),
+    TW(-0.9838002057026316, -0.17926838890183572), TW(-0.9839374134492189, -0.17851377093899742),
+    TW(-0.9840740423707764, -0.17775904796110742), TW(-0.984210092386929, -0.17700422041214894),
+    TW(-0.9843455634176419, -0.176249288736168), TW(-0.9844804553832209, -0.17549425337727145),
+    TW(-0.9846147682043126, -0.17473911477962714), TW(-0.9847485018019042, -0.17398387338746413),
+    TW(-0.9848816560973237, -0.17322852964507054), TW(-0.9850142310122398, -0.17247308399679612),
+    TW(-0.9851462264686621, -0.17171753688705002), TW(-0.9852776423889412, -0.17096188876030122),
+    TW(-0.9854084786957684, -0.17020614006107795), TW(-0.9855387353121761, -0.1694502912339682),
+    TW(-0.9856684121615376, -0.1686943427236175), TW(-0.9857975091675674, -0.16793829497473128),
+    TW(-0.9859260262543211, -0.16718214843207296), TW(-0.9860539633461954, -0.16642590354046405),
+    TW(-0.9861813203679282, -0.16566956074478442), TW(-0.9863080972445986, -0.16491312048997014),
+    TW(-0.9864342939016271, -0.16415658322101598), TW(-0.9865599102647754, -0.16339994938297328),
+    TW(-0.9866849462601467, -0.1626432194209503), TW(-0.9868094018141855, -0.16188639378011174),
+    TW(-0.9869332768536777, -0.16112947290567906), TW(-0.987056571305751, -0.16037245724292845),
+    TW(-0.9871792850978743, -0.15961534723719314), TW(-0.9873014181578584, -0.15885814333386147),
+    TW(-0.9874229704138554, -0.15810084597837695), TW(-0.9875439417943592, -0.15734345561623855),
+    TW(-0.9876643322282057, -0.15658597269299865), TW(-0.9877841416445722, -0.15582839765426537),
+    TW(-0.9879033699729778, -0.1550707309457006), TW(-0.9880220171432835, -0.15431297301302008),
+    TW(-0.9881400830856926, -0.15355512430199336), TW(-0.9882575677307495, -0.15279718525844369),
+    TW(-0.9883744710093413, -0.15203915632824624), TW(-0.9884907928526966, -0.1512810379573303),
+    TW(-0.9886065331923864, -0.15052283059167743), TW(-0.9887216919603238, -0.14976453467732145),
+    TW(-0.9888362690887634, -0.14900615066034878), TW(-0.988950264510303, -0.14824767898689625),
+    TW(-0.9890636781578815, -0.14748912010315374), TW(-0.989176509964781, -0.1467304744553618),
+    TW(-0.9892887598646252, -0.1459717424898122), TW(-0.9894004277913804, -0.14521292465284735),
+    TW(-0.9895115136793552, -0.14445402139086072), TW(-0.9896220174632008, -0.14369503315029464),
+    TW(-0.9897319390779106, -0.14293596037764278), TW(-0.9898412784588205, -0.1421768035194481),
+    TW(-0.989950035541609, -0.14141756302230296), TW(-0.990058210262297, -0.14065823933284954),
+    TW(-0.9901658025572484, -0.13989883289777744), TW(-0.9902728123631691, -0.13913934416382634),
+    TW(-0.9903792396171082, -0.13837977357778394), TW(-0.9904850842564571, -0.13762012158648604),
+    TW(-0.9905903462189501, -0.1368603886368163), TW(-0.9906950254426646, -0.13610057517570648),
+    TW(-0.9907991218660203, -0.1353406816501344), TW(-0.99090263542778, -0.13458070850712628),
+    TW(-0.9910055660670494, -0.13382065619375477), TW(-0.9911079137232769, -0.133060525157139),
+    TW(-0.991209678336254, -0.132300315844445), TW(-0.9913108598461154, -0.13154002870288334),
+    TW(-0.9914114581933385, -0.13077966417971187), TW(-0.9915114733187439, -0.13001922272223343),
+    TW(-0.9916109051634954, -0.1292587047777961), TW(-0.9917097536690995, -0.12849811079379309),
+    TW(-0.9918080187774064, -0.12773744121766256), TW(-0.9919057004306093, -0.12697669649688606),
+    TW(-0.9920027985712445, -0.12621587707899046), TW(-0.9920993131421918, -0.12545498341154626),
+    TW(-0.9921952440866739, -0.1246940159421676), TW(-0.9922905913482573, -0.12393297511851248),
+    TW(-0.9923853548708517, -0.1231718613882807), TW(-0.99247953459871, -0.12241067519921635),
+    TW(-0.9925731304764288, -0.1216494169991056), TW(-0.992666142448948, -0.12088808723577706),
+    TW(-0.9927585704615511, -0.12012668635710141), TW(-0.9928504144598651, -0.11936521481099163),
+    TW(-0.9929416743898605, -0.1186036730454009), TW(-0.9930323501978514, -0.11784206150832509),
+    TW(-0.9931224418304956, -0.1170803806478006), TW(-0.9932119492347945, -0.11631863091190471),
+    TW(-0.9933008723580933, -0.11555681274875558), TW(-0.9933892111480807, -0.1147949266065103),
+    TW(-0.9934769655527892, -0.11403297293336735), TW(-0.9935641355205953, -0.11327095217756442),
+    TW(-0.9936507210002191, -0.11250886478737868), TW(-0.9937367219407246, -0.1117467112111265),
+    TW(-0.9938221382915197, -0.11098449189716365), TW(-0.9939069700023561, -0.11022220729388324),
+    TW(-0.9939912170233294, -0.1094598578497181), TW(-0.9940748793048794, -0.10869744401313874),
+    TW(-0.9941579567977897, -0.1079349662326536), TW(-0.9942404494531879, -0.10717242495680916),
+    TW(-0.9943223572225458, -0.1064098206341879), TW(-0.9944036800576791, -0.10564715371341075),
+    TW(-0.9944844179107476, -0.10488442464313502), TW(-0.9945645707342554, -0.10412163387205457),
+    TW(-0.9946441384810507, -0.10335878184889953), TW(-0.9947231211043257, -0.10259586902243656),
+    TW(-0.9948015185576171, -0.10183289584146672), TW(-0.9948793307948056, -0.10106986275482793),
+    TW(-0.9949565577701164, -0.10030677021139289), TW(-0.9950331994381186, -0.09954361866006928),
+    TW(-0.9951092557537261, -0.09878040854979994), TW(-0.9951847266721968, -0.09801714032956083),
+    TW(-0.9952596121491333, -0.09725381444836342), TW(-0.9953339121404823, -0.09649043135525266),
+    TW(-0.9954076266025349, -0.09572699149930716), TW(-0.9954807554919269, -0.09496349532963891),
+    TW(-0.9955532987656385, -0.09419994329539348), TW(-0.9956252563809943, -0.09343633584574797),
+    TW(-0.9956966282956635, -0.09267267342991342), TW(-0.9957674144676598, -0.09190895649713275),
+    TW(-0.9958376148553416, -0.09114518549668096), TW(-0.9959072294174117, -0.09038136087786529),
+    TW(-0.9959762581129178, -0.0896174830900232), TW(-0.996044700901252, -0.08885355258252475),
+    TW(-0.9961125577421511, -0.08808956980477058), TW(-0.996179828595697, -0.08732553520619206),
+    TW(-0.9962465134223155, -0.08656144923625107), TW(-0.996312612182778, -0.08579731234444016),
+    TW(-0.9963781248382002, -0.08503312498028047), TW(-0.9964430513500426, -0.08426888759332418),
+    TW(-0.9965073916801108, -0.08350460063315246), TW(-0.9965711457905548, -0.08274026454937564),
+    TW(-0.9966343136438699, -0.08197587979163339), TW(-0.9966968952028961, -0.08121144680959266),
+    TW(-0.996758890430818, -0.08044696605295015), TW(-0.9968202992911657, -0.0796824379714302),
+    TW(-0.9968811217478138, -0.07891786301478494), TW(-0.9969413577649822, -0.07815324163279415),
+    TW(-0.9970010073072353, -0.07738857427526533), TW(-0.997060070339483, -0.07662386139203169),
+    TW(-0.99711854682698, -0.07585910343295456), TW(-0.9971764367353261, -0.07509430084792135),
+    TW(-0.9972337400304663, -0.07432945408684571), TW(-0.9972904566786902, -0.07356456359966773),
+    TW(-0.9973465866466331, -0.07279962983635191), TW(-0.9974021299012753, -0.07203465324688947),
+    TW(-0.9974570864099419, -0.07126963428129648), TW(-0.9975114561403035, -0.07050457338961386),
+    TW(-0.9975652390603758, -0.06973947102190721), TW(-0.9976184351385196, -0.06897432762826702),
+    TW(-0.997671044343441, -0.06820914365880651), TW(-0.9977230666441916, -0.06744391956366418),
+    TW(-0.9977745020101678, -0.0666786557930016), TW(-0.9978253504111116, -0.06591335279700376),
+    TW(-0.9978756118171102, -0.06514801102587914), TW(-0.997925286198596, -0.0643826309298577),
+    TW(-0.997974373526347, -0.06361721295919325), TW(-0.9980228737714862, -0.06285175756416149),
+    TW(-0.9980707869054823, -0.06208626519506009), TW(-0.9981181129001492, -0.06132073630220849),
+    TW(-0.9981648517276462, -0.060555171335948066), TW(-0.9982110033604782, -0.05978957074664007),
+    TW(-0.9982565677714952, -0.05902393498466805), TW(-0.9983015449338929, -0.058258264500435794),
+    TW(-0.9983459348212124, -0.057492559744367525), TW(-0.9983897374073402, -0.05672682116690807),
+    TW(-0.9984329526665084, -0.055961049218520804), TW(-0.9984755805732948, -0.055195244349690094),
+    TW(-0.9985176211026221, -0.05442940701091921), TW(-0.9985590742297593, -0.05366353765273052),
+    TW(-0.9985999399303204, -0.05289763672566524), TW(-0.9986402181802652, -0.052131704680283594),
+    TW(-0.9986799089558991, -0.051365741967162794), TW(-0.9987190122338729, -0.05059974903689939),
+    TW(-0.9987575279911833, -0.04983372634010732), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(-0.998832796853528, -0.04830159344948046), TW(-0.9988695499142836, -0.04753548415695954),
+    TW(-0.9989057153658183, -0.04676934690053802), TW(-0.9989412931868569, -0.046003182130914706),
+    TW(-0.9989762833564698, -0.04523699029880458), TW(-0.9990106858540734, -0.044470771854938584),
+    TW(-0.9990445006594293, -0.0437045272500637), TW(-0.9990777277526454, -0.04293825693494102),
+    TW(-0.9991103671141749, -0.042171961360348065), TW(-0.9991424187248169, -0.041405640977076774),
+    TW(-0.9991738825657164, -0.040639296235933695), TW(-0.9992047586183639, -0.03987292758774013),
+    TW(-0.9992350468645959, -0.039106535483330124), TW(-0.9992647472865944, -0.038340120373552854),
+    TW(-0.9992938598668877, -0.03757368270927058), TW(-0.9993223845883495, -0.03680722294135883),
+    TW(-0.9993503214341994, -0.03604074152070614), TW(-0.9993776703880028, -0.03527423889821423),
+    TW(-0.9994044314336713, -0.03450771552479595), TW(-0.9994306045554617, -0.033741171851377705),
+    TW(-0.9994561897379773, -0.03297460832889738), TW(-0.999481186966167, -0.032208025408304544),
+    TW(-0.9995055962253253, -0.03144142354056063), TW(-0.9995294175010931, -0.030674803176636865),
+    TW(-0.999552650779457, -0.029908164767516718), TW(-0.9995752960467492, -0.029141508764193802),
+    TW(-0.9995973532896484, -0.028374835617672095), TW(-0.9996188224951786, -0.02760814577896566),
+    TW(-0.9996397036507102, -0.026841439699098812), TW(-0.9996599967439592, -0.0260747178291041),
+    TW(-0.9996797017629879, -0.02530798062002469), TW(-0.9996988186962042, -0.024541228522912326),
+    TW(-0.9997173475323622, -0.023774461988827513), TW(-0.9997352882605617, -0.023007681468839695),
+    TW(-0.9997526408702488, -0.0222408874140252), TW(-0.9997694053512153, -0.021474080275469667),
+    TW(-0.9997855816935992, -0.020707260504265974), TW(-0.9998011698878843, -0.019940428551514438),
+    TW(-0.9998161699249004, -0.01917358486832254), TW(-0.9998305817958234, -0.0184067299058051),
+    TW(-0.9998444054921752, -0.017639864115082258), TW(-0.9998576410058239, -0.016872987947281835),
+    TW(-0.999870288328983, -0.016106101853537325), TW(-0.9998823474542126, -0.01533920628498806),
+    TW(-0.9998938183744185, -0.014572301692779387), TW(-0.9999047010828528, -0.013805388528060632),
+    TW(-0.9999149955731135, -0.013038467241987494), TW(-0.9999247018391445, -0.012271538285720007),
+    TW(-0.999933819875236, -0.011504602110422715), TW(-0.9999423496760239, -0.01073765916726441),
+    TW(-0.9999502912364905, -0.009970709907418312), TW(-0.9999576445519639, -0.00920375478206002),
+    TW(-0.9999644096181183, -0.008436794242369922), TW(-0.9999705864309741, -0.007669828739531138),
+    TW(-0.9999761749868976, -0.006902858724729716), TW(-0.9999811752826011, -0.006135884649154799),
+    TW(-0.9999855873151432, -0.005368906963996586), TW(-0.9999894110819284, -0.004601926120448733),
+    TW(-0.9999926465807072, -0.0038349425697063095), TW(-0.9999952938095762, -0.003067956762965977),
+    TW(-0.9999973527669782, -0.0023009691514257256), TW(-0.9999988234517019, -0.0015339801862850493),
+    TW(-0.9999997058628822, -0.0007669903187429077), TW(-1.0, -1.2246467991473532e-16),
+};
+
+static const kiss_fft_index swaps_128[48] = {
+    1, 16, 2, 32, 3, 48, 5, 20, 6, 36, 7, 52, 9, 24, 10, 40,
+    11, 56, 13, 28, 14, 44, 15, 60, 18, 33, 19, 49, 22, 37, 23, 53,
+    26, 41, 27, 57, 30, 45, 31, 61, 35, 50, 39, 54, 43, 58, 47, 62,
+};
+
+static const fft_window_t window_128[64] = {
+    WIN(-1.3877787807814457e-17), WIN(0.0002204846265978777), WIN(0.0008842693835267035), WIN(0.0019983131175448227),
+    WIN(0.0035741016484718557), WIN(0.005627480629291803), WIN(0.008178424032046938), WIN(0.011250740711563609),
+    WIN(0.014871722157515851), WIN(0.01907173517278627), WIN(0.02388376380625158), WIN(0.02934290541510913),
+    WIN(0.035485826230191524), WIN(0.04235018224239892), WIN(0.04997401161493553), WIN(0.05839510515057767),
+    WIN(0.0676503616024359), WIN(0.07777513480795592), WIN(0.08880257974726191), WIN(0.1007630046770813),
+    WIN(0.11368323646983279), WIN(0.12758600619410676), WIN(0.14248936180856675), WIN(0.158406114607757),
+    WIN(0.17534332575763534), WIN(0.19330183889372324), WIN(0.2122758643290849), WIN(0.23225261993701163),
+    WIN(0.25321203323896724), WIN(0.2751265086472146), WIN(0.2979607631892459), WIN(0.32167173338371524),
+    WIN(0.3462085552514348), WIN(0.37151261873683383), WIN(0.39751769709198925), WIN(0.424150151043997),
+    WIN(0.45132920683420763), WIN(0.4789673064918618), WIN(0.506970527992046), WIN(0.5352390722556231),
+    WIN(0.5636678132836843), WIN(0.5921469070876366), WIN(0.6205624544845052), WIN(0.6487972122812107),
+    WIN(0.6767313468768822), WIN(0.7042432238735404), WIN(0.7312102269071385), WIN(0.7575095985966889),
+    WIN(0.7830192962622085), WIN(0.8076188548849877), WIN(0.8311902496779788), WIN(0.8536187506011261),
+    WIN(0.8747937611965372), WIN(0.8946096342312827), WIN(0.9129664568203135), WIN(0.929770797956727),
+    WIN(0.9449364116991064), WIN(0.9583848896527869), WIN(0.9700462568300098), WIN(0.9798595054787754),
+    WIN(0.987773062026939), WIN(0.9937451828914112), WIN(0.9977442755464377), WIN(0.9997491419236825),
+};
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+static const kiss_fft_cpx stage_twiddles_128[63] = {
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.7071067811865476, -0.7071067811865475),
+    TW(0.38268343236508984, -0.9238795325112867), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(-0.9238795325112868, 0.38268343236508967), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.5555702330196023, -0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.4713967368259977, -0.881921264348355), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6343932841636455, -0.773010453362737), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.555570233019602, -0.8314696123025455),
+    TW(-0.9951847266721969, 0.09801714032956059), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.8314696123025453, -0.5555702330196022),
+    TW(-0.7730104533627371, 0.6343932841636453), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(-0.29028467725446244, 0.9569403357322088),
+};
+#endif
+
+static const kiss_fft_index swaps_256[216] = {
+    1, 64, 64, 2, 2, 16, 16, 8, 8, 4, 4, 32, 3, 80, 80, 10,
+    10, 20, 20, 40, 40, 5, 5, 96, 6, 48, 48, 9, 9, 68, 68, 34,
+    34, 17, 17, 72, 7, 112, 112, 11, 11, 84, 84, 42, 42, 21, 21, 104,
+    12, 36, 36, 33, 33, 65, 65, 66, 66, 18, 18, 24, 13, 100, 100, 35,
+    35, 81, 81, 74, 74, 22, 22, 56, 14, 52, 52, 41, 41, 69, 69, 98,
+    98, 19, 19, 88, 15, 116, 116, 43, 43, 85, 85, 106, 106, 23, 23, 120,
+    25, 76, 76, 38, 38, 49, 49, 73, 73, 70, 70, 50, 26, 28, 28, 44,
+    44, 37, 37, 97, 97, 67, 67, 82, 27, 92, 92, 46, 46, 53, 53, 105,
+    105, 71, 71, 114, 29, 108, 108, 39, 39, 113, 113, 75, 75, 86, 86, 58,
+    30, 60, 60, 45, 45, 101, 101, 99, 99, 83, 83, 90, 31, 124, 124, 47,
+    47, 117, 117, 107, 107, 87, 87, 122, 51, 89, 89, 78, 78, 54, 54, 57,
+    57, 77, 77, 102, 55, 121, 121, 79, 79, 118, 118, 59, 59, 93, 93, 110,
+    61, 109, 109, 103, 103, 115, 115, 91, 91, 94, 94, 62, 63, 125, 125, 111,
+    111, 119, 119, 123, 123, 95, 95, 126,
+};
+
+static const fft_window_t window_256[128] = {
+    WIN(-1.3877787807814457e-17), WIN(5.465338660738672e-05), WIN(0.00021875721542015392), WIN(0.0004927419767976476),
+    WIN(0.0008773234339859853), WIN(0.0013735000468328845), WIN(0.0019825493744622807), WIN(0.0027060234663564414),
+    WIN(0.0035457432539502676), WIN(0.0045037919574719976), WIN(0.005582507525357994), WIN(0.006784474126117462),
+    WIN(0.008112512715023626), WIN(0.009569670700454683), WIN(0.011159210737088664), WIN(0.012884598675474812),
+    WIN(0.014749490699747105), WIN(0.01675771968740821), WIN(0.018913280827195636), WIN(0.021220316533030484),
+    WIN(0.023683100693948217), WIN(0.026306022301708365), WIN(0.029093568499475538), WIN(0.03205030709655074),
+    WIN(0.03518086859560946), WIN(0.0384899277802619), WIN(0.041982184911994035), WIN(0.04566234658666788),
+    WIN(0.049535106301755734), WIN(0.053605124786350426), WIN(0.05787701014673456), WIN(0.06235529788089897),
+    WIN(0.06704443081587531), WIN(0.07194873902209105), WIN(0.07707241975915859), WIN(0.08241951750758408),
+    WIN(0.08799390414081369), WIN(0.09379925929183651), WIN(0.09983905096822629), WIN(0.1061165164690331),
+    WIN(0.11263464365633269), WIN(0.11939615263350464), WIN(0.12640347788144357), WIN(0.13365875090291132),
+    WIN(0.14116378342412067), WIN(0.14892005120139032), WIN(0.15692867847935152), WIN(0.16519042314570187),
+    WIN(0.17370566262590464), WIN(0.18247438055952964), WIN(0.19149615429811653), WIN(0.20077014326253045),
+    WIN(0.2102950781957708), WIN(0.2200692513450887), WIN(0.2300905076050856), WIN(0.24035623665118944),
+    WIN(0.25086336609056115), WIN(0.26160835565506946), WIN(0.272587192458484), WIN(0.2837953873375033),
+    WIN(0.29522797229363673), WIN(0.30687949905032136), WIN(0.31874403873697776), WIN(0.3308151827089932),
+    WIN(0.34308604450988284), WIN(0.35554926297912154), WIN(0.3681970065063631), WIN(0.3810209784299852),
+    WIN(0.3940124235751223), WIN(0.40716213592356665), WIN(0.4204604674051701), WIN(0.4338973377976295),
+    WIN(0.4474622457188313), WIN(0.4611442806932531), WIN(0.47493213627127584), WIN(0.4888141241776722),
+    WIN(0.5027781894629941), WIN(0.5168119266291046), WIN(0.5309025966976758), WIN(0.5450371451881405),
+    WIN(0.5592022209693055), WIN(0.5733841959466539), WIN(0.5875691855452643), WIN(0.6017430699462674),
+    WIN(0.6158915160328472), WIN(0.6299999999999999), WIN(0.6440538305805452), WIN(0.6580381728383121),
+    WIN(0.6719380724779375), WIN(0.68573848061936), WIN(0.6994242789838615), WIN(0.7129803054373971),
+    WIN(0.7263913798359676), WIN(0.7396423301169448), WIN(0.7527180185795337), WIN(0.7656033682969697),
+    WIN(0.7782833896026065), WIN(0.790743206591723), WIN(0.8029680835807139), WIN(0.8149434514652818),
+    WIN(0.8266549339193551), WIN(0.8380883733766862), WIN(0.8492298567374694), WIN(0.8600657407428189),
+    WIN(0.8705826769606064), WIN(0.8807676363269302), WIN(0.8906079331884088), WIN(0.9000912487915312),
+    WIN(0.9092056541664713), WIN(0.917939632354069), WIN(0.9262820999261012), WIN(0.9342224277505026),
+    WIN(0.941750460954848), WIN(0.9488565380431748), WIN(0.9555315091230884), WIN(0.961766753202076),
+    WIN(0.9675541945140154), WIN(0.972886317839036), WIN(0.977756182782138), WIN(0.9821574369783108),
+    WIN(0.9860843281942994), WIN(0.9895317152996566), WIN(0.9924950780822588), WIN(0.9949705258860717),
+    WIN(0.9969548050516153), WIN(0.9984453051422769), WIN(0.9994400639423745), WIN(0.999937771215645),
+};
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+static const kiss_fft_cpx stage_twiddles_256[127] = {
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.7071067811865476, -0.7071067811865475), TW(6.123233995736766e-17, -1.0),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.5555702330196023, -0.8314696123025452), TW(-0.3826834323650897, -0.9238795325112867),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.9238795325112867, -0.3826834323650899),
+    TW(-0.5555702330196022, 0.8314696123025452), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.24298017990326398, -0.970031253194544), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6715589548470183, -0.7409511253549591), TW(-0.09801714032956065, -0.9951847266721969),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.5956993044924335, -0.8032075314806448), TW(-0.29028467725446216, -0.9569403357322089),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5141027441932217, -0.8577286100002721), TW(-0.4713967368259977, -0.881921264348355),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.6343932841636454, -0.7730104533627371),
+    TW(-0.970031253194544, 0.24298017990326382), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.773010453362737, -0.6343932841636455),
+    TW(-0.8577286100002721, 0.5141027441932216), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(-0.6715589548470187, 0.7409511253549589), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.9569403357322088, -0.2902846772544624),
+    TW(-0.4275550934302825, 0.9039892931234431), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.9951847266721968, -0.09801714032956083),
+    TW(-0.1467304744553623, 0.9891765099647809),
+};
+#endif
+
+static const kiss_fft_index swaps_512[240] = {
+    1, 64, 2, 128, 3, 192, 4, 16, 5, 80, 6, 144, 7, 208, 8, 32,
+    9, 96, 10, 160, 11, 224, 12, 48, 13, 112, 14, 176, 15, 240, 17, 68,
+    18, 132, 19, 196, 21, 84, 22, 148, 23, 212, 24, 36, 25, 100, 26, 164,
+    27, 228, 28, 52, 29, 116, 30, 180, 31, 244, 33, 72, 34, 136, 35, 200,
+    37, 88, 38, 152, 39, 216, 41, 104, 42, 168, 43, 232, 44, 56, 45, 120,
+    46, 184, 47, 248, 49, 76, 50, 140, 51, 204, 53, 92, 54, 156, 55, 220,
+    57, 108, 58, 172, 59, 236, 61, 124, 62, 188, 63, 252, 66, 129, 67, 193,
+    69, 81, 70, 145, 71, 209, 73, 97, 74, 161, 75, 225, 77, 113, 78, 177,
+    79, 241, 82, 133, 83, 197, 86, 149, 87, 213, 89, 101, 90, 165, 91, 229,
+    93, 117, 94, 181, 95, 245, 98, 137, 99, 201, 102, 153, 103, 217, 106, 169,
+    107, 233, 109, 121, 110, 185, 111, 249, 114, 141, 115, 205, 118, 157, 119, 221,
+    122, 173, 123, 237, 126, 189, 127, 253, 131, 194, 134, 146, 135, 210, 138, 162,
+    139, 226, 142, 178, 143, 242, 147, 198, 151, 214, 154, 166, 155, 230, 158, 182,
+    159, 246, 163, 202, 167, 218, 171, 234, 174, 186, 175, 250, 179, 206, 183, 222,
+    187, 238, 191, 254, 199, 211, 203, 227, 207, 243, 219, 231, 223, 247, 239, 251,
+};
+
+static const fft_window_t window_512[256] = {
+    WIN(-1.3877787807814457e-17), WIN(1.3607682110658437e-05), WIN(5.443964168391768e-05), WIN(0.0001225226104617505),
+    WIN(0.00021790111474698226), WIN(0.00034063743552098513), WIN(0.0004908115526448958), WIN(0.0006685210731809249),
+    WIN(0.00087388114388047), WIN(0.0011070243478964875), WIN(0.0013681005857874712), WIN(0.0016572769408911836),
+    WIN(0.0019747375291557373), WIN(0.002320683333526502), WIN(0.002695332022997432), WIN(0.0030989177564446913),
+    WIN(0.0035316909713715566), WIN(0.003993918157702128), WIN(0.00448588161677306), WIN(0.005007879205679702),
+    WIN(0.005560224067145403), WIN(0.006143244345090115), WIN(0.006757282886085014), WIN(0.007402696926888802),
+    WIN(0.008079857768270332), WIN(0.00878915043533171), WIN(0.009530973324554548), WIN(0.010305737837800935),
+    WIN(0.01111386800350958), WIN(0.011955800085335512), WIN(0.01283198217849068), WIN(0.013742873794050793),
+    WIN(0.014688945431501059), WIN(0.015670678139802885), WIN(0.016688563067269117), WIN(0.017743101000545526),
+    WIN(0.018834801893000547), WIN(0.01996418438283553), WIN(0.021131775301231774), WIN(0.02233810917085985),
+    WIN(0.023583727695081207), WIN(0.024869179238180016), WIN(0.02619501829696836), WIN(0.027561804964113673),
+    WIN(0.028970104383544117), WIN(0.030420486198291935), WIN(0.03191352399114041), WIN(0.03344979471844563),
+    WIN(0.03502987813750773), WIN(0.0366543562278729), WIN(0.03832381260694959), WIN(0.04003883194032792),
+    WIN(0.04179999934719458), WIN(0.043607899801239206), WIN(0.04546311752745184), WIN(0.04736623539521321),
+    WIN(0.04931783430808426), WIN(0.051318492590702154), WIN(0.053368785373193096), WIN(0.05546928397351506),
+    WIN(0.0576205552781437), WIN(0.05982316112151867), WIN(0.06207765766466612), WIN(0.06438459477341729),
+    WIN(0.06674451539664063), WIN(0.06915795494490909), WIN(0.07162544067002072), WIN(0.07414749104579424),
+    WIN(0.07672461515055823), WIN(0.07935731205175409), WIN(0.08204607019307149), WIN(0.08479136678453274),
+    WIN(0.08759366719594408), WIN(0.09045342435412804), WIN(0.09337107814434946), WIN(0.09634705481634698),
+    WIN(0.09938176639537856), WIN(0.10247561009868729), WIN(0.10562896775779011), WIN(0.1088422052469919),
+    WIN(0.11211567191851904), WIN(0.11544970004466891), WIN(0.1188446042673632), WIN(0.12230068105549102),
+    WIN(0.1258182081704242), WIN(0.12939744414008048), WIN(0.13303862774190744), WIN(0.13674197749515454),
+    WIN(0.1405076911627942), WIN(0.14433594526344984), WIN(0.14822689459368044), WIN(0.15218067176096778),
+    WIN(0.1561973867277443), WIN(0.1602771263667945), WIN(0.16441995402835577), WIN(0.1686259091192382),
+    WIN(0.17289500669427565), WIN(0.17722723706041316), WIN(0.1816225653937283), WIN(0.1860809313696778),
+    WIN(0.19060224880685067), WIN(0.19518640532450493), WIN(0.19983326201415175), WIN(0.20454265312544762),
+    WIN(0.20931438576664477), WIN(0.2141482396198391), WIN(0.2190439666712522), WIN(0.22400129095676796),
+    WIN(0.22901990832294078), WIN(0.23409948620368065), WIN(0.23923966341281233), WIN(0.24444004995269417),
+    WIN(0.249700226839077), WIN(0.25501974594236837), WIN(0.2603981298454619), WIN(0.2658348717182805),
+    WIN(0.27132943520916997), WIN(0.2768812543532747), WIN(0.28248973349801043), WIN(0.2881542472457439),
+    WIN(0.2938741404137772), WIN(0.2996487280117236), WIN(0.3054772952363519), WIN(0.311359097483967),
+    WIN(0.31729336038038125), WIN(0.32327927982852167), WIN(0.32931602207371047), WIN(0.33540272378663927),
+    WIN(0.34153849216405474), WIN(0.3477224050471543), WIN(0.353953511057687), WIN(0.3602308297517399),
+    WIN(0.3665533517911803), WIN(0.3729200391327149), WIN(0.37932982523451464), WIN(0.3857816152803434),
+    WIN(0.3922742864211201), WIN(0.3988066880338296), WIN(0.4053776419976924), WIN(0.4119859429874858),
+    WIN(0.4186303587839058), WIN(0.4253096306008435), WIN(0.4320224734294418), WIN(0.43876757639878666),
+    WIN(0.4455436031530805), WIN(0.45234919224512826), WIN(0.45918295754596355), WIN(0.46604348867043077),
+    WIN(0.47292935141852366), WIN(0.47983908823228205), WIN(0.4867712186680263), WIN(0.4937242398837107),
+    WIN(0.5006966271411587), WIN(0.5076868343229413), WIN(0.5146932944636438), WIN(0.5217144202952656),
+    WIN(0.5287486048064775), WIN(0.5357942218154644), WIN(0.5428496265560647), WIN(0.5499131562769122),
+    WIN(0.5569831308532793), WIN(0.564057853411309), WIN(0.5711356109643189), WIN(0.5782146750608509),
+    WIN(0.5852933024441344), WIN(0.5923697357226181), WIN(0.5994422040512322), WIN(0.6065089238230135),
+    WIN(0.6135680993707476), WIN(0.6206179236782462), WIN(0.6276565791008978), WIN(0.6346822380951045),
+    WIN(0.6416930639562248), WIN(0.6486872115646269), WIN(0.6556628281394631), WIN(0.662618053999755),
+    WIN(0.669551023332394), WIN(0.6764598649666375), WIN(0.6833427031546916), WIN(0.6901976583579589),
+    WIN(0.6970228480385307), WIN(0.7038163874554921), WIN(0.7105763904656189), WIN(0.7173009703280222),
+    WIN(0.7239882405123163), WIN(0.7306363155098622), WIN(0.7372433116476527), WIN(0.7438073479043901),
+    WIN(0.7503265467283188), WIN(0.75679903485636), WIN(0.7632229441341057), WIN(0.7695964123362198),
+    WIN(0.7759175839868008), WIN(0.7821846111792526), WIN(0.7883956543952149), WIN(0.7945488833221043),
+    WIN(0.8006424776688131), WIN(0.8066746279791217), WIN(0.8126435364423684), WIN(0.8185474177009376),
+    WIN(0.8243844996541152), WIN(0.8301530242578682), WIN(0.8358512483201052), WIN(0.8414774442909799),
+    WIN(0.8470299010477956), WIN(0.8525069246740795), WIN(0.8579068392323901), WIN(0.8632279875304336),
+    WIN(0.8684687318800577), WIN(0.8736274548487037), WIN(0.8787025600029006), WIN(0.883692472643382),
+    WIN(0.888595640531419), WIN(0.8934105346059662), WIN(0.8981356496912143), WIN(0.9027695051941624),
+    WIN(0.9073106457918124), WIN(0.9117576421076078), WIN(0.9161090913767331), WIN(0.9203636180999081),
+    WIN(0.9245198746853034), WIN(0.9285765420782242), WIN(0.9325323303782068), WIN(0.9363859794431809),
+    WIN(0.9401362594803617), WIN(0.9437819716235378), WIN(0.947321948496433), WIN(0.9507550547618231),
+    WIN(0.9540801876561036), WIN(0.9572962775090027), WIN(0.9604022882481529), WIN(0.963397217888232),
+    WIN(0.9662800990044049), WIN(0.9690499991897936), WIN(0.9717060214967231), WIN(0.9742473048614902),
+    WIN(0.9766730245124222), WIN(0.9789823923609883), WIN(0.981174657375751), WIN(0.9832491059389404),
+    WIN(0.9852050621854557), WIN(0.987041888324098), WIN(0.9887589849408591), WIN(0.9903557912840895),
+    WIN(0.991831785531389), WIN(0.9931864850380672), WIN(0.9944194465670357), WIN(0.9955302665),
+    WIN(0.996518581029833), WIN(0.9973840663340239), WIN(0.9981264387290993), WIN(0.9987454548059362),
+    WIN(0.9992409115458837), WIN(0.9996126464176329), WIN(0.999860537454779), WIN(0.9999845033140297),
+};
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+static const kiss_fft_cpx stage_twiddles_512[255] = {
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.7071067811865476, -0.7071067811865475),
+    TW(0.38268343236508984, -0.9238795325112867), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(-0.9238795325112868, 0.38268343236508967), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.5555702330196023, -0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.4713967368259977, -0.881921264348355), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6343932841636455, -0.773010453362737), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.555570233019602, -0.8314696123025455),
+    TW(-0.9951847266721969, 0.09801714032956059), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.8314696123025453, -0.5555702330196022),
+    TW(-0.7730104533627371, 0.6343932841636453), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(-0.29028467725446244, 0.9569403357322088), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.4496113296546066, -0.8932243011955153), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.6715589548470183, -0.7409511253549591),
+    TW(0.3136817403988916, -0.9495281805930367), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.5956993044924335, -0.8032075314806448),
+    TW(0.17096188876030136, -0.9852776423889412), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.024541228522912264, -0.9996988186962042), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.12241067519921615, -0.99247953459871), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.534997619887097, -0.8448535652497072), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6895405447370669, -0.7242470829514669), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6531728429537768, -0.7572088465064845), TW(-0.14673047445536164, -0.989176509964781),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6152315905806268, -0.7883464276266062), TW(-0.24298017990326387, -0.970031253194544),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5758081914178453, -0.8175848131515837), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5349976198870973, -0.844853565249707), TW(-0.42755509343028186, -0.9039892931234434),
+    TW(-0.99247953459871, -0.12241067519921635), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.4928981922297841, -0.8700869911087113), TW(-0.5141027441932217, -0.8577286100002721),
+    TW(-0.9996988186962042, 0.02454122852291208), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4496113296546066, -0.8932243011955153), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(-0.9852776423889413, 0.17096188876030097), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.40524131400498986, -0.9142097557035307), TW(-0.6715589548470184, -0.740951125354959),
+    TW(-0.9495281805930368, 0.3136817403988912), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3598950365349883, -0.9329927988347388), TW(-0.7409511253549589, -0.6715589548470186),
+    TW(-0.8932243011955153, 0.44961132965460665), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.3136817403988916, -0.9495281805930367), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(-0.8175848131515837, 0.5758081914178453), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.2667127574748984, -0.9637760657954398), TW(-0.857728610000272, -0.5141027441932218),
+    TW(-0.724247082951467, 0.6895405447370668), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.21910124015686977, -0.9757021300385286), TW(-0.9039892931234433, -0.42755509343028203),
+    TW(-0.6152315905806273, 0.7883464276266059), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.17096188876030136, -0.9852776423889412), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(-0.4928981922297842, 0.8700869911087113), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.12241067519921628, -0.99247953459871), TW(-0.970031253194544, -0.24298017990326407),
+    TW(-0.35989503653498794, 0.932992798834739), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.07356456359966745, -0.9972904566786902), TW(-0.989176509964781, -0.1467304744553618),
+    TW(-0.2191012401568701, 0.9757021300385285), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.024541228522912264, -0.9996988186962042), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(-0.07356456359966736, 0.9972904566786902),
+};
+#endif
+
+static const kiss_fft_index swaps_1024[904] = {
+    1, 256, 256, 2, 2, 64, 64, 8, 8, 16, 16, 32, 32, 4, 4, 128,
+    3, 320, 320, 10, 10, 80, 80, 40, 40, 20, 20, 160, 160, 5, 5, 384,
+    6, 192, 192, 9, 9, 272, 272, 34, 34, 68, 68, 136, 136, 17, 17, 288,
+    7, 448, 448, 11, 11, 336, 336, 42, 42, 84, 84, 168, 168, 21, 21, 416,
+    12, 144, 144, 33, 33, 260, 260, 130, 130, 65, 65, 264, 264, 18, 18, 96,
+    13, 400, 400, 35, 35, 324, 324, 138, 138, 81, 81, 296, 296, 22, 22, 224,
+    14, 208, 208, 41, 41, 276, 276, 162, 162, 69, 69, 392, 392, 19, 19, 352,
+    15, 464, 464, 43, 43, 340, 340, 170, 170, 85, 85, 424, 424, 23, 23, 480,
+    24, 48, 48, 36, 36, 132, 132, 129, 129, 257, 257, 258, 258, 66, 66, 72,
+    25, 304, 304, 38, 38, 196, 196, 137, 137, 273, 273, 290, 290, 70, 70, 200,
+    26, 112, 112, 44, 44, 148, 148, 161, 161, 261, 261, 386, 386, 67, 67, 328,
+    27, 368, 368, 46, 46, 212, 212, 169, 169, 277, 277, 418, 418, 71, 71, 456,
+    28, 176, 176, 37, 37, 388, 388, 131, 131, 321, 321, 266, 266, 82, 82, 104,
+    29, 432, 432, 39, 39, 452, 452, 139, 139, 337, 337, 298, 298, 86, 86, 232,
+    30, 240, 240, 45, 45, 404, 404, 163, 163, 325, 325, 394, 394, 83, 83, 360,
+    31, 496, 496, 47, 47, 468, 468, 171, 171, 341, 341, 426, 426, 87, 87, 488,
+    49, 292, 292, 134, 134, 193, 193, 265, 265, 274, 274, 98, 98, 76, 76, 152,
+    50, 100, 100, 140, 140, 145, 145, 289, 289, 262, 262, 194, 194, 73, 73, 280,
+    51, 356, 356, 142, 142, 209, 209, 297, 297, 278, 278, 226, 226, 77, 77, 408,
+    52, 164, 164, 133, 133, 385, 385, 259, 259, 322, 322, 74, 74, 88, 88, 56,
+    53, 420, 420, 135, 135, 449, 449, 267, 267, 338, 338, 106, 106, 92, 92, 184,
+    54, 228, 228, 141, 141, 401, 401, 291, 291, 326, 326, 202, 202, 89, 89, 312,
+    55, 484, 484, 143, 143, 465, 465, 299, 299, 342, 342, 234, 234, 93, 93, 440,
+    57, 308, 308, 166, 166, 197, 197, 393, 393, 275, 275, 354, 354, 78, 78, 216,
+    58, 116, 116, 172, 172, 149, 149, 417, 417, 263, 263, 450, 450, 75, 75, 344,
+    59, 372, 372, 174, 174, 213, 213, 425, 425, 279, 279, 482, 482, 79, 79, 472,
+    60, 180, 180, 165, 165, 389, 389, 387, 387, 323, 323, 330, 330, 90, 90, 120,
+    61, 436, 436, 167, 167, 453, 453, 395, 395, 339, 339, 362, 362, 94, 94, 248,
+    62, 244, 244, 173, 173, 405, 405, 419, 419, 327, 327, 458, 458, 91, 91, 376,
+    63, 500, 500, 175, 175, 469, 469, 427, 427, 343, 343, 490, 490, 95, 95, 504,
+    97, 268, 268, 146, 99, 332, 332, 154, 154, 113, 113, 300, 300, 150, 150, 225,
+    225, 269, 269, 402, 101, 396, 396, 147, 147, 353, 353, 270, 270, 210, 210, 105,
+    105, 284, 284, 178, 102, 204, 204, 153, 153, 305, 305, 294, 294, 198, 198, 201,
+    201, 281, 281, 306, 103, 460, 460, 155, 155, 369, 369, 302, 302, 214, 214, 233,
+    233, 285, 285, 434, 107, 348, 348, 186, 186, 117, 117, 428, 428, 151, 151, 481,
+    481, 271, 271, 466, 108, 156, 156, 177, 177, 293, 293, 390, 390, 195, 195, 329,
+    329, 282, 282, 114, 109, 412, 412, 179, 179, 357, 357, 398, 398, 211, 211, 361,
+    361, 286, 286, 242, 110, 220, 220, 185, 185, 309, 309, 422, 422, 199, 199, 457,
+    457, 283, 283, 370, 111, 476, 476, 187, 187, 373, 373, 430, 430, 215, 215, 489,
+    489, 287, 287, 498, 115, 364, 364, 158, 158, 241, 241, 301, 301, 406, 406, 227,
+    227, 333, 333, 410, 118, 236, 236, 157, 157, 433, 433, 295, 295, 454, 454, 203,
+    203, 345, 345, 314, 119, 492, 492, 159, 159, 497, 497, 303, 303, 470, 470, 235,
+    235, 349, 349, 442, 121, 316, 316, 182, 182, 229, 229, 397, 397, 403, 403, 355,
+    355, 334, 334, 218, 122, 124, 124, 188, 188, 181, 181, 421, 421, 391, 391, 451,
+    451, 331, 331, 346, 123, 380, 380, 190, 190, 245, 245, 429, 429, 407, 407, 483,
+    483, 335, 335, 474, 125, 444, 444, 183, 183, 485, 485, 399, 399, 467, 467, 363,
+    363, 350, 350, 250, 126, 252, 252, 189, 189, 437, 437, 423, 423, 455, 455, 459,
+    459, 347, 347, 378, 127, 508, 508, 191, 191, 501, 501, 431, 431, 471, 471, 491,
+    491, 351, 351, 506, 205, 409, 409, 307, 307, 358, 358, 206, 206, 217, 217, 313,
+    313, 310, 310, 230, 207, 473, 473, 315, 315, 374, 374, 238, 238, 221, 221, 441,
+    441, 311, 311, 486, 219, 377, 377, 318, 318, 246, 246, 237, 237, 413, 413, 435,
+    435, 359, 359, 462, 222, 249, 249, 317, 317, 438, 438, 231, 231, 461, 461, 411,
+    411, 371, 371, 366, 223, 505, 505, 319, 319, 502, 502, 239, 239, 477, 477, 443,
+    443, 375, 375, 494, 243, 365, 365, 414, 247, 493, 493, 415, 415, 499, 499, 367,
+    367, 478, 478, 251, 251, 381, 381, 446, 253, 445, 445, 439, 439, 487, 487, 463,
+    463, 475, 475, 379, 379, 382, 382, 254, 255, 509, 509, 447, 447, 503, 503, 495,
+    495, 479, 479, 507, 507, 383, 383, 510,
+};
+
+static const fft_window_t window_1024[512] = {
+    WIN(-1.3877787807814457e-17), WIN(3.395133803971162e-06), WIN(1.3581090180514455e-05), WIN(3.055953389992372e-05),
+    WIN(5.433323916569088e-05), WIN(8.490608899498764e-05), WIN(0.00012228307435091512), WIN(0.00016647029302682692),
+    WIN(0.00021747494828386338), WIN(0.00027530534724047595), WIN(0.0003399708990153849), WIN(0.00041148211262373446),
+    WIN(0.0004898505946268478), WIN(0.0005750890465359981), WIN(0.0006672112619706683), WIN(0.0007662321235716446),
+    WIN(0.0008721675996697376), WIN(0.0009850347407101001), WIN(0.001104851675433366), WIN(0.00123163760681394),
+    WIN(0.0013654128077558447), WIN(0.001506198616547605), WIN(0.0016540174320758272), WIN(0.0018088927087991091),
+    WIN(0.0019708489514828897), WIN(0.00213991170969606), WIN(0.0023161075720698615), WIN(0.0024994641603207357),
+    WIN(0.0026900101230373785), WIN(0.0028877751292339104), WIN(0.0030927898616688043), WIN(0.0033050860099324425),
+    WIN(0.003524696263302693), WIN(0.0037516543033711963), WIN(0.003985994796440129), WIN(0.004227753385692146),
+    WIN(0.004476966683133479), WIN(0.004733672261312424), WIN(0.004997908644813934), WIN(0.005269715301532349),
+    WIN(0.0055491326337230445), WIN(0.005836201968834831), WIN(0.006130965550124684), WIN(0.006433466527055842),
+    WIN(0.006743748945481645), WIN(0.00706185773761582), WIN(0.007387838711791744), WIN(0.007721738542011261),
+    WIN(0.008063604757286152), WIN(0.008413485730772802), WIN(0.008771430668702382), WIN(0.009137489599108414),
+    WIN(0.00951171336035321), WIN(0.00989415358945557), WIN(0.010284862710220971), WIN(0.01068389392117721),
+    WIN(0.01109130118331609), WIN(0.01150713920764456), WIN(0.011931463442546267), WIN(0.012364330060956531),
+    WIN(0.012805795947351671), WIN(0.013255918684556348), WIN(0.01371475654036932), WIN(0.014182368454011468),
+    WIN(0.014658814022397423), WIN(0.01514415348623259), WIN(0.015638447715939613), WIN(0.016141758197414084),
+    WIN(0.0166541470176145), WIN(0.017175676849986485), WIN(0.017706410939725407), WIN(0.018246413088878657),
+    WIN(0.018795747641291036), WIN(0.019354479467394457), WIN(0.019922673948845976), WIN(0.02050039696301538),
+    WIN(0.021087714867325733), WIN(0.02168469448344878), WIN(0.02229140308135867), WIN(0.0229079083632455),
+    WIN(0.023534278447292722), WIN(0.024170581851319616), WIN(0.024816887476292675), WIN(0.025473264589707875),
+    WIN(0.02613978280884724), WIN(0.02681651208391183), WIN(0.027503522681034225), WIN(0.028200885165173467),
+    WIN(0.028908670382894935), WIN(0.029626949445038256), WIN(0.030355793709276213), WIN(0.031095274762566863),
+    WIN(0.03184546440350292), WIN(0.03260643462456032), WIN(0.03337825759424905), WIN(0.03416100563916997),
+    WIN(0.0349547512259796), WIN(0.03575956694326646), WIN(0.03657552548334167), WIN(0.03740269962394746),
+    WIN(0.038241162209885285), WIN(0.03909098613456838), WIN(0.03995224432150018), WIN(0.04082500970568283),
+    WIN(0.041709355214958194), WIN(0.04260535375128485), WIN(0.04351307817195407), WIN(0.04443260127074758),
+    WIN(0.04536399575904115), WIN(0.04630733424685606), WIN(0.04726268922386219), WIN(0.04823013304033605),
+    WIN(0.04920973788807647), WIN(0.050201575781281635), WIN(0.05120571853738985), WIN(0.052222237757888645),
+    WIN(0.05325120480909373), WIN(0.054292690802902256), WIN(0.055346766577523424), WIN(0.05641350267818888),
+    WIN(0.05749296933784714), WIN(0.058585236457844934), WIN(0.05969037358859802), WIN(0.060808449910256274),
+    WIN(0.061939534213364275), WIN(0.06308369487952278), WIN(0.06424099986205245), WIN(0.06541151666666441),
+    WIN(0.06659531233214026), WIN(0.06779245341102494), WIN(0.06900300595033572), WIN(0.07022703547229067),
+    WIN(0.07146460695505966), WIN(0.07271578481354138), WIN(0.07398063288016929), WIN(0.07525921438575028),
+    WIN(0.07655159194033885), WIN(0.07785782751415016), WIN(0.07917798241851529), WIN(0.08051211728688186),
+    WIN(0.08186029205586338), WIN(0.08322256594634038), WIN(0.08459899744461649), WIN(0.08598964428363308),
+    WIN(0.08739456342424522), WIN(0.08881381103656243), WIN(0.09024744248135733), WIN(0.09169551229154542),
+    WIN(0.09315807415373888), WIN(0.09463518088987827), WIN(0.0961268844389444), WIN(0.09763323583875418),
+    WIN(0.0991542852078433), WIN(0.10069008172743905), WIN(0.10224067362352576), WIN(0.10380610814900713),
+    WIN(0.10538643156596778), WIN(0.10698168912803656), WIN(0.10859192506285617), WIN(0.11021718255466052),
+    WIN(0.11185750372696435), WIN(0.11351292962536708), WIN(0.11518350020047376), WIN(0.1168692542909375),
+    WIN(0.11857022960662503), WIN(0.12028646271190796), WIN(0.12201798900908517), WIN(0.12376484272193539),
+    WIN(0.1255270568794073), WIN(0.12730466329944587), WIN(0.12909769257296042), WIN(0.13090617404793697),
+    WIN(0.1327301358136961), WIN(0.1345696046853016), WIN(0.1364246061881202), WIN(0.13829516454253668),
+    WIN(0.14018130264882728), WIN(0.1420830420721924), WIN(0.14400040302795364), WIN(0.14593340436691574),
+    WIN(0.1478820635608973), WIN(0.14984639668843291), WIN(0.15182641842064826), WIN(0.1538221420073118),
+    WIN(0.15583357926306568), WIN(0.15786074055383703), WIN(0.1599036347834339), WIN(0.16196226938032715),
+    WIN(0.16403665028462044), WIN(0.16612678193521313), WIN(0.1682326672571542), WIN(0.17035430764919438),
+    WIN(0.1724917029715351), WIN(0.17464485153377807), WIN(0.17681375008307854), WIN(0.17899839379250226),
+    WIN(0.18119877624959094), WIN(0.18341488944513648), WIN(0.18564672376216657), WIN(0.1878942679651446),
+    WIN(0.19015750918938507), WIN(0.19243643293068674), WIN(0.1947310230351863), WIN(0.1970412616894323),
+    WIN(0.19936712941068552), WIN(0.2017086050374422), WIN(0.2040656657201877), WIN(0.20643828691237753),
+    WIN(0.20882644236165077), WIN(0.2112301041012769), WIN(0.21364924244183658), WIN(0.21608382596314024),
+    WIN(0.21853382150638428), WIN(0.22099919416654706), WIN(0.2234799072850278), WIN(0.22597592244252676),
+    WIN(0.22848719945217227), WIN(0.23101369635289248), WIN(0.23355536940303534), WIN(0.2361121730742386),
+    WIN(0.23868406004554849), WIN(0.2412709811977932), WIN(0.24387288560820675), WIN(0.24648972054530932),
+    WIN(0.2491214314640431), WIN(0.2517679620011648), WIN(0.25442925397089644), WIN(0.2571052473608364),
+    WIN(0.2597958803281298), WIN(0.2625010891959012), WIN(0.26522080844994994), WIN(0.26795497073570773),
+    WIN(0.2707035068554635), WIN(0.27346634576585055), WIN(0.27624341457560236), WIN(0.2790346385435743),
+    WIN(0.28183994107703336), WIN(0.2846592437302172), WIN(0.28749246620316204), WIN(0.29033952634080046),
+    WIN(0.2932003401323303), WIN(0.29607482171085464), WIN(0.2989628833532933), WIN(0.301864435480567),
+    WIN(0.3047793866580546), WIN(0.3077076435963225), WIN(0.31064911115212845), WIN(0.31360369232969926),
+    WIN(0.31657128828228204), WIN(0.31955179831397096), WIN(0.322545119881808), WIN(0.32555114859815837),
+    WIN(0.32856977823336153), WIN(0.331600900718657), WIN(0.33464440614938573), WIN(0.33770018278846586),
+    WIN(0.3407681170701441), WIN(0.3438480936040226), WIN(0.34693999517935925), WIN(0.35004370276964514),
+    WIN(0.3531590955374546), WIN(0.3562860508395701), WIN(0.35942444423238196), WIN(0.36257414947756095),
+    WIN(0.3657350385480047), WIN(0.3689069816340575), WIN(0.3720898471500014), WIN(0.37528350174082087),
+    WIN(0.3784878102892384), WIN(0.3817026359230201), WIN(0.3849278400225538), WIN(0.3881632822286946),
+    WIN(0.39140882045088116), WIN(0.3946643108755191), WIN(0.3979296079746329), WIN(0.4012045645147838),
+    WIN(0.40448903156625354), WIN(0.40778285851249396), WIN(0.41108589305983934), WIN(0.41439798124748267),
+    WIN(0.41771896745771386), WIN(0.4210486944264184), WIN(0.4243870032538366), WIN(0.4277337334155814),
+    WIN(0.4310887227739128), WIN(0.434451807589271), WIN(0.4378228225320612), WIN(0.441201600694696),
+    WIN(0.44458797360388747), WIN(0.44798177123319105), WIN(0.4513828220158007), WIN(0.4547909528575893),
+    WIN(0.4582059891503994), WIN(0.4616277547855763), WIN(0.46505607216774614), WIN(0.46849076222883634),
+    WIN(0.4719316444423355), WIN(0.47537853683779363), WIN(0.4788312560155578), WIN(0.482289617161744),
+    WIN(0.48575343406344323), WIN(0.48922251912415726), WIN(0.4926966833794672), WIN(0.4961757365129278),
+    WIN(0.49965948687218814), WIN(0.503147741485338), WIN(0.5066403060774743), WIN(0.5101369850874895),
+    WIN(0.513637581685077), WIN(0.5171418977879518), WIN(0.5206497340792877), WIN(0.5241608900253633),
+    WIN(0.5276751638934181), WIN(0.531192352769718), WIN(0.5347122525778227), WIN(0.5382346580970585),
+    WIN(0.5417593629811888), WIN(0.5452861597772851), WIN(0.5488148399447932), WIN(0.5523451938747903),
+    WIN(0.5558770109094368), WIN(0.5594100793616127), WIN(0.5629441865347419), WIN(0.5664791187427995),
+    WIN(0.5700146613304996), WIN(0.5735505986936605), WIN(0.5770867142997472), WIN(0.580622790708585),
+    WIN(0.5841586095932437), WIN(0.58769395176109), WIN(0.591228597175004), WIN(0.5947623249747583),
+    WIN(0.5982949134985552), WIN(0.6018261403047204), WIN(0.6053557821935536), WIN(0.6088836152293233),
+    WIN(0.6124094147624165), WIN(0.615932955451628), WIN(0.6194540112865953), WIN(0.6229723556103688),
+    WIN(0.6264877611421242), WIN(0.6299999999999999), WIN(0.6335088437240718), WIN(0.6370140632994503),
+    WIN(0.6405154291795048), WIN(0.6440127113092061), WIN(0.6475056791485883), WIN(0.6509941016963257),
+    WIN(0.6544777475134195), WIN(0.6579563847469955), WIN(0.6614297811542044), WIN(0.6648977041262262),
+    WIN(0.668359920712372), WIN(0.671816197644283), WIN(0.6752663013602204), WIN(0.6787099980294442),
+    WIN(0.6821470535766808), WIN(0.6855772337066693), WIN(0.6890003039287902), WIN(0.6924160295817667),
+    WIN(0.695824175858444), WIN(0.6992245078306313), WIN(0.7026167904740154), WIN(0.7060007886931338),
+    WIN(0.7093762673464077), WIN(0.712742991271232), WIN(0.716100725309115), WIN(0.7194492343308716),
+    WIN(0.7227882832618563), WIN(0.7261176371072443), WIN(0.7294370609773477), WIN(0.7327463201129679),
+    WIN(0.7360451799107794), WIN(0.7393334059487454), WIN(0.7426107640115519), WIN(0.7458770201160702),
+    WIN(0.7491319405368335), WIN(0.7523752918315283), WIN(0.7556068408664994), WIN(0.7588263548422579),
+    WIN(0.7620336013190002), WIN(0.7652283482421195), WIN(0.7684103639677218), WIN(0.771579417288131),
+    WIN(0.7747352774573864), WIN(0.7778777142167248), WIN(0.7810064978200484), WIN(0.7841213990593721),
+    WIN(0.7872221892902426), WIN(0.7903086404571374), WIN(0.7933805251188274), WIN(0.7964376164737083),
+    WIN(0.7994796883850906), WIN(0.8025065154064556), WIN(0.805517872806657), WIN(0.808513536595083),
+    WIN(0.8114932835467615), WIN(0.8144568912274129), WIN(0.8174041380184427), WIN(0.8203348031418722),
+    WIN(0.8232486666852068), WIN(0.8261455096262298), WIN(0.8290251138577297), WIN(0.8318872622121477),
+    WIN(0.8347317384861491), WIN(0.8375583274651083), WIN(0.8403668149475136), WIN(0.8431569877692767),
+    WIN(0.845928633827953), WIN(0.8486815421068663), WIN(0.8514155026991321), WIN(0.85413030683158),
+    WIN(0.8568257468885673), WIN(0.8595016164356886), WIN(0.862157710243367), WIN(0.8647938243103328),
+    WIN(0.8674097558869832), WIN(0.8700053034986167), WIN(0.8725802669685465), WIN(0.8751344474410803),
+    WIN(0.8776676474043724), WIN(0.8801796707131371), WIN(0.8826703226112256), WIN(0.8851394097540619),
+    WIN(0.8875867402309329), WIN(0.8900121235871299), WIN(0.8924153708459438), WIN(0.8947962945304999),
+    WIN(0.8971547086854407), WIN(0.899490428898448), WIN(0.9018032723216002), WIN(0.9040930576925654),
+    WIN(0.9063596053556249), WIN(0.908602737282526), WIN(0.9108222770931576), WIN(0.9130180500760516),
+    WIN(0.9151898832087013), WIN(0.9173376051776978), WIN(0.919461046398679), WIN(0.9215600390360912),
+    WIN(0.9236344170227594), WIN(0.9256840160792601), WIN(0.9277086737331012), WIN(0.9297082293376991),
+    WIN(0.9316825240911552), WIN(0.9336314010548243), WIN(0.9355547051716817), WIN(0.9374522832844716),
+    WIN(0.9393239841536498), WIN(0.9411696584751083), WIN(0.9429891588976804), WIN(0.9447823400404302),
+    WIN(0.9465490585097139), WIN(0.9482891729160221), WIN(0.9500025438905885), WIN(0.9516890341017736),
+    WIN(0.9533485082712148), WIN(0.9549808331897414), WIN(0.9565858777330544), WIN(0.9581635128771672),
+    WIN(0.9597136117136044), WIN(0.9612360494643596), WIN(0.9627307034966064), WIN(0.9641974533371633),
+    WIN(0.9656361806867083), WIN(0.9670467694337431), WIN(0.9684291056683049), WIN(0.9697830776954206),
+    WIN(0.9711085760483077), WIN(0.9724054935013126), WIN(0.9736737250825908), WIN(0.9749131680865241),
+    WIN(0.9761237220858727), WIN(0.9773052889436634), WIN(0.9784577728248077), WIN(0.9795810802074532),
+    WIN(0.9806751198940619), WIN(0.9817398030222189), WIN(0.9827750430751642), WIN(0.9837807558920523),
+    WIN(0.9847568596779318), WIN(0.9857032750134497), WIN(0.9866199248642744), WIN(0.9875067345902389),
+    WIN(0.9883636319542003), WIN(0.9891905471306182), WIN(0.9899874127138465), WIN(0.9907541637261402),
+    WIN(0.991490737625376), WIN(0.9921970743124829), WIN(0.9928731161385865), WIN(0.9935188079118612),
+    WIN(0.9941340969040916), WIN(0.9947189328569436), WIN(0.9952732679879405), WIN(0.9957970569961472),
+    WIN(0.9962902570675589), WIN(0.9967528278801951), WIN(0.9971847316088976), WIN(0.9975859329298319),
+    WIN(0.9979563990246911), WIN(0.9982960995846026), WIN(0.9986050068137355), WIN(0.9988830954326104),
+    WIN(0.9991303426811088), WIN(0.9993467283211825), WIN(0.9995322346392647), WIN(0.9996868464483781),
+    WIN(0.9998105510899443), WIN(0.9999033384352909), WIN(0.9999652008868579), WIN(0.9999961333791026),
+};
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+static const kiss_fft_cpx stage_twiddles_1024[511] = {
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.7071067811865476, -0.7071067811865475), TW(6.123233995736766e-17, -1.0),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.5555702330196023, -0.8314696123025452), TW(-0.3826834323650897, -0.9238795325112867),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.9238795325112867, -0.3826834323650899),
+    TW(-0.5555702330196022, 0.8314696123025452), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.24298017990326398, -0.970031253194544), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6715589548470183, -0.7409511253549591), TW(-0.09801714032956065, -0.9951847266721969),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.5956993044924335, -0.8032075314806448), TW(-0.29028467725446216, -0.9569403357322089),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5141027441932217, -0.8577286100002721), TW(-0.4713967368259977, -0.881921264348355),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.6343932841636454, -0.7730104533627371),
+    TW(-0.970031253194544, 0.24298017990326382), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.773010453362737, -0.6343932841636455),
+    TW(-0.8577286100002721, 0.5141027441932216), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(-0.6715589548470187, 0.7409511253549589), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.9569403357322088, -0.2902846772544624),
+    TW(-0.4275550934302825, 0.9039892931234431), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.9951847266721968, -0.09801714032956083),
+    TW(-0.1467304744553623, 0.9891765099647809), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9999247018391445, -0.012271538285719925), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9993223845883495, -0.03680722294135883), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9993223845883495, -0.03680722294135883), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9939069700023561, -0.11022220729388306), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9981181129001492, -0.06132073630220858), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.9831054874312163, -0.18303988795514095), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.996312612182778, -0.0857973123444399), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9669764710448521, -0.25486565960451457), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9939069700023561, -0.11022220729388306), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9456073253805213, -0.3253102921622629), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.99090263542778, -0.13458070850712617), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.9191138516900578, -0.3939920400610481), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9873014181578584, -0.15885814333386145), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8876396204028539, -0.46053871095824), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.9831054874312163, -0.18303988795514095), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.8513551931052652, -0.524589682678469), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9783173707196277, -0.20711137619221856), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.8104571982525948, -0.5857978574564389), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.9729399522055602, -0.2310581082806711), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.765167265622459, -0.6438315428897914), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9669764710448521, -0.25486565960451457), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.7157308252838186, -0.6983762494089729), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.9604305194155658, -0.27851968938505306), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.6624157775901718, -0.7491363945234593), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9533060403541939, -0.3020059493192281), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.6055110414043255, -0.7958369046088835), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.9456073253805213, -0.3253102921622629), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.5453249884220465, -0.838224705554838), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.937339011912575, -0.34841868024943456), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.48218377207912283, -0.8760700941954066), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.4496113296546066, -0.8932243011955153),
+    TW(0.9285060804732156, -0.37131719395183754), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.4164295600976373, -0.9091679830905223), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9191138516900578, -0.3939920400610481), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.3484186802494345, -0.937339011912575), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.6715589548470183, -0.7409511253549591), TW(0.3136817403988916, -0.9495281805930367),
+    TW(0.9091679830905224, -0.41642956009763715), TW(0.6531728429537768, -0.7572088465064845),
+    TW(0.27851968938505306, -0.9604305194155658), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.8986744656939538, -0.43861623853852766), TW(0.6152315905806268, -0.7883464276266062),
+    TW(0.20711137619221856, -0.9783173707196277), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.5956993044924335, -0.8032075314806448), TW(0.17096188876030136, -0.9852776423889412),
+    TW(0.8876396204028539, -0.46053871095824), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.13458070850712622, -0.99090263542778), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8760700941954066, -0.4821837720791227), TW(0.5349976198870973, -0.844853565249707),
+    TW(0.06132073630220865, -0.9981181129001492), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.024541228522912264, -0.9996988186962042),
+    TW(0.8639728561215868, -0.5035383837257176), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.012271538285719823, -0.9999247018391445), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8513551931052652, -0.524589682678469), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.08579731234443976, -0.996312612182778), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.12241067519921615, -0.99247953459871),
+    TW(0.8382247055548381, -0.5453249884220465), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.15885814333386128, -0.9873014181578584), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8245893027850253, -0.5657318107836131), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.23105810828067114, -0.9729399522055602), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(0.8104571982525948, -0.5857978574564389), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.3020059493192281, -0.9533060403541939), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.7958369046088836, -0.6055110414043255), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.3713171939518375, -0.9285060804732156), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(0.7807372285720945, -0.6248594881423863), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.4386162385385274, -0.8986744656939539), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.765167265622459, -0.6438315428897914), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.5035383837257175, -0.8639728561215868), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.534997619887097, -0.8448535652497072),
+    TW(0.7491363945234594, -0.6624157775901718), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.5657318107836132, -0.8245893027850252), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.7326542716724128, -0.680600997795453), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.6248594881423862, -0.7807372285720946), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(0.7157308252838186, -0.6983762494089729), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.680600997795453, -0.7326542716724128), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6983762494089729, -0.7157308252838186), TW(-0.024541228522912142, -0.9996988186962042),
+    TW(-0.7326542716724127, -0.6806009977954532), TW(0.6895405447370669, -0.7242470829514669),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(0.6806009977954531, -0.7326542716724128), TW(-0.07356456359966733, -0.9972904566786902),
+    TW(-0.7807372285720945, -0.6248594881423863), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6624157775901718, -0.7491363945234593), TW(-0.12241067519921615, -0.99247953459871),
+    TW(-0.8245893027850251, -0.5657318107836135), TW(0.6531728429537768, -0.7572088465064845),
+    TW(-0.14673047445536164, -0.989176509964781), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(0.6438315428897915, -0.765167265622459), TW(-0.17096188876030124, -0.9852776423889412),
+    TW(-0.8639728561215867, -0.5035383837257177), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6248594881423865, -0.7807372285720944), TW(-0.21910124015686966, -0.9757021300385286),
+    TW(-0.8986744656939539, -0.43861623853852755), TW(0.6152315905806268, -0.7883464276266062),
+    TW(-0.24298017990326387, -0.970031253194544), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(0.6055110414043255, -0.7958369046088835), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(-0.9285060804732155, -0.3713171939518377), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5857978574564389, -0.8104571982525948), TW(-0.3136817403988914, -0.9495281805930367),
+    TW(-0.9533060403541939, -0.30200594931922803), TW(0.5758081914178453, -0.8175848131515837),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(0.5657318107836132, -0.8245893027850253), TW(-0.35989503653498817, -0.9329927988347388),
+    TW(-0.9729399522055601, -0.23105810828067133), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5453249884220465, -0.838224705554838), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(-0.9873014181578584, -0.15885814333386147), TW(0.5349976198870973, -0.844853565249707),
+    TW(-0.42755509343028186, -0.9039892931234434), TW(-0.99247953459871, -0.12241067519921635),
+    TW(0.5245896826784688, -0.8513551931052652), TW(-0.4496113296546067, -0.8932243011955152),
+    TW(-0.996312612182778, -0.08579731234444016), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.5035383837257176, -0.8639728561215867), TW(-0.492898192229784, -0.8700869911087115),
+    TW(-0.9999247018391445, -0.012271538285720007), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.5141027441932217, -0.8577286100002721), TW(-0.9996988186962042, 0.02454122852291208),
+    TW(0.48218377207912283, -0.8760700941954066), TW(-0.534997619887097, -0.8448535652497072),
+    TW(-0.9981181129001492, 0.061320736302208245), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.46053871095824, -0.8876396204028539), TW(-0.5758081914178453, -0.8175848131515837),
+    TW(-0.99090263542778, 0.13458070850712606), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(-0.9852776423889413, 0.17096188876030097),
+    TW(0.4386162385385277, -0.8986744656939538), TW(-0.6152315905806267, -0.7883464276266063),
+    TW(-0.9783173707196277, 0.2071113761922186), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.4164295600976373, -0.9091679830905223), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(-0.9604305194155659, 0.2785196893850529), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.6715589548470184, -0.740951125354959), TW(-0.9495281805930368, 0.3136817403988912),
+    TW(0.3939920400610481, -0.9191138516900578), TW(-0.6895405447370669, -0.7242470829514669),
+    TW(-0.937339011912575, 0.34841868024943456), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3713171939518376, -0.9285060804732155), TW(-0.7242470829514668, -0.689540544737067),
+    TW(-0.9091679830905225, 0.41642956009763693), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.7409511253549589, -0.6715589548470186), TW(-0.8932243011955153, 0.44961132965460665),
+    TW(0.3484186802494345, -0.937339011912575), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(-0.8760700941954066, 0.48218377207912266), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.325310292162263, -0.9456073253805213), TW(-0.7883464276266062, -0.6152315905806269),
+    TW(-0.8382247055548382, 0.5453249884220461), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(-0.8175848131515837, 0.5758081914178453),
+    TW(0.3020059493192282, -0.9533060403541938), TW(-0.8175848131515836, -0.5758081914178454),
+    TW(-0.7958369046088836, 0.6055110414043254), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.27851968938505306, -0.9604305194155658), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(-0.7491363945234593, 0.6624157775901718), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.857728610000272, -0.5141027441932218), TW(-0.724247082951467, 0.6895405447370668),
+    TW(0.2548656596045146, -0.9669764710448521), TW(-0.8700869911087113, -0.49289819222978415),
+    TW(-0.698376249408973, 0.7157308252838185), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.23105810828067128, -0.9729399522055601), TW(-0.8932243011955152, -0.4496113296546069),
+    TW(-0.6438315428897915, 0.765167265622459), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.9039892931234433, -0.42755509343028203), TW(-0.6152315905806273, 0.7883464276266059),
+    TW(0.20711137619221856, -0.9783173707196277), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(-0.5857978574564391, 0.8104571982525947), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.18303988795514106, -0.9831054874312163), TW(-0.9329927988347388, -0.35989503653498833),
+    TW(-0.5245896826784694, 0.8513551931052649), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(-0.4928981922297842, 0.8700869911087113),
+    TW(0.1588581433338614, -0.9873014181578584), TW(-0.9495281805930367, -0.3136817403988914),
+    TW(-0.4605387109582399, 0.887639620402854), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.13458070850712622, -0.99090263542778), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(-0.3939920400610482, 0.9191138516900577), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.970031253194544, -0.24298017990326407), TW(-0.35989503653498794, 0.932992798834739),
+    TW(0.11022220729388318, -0.9939069700023561), TW(-0.9757021300385285, -0.21910124015687005),
+    TW(-0.3253102921622633, 0.9456073253805212), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.08579731234443988, -0.996312612182778), TW(-0.9852776423889412, -0.17096188876030122),
+    TW(-0.25486565960451435, 0.9669764710448522), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.989176509964781, -0.1467304744553618), TW(-0.2191012401568701, 0.9757021300385285),
+    TW(0.06132073630220865, -0.9981181129001492), TW(-0.99247953459871, -0.12241067519921635),
+    TW(-0.18303988795514095, 0.9831054874312163), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.03680722294135899, -0.9993223845883495), TW(-0.9972904566786902, -0.07356456359966773),
+    TW(-0.11022220729388331, 0.9939069700023561), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(-0.07356456359966736, 0.9972904566786902),
+    TW(0.012271538285719944, -0.9999247018391445), TW(-0.9996988186962042, -0.024541228522912326),
+    TW(-0.03680722294135933, 0.9993223845883494),
+};
+#endif
+
+static const kiss_fft_index swaps_2048[960] = {
+    1, 256, 2, 512, 3, 768, 4, 64, 5, 320, 6, 576, 7, 832, 8, 128,
+    9, 384, 10, 640, 11, 896, 12, 192, 13, 448, 14, 704, 15, 960, 17, 272,
+    18, 528, 19, 784, 20, 80, 21, 336, 22, 592, 23, 848, 24, 144, 25, 400,
+    26, 656, 27, 912, 28, 208, 29, 464, 30, 720, 31, 976, 33, 288, 34, 544,
+    35, 800, 36, 96, 37, 352, 38, 608, 39, 864, 40, 160, 41, 416, 42, 672,
+    43, 928, 44, 224, 45, 480, 46, 736, 47, 992, 49, 304, 50, 560, 51, 816,
+    52, 112, 53, 368, 54, 624, 55, 880, 56, 176, 57, 432, 58, 688, 59, 944,
+    60, 240, 61, 496, 62, 752, 63, 1008, 65, 260, 66, 516, 67, 772, 69, 324,
+    70, 580, 71, 836, 72, 132, 73, 388, 74, 644, 75, 900, 76, 196, 77, 452,
+    78, 708, 79, 964, 81, 276, 82, 532, 83, 788, 85, 340, 86, 596, 87, 852,
+    88, 148, 89, 404, 90, 660, 91, 916, 92, 212, 93, 468, 94, 724, 95, 980,
+    97, 292, 98, 548, 99, 804, 101, 356, 102, 612, 103, 868, 104, 164, 105, 420,
+    106, 676, 107, 932, 108, 228, 109, 484, 110, 740, 111, 996, 113, 308, 114, 564,
+    115, 820, 117, 372, 118, 628, 119, 884, 120, 180, 121, 436, 122, 692, 123, 948,
+    124, 244, 125, 500, 126, 756, 127, 1012, 129, 264, 130, 520, 131, 776, 133, 328,
+    134, 584, 135, 840, 137, 392, 138, 648, 139, 904, 140, 200, 141, 456, 142, 712,
+    143, 968, 145, 280, 146, 536, 147, 792, 149, 344, 150, 600, 151, 856, 153, 408,
+    154, 664, 155, 920, 156, 216, 157, 472, 158, 728, 159, 984, 161, 296, 162, 552,
+    163, 808, 165, 360, 166, 616, 167, 872, 169, 424, 170, 680, 171, 936, 172, 232,
+    173, 488, 174, 744, 175, 1000, 177, 312, 178, 568, 179, 824, 181, 376, 182, 632,
+    183, 888, 185, 440, 186, 696, 187, 952, 188, 248, 189, 504, 190, 760, 191, 1016,
+    193, 268, 194, 524, 195, 780, 197, 332, 198, 588, 199, 844, 201, 396, 202, 652,
+    203, 908, 205, 460, 206, 716, 207, 972, 209, 284, 210, 540, 211, 796, 213, 348,
+    214, 604, 215, 860, 217, 412, 218, 668, 219, 924, 221, 476, 222, 732, 223, 988,
+    225, 300, 226, 556, 227, 812, 229, 364, 230, 620, 231, 876, 233, 428, 234, 684,
+    235, 940, 237, 492, 238, 748, 239, 1004, 241, 316, 242, 572, 243, 828, 245, 380,
+    246, 636, 247, 892, 249, 444, 250, 700, 251, 956, 253, 508, 254, 764, 255, 1020,
+    258, 513, 259, 769, 261, 321, 262, 577, 263, 833, 265, 385, 266, 641, 267, 897,
+    269, 449, 270, 705, 271, 961, 274, 529, 275, 785, 277, 337, 278, 593, 279, 849,
+    281, 401, 282, 657, 283, 913, 285, 465, 286, 721, 287, 977, 290, 545, 291, 801,
+    293, 353, 294, 609, 295, 865, 297, 417, 298, 673, 299, 929, 301, 481, 302, 737,
+    303, 993, 306, 561, 307, 817, 309, 369, 310, 625, 311, 881, 313, 433, 314, 689,
+    315, 945, 317, 497, 318, 753, 319, 1009, 322, 517, 323, 773, 326, 581, 327, 837,
+    329, 389, 330, 645, 331, 901, 333, 453, 334, 709, 335, 965, 338, 533, 339, 789,
+    342, 597, 343, 853, 345, 405, 346, 661, 347, 917, 349, 469, 350, 725, 351, 981,
+    354, 549, 355, 805, 358, 613, 359, 869, 361, 421, 362, 677, 363, 933, 365, 485,
+    366, 741, 367, 997, 370, 565, 371, 821, 374, 629, 375, 885, 377, 437, 378, 693,
+    379, 949, 381, 501, 382, 757, 383, 1013, 386, 521, 387, 777, 390, 585, 391, 841,
+    394, 649, 395, 905, 397, 457, 398, 713, 399, 969, 402, 537, 403, 793, 406, 601,
+    407, 857, 410, 665, 411, 921, 413, 473, 414, 729, 415, 985, 418, 553, 419, 809,
+    422, 617, 423, 873, 426, 681, 427, 937, 429, 489, 430, 745, 431, 1001, 434, 569,
+    435, 825, 438, 633, 439, 889, 442, 697, 443, 953, 445, 505, 446, 761, 447, 1017,
+    450, 525, 451, 781, 454, 589, 455, 845, 458, 653, 459, 909, 462, 717, 463, 973,
+    466, 541, 467, 797, 470, 605, 471, 861, 474, 669, 475, 925, 478, 733, 479, 989,
+    482, 557, 483, 813, 486, 621, 487, 877, 490, 685, 491, 941, 494, 749, 495, 1005,
+    498, 573, 499, 829, 502, 637, 503, 893, 506, 701, 507, 957, 510, 765, 511, 1021,
+    515, 770, 518, 578, 519, 834, 522, 642, 523, 898, 526, 706, 527, 962, 531, 786,
+    534, 594, 535, 850, 538, 658, 539, 914, 542, 722, 543, 978, 547, 802, 550, 610,
+    551, 866, 554, 674, 555, 930, 558, 738, 559, 994, 563, 818, 566, 626, 567, 882,
+    570, 690, 571, 946, 574, 754, 575, 1010, 579, 774, 583, 838, 586, 646, 587, 902,
+    590, 710, 591, 966, 595, 790, 599, 854, 602, 662, 603, 918, 606, 726, 607, 982,
+    611, 806, 615, 870, 618, 678, 619, 934, 622, 742, 623, 998, 627, 822, 631, 886,
+    634, 694, 635, 950, 638, 758, 639, 1014, 643, 778, 647, 842, 651, 906, 654, 714,
+    655, 970, 659, 794, 663, 858, 667, 922, 670, 730, 671, 986, 675, 810, 679, 874,
+    683, 938, 686, 746, 687, 1002, 691, 826, 695, 890, 699, 954, 702, 762, 703, 1018,
+    707, 782, 711, 846, 715, 910, 719, 974, 723, 798, 727, 862, 731, 926, 735, 990,
+    739, 814, 743, 878, 747, 942, 751, 1006, 755, 830, 759, 894, 763, 958, 767, 1022,
+    775, 835, 779, 899, 783, 963, 791, 851, 795, 915, 799, 979, 807, 867, 811, 931,
+    815, 995, 823, 883, 827, 947, 831, 1011, 843, 903, 847, 967, 859, 919, 863, 983,
+    875, 935, 879, 999, 891, 951, 895, 1015, 911, 971, 927, 987, 943, 1003, 959, 1019,
+};
+
+static const fft_window_t window_2048[1024] = {
+    WIN(-1.3877787807814457e-17), WIN(8.479456926335782e-07), WIN(3.3918173889951886e-06), WIN(7.631718942816001e-06),
+    WIN(1.35678234370884e-05), WIN(2.1200373174545817e-05), WIN(3.05296796639376e-05), WIN(4.155612360301486e-05),
+    WIN(5.42801548568117e-05), WIN(6.870229243297055e-05), WIN(8.482312445243223e-05), WIN(0.00010264330811700362),
+    WIN(0.00012216356967219288), WIN(0.00014338470436701944), WIN(0.00016630757640945237), WIN(0.00019093311891840714),
+    WIN(0.00021726233387117655), WIN(0.0002452962920480861), WIN(0.0002750361329721257), WIN(0.00030648306484581944),
+    WIN(0.00033963836448339113), WIN(0.0003745033772395018), WIN(0.0004110795169343512), WIN(0.0004493682657744358),
+    WIN(0.0004893711742697954), WIN(0.0005310898611474574), WIN(0.0005745260132608426), WIN(0.0006196813854957711),
+    WIN(0.0006665578006718603), WIN(0.0007151571494412451), WIN(0.0007654813901823293), WIN(0.000817532548890651),
+    WIN(0.0008713127190653203), WIN(0.0009268240615921131), WIN(0.0009840688046224705), WIN(0.0010430492434487931),
+    WIN(0.0011037677403760715), WIN(0.0011662267245896446), WIN(0.0012304286920192392), WIN(0.0012963762051991096),
+    WIN(0.001364071893124555), WIN(0.0014335184511048427), WIN(0.0015047186406118435), WIN(0.001577675289125613),
+    WIN(0.0016523912899758797), WIN(0.001728869602179564), WIN(0.0018071132502751747), WIN(0.0018871253241530273),
+    WIN(0.0019689089788818698), WIN(0.002052467434532121), WIN(0.0021378039759945983), WIN(0.0022249219527965963),
+    WIN(0.002313824778913759), WIN(0.0024045159325779275), WIN(0.0024969989560822), WIN(0.0025912774555815615),
+    WIN(0.0026873551008902985), WIN(0.0027852356252755506), WIN(0.0028849228252474657), WIN(0.0029864205603454125),
+    WIN(0.0030897327529209873), WIN(0.0031948633879169963), WIN(0.003301816512643288), WIN(0.0034105962365485187),
+    WIN(0.0035212067309887546), WIN(0.0036336522289921597), WIN(0.003747937025020645), WIN(0.003864065474727313),
+    WIN(0.0039820419947108054), WIN(0.00410187106226613), WIN(0.004223557215131665), WIN(0.004347105051232952),
+    WIN(0.0044725192284229), WIN(0.0045998044642184405), WIN(0.004728965535533855), WIN(0.004860007278410447),
+    WIN(0.0049929345877429004), WIN(0.005127752417002293), WIN(0.005264465777955252), WIN(0.005403079740380304),
+    WIN(0.005543599431780358), WIN(0.005686030037091949), WIN(0.005830376798391143), WIN(0.0059766450145959105),
+    WIN(0.006124840041165397), WIN(0.006274967289795569), WIN(0.006427032228111848), WIN(0.006581040379358069),
+    WIN(0.0067369973220823), WIN(0.006894908689819443), WIN(0.007054780170770422), WIN(0.007216617507478401),
+    WIN(0.007380426496500919), WIN(0.007546212988080045), WIN(0.007713982885808074), WIN(0.007883742146291048),
+    WIN(0.008055496778808069), WIN(0.008229252844968393), WIN(0.008405016458364542), WIN(0.008582793784222859),
+    WIN(0.008762591039050652), WIN(0.008944414490280064), WIN(0.009128270455909013), WIN(0.009314165304139296),
+    WIN(0.009502105453010806), WIN(0.009692097370033778), WIN(0.009884147571816784), WIN(0.010078262623692907),
+    WIN(0.010274449139341682), WIN(0.010472713780409065), WIN(0.010673063256123778), WIN(0.010875504322910685),
+    WIN(0.011080043784001778), WIN(0.011286688489043517), WIN(0.01149544533370156), WIN(0.011706321259262673),
+    WIN(0.01191932325223339), WIN(0.012134458343936366), WIN(0.012351733610103187), WIN(0.012571156170464844),
+    WIN(0.012792733188339199), WIN(0.013016471870215464), WIN(0.013242379465336268), WIN(0.013470463265276497),
+    WIN(0.013700730603519784), WIN(0.013933188855031947), WIN(0.014167845435831883), WIN(0.014404707802559563),
+    WIN(0.014643783452041516), WIN(0.014885079920853722), WIN(0.015128604784881379), WIN(0.015374365658876593),
+    WIN(0.01562237019601305), WIN(0.01587262608743848), WIN(0.016125141061823826), WIN(0.016379922884910768),
+    WIN(0.016636979359056073), WIN(0.0168963183227734), WIN(0.0171579476502731), WIN(0.01742187525099892),
+    WIN(0.01768810906916267), WIN(0.017956657083276192), WIN(0.018227527305681078), WIN(0.01850072778207576),
+    WIN(0.018776266591040355), WIN(0.019054151843559186), WIN(0.019334391682540697), WIN(0.01961699428233537),
+    WIN(0.019901967848251025), WIN(0.02018932061606586), WIN(0.020479060851539534), WIN(0.020771196849921722),
+    WIN(0.0210657369354581), WIN(0.02136268946089509), WIN(0.021662062806981207), WIN(0.021963865381967235),
+    WIN(0.022268105621103568), WIN(0.02257479198613601), WIN(0.02288393296479873), WIN(0.023195537070305812),
+    WIN(0.023509612840840348), WIN(0.02382616883904163), WIN(0.024145213651490235), WIN(0.02446675588819113),
+    WIN(0.024790804182054864), WIN(0.02511736718837658), WIN(0.025446453584313314), WIN(0.02577807206835927),
+    WIN(0.026112231359819257), WIN(0.026448940198280153), WIN(0.026788207343080538), WIN(0.027130041572778457),
+    WIN(0.027474451684617575), WIN(0.027821446493991195), WIN(0.028171034833904915), WIN(0.028523225554437086),
+    WIN(0.028878027522197952), WIN(0.029235449619786927), WIN(0.029595500745247874), WIN(0.029958189811523532),
+    WIN(0.03032352574590732), WIN(0.03069151748949432), WIN(0.031062173996630353), WIN(0.03143550423435921),
+    WIN(0.031811517181869045), WIN(0.03219022182993645), WIN(0.03257162718036976), WIN(0.03295574224545013),
+    WIN(0.033342576047371966), WIN(0.0337321376176813), WIN(0.034124435996712985), WIN(0.03451948023302659),
+    WIN(0.03491727938284071), WIN(0.035317842509466305), WIN(0.03572117868273837), WIN(0.03612729697844637),
+    WIN(0.03653620647776372), WIN(0.036947916266675346), WIN(0.037362435435405225), WIN(0.03777977307784114),
+    WIN(0.038199938290959704), WIN(0.03862294017424939), WIN(0.039048787829132764), WIN(0.03947749035838738),
+    WIN(0.03990905686556618), WIN(0.04034349645441583), WIN(0.040780818228295185), WIN(0.04122103128959184),
+    WIN(0.04166414473913821), WIN(0.04211016767562649), WIN(0.042559109195022635), WIN(0.04301097838997964),
+    WIN(0.04346578434924962), WIN(0.04392353615709539), WIN(0.044384242892701), WIN(0.04484791362958124),
+    WIN(0.045314557434991146), WIN(0.04578418336933372), WIN(0.04625680048556778), WIN(0.04673241782861458),
+    WIN(0.04721104443476386), WIN(0.04769268933107942), WIN(0.048177361534803946), WIN(0.04866507005276303),
+    WIN(0.04915582388076915), WIN(0.04964963200302415), WIN(0.050146503391522386), WIN(0.05064644700545234),
+    WIN(0.05114947179059832), WIN(0.0516555866787415), WIN(0.052164800587060446), WIN(0.0526771224175315),
+    WIN(0.053192561056328566), WIN(0.053711125373222646), WIN(0.05423282422098088), WIN(0.05475766643476542),
+    WIN(0.055285660831532135), WIN(0.055816816209428605), WIN(0.056351141347192546), WIN(0.056888645003549426),
+    WIN(0.05742933591661018), WIN(0.05797322280326887), WIN(0.05852031435859985), WIN(0.05907061925525518),
+    WIN(0.05962414614286189), WIN(0.06018090364741894), WIN(0.06074090037069442), WIN(0.06130414488962267),
+    WIN(0.06187064575570153), WIN(0.06244041149438917), WIN(0.06301345060450164), WIN(0.06358977155761017),
+    WIN(0.06416938279743839), WIN(0.06475229273926014), WIN(0.06533850976929742), WIN(0.06592804224411784),
+    WIN(0.06652089849003343), WIN(0.06711708680249849), WIN(0.06771661544550878), WIN(0.0683194926510004),
+    WIN(0.06892572661824888), WIN(0.06953532551326932), WIN(0.070148297468216), WIN(0.07076465058078314),
+    WIN(0.07138439291360583), WIN(0.07200753249366103), WIN(0.07263407731166979), WIN(0.07326403532149925),
+    WIN(0.0738974144395658), WIN(0.07453422254423805), WIN(0.07517446747524135), WIN(0.07581815703306198),
+    WIN(0.07646529897835229), WIN(0.07711590103133698), WIN(0.07776997087121926), WIN(0.07842751613558832),
+    WIN(0.07908854441982707), WIN(0.07975306327652115), WIN(0.08042108021486832), WIN(0.08109260270008853),
+    WIN(0.08176763815283554), WIN(0.08244619394860851), WIN(0.08312827741716503), WIN(0.08381389584193494),
+    WIN(0.08450305645943494), WIN(0.08519576645868439), WIN(0.08589203298062184), WIN(0.08659186311752261),
+    WIN(0.08729526391241776), WIN(0.08800224235851346), WIN(0.08871280539861208), WIN(0.089426959924534),
+    WIN(0.0901447127765406), WIN(0.09086607074275864), WIN(0.09159104055860548), WIN(0.0923196289062155),
+    WIN(0.09305184241386848), WIN(0.09378768765541799), WIN(0.0945271711497222), WIN(0.09527029936007524),
+    WIN(0.09601707869364033), WIN(0.09676751550088408), WIN(0.09752161607501197), WIN(0.09827938665140588),
+    WIN(0.09904083340706207), WIN(0.09980596246003154), WIN(0.10057477986886121), WIN(0.10134729163203705),
+    WIN(0.10212350368742838), WIN(0.10290342191173385), WIN(0.10368705211992918), WIN(0.10447440006471614),
+    WIN(0.10526547143597324), WIN(0.10606027186020835), WIN(0.10685880690001265), WIN(0.1076610820535164),
+    WIN(0.10846710275384645), WIN(0.10927687436858517), WIN(0.11009040219923197), WIN(0.1109076914806654),
+    WIN(0.11172874738060813), WIN(0.11255357499909316), WIN(0.113382179367932), WIN(0.11421456545018499),
+    WIN(0.11505073813963282), WIN(0.11589070226025107), WIN(0.11673446256568557), WIN(0.1175820237387306),
+    WIN(0.11843339039080805), WIN(0.11928856706145027), WIN(0.12014755821778295), WIN(0.12101036825401185),
+    WIN(0.1218770014909101), WIN(0.12274746217530862), WIN(0.12362175447958859), WIN(0.12449988250117527),
+    WIN(0.12538185026203533), WIN(0.12626766170817463), WIN(0.12715732070914001), WIN(0.12805083105752188),
+    WIN(0.12894819646846034), WIN(0.12984942057915216), WIN(0.13075450694836144), WIN(0.13166345905593146),
+    WIN(0.13257628030229976), WIN(0.1334929740080152), WIN(0.13441354341325717), WIN(0.13533799167735788),
+    WIN(0.13626632187832588), WIN(0.13719853701237397), WIN(0.13813463999344738), WIN(0.1390746336527563),
+    WIN(0.14001852073830948), WIN(0.14096630391445145), WIN(0.14191798576140177), WIN(0.1428735687747968),
+    WIN(0.14383305536523452), WIN(0.14479644785782148), WIN(0.14576374849172247), WIN(0.14673495941971323),
+    WIN(0.1477100827077356), WIN(0.14868912033445503), WIN(0.14967207419082162), WIN(0.15065894607963273),
+    WIN(0.15164973771509974), WIN(0.15264445072241667), WIN(0.15364308663733156), WIN(0.15464564690572147),
+    WIN(0.1556521328831689), WIN(0.15666254583454317), WIN(0.15767688693358234), WIN(0.15869515726248),
+    WIN(0.15971735781147356), WIN(0.16074348947843622), WIN(0.1617735530684719), WIN(0.16280754929351277),
+    WIN(0.16384547877192024), WIN(0.16488734202808814), WIN(0.16593313949205019), WIN(0.1669828714990892),
+    WIN(0.16803653828935047), WIN(0.16909414000745734), WIN(0.17015567670213064), WIN(0.17122114832581023),
+    WIN(0.17229055473428126), WIN(0.1733638956863019), WIN(0.17444117084323513), WIN(0.1755223797686842),
+    WIN(0.17660752192812953), WIN(0.1776965966885712), WIN(0.17878960331817262), WIN(0.1798865409859089),
+    WIN(0.18098740876121736), WIN(0.18209220561365236), WIN(0.1832009304125425), WIN(0.18431358192665234),
+    WIN(0.18543015882384586), WIN(0.1865506596707547), WIN(0.18767508293244908), WIN(0.18880342697211222),
+    WIN(0.18993569005071848), WIN(0.19107187032671397), WIN(0.19221196585570233), WIN(0.19335597459013165),
+    WIN(0.19450389437898732), WIN(0.19565572296748623), WIN(0.19681145799677607), WIN(0.19797109700363713),
+    WIN(0.1991346374201877), WIN(0.20030207657359417), WIN(0.2014734116857829), WIN(0.20264863987315723),
+    WIN(0.20382775814631693), WIN(0.205010763409782), WIN(0.20619765246171973), WIN(0.20738842199367574),
+    WIN(0.208583068590308), WIN(0.20978158872912533), WIN(0.2109839787802288), WIN(0.21219023500605727),
+    WIN(0.2134003535611369), WIN(0.21461433049183343), WIN(0.21583216173610936), WIN(0.21705384312328346),
+    WIN(0.2182793703737958), WIN(0.21950873909897467), WIN(0.22074194480080905), WIN(0.2219789828717232),
+    WIN(0.22321984859435615), WIN(0.22446453714134518), WIN(0.22571304357511157), WIN(0.22696536284765254),
+    WIN(0.22822148980033463), WIN(0.22948141916369277), WIN(0.23074514555723202), WIN(0.23201266348923427),
+    WIN(0.23328396735656748), WIN(0.2345590514445005), WIN(0.2358379099265199), WIN(0.2371205368641522),
+    WIN(0.23840692620679002), WIN(0.23969707179152067), WIN(0.2409909673429607), WIN(0.24228860647309242),
+    WIN(0.24358998268110654), WIN(0.24489508935324678), WIN(0.24620391976265993), WIN(0.2475164670692488),
+    WIN(0.24883272431953019), WIN(0.25015268444649624), WIN(0.25147634026947985), WIN(0.2528036844940248),
+    WIN(0.25413470971175844), WIN(0.25546940840027044), WIN(0.25680777292299367), WIN(0.25814979552909095),
+    WIN(0.2594954683533439), WIN(0.26084478341604805), WIN(0.26219773262290985), WIN(0.26355430776495),
+    WIN(0.2649145005184087), WIN(0.2662783024446569), WIN(0.26764570499011076), WIN(0.26901669948614954),
+    WIN(0.2703912771490399), WIN(0.2717694290798612), WIN(0.27315114626443826), WIN(0.2745364195732756),
+    WIN(0.27592523976149713), WIN(0.27731759746879), WIN(0.2787134832193524), WIN(0.2801128874218455),
+    WIN(0.28151580036934937), WIN(0.282922212239324), WIN(0.2843321130935732), WIN(0.28574549287821416),
+    WIN(0.28716234142364944), WIN(0.2885826484445456), WIN(0.29000640353981294), WIN(0.2914335961925928),
+    WIN(0.29286421577024635), WIN(0.2942982515243494), WIN(0.29573569259069027), WIN(0.2971765279892724),
+    WIN(0.2986207466243221), WIN(0.30006833728429827), WIN(0.30151928864190913), WIN(0.30297358925413076),
+    WIN(0.30443122756223157), WIN(0.30589219189180006), WIN(0.30735647045277786), WIN(0.30882405133949564),
+    WIN(0.3102949225307144), WIN(0.31176907188967085), WIN(0.31324648716412634), WIN(0.31472715598642154),
+    WIN(0.3162110658735334), WIN(0.31769820422713857), WIN(0.31918855833367843), WIN(0.32068211536443203),
+    WIN(0.32217886237558946), WIN(0.32367878630833247), WIN(0.3251818739889175), WIN(0.3266881121287637),
+    WIN(0.328197487324546), WIN(0.3297099860582907), WIN(0.33122559469747737), WIN(0.33274429949514295),
+    WIN(0.3342660865899918), WIN(0.3357909420065095), WIN(0.33731885165508085), WIN(0.33884980133211173),
+    WIN(0.34038377672015646), WIN(0.3419207633880476), WIN(0.3434607467910323), WIN(0.34500371227091103),
+    WIN(0.34654964505618147), WIN(0.34809853026218673), WIN(0.3496503528912668), WIN(0.3512050978329164),
+    WIN(0.3527627498639447), WIN(0.3543232936486411), WIN(0.35588671373894415), WIN(0.3574529945746155),
+    WIN(0.3590221204834175), WIN(0.36059407568129553), WIN(0.3621688442725648), WIN(0.36374641025010007),
+    WIN(0.36532675749553145), WIN(0.3669098697794429), WIN(0.36849573076157655), WIN(0.3700843239910391),
+    WIN(0.37167563290651495), WIN(0.3732696408364812), WIN(0.37486633099942895), WIN(0.3764656865040873),
+    WIN(0.37806769034965215), WIN(0.37967232542601953), WIN(0.38127957451402233), WIN(0.38288942028567235),
+    WIN(0.3845018453044052), WIN(0.3861168320253308), WIN(0.38773436279548645), WIN(0.38935441985409613),
+    WIN(0.39097698533283193), WIN(0.39260204125608084), WIN(0.394229569541216), WIN(0.39585955199887024),
+    WIN(0.3974919703332166), WIN(0.39912680614225016), WIN(0.40076404091807627), WIN(0.4024036560472013),
+    WIN(0.40404563281082834), WIN(0.40568995238515676), WIN(0.4073365958416868), WIN(0.40898554414752564),
+    WIN(0.41063677816570127), WIN(0.41229027865547696), WIN(0.41394602627267235), WIN(0.41560400156998734),
+    WIN(0.41726418499732987), WIN(0.4189265569021493), WIN(0.420591097529771), WIN(0.42225778702373856),
+    WIN(0.4239266054261568), WIN(0.425597532678041), WIN(0.42727054861966896), WIN(0.4289456329909368),
+    WIN(0.4306227654317208), WIN(0.43230192548224033), WIN(0.4339830925834271), WIN(0.4356662460772969),
+    WIN(0.4373513652073259), WIN(0.4390384291188313), WIN(0.4407274168593546), WIN(0.4424183073790505),
+    WIN(0.4441110795310786), WIN(0.44580571207199804), WIN(0.44750218366216876), WIN(0.44920047286615483),
+    WIN(0.4509005581531306), WIN(0.452602417897294), WIN(0.45430603037827905), WIN(0.4560113737815776),
+    WIN(0.4577184261989597), WIN(0.4594271656289021), WIN(0.4611375699770167), WIN(0.4628496170564863),
+    WIN(0.46456328458850144), WIN(0.46627855020270215), WIN(0.46799539143762414), WIN(0.4697137857411467),
+    WIN(0.47143371047094607), WIN(0.4731551428949521), WIN(0.47487806019180834), WIN(0.4766024394513352),
+    WIN(0.47832825767499887), WIN(0.4800554917763807), WIN(0.4817841185816536), WIN(0.48351411483005924),
+    WIN(0.4852454571743908), WIN(0.48697812218147857), WIN(0.48871208633267793), WIN(0.4904473260243637),
+    WIN(0.49218381756842505), WIN(0.4939215371927666), WIN(0.49566046104181005), WIN(0.49740056517700254),
+    WIN(0.49914182557732556), WIN(0.5008842181398102), WIN(0.5026277186800527), WIN(0.5043723029327364),
+    WIN(0.5061179465521546), WIN(0.5078646251127392), WIN(0.5096123141095906), WIN(0.5113609889590125),
+    WIN(0.5131106249990489), WIN(0.514861197490025), WIN(0.5166126816150922), WIN(0.5183650524807748),
+    WIN(0.5201182851175208), WIN(0.5218723544802568), WIN(0.5236272354489437), WIN(0.5253829028291395),
+    WIN(0.5271393313525604), WIN(0.5288964956776506), WIN(0.5306543703901498), WIN(0.5324129300036683),
+    WIN(0.5341721489602625), WIN(0.5359320016310157), WIN(0.5376924623166187), WIN(0.5394535052479577),
+    WIN(0.5412151045867017), WIN(0.5429772344258953), WIN(0.5447398687905531), WIN(0.5465029816382582),
+    WIN(0.5482665468597623), WIN(0.5500305382795901), WIN(0.551794929656647), WIN(0.5535596946848272),
+    WIN(0.5553248069936282), WIN(0.5570902401487653), WIN(0.55885596765279), WIN(0.5606219629457129),
+    WIN(0.562388199405626), WIN(0.5641546503493315), WIN(0.5659212890329703), WIN(0.5676880886526552),
+    WIN(0.5694550223451065), WIN(0.5712220631882899), WIN(0.5729891842020571), WIN(0.5747563583487904),
+    WIN(0.576523558534047), WIN(0.5782907576072106), WIN(0.5800579283621403), WIN(0.5818250435378258),
+    WIN(0.5835920758190452), WIN(0.5853589978370229), WIN(0.5871257821700915), WIN(0.588892401344357),
+    WIN(0.5906588278343659), WIN(0.5924250340637733), WIN(0.5941909924060155), WIN(0.5959566751849847),
+    WIN(0.5977220546757058), WIN(0.5994871031050137), WIN(0.6012517926522374), WIN(0.6030160954498824),
+    WIN(0.6047799835843175), WIN(0.6065434290964619), WIN(0.608306403982478), WIN(0.6100688801944636),
+    WIN(0.6118308296411469), WIN(0.613592224188584), WIN(0.6153530356608593), WIN(0.6171132358407871),
+    WIN(0.6188727964706148), WIN(0.6206316892527306), WIN(0.6223898858503709), WIN(0.624147357888331),
+    WIN(0.6259040769536762), WIN(0.6276600145964584), WIN(0.6294151423304313), WIN(0.6311694316337693),
+    WIN(0.632922853949787), WIN(0.6346753806876625), WIN(0.6364269832231619), WIN(0.6381776328993646),
+    WIN(0.6399273010273916), WIN(0.6416759588871359), WIN(0.6434235777279939), WIN(0.6451701287695977),
+    WIN(0.6469155832025528), WIN(0.6486599121891733), WIN(0.6504030868642211), WIN(0.6521450783356458),
+    WIN(0.6538858576853277), WIN(0.6556253959698222), WIN(0.6573636642211022), WIN(0.6591006334473086),
+    WIN(0.6608362746334966), WIN(0.6625705587423869), WIN(0.6643034567151165), WIN(0.666034939471992),
+    WIN(0.6677649779132454), WIN(0.669493542919788), WIN(0.6712206053539694), WIN(0.6729461360603363),
+    WIN(0.6746701058663923), WIN(0.6763924855833592), WIN(0.6781132460069405), WIN(0.6798323579180853),
+    WIN(0.6815497920837547), WIN(0.6832655192576856), WIN(0.6849795101811633), WIN(0.6866917355837858),
+    WIN(0.6884021661842371), WIN(0.690110772691058), WIN(0.6918175258034185), WIN(0.6935223962118914),
+    WIN(0.6952253545992262), WIN(0.6969263716411266), WIN(0.6986254180070259), WIN(0.7003224643608654),
+    WIN(0.7020174813618718), WIN(0.7037104396653389), WIN(0.7054013099234065), WIN(0.7070900627858424),
+    WIN(0.7087766689008248), WIN(0.710461098915725), WIN(0.7121433234778917), WIN(0.7138233132354348),
+    WIN(0.715501038838012), WIN(0.7171764709376145), WIN(0.7188495801893532), WIN(0.7205203372522466),
+    WIN(0.7221887127900094), WIN(0.7238546774718411), WIN(0.725518201973214), WIN(0.7271792569766651),
+    WIN(0.7288378131725853), WIN(0.7304938412600109), WIN(0.732147311947414), WIN(0.7337981959534958),
+    WIN(0.7354464640079775), WIN(0.7370920868523946), WIN(0.738735035240888), WIN(0.7403752799409992),
+    WIN(0.7420127917344631), WIN(0.7436475414180016), WIN(0.7452794998041196), WIN(0.7469086377218971),
+    WIN(0.7485349260177863), WIN(0.7501583355564048), WIN(0.751778837221331), WIN(0.7533964019159006),
+    WIN(0.7550110005640002), WIN(0.7566226041108629), WIN(0.7582311835238654), WIN(0.7598367097933214),
+    WIN(0.7614391539332777), WIN(0.7630384869823101), WIN(0.7646346800043186), WIN(0.7662277040893225),
+    WIN(0.7678175303542545), WIN(0.7694041299437574), WIN(0.7709874740309783), WIN(0.7725675338183632),
+    WIN(0.7741442805384506), WIN(0.7757176854546672), WIN(0.7772877198621206), WIN(0.7788543550883931),
+    WIN(0.7804175624943349), WIN(0.7819773134748579), WIN(0.7835335794597266), WIN(0.7850863319143508),
+    WIN(0.7866355423405782), WIN(0.7881811822774846), WIN(0.7897232233021643), WIN(0.7912616370305205),
+    WIN(0.7927963951180559), WIN(0.7943274692606602), WIN(0.7958548311953991), WIN(0.7973784527013029),
+    WIN(0.7988983056001517), WIN(0.8004143617572641), WIN(0.801926593082281), WIN(0.8034349715299519),
+    WIN(0.8049394691009184), WIN(0.806440057842498), WIN(0.8079367098494661), WIN(0.8094293972648384),
+    WIN(0.810918092280652), WIN(0.8124027671387443), WIN(0.8138833941315324), WIN(0.8153599456027925),
+    WIN(0.816832393948435), WIN(0.8183007116172817), WIN(0.8197648711118412), WIN(0.821224844989082),
+    WIN(0.8226806058612063), WIN(0.8241321263964205), WIN(0.8255793793197073), WIN(0.8270223374135947),
+    WIN(0.8284609735189232), WIN(0.8298952605356148), WIN(0.8313251714234374), WIN(0.8327506792027701),
+    WIN(0.8341717569553655), WIN(0.835588377825113), WIN(0.8370005150187977), WIN(0.8384081418068614),
+    WIN(0.8398112315241588), WIN(0.8412097575707147), WIN(0.8426036934124786), WIN(0.8439930125820779),
+    WIN(0.8453776886795706), WIN(0.8467576953731946), WIN(0.8481330064001176), WIN(0.8495035955671826),
+    WIN(0.8508694367516553), WIN(0.8522305039019673), WIN(0.8535867710384584), WIN(0.8549382122541165),
+    WIN(0.8562848017153174), WIN(0.857626513662562), WIN(0.8589633224112109), WIN(0.8602952023522179),
+    WIN(0.8616221279528632), WIN(0.8629440737574815), WIN(0.8642610143881906), WIN(0.8655729245456181),
+    WIN(0.8668797790096251), WIN(0.8681815526400285), WIN(0.8694782203773208), WIN(0.8707697572433896),
+    WIN(0.8720561383422331), WIN(0.8733373388606736), WIN(0.8746133340690713), WIN(0.8758840993220331),
+    WIN(0.8771496100591213), WIN(0.878409841805558), WIN(0.8796647701729308), WIN(0.8809143708598928),
+    WIN(0.8821586196528611), WIN(0.8833974924267164), WIN(0.8846309651454951), WIN(0.8858590138630833),
+    WIN(0.8870816147239056), WIN(0.8882987439636137), WIN(0.889510377909772), WIN(0.8907164929825402),
+    WIN(0.8919170656953532), WIN(0.8931120726556007), WIN(0.8943014905653015), WIN(0.8954852962217779),
+    WIN(0.8966634665183254), WIN(0.8978359784448817), WIN(0.8990028090886922), WIN(0.900163935634972),
+    WIN(0.901319335367568), WIN(0.9024689856696152), WIN(0.9036128640241935), WIN(0.9047509480149782),
+    WIN(0.9058832153268919), WIN(0.9070096437467501), WIN(0.9081302111639066), WIN(0.9092448955708942),
+    WIN(0.9103536750640646), WIN(0.9114565278442238), WIN(0.9125534322172648), WIN(0.9136443665947993),
+    WIN(0.9147293094947843), WIN(0.9158082395421472), WIN(0.9168811354694062), WIN(0.9179479761172913),
+    WIN(0.9190087404353586), WIN(0.9200634074826033), WIN(0.9211119564280696), WIN(0.9221543665514583),
+    WIN(0.9231906172437292), WIN(0.9242206880077026), WIN(0.9252445584586577), WIN(0.9262622083249257),
+    WIN(0.9272736174484818), WIN(0.9282787657855337), WIN(0.9292776334071065), WIN(0.930270200499625),
+    WIN(0.9312564473654915), WIN(0.932236354423662), WIN(0.9332099022102187), WIN(0.9341770713789381),
+    WIN(0.9351378427018574), WIN(0.9360921970698364), WIN(0.9370401154931169), WIN(0.9379815791018785),
+    WIN(0.9389165691467903), WIN(0.9398450669995609), WIN(0.9407670541534828), WIN(0.9416825122239753),
+    WIN(0.9425914229491227), WIN(0.9434937681902106), WIN(0.9443895299322562), WIN(0.9452786902845373),
+    WIN(0.946161231481117), WIN(0.9470371358813651), WIN(0.9479063859704753), WIN(0.9487689643599794),
+    WIN(0.9496248537882581), WIN(0.9504740371210479), WIN(0.9513164973519438), WIN(0.9521522176028991),
+    WIN(0.9529811811247221), WIN(0.9538033712975675), WIN(0.9546187716314252), WIN(0.9554273657666049),
+    WIN(0.9562291374742191), WIN(0.9570240706566573), WIN(0.9578121493480625), WIN(0.9585933577147995),
+    WIN(0.9593676800559214), WIN(0.9601351008036321), WIN(0.9608956045237442), WIN(0.9616491759161343),
+    WIN(0.962395799815193), WIN(0.9631354611902718), WIN(0.9638681451461272), WIN(0.9645938369233579),
+    WIN(0.9653125218988419), WIN(0.9660241855861658), WIN(0.9667288136360533), WIN(0.9674263918367887),
+    WIN(0.9681169061146346), WIN(0.9688003425342492), WIN(0.9694766872990959), WIN(0.9701459267518516),
+    WIN(0.9708080473748097), WIN(0.9714630357902789), WIN(0.9721108787609788), WIN(0.9727515631904307),
+    WIN(0.9733850761233439), WIN(0.9740114047460002), WIN(0.9746305363866308), WIN(0.9752424585157914),
+    WIN(0.9758471587467331), WIN(0.9764446248357683), WIN(0.9770348446826327), WIN(0.977617806330843),
+    WIN(0.9781934979680516), WIN(0.9787619079263941), WIN(0.9793230246828369), WIN(0.9798768368595163),
+    WIN(0.980423333224076), WIN(0.9809625026900003), WIN(0.9814943343169404), WIN(0.9820188173110408),
+    WIN(0.9825359410252567), WIN(0.9830456949596711), WIN(0.9835480687618041), WIN(0.9840430522269213),
+    WIN(0.9845306352983352), WIN(0.9850108080677032), WIN(0.9854835607753214), WIN(0.9859488838104139),
+    WIN(0.9864067677114178), WIN(0.9868572031662632), WIN(0.9873001810126499), WIN(0.9877356922383191),
+    WIN(0.9881637279813197), WIN(0.988584279530272), WIN(0.9889973383246266), WIN(0.9894028959549165),
+    WIN(0.9898009441630089), WIN(0.9901914748423484), WIN(0.990574480038198), WIN(0.9909499519478762),
+    WIN(0.991317882920987), WIN(0.9916782654596481), WIN(0.9920310922187129), WIN(0.9923763560059893),
+    WIN(0.9927140497824518), WIN(0.9930441666624523), WIN(0.9933666999139228), WIN(0.993681642958577),
+    WIN(0.9939889893721042), WIN(0.9942887328843611), WIN(0.994580867379558), WIN(0.9948653868964391),
+    WIN(0.9951422856284621), WIN(0.9954115579239681), WIN(0.9956731982863514), WIN(0.9959272013742219),
+    WIN(0.9961735620015639), WIN(0.9964122751378907), WIN(0.9966433359083934), WIN(0.9968667395940867),
+    WIN(0.9970824816319479), WIN(0.9972905576150536), WIN(0.9974909632927106), WIN(0.9976836945705816),
+    WIN(0.9978687475108073), WIN(0.9980461183321241), WIN(0.9982158034099748), WIN(0.9983777992766187),
+    WIN(0.9985321026212328), WIN(0.998678710290011), WIN(0.9988176192862578), WIN(0.9989488267704776),
+    WIN(0.9990723300604589), WIN(0.999188126631354), WIN(0.9992962141157545), WIN(0.9993965903037612),
+    WIN(0.9994892531430501), WIN(0.9995742007389337), WIN(0.9996514313544163), WIN(0.9997209434102472),
+    WIN(0.9997827354849667), WIN(0.9998368063149481), WIN(0.9998831547944365), WIN(0.9999217799755803),
+    WIN(0.9999526810684604), WIN(0.9999758574411133), WIN(0.9999913086195498), WIN(0.9999990342877694),
+};
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+static const kiss_fft_cpx stage_twiddles_2048[1023] = {
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.7071067811865476, -0.7071067811865475),
+    TW(0.38268343236508984, -0.9238795325112867), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(-0.9238795325112868, 0.38268343236508967), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.5555702330196023, -0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.4713967368259977, -0.881921264348355), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6343932841636455, -0.773010453362737), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.555570233019602, -0.8314696123025455),
+    TW(-0.9951847266721969, 0.09801714032956059), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.8314696123025453, -0.5555702330196022),
+    TW(-0.7730104533627371, 0.6343932841636453), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(-0.29028467725446244, 0.9569403357322088), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.4496113296546066, -0.8932243011955153), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.6715589548470183, -0.7409511253549591),
+    TW(0.3136817403988916, -0.9495281805930367), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.5956993044924335, -0.8032075314806448),
+    TW(0.17096188876030136, -0.9852776423889412), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.024541228522912264, -0.9996988186962042), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.12241067519921615, -0.99247953459871), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.534997619887097, -0.8448535652497072), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6895405447370669, -0.7242470829514669), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6531728429537768, -0.7572088465064845), TW(-0.14673047445536164, -0.989176509964781),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6152315905806268, -0.7883464276266062), TW(-0.24298017990326387, -0.970031253194544),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5758081914178453, -0.8175848131515837), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5349976198870973, -0.844853565249707), TW(-0.42755509343028186, -0.9039892931234434),
+    TW(-0.99247953459871, -0.12241067519921635), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.4928981922297841, -0.8700869911087113), TW(-0.5141027441932217, -0.8577286100002721),
+    TW(-0.9996988186962042, 0.02454122852291208), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4496113296546066, -0.8932243011955153), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(-0.9852776423889413, 0.17096188876030097), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.40524131400498986, -0.9142097557035307), TW(-0.6715589548470184, -0.740951125354959),
+    TW(-0.9495281805930368, 0.3136817403988912), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3598950365349883, -0.9329927988347388), TW(-0.7409511253549589, -0.6715589548470186),
+    TW(-0.8932243011955153, 0.44961132965460665), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.3136817403988916, -0.9495281805930367), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(-0.8175848131515837, 0.5758081914178453), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.2667127574748984, -0.9637760657954398), TW(-0.857728610000272, -0.5141027441932218),
+    TW(-0.724247082951467, 0.6895405447370668), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.21910124015686977, -0.9757021300385286), TW(-0.9039892931234433, -0.42755509343028203),
+    TW(-0.6152315905806273, 0.7883464276266059), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.17096188876030136, -0.9852776423889412), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(-0.4928981922297842, 0.8700869911087113), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.12241067519921628, -0.99247953459871), TW(-0.970031253194544, -0.24298017990326407),
+    TW(-0.35989503653498794, 0.932992798834739), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.07356456359966745, -0.9972904566786902), TW(-0.989176509964781, -0.1467304744553618),
+    TW(-0.2191012401568701, 0.9757021300385285), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.024541228522912264, -0.9996988186962042), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(-0.07356456359966736, 0.9972904566786902), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9999811752826011, -0.006135884649154475), TW(0.9999247018391445, -0.012271538285719925),
+    TW(0.9998305817958234, -0.01840672990580482), TW(0.9999247018391445, -0.012271538285719925),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9998305817958234, -0.01840672990580482), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9984755805732948, -0.055195244349689934), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9995294175010931, -0.030674803176636626), TW(0.9981181129001492, -0.06132073630220858),
+    TW(0.9957674144676598, -0.09190895649713272), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9990777277526454, -0.04293825693494082), TW(0.996312612182778, -0.0857973123444399),
+    TW(0.9917097536690995, -0.12849811079379317), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9984755805732948, -0.055195244349689934), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9863080972445987, -0.16491312048996992), TW(0.9981181129001492, -0.06132073630220858),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.9977230666441916, -0.06744391956366405), TW(0.99090263542778, -0.13458070850712617),
+    TW(0.9795697656854405, -0.2011046348420919), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9968202992911657, -0.07968243797143013), TW(0.9873014181578584, -0.15885814333386145),
+    TW(0.9715038909862518, -0.2370236059943672), TW(0.996312612182778, -0.0857973123444399),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.9957674144676598, -0.09190895649713272), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.9621214042690416, -0.272621355449949), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9945645707342554, -0.10412163387205459), TW(0.9783173707196277, -0.20711137619221856),
+    TW(0.9514350209690083, -0.30784964004153487), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.9932119492347945, -0.11631863091190475), TW(0.9729399522055602, -0.2310581082806711),
+    TW(0.9394592236021899, -0.3426607173119944), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.9917097536690995, -0.12849811079379317), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.9262102421383114, -0.37700741021641826), TW(0.99090263542778, -0.13458070850712617),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.9900582102622971, -0.1406582393328492), TW(0.9604305194155658, -0.27851968938505306),
+    TW(0.9117060320054299, -0.4108431710579039), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9882575677307495, -0.15279718525844344), TW(0.9533060403541939, -0.3020059493192281),
+    TW(0.8959662497561852, -0.4441221445704292), TW(0.9873014181578584, -0.15885814333386145),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.9863080972445987, -0.16491312048996992), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.8790122264286335, -0.4767992300633221), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.984210092386929, -0.17700422041214875), TW(0.937339011912575, -0.34841868024943456),
+    TW(0.8608669386377673, -0.508830142543107), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.9819638691095552, -0.1890686641498062), TW(0.9285060804732156, -0.37131719395183754),
+    TW(0.8415549774368984, -0.5401714727298929), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9795697656854405, -0.2011046348420919), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.8211025149911046, -0.5707807458869673), TW(0.9783173707196277, -0.20711137619221856),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.9770281426577544, -0.21311031991609136), TW(0.9091679830905224, -0.41642956009763715),
+    TW(0.799537269107905, -0.600616479383869), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.9743393827855759, -0.22508391135979283), TW(0.8986744656939538, -0.43861623853852766),
+    TW(0.7768884656732324, -0.629638238914927), TW(0.9729399522055602, -0.2310581082806711),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.9715038909862518, -0.2370236059943672), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.7531867990436125, -0.6578066932970786), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9685220942744174, -0.24892760574572015), TW(0.8760700941954066, -0.4821837720791227),
+    TW(0.7284643904482252, -0.6850836677727004), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.9653944416976894, -0.2607941179152755), TW(0.8639728561215868, -0.5035383837257176),
+    TW(0.7027547444572253, -0.7114321957452164), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.9621214042690416, -0.272621355449949), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.676092703575316, -0.7368165688773698), TW(0.9604305194155658, -0.27851968938505306),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.6624157775901718, -0.7491363945234593),
+    TW(0.9587034748958716, -0.2844075372112719), TW(0.8382247055548381, -0.5453249884220465),
+    TW(0.6485144010221126, -0.7612023854842618), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9551411683057708, -0.2961508882436238), TW(0.8245893027850253, -0.5657318107836131),
+    TW(0.6200572117632892, -0.7845565971555752), TW(0.9533060403541939, -0.3020059493192281),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.6055110414043255, -0.7958369046088835),
+    TW(0.9514350209690083, -0.30784964004153487), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.5907597018588743, -0.8068475535437992), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.9475855910177411, -0.3195020308160157), TW(0.7958369046088836, -0.6055110414043255),
+    TW(0.560661576197336, -0.8280450452577558), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.5453249884220465, -0.838224705554838),
+    TW(0.9435934581619604, -0.33110630575987643), TW(0.7807372285720945, -0.6248594881423863),
+    TW(0.5298036246862948, -0.8481203448032971), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.9394592236021899, -0.3426607173119944), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.49822766697278187, -0.8670462455156926), TW(0.937339011912575, -0.34841868024943456),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.48218377207912283, -0.8760700941954066),
+    TW(0.9351835099389476, -0.35416352542049034), TW(0.7491363945234594, -0.6624157775901718),
+    TW(0.4659764957679661, -0.8847970984309378), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.4496113296546066, -0.8932243011955153),
+    TW(0.9307669610789837, -0.36561299780477385), TW(0.7326542716724128, -0.680600997795453),
+    TW(0.433093818853152, -0.901348847046022), TW(0.9285060804732156, -0.37131719395183754),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.4164295600976373, -0.9091679830905223),
+    TW(0.9262102421383114, -0.37700741021641826), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.3996241998456468, -0.9166790599210427), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.921514039342042, -0.38834504669882625), TW(0.6983762494089729, -0.7157308252838186),
+    TW(0.36561299780477396, -0.9307669610789837), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.3484186802494345, -0.937339011912575),
+    TW(0.9166790599210427, -0.3996241998456468), TW(0.6806009977954531, -0.7326542716724128),
+    TW(0.33110630575987643, -0.9435934581619604), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.6715589548470183, -0.7409511253549591), TW(0.3136817403988916, -0.9495281805930367),
+    TW(0.9117060320054299, -0.4108431710579039), TW(0.6624157775901718, -0.7491363945234593),
+    TW(0.29615088824362396, -0.9551411683057707), TW(0.9091679830905224, -0.41642956009763715),
+    TW(0.6531728429537768, -0.7572088465064845), TW(0.27851968938505306, -0.9604305194155658),
+    TW(0.9065957045149153, -0.4220002707997997), TW(0.6438315428897915, -0.765167265622459),
+    TW(0.26079411791527557, -0.9653944416976894), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.901348847046022, -0.43309381885315196), TW(0.6248594881423865, -0.7807372285720944),
+    TW(0.22508391135979278, -0.9743393827855759), TW(0.8986744656939538, -0.43861623853852766),
+    TW(0.6152315905806268, -0.7883464276266062), TW(0.20711137619221856, -0.9783173707196277),
+    TW(0.8959662497561852, -0.4441221445704292), TW(0.6055110414043255, -0.7958369046088835),
+    TW(0.18906866414980628, -0.9819638691095552), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.5956993044924335, -0.8032075314806448), TW(0.17096188876030136, -0.9852776423889412),
+    TW(0.8904487232447579, -0.45508358712634384), TW(0.5857978574564389, -0.8104571982525948),
+    TW(0.1527971852584434, -0.9882575677307495), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.13458070850712622, -0.99090263542778),
+    TW(0.8847970984309378, -0.4659764957679662), TW(0.5657318107836132, -0.8245893027850253),
+    TW(0.11631863091190488, -0.9932119492347945), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8790122264286335, -0.4767992300633221), TW(0.5453249884220465, -0.838224705554838),
+    TW(0.07968243797143013, -0.9968202992911657), TW(0.8760700941954066, -0.4821837720791227),
+    TW(0.5349976198870973, -0.844853565249707), TW(0.06132073630220865, -0.9981181129001492),
+    TW(0.8730949784182901, -0.487550160148436), TW(0.5245896826784688, -0.8513551931052652),
+    TW(0.04293825693494096, -0.9990777277526454), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.024541228522912264, -0.9996988186962042),
+    TW(0.8670462455156926, -0.49822766697278187), TW(0.5035383837257176, -0.8639728561215867),
+    TW(0.006135884649154515, -0.9999811752826011), TW(0.8639728561215868, -0.5035383837257176),
+    TW(0.4928981922297841, -0.8700869911087113), TW(-0.012271538285719823, -0.9999247018391445),
+    TW(0.8608669386377673, -0.508830142543107), TW(0.48218377207912283, -0.8760700941954066),
+    TW(-0.03067480317663646, -0.9995294175010931), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8545579883654005, -0.5193559901655896), TW(0.46053871095824, -0.8876396204028539),
+    TW(-0.06744391956366398, -0.9977230666441916), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.4496113296546066, -0.8932243011955153), TW(-0.08579731234443976, -0.996312612182778),
+    TW(0.8481203448032972, -0.5298036246862946), TW(0.4386162385385277, -0.8986744656939538),
+    TW(-0.1041216338720546, -0.9945645707342554), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.12241067519921615, -0.99247953459871),
+    TW(0.8415549774368984, -0.5401714727298929), TW(0.4164295600976373, -0.9091679830905223),
+    TW(-0.14065823933284913, -0.9900582102622971), TW(0.8382247055548381, -0.5453249884220465),
+    TW(0.40524131400498986, -0.9142097557035307), TW(-0.15885814333386128, -0.9873014181578584),
+    TW(0.83486287498638, -0.5504579729366048), TW(0.3939920400610481, -0.9191138516900578),
+    TW(-0.17700422041214875, -0.984210092386929), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8280450452577558, -0.560661576197336), TW(0.3713171939518376, -0.9285060804732155),
+    TW(-0.21311031991609125, -0.9770281426577544), TW(0.8245893027850253, -0.5657318107836131),
+    TW(0.3598950365349883, -0.9329927988347388), TW(-0.23105810828067114, -0.9729399522055602),
+    TW(0.8211025149911046, -0.5707807458869673), TW(0.3484186802494345, -0.937339011912575),
+    TW(-0.24892760574572012, -0.9685220942744174), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(0.8140363297059484, -0.5808139580957645), TW(0.325310292162263, -0.9456073253805213),
+    TW(-0.2844075372112717, -0.9587034748958716), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.3136817403988916, -0.9495281805930367), TW(-0.3020059493192281, -0.9533060403541939),
+    TW(0.8068475535437993, -0.5907597018588742), TW(0.3020059493192282, -0.9533060403541938),
+    TW(-0.31950203081601564, -0.9475855910177412), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.799537269107905, -0.600616479383869), TW(0.27851968938505306, -0.9604305194155658),
+    TW(-0.3541635254204904, -0.9351835099389476), TW(0.7958369046088836, -0.6055110414043255),
+    TW(0.2667127574748984, -0.9637760657954398), TW(-0.3713171939518375, -0.9285060804732156),
+    TW(0.7921065773002124, -0.6103828062763095), TW(0.2548656596045146, -0.9669764710448521),
+    TW(-0.3883450466988262, -0.921514039342042), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(0.7845565971555752, -0.6200572117632891), TW(0.23105810828067128, -0.9729399522055601),
+    TW(-0.4220002707997997, -0.9065957045149153), TW(0.7807372285720945, -0.6248594881423863),
+    TW(0.21910124015686977, -0.9757021300385286), TW(-0.4386162385385274, -0.8986744656939539),
+    TW(0.7768884656732324, -0.629638238914927), TW(0.20711137619221856, -0.9783173707196277),
+    TW(-0.4550835871263437, -0.890448723244758), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7691033376455797, -0.6391244448637757), TW(0.18303988795514106, -0.9831054874312163),
+    TW(-0.4875501601484357, -0.8730949784182902), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.17096188876030136, -0.9852776423889412), TW(-0.5035383837257175, -0.8639728561215868),
+    TW(0.7612023854842618, -0.6485144010221124), TW(0.1588581433338614, -0.9873014181578584),
+    TW(-0.5193559901655896, -0.8545579883654005), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.534997619887097, -0.8448535652497072),
+    TW(0.7531867990436125, -0.6578066932970786), TW(0.13458070850712622, -0.99090263542778),
+    TW(-0.5504579729366047, -0.8348628749863801), TW(0.7491363945234594, -0.6624157775901718),
+    TW(0.12241067519921628, -0.99247953459871), TW(-0.5657318107836132, -0.8245893027850252),
+    TW(0.7450577854414661, -0.6669999223036375), TW(0.11022220729388318, -0.9939069700023561),
+    TW(-0.5808139580957644, -0.8140363297059485), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.7368165688773699, -0.6760927035753159), TW(0.08579731234443988, -0.996312612182778),
+    TW(-0.6103828062763096, -0.7921065773002123), TW(0.7326542716724128, -0.680600997795453),
+    TW(0.07356456359966745, -0.9972904566786902), TW(-0.6248594881423862, -0.7807372285720946),
+    TW(0.7284643904482252, -0.6850836677727004), TW(0.06132073630220865, -0.9981181129001492),
+    TW(-0.6391244448637757, -0.7691033376455796), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(0.7200025079613817, -0.693971460889654), TW(0.03680722294135899, -0.9993223845883495),
+    TW(-0.6669999223036374, -0.7450577854414661), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.024541228522912264, -0.9996988186962042), TW(-0.680600997795453, -0.7326542716724128),
+    TW(0.7114321957452164, -0.7027547444572253), TW(0.012271538285719944, -0.9999247018391445),
+    TW(-0.6939714608896538, -0.7200025079613818), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.7027547444572253, -0.7114321957452164), TW(-0.012271538285719823, -0.9999247018391445),
+    TW(-0.7200025079613817, -0.693971460889654), TW(0.6983762494089729, -0.7157308252838186),
+    TW(-0.024541228522912142, -0.9996988186962042), TW(-0.7326542716724127, -0.6806009977954532),
+    TW(0.693971460889654, -0.7200025079613817), TW(-0.036807222941358866, -0.9993223845883495),
+    TW(-0.745057785441466, -0.6669999223036376), TW(0.6895405447370669, -0.7242470829514669),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(0.6850836677727004, -0.7284643904482252), TW(-0.06132073630220853, -0.9981181129001492),
+    TW(-0.7691033376455795, -0.6391244448637758), TW(0.6806009977954531, -0.7326542716724128),
+    TW(-0.07356456359966733, -0.9972904566786902), TW(-0.7807372285720945, -0.6248594881423863),
+    TW(0.676092703575316, -0.7368165688773698), TW(-0.08579731234443976, -0.996312612182778),
+    TW(-0.7921065773002122, -0.6103828062763097), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6669999223036375, -0.745057785441466), TW(-0.11022220729388306, -0.9939069700023561),
+    TW(-0.8140363297059484, -0.5808139580957645), TW(0.6624157775901718, -0.7491363945234593),
+    TW(-0.12241067519921615, -0.99247953459871), TW(-0.8245893027850251, -0.5657318107836135),
+    TW(0.6578066932970786, -0.7531867990436124), TW(-0.1345807085071261, -0.99090263542778),
+    TW(-0.83486287498638, -0.5504579729366049), TW(0.6531728429537768, -0.7572088465064845),
+    TW(-0.14673047445536164, -0.989176509964781), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(0.6485144010221126, -0.7612023854842618), TW(-0.15885814333386128, -0.9873014181578584),
+    TW(-0.8545579883654004, -0.5193559901655898), TW(0.6438315428897915, -0.765167265622459),
+    TW(-0.17096188876030124, -0.9852776423889412), TW(-0.8639728561215867, -0.5035383837257177),
+    TW(0.6391244448637757, -0.7691033376455796), TW(-0.18303988795514092, -0.9831054874312163),
+    TW(-0.8730949784182901, -0.4875501601484359), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6296382389149271, -0.7768884656732324), TW(-0.20711137619221845, -0.9783173707196277),
+    TW(-0.8904487232447579, -0.4550835871263439), TW(0.6248594881423865, -0.7807372285720944),
+    TW(-0.21910124015686966, -0.9757021300385286), TW(-0.8986744656939539, -0.43861623853852755),
+    TW(0.6200572117632892, -0.7845565971555752), TW(-0.23105810828067114, -0.9729399522055602),
+    TW(-0.9065957045149153, -0.42200027079979985), TW(0.6152315905806268, -0.7883464276266062),
+    TW(-0.24298017990326387, -0.970031253194544), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(0.6103828062763095, -0.7921065773002124), TW(-0.2548656596045145, -0.9669764710448521),
+    TW(-0.9215140393420418, -0.3883450466988266), TW(0.6055110414043255, -0.7958369046088835),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(-0.9285060804732155, -0.3713171939518377),
+    TW(0.600616479383869, -0.799537269107905), TW(-0.27851968938505295, -0.9604305194155659),
+    TW(-0.9351835099389476, -0.3541635254204904), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5907597018588743, -0.8068475535437992), TW(-0.3020059493192281, -0.9533060403541939),
+    TW(-0.9475855910177411, -0.3195020308160158), TW(0.5857978574564389, -0.8104571982525948),
+    TW(-0.3136817403988914, -0.9495281805930367), TW(-0.9533060403541939, -0.30200594931922803),
+    TW(0.5808139580957645, -0.8140363297059483), TW(-0.32531029216226287, -0.9456073253805214),
+    TW(-0.9587034748958715, -0.2844075372112721), TW(0.5758081914178453, -0.8175848131515837),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(0.5707807458869674, -0.8211025149911046), TW(-0.3484186802494344, -0.937339011912575),
+    TW(-0.9685220942744174, -0.2489276057457201), TW(0.5657318107836132, -0.8245893027850253),
+    TW(-0.35989503653498817, -0.9329927988347388), TW(-0.9729399522055601, -0.23105810828067133),
+    TW(0.560661576197336, -0.8280450452577558), TW(-0.3713171939518375, -0.9285060804732156),
+    TW(-0.9770281426577544, -0.21311031991609142), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5504579729366048, -0.83486287498638), TW(-0.393992040061048, -0.9191138516900578),
+    TW(-0.984210092386929, -0.17700422041214894), TW(0.5453249884220465, -0.838224705554838),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(-0.9873014181578584, -0.15885814333386147),
+    TW(0.540171472729893, -0.8415549774368983), TW(-0.416429560097637, -0.9091679830905225),
+    TW(-0.990058210262297, -0.14065823933284954), TW(0.5349976198870973, -0.844853565249707),
+    TW(-0.42755509343028186, -0.9039892931234434), TW(-0.99247953459871, -0.12241067519921635),
+    TW(0.5298036246862948, -0.8481203448032971), TW(-0.4386162385385274, -0.8986744656939539),
+    TW(-0.9945645707342554, -0.10412163387205457), TW(0.5245896826784688, -0.8513551931052652),
+    TW(-0.4496113296546067, -0.8932243011955152), TW(-0.996312612182778, -0.08579731234444016),
+    TW(0.5193559901655895, -0.8545579883654005), TW(-0.46053871095824006, -0.8876396204028539),
+    TW(-0.9977230666441916, -0.06744391956366418), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.508830142543107, -0.8608669386377673), TW(-0.4821837720791227, -0.8760700941954066),
+    TW(-0.9995294175010931, -0.030674803176636865), TW(0.5035383837257176, -0.8639728561215867),
+    TW(-0.492898192229784, -0.8700869911087115), TW(-0.9999247018391445, -0.012271538285720007),
+    TW(0.49822766697278187, -0.8670462455156926), TW(-0.5035383837257175, -0.8639728561215868),
+    TW(-0.9999811752826011, 0.006135884649154554), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.5141027441932217, -0.8577286100002721), TW(-0.9996988186962042, 0.02454122852291208),
+    TW(0.48755016014843605, -0.8730949784182901), TW(-0.5245896826784687, -0.8513551931052652),
+    TW(-0.9990777277526454, 0.04293825693494078), TW(0.48218377207912283, -0.8760700941954066),
+    TW(-0.534997619887097, -0.8448535652497072), TW(-0.9981181129001492, 0.061320736302208245),
+    TW(0.47679923006332225, -0.8790122264286334), TW(-0.5453249884220462, -0.8382247055548382),
+    TW(-0.9968202992911658, 0.07968243797142995), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4659764957679661, -0.8847970984309378), TW(-0.5657318107836132, -0.8245893027850252),
+    TW(-0.9932119492347946, 0.11631863091190447), TW(0.46053871095824, -0.8876396204028539),
+    TW(-0.5758081914178453, -0.8175848131515837), TW(-0.99090263542778, 0.13458070850712606),
+    TW(0.45508358712634384, -0.8904487232447579), TW(-0.5857978574564389, -0.8104571982525948),
+    TW(-0.9882575677307495, 0.15279718525844344), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(-0.9852776423889413, 0.17096188876030097),
+    TW(0.44412214457042926, -0.8959662497561851), TW(-0.6055110414043254, -0.7958369046088836),
+    TW(-0.9819638691095552, 0.1890686641498061), TW(0.4386162385385277, -0.8986744656939538),
+    TW(-0.6152315905806267, -0.7883464276266063), TW(-0.9783173707196277, 0.2071113761922186),
+    TW(0.433093818853152, -0.901348847046022), TW(-0.6248594881423862, -0.7807372285720946),
+    TW(-0.9743393827855759, 0.2250839113597926), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.4220002707997998, -0.9065957045149153), TW(-0.6438315428897913, -0.7651672656224591),
+    TW(-0.9653944416976894, 0.2607941179152756), TW(0.4164295600976373, -0.9091679830905223),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(-0.9604305194155659, 0.2785196893850529),
+    TW(0.4108431710579039, -0.9117060320054299), TW(-0.6624157775901719, -0.7491363945234593),
+    TW(-0.9551411683057708, 0.2961508882436238), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.6715589548470184, -0.740951125354959), TW(-0.9495281805930368, 0.3136817403988912),
+    TW(0.3996241998456468, -0.9166790599210427), TW(-0.680600997795453, -0.7326542716724128),
+    TW(-0.9435934581619604, 0.33110630575987626), TW(0.3939920400610481, -0.9191138516900578),
+    TW(-0.6895405447370669, -0.7242470829514669), TW(-0.937339011912575, 0.34841868024943456),
+    TW(0.3883450466988263, -0.9215140393420419), TW(-0.6983762494089728, -0.7157308252838187),
+    TW(-0.9307669610789838, 0.3656129978047736), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3770074102164183, -0.9262102421383113), TW(-0.7157308252838186, -0.6983762494089729),
+    TW(-0.9166790599210427, 0.39962419984564684), TW(0.3713171939518376, -0.9285060804732155),
+    TW(-0.7242470829514668, -0.689540544737067), TW(-0.9091679830905225, 0.41642956009763693),
+    TW(0.36561299780477396, -0.9307669610789837), TW(-0.7326542716724127, -0.6806009977954532),
+    TW(-0.901348847046022, 0.43309381885315185), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.7409511253549589, -0.6715589548470186), TW(-0.8932243011955153, 0.44961132965460665),
+    TW(0.3541635254204905, -0.9351835099389475), TW(-0.7491363945234591, -0.662415777590172),
+    TW(-0.8847970984309379, 0.46597649576796596), TW(0.3484186802494345, -0.937339011912575),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(-0.8760700941954066, 0.48218377207912266),
+    TW(0.3426607173119944, -0.9394592236021899), TW(-0.765167265622459, -0.6438315428897914),
+    TW(-0.8670462455156929, 0.49822766697278154), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.33110630575987643, -0.9435934581619604), TW(-0.7807372285720945, -0.6248594881423863),
+    TW(-0.8481203448032972, 0.5298036246862946), TW(0.325310292162263, -0.9456073253805213),
+    TW(-0.7883464276266062, -0.6152315905806269), TW(-0.8382247055548382, 0.5453249884220461),
+    TW(0.31950203081601575, -0.9475855910177411), TW(-0.7958369046088835, -0.6055110414043257),
+    TW(-0.8280450452577558, 0.5606615761973359), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(-0.8175848131515837, 0.5758081914178453),
+    TW(0.307849640041535, -0.9514350209690083), TW(-0.8104571982525947, -0.585797857456439),
+    TW(-0.8068475535437994, 0.5907597018588739), TW(0.3020059493192282, -0.9533060403541938),
+    TW(-0.8175848131515836, -0.5758081914178454), TW(-0.7958369046088836, 0.6055110414043254),
+    TW(0.29615088824362396, -0.9551411683057707), TW(-0.8245893027850251, -0.5657318107836135),
+    TW(-0.7845565971555752, 0.6200572117632892), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.2844075372112718, -0.9587034748958716), TW(-0.8382247055548381, -0.5453249884220464),
+    TW(-0.7612023854842619, 0.6485144010221123), TW(0.27851968938505306, -0.9604305194155658),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(-0.7491363945234593, 0.6624157775901718),
+    TW(0.272621355449949, -0.9621214042690416), TW(-0.8513551931052652, -0.524589682678469),
+    TW(-0.73681656887737, 0.6760927035753158), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.857728610000272, -0.5141027441932218), TW(-0.724247082951467, 0.6895405447370668),
+    TW(0.26079411791527557, -0.9653944416976894), TW(-0.8639728561215867, -0.5035383837257177),
+    TW(-0.7114321957452167, 0.7027547444572251), TW(0.2548656596045146, -0.9669764710448521),
+    TW(-0.8700869911087113, -0.49289819222978415), TW(-0.698376249408973, 0.7157308252838185),
+    TW(0.24892760574572026, -0.9685220942744173), TW(-0.8760700941954065, -0.4821837720791229),
+    TW(-0.6850836677727004, 0.7284643904482252), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.23702360599436734, -0.9715038909862518), TW(-0.8876396204028538, -0.4605387109582402),
+    TW(-0.6578066932970787, 0.7531867990436124), TW(0.23105810828067128, -0.9729399522055601),
+    TW(-0.8932243011955152, -0.4496113296546069), TW(-0.6438315428897915, 0.765167265622459),
+    TW(0.22508391135979278, -0.9743393827855759), TW(-0.8986744656939539, -0.43861623853852755),
+    TW(-0.6296382389149269, 0.7768884656732326), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.9039892931234433, -0.42755509343028203), TW(-0.6152315905806273, 0.7883464276266059),
+    TW(0.21311031991609136, -0.9770281426577544), TW(-0.9091679830905224, -0.41642956009763715),
+    TW(-0.6006164793838693, 0.7995372691079048), TW(0.20711137619221856, -0.9783173707196277),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(-0.5857978574564391, 0.8104571982525947),
+    TW(0.20110463484209196, -0.9795697656854405), TW(-0.9191138516900578, -0.39399204006104815),
+    TW(-0.5707807458869674, 0.8211025149911046), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.18906866414980628, -0.9819638691095552), TW(-0.9285060804732155, -0.3713171939518377),
+    TW(-0.5401714727298927, 0.8415549774368986), TW(0.18303988795514106, -0.9831054874312163),
+    TW(-0.9329927988347388, -0.35989503653498833), TW(-0.5245896826784694, 0.8513551931052649),
+    TW(0.17700422041214886, -0.984210092386929), TW(-0.9373390119125748, -0.3484186802494348),
+    TW(-0.5088301425431073, 0.8608669386377671), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(-0.4928981922297842, 0.8700869911087113),
+    TW(0.1649131204899701, -0.9863080972445987), TW(-0.9456073253805212, -0.32531029216226326),
+    TW(-0.47679923006332214, 0.8790122264286334), TW(0.1588581433338614, -0.9873014181578584),
+    TW(-0.9495281805930367, -0.3136817403988914), TW(-0.4605387109582399, 0.887639620402854),
+    TW(0.1527971852584434, -0.9882575677307495), TW(-0.9533060403541939, -0.30200594931922803),
+    TW(-0.44412214457042976, 0.8959662497561849), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.14065823933284924, -0.9900582102622971), TW(-0.9604305194155658, -0.27851968938505317),
+    TW(-0.4108431710579042, 0.9117060320054298), TW(0.13458070850712622, -0.99090263542778),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(-0.3939920400610482, 0.9191138516900577),
+    TW(0.12849811079379322, -0.9917097536690995), TW(-0.9669764710448521, -0.2548656596045147),
+    TW(-0.3770074102164182, 0.9262102421383114), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.970031253194544, -0.24298017990326407), TW(-0.35989503653498794, 0.932992798834739),
+    TW(0.11631863091190488, -0.9932119492347945), TW(-0.9729399522055601, -0.23105810828067133),
+    TW(-0.3426607173119949, 0.9394592236021897), TW(0.11022220729388318, -0.9939069700023561),
+    TW(-0.9757021300385285, -0.21910124015687005), TW(-0.3253102921622633, 0.9456073253805212),
+    TW(0.10412163387205473, -0.9945645707342554), TW(-0.9783173707196275, -0.20711137619221884),
+    TW(-0.3078496400415351, 0.9514350209690083), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.0919089564971327, -0.9957674144676598), TW(-0.9831054874312163, -0.1830398879551409),
+    TW(-0.27262135544994887, 0.9621214042690416), TW(0.08579731234443988, -0.996312612182778),
+    TW(-0.9852776423889412, -0.17096188876030122), TW(-0.25486565960451435, 0.9669764710448522),
+    TW(0.07968243797143013, -0.9968202992911657), TW(-0.9873014181578584, -0.15885814333386147),
+    TW(-0.23702360599436767, 0.9715038909862517), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.989176509964781, -0.1467304744553618), TW(-0.2191012401568701, 0.9757021300385285),
+    TW(0.0674439195636641, -0.9977230666441916), TW(-0.99090263542778, -0.13458070850712628),
+    TW(-0.20110463484209207, 0.9795697656854405), TW(0.06132073630220865, -0.9981181129001492),
+    TW(-0.99247953459871, -0.12241067519921635), TW(-0.18303988795514095, 0.9831054874312163),
+    TW(0.05519524434969003, -0.9984755805732948), TW(-0.9939069700023561, -0.11022220729388324),
+    TW(-0.16491312048996976, 0.9863080972445987), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.04293825693494096, -0.9990777277526454), TW(-0.996312612182778, -0.08579731234444016),
+    TW(-0.12849811079379359, 0.9917097536690995), TW(0.03680722294135899, -0.9993223845883495),
+    TW(-0.9972904566786902, -0.07356456359966773), TW(-0.11022220729388331, 0.9939069700023561),
+    TW(0.03067480317663658, -0.9995294175010931), TW(-0.9981181129001492, -0.06132073630220849),
+    TW(-0.09190895649713282, 0.9957674144676598), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(-0.07356456359966736, 0.9972904566786902),
+    TW(0.01840672990580482, -0.9998305817958234), TW(-0.9993223845883495, -0.03680722294135883),
+    TW(-0.05519524434968971, 0.9984755805732948), TW(0.012271538285719944, -0.9999247018391445),
+    TW(-0.9996988186962042, -0.024541228522912326), TW(-0.03680722294135933, 0.9993223845883494),
+    TW(0.006135884649154515, -0.9999811752826011), TW(-0.9999247018391445, -0.012271538285720007),
+    TW(-0.018406729905805164, 0.9998305817958234),
+};
+#endif
+
+static const kiss_fft_index swaps_4096[3720] = {
+    1, 1024, 1024, 2, 2, 256, 256, 8, 8, 64, 64, 32, 32, 16, 16, 128,
+    128, 4, 4, 512, 3, 1280, 1280, 10, 10, 320, 320, 40, 40, 80, 80, 160,
+    160, 20, 20, 640, 640, 5, 5, 1536, 6, 768, 768, 9, 9, 1088, 1088, 34,
+    34, 272, 272, 136, 136, 68, 68, 544, 544, 17, 17, 1152, 7, 1792, 1792, 11,
+    11, 1344, 1344, 42, 42, 336, 336, 168, 168, 84, 84, 672, 672, 21, 21, 1664,
+    12, 576, 576, 33, 33, 1040, 1040, 130, 130, 260, 260, 520, 520, 65, 65, 1056,
+    1056, 18, 18, 384, 13, 1600, 1600, 35, 35, 1296, 1296, 138, 138, 324, 324, 552,
+    552, 81, 81, 1184, 1184, 22, 22, 896, 14, 832, 832, 41, 41, 1104, 1104, 162,
+    162, 276, 276, 648, 648, 69, 69, 1568, 1568, 19, 19, 1408, 15, 1856, 1856, 43,
+    43, 1360, 1360, 170, 170, 340, 340, 680, 680, 85, 85, 1696, 1696, 23, 23, 1920,
+    24, 192, 192, 36, 36, 528, 528, 129, 129, 1028, 1028, 514, 514, 257, 257, 1032,
+    1032, 66, 66, 288, 25, 1216, 1216, 38, 38, 784, 784, 137, 137, 1092, 1092, 546,
+    546, 273, 273, 1160, 1160, 70, 70, 800, 26, 448, 448, 44, 44, 592, 592, 161,
+    161, 1044, 1044, 642, 642, 261, 261, 1544, 1544, 67, 67, 1312, 27, 1472, 1472, 46,
+    46, 848, 848, 169, 169, 1108, 1108, 674, 674, 277, 277, 1672, 1672, 71, 71, 1824,
+    28, 704, 704, 37, 37, 1552, 1552, 131, 131, 1284, 1284, 522, 522, 321, 321, 1064,
+    1064, 82, 82, 416, 29, 1728, 1728, 39, 39, 1808, 1808, 139, 139, 1348, 1348, 554,
+    554, 337, 337, 1192, 1192, 86, 86, 928, 30, 960, 960, 45, 45, 1616, 1616, 163,
+    163, 1300, 1300, 650, 650, 325, 325, 1576, 1576, 83, 83, 1440, 31, 1984, 1984, 47,
+    47, 1872, 1872, 171, 171, 1364, 1364, 682, 682, 341, 341, 1704, 1704, 87, 87, 1952,
+    48, 144, 144, 132, 132, 516, 516, 513, 513, 1025, 1025, 1026, 1026, 258, 258, 264,
+    264, 72, 72, 96, 49, 1168, 1168, 134, 134, 772, 772, 521, 521, 1089, 1089, 1058,
+    1058, 274, 274, 392, 392, 76, 76, 608, 50, 400, 400, 140, 140, 580, 580, 545,
+    545, 1041, 1041, 1154, 1154, 262, 262, 776, 776, 73, 73, 1120, 51, 1424, 1424, 142,
+    142, 836, 836, 553, 553, 1105, 1105, 1186, 1186, 278, 278, 904, 904, 77, 77, 1632,
+    52, 656, 656, 133, 133, 1540, 1540, 515, 515, 1281, 1281, 1034, 1034, 322, 322, 296,
+    296, 88, 88, 224, 53, 1680, 1680, 135, 135, 1796, 1796, 523, 523, 1345, 1345, 1066,
+    1066, 338, 338, 424, 424, 92, 92, 736, 54, 912, 912, 141, 141, 1604, 1604, 547,
+    547, 1297, 1297, 1162, 1162, 326, 326, 808, 808, 89, 89, 1248, 55, 1936, 1936, 143,
+    143, 1860, 1860, 555, 555, 1361, 1361, 1194, 1194, 342, 342, 936, 936, 93, 93, 1760,
+    56, 208, 208, 164, 164, 532, 532, 641, 641, 1029, 1029, 1538, 1538, 259, 259, 1288,
+    1288, 74, 74, 352, 57, 1232, 1232, 166, 166, 788, 788, 649, 649, 1093, 1093, 1570,
+    1570, 275, 275, 1416, 1416, 78, 78, 864, 58, 464, 464, 172, 172, 596, 596, 673,
+    673, 1045, 1045, 1666, 1666, 263, 263, 1800, 1800, 75, 75, 1376, 59, 1488, 1488, 174,
+    174, 852, 852, 681, 681, 1109, 1109, 1698, 1698, 279, 279, 1928, 1928, 79, 79, 1888,
+    60, 720, 720, 165, 165, 1556, 1556, 643, 643, 1285, 1285, 1546, 1546, 323, 323, 1320,
+    1320, 90, 90, 480, 61, 1744, 1744, 167, 167, 1812, 1812, 651, 651, 1349, 1349, 1578,
+    1578, 339, 339, 1448, 1448, 94, 94, 992, 62, 976, 976, 173, 173, 1620, 1620, 675,
+    675, 1301, 1301, 1674, 1674, 327, 327, 1832, 1832, 91, 91, 1504, 63, 2000, 2000, 175,
+    175, 1876, 1876, 683, 683, 1365, 1365, 1706, 1706, 343, 343, 1960, 1960, 95, 95, 2016,
+    97, 1072, 1072, 146, 146, 388, 388, 524, 524, 577, 577, 1057, 1057, 1042, 1042, 386,
+    386, 268, 268, 584, 98, 304, 304, 152, 152, 196, 196, 548, 548, 529, 529, 1153,
+    1153, 1030, 1030, 770, 770, 265, 265, 1096, 99, 1328, 1328, 154, 154, 452, 452, 556,
+    556, 593, 593, 1185, 1185, 1046, 1046, 898, 898, 269, 269, 1608, 100, 560, 560, 145,
+    145, 1156, 1156, 518, 518, 769, 769, 1033, 1033, 1090, 1090, 290, 290, 280, 280, 200,
+    101, 1584, 1584, 147, 147, 1412, 1412, 526, 526, 833, 833, 1065, 1065, 1106, 1106, 418,
+    418, 284, 284, 712, 102, 816, 816, 153, 153, 1220, 1220, 550, 550, 785, 785, 1161,
+    1161, 1094, 1094, 802, 802, 281, 281, 1224, 103, 1840, 1840, 155, 155, 1476, 1476, 558,
+    558, 849, 849, 1193, 1193, 1110, 1110, 930, 930, 285, 285, 1736, 104, 112, 112, 176,
+    176, 148, 148, 644, 644, 517, 517, 1537, 1537, 1027, 1027, 1282, 1282, 266, 266, 328,
+    105, 1136, 1136, 178, 178, 404, 404, 652, 652, 581, 581, 1569, 1569, 1043, 1043, 1410,
+    1410, 270, 270, 840, 106, 368, 368, 184, 184, 212, 212, 676, 676, 533, 533, 1665,
+    1665, 1031, 1031, 1794, 1794, 267, 267, 1352, 107, 1392, 1392, 186, 186, 468, 468, 684,
+    684, 597, 597, 1697, 1697, 1047, 1047, 1922, 1922, 271, 271, 1864, 108, 624, 624, 177,
+    177, 1172, 1172, 646, 646, 773, 773, 1545, 1545, 1091, 1091, 1314, 1314, 282, 282, 456,
+    109, 1648, 1648, 179, 179, 1428, 1428, 654, 654, 837, 837, 1577, 1577, 1107, 1107, 1442,
+    1442, 286, 286, 968, 110, 880, 880, 185, 185, 1236, 1236, 678, 678, 789, 789, 1673,
+    1673, 1095, 1095, 1826, 1826, 283, 283, 1480, 111, 1904, 1904, 187, 187, 1492, 1492, 686,
+    686, 853, 853, 1705, 1705, 1111, 1111, 1954, 1954, 287, 287, 1992, 113, 1200, 1200, 150,
+    150, 900, 900, 525, 525, 1601, 1601, 1059, 1059, 1298, 1298, 394, 394, 332, 332, 616,
+    114, 432, 432, 156, 156, 708, 708, 549, 549, 1553, 1553, 1155, 1155, 1286, 1286, 778,
+    778, 329, 329, 1128, 115, 1456, 1456, 158, 158, 964, 964, 557, 557, 1617, 1617, 1187,
+    1187, 1302, 1302, 906, 906, 333, 333, 1640, 116, 688, 688, 149, 149, 1668, 1668, 519,
+    519, 1793, 1793, 1035, 1035, 1346, 1346, 298, 298, 344, 344, 232, 117, 1712, 1712, 151,
+    151, 1924, 1924, 527, 527, 1857, 1857, 1067, 1067, 1362, 1362, 426, 426, 348, 348, 744,
+    118, 944, 944, 157, 157, 1732, 1732, 551, 551, 1809, 1809, 1163, 1163, 1350, 1350, 810,
+    810, 345, 345, 1256, 119, 1968, 1968, 159, 159, 1988, 1988, 559, 559, 1873, 1873, 1195,
+    1195, 1366, 1366, 938, 938, 349, 349, 1768, 120, 240, 240, 180, 180, 660, 660, 645,
+    645, 1541, 1541, 1539, 1539, 1283, 1283, 1290, 1290, 330, 330, 360, 121, 1264, 1264, 182,
+    182, 916, 916, 653, 653, 1605, 1605, 1571, 1571, 1299, 1299, 1418, 1418, 334, 334, 872,
+    122, 496, 496, 188, 188, 724, 724, 677, 677, 1557, 1557, 1667, 1667, 1287, 1287, 1802,
+    1802, 331, 331, 1384, 123, 1520, 1520, 190, 190, 980, 980, 685, 685, 1621, 1621, 1699,
+    1699, 1303, 1303, 1930, 1930, 335, 335, 1896, 124, 752, 752, 181, 181, 1684, 1684, 647,
+    647, 1797, 1797, 1547, 1547, 1347, 1347, 1322, 1322, 346, 346, 488, 125, 1776, 1776, 183,
+    183, 1940, 1940, 655, 655, 1861, 1861, 1579, 1579, 1363, 1363, 1450, 1450, 350, 350, 1000,
+    126, 1008, 1008, 189, 189, 1748, 1748, 679, 679, 1813, 1813, 1675, 1675, 1351, 1351, 1834,
+    1834, 347, 347, 1512, 127, 2032, 2032, 191, 191, 2004, 2004, 687, 687, 1877, 1877, 1707,
+    1707, 1367, 1367, 1962, 1962, 351, 351, 2024, 193, 1060, 1060, 530, 530, 385, 385, 1036,
+    1036, 578, 578, 289, 289, 1048, 1048, 194, 194, 292, 292, 536, 195, 1316, 1316, 538,
+    538, 449, 449, 1068, 1068, 594, 594, 417, 417, 1052, 1052, 706, 706, 293, 293, 1560,
+    197, 1572, 1572, 531, 531, 1409, 1409, 1038, 1038, 834, 834, 297, 297, 1112, 1112, 226,
+    226, 308, 308, 664, 198, 804, 804, 537, 537, 1217, 1217, 1062, 1062, 786, 786, 393,
+    393, 1100, 1100, 610, 610, 305, 305, 1176, 199, 1828, 1828, 539, 539, 1473, 1473, 1070,
+    1070, 850, 850, 425, 425, 1116, 1116, 738, 738, 309, 309, 1688, 201, 1124, 1124, 562,
+    562, 401, 401, 1164, 1164, 582, 582, 801, 801, 1049, 1049, 1218, 1218, 294, 294, 792,
+    202, 356, 356, 568, 568, 209, 209, 1188, 1188, 534, 534, 897, 897, 1037, 1037, 1602,
+    1602, 291, 291, 1304, 203, 1380, 1380, 570, 570, 465, 465, 1196, 1196, 598, 598, 929,
+    929, 1053, 1053, 1730, 1730, 295, 295, 1816, 204, 612, 612, 561, 561, 1169, 1169, 1158,
+    1158, 774, 774, 777, 777, 1097, 1097, 1122, 1122, 306, 306, 408, 205, 1636, 1636, 563,
+    563, 1425, 1425, 1166, 1166, 838, 838, 809, 809, 1113, 1113, 1250, 1250, 310, 310, 920,
+    206, 868, 868, 569, 569, 1233, 1233, 1190, 1190, 790, 790, 905, 905, 1101, 1101, 1634,
+    1634, 307, 307, 1432, 207, 1892, 1892, 571, 571, 1489, 1489, 1198, 1198, 854, 854, 937,
+    937, 1117, 1117, 1762, 1762, 311, 311, 1944, 210, 420, 420, 540, 540, 705, 705, 1061,
+    1061, 1554, 1554, 387, 387, 1292, 1292, 586, 586, 353, 353, 1080, 211, 1444, 1444, 542,
+    542, 961, 961, 1069, 1069, 1618, 1618, 419, 419, 1308, 1308, 714, 714, 357, 357, 1592,
+    213, 1700, 1700, 535, 535, 1921, 1921, 1039, 1039, 1858, 1858, 299, 299, 1368, 1368, 234,
+    234, 372, 372, 696, 214, 932, 932, 541, 541, 1729, 1729, 1063, 1063, 1810, 1810, 395,
+    395, 1356, 1356, 618, 618, 369, 369, 1208, 215, 1956, 1956, 543, 543, 1985, 1985, 1071,
+    1071, 1874, 1874, 427, 427, 1372, 1372, 746, 746, 373, 373, 1720, 216, 228, 228, 564,
+    564, 657, 657, 1157, 1157, 1542, 1542, 771, 771, 1289, 1289, 1098, 1098, 354, 354, 312,
+    217, 1252, 1252, 566, 566, 913, 913, 1165, 1165, 1606, 1606, 803, 803, 1305, 1305, 1226,
+    1226, 358, 358, 824, 218, 484, 484, 572, 572, 721, 721, 1189, 1189, 1558, 1558, 899,
+    899, 1293, 1293, 1610, 1610, 355, 355, 1336, 219, 1508, 1508, 574, 574, 977, 977, 1197,
+    1197, 1622, 1622, 931, 931, 1309, 1309, 1738, 1738, 359, 359, 1848, 220, 740, 740, 565,
+    565, 1681, 1681, 1159, 1159, 1798, 1798, 779, 779, 1353, 1353, 1130, 1130, 370, 370, 440,
+    221, 1764, 1764, 567, 567, 1937, 1937, 1167, 1167, 1862, 1862, 811, 811, 1369, 1369, 1258,
+    1258, 374, 374, 952, 222, 996, 996, 573, 573, 1745, 1745, 1191, 1191, 1814, 1814, 907,
+    907, 1357, 1357, 1642, 1642, 371, 371, 1464, 223, 2020, 2020, 575, 575, 2001, 2001, 1199,
+    1199, 1878, 1878, 939, 939, 1373, 1373, 1770, 1770, 375, 375, 1976, 225, 1076, 1076, 658,
+    658, 389, 389, 1548, 1548, 579, 579, 1313, 1313, 1050, 1050, 450, 450, 300, 300, 600,
+    227, 1332, 1332, 666, 666, 453, 453, 1580, 1580, 595, 595, 1441, 1441, 1054, 1054, 962,
+    962, 301, 301, 1624, 229, 1588, 1588, 659, 659, 1413, 1413, 1550, 1550, 835, 835, 1321,
+    1321, 1114, 1114, 482, 482, 316, 316, 728, 230, 820, 820, 665, 665, 1221, 1221, 1574,
+    1574, 787, 787, 1417, 1417, 1102, 1102, 866, 866, 313, 313, 1240, 231, 1844, 1844, 667,
+    667, 1477, 1477, 1582, 1582, 851, 851, 1449, 1449, 1118, 1118, 994, 994, 317, 317, 1752,
+    233, 1140, 1140, 690, 690, 405, 405, 1676, 1676, 583, 583, 1825, 1825, 1051, 1051, 1474,
+    1474, 302, 302, 856, 235, 1396, 1396, 698, 698, 469, 469, 1708, 1708, 599, 599, 1953,
+    1953, 1055, 1055, 1986, 1986, 303, 303, 1880, 236, 628, 628, 689, 689, 1173, 1173, 1670,
+    1670, 775, 775, 1801, 1801, 1099, 1099, 1378, 1378, 314, 314, 472, 237, 1652, 1652, 691,
+    691, 1429, 1429, 1678, 1678, 839, 839, 1833, 1833, 1115, 1115, 1506, 1506, 318, 318, 984,
+    238, 884, 884, 697, 697, 1237, 1237, 1702, 1702, 791, 791, 1929, 1929, 1103, 1103, 1890,
+    1890, 315, 315, 1496, 239, 1908, 1908, 699, 699, 1493, 1493, 1710, 1710, 855, 855, 1961,
+    1961, 1119, 1119, 2018, 2018, 319, 319, 2008, 241, 1204, 1204, 662, 662, 901, 901, 1549,
+    1549, 1603, 1603, 1315, 1315, 1306, 1306, 458, 458, 364, 364, 632, 242, 436, 436, 668,
+    668, 709, 709, 1573, 1573, 1555, 1555, 1411, 1411, 1294, 1294, 842, 842, 361, 361, 1144,
+    243, 1460, 1460, 670, 670, 965, 965, 1581, 1581, 1619, 1619, 1443, 1443, 1310, 1310, 970,
+    970, 365, 365, 1656, 244, 692, 692, 661, 661, 1669, 1669, 1543, 1543, 1795, 1795, 1291,
+    1291, 1354, 1354, 362, 362, 376, 376, 248, 245, 1716, 1716, 663, 663, 1925, 1925, 1551,
+    1551, 1859, 1859, 1323, 1323, 1370, 1370, 490, 490, 380, 380, 760, 246, 948, 948, 669,
+    669, 1733, 1733, 1575, 1575, 1811, 1811, 1419, 1419, 1358, 1358, 874, 874, 377, 377, 1272,
+    247, 1972, 1972, 671, 671, 1989, 1989, 1583, 1583, 1875, 1875, 1451, 1451, 1374, 1374, 1002,
+    1002, 381, 381, 1784, 249, 1268, 1268, 694, 694, 917, 917, 1677, 1677, 1607, 1607, 1827,
+    1827, 1307, 1307, 1482, 1482, 366, 366, 888, 250, 500, 500, 700, 700, 725, 725, 1701,
+    1701, 1559, 1559, 1923, 1923, 1295, 1295, 1866, 1866, 363, 363, 1400, 251, 1524, 1524, 702,
+    702, 981, 981, 1709, 1709, 1623, 1623, 1955, 1955, 1311, 1311, 1994, 1994, 367, 367, 1912,
+    252, 756, 756, 693, 693, 1685, 1685, 1671, 1671, 1799, 1799, 1803, 1803, 1355, 1355, 1386,
+    1386, 378, 378, 504, 253, 1780, 1780, 695, 695, 1941, 1941, 1679, 1679, 1863, 1863, 1835,
+    1835, 1371, 1371, 1514, 1514, 382, 382, 1016, 254, 1012, 1012, 701, 701, 1749, 1749, 1703,
+    1703, 1815, 1815, 1931, 1931, 1359, 1359, 1898, 1898, 379, 379, 1528, 255, 2036, 2036, 703,
+    703, 2005, 2005, 1711, 1711, 1879, 1879, 1963, 1963, 1375, 1375, 2026, 2026, 383, 383, 2040,
+    390, 780, 780, 585, 585, 1121, 1121, 1074, 1074, 402, 402, 396, 396, 588, 588, 609,
+    609, 1073, 1073, 1170, 391, 1804, 1804, 587, 587, 1377, 1377, 1082, 1082, 466, 466, 428,
+    428, 604, 604, 737, 737, 1077, 1077, 1682, 397, 1612, 1612, 611, 611, 1329, 1329, 1178,
+    1178, 454, 454, 812, 812, 601, 601, 1249, 1249, 1078, 1078, 914, 398, 844, 844, 617,
+    617, 1137, 1137, 1202, 1202, 406, 406, 908, 908, 589, 589, 1633, 1633, 1075, 1075, 1426,
+    399, 1868, 1868, 619, 619, 1393, 1393, 1210, 1210, 470, 470, 940, 940, 605, 605, 1761,
+    1761, 1079, 1079, 1938, 403, 1420, 1420, 590, 590, 865, 865, 1081, 1081, 1234, 1234, 422,
+    422, 796, 796, 713, 713, 1125, 1125, 1586, 407, 1932, 1932, 591, 591, 1889, 1889, 1083,
+    1083, 1490, 1490, 430, 430, 860, 860, 745, 745, 1141, 1141, 1714, 409, 1228, 1228, 614,
+    614, 817, 817, 1177, 1177, 1222, 1222, 806, 806, 793, 793, 1225, 1225, 1126, 1126, 818,
+    410, 460, 460, 620, 620, 625, 625, 1201, 1201, 1174, 1174, 902, 902, 781, 781, 1609,
+    1609, 1123, 1123, 1330, 411, 1484, 1484, 622, 622, 881, 881, 1209, 1209, 1238, 1238, 934,
+    934, 797, 797, 1737, 1737, 1127, 1127, 1842, 412, 716, 716, 613, 613, 1585, 1585, 1171,
+    1171, 1414, 1414, 782, 782, 841, 841, 1129, 1129, 1138, 1138, 434, 413, 1740, 1740, 615,
+    615, 1841, 1841, 1179, 1179, 1478, 1478, 814, 814, 857, 857, 1257, 1257, 1142, 1142, 946,
+    414, 972, 972, 621, 621, 1649, 1649, 1203, 1203, 1430, 1430, 910, 910, 845, 845, 1641,
+    1641, 1139, 1139, 1458, 415, 1996, 1996, 623, 623, 1905, 1905, 1211, 1211, 1494, 1494, 942,
+    942, 861, 861, 1769, 1769, 1143, 1143, 1970, 421, 1564, 1564, 707, 707, 1317, 1317, 1562,
+    1562, 451, 451, 1324, 1324, 602, 602, 481, 481, 1084, 1084, 722, 423, 1820, 1820, 715,
+    715, 1381, 1381, 1594, 1594, 467, 467, 1452, 1452, 606, 606, 993, 993, 1085, 1085, 1746,
+    429, 1628, 1628, 739, 739, 1333, 1333, 1690, 1690, 455, 455, 1836, 1836, 603, 603, 1505,
+    1505, 1086, 1086, 978, 431, 1884, 1884, 747, 747, 1397, 1397, 1722, 1722, 471, 471, 1964,
+    1964, 607, 607, 2017, 2017, 1087, 1087, 2002, 433, 1180, 1180, 710, 710, 805, 805, 1561,
+    1561, 1219, 1219, 1318, 1318, 794, 794, 457, 457, 1132, 1132, 626, 435, 1436, 1436, 718,
+    718, 869, 869, 1593, 1593, 1235, 1235, 1446, 1446, 798, 798, 969, 969, 1133, 1133, 1650,
+    437, 1692, 1692, 711, 711, 1829, 1829, 1563, 1563, 1475, 1475, 1326, 1326, 858, 858, 489,
+    489, 1148, 1148, 754, 438, 924, 924, 717, 717, 1637, 1637, 1587, 1587, 1427, 1427, 1422,
+    1422, 846, 846, 873, 873, 1145, 1145, 1266, 439, 1948, 1948, 719, 719, 1893, 1893, 1595,
+    1595, 1491, 1491, 1454, 1454, 862, 862, 1001, 1001, 1149, 1149, 1778, 441, 1244, 1244, 742,
+    742, 821, 821, 1689, 1689, 1223, 1223, 1830, 1830, 795, 795, 1481, 1481, 1134, 1134, 882,
+    442, 476, 476, 748, 748, 629, 629, 1713, 1713, 1175, 1175, 1926, 1926, 783, 783, 1865,
+    1865, 1131, 1131, 1394, 443, 1500, 1500, 750, 750, 885, 885, 1721, 1721, 1239, 1239, 1958,
+    1958, 799, 799, 1993, 1993, 1135, 1135, 1906, 444, 732, 732, 741, 741, 1589, 1589, 1683,
+    1683, 1415, 1415, 1806, 1806, 843, 843, 1385, 1385, 1146, 1146, 498, 445, 1756, 1756, 743,
+    743, 1845, 1845, 1691, 1691, 1479, 1479, 1838, 1838, 859, 859, 1513, 1513, 1150, 1150, 1010,
+    446, 988, 988, 749, 749, 1653, 1653, 1715, 1715, 1431, 1431, 1934, 1934, 847, 847, 1897,
+    1897, 1147, 1147, 1522, 447, 2012, 2012, 751, 751, 1909, 1909, 1723, 1723, 1495, 1495, 1966,
+    1966, 863, 863, 2025, 2025, 1151, 1151, 2034, 459, 1388, 1388, 634, 634, 497, 497, 1212,
+    1212, 726, 726, 933, 933, 1565, 1565, 1731, 1731, 1319, 1319, 1818, 461, 1644, 1644, 627,
+    627, 1457, 1457, 1182, 1182, 966, 966, 813, 813, 1625, 1625, 1251, 1251, 1334, 1334, 922,
+    462, 876, 876, 633, 633, 1265, 1265, 1206, 1206, 918, 918, 909, 909, 1613, 1613, 1635,
+    1635, 1331, 1331, 1434, 463, 1900, 1900, 635, 635, 1521, 1521, 1214, 1214, 982, 982, 941,
+    941, 1629, 1629, 1763, 1763, 1335, 1335, 1946, 473, 1260, 1260, 630, 630, 945, 945, 1181,
+    1181, 1734, 1734, 807, 807, 1817, 1817, 1227, 1227, 1382, 1382, 826, 474, 492, 492, 636,
+    636, 753, 753, 1205, 1205, 1686, 1686, 903, 903, 1805, 1805, 1611, 1611, 1379, 1379, 1338,
+    475, 1516, 1516, 638, 638, 1009, 1009, 1213, 1213, 1750, 1750, 935, 935, 1821, 1821, 1739,
+    1739, 1383, 1383, 1850, 477, 1772, 1772, 631, 631, 1969, 1969, 1183, 1183, 1990, 1990, 815,
+    815, 1881, 1881, 1259, 1259, 1398, 1398, 954, 478, 1004, 1004, 637, 637, 1777, 1777, 1207,
+    1207, 1942, 1942, 911, 911, 1869, 1869, 1643, 1643, 1395, 1395, 1466, 479, 2028, 2028, 639,
+    639, 2033, 2033, 1215, 1215, 2006, 2006, 943, 943, 1885, 1885, 1771, 1771, 1399, 1399, 1978,
+    483, 1340, 1340, 730, 730, 485, 485, 1596, 1596, 723, 723, 1445, 1445, 1566, 1566, 963,
+    963, 1325, 1325, 1626, 486, 828, 828, 729, 729, 1253, 1253, 1590, 1590, 915, 915, 1421,
+    1421, 1614, 1614, 867, 867, 1337, 1337, 1242, 487, 1852, 1852, 731, 731, 1509, 1509, 1598,
+    1598, 979, 979, 1453, 1453, 1630, 1630, 995, 995, 1341, 1341, 1754, 491, 1404, 1404, 762,
+    762, 501, 501, 1724, 1724, 727, 727, 1957, 1957, 1567, 1567, 1987, 1987, 1327, 1327, 1882,
+    493, 1660, 1660, 755, 755, 1461, 1461, 1694, 1694, 967, 967, 1837, 1837, 1627, 1627, 1507,
+    1507, 1342, 1342, 986, 494, 892, 892, 761, 761, 1269, 1269, 1718, 1718, 919, 919, 1933,
+    1933, 1615, 1615, 1891, 1891, 1339, 1339, 1498, 495, 1916, 1916, 763, 763, 1525, 1525, 1726,
+    1726, 983, 983, 1965, 1965, 1631, 1631, 2019, 2019, 1343, 1343, 2010, 499, 1468, 1468, 734,
+    734, 997, 997, 1597, 1597, 1747, 1747, 1447, 1447, 1822, 1822, 971, 971, 1389, 1389, 1658,
+    502, 956, 956, 733, 733, 1765, 1765, 1591, 1591, 1939, 1939, 1423, 1423, 1870, 1870, 875,
+    875, 1401, 1401, 1274, 503, 1980, 1980, 735, 735, 2021, 2021, 1599, 1599, 2003, 2003, 1455,
+    1455, 1886, 1886, 1003, 1003, 1405, 1405, 1786, 505, 1276, 1276, 758, 758, 949, 949, 1693,
+    1693, 1735, 1735, 1831, 1831, 1819, 1819, 1483, 1483, 1390, 1390, 890, 506, 508, 508, 764,
+    764, 757, 757, 1717, 1717, 1687, 1687, 1927, 1927, 1807, 1807, 1867, 1867, 1387, 1387, 1402,
+    507, 1532, 1532, 766, 766, 1013, 1013, 1725, 1725, 1751, 1751, 1959, 1959, 1823, 1823, 1995,
+    1995, 1391, 1391, 1914, 509, 1788, 1788, 759, 759, 1973, 1973, 1695, 1695, 1991, 1991, 1839,
+    1839, 1883, 1883, 1515, 1515, 1406, 1406, 1018, 510, 1020, 1020, 765, 765, 1781, 1781, 1719,
+    1719, 1943, 1943, 1935, 1935, 1871, 1871, 1899, 1899, 1403, 1403, 1530, 511, 2044, 2044, 767,
+    767, 2037, 2037, 1727, 1727, 2007, 2007, 1967, 1967, 1887, 1887, 2027, 2027, 1407, 1407, 2042,
+    819, 1433, 1433, 1230, 1230, 870, 870, 825, 825, 1241, 1241, 1254, 1254, 822, 822, 921,
+    921, 1229, 1229, 1638, 823, 1945, 1945, 1231, 1231, 1894, 1894, 827, 827, 1497, 1497, 1262,
+    1262, 886, 886, 953, 953, 1245, 1245, 1766, 829, 1753, 1753, 1255, 1255, 1846, 1846, 923,
+    923, 1485, 1485, 1646, 1646, 883, 883, 1465, 1465, 1246, 1246, 998, 830, 985, 985, 1261,
+    1261, 1654, 1654, 947, 947, 1437, 1437, 1742, 1742, 871, 871, 1849, 1849, 1243, 1243, 1510,
+    831, 2009, 2009, 1263, 1263, 1910, 1910, 955, 955, 1501, 1501, 1774, 1774, 887, 887, 1977,
+    1977, 1247, 1247, 2022, 877, 1657, 1657, 1267, 1267, 1462, 1462, 926, 926, 973, 973, 1645,
+    1645, 1651, 1651, 1459, 1459, 1438, 1438, 974, 878, 889, 889, 1273, 1273, 1270, 1270, 950,
+    950, 925, 925, 1741, 1741, 1639, 1639, 1843, 1843, 1435, 1435, 1486, 879, 1913, 1913, 1275,
+    1275, 1526, 1526, 958, 958, 989, 989, 1773, 1773, 1655, 1655, 1971, 1971, 1439, 1439, 1998,
+    891, 1529, 1529, 1278, 1278, 1014, 1014, 957, 957, 1757, 1757, 1767, 1767, 1847, 1847, 1947,
+    1947, 1487, 1487, 1902, 893, 1785, 1785, 1271, 1271, 1974, 1974, 927, 927, 1997, 1997, 1647,
+    1647, 1907, 1907, 1467, 1467, 1502, 1502, 1006, 894, 1017, 1017, 1277, 1277, 1782, 1782, 951,
+    951, 1949, 1949, 1743, 1743, 1895, 1895, 1851, 1851, 1499, 1499, 1518, 895, 2041, 2041, 1279,
+    1279, 2038, 2038, 959, 959, 2013, 2013, 1775, 1775, 1911, 1911, 1979, 1979, 1503, 1503, 2030,
+    975, 1901, 1901, 1659, 1659, 1523, 1523, 1470, 1470, 990, 990, 1005, 1005, 1661, 1661, 1779,
+    1779, 1463, 1463, 1950, 987, 1517, 1517, 1662, 1662, 1011, 1011, 1469, 1469, 1758, 1758, 999,
+    999, 1853, 1853, 1755, 1755, 1511, 1511, 1854, 991, 2029, 2029, 1663, 1663, 2035, 2035, 1471,
+    1471, 2014, 2014, 1007, 1007, 1917, 1917, 1787, 1787, 1527, 1527, 1982, 1015, 1981, 1981, 1759,
+    1759, 2023, 2023, 1855, 1855, 2011, 2011, 1519, 1519, 1918, 1918, 1019, 1019, 1533, 1533, 1790,
+    1021, 1789, 1789, 1783, 1783, 1975, 1975, 1951, 1951, 1999, 1999, 1903, 1903, 1915, 1915, 1531,
+    1531, 1534, 1534, 1022, 1023, 2045, 2045, 1791, 1791, 2039, 2039, 1983, 1983, 2015, 2015, 2031,
+    2031, 1919, 1919, 2043, 2043, 1535, 1535, 2046,
+};
+
+static const fft_window_t window_4096[2048] = {
+    WIN(-1.3877787807814457e-17), WIN(2.1188236073999e-07), WIN(8.475316046890891e-07), WIN(1.906954216326917e-06),
+    WIN(3.3901610034942076e-06), WIN(5.2971670964768736e-06), WIN(7.62799194861663e-06), WIN(1.038265933533955e-05),
+    WIN(1.3561197354142185e-05), WIN(1.716363842430013e-05), WIN(2.1190019286188022e-05), WIN(2.56403810007938e-05),
+    WIN(3.0514768949413407e-05), WIN(3.581323283255444e-05), WIN(4.1535826669783504e-05), WIN(4.768260879846331e-05),
+    WIN(5.425364187326698e-05), WIN(6.124899286522045e-05), WIN(6.86687330607727e-05), WIN(7.651293806072712e-05),
+    WIN(8.478168777931172e-05), WIN(9.347506644295789e-05), WIN(0.00010259316258909301), WIN(0.0001121360690650719),
+    WIN(0.00012210388302687225), WIN(0.00013249670593742935), WIN(0.00014331464356563683), WIN(0.00015455780598459812),
+    WIN(0.00016622630757021084), WIN(0.0001783202669995293), WIN(0.00019083980724902971), WIN(0.00020378505559309756),
+    WIN(0.00021715614360209856), WIN(0.0002309532071405468), WIN(0.0002451763863652451), WIN(0.0002598258257233421),
+    WIN(0.0002749016739502369), WIN(0.0002904040840677191), WIN(0.00030633321338158215), WIN(0.00032268922347940265),
+    WIN(0.0003394722802286254), WIN(0.0003566825537738849), WIN(0.00037432021853488207), WIN(0.000392385453203678),
+    WIN(0.0004108784407426125), WIN(0.0004297993683812229), WIN(0.000449148427614135), WIN(0.000468925814198079),
+    WIN(0.0004891317281491975), WIN(0.0005097663737403946), WIN(0.0005308299594982274), WIN(0.0005523226982003526),
+    WIN(0.0005742448068721678), WIN(0.0005965965067841472), WIN(0.0006193780234484275), WIN(0.0006425895866158521),
+    WIN(0.0006662314302726957), WIN(0.0006903037926374034), WIN(0.0007148069161573983), WIN(0.0007397410475052935),
+    WIN(0.0007651064375760047), WIN(0.0007909033414827543), WIN(0.0008171320185538233), WIN(0.0008437927323287492),
+    WIN(0.0008708857505546896), WIN(0.0008984113451827869), WIN(0.0009263697923641984), WIN(0.000954761372446225),
+    WIN(0.0009835863699687308), WIN(0.0010128450736596462), WIN(0.0010425377764314153), WIN(0.0010726647753764307),
+    WIN(0.0011032263717632995), WIN(0.0011342228710324587), WIN(0.0011656545827918446), WIN(0.001197521820812661),
+    WIN(0.0012298249030247982), WIN(0.0012625641515127406), WIN(0.0012957398925106944), WIN(0.0013293524563982861),
+    WIN(0.001363402177695705), WIN(0.0013978893950592347), WIN(0.0014328144512764235), WIN(0.0014681776932611856),
+    WIN(0.0015039794720490829), WIN(0.0015402201427924533), WIN(0.0015769000647552073), WIN(0.0016140196013080532),
+    WIN(0.0016515791199232105), WIN(0.0016895789921693438), WIN(0.0017280195937064424), WIN(0.0017669013042803106),
+    WIN(0.0018062245077176131), WIN(0.0018459895919200053), WIN(0.0018861969488591923), WIN(0.001926846974571142),
+    WIN(0.0019679400691506865), WIN(0.0020094766367456246), WIN(0.002051457085551406), WIN(0.002093881827805219),
+    WIN(0.002136751279780358), WIN(0.002180065861780045), WIN(0.0022238259981319786), WIN(0.0022680321171819617),
+    WIN(0.002312684651288227), WIN(0.0023577840368152053), WIN(0.002403330714127308), WIN(0.002449325127583002),
+    WIN(0.002495767725528328), WIN(0.002542658960290753), WIN(0.002589999288172648), WIN(0.0026377891694451816),
+    WIN(0.002686029068341464), WIN(0.00273471945305033), WIN(0.00278386079570965), WIN(0.002833453572399544),
+    WIN(0.0028834982631361222), WIN(0.00293399535186413), WIN(0.002984945326450661), WIN(0.0030363486786780663),
+    WIN(0.0030882059042369736), WIN(0.003140517502719431), WIN(0.0031932839776119964), WIN(0.0032465058362882854),
+    WIN(0.0033001835900021287), WIN(0.0033543177538803703), WIN(0.003408908846915387), WIN(0.003463957391958039),
+    WIN(0.0035194639157102026), WIN(0.0035754289487172075), WIN(0.0036318530253606762), WIN(0.0036887366838506686),
+    WIN(0.003746080466218202), WIN(0.0038038849183078816), WIN(0.0038621505897696723), WIN(0.003920878034051639),
+    WIN(0.003980067808391913), WIN(0.004039720473810793), WIN(0.004099836595102921), WIN(0.0041604167408293286),
+    WIN(0.004221461483309319), WIN(0.004282971398612501), WIN(0.004344947066550503), WIN(0.004407389070668941),
+    WIN(0.004470297998239087), WIN(0.004533674440249588), WIN(0.004597518991398153), WIN(0.0046618322500830145),
+    WIN(0.004726614818394703), WIN(0.004791867302107303), WIN(0.004857590310670054), WIN(0.004923784457198502),
+    WIN(0.00499045035846625), WIN(0.005057588634895666), WIN(0.005125199910549619), WIN(0.0051932848131223674),
+    WIN(0.005261843973930619), WIN(0.005330878027904773), WIN(0.005400387613579943), WIN(0.005470373373086729),
+    WIN(0.005540835952142165), WIN(0.005611776000040661), WIN(0.005683194169644745), WIN(0.0057550911173757935),
+    WIN(0.0058274675032047585), WIN(0.005900323990642775), WIN(0.005973661246731737), WIN(0.006047479942034778),
+    WIN(0.006121780750626957), WIN(0.006196564350085518), WIN(0.006271831421480148), WIN(0.006347582649363609),
+    WIN(0.006423818721761856), WIN(0.006500540330164131), WIN(0.006577748169513356), WIN(0.006655442938196129),
+    WIN(0.0067336253380328726), WIN(0.006812296074267657), WIN(0.006891455855558476), WIN(0.006971105393966837),
+    WIN(0.007051245404947795), WIN(0.00713187660733991), WIN(0.00721299972335461), WIN(0.007294615478566344),
+    WIN(0.007376724601901835), WIN(0.007459327825630038), WIN(0.007542425885351534), WIN(0.007626019519987939),
+    WIN(0.007710109471771656), WIN(0.007794696486235014), WIN(0.007879781312199727), WIN(0.007965364701766148),
+    WIN(0.008051447410302698), WIN(0.0081380301964349), WIN(0.008225113822034641), WIN(0.008312699052209188),
+    WIN(0.008400786655290385), WIN(0.008489377402823448), WIN(0.008578472069556253), WIN(0.008668071433427946),
+    WIN(0.008758176275557986), WIN(0.008848787380234951), WIN(0.008939905534905215), WIN(0.009031531530161716),
+    WIN(0.009123666159732716), WIN(0.009216310220470189), WIN(0.009309464512338841), WIN(0.00940312983840412),
+    WIN(0.00949730700482096), WIN(0.009591996820822318), WIN(0.009687200098707327), WIN(0.009782917653829756),
+    WIN(0.009879150304586387), WIN(0.009975898872404992), WIN(0.01007316418173286), WIN(0.010170947060024638),
+    WIN(0.01026924833773074), WIN(0.01036806884828513), WIN(0.010467409428093502), WIN(0.010567270916521154),
+    WIN(0.010667654155880994), WIN(0.010768559991421275), WIN(0.01086998927131358), WIN(0.010971942846640555),
+    WIN(0.011074421571383462), WIN(0.011177426302410129), WIN(0.011280957899462492), WIN(0.011385017225144144),
+    WIN(0.01148960514490796), WIN(0.011594722527043452), WIN(0.011700370242664418), WIN(0.011806549165696296),
+    WIN(0.01191326017286342), WIN(0.012020504143676676), WIN(0.012128281960420262), WIN(0.012236594508139388),
+    WIN(0.01234544267462722), WIN(0.012454827350412173), WIN(0.012564749428744831), WIN(0.012675209805585286),
+    WIN(0.012786209379589873), WIN(0.012897749052098215), WIN(0.013009829727120392), WIN(0.01312245231132337),
+    WIN(0.013235617714018308), WIN(0.013349326847147076), WIN(0.013463580625269138), WIN(0.013578379965548136),
+    WIN(0.013693725787738677), WIN(0.013809619014172943), WIN(0.013926060569747288), WIN(0.01404305138190872),
+    WIN(0.014160592380641435), WIN(0.014278684498453244), WIN(0.014397328670362051), WIN(0.014516525833882257),
+    WIN(0.014636276929010997), WIN(0.014756582898214396), WIN(0.014877444686414103), WIN(0.014998863240973014),
+    WIN(0.015120839511682), WIN(0.015243374450745542), WIN(0.015366469012768169), WIN(0.015490124154740346),
+    WIN(0.015614340836024393), WIN(0.015739120018340755), WIN(0.015864462665753587), WIN(0.01599036974465684),
+    WIN(0.016116842223760086), WIN(0.01624388107407413), WIN(0.01637148726889713), WIN(0.0164996617838001),
+    WIN(0.01662840559661253), WIN(0.01675771968740821), WIN(0.01688760503849067), WIN(0.017018062634379),
+    WIN(0.01714909346179313), WIN(0.0172806985096393), WIN(0.01741287876899588), WIN(0.017545635233098378),
+    WIN(0.017678968897324954), WIN(0.017812880759181894), WIN(0.01794737181828865), WIN(0.0180824430763634),
+    WIN(0.018218095537208136), WIN(0.018354330206693643), WIN(0.01849114809274509), WIN(0.018628550205326777),
+    WIN(0.01876653755642739), WIN(0.01890511116004502), WIN(0.01904427203217214), WIN(0.01918402119078054),
+    WIN(0.019324359655806263), WIN(0.0194652884491347), WIN(0.019606808594585128), WIN(0.019748921117895786),
+    WIN(0.019891627046708424), WIN(0.020034927410553516), WIN(0.02017882324083424), WIN(0.020323315570811983),
+    WIN(0.02046840543559033), WIN(0.02061409387209997), WIN(0.020760381919083436), WIN(0.020907270617079143),
+    WIN(0.02105476100840644), WIN(0.021202854137149806), WIN(0.0213515510491432), WIN(0.021500852791954773),
+    WIN(0.021650760414870962), WIN(0.021801274968880957), WIN(0.02195239750666097), WIN(0.022104129082558613),
+    WIN(0.022256470752576828), WIN(0.02240942357435856), WIN(0.0225629886071705), WIN(0.022717166911887493),
+    WIN(0.022871959550976532), WIN(0.023027367588480813), WIN(0.023183392090003883), WIN(0.023340034122693566),
+    WIN(0.023497294755225932), WIN(0.02365517505778935), WIN(0.023813676102068276), WIN(0.023972798961227226),
+    WIN(0.024132544709894628), WIN(0.024292914424146467), WIN(0.02445390918149041), WIN(0.02461553006084926),
+    WIN(0.02477777814254485), WIN(0.024940654508281784), WIN(0.02510416024113083), WIN(0.025268296425512905),
+    WIN(0.02543306414718253), WIN(0.025598464493211327), WIN(0.025764498551971764), WIN(0.02593116741312046),
+    WIN(0.026098472167581842), WIN(0.026266413907531594), WIN(0.02643499372638005), WIN(0.02660421271875548),
+    WIN(0.02677407198048775), WIN(0.026944572608591358), WIN(0.027115715701249078), WIN(0.027287502357794917),
+    WIN(0.027459933678697618), WIN(0.02763301076554392), WIN(0.027806734721021478), WIN(0.027981106648902382),
+    WIN(0.02815612765402612), WIN(0.028331798842282804), WIN(0.028508121320596214), WIN(0.02868509619690683),
+    WIN(0.028862724580154937), WIN(0.029041007580263838), WIN(0.029219946308122344), WIN(0.029399541875568327),
+    WIN(0.02957979539537131), WIN(0.029760707981215453), WIN(0.029942280747682543), WIN(0.03012451481023465),
+    WIN(0.030307411285197275), WIN(0.03049097128974195), WIN(0.030675195941869023), WIN(0.030860086360390664),
+    WIN(0.031045643664913206), WIN(0.031231868975820296), WIN(0.031418763414255334), WIN(0.031606328102104224),
+    WIN(0.031794564161977984), WIN(0.03198347271719543), WIN(0.03217305489176576), WIN(0.032363311810371165),
+    WIN(0.0325542445983492), WIN(0.03274585438167569), WIN(0.032938142286946845), WIN(0.033131109441362015),
+    WIN(0.03332475697270604), WIN(0.03351908600933168), WIN(0.03371409768014225), WIN(0.0339097931145737),
+    WIN(0.034106173442577256), WIN(0.03430323979460158), WIN(0.034500993301575335), WIN(0.034699435094889305),
+    WIN(0.03489856630637879), WIN(0.03509838806830586), WIN(0.03529890151334163), WIN(0.0355001077745484),
+    WIN(0.0357020079853621), WIN(0.03590460327957422), WIN(0.03610789479131415), WIN(0.036311883655031345),
+    WIN(0.03651657100547731), WIN(0.036721957977687916), WIN(0.03692804570696537), WIN(0.03713483532886036),
+    WIN(0.03734232797915417), WIN(0.03755052479384043), WIN(0.03775942690910762), WIN(0.037969035461320674),
+    WIN(0.03817935158700321), WIN(0.03839037642281934), WIN(0.03860211110555588), WIN(0.03881455677210386),
+    WIN(0.03902771455944094), WIN(0.03924158560461298), WIN(0.03945617104471602), WIN(0.039671472016878165),
+    WIN(0.03988748965824147), WIN(0.04010422510594382), WIN(0.040321679497100596), WIN(0.04053985396878656),
+    WIN(0.04075874965801774), WIN(0.04097836770173317), WIN(0.04119870923677648), WIN(0.041419775399877984),
+    WIN(0.041641567327635964), WIN(0.04186408615649892), WIN(0.04208733302274674), WIN(0.04231130906247287),
+    WIN(0.04253601541156565), WIN(0.042761453205690025), WIN(0.04298762358026954), WIN(0.04321452767046746),
+    WIN(0.04344216661116867), WIN(0.043670541536961274), WIN(0.04389965358211831), WIN(0.04412950388057903),
+    WIN(0.04436009356593067), WIN(0.044591423771390054), WIN(0.04482349562978498), WIN(0.045056310273535925),
+    WIN(0.04528986883463744), WIN(0.045524172444639736), WIN(0.045759222234630206), WIN(0.04599501933521487),
+    WIN(0.04623156487649968), WIN(0.046468859988072424), WIN(0.046706905798983865), WIN(0.046945703437729136),
+    WIN(0.04718525403222948), WIN(0.047425558709813284), WIN(0.047666618597197924), WIN(0.04790843482047082),
+    WIN(0.048151008505071105), WIN(0.0483943407757708), WIN(0.04863843275665629), WIN(0.048883285571109644),
+    WIN(0.04912890034179025), WIN(0.049375278190615726), WIN(0.049622420238743525), WIN(0.049870327606552384),
+    WIN(0.05011900141362338), WIN(0.05036844277872139), WIN(0.050618652819776594), WIN(0.05086963265386541),
+    WIN(0.051121383397191966), WIN(0.051373906165069635), WIN(0.05162720207190194), WIN(0.051881272231164094),
+    WIN(0.05213611775538405), WIN(0.05239173975612407), WIN(0.05264813934396184), WIN(0.0529053176284716),
+    WIN(0.05316327571820567), WIN(0.053422014720675384), WIN(0.05368153574233269), WIN(0.05394183988855103),
+    WIN(0.054202928263606946), WIN(0.05446480197066089), WIN(0.05472746211173891), WIN(0.054990909787713364),
+    WIN(0.05525514609828464), WIN(0.05552017214196206), WIN(0.055785989016045104), WIN(0.05605259781660481),
+    WIN(0.05631999963846479), WIN(0.056588195575182465), WIN(0.05685718671903037), WIN(0.05712697416097724),
+    WIN(0.057397558990669145), WIN(0.057668942296410966), WIN(0.05794112516514725), WIN(0.058214108682443554),
+    WIN(0.058487893932467776), WIN(0.05876248199797102), WIN(0.059037873960268994), WIN(0.05931407089922315),
+    WIN(0.05959107389322192), WIN(0.059868884019161794), WIN(0.0601475023524286), WIN(0.06042692996687861),
+    WIN(0.06070716793481965), WIN(0.06098821732699263), WIN(0.0612700792125522), WIN(0.061552754659048504),
+    WIN(0.06183624473240784), WIN(0.0621205504969142), WIN(0.06240567301519035), WIN(0.06269161334817898),
+    WIN(0.06297837255512385), WIN(0.06326595169355125), WIN(0.06355435181925082), WIN(0.06384357398625694),
+    WIN(0.06413361924683006), WIN(0.06442448865143757), WIN(0.06471618324873528), WIN(0.06500870408554867),
+    WIN(0.06530205220685373), WIN(0.06559622865575855), WIN(0.06589123447348443), WIN(0.06618707069934693),
+    WIN(0.06648373837073743), WIN(0.06678123852310403), WIN(0.06707957218993288), WIN(0.06737874040272973),
+    WIN(0.06767874419100059), WIN(0.06797958458223345), WIN(0.06828126260187939), WIN(0.06858377927333385),
+    WIN(0.06888713561791775), WIN(0.06919133265485895), WIN(0.06949637140127357), WIN(0.06980225287214697),
+    WIN(0.07010897808031545), WIN(0.07041654803644709), WIN(0.07072496374902348), WIN(0.07103422622432086),
+    WIN(0.07134433646639123), WIN(0.07165529547704412), WIN(0.07196710425582745), WIN(0.07227976380000918),
+    WIN(0.07259327510455871), WIN(0.07290763916212774), WIN(0.07322285696303237), WIN(0.07353892949523388),
+    WIN(0.07385585774432032), WIN(0.07417364269348806), WIN(0.07449228532352278), WIN(0.07481178661278146),
+    WIN(0.07513214753717326), WIN(0.07545336907014118), WIN(0.07577545218264345), WIN(0.07609839784313524),
+    WIN(0.07642220701754963), WIN(0.0767468806692794), WIN(0.07707241975915859), WIN(0.07739882524544371),
+    WIN(0.07772609808379549), WIN(0.07805423922726011), WIN(0.0783832496262512), WIN(0.07871313022853085),
+    WIN(0.07904388197919146), WIN(0.07937550582063727), WIN(0.07970800269256587), WIN(0.08004137353194982),
+    WIN(0.08037561927301823), WIN(0.0807107408472385), WIN(0.08104673918329769), WIN(0.08138361520708436),
+    WIN(0.08172136984167011), WIN(0.08206000400729148), WIN(0.08239951862133119), WIN(0.08273991459830035),
+    WIN(0.08308119284981974), WIN(0.0834233542846018), WIN(0.08376639980843217), WIN(0.0841103303241516),
+    WIN(0.08445514673163769), WIN(0.0848008499277867), WIN(0.08514744080649504), WIN(0.0854949202586417),
+    WIN(0.08584328917206943), WIN(0.08619254843156696), WIN(0.08654269891885083), WIN(0.08689374151254706),
+    WIN(0.08724567708817335), WIN(0.08759850651812084), WIN(0.08795223067163585), WIN(0.08830685041480223),
+    WIN(0.0886623666105229), WIN(0.08901878011850226), WIN(0.0893760917952278), WIN(0.08973430249395234),
+    WIN(0.09009341306467591), WIN(0.09045342435412804), WIN(0.09081433720574965), WIN(0.0911761524596751),
+    WIN(0.09153887095271447), WIN(0.09190249351833545), WIN(0.09226702098664588), WIN(0.09263245418437543),
+    WIN(0.09299879393485819), WIN(0.09336604105801458), WIN(0.09373419637033388), WIN(0.09410326068485618),
+    WIN(0.09447323481115477), WIN(0.09484411955531843), WIN(0.09521591571993393), WIN(0.09558862410406796),
+    WIN(0.0959622455032497), WIN(0.09633678070945331), WIN(0.0967122305110801), WIN(0.09708859569294113),
+    WIN(0.09746587703623957), WIN(0.09784407531855303), WIN(0.0982231913138163), WIN(0.09860322579230368),
+    WIN(0.09898417952061149), WIN(0.09936605326164077), WIN(0.09974884777457982), WIN(0.10013256381488658),
+    WIN(0.10051720213427151), WIN(0.10090276348068006), WIN(0.10128924859827564), WIN(0.10167665822742186),
+    WIN(0.10206499310466557), WIN(0.1024542539627194), WIN(0.10284444153044486), WIN(0.10323555653283473),
+    WIN(0.10362759969099605), WIN(0.10402057172213308), WIN(0.10441447333952991), WIN(0.10480930525253354),
+    WIN(0.1052050681665368), WIN(0.10560176278296117), WIN(0.10599938979923985), WIN(0.10639794990880073),
+    WIN(0.10679744380104941), WIN(0.10719787216135215), WIN(0.10759923567101923), WIN(0.10800153500728767),
+    WIN(0.1084047708433047), WIN(0.10880894384811066), WIN(0.10921405468662232), WIN(0.10962010401961615),
+    WIN(0.11002709250371148), WIN(0.11043502079135359), WIN(0.11084388953079741), WIN(0.11125369936609036),
+    WIN(0.11166445093705633), WIN(0.11207614487927839), WIN(0.11248878182408253), WIN(0.11290236239852126),
+    WIN(0.1133168872253568), WIN(0.11373235692304463), WIN(0.11414877210571713), WIN(0.11456613338316715),
+    WIN(0.11498444136083137), WIN(0.11540369663977422), WIN(0.11582389981667135), WIN(0.11624505148379333),
+    WIN(0.11666715222898938), WIN(0.11709020263567127), WIN(0.11751420328279666), WIN(0.11793915474485345),
+    WIN(0.11836505759184324), WIN(0.11879191238926542), WIN(0.11921971969810072), WIN(0.11964848007479577),
+    WIN(0.12007819407124629), WIN(0.12050886223478179), WIN(0.12094048510814925), WIN(0.12137306322949701),
+    WIN(0.12180659713235936), WIN(0.12224108734564021), WIN(0.12267653439359752), WIN(0.1231129387958274),
+    WIN(0.12355030106724851), WIN(0.12398862171808572), WIN(0.12442790125385539), WIN(0.12486814017534875),
+    WIN(0.12530933897861707), WIN(0.12575149815495534), WIN(0.1261946181908871), WIN(0.12663869956814916),
+    WIN(0.1270837427636753), WIN(0.12752974824958166), WIN(0.1279767164931509), WIN(0.12842464795681688),
+    WIN(0.1288735430981491), WIN(0.12932340236983791), WIN(0.12977422621967863), WIN(0.13022601509055684),
+    WIN(0.13067876942043266), WIN(0.13113248964232593), WIN(0.13158717618430116), WIN(0.13204282946945176),
+    WIN(0.13249944991588605), WIN(0.13295703793671124), WIN(0.13341559394001917), WIN(0.13387511832887064),
+    WIN(0.13433561150128137), WIN(0.13479707385020628), WIN(0.1352595057635254), WIN(0.13572290762402842),
+    WIN(0.13618727980940026), WIN(0.13665262269220663), WIN(0.13711893663987854), WIN(0.1375862220146986),
+    WIN(0.13805447917378563), WIN(0.13852370846908085), WIN(0.13899391024733243), WIN(0.1394650848500819),
+    WIN(0.13993723261364927), WIN(0.1404103538691186), WIN(0.14088444894232371), WIN(0.14135951815383385),
+    WIN(0.1418355618189397), WIN(0.1423125802476383), WIN(0.14279057374461998), WIN(0.14326954260925326),
+    WIN(0.1437494871355714), WIN(0.14423040761225744), WIN(0.14471230432263138), WIN(0.14519517754463535),
+    WIN(0.1456790275508194), WIN(0.1461638546083287), WIN(0.14664965897888846), WIN(0.14713644091879102),
+    WIN(0.1476242006788813), WIN(0.14811293850454374), WIN(0.14860265463568811), WIN(0.14909334930673634),
+    WIN(0.14958502274660798), WIN(0.1500776751787078), WIN(0.1505713068209117), WIN(0.15106591788555268),
+    WIN(0.1515615085794086), WIN(0.15205807910368763), WIN(0.15255562965401587), WIN(0.15305416042042286),
+    WIN(0.15355367158732974), WIN(0.15405416333353475), WIN(0.1545556358322011), WIN(0.1550580892508427),
+    WIN(0.15556152375131221), WIN(0.1560659394897875), WIN(0.1565713366167581), WIN(0.15707771527701342),
+    WIN(0.15758507560962876), WIN(0.1580934177479533), WIN(0.15860274181959633), WIN(0.1591130479464155),
+    WIN(0.15962433624450337), WIN(0.1601366068241752), WIN(0.16064985978995566), WIN(0.16116409524056713),
+    WIN(0.1616793132689166), WIN(0.16219551396208298), WIN(0.16271269740130534), WIN(0.1632308636619698),
+    WIN(0.1637500128135979), WIN(0.16427014491983336), WIN(0.16479126003843084), WIN(0.16531335822124288),
+    WIN(0.16583643951420848), WIN(0.1663605039573401), WIN(0.1668855515847125), WIN(0.16741158242445037),
+    WIN(0.1679385964987158), WIN(0.16846659382369739), WIN(0.16899557440959756), WIN(0.16952553826062128),
+    WIN(0.17005648537496354), WIN(0.1705884157447986), WIN(0.17112132935626753), WIN(0.1716552261894671),
+    WIN(0.17219010621843772), WIN(0.17272596941115223), WIN(0.17326281572950458), WIN(0.1738006451292977),
+    WIN(0.17433945756023303), WIN(0.1748792529658984), WIN(0.17542003128375755), WIN(0.17596179244513777),
+    WIN(0.17650453637521996), WIN(0.17704826299302662), WIN(0.17759297221141135), WIN(0.17813866393704725),
+    WIN(0.17868533807041628), WIN(0.17923299450579872), WIN(0.17978163313126114), WIN(0.18033125382864695),
+    WIN(0.18088185647356464), WIN(0.18143344093537767), WIN(0.1819860070771931), WIN(0.18253955475585185),
+    WIN(0.18309408382191744), WIN(0.18364959411966592), WIN(0.184206085487075), WIN(0.18476355775581396),
+    WIN(0.1853220107512334), WIN(0.18588144429235415), WIN(0.1864418581918583), WIN(0.18700325225607778),
+    WIN(0.18756562628498522), WIN(0.18812898007218276), WIN(0.18869331340489315), WIN(0.18925862606394897),
+    WIN(0.1898249178237832), WIN(0.19039218845241884), WIN(0.19096043771145949), WIN(0.19152966535607968),
+    WIN(0.1920998711350144), WIN(0.19267105479055036), WIN(0.19324321605851594), WIN(0.19381635466827174),
+    WIN(0.19439047034270054), WIN(0.19496556279819915), WIN(0.19554163174466738), WIN(0.19611867688550022),
+    WIN(0.19669669791757743), WIN(0.19727569453125482), WIN(0.19785566641035537), WIN(0.19843661323215914),
+    WIN(0.19901853466739544), WIN(0.19960143038023276), WIN(0.20018530002827084), WIN(0.20077014326253045),
+    WIN(0.20135595972744602), WIN(0.20194274906085574), WIN(0.20253051089399357), WIN(0.20311924485148),
+    WIN(0.20370895055131372), WIN(0.20429962760486334), WIN(0.20489127561685813), WIN(0.2054838941853805),
+    WIN(0.20607748290185668), WIN(0.2066720413510496), WIN(0.20726756911104888), WIN(0.2078640657532645),
+    WIN(0.20846153084241742), WIN(0.2090599639365316), WIN(0.20965936458692666), WIN(0.210259732338209),
+    WIN(0.21086106672826466), WIN(0.21146336728825052), WIN(0.2120666335425876), WIN(0.2126708650089525),
+    WIN(0.21327606119827014), WIN(0.21388222161470544), WIN(0.2144893457556568), WIN(0.21509743311174784),
+    WIN(0.21570648316681978), WIN(0.21631649539792497), WIN(0.21692746927531822), WIN(0.21753940426245105),
+    WIN(0.21815229981596265), WIN(0.21876615538567457), WIN(0.2193809704145822), WIN(0.2199967443388488),
+    WIN(0.22061347658779706), WIN(0.22123116658390396), WIN(0.22184981374279272), WIN(0.22246941747322585),
+    WIN(0.22308997717709939), WIN(0.22371149224943532), WIN(0.22433396207837542), WIN(0.22495738604517412),
+    WIN(0.22558176352419282), WIN(0.22620709388289273), WIN(0.22683337648182905), WIN(0.22746061067464377),
+    WIN(0.22808879580806027), WIN(0.22871793122187706), WIN(0.22934801624896056), WIN(0.22997905021524057),
+    WIN(0.23061103243970282), WIN(0.23124396223438434), WIN(0.23187783890436597), WIN(0.23251266174776802),
+    WIN(0.2331484300557435), WIN(0.23378514311247306), WIN(0.2344228001951584), WIN(0.23506140057401773),
+    WIN(0.2357009435122798), WIN(0.2363414282661777), WIN(0.23698285408494496), WIN(0.23762522021080845),
+    WIN(0.2382685258789849), WIN(0.2389127703176736), WIN(0.23955795274805328), WIN(0.24020407238427544),
+    WIN(0.2408511284334604), WIN(0.24149912009569113), WIN(0.24214804656400968), WIN(0.2427979070244114),
+    WIN(0.24344870065584), WIN(0.24410042663018383), WIN(0.2447530841122699), WIN(0.24540667225986054),
+    WIN(0.24606119022364759), WIN(0.24671663714724895), WIN(0.24737301216720348), WIN(0.24803031441296725),
+    WIN(0.24868854300690835), WIN(0.24934769706430354), WIN(0.2500077756933337), WIN(0.25066877799507936),
+    WIN(0.25133070306351746), WIN(0.25199354998551643), WIN(0.2526573178408334), WIN(0.2533220057021088),
+    WIN(0.25398761263486413), WIN(0.25465413769749706), WIN(0.2553215799412788), WIN(0.25598993841034934),
+    WIN(0.2566592121417146), WIN(0.2573294001652432), WIN(0.2580005015036621), WIN(0.2586725151725543),
+    WIN(0.25934544018035466), WIN(0.2600192755283476), WIN(0.2606940202106627), WIN(0.261369673214273),
+    WIN(0.2620462335189908), WIN(0.2627237000974656), WIN(0.2634020719151804), WIN(0.26408134793044924),
+    WIN(0.26476152709441486), WIN(0.26544260835104466), WIN(0.2661245906371299), WIN(0.2668074728822814),
+    WIN(0.2674912540089284), WIN(0.2681759329323148), WIN(0.2688615085604978), WIN(0.2695479797943452),
+    WIN(0.2702353455275332), WIN(0.27092360464654397), WIN(0.27161275603066376), WIN(0.272302798551981),
+    WIN(0.2729937310753835), WIN(0.27368555245855775), WIN(0.27437826155198597), WIN(0.2750718571989451),
+    WIN(0.2757663382355039), WIN(0.27646170349052307), WIN(0.2771579517856518), WIN(0.2778550819353276),
+    WIN(0.27855309274677387), WIN(0.279251983019999), WIN(0.27995175154779517), WIN(0.2806523971157362),
+    WIN(0.2813539185021776), WIN(0.2820563144782542), WIN(0.28275958380788013), WIN(0.28346372524774666),
+    WIN(0.28416873754732225), WIN(0.28487461944885145), WIN(0.28558136968735337), WIN(0.2862889869906219),
+    WIN(0.28699747007922405), WIN(0.28770681766650075), WIN(0.2884170284585641), WIN(0.2891281011542993),
+    WIN(0.28984003444536244), WIN(0.2905528270161811), WIN(0.2912664775439532), WIN(0.29198098469864786),
+    WIN(0.29269634714300435), WIN(0.29341256353253253), WIN(0.2941296325155123), WIN(0.2948475527329939),
+    WIN(0.2955663228187986), WIN(0.29628594139951736), WIN(0.2970064070945129), WIN(0.2977277185159185),
+    WIN(0.29844987426863945), WIN(0.2991728729503522), WIN(0.2998967131515065), WIN(0.3006213934553249),
+    WIN(0.3013469124378031), WIN(0.30207326866771167), WIN(0.30280046070659594), WIN(0.30352848710877767),
+    WIN(0.30425734642135455), WIN(0.304987037184203), WIN(0.30571755792997773), WIN(0.30644890718411355),
+    WIN(0.3071810834648261), WIN(0.30791408528311354), WIN(0.3086479111427578), WIN(0.3093825595403252),
+    WIN(0.31011802896516893), WIN(0.3108543178994299), WIN(0.31159142481803864), WIN(0.3123293481887162),
+    WIN(0.31306808647197715), WIN(0.3138076381211299), WIN(0.3145480015822799), WIN(0.3152891752943301),
+    WIN(0.31603115768898415), WIN(0.31677394719074814), WIN(0.31751754221693174), WIN(0.31826194117765183),
+    WIN(0.3190071424758336), WIN(0.3197531445072138), WIN(0.3204999456603418), WIN(0.3212475443165833),
+    WIN(0.32199593885012223), WIN(0.32274512762796365), WIN(0.3234951090099353), WIN(0.324245881348692),
+    WIN(0.32499744298971744), WIN(0.3257497922713264), WIN(0.32650292752466936), WIN(0.3272568470737336),
+    WIN(0.32801154923534775), WIN(0.3287670323191837), WIN(0.32952329462776075), WIN(0.330280334456448),
+    WIN(0.3310381500934685), WIN(0.3317967398199019), WIN(0.33255610190968776), WIN(0.33331623462963045),
+    WIN(0.3340771362394005), WIN(0.3348388049915403), WIN(0.3356012391314665), WIN(0.33636443689747464),
+    WIN(0.3371283965207419), WIN(0.33789311622533225), WIN(0.33865859422819955), WIN(0.339424828739192),
+    WIN(0.34019181796105596), WIN(0.3409595600894402), WIN(0.3417280533129007), WIN(0.34249729581290356),
+    WIN(0.34326728576383103), WIN(0.3440380213329849), WIN(0.34480950068059146), WIN(0.3455817219598053),
+    WIN(0.3463546833167153), WIN(0.3471283828903479), WIN(0.34790281881267326), WIN(0.3486779892086086),
+    WIN(0.3494538921960242), WIN(0.3502305258857484), WIN(0.3510078883815715), WIN(0.35178597778025245),
+    WIN(0.35256479217152253), WIN(0.353344329638092), WIN(0.35412458825565374), WIN(0.3549055660928904),
+    WIN(0.3556872612114785), WIN(0.3564696716660947), WIN(0.3572527955044208), WIN(0.35803663076714975),
+    WIN(0.3588211754879917), WIN(0.35960642769367834), WIN(0.3603923854039707), WIN(0.3611790466316636),
+    WIN(0.3619664093825925), WIN(0.36275447165563834), WIN(0.36354323144273515), WIN(0.36433268672887514),
+    WIN(0.3651228354921156), WIN(0.36591367570358463), WIN(0.36670520532748757), WIN(0.3674974223211142),
+    WIN(0.36829032463484396), WIN(0.36908391021215387), WIN(0.3698781769896239), WIN(0.370673122896945),
+    WIN(0.3714687458569241), WIN(0.37226504378549297), WIN(0.3730620145917134), WIN(0.37385965617778544),
+    WIN(0.37465796643905336), WIN(0.3754569432640133), WIN(0.37625658453432087), WIN(0.37705688812479704),
+    WIN(0.3778578519034369), WIN(0.37865947373141606), WIN(0.37946175146309863), WIN(0.380264682946044),
+    WIN(0.38106826602101507), WIN(0.38187249852198596), WIN(0.3826773782761489), WIN(0.3834829031039225),
+    WIN(0.3842890708189597), WIN(0.38509587922815547), WIN(0.38590332613165435), WIN(0.3867114093228592),
+    WIN(0.3875201265884389), WIN(0.38832947570833654), WIN(0.389139454455777), WIN(0.38995006059727666),
+    WIN(0.3907612918926506), WIN(0.3915731460950207), WIN(0.3923856209508256), WIN(0.39319871419982744),
+    WIN(0.3940124235751223), WIN(0.3948267468031467), WIN(0.39564168160368857), WIN(0.3964572256898942),
+    WIN(0.3972733767682786), WIN(0.3980901325387328), WIN(0.3989074906945344), WIN(0.3997254489223559),
+    WIN(0.4005440049022732), WIN(0.4013631563077762), WIN(0.4021829008057767), WIN(0.40300323605661864),
+    WIN(0.40382415971408664), WIN(0.4046456694254163), WIN(0.405467762831303), WIN(0.406290437565912),
+    WIN(0.40711369125688723), WIN(0.4079375215253621), WIN(0.4087619259859688), WIN(0.409586902246847),
+    WIN(0.410412447909656), WIN(0.4112385605695824), WIN(0.412065237815352), WIN(0.4128924772292379),
+    WIN(0.4137202763870727), WIN(0.41454863285825716), WIN(0.4153775442057712), WIN(0.4162070079861838),
+    WIN(0.41703702174966384), WIN(0.4178675830399906), WIN(0.418698689394563), WIN(0.41953033834441217),
+    WIN(0.4203625274142105), WIN(0.4211952541222835), WIN(0.42202851598061913), WIN(0.42286231049488027),
+    WIN(0.4236966351644142), WIN(0.42453148748226494), WIN(0.4253668649351825), WIN(0.42620276500363563),
+    WIN(0.4270391851618223), WIN(0.42787612287768034), WIN(0.42871357561289974), WIN(0.42955154082293323),
+    WIN(0.4303900159570083), WIN(0.43122899845813734), WIN(0.43206848576313106), WIN(0.43290847530260845),
+    WIN(0.4337489645010093), WIN(0.4345899507766056), WIN(0.43543143154151315), WIN(0.43627340420170396),
+    WIN(0.4371158661570169), WIN(0.43795881480117144), WIN(0.4388022475217779), WIN(0.4396461617003511),
+    WIN(0.4404905547123205), WIN(0.4413354239270446), WIN(0.4421807667078216), WIN(0.44302658041190257),
+    WIN(0.4438728623905033), WIN(0.44471960998881654), WIN(0.4455668205460259), WIN(0.44641449139531625),
+    WIN(0.44726261986388804), WIN(0.44811120327296927), WIN(0.44896023893782844), WIN(0.44980972416778686),
+    WIN(0.4506596562662324), WIN(0.45151003253063116), WIN(0.4523608502525419), WIN(0.4532121067176278),
+    WIN(0.4540637992056701), WIN(0.45491592499058175), WIN(0.4557684813404189), WIN(0.4566214655173969),
+    WIN(0.45747487477790066), WIN(0.45832870637250045), WIN(0.45918295754596355), WIN(0.46003762553726923),
+    WIN(0.4608927075796211), WIN(0.4617482009004616), WIN(0.4626041027214851), WIN(0.4634604102586519),
+    WIN(0.4643171207222024), WIN(0.46517423131666963), WIN(0.46603173924089525), WIN(0.46688964168804126),
+    WIN(0.4677479358456061), WIN(0.4686066188954368), WIN(0.4694656880137451), WIN(0.47032514037111955),
+    WIN(0.47118497313254204), WIN(0.4720451834573998), WIN(0.4729057684995016), WIN(0.47376672540709164),
+    WIN(0.474628051322863), WIN(0.47548974338397415), WIN(0.4763517987220617), WIN(0.47721421446325635),
+    WIN(0.4780769877281965), WIN(0.47894011563204436), WIN(0.47980359528449973), WIN(0.4806674237898151),
+    WIN(0.4815315982468107), WIN(0.4823961157488894), WIN(0.48326097338405244), WIN(0.48412616823491306),
+    WIN(0.48499169737871356), WIN(0.48585755788733853), WIN(0.4867237468273322), WIN(0.48759026125991145),
+    WIN(0.48845709824098354), WIN(0.4893242548211602), WIN(0.49019172804577305), WIN(0.49105951495488986),
+    WIN(0.4919276125833294), WIN(0.4927960179606783), WIN(0.49366472811130485), WIN(0.494533740054377),
+    WIN(0.49540305080387637), WIN(0.49627265736861537), WIN(0.49714255675225205), WIN(0.4980127459533072),
+    WIN(0.49888322196517965), WIN(0.49975398177616237), WIN(0.5006250223694594), WIN(0.5014963407232007),
+    WIN(0.5023679338104601), WIN(0.5032397985992697), WIN(0.5041119320526383), WIN(0.504984331128566),
+    WIN(0.5058569927800619), WIN(0.5067299139551598), WIN(0.5076030915969355), WIN(0.508476522643523),
+    WIN(0.5093502040281308), WIN(0.5102241326790602), WIN(0.5110983055197194), WIN(0.5119727194686436),
+    WIN(0.5128473714395088), WIN(0.5137222583411514), WIN(0.5145973770775827), WIN(0.5154727245480084),
+    WIN(0.5163482976468436), WIN(0.5172240932637316), WIN(0.5181001082835599), WIN(0.5189763395864777),
+    WIN(0.519852784047914), WIN(0.520729438538594), WIN(0.5216062999245572), WIN(0.5224833650671739),
+    WIN(0.523360630823164), WIN(0.5242380940446132), WIN(0.5251157515789926), WIN(0.5259936002691732),
+    WIN(0.5268716369534469), WIN(0.5277498584655425), WIN(0.5286282616346433), WIN(0.5295068432854059),
+    WIN(0.5303856002379777), WIN(0.5312645293080149), WIN(0.5321436273066998), WIN(0.5330228910407604),
+    WIN(0.5339023173124869), WIN(0.5347819029197508), WIN(0.535661644656023), WIN(0.5365415393103912),
+    WIN(0.5374215836675797), WIN(0.5383017745079663), WIN(0.5391821086076016), WIN(0.540062582738227),
+    WIN(0.5409431936672935), WIN(0.5418239381579796), WIN(0.5427048129692107), WIN(0.5435858148556773),
+    WIN(0.5444669405678536), WIN(0.5453481868520167), WIN(0.5462295504502642), WIN(0.5471110281005349),
+    WIN(0.5479926165366253), WIN(0.5488743124882111), WIN(0.5497561126808638), WIN(0.5506380138360715),
+    WIN(0.5515200126712563), WIN(0.5524021058997952), WIN(0.5532842902310375), WIN(0.5541665623703255),
+    WIN(0.5550489190190123), WIN(0.5559313568744821), WIN(0.5568138726301695), WIN(0.5576964629755776),
+    WIN(0.5585791245962994), WIN(0.5594618541740355), WIN(0.5603446483866147), WIN(0.5612275039080126),
+    WIN(0.5621104174083722), WIN(0.5629933855540228), WIN(0.5638764050075), WIN(0.5647594724275652),
+    WIN(0.5656425844692251), WIN(0.5665257377837529), WIN(0.5674089290187057), WIN(0.5682921548179468),
+    WIN(0.5691754118216643), WIN(0.5700586966663914), WIN(0.570942005985026), WIN(0.5718253364068516),
+    WIN(0.572708684557557), WIN(0.5735920470592558), WIN(0.5744754205305075), WIN(0.5753588015863372),
+    WIN(0.5762421868382566), WIN(0.5771255728942831), WIN(0.5780089563589607), WIN(0.5788923338333803),
+    WIN(0.5797757019152014), WIN(0.5806590571986703), WIN(0.5815423962746423), WIN(0.5824257157306013),
+    WIN(0.5833090121506809), WIN(0.5841922821156852), WIN(0.5850755222031093), WIN(0.5859587289871586),
+    WIN(0.5868418990387725), WIN(0.5877250289256425), WIN(0.5886081152122342), WIN(0.5894911544598082),
+    WIN(0.5903741432264401), WIN(0.5912570780670436), WIN(0.5921399555333884), WIN(0.5930227721741237),
+    WIN(0.593905524534798), WIN(0.5947882091578807), WIN(0.595670822582783), WIN(0.5965533613458799),
+    WIN(0.5974358219805291), WIN(0.5983182010170949), WIN(0.5992004949829688), WIN(0.6000827004025892),
+    WIN(0.6009648137974646), WIN(0.6018468316861944), WIN(0.6027287505844898), WIN(0.6036105670051964),
+    WIN(0.6044922774583148), WIN(0.6053738784510213), WIN(0.6062553664876922), WIN(0.6071367380699227),
+    WIN(0.6080179896965496), WIN(0.6088991178636732), WIN(0.6097801190646783), WIN(0.6106609897902572),
+    WIN(0.61154172652843), WIN(0.6124223257645668), WIN(0.6133027839814107), WIN(0.6141830976590981),
+    WIN(0.6150632632751811), WIN(0.6159432773046511), WIN(0.6168231362199573), WIN(0.6177028364910319),
+    WIN(0.6185823745853111), WIN(0.6194617469677564), WIN(0.6203409501008785), WIN(0.6212199804447568),
+    WIN(0.6220988344570642), WIN(0.622977508593088), WIN(0.6238559993057524), WIN(0.62473430304564),
+    WIN(0.6256124162610163), WIN(0.6264903353978489), WIN(0.6273680568998329), WIN(0.6282455772084111),
+    WIN(0.6291228927627975), WIN(0.6299999999999999), WIN(0.6308768953548414), WIN(0.6317535752599841),
+    WIN(0.6326300361459507), WIN(0.6335062744411475), WIN(0.6343822865718871), WIN(0.6352580689624112),
+    WIN(0.6361336180349123), WIN(0.6370089302095575), WIN(0.6378840019045112), WIN(0.6387588295359566),
+    WIN(0.6396334095181206), WIN(0.6405077382632939), WIN(0.6413818121818561), WIN(0.642255627682298),
+    WIN(0.6431291811712445), WIN(0.6440024690534756), WIN(0.6448754877319532), WIN(0.6457482336078411),
+    WIN(0.6466207030805284), WIN(0.6474928925476537), WIN(0.6483647984051268), WIN(0.6492364170471534),
+    WIN(0.6501077448662563), WIN(0.6509787782532999), WIN(0.651849513597513), WIN(0.6527199472865116),
+    WIN(0.6535900757063228), WIN(0.6544598952414085), WIN(0.655329402274686), WIN(0.6561985931875542),
+    WIN(0.6570674643599168), WIN(0.6579360121702031), WIN(0.6588042329953948), WIN(0.6596721232110455),
+    WIN(0.6605396791913077), WIN(0.6614068973089545), WIN(0.6622737739354033), WIN(0.6631403054407385),
+    WIN(0.6640064881937373), WIN(0.6648723185618906), WIN(0.6657377929114278), WIN(0.6666029076073414),
+    WIN(0.6674676590134075), WIN(0.6683320434922135), WIN(0.6691960574051783), WIN(0.6700596971125775),
+    WIN(0.6709229589735676), WIN(0.6717858393462082), WIN(0.6726483345874867), WIN(0.6735104410533431),
+    WIN(0.6743721550986906), WIN(0.6752334730774423), WIN(0.6760943913425347), WIN(0.6769549062459502),
+    WIN(0.6778150141387418), WIN(0.6786747113710568), WIN(0.679533994292161), WIN(0.680392859250462),
+    WIN(0.6812513025935343), WIN(0.6821093206681408), WIN(0.6829669098202604), WIN(0.6838240663951086),
+    WIN(0.6846807867371635), WIN(0.6855370671901896), WIN(0.6863929040972603), WIN(0.687248293800784),
+    WIN(0.6881032326425277), WIN(0.6889577169636397), WIN(0.689811743104676), WIN(0.6906653074056217),
+    WIN(0.6915184062059176), WIN(0.6923710358444839), WIN(0.6932231926597423), WIN(0.6940748729896429),
+    WIN(0.6949260731716872), WIN(0.6957767895429522), WIN(0.6966270184401149), WIN(0.6974767561994767),
+    WIN(0.6983259991569868), WIN(0.6991747436482685), WIN(0.7000229860086413), WIN(0.7008707225731458),
+    WIN(0.7017179496765693), WIN(0.7025646636534686), WIN(0.7034108608381949), WIN(0.7042565375649193),
+    WIN(0.7051016901676543), WIN(0.7059463149802814), WIN(0.7067904083365741), WIN(0.707633966570222),
+    WIN(0.7084769860148558), WIN(0.7093194630040712), WIN(0.7101613938714543), WIN(0.7110027749506059),
+    WIN(0.7118436025751645), WIN(0.7126838730788325), WIN(0.7135235827954005), WIN(0.7143627280587712),
+    WIN(0.715201305202984), WIN(0.71603931056224), WIN(0.7168767404709263), WIN(0.7177135912636408),
+    WIN(0.7185498592752164), WIN(0.7193855408407452), WIN(0.720220632295605), WIN(0.7210551299754814),
+    WIN(0.7218890302163937), WIN(0.7227223293547207), WIN(0.7235550237272222), WIN(0.7243871096710668),
+    WIN(0.7252185835238548), WIN(0.7260494416236436), WIN(0.7268796803089718), WIN(0.7277092959188844),
+    WIN(0.7285382847929569), WIN(0.7293666432713212), WIN(0.7301943676946889), WIN(0.731021454404376),
+    WIN(0.7318478997423293), WIN(0.7326737000511496), WIN(0.7334988516741167), WIN(0.7343233509552141),
+    WIN(0.7351471942391543), WIN(0.7359703778714035), WIN(0.7367928981982057), WIN(0.7376147515666067),
+    WIN(0.738435934324482), WIN(0.739256442820558), WIN(0.7400762734044387), WIN(0.740895422426631),
+    WIN(0.7417138862385667), WIN(0.7425316611926304), WIN(0.7433487436421832), WIN(0.7441651299415867),
+    WIN(0.7449808164462287), WIN(0.7457957995125478), WIN(0.7466100754980579), WIN(0.7474236407613738),
+    WIN(0.7482364916622352), WIN(0.7490486245615307), WIN(0.7498600358213254), WIN(0.7506707218048834),
+    WIN(0.7514806788766928), WIN(0.7522899034024912), WIN(0.7530983917492902), WIN(0.7539061402854009),
+    WIN(0.7547131453804576), WIN(0.7555194034054427), WIN(0.7563249107327129), WIN(0.7571296637360225),
+    WIN(0.7579336587905492), WIN(0.7587368922729183), WIN(0.7595393605612278), WIN(0.7603410600350732),
+    WIN(0.7611419870755726), WIN(0.7619421380653911), WIN(0.7627415093887655), WIN(0.7635400974315302),
+    WIN(0.7643378985811399), WIN(0.7651349092266974), WIN(0.7659311257589757), WIN(0.7667265445704438),
+    WIN(0.767521162055292), WIN(0.7683149746094565), WIN(0.7691079786306437), WIN(0.769900170518355),
+    WIN(0.7706915466739125), WIN(0.7714821035004833), WIN(0.7722718374031037), WIN(0.7730607447887046),
+    WIN(0.7738488220661365), WIN(0.7746360656461936), WIN(0.775422471941639), WIN(0.7762080373672304),
+    WIN(0.7769927583397421), WIN(0.7777766312779929), WIN(0.7785596526028692), WIN(0.7793418187373498),
+    WIN(0.7801231261065313), WIN(0.7809035711376523), WIN(0.7816831502601178), WIN(0.7824618599055255),
+    WIN(0.7832396965076888), WIN(0.7840166565026612), WIN(0.7847927363287638), WIN(0.785567932426607),
+    WIN(0.7863422412391168), WIN(0.7871156592115586), WIN(0.7878881827915624), WIN(0.7886598084291482),
+    WIN(0.7894305325767486), WIN(0.7902003516892354), WIN(0.7909692622239438), WIN(0.7917372606406959),
+    WIN(0.792504343401827), WIN(0.7932705069722091), WIN(0.7940357478192759), WIN(0.7948000624130468),
+    WIN(0.7955634472261529), WIN(0.7963258987338603), WIN(0.7970874134140947), WIN(0.797847987747467),
+    WIN(0.7986076182172961), WIN(0.7993663013096359), WIN(0.8001240335132974), WIN(0.8008808113198741),
+    WIN(0.8016366312237674), WIN(0.8023914897222096), WIN(0.8031453833152896), WIN(0.8038983085059764),
+    WIN(0.8046502618001442), WIN(0.8054012397065968), WIN(0.8061512387370917), WIN(0.8069002554063645),
+    WIN(0.8076482862321536), WIN(0.8083953277352245), WIN(0.809141376439394), WIN(0.8098864288715554),
+    WIN(0.8106304815617008), WIN(0.8113735310429474), WIN(0.8121155738515616), WIN(0.8128566065269824),
+    WIN(0.8135966256118462), WIN(0.8143356276520108), WIN(0.8150736091965802), WIN(0.8158105667979288),
+    WIN(0.8165464970117249), WIN(0.8172813963969545), WIN(0.8180152615159483), WIN(0.8187480889344021),
+    WIN(0.819479875221404), WIN(0.8202106169494563), WIN(0.8209403106945009), WIN(0.8216689530359439),
+    WIN(0.822396540556678), WIN(0.8231230698431078), WIN(0.8238485374851734), WIN(0.8245729400763748),
+    WIN(0.8252962742137954), WIN(0.8260185364981267), WIN(0.8267397235336912), WIN(0.8274598319284673),
+    WIN(0.8281788582941135), WIN(0.8288967992459909), WIN(0.8296136514031889), WIN(0.830329411388547),
+    WIN(0.8310440758286805), WIN(0.831757641354004), WIN(0.8324701045987544), WIN(0.8331814622010145),
+    WIN(0.8338917108027392), WIN(0.8346008470497761), WIN(0.8353088675918907), WIN(0.8360157690827908),
+    WIN(0.8367215481801489), WIN(0.8374262015456265), WIN(0.8381297258448982), WIN(0.8388321177476737),
+    WIN(0.8395333739277238), WIN(0.8402334910629017), WIN(0.8409324658351676), WIN(0.8416302949306133),
+    WIN(0.8423269750394831), WIN(0.8430225028561992), WIN(0.8437168750793859), WIN(0.8444100884118902),
+    WIN(0.8451021395608085), WIN(0.845793025237507), WIN(0.8464827421576471), WIN(0.8471712870412083),
+    WIN(0.8478586566125114), WIN(0.8485448476002405), WIN(0.8492298567374694), WIN(0.8499136807616816),
+    WIN(0.8505963164147954), WIN(0.851277760443186), WIN(0.85195800959771), WIN(0.8526370606337271),
+    WIN(0.8533149103111244), WIN(0.8539915553943385), WIN(0.8546669926523792), WIN(0.8553412188588521),
+    WIN(0.8560142307919819), WIN(0.8566860252346364), WIN(0.8573565989743466), WIN(0.8580259488033323),
+    WIN(0.8586940715185242), WIN(0.8593609639215862), WIN(0.8600266228189398), WIN(0.8606910450217838),
+    WIN(0.8613542273461208), WIN(0.8620161666127774), WIN(0.8626768596474284), WIN(0.8633363032806177),
+    WIN(0.8639944943477833), WIN(0.8646514296892781), WIN(0.865307106150393), WIN(0.8659615205813802),
+    WIN(0.8666146698374745), WIN(0.8672665507789166), WIN(0.8679171602709759), WIN(0.8685664951839716),
+    WIN(0.8692145523932968), WIN(0.8698613287794396), WIN(0.8705068212280059), WIN(0.8711510266297426),
+    WIN(0.8717939418805576), WIN(0.8724355638815442), WIN(0.8730758895390033), WIN(0.8737149157644637),
+    WIN(0.8743526394747062), WIN(0.8749890575917848), WIN(0.8756241670430489), WIN(0.8762579647611656),
+    WIN(0.8768904476841417), WIN(0.877521612755345), WIN(0.8781514569235275), WIN(0.8787799771428462),
+    WIN(0.8794071703728854), WIN(0.8800330335786793), WIN(0.880657563730732), WIN(0.8812807578050411),
+    WIN(0.8819026127831189), WIN(0.8825231256520133), WIN(0.8831422934043307), WIN(0.8837601130382571),
+    WIN(0.884376581557579), WIN(0.8849916959717068), WIN(0.885605453295694), WIN(0.8862178505502605),
+    WIN(0.8868288847618137), WIN(0.8874385529624693), WIN(0.8880468521900734), WIN(0.8886537794882229),
+    WIN(0.889259331906288), WIN(0.8898635064994329), WIN(0.8904663003286374), WIN(0.8910677104607163),
+    WIN(0.8916677339683439), WIN(0.892266367930072), WIN(0.8928636094303525), WIN(0.8934594555595589),
+    WIN(0.8940539034140055), WIN(0.89464695009597), WIN(0.8952385927137141), WIN(0.8958288283815038),
+    WIN(0.8964176542196309), WIN(0.8970050673544334), WIN(0.8975910649183164), WIN(0.8981756440497731),
+    WIN(0.8987588018934053), WIN(0.8993405355999431), WIN(0.8999208423262676), WIN(0.9004997192354294),
+    WIN(0.9010771634966709), WIN(0.901653172285445), WIN(0.9022277427834368), WIN(0.9028008721785836),
+    WIN(0.903372557665096), WIN(0.9039427964434761), WIN(0.9045115857205405), WIN(0.9050789227094388),
+    WIN(0.9056448046296738), WIN(0.9062092287071232), WIN(0.9067721921740575), WIN(0.9073336922691612),
+    WIN(0.9078937262375539), WIN(0.9084522913308081), WIN(0.9090093848069707), WIN(0.9095650039305824),
+    WIN(0.9101191459726969), WIN(0.9106718082109025), WIN(0.9112229879293401), WIN(0.9117726824187229),
+    WIN(0.912320888976358), WIN(0.9128676049061639), WIN(0.9134128275186911), WIN(0.9139565541311415),
+    WIN(0.9144987820673876), WIN(0.9150395086579926), WIN(0.9155787312402295), WIN(0.9161164471580994),
+    WIN(0.9166526537623528), WIN(0.9171873484105075), WIN(0.9177205284668678), WIN(0.9182521913025449),
+    WIN(0.9187823342954737), WIN(0.9193109548304348), WIN(0.9198380502990712), WIN(0.9203636180999081),
+    WIN(0.9208876556383725), WIN(0.921410160326811), WIN(0.9219311295845088), WIN(0.9224505608377096),
+    WIN(0.9229684515196329), WIN(0.9234847990704935), WIN(0.9239996009375201), WIN(0.9245128545749737),
+    WIN(0.9250245574441663), WIN(0.9255347070134794), WIN(0.9260433007583818), WIN(0.92655033616145),
+    WIN(0.9270558107123839), WIN(0.9275597219080264), WIN(0.9280620672523825), WIN(0.928562844256636),
+    WIN(0.9290620504391685), WIN(0.9295596833255775), WIN(0.9300557404486937), WIN(0.9305502193485999),
+    WIN(0.9310431175726491), WIN(0.9315344326754815), WIN(0.9320241622190426), WIN(0.9325123037726016),
+    WIN(0.9329988549127685), WIN(0.9334838132235124), WIN(0.9339671762961788), WIN(0.9344489417295064),
+    WIN(0.9349291071296469), WIN(0.9354076701101801), WIN(0.9358846282921323), WIN(0.9363599793039942),
+    WIN(0.9368337207817372), WIN(0.9373058503688321), WIN(0.9377763657162647), WIN(0.938245264482554),
+    WIN(0.938712544333769), WIN(0.9391782029435463), WIN(0.9396422379931058), WIN(0.94010464717127),
+    WIN(0.9405654281744781), WIN(0.9410245787068047), WIN(0.9414820964799766), WIN(0.9419379792133887),
+    WIN(0.9423922246341213), WIN(0.9428448304769562), WIN(0.9432957944843942), WIN(0.9437451144066706),
+    WIN(0.9441927880017731), WIN(0.9446388130354556), WIN(0.9450831872812583), WIN(0.9455259085205205),
+    WIN(0.9459669745423992), WIN(0.9464063831438843), WIN(0.9468441321298143), WIN(0.9472802193128943),
+    WIN(0.9477146425137098), WIN(0.948147399560744), WIN(0.9485784882903934), WIN(0.9490079065469834),
+    WIN(0.9494356521827847), WIN(0.9498617230580292), WIN(0.9502861170409238), WIN(0.9507088320076691),
+    WIN(0.9511298658424724), WIN(0.9515492164375647), WIN(0.9519668816932156), WIN(0.9523828595177486),
+    WIN(0.952797147827557), WIN(0.9532097445471186), WIN(0.9536206476090119), WIN(0.9540298549539293),
+    WIN(0.9544373645306949), WIN(0.9548431742962777), WIN(0.9552472822158071), WIN(0.9556496862625878),
+    WIN(0.9560503844181151), WIN(0.9564493746720892), WIN(0.9568466550224305), WIN(0.9572422234752938),
+    WIN(0.957636078045083), WIN(0.9580282167544664), WIN(0.9584186376343902), WIN(0.9588073387240943),
+    WIN(0.9591943180711252), WIN(0.9595795737313513), WIN(0.9599631037689773), WIN(0.9603449062565581),
+    WIN(0.960724979275013), WIN(0.9611033209136397), WIN(0.9614799292701286), WIN(0.9618548024505771),
+    WIN(0.9622279385695032), WIN(0.9625993357498585), WIN(0.9629689921230441), WIN(0.9633369058289223),
+    WIN(0.9637030750158319), WIN(0.9640674978406003), WIN(0.9644301724685582), WIN(0.9647910970735535),
+    WIN(0.9651502698379629), WIN(0.9655076889527072), WIN(0.9658633526172637), WIN(0.9662172590396797),
+    WIN(0.9665694064365853), WIN(0.9669197930332079), WIN(0.9672684170633828), WIN(0.967615276769569),
+    WIN(0.9679603704028603), WIN(0.9683036962229989), WIN(0.9686452524983884), WIN(0.9689850375061053),
+    WIN(0.969323049531914), WIN(0.9696592868702771), WIN(0.9699937478243696), WIN(0.9703264307060905),
+    WIN(0.9706573338360758), WIN(0.9709864555437108), WIN(0.9713137941671419), WIN(0.9716393480532898),
+    WIN(0.9719631155578602), WIN(0.9722850950453584), WIN(0.9726052848890988), WIN(0.9729236834712183),
+    WIN(0.9732402891826879), WIN(0.9735551004233248), WIN(0.9738681156018038), WIN(0.9741793331356696),
+    WIN(0.9744887514513478), WIN(0.9747963689841572), WIN(0.9751021841783211), WIN(0.9754061954869785),
+    WIN(0.9757084013721962), WIN(0.9760088003049792), WIN(0.9763073907652827), WIN(0.9766041712420239),
+    WIN(0.9768991402330915), WIN(0.9771922962453582), WIN(0.9774836377946913), WIN(0.9777731634059634),
+    WIN(0.9780608716130641), WIN(0.9783467609589096), WIN(0.9786308299954547), WIN(0.9789130772837029),
+    WIN(0.9791935013937171), WIN(0.9794721009046301), WIN(0.9797488744046551), WIN(0.9800238204910966),
+    WIN(0.9802969377703602), WIN(0.9805682248579634), WIN(0.980837680378545), WIN(0.9811053029658765),
+    WIN(0.981371091262871), WIN(0.9816350439215945), WIN(0.9818971596032745), WIN(0.9821574369783108),
+    WIN(0.9824158747262853), WIN(0.9826724715359716), WIN(0.9829272261053444), WIN(0.9831801371415895),
+    WIN(0.9834312033611138), WIN(0.9836804234895536), WIN(0.9839277962617852), WIN(0.984173320421934),
+    WIN(0.9844169947233826), WIN(0.9846588179287826), WIN(0.9848987888100608), WIN(0.9851369061484306),
+    WIN(0.9853731687343995), WIN(0.9856075753677794), WIN(0.9858401248576941), WIN(0.9860708160225891),
+    WIN(0.98629964769024), WIN(0.9865266186977614), WIN(0.9867517278916149), WIN(0.9869749741276188),
+    WIN(0.9871963562709551), WIN(0.9874158731961795), WIN(0.987633523787228), WIN(0.9878493069374269),
+    WIN(0.9880632215495), WIN(0.9882752665355763), WIN(0.9884854408171996), WIN(0.9886937433253351),
+    WIN(0.9889001730003778), WIN(0.9891047287921607), WIN(0.9893074096599617), WIN(0.9895082145725123),
+    WIN(0.9897071425080045), WIN(0.9899041924540994), WIN(0.990099363407933), WIN(0.9902926543761252),
+    WIN(0.9904840643747864), WIN(0.9906735924295255), WIN(0.9908612375754555), WIN(0.991046998857203),
+    WIN(0.9912308753289135), WIN(0.9914128660542589), WIN(0.9915929701064445), WIN(0.9917711865682163),
+    WIN(0.991947514531867), WIN(0.9921219530992432), WIN(0.9922945013817523), WIN(0.9924651585003683),
+    WIN(0.9926339235856392), WIN(0.9928007957776929), WIN(0.9929657742262438), WIN(0.9931288580905989),
+    WIN(0.9932900465396645), WIN(0.9934493387519516), WIN(0.9936067339155832), WIN(0.9937622312282987),
+    WIN(0.9939158298974613), WIN(0.994067529140063), WIN(0.994217328182731), WIN(0.9943652262617333),
+    WIN(0.9945112226229837), WIN(0.9946553165220484), WIN(0.9947975072241507), WIN(0.9949377940041771),
+    WIN(0.9950761761466825), WIN(0.995212652945895), WIN(0.9953472237057219), WIN(0.9954798877397544),
+    WIN(0.9956106443712727), WIN(0.9957394929332515), WIN(0.995866432768364), WIN(0.9959914632289879),
+    WIN(0.9961145836772096), WIN(0.9962357934848288), WIN(0.9963550920333635), WIN(0.9964724787140545),
+    WIN(0.9965879529278701), WIN(0.9967015140855099), WIN(0.9968131616074098), WIN(0.9969228949237466),
+    WIN(0.9970307134744412), WIN(0.9971366167091631), WIN(0.9972406040873355), WIN(0.997342675078138),
+    WIN(0.9974428291605112), WIN(0.9975410658231605), WIN(0.9976373845645596), WIN(0.9977317848929548),
+    WIN(0.9978242663263679), WIN(0.9979148283926007), WIN(0.9980034706292378), WIN(0.9980901925836498),
+    WIN(0.9981749938129979), WIN(0.9982578738842357), WIN(0.9983388323741136), WIN(0.9984178688691812),
+    WIN(0.9984949829657905), WIN(0.9985701742700994), WIN(0.9986434423980741), WIN(0.9987147869754919),
+    WIN(0.9987842076379443), WIN(0.9988517040308398), WIN(0.9989172758094063), WIN(0.9989809226386932),
+    WIN(0.9990426441935752), WIN(0.999102440158753), WIN(0.9991603102287573), WIN(0.9992162541079499),
+    WIN(0.9992702715105265), WIN(0.9993223621605184), WIN(0.9993725257917949), WIN(0.9994207621480654),
+    WIN(0.9994670709828805), WIN(0.999511452059635), WIN(0.9995539051515687), WIN(0.9995944300417687),
+    WIN(0.9996330265231704), WIN(0.9996696943985597), WIN(0.999704433480574), WIN(0.9997372435917038),
+    WIN(0.999768124564294), WIN(0.9997970762405448), WIN(0.9998240984725139), WIN(0.9998491911221161),
+    WIN(0.9998723540611257), WIN(0.9998935871711766), WIN(0.9999128903437633), WIN(0.9999302634802422),
+    WIN(0.9999457064918317), WIN(0.9999592192996134), WIN(0.9999708018345322), WIN(0.9999804540373972),
+    WIN(0.999988175858882), WIN(0.9999939672595249), WIN(0.9999978282097294), WIN(0.9999997586897643),
+};
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+static const kiss_fft_cpx stage_twiddles_4096[2047] = {
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.7071067811865476, -0.7071067811865475), TW(6.123233995736766e-17, -1.0),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.5555702330196023, -0.8314696123025452), TW(-0.3826834323650897, -0.9238795325112867),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.9238795325112867, -0.3826834323650899),
+    TW(-0.5555702330196022, 0.8314696123025452), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.24298017990326398, -0.970031253194544), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6715589548470183, -0.7409511253549591), TW(-0.09801714032956065, -0.9951847266721969),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.5956993044924335, -0.8032075314806448), TW(-0.29028467725446216, -0.9569403357322089),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5141027441932217, -0.8577286100002721), TW(-0.4713967368259977, -0.881921264348355),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.6343932841636454, -0.7730104533627371),
+    TW(-0.970031253194544, 0.24298017990326382), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.773010453362737, -0.6343932841636455),
+    TW(-0.8577286100002721, 0.5141027441932216), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(-0.6715589548470187, 0.7409511253549589), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.9569403357322088, -0.2902846772544624),
+    TW(-0.4275550934302825, 0.9039892931234431), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.9951847266721968, -0.09801714032956083),
+    TW(-0.1467304744553623, 0.9891765099647809), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9999247018391445, -0.012271538285719925), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9993223845883495, -0.03680722294135883), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9993223845883495, -0.03680722294135883), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9939069700023561, -0.11022220729388306), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9981181129001492, -0.06132073630220858), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.9831054874312163, -0.18303988795514095), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.996312612182778, -0.0857973123444399), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9669764710448521, -0.25486565960451457), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9939069700023561, -0.11022220729388306), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9456073253805213, -0.3253102921622629), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.99090263542778, -0.13458070850712617), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.9191138516900578, -0.3939920400610481), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9873014181578584, -0.15885814333386145), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8876396204028539, -0.46053871095824), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.9831054874312163, -0.18303988795514095), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.8513551931052652, -0.524589682678469), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9783173707196277, -0.20711137619221856), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.8104571982525948, -0.5857978574564389), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.9729399522055602, -0.2310581082806711), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.765167265622459, -0.6438315428897914), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9669764710448521, -0.25486565960451457), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.7157308252838186, -0.6983762494089729), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.9604305194155658, -0.27851968938505306), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.6624157775901718, -0.7491363945234593), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9533060403541939, -0.3020059493192281), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.6055110414043255, -0.7958369046088835), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.9456073253805213, -0.3253102921622629), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.5453249884220465, -0.838224705554838), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.937339011912575, -0.34841868024943456), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.48218377207912283, -0.8760700941954066), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.4496113296546066, -0.8932243011955153),
+    TW(0.9285060804732156, -0.37131719395183754), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.4164295600976373, -0.9091679830905223), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9191138516900578, -0.3939920400610481), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.3484186802494345, -0.937339011912575), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.6715589548470183, -0.7409511253549591), TW(0.3136817403988916, -0.9495281805930367),
+    TW(0.9091679830905224, -0.41642956009763715), TW(0.6531728429537768, -0.7572088465064845),
+    TW(0.27851968938505306, -0.9604305194155658), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.8986744656939538, -0.43861623853852766), TW(0.6152315905806268, -0.7883464276266062),
+    TW(0.20711137619221856, -0.9783173707196277), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.5956993044924335, -0.8032075314806448), TW(0.17096188876030136, -0.9852776423889412),
+    TW(0.8876396204028539, -0.46053871095824), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.13458070850712622, -0.99090263542778), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8760700941954066, -0.4821837720791227), TW(0.5349976198870973, -0.844853565249707),
+    TW(0.06132073630220865, -0.9981181129001492), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.024541228522912264, -0.9996988186962042),
+    TW(0.8639728561215868, -0.5035383837257176), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.012271538285719823, -0.9999247018391445), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8513551931052652, -0.524589682678469), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.08579731234443976, -0.996312612182778), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.12241067519921615, -0.99247953459871),
+    TW(0.8382247055548381, -0.5453249884220465), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.15885814333386128, -0.9873014181578584), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8245893027850253, -0.5657318107836131), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.23105810828067114, -0.9729399522055602), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(0.8104571982525948, -0.5857978574564389), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.3020059493192281, -0.9533060403541939), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.7958369046088836, -0.6055110414043255), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.3713171939518375, -0.9285060804732156), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(0.7807372285720945, -0.6248594881423863), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.4386162385385274, -0.8986744656939539), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.765167265622459, -0.6438315428897914), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.5035383837257175, -0.8639728561215868), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.534997619887097, -0.8448535652497072),
+    TW(0.7491363945234594, -0.6624157775901718), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.5657318107836132, -0.8245893027850252), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.7326542716724128, -0.680600997795453), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.6248594881423862, -0.7807372285720946), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(0.7157308252838186, -0.6983762494089729), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.680600997795453, -0.7326542716724128), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6983762494089729, -0.7157308252838186), TW(-0.024541228522912142, -0.9996988186962042),
+    TW(-0.7326542716724127, -0.6806009977954532), TW(0.6895405447370669, -0.7242470829514669),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(0.6806009977954531, -0.7326542716724128), TW(-0.07356456359966733, -0.9972904566786902),
+    TW(-0.7807372285720945, -0.6248594881423863), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6624157775901718, -0.7491363945234593), TW(-0.12241067519921615, -0.99247953459871),
+    TW(-0.8245893027850251, -0.5657318107836135), TW(0.6531728429537768, -0.7572088465064845),
+    TW(-0.14673047445536164, -0.989176509964781), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(0.6438315428897915, -0.765167265622459), TW(-0.17096188876030124, -0.9852776423889412),
+    TW(-0.8639728561215867, -0.5035383837257177), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6248594881423865, -0.7807372285720944), TW(-0.21910124015686966, -0.9757021300385286),
+    TW(-0.8986744656939539, -0.43861623853852755), TW(0.6152315905806268, -0.7883464276266062),
+    TW(-0.24298017990326387, -0.970031253194544), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(0.6055110414043255, -0.7958369046088835), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(-0.9285060804732155, -0.3713171939518377), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5857978574564389, -0.8104571982525948), TW(-0.3136817403988914, -0.9495281805930367),
+    TW(-0.9533060403541939, -0.30200594931922803), TW(0.5758081914178453, -0.8175848131515837),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(0.5657318107836132, -0.8245893027850253), TW(-0.35989503653498817, -0.9329927988347388),
+    TW(-0.9729399522055601, -0.23105810828067133), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5453249884220465, -0.838224705554838), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(-0.9873014181578584, -0.15885814333386147), TW(0.5349976198870973, -0.844853565249707),
+    TW(-0.42755509343028186, -0.9039892931234434), TW(-0.99247953459871, -0.12241067519921635),
+    TW(0.5245896826784688, -0.8513551931052652), TW(-0.4496113296546067, -0.8932243011955152),
+    TW(-0.996312612182778, -0.08579731234444016), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.5035383837257176, -0.8639728561215867), TW(-0.492898192229784, -0.8700869911087115),
+    TW(-0.9999247018391445, -0.012271538285720007), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.5141027441932217, -0.8577286100002721), TW(-0.9996988186962042, 0.02454122852291208),
+    TW(0.48218377207912283, -0.8760700941954066), TW(-0.534997619887097, -0.8448535652497072),
+    TW(-0.9981181129001492, 0.061320736302208245), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.46053871095824, -0.8876396204028539), TW(-0.5758081914178453, -0.8175848131515837),
+    TW(-0.99090263542778, 0.13458070850712606), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(-0.9852776423889413, 0.17096188876030097),
+    TW(0.4386162385385277, -0.8986744656939538), TW(-0.6152315905806267, -0.7883464276266063),
+    TW(-0.9783173707196277, 0.2071113761922186), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.4164295600976373, -0.9091679830905223), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(-0.9604305194155659, 0.2785196893850529), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.6715589548470184, -0.740951125354959), TW(-0.9495281805930368, 0.3136817403988912),
+    TW(0.3939920400610481, -0.9191138516900578), TW(-0.6895405447370669, -0.7242470829514669),
+    TW(-0.937339011912575, 0.34841868024943456), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3713171939518376, -0.9285060804732155), TW(-0.7242470829514668, -0.689540544737067),
+    TW(-0.9091679830905225, 0.41642956009763693), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.7409511253549589, -0.6715589548470186), TW(-0.8932243011955153, 0.44961132965460665),
+    TW(0.3484186802494345, -0.937339011912575), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(-0.8760700941954066, 0.48218377207912266), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.325310292162263, -0.9456073253805213), TW(-0.7883464276266062, -0.6152315905806269),
+    TW(-0.8382247055548382, 0.5453249884220461), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(-0.8175848131515837, 0.5758081914178453),
+    TW(0.3020059493192282, -0.9533060403541938), TW(-0.8175848131515836, -0.5758081914178454),
+    TW(-0.7958369046088836, 0.6055110414043254), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.27851968938505306, -0.9604305194155658), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(-0.7491363945234593, 0.6624157775901718), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.857728610000272, -0.5141027441932218), TW(-0.724247082951467, 0.6895405447370668),
+    TW(0.2548656596045146, -0.9669764710448521), TW(-0.8700869911087113, -0.49289819222978415),
+    TW(-0.698376249408973, 0.7157308252838185), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.23105810828067128, -0.9729399522055601), TW(-0.8932243011955152, -0.4496113296546069),
+    TW(-0.6438315428897915, 0.765167265622459), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.9039892931234433, -0.42755509343028203), TW(-0.6152315905806273, 0.7883464276266059),
+    TW(0.20711137619221856, -0.9783173707196277), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(-0.5857978574564391, 0.8104571982525947), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.18303988795514106, -0.9831054874312163), TW(-0.9329927988347388, -0.35989503653498833),
+    TW(-0.5245896826784694, 0.8513551931052649), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(-0.4928981922297842, 0.8700869911087113),
+    TW(0.1588581433338614, -0.9873014181578584), TW(-0.9495281805930367, -0.3136817403988914),
+    TW(-0.4605387109582399, 0.887639620402854), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.13458070850712622, -0.99090263542778), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(-0.3939920400610482, 0.9191138516900577), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.970031253194544, -0.24298017990326407), TW(-0.35989503653498794, 0.932992798834739),
+    TW(0.11022220729388318, -0.9939069700023561), TW(-0.9757021300385285, -0.21910124015687005),
+    TW(-0.3253102921622633, 0.9456073253805212), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.08579731234443988, -0.996312612182778), TW(-0.9852776423889412, -0.17096188876030122),
+    TW(-0.25486565960451435, 0.9669764710448522), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.989176509964781, -0.1467304744553618), TW(-0.2191012401568701, 0.9757021300385285),
+    TW(0.06132073630220865, -0.9981181129001492), TW(-0.99247953459871, -0.12241067519921635),
+    TW(-0.18303988795514095, 0.9831054874312163), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.03680722294135899, -0.9993223845883495), TW(-0.9972904566786902, -0.07356456359966773),
+    TW(-0.11022220729388331, 0.9939069700023561), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(-0.07356456359966736, 0.9972904566786902),
+    TW(0.012271538285719944, -0.9999247018391445), TW(-0.9996988186962042, -0.024541228522912326),
+    TW(-0.03680722294135933, 0.9993223845883494), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9999952938095762, -0.003067956762965976), TW(0.9999811752826011, -0.006135884649154475),
+    TW(0.9999576445519639, -0.00920375478205982), TW(0.9999811752826011, -0.006135884649154475),
+    TW(0.9999247018391445, -0.012271538285719925), TW(0.9998305817958234, -0.01840672990580482),
+    TW(0.9999576445519639, -0.00920375478205982), TW(0.9998305817958234, -0.01840672990580482),
+    TW(0.9996188224951786, -0.02760814577896574), TW(0.9999247018391445, -0.012271538285719925),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9998823474542126, -0.0153392062849881), TW(0.9995294175010931, -0.030674803176636626),
+    TW(0.9989412931868569, -0.04600318213091462), TW(0.9998305817958234, -0.01840672990580482),
+    TW(0.9993223845883495, -0.03680722294135883), TW(0.9984755805732948, -0.055195244349689934),
+    TW(0.9997694053512153, -0.021474080275469508), TW(0.9990777277526454, -0.04293825693494082),
+    TW(0.997925286198596, -0.06438263092985747), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9996188224951786, -0.02760814577896574), TW(0.9984755805732948, -0.055195244349689934),
+    TW(0.9965711457905548, -0.08274026454937569), TW(0.9995294175010931, -0.030674803176636626),
+    TW(0.9981181129001492, -0.06132073630220858), TW(0.9957674144676598, -0.09190895649713272),
+    TW(0.9994306045554617, -0.03374117185137758), TW(0.9977230666441916, -0.06744391956366405),
+    TW(0.9948793307948056, -0.10106986275482782), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9992047586183639, -0.03987292758773981), TW(0.9968202992911657, -0.07968243797143013),
+    TW(0.9928504144598651, -0.11936521481099135), TW(0.9990777277526454, -0.04293825693494082),
+    TW(0.996312612182778, -0.0857973123444399), TW(0.9917097536690995, -0.12849811079379317),
+    TW(0.9989412931868569, -0.04600318213091462), TW(0.9957674144676598, -0.09190895649713272),
+    TW(0.9904850842564571, -0.13762012158648604), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9986402181802653, -0.052131704680283324), TW(0.9945645707342554, -0.10412163387205459),
+    TW(0.9877841416445722, -0.15582839765426523), TW(0.9984755805732948, -0.055195244349689934),
+    TW(0.9939069700023561, -0.11022220729388306), TW(0.9863080972445987, -0.16491312048996992),
+    TW(0.9983015449338929, -0.05825826450043575), TW(0.9932119492347945, -0.11631863091190475),
+    TW(0.9847485018019042, -0.17398387338746382), TW(0.9981181129001492, -0.06132073630220858),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.997925286198596, -0.06438263092985747), TW(0.9917097536690995, -0.12849811079379317),
+    TW(0.9813791933137546, -0.19208039704989244), TW(0.9977230666441916, -0.06744391956366405),
+    TW(0.99090263542778, -0.13458070850712617), TW(0.9795697656854405, -0.2011046348420919),
+    TW(0.9975114561403035, -0.07050457338961386), TW(0.9900582102622971, -0.1406582393328492),
+    TW(0.9776773578245099, -0.2101118368804696), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.997060070339483, -0.07662386139203149), TW(0.9882575677307495, -0.15279718525844344),
+    TW(0.973644249650812, -0.22807208317088573), TW(0.9968202992911657, -0.07968243797143013),
+    TW(0.9873014181578584, -0.15885814333386145), TW(0.9715038909862518, -0.2370236059943672),
+    TW(0.9965711457905548, -0.08274026454937569), TW(0.9863080972445987, -0.16491312048996992),
+    TW(0.9692812353565485, -0.2459550503357946), TW(0.996312612182778, -0.0857973123444399),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.996044700901252, -0.0888535525825246), TW(0.984210092386929, -0.17700422041214875),
+    TW(0.9645897932898128, -0.26375467897483135), TW(0.9957674144676598, -0.09190895649713272),
+    TW(0.9831054874312163, -0.18303988795514095), TW(0.9621214042690416, -0.272621355449949),
+    TW(0.9954807554919269, -0.09496349532963899), TW(0.9819638691095552, -0.1890686641498062),
+    TW(0.9595715130819845, -0.28146493792575794), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9948793307948056, -0.10106986275482782), TW(0.9795697656854405, -0.2011046348420919),
+    TW(0.9542280951091057, -0.2990798263080405), TW(0.9945645707342554, -0.10412163387205459),
+    TW(0.9783173707196277, -0.20711137619221856), TW(0.9514350209690083, -0.30784964004153487),
+    TW(0.9942404494531879, -0.10717242495680884), TW(0.9770281426577544, -0.21311031991609136),
+    TW(0.9485613499157303, -0.31659337555616585), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.9935641355205953, -0.11327095217756435), TW(0.9743393827855759, -0.22508391135979283),
+    TW(0.9425731976014469, -0.3339996514420094), TW(0.9932119492347945, -0.11631863091190475),
+    TW(0.9729399522055602, -0.2310581082806711), TW(0.9394592236021899, -0.3426607173119944),
+    TW(0.9928504144598651, -0.11936521481099135), TW(0.9715038909862518, -0.2370236059943672),
+    TW(0.9362656671702783, -0.3512927560855671), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.9920993131421918, -0.12545498341154623), TW(0.9685220942744174, -0.24892760574572015),
+    TW(0.9296408958431813, -0.3684668299533723), TW(0.9917097536690995, -0.12849811079379317),
+    TW(0.9669764710448521, -0.25486565960451457), TW(0.9262102421383114, -0.37700741021641826),
+    TW(0.9913108598461154, -0.13154002870288312), TW(0.9653944416976894, -0.2607941179152755),
+    TW(0.9227011283338786, -0.38551605384391885), TW(0.99090263542778, -0.13458070850712617),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.9904850842564571, -0.13762012158648604), TW(0.9621214042690416, -0.272621355449949),
+    TW(0.9154487160882678, -0.40243465085941843), TW(0.9900582102622971, -0.1406582393328492),
+    TW(0.9604305194155658, -0.27851968938505306), TW(0.9117060320054299, -0.4108431710579039),
+    TW(0.9896220174632009, -0.14369503315029447), TW(0.9587034748958716, -0.2844075372112719),
+    TW(0.9078861164876663, -0.4192168883632239), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9887216919603238, -0.1497645346773215), TW(0.9551411683057708, -0.2961508882436238),
+    TW(0.9000158920161603, -0.4358570799222555), TW(0.9882575677307495, -0.15279718525844344),
+    TW(0.9533060403541939, -0.3020059493192281), TW(0.8959662497561852, -0.4441221445704292),
+    TW(0.9877841416445722, -0.15582839765426523), TW(0.9514350209690083, -0.30784964004153487),
+    TW(0.8918407093923427, -0.4523495872337709), TW(0.9873014181578584, -0.15885814333386145),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.9868094018141855, -0.16188639378011183), TW(0.9475855910177411, -0.3195020308160157),
+    TW(0.8833633386657316, -0.4686888220358279), TW(0.9863080972445987, -0.16491312048996992),
+    TW(0.9456073253805213, -0.3253102921622629), TW(0.8790122264286335, -0.4767992300633221),
+    TW(0.9857975091675675, -0.16793829497473117), TW(0.9435934581619604, -0.33110630575987643),
+    TW(0.8745866522781761, -0.48486924800079106), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.9847485018019042, -0.17398387338746382), TW(0.9394592236021899, -0.3426607173119944),
+    TW(0.8655136240905691, -0.5008853826112407), TW(0.984210092386929, -0.17700422041214875),
+    TW(0.937339011912575, -0.34841868024943456), TW(0.8608669386377673, -0.508830142543107),
+    TW(0.9836624192117303, -0.18002290140569951), TW(0.9351835099389476, -0.35416352542049034),
+    TW(0.8561473283751945, -0.5167317990176499), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.9825393022874412, -0.18605515166344663), TW(0.9307669610789837, -0.36561299780477385),
+    TW(0.8464909387740521, -0.5324031278771979), TW(0.9819638691095552, -0.1890686641498062),
+    TW(0.9285060804732156, -0.37131719395183754), TW(0.8415549774368984, -0.5401714727298929),
+    TW(0.9813791933137546, -0.19208039704989244), TW(0.9262102421383114, -0.37700741021641826),
+    TW(0.836547727223512, -0.5478940591731002), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9801821359681174, -0.19809841071795356), TW(0.921514039342042, -0.38834504669882625),
+    TW(0.8263210628456635, -0.5631993440138341), TW(0.9795697656854405, -0.2011046348420919),
+    TW(0.9191138516900578, -0.3939920400610481), TW(0.8211025149911046, -0.5707807458869673),
+    TW(0.9789481753190622, -0.20410896609281687), TW(0.9166790599210427, -0.3996241998456468),
+    TW(0.8158144108067338, -0.5783137964116556), TW(0.9783173707196277, -0.20711137619221856),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.9776773578245099, -0.2101118368804696), TW(0.9117060320054299, -0.4108431710579039),
+    TW(0.8050313311429637, -0.5932322950397998), TW(0.9770281426577544, -0.21311031991609136),
+    TW(0.9091679830905224, -0.41642956009763715), TW(0.799537269107905, -0.600616479383869),
+    TW(0.9763697313300211, -0.21610679707621952), TW(0.9065957045149153, -0.4220002707997997),
+    TW(0.7939754775543372, -0.6079497849677736), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.9750253450669941, -0.2220936209732035), TW(0.901348847046022, -0.43309381885315196),
+    TW(0.7826505961665757, -0.62246127937415), TW(0.9743393827855759, -0.22508391135979283),
+    TW(0.8986744656939538, -0.43861623853852766), TW(0.7768884656732324, -0.629638238914927),
+    TW(0.973644249650812, -0.22807208317088573), TW(0.8959662497561852, -0.4441221445704292),
+    TW(0.7710605242618138, -0.6367618612362842), TW(0.9729399522055602, -0.2310581082806711),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.9722264970789363, -0.23404195858354343), TW(0.8904487232447579, -0.45508358712634384),
+    TW(0.7592091889783881, -0.6508466849963809), TW(0.9715038909862518, -0.2370236059943672),
+    TW(0.8876396204028539, -0.46053871095824), TW(0.7531867990436125, -0.6578066932970786),
+    TW(0.9707721407289504, -0.2400030224487415), TW(0.8847970984309378, -0.4659764957679662),
+    TW(0.7471006059801801, -0.6647109782033448), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9692812353565485, -0.2459550503357946), TW(0.8790122264286335, -0.4767992300633221),
+    TW(0.7347388780959635, -0.6783500431298615), TW(0.9685220942744174, -0.24892760574572015),
+    TW(0.8760700941954066, -0.4821837720791227), TW(0.7284643904482252, -0.6850836677727004),
+    TW(0.9677538370934755, -0.25189781815421697), TW(0.8730949784182901, -0.487550160148436),
+    TW(0.7221281939292153, -0.6917592583641577), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.9661900034454125, -0.257831102162159), TW(0.8670462455156926, -0.49822766697278187),
+    TW(0.7092728264388657, -0.7049340803759049), TW(0.9653944416976894, -0.2607941179152755),
+    TW(0.8639728561215868, -0.5035383837257176), TW(0.7027547444572253, -0.7114321957452164),
+    TW(0.9645897932898128, -0.26375467897483135), TW(0.8608669386377673, -0.508830142543107),
+    TW(0.696177131491463, -0.7178700450557317), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.9629532668736839, -0.2696683255729151), TW(0.8545579883654005, -0.5193559901655896),
+    TW(0.6828455463852481, -0.7305627692278276), TW(0.9621214042690416, -0.272621355449949),
+    TW(0.8513551931052652, -0.524589682678469), TW(0.676092703575316, -0.7368165688773698),
+    TW(0.9612804858113206, -0.27557181931095814), TW(0.8481203448032972, -0.5298036246862946),
+    TW(0.669282588346636, -0.7430079521351217), TW(0.9604305194155658, -0.27851968938505306),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.6624157775901718, -0.7491363945234593),
+    TW(0.9595715130819845, -0.28146493792575794), TW(0.8415549774368984, -0.5401714727298929),
+    TW(0.6554928529996155, -0.7552013768965365), TW(0.9587034748958716, -0.2844075372112719),
+    TW(0.8382247055548381, -0.5453249884220465), TW(0.6485144010221126, -0.7612023854842618),
+    TW(0.9578264130275329, -0.2873474595447295), TW(0.83486287498638, -0.5504579729366048),
+    TW(0.6414810128085832, -0.7671389119358204), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9560452513499964, -0.29321916269425863), TW(0.8280450452577558, -0.560661576197336),
+    TW(0.6272518154951442, -0.7788165123814759), TW(0.9551411683057708, -0.2961508882436238),
+    TW(0.8245893027850253, -0.5657318107836131), TW(0.6200572117632892, -0.7845565971555752),
+    TW(0.9542280951091057, -0.2990798263080405), TW(0.8211025149911046, -0.5707807458869673),
+    TW(0.6128100824294097, -0.79023022143731), TW(0.9533060403541939, -0.3020059493192281),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.6055110414043255, -0.7958369046088835),
+    TW(0.9523750127197659, -0.3049292297354024), TW(0.8140363297059484, -0.5808139580957645),
+    TW(0.5981607069963424, -0.8013761717231401), TW(0.9514350209690083, -0.30784964004153487),
+    TW(0.8104571982525948, -0.5857978574564389), TW(0.5907597018588743, -0.8068475535437992),
+    TW(0.9504860739494817, -0.3107671527496115), TW(0.8068475535437993, -0.5907597018588742),
+    TW(0.5833086529376983, -0.8122505865852039), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.9485613499157303, -0.31659337555616585), TW(0.799537269107905, -0.600616479383869),
+    TW(0.5682589526701315, -0.8228497813758263), TW(0.9475855910177411, -0.3195020308160157),
+    TW(0.7958369046088836, -0.6055110414043255), TW(0.560661576197336, -0.8280450452577558),
+    TW(0.9466009130832835, -0.32240767880106985), TW(0.7921065773002124, -0.6103828062763095),
+    TW(0.5530167055800276, -0.8331701647019132), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.5453249884220465, -0.838224705554838),
+    TW(0.9446048372614803, -0.3282098435790925), TW(0.7845565971555752, -0.6200572117632891),
+    TW(0.5375870762956455, -0.8432082396418454), TW(0.9435934581619604, -0.33110630575987643),
+    TW(0.7807372285720945, -0.6248594881423863), TW(0.5298036246862948, -0.8481203448032971),
+    TW(0.9425731976014469, -0.3339996514420094), TW(0.7768884656732324, -0.629638238914927),
+    TW(0.5219752929371544, -0.8529606049303636), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.9405060705932683, -0.33977688440682685), TW(0.7691033376455797, -0.6391244448637757),
+    TW(0.5061866453451555, -0.8624239561110405), TW(0.9394592236021899, -0.3426607173119944),
+    TW(0.765167265622459, -0.6438315428897914), TW(0.49822766697278187, -0.8670462455156926),
+    TW(0.9384035340631081, -0.3455413249639891), TW(0.7612023854842618, -0.6485144010221124),
+    TW(0.4902264832882911, -0.8715950866559511), TW(0.937339011912575, -0.34841868024943456),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.48218377207912283, -0.8760700941954066),
+    TW(0.9362656671702783, -0.3512927560855671), TW(0.7531867990436125, -0.6578066932970786),
+    TW(0.47410021465055, -0.8804708890521608), TW(0.9351835099389476, -0.35416352542049034),
+    TW(0.7491363945234594, -0.6624157775901718), TW(0.4659764957679661, -0.8847970984309378),
+    TW(0.934092550404259, -0.35703096123343), TW(0.7450577854414661, -0.6669999223036375),
+    TW(0.4578133035988773, -0.8890483558546646), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.4496113296546066, -0.8932243011955153),
+    TW(0.9318842655816681, -0.3627557243673972), TW(0.7368165688773699, -0.6760927035753159),
+    TW(0.4413712687317166, -0.8973245807054183), TW(0.9307669610789837, -0.36561299780477385),
+    TW(0.7326542716724128, -0.680600997795453), TW(0.433093818853152, -0.901348847046022),
+    TW(0.9296408958431813, -0.3684668299533723), TW(0.7284643904482252, -0.6850836677727004),
+    TW(0.4247796812091088, -0.9052967593181188), TW(0.9285060804732156, -0.37131719395183754),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.4164295600976373, -0.9091679830905223),
+    TW(0.9273625256504011, -0.37416406297145793), TW(0.7200025079613817, -0.693971460889654),
+    TW(0.40804416286497874, -0.9129621904283981), TW(0.9262102421383114, -0.37700741021641826),
+    TW(0.7157308252838186, -0.6983762494089729), TW(0.3996241998456468, -0.9166790599210427),
+    TW(0.9250492407826776, -0.37984720892405116), TW(0.7114321957452164, -0.7027547444572253),
+    TW(0.391170384302254, -0.9203182767091105), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9227011283338786, -0.38551605384391885), TW(0.7027547444572253, -0.7114321957452164),
+    TW(0.374164062971458, -0.9273625256504011), TW(0.921514039342042, -0.38834504669882625),
+    TW(0.6983762494089729, -0.7157308252838186), TW(0.36561299780477396, -0.9307669610789837),
+    TW(0.9203182767091106, -0.39117038430225387), TW(0.693971460889654, -0.7200025079613817),
+    TW(0.35703096123343003, -0.9340925504042589), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.3484186802494345, -0.937339011912575),
+    TW(0.9179007756213905, -0.3968099874167103), TW(0.6850836677727004, -0.7284643904482252),
+    TW(0.33977688440682696, -0.9405060705932683), TW(0.9166790599210427, -0.3996241998456468),
+    TW(0.6806009977954531, -0.7326542716724128), TW(0.33110630575987643, -0.9435934581619604),
+    TW(0.9154487160882678, -0.40243465085941843), TW(0.676092703575316, -0.7368165688773698),
+    TW(0.32240767880107, -0.9466009130832835), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.6715589548470183, -0.7409511253549591), TW(0.3136817403988916, -0.9495281805930367),
+    TW(0.9129621904283982, -0.4080441628649787), TW(0.6669999223036375, -0.745057785441466),
+    TW(0.30492922973540243, -0.9523750127197659), TW(0.9117060320054299, -0.4108431710579039),
+    TW(0.6624157775901718, -0.7491363945234593), TW(0.29615088824362396, -0.9551411683057707),
+    TW(0.9104412922580672, -0.4136383122384345), TW(0.6578066932970786, -0.7531867990436124),
+    TW(0.28734745954472957, -0.9578264130275329), TW(0.9091679830905224, -0.41642956009763715),
+    TW(0.6531728429537768, -0.7572088465064845), TW(0.27851968938505306, -0.9604305194155658),
+    TW(0.9078861164876663, -0.4192168883632239), TW(0.6485144010221126, -0.7612023854842618),
+    TW(0.2696683255729152, -0.9629532668736839), TW(0.9065957045149153, -0.4220002707997997),
+    TW(0.6438315428897915, -0.765167265622459), TW(0.26079411791527557, -0.9653944416976894),
+    TW(0.9052967593181188, -0.4247796812091088), TW(0.6391244448637757, -0.7691033376455796),
+    TW(0.2518978181542169, -0.9677538370934755), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.9026733182372588, -0.4303264813400826), TW(0.6296382389149271, -0.7768884656732324),
+    TW(0.23404195858354346, -0.9722264970789363), TW(0.901348847046022, -0.43309381885315196),
+    TW(0.6248594881423865, -0.7807372285720944), TW(0.22508391135979278, -0.9743393827855759),
+    TW(0.9000158920161603, -0.4358570799222555), TW(0.6200572117632892, -0.7845565971555752),
+    TW(0.2161067970762196, -0.9763697313300211), TW(0.8986744656939538, -0.43861623853852766),
+    TW(0.6152315905806268, -0.7883464276266062), TW(0.20711137619221856, -0.9783173707196277),
+    TW(0.8973245807054183, -0.44137126873171667), TW(0.6103828062763095, -0.7921065773002124),
+    TW(0.19809841071795373, -0.9801821359681173), TW(0.8959662497561852, -0.4441221445704292),
+    TW(0.6055110414043255, -0.7958369046088835), TW(0.18906866414980628, -0.9819638691095552),
+    TW(0.8945994856313827, -0.44686884016237416), TW(0.600616479383869, -0.799537269107905),
+    TW(0.18002290140569951, -0.9836624192117303), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.5956993044924335, -0.8032075314806448), TW(0.17096188876030136, -0.9852776423889412),
+    TW(0.8918407093923427, -0.4523495872337709), TW(0.5907597018588743, -0.8068475535437992),
+    TW(0.16188639378011188, -0.9868094018141854), TW(0.8904487232447579, -0.45508358712634384),
+    TW(0.5857978574564389, -0.8104571982525948), TW(0.1527971852584434, -0.9882575677307495),
+    TW(0.8890483558546646, -0.4578133035988772), TW(0.5808139580957645, -0.8140363297059483),
+    TW(0.14369503315029458, -0.9896220174632008), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.13458070850712622, -0.99090263542778),
+    TW(0.8862225301488806, -0.46325978355186015), TW(0.5707807458869674, -0.8211025149911046),
+    TW(0.1254549834115462, -0.9920993131421918), TW(0.8847970984309378, -0.4659764957679662),
+    TW(0.5657318107836132, -0.8245893027850253), TW(0.11631863091190488, -0.9932119492347945),
+    TW(0.8833633386657316, -0.4686888220358279), TW(0.560661576197336, -0.8280450452577558),
+    TW(0.10717242495680887, -0.9942404494531879), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8804708890521608, -0.47410021465054997), TW(0.5504579729366048, -0.83486287498638),
+    TW(0.08885355258252468, -0.996044700901252), TW(0.8790122264286335, -0.4767992300633221),
+    TW(0.5453249884220465, -0.838224705554838), TW(0.07968243797143013, -0.9968202992911657),
+    TW(0.8775452902072614, -0.479493757660153), TW(0.540171472729893, -0.8415549774368983),
+    TW(0.07050457338961401, -0.9975114561403035), TW(0.8760700941954066, -0.4821837720791227),
+    TW(0.5349976198870973, -0.844853565249707), TW(0.06132073630220865, -0.9981181129001492),
+    TW(0.8745866522781761, -0.48486924800079106), TW(0.5298036246862948, -0.8481203448032971),
+    TW(0.05213170468028332, -0.9986402181802653), TW(0.8730949784182901, -0.487550160148436),
+    TW(0.5245896826784688, -0.8513551931052652), TW(0.04293825693494096, -0.9990777277526454),
+    TW(0.871595086655951, -0.49022648328829116), TW(0.5193559901655895, -0.8545579883654005),
+    TW(0.03374117185137764, -0.9994306045554617), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.024541228522912264, -0.9996988186962042),
+    TW(0.8685707059713409, -0.49556526182577254), TW(0.508830142543107, -0.8608669386377673),
+    TW(0.01533920628498822, -0.9998823474542126), TW(0.8670462455156926, -0.49822766697278187),
+    TW(0.5035383837257176, -0.8639728561215867), TW(0.006135884649154515, -0.9999811752826011),
+    TW(0.8655136240905691, -0.5008853826112407), TW(0.49822766697278187, -0.8670462455156926),
+    TW(-0.0030679567629660156, -0.9999952938095762), TW(0.8639728561215868, -0.5035383837257176),
+    TW(0.4928981922297841, -0.8700869911087113), TW(-0.012271538285719823, -0.9999247018391445),
+    TW(0.8624239561110406, -0.5061866453451552), TW(0.48755016014843605, -0.8730949784182901),
+    TW(-0.021474080275469484, -0.9997694053512153), TW(0.8608669386377673, -0.508830142543107),
+    TW(0.48218377207912283, -0.8760700941954066), TW(-0.03067480317663646, -0.9995294175010931),
+    TW(0.8593018183570085, -0.5114688504379703), TW(0.47679923006332225, -0.8790122264286334),
+    TW(-0.03987292758773973, -0.9992047586183639), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8561473283751945, -0.5167317990176499), TW(0.4659764957679661, -0.8847970984309378),
+    TW(-0.05825826450043561, -0.9983015449338929), TW(0.8545579883654005, -0.5193559901655896),
+    TW(0.46053871095824, -0.8876396204028539), TW(-0.06744391956366398, -0.9977230666441916),
+    TW(0.8529606049303636, -0.5219752929371544), TW(0.45508358712634384, -0.8904487232447579),
+    TW(-0.0766238613920315, -0.997060070339483), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.4496113296546066, -0.8932243011955153), TW(-0.08579731234443976, -0.996312612182778),
+    TW(0.8497417680008525, -0.5271991347819013), TW(0.44412214457042926, -0.8959662497561851),
+    TW(-0.09496349532963895, -0.9954807554919269), TW(0.8481203448032972, -0.5298036246862946),
+    TW(0.4386162385385277, -0.8986744656939538), TW(-0.1041216338720546, -0.9945645707342554),
+    TW(0.8464909387740521, -0.5324031278771979), TW(0.433093818853152, -0.901348847046022),
+    TW(-0.11327095217756424, -0.9935641355205953), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.12241067519921615, -0.99247953459871),
+    TW(0.8432082396418454, -0.5375870762956454), TW(0.4220002707997998, -0.9065957045149153),
+    TW(-0.13154002870288314, -0.9913108598461154), TW(0.8415549774368984, -0.5401714727298929),
+    TW(0.4164295600976373, -0.9091679830905223), TW(-0.14065823933284913, -0.9900582102622971),
+    TW(0.8398937941959995, -0.5427507848645159), TW(0.4108431710579039, -0.9117060320054299),
+    TW(-0.1497645346773215, -0.9887216919603238), TW(0.8382247055548381, -0.5453249884220465),
+    TW(0.40524131400498986, -0.9142097557035307), TW(-0.15885814333386128, -0.9873014181578584),
+    TW(0.836547727223512, -0.5478940591731002), TW(0.3996241998456468, -0.9166790599210427),
+    TW(-0.1679382949747311, -0.9857975091675675), TW(0.83486287498638, -0.5504579729366048),
+    TW(0.3939920400610481, -0.9191138516900578), TW(-0.17700422041214875, -0.984210092386929),
+    TW(0.8331701647019132, -0.5530167055800275), TW(0.3883450466988263, -0.9215140393420419),
+    TW(-0.1860551516634465, -0.9825393022874412), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.829761233794523, -0.5581185312205561), TW(0.3770074102164183, -0.9262102421383113),
+    TW(-0.2041089660928169, -0.9789481753190622), TW(0.8280450452577558, -0.560661576197336),
+    TW(0.3713171939518376, -0.9285060804732155), TW(-0.21311031991609125, -0.9770281426577544),
+    TW(0.8263210628456635, -0.5631993440138341), TW(0.36561299780477396, -0.9307669610789837),
+    TW(-0.22209362097320348, -0.9750253450669941), TW(0.8245893027850253, -0.5657318107836131),
+    TW(0.3598950365349883, -0.9329927988347388), TW(-0.23105810828067114, -0.9729399522055602),
+    TW(0.8228497813758264, -0.5682589526701315), TW(0.3541635254204905, -0.9351835099389475),
+    TW(-0.2400030224487414, -0.9707721407289504), TW(0.8211025149911046, -0.5707807458869673),
+    TW(0.3484186802494345, -0.937339011912575), TW(-0.24892760574572012, -0.9685220942744174),
+    TW(0.8193475200767969, -0.5732971666980422), TW(0.3426607173119944, -0.9394592236021899),
+    TW(-0.2578311021621588, -0.9661900034454126), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(0.8158144108067338, -0.5783137964116556), TW(0.33110630575987643, -0.9435934581619604),
+    TW(-0.27557181931095814, -0.9612804858113206), TW(0.8140363297059484, -0.5808139580957645),
+    TW(0.325310292162263, -0.9456073253805213), TW(-0.2844075372112717, -0.9587034748958716),
+    TW(0.8122505865852039, -0.5833086529376983), TW(0.31950203081601575, -0.9475855910177411),
+    TW(-0.2932191626942586, -0.9560452513499965), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.3136817403988916, -0.9495281805930367), TW(-0.3020059493192281, -0.9533060403541939),
+    TW(0.808656181588175, -0.5882815482226452), TW(0.307849640041535, -0.9514350209690083),
+    TW(-0.31076715274961136, -0.9504860739494818), TW(0.8068475535437993, -0.5907597018588742),
+    TW(0.3020059493192282, -0.9533060403541938), TW(-0.31950203081601564, -0.9475855910177412),
+    TW(0.8050313311429637, -0.5932322950397998), TW(0.29615088824362396, -0.9551411683057707),
+    TW(-0.32820984357909255, -0.9446048372614803), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.8013761717231402, -0.5981607069963423), TW(0.2844075372112718, -0.9587034748958716),
+    TW(-0.34554132496398904, -0.9384035340631082), TW(0.799537269107905, -0.600616479383869),
+    TW(0.27851968938505306, -0.9604305194155658), TW(-0.3541635254204904, -0.9351835099389476),
+    TW(0.7976908409433912, -0.6030665985403482), TW(0.272621355449949, -0.9621214042690416),
+    TW(-0.3627557243673971, -0.9318842655816681), TW(0.7958369046088836, -0.6055110414043255),
+    TW(0.2667127574748984, -0.9637760657954398), TW(-0.3713171939518375, -0.9285060804732156),
+    TW(0.7939754775543372, -0.6079497849677736), TW(0.26079411791527557, -0.9653944416976894),
+    TW(-0.379847208924051, -0.9250492407826777), TW(0.7921065773002124, -0.6103828062763095),
+    TW(0.2548656596045146, -0.9669764710448521), TW(-0.3883450466988262, -0.921514039342042),
+    TW(0.79023022143731, -0.6128100824294097), TW(0.24892760574572026, -0.9685220942744173),
+    TW(-0.3968099874167103, -0.9179007756213905), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(0.7864552135990858, -0.6176473079378039), TW(0.23702360599436734, -0.9715038909862518),
+    TW(-0.41363831223843445, -0.9104412922580672), TW(0.7845565971555752, -0.6200572117632891),
+    TW(0.23105810828067128, -0.9729399522055601), TW(-0.4220002707997997, -0.9065957045149153),
+    TW(0.7826505961665757, -0.62246127937415), TW(0.22508391135979278, -0.9743393827855759),
+    TW(-0.4303264813400827, -0.9026733182372588), TW(0.7807372285720945, -0.6248594881423863),
+    TW(0.21910124015686977, -0.9757021300385286), TW(-0.4386162385385274, -0.8986744656939539),
+    TW(0.778816512381476, -0.6272518154951441), TW(0.21311031991609136, -0.9770281426577544),
+    TW(-0.446868840162374, -0.8945994856313828), TW(0.7768884656732324, -0.629638238914927),
+    TW(0.20711137619221856, -0.9783173707196277), TW(-0.4550835871263437, -0.890448723244758),
+    TW(0.7749531065948739, -0.6320187359398091), TW(0.20110463484209196, -0.9795697656854405),
+    TW(-0.46325978355186015, -0.8862225301488806), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7710605242618138, -0.6367618612362842), TW(0.18906866414980628, -0.9819638691095552),
+    TW(-0.4794937576601531, -0.8775452902072612), TW(0.7691033376455797, -0.6391244448637757),
+    TW(0.18303988795514106, -0.9831054874312163), TW(-0.4875501601484357, -0.8730949784182902),
+    TW(0.7671389119358204, -0.6414810128085832), TW(0.17700422041214886, -0.984210092386929),
+    TW(-0.4955652618257724, -0.868570705971341), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.17096188876030136, -0.9852776423889412), TW(-0.5035383837257175, -0.8639728561215868),
+    TW(0.7631884172633813, -0.6461760129833163), TW(0.1649131204899701, -0.9863080972445987),
+    TW(-0.5114688504379704, -0.8593018183570084), TW(0.7612023854842618, -0.6485144010221124),
+    TW(0.1588581433338614, -0.9873014181578584), TW(-0.5193559901655896, -0.8545579883654005),
+    TW(0.7592091889783881, -0.6508466849963809), TW(0.1527971852584434, -0.9882575677307495),
+    TW(-0.5271991347819011, -0.8497417680008527), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.534997619887097, -0.8448535652497072),
+    TW(0.7552013768965365, -0.6554928529996153), TW(0.14065823933284924, -0.9900582102622971),
+    TW(-0.5427507848645158, -0.8398937941959996), TW(0.7531867990436125, -0.6578066932970786),
+    TW(0.13458070850712622, -0.99090263542778), TW(-0.5504579729366047, -0.8348628749863801),
+    TW(0.7511651319096865, -0.6601143420674205), TW(0.12849811079379322, -0.9917097536690995),
+    TW(-0.5581185312205561, -0.829761233794523), TW(0.7491363945234594, -0.6624157775901718),
+    TW(0.12241067519921628, -0.99247953459871), TW(-0.5657318107836132, -0.8245893027850252),
+    TW(0.7471006059801801, -0.6647109782033448), TW(0.11631863091190488, -0.9932119492347945),
+    TW(-0.573297166698042, -0.8193475200767971), TW(0.7450577854414661, -0.6669999223036375),
+    TW(0.11022220729388318, -0.9939069700023561), TW(-0.5808139580957644, -0.8140363297059485),
+    TW(0.7430079521351217, -0.669282588346636), TW(0.10412163387205473, -0.9945645707342554),
+    TW(-0.5882815482226452, -0.8086561815881751), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.7388873244606151, -0.673829000378756), TW(0.0919089564971327, -0.9957674144676598),
+    TW(-0.6030665985403483, -0.797690840943391), TW(0.7368165688773699, -0.6760927035753159),
+    TW(0.08579731234443988, -0.996312612182778), TW(-0.6103828062763096, -0.7921065773002123),
+    TW(0.7347388780959635, -0.6783500431298615), TW(0.07968243797143013, -0.9968202992911657),
+    TW(-0.6176473079378038, -0.7864552135990859), TW(0.7326542716724128, -0.680600997795453),
+    TW(0.07356456359966745, -0.9972904566786902), TW(-0.6248594881423862, -0.7807372285720946),
+    TW(0.7305627692278276, -0.6828455463852481), TW(0.0674439195636641, -0.9977230666441916),
+    TW(-0.632018735939809, -0.7749531065948739), TW(0.7284643904482252, -0.6850836677727004),
+    TW(0.06132073630220865, -0.9981181129001492), TW(-0.6391244448637757, -0.7691033376455796),
+    TW(0.726359155084346, -0.687315340891759), TW(0.05519524434969003, -0.9984755805732948),
+    TW(-0.6461760129833164, -0.7631884172633813), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(0.7221281939292153, -0.6917592583641577), TW(0.04293825693494096, -0.9990777277526454),
+    TW(-0.6601143420674204, -0.7511651319096866), TW(0.7200025079613817, -0.693971460889654),
+    TW(0.03680722294135899, -0.9993223845883495), TW(-0.6669999223036374, -0.7450577854414661),
+    TW(0.7178700450557317, -0.696177131491463), TW(0.03067480317663658, -0.9995294175010931),
+    TW(-0.673829000378756, -0.7388873244606152), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.024541228522912264, -0.9996988186962042), TW(-0.680600997795453, -0.7326542716724128),
+    TW(0.7135848687807936, -0.7005687939432483), TW(0.01840672990580482, -0.9998305817958234),
+    TW(-0.6873153408917592, -0.7263591550843459), TW(0.7114321957452164, -0.7027547444572253),
+    TW(0.012271538285719944, -0.9999247018391445), TW(-0.6939714608896538, -0.7200025079613818),
+    TW(0.7092728264388657, -0.7049340803759049), TW(0.006135884649154515, -0.9999811752826011),
+    TW(-0.7005687939432482, -0.7135848687807937), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.704934080375905, -0.7092728264388656), TW(-0.006135884649154393, -0.9999811752826011),
+    TW(-0.7135848687807936, -0.7005687939432483), TW(0.7027547444572253, -0.7114321957452164),
+    TW(-0.012271538285719823, -0.9999247018391445), TW(-0.7200025079613817, -0.693971460889654),
+    TW(0.7005687939432484, -0.7135848687807935), TW(-0.018406729905804695, -0.9998305817958234),
+    TW(-0.7263591550843458, -0.6873153408917593), TW(0.6983762494089729, -0.7157308252838186),
+    TW(-0.024541228522912142, -0.9996988186962042), TW(-0.7326542716724127, -0.6806009977954532),
+    TW(0.696177131491463, -0.7178700450557317), TW(-0.03067480317663646, -0.9995294175010931),
+    TW(-0.738887324460615, -0.6738290003787561), TW(0.693971460889654, -0.7200025079613817),
+    TW(-0.036807222941358866, -0.9993223845883495), TW(-0.745057785441466, -0.6669999223036376),
+    TW(0.6917592583641577, -0.7221281939292153), TW(-0.042938256934940834, -0.9990777277526454),
+    TW(-0.7511651319096865, -0.6601143420674205), TW(0.6895405447370669, -0.7242470829514669),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(0.6873153408917592, -0.726359155084346), TW(-0.05519524434968991, -0.9984755805732948),
+    TW(-0.763188417263381, -0.6461760129833166), TW(0.6850836677727004, -0.7284643904482252),
+    TW(-0.06132073630220853, -0.9981181129001492), TW(-0.7691033376455795, -0.6391244448637758),
+    TW(0.6828455463852481, -0.7305627692278276), TW(-0.06744391956366398, -0.9977230666441916),
+    TW(-0.7749531065948738, -0.6320187359398091), TW(0.6806009977954531, -0.7326542716724128),
+    TW(-0.07356456359966733, -0.9972904566786902), TW(-0.7807372285720945, -0.6248594881423863),
+    TW(0.6783500431298616, -0.7347388780959634), TW(-0.07968243797143001, -0.9968202992911658),
+    TW(-0.7864552135990858, -0.6176473079378039), TW(0.676092703575316, -0.7368165688773698),
+    TW(-0.08579731234443976, -0.996312612182778), TW(-0.7921065773002122, -0.6103828062763097),
+    TW(0.6738290003787561, -0.7388873244606151), TW(-0.09190895649713257, -0.9957674144676598),
+    TW(-0.7976908409433909, -0.6030665985403484), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.669282588346636, -0.7430079521351217), TW(-0.1041216338720546, -0.9945645707342554),
+    TW(-0.808656181588175, -0.5882815482226453), TW(0.6669999223036375, -0.745057785441466),
+    TW(-0.11022220729388306, -0.9939069700023561), TW(-0.8140363297059484, -0.5808139580957645),
+    TW(0.6647109782033449, -0.7471006059801801), TW(-0.11631863091190475, -0.9932119492347945),
+    TW(-0.819347520076797, -0.5732971666980421), TW(0.6624157775901718, -0.7491363945234593),
+    TW(-0.12241067519921615, -0.99247953459871), TW(-0.8245893027850251, -0.5657318107836135),
+    TW(0.6601143420674205, -0.7511651319096864), TW(-0.1284981107937931, -0.9917097536690995),
+    TW(-0.8297612337945229, -0.5581185312205563), TW(0.6578066932970786, -0.7531867990436124),
+    TW(-0.1345807085071261, -0.99090263542778), TW(-0.83486287498638, -0.5504579729366049),
+    TW(0.6554928529996155, -0.7552013768965365), TW(-0.14065823933284913, -0.9900582102622971),
+    TW(-0.8398937941959995, -0.5427507848645159), TW(0.6531728429537768, -0.7572088465064845),
+    TW(-0.14673047445536164, -0.989176509964781), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(0.650846684996381, -0.759209188978388), TW(-0.1527971852584433, -0.9882575677307495),
+    TW(-0.8497417680008525, -0.5271991347819013), TW(0.6485144010221126, -0.7612023854842618),
+    TW(-0.15885814333386128, -0.9873014181578584), TW(-0.8545579883654004, -0.5193559901655898),
+    TW(0.6461760129833164, -0.7631884172633813), TW(-0.16491312048996995, -0.9863080972445987),
+    TW(-0.8593018183570084, -0.5114688504379705), TW(0.6438315428897915, -0.765167265622459),
+    TW(-0.17096188876030124, -0.9852776423889412), TW(-0.8639728561215867, -0.5035383837257177),
+    TW(0.6414810128085832, -0.7671389119358204), TW(-0.17700422041214875, -0.984210092386929),
+    TW(-0.8685707059713409, -0.49556526182577254), TW(0.6391244448637757, -0.7691033376455796),
+    TW(-0.18303988795514092, -0.9831054874312163), TW(-0.8730949784182901, -0.4875501601484359),
+    TW(0.6367618612362842, -0.7710605242618137), TW(-0.18906866414980616, -0.9819638691095552),
+    TW(-0.8775452902072611, -0.4794937576601533), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6320187359398091, -0.7749531065948738), TW(-0.20110463484209182, -0.9795697656854405),
+    TW(-0.8862225301488805, -0.4632597835518603), TW(0.6296382389149271, -0.7768884656732324),
+    TW(-0.20711137619221845, -0.9783173707196277), TW(-0.8904487232447579, -0.4550835871263439),
+    TW(0.6272518154951442, -0.7788165123814759), TW(-0.21311031991609125, -0.9770281426577544),
+    TW(-0.8945994856313827, -0.44686884016237416), TW(0.6248594881423865, -0.7807372285720944),
+    TW(-0.21910124015686966, -0.9757021300385286), TW(-0.8986744656939539, -0.43861623853852755),
+    TW(0.6224612793741501, -0.7826505961665757), TW(-0.22508391135979267, -0.9743393827855759),
+    TW(-0.9026733182372587, -0.4303264813400829), TW(0.6200572117632892, -0.7845565971555752),
+    TW(-0.23105810828067114, -0.9729399522055602), TW(-0.9065957045149153, -0.42200027079979985),
+    TW(0.617647307937804, -0.7864552135990858), TW(-0.23702360599436723, -0.9715038909862518),
+    TW(-0.9104412922580671, -0.4136383122384346), TW(0.6152315905806268, -0.7883464276266062),
+    TW(-0.24298017990326387, -0.970031253194544), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(0.6128100824294097, -0.79023022143731), TW(-0.24892760574572012, -0.9685220942744174),
+    TW(-0.9179007756213905, -0.39680998741671025), TW(0.6103828062763095, -0.7921065773002124),
+    TW(-0.2548656596045145, -0.9669764710448521), TW(-0.9215140393420418, -0.3883450466988266),
+    TW(0.6079497849677737, -0.7939754775543372), TW(-0.26079411791527546, -0.9653944416976894),
+    TW(-0.9250492407826775, -0.3798472089240514), TW(0.6055110414043255, -0.7958369046088835),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(-0.9285060804732155, -0.3713171939518377),
+    TW(0.6030665985403483, -0.797690840943391), TW(-0.27262135544994887, -0.9621214042690416),
+    TW(-0.931884265581668, -0.3627557243673973), TW(0.600616479383869, -0.799537269107905),
+    TW(-0.27851968938505295, -0.9604305194155659), TW(-0.9351835099389476, -0.3541635254204904),
+    TW(0.5981607069963424, -0.8013761717231401), TW(-0.2844075372112717, -0.9587034748958716),
+    TW(-0.9384035340631082, -0.345541324963989), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5932322950397998, -0.8050313311429637), TW(-0.29615088824362384, -0.9551411683057707),
+    TW(-0.9446048372614801, -0.3282098435790927), TW(0.5907597018588743, -0.8068475535437992),
+    TW(-0.3020059493192281, -0.9533060403541939), TW(-0.9475855910177411, -0.3195020308160158),
+    TW(0.5882815482226453, -0.808656181588175), TW(-0.30784964004153487, -0.9514350209690083),
+    TW(-0.9504860739494817, -0.31076715274961153), TW(0.5857978574564389, -0.8104571982525948),
+    TW(-0.3136817403988914, -0.9495281805930367), TW(-0.9533060403541939, -0.30200594931922803),
+    TW(0.5833086529376983, -0.8122505865852039), TW(-0.31950203081601564, -0.9475855910177412),
+    TW(-0.9560452513499963, -0.29321916269425896), TW(0.5808139580957645, -0.8140363297059483),
+    TW(-0.32531029216226287, -0.9456073253805214), TW(-0.9587034748958715, -0.2844075372112721),
+    TW(0.5783137964116556, -0.8158144108067338), TW(-0.3311063057598763, -0.9435934581619604),
+    TW(-0.9612804858113206, -0.2755718193109583), TW(0.5758081914178453, -0.8175848131515837),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(0.5732971666980423, -0.8193475200767969), TW(-0.34266071731199427, -0.9394592236021899),
+    TW(-0.9661900034454125, -0.257831102162159), TW(0.5707807458869674, -0.8211025149911046),
+    TW(-0.3484186802494344, -0.937339011912575), TW(-0.9685220942744174, -0.2489276057457201),
+    TW(0.5682589526701315, -0.8228497813758263), TW(-0.3541635254204904, -0.9351835099389476),
+    TW(-0.9707721407289502, -0.24000302244874178), TW(0.5657318107836132, -0.8245893027850253),
+    TW(-0.35989503653498817, -0.9329927988347388), TW(-0.9729399522055601, -0.23105810828067133),
+    TW(0.5631993440138341, -0.8263210628456634), TW(-0.36561299780477385, -0.9307669610789837),
+    TW(-0.9750253450669941, -0.22209362097320365), TW(0.560661576197336, -0.8280450452577558),
+    TW(-0.3713171939518375, -0.9285060804732156), TW(-0.9770281426577544, -0.21311031991609142),
+    TW(0.5581185312205561, -0.829761233794523), TW(-0.3770074102164182, -0.9262102421383114),
+    TW(-0.9789481753190622, -0.20410896609281684), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5530167055800276, -0.8331701647019132), TW(-0.3883450466988262, -0.921514039342042),
+    TW(-0.9825393022874412, -0.1860551516634469), TW(0.5504579729366048, -0.83486287498638),
+    TW(-0.393992040061048, -0.9191138516900578), TW(-0.984210092386929, -0.17700422041214894),
+    TW(0.5478940591731002, -0.8365477272235119), TW(-0.3996241998456467, -0.9166790599210427),
+    TW(-0.9857975091675674, -0.16793829497473128), TW(0.5453249884220465, -0.838224705554838),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(-0.9873014181578584, -0.15885814333386147),
+    TW(0.542750784864516, -0.8398937941959994), TW(-0.4108431710579038, -0.9117060320054299),
+    TW(-0.9887216919603238, -0.14976453467732145), TW(0.540171472729893, -0.8415549774368983),
+    TW(-0.416429560097637, -0.9091679830905225), TW(-0.990058210262297, -0.14065823933284954),
+    TW(0.5375870762956455, -0.8432082396418454), TW(-0.4220002707997997, -0.9065957045149153),
+    TW(-0.9913108598461154, -0.13154002870288334), TW(0.5349976198870973, -0.844853565249707),
+    TW(-0.42755509343028186, -0.9039892931234434), TW(-0.99247953459871, -0.12241067519921635),
+    TW(0.532403127877198, -0.846490938774052), TW(-0.4330938188531519, -0.901348847046022),
+    TW(-0.9935641355205953, -0.11327095217756442), TW(0.5298036246862948, -0.8481203448032971),
+    TW(-0.4386162385385274, -0.8986744656939539), TW(-0.9945645707342554, -0.10412163387205457),
+    TW(0.5271991347819014, -0.8497417680008524), TW(-0.44412214457042914, -0.8959662497561852),
+    TW(-0.9954807554919269, -0.09496349532963891), TW(0.5245896826784688, -0.8513551931052652),
+    TW(-0.4496113296546067, -0.8932243011955152), TW(-0.996312612182778, -0.08579731234444016),
+    TW(0.5219752929371544, -0.8529606049303636), TW(-0.4550835871263437, -0.890448723244758),
+    TW(-0.997060070339483, -0.07662386139203169), TW(0.5193559901655895, -0.8545579883654005),
+    TW(-0.46053871095824006, -0.8876396204028539), TW(-0.9977230666441916, -0.06744391956366418),
+    TW(0.51673179901765, -0.8561473283751945), TW(-0.465976495767966, -0.8847970984309379),
+    TW(-0.9983015449338929, -0.058258264500435794), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.5114688504379705, -0.8593018183570084), TW(-0.4767992300633219, -0.8790122264286335),
+    TW(-0.9992047586183639, -0.03987292758774013), TW(0.508830142543107, -0.8608669386377673),
+    TW(-0.4821837720791227, -0.8760700941954066), TW(-0.9995294175010931, -0.030674803176636865),
+    TW(0.5061866453451555, -0.8624239561110405), TW(-0.4875501601484357, -0.8730949784182902),
+    TW(-0.9997694053512153, -0.021474080275469667), TW(0.5035383837257176, -0.8639728561215867),
+    TW(-0.492898192229784, -0.8700869911087115), TW(-0.9999247018391445, -0.012271538285720007),
+    TW(0.5008853826112409, -0.865513624090569), TW(-0.4982276669727816, -0.8670462455156928),
+    TW(-0.9999952938095762, -0.003067956762965977), TW(0.49822766697278187, -0.8670462455156926),
+    TW(-0.5035383837257175, -0.8639728561215868), TW(-0.9999811752826011, 0.006135884649154554),
+    TW(0.4955652618257725, -0.8685707059713409), TW(-0.5088301425431071, -0.8608669386377672),
+    TW(-0.9998823474542126, 0.015339206284987816), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.5141027441932217, -0.8577286100002721), TW(-0.9996988186962042, 0.02454122852291208),
+    TW(0.4902264832882911, -0.8715950866559511), TW(-0.5193559901655896, -0.8545579883654005),
+    TW(-0.9994306045554617, 0.033741171851377455), TW(0.48755016014843605, -0.8730949784182901),
+    TW(-0.5245896826784687, -0.8513551931052652), TW(-0.9990777277526454, 0.04293825693494078),
+    TW(0.4848692480007911, -0.8745866522781761), TW(-0.5298036246862947, -0.8481203448032972),
+    TW(-0.9986402181802653, 0.05213170468028335), TW(0.48218377207912283, -0.8760700941954066),
+    TW(-0.534997619887097, -0.8448535652497072), TW(-0.9981181129001492, 0.061320736302208245),
+    TW(0.479493757660153, -0.8775452902072612), TW(-0.5401714727298929, -0.8415549774368984),
+    TW(-0.9975114561403035, 0.0705045733896136), TW(0.47679923006332225, -0.8790122264286334),
+    TW(-0.5453249884220462, -0.8382247055548382), TW(-0.9968202992911658, 0.07968243797142995),
+    TW(0.47410021465055, -0.8804708890521608), TW(-0.5504579729366047, -0.8348628749863801),
+    TW(-0.996044700901252, 0.0888535525825245), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.46868882203582796, -0.8833633386657316), TW(-0.5606615761973359, -0.8280450452577558),
+    TW(-0.9942404494531879, 0.10717242495680891), TW(0.4659764957679661, -0.8847970984309378),
+    TW(-0.5657318107836132, -0.8245893027850252), TW(-0.9932119492347946, 0.11631863091190447),
+    TW(0.46325978355186026, -0.8862225301488806), TW(-0.5707807458869671, -0.8211025149911048),
+    TW(-0.9920993131421918, 0.125454983411546), TW(0.46053871095824, -0.8876396204028539),
+    TW(-0.5758081914178453, -0.8175848131515837), TW(-0.99090263542778, 0.13458070850712606),
+    TW(0.4578133035988773, -0.8890483558546646), TW(-0.5808139580957644, -0.8140363297059485),
+    TW(-0.9896220174632009, 0.1436950331502944), TW(0.45508358712634384, -0.8904487232447579),
+    TW(-0.5857978574564389, -0.8104571982525948), TW(-0.9882575677307495, 0.15279718525844344),
+    TW(0.452349587233771, -0.8918407093923427), TW(-0.590759701858874, -0.8068475535437994),
+    TW(-0.9868094018141855, 0.1618863937801115), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(-0.9852776423889413, 0.17096188876030097),
+    TW(0.4468688401623743, -0.8945994856313826), TW(-0.6006164793838688, -0.7995372691079052),
+    TW(-0.9836624192117303, 0.18002290140569935), TW(0.44412214457042926, -0.8959662497561851),
+    TW(-0.6055110414043254, -0.7958369046088836), TW(-0.9819638691095552, 0.1890686641498061),
+    TW(0.4413712687317166, -0.8973245807054183), TW(-0.6103828062763096, -0.7921065773002123),
+    TW(-0.9801821359681174, 0.19809841071795356), TW(0.4386162385385277, -0.8986744656939538),
+    TW(-0.6152315905806267, -0.7883464276266063), TW(-0.9783173707196277, 0.2071113761922186),
+    TW(0.4358570799222555, -0.9000158920161603), TW(-0.6200572117632892, -0.7845565971555751),
+    TW(-0.9763697313300213, 0.21610679707621921), TW(0.433093818853152, -0.901348847046022),
+    TW(-0.6248594881423862, -0.7807372285720946), TW(-0.9743393827855759, 0.2250839113597926),
+    TW(0.4303264813400826, -0.9026733182372588), TW(-0.6296382389149271, -0.7768884656732324),
+    TW(-0.9722264970789364, 0.23404195858354326), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.4247796812091088, -0.9052967593181188), TW(-0.6391244448637757, -0.7691033376455796),
+    TW(-0.9677538370934755, 0.25189781815421697), TW(0.4220002707997998, -0.9065957045149153),
+    TW(-0.6438315428897913, -0.7651672656224591), TW(-0.9653944416976894, 0.2607941179152756),
+    TW(0.41921688836322396, -0.9078861164876662), TW(-0.6485144010221124, -0.7612023854842619),
+    TW(-0.962953266873684, 0.2696683255729148), TW(0.4164295600976373, -0.9091679830905223),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(-0.9604305194155659, 0.2785196893850529),
+    TW(0.41363831223843456, -0.9104412922580671), TW(-0.6578066932970786, -0.7531867990436125),
+    TW(-0.9578264130275329, 0.2873474595447294), TW(0.4108431710579039, -0.9117060320054299),
+    TW(-0.6624157775901719, -0.7491363945234593), TW(-0.9551411683057708, 0.2961508882436238),
+    TW(0.40804416286497874, -0.9129621904283981), TW(-0.6669999223036374, -0.7450577854414661),
+    TW(-0.9523750127197659, 0.30492922973540243), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.6715589548470184, -0.740951125354959), TW(-0.9495281805930368, 0.3136817403988912),
+    TW(0.40243465085941854, -0.9154487160882678), TW(-0.6760927035753158, -0.73681656887737),
+    TW(-0.9466009130832836, 0.32240767880106963), TW(0.3996241998456468, -0.9166790599210427),
+    TW(-0.680600997795453, -0.7326542716724128), TW(-0.9435934581619604, 0.33110630575987626),
+    TW(0.3968099874167104, -0.9179007756213904), TW(-0.6850836677727002, -0.7284643904482253),
+    TW(-0.9405060705932684, 0.3397768844068268), TW(0.3939920400610481, -0.9191138516900578),
+    TW(-0.6895405447370669, -0.7242470829514669), TW(-0.937339011912575, 0.34841868024943456),
+    TW(0.391170384302254, -0.9203182767091105), TW(-0.6939714608896538, -0.7200025079613818),
+    TW(-0.9340925504042589, 0.3570309612334301), TW(0.3883450466988263, -0.9215140393420419),
+    TW(-0.6983762494089728, -0.7157308252838187), TW(-0.9307669610789838, 0.3656129978047736),
+    TW(0.385516053843919, -0.9227011283338785), TW(-0.7027547444572251, -0.7114321957452167),
+    TW(-0.9273625256504011, 0.3741640629714578), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3798472089240511, -0.9250492407826776), TW(-0.7114321957452165, -0.7027547444572252),
+    TW(-0.9203182767091106, 0.3911703843022538), TW(0.3770074102164183, -0.9262102421383113),
+    TW(-0.7157308252838186, -0.6983762494089729), TW(-0.9166790599210427, 0.39962419984564684),
+    TW(0.374164062971458, -0.9273625256504011), TW(-0.7200025079613817, -0.693971460889654),
+    TW(-0.9129621904283983, 0.40804416286497835), TW(0.3713171939518376, -0.9285060804732155),
+    TW(-0.7242470829514668, -0.689540544737067), TW(-0.9091679830905225, 0.41642956009763693),
+    TW(0.3684668299533723, -0.9296408958431813), TW(-0.7284643904482252, -0.6850836677727004),
+    TW(-0.9052967593181188, 0.42477968120910864), TW(0.36561299780477396, -0.9307669610789837),
+    TW(-0.7326542716724127, -0.6806009977954532), TW(-0.901348847046022, 0.43309381885315185),
+    TW(0.3627557243673972, -0.9318842655816681), TW(-0.7368165688773699, -0.6760927035753159),
+    TW(-0.8973245807054183, 0.44137126873171667), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.7409511253549589, -0.6715589548470186), TW(-0.8932243011955153, 0.44961132965460665),
+    TW(0.35703096123343003, -0.9340925504042589), TW(-0.745057785441466, -0.6669999223036376),
+    TW(-0.8890483558546647, 0.45781330359887695), TW(0.3541635254204905, -0.9351835099389475),
+    TW(-0.7491363945234591, -0.662415777590172), TW(-0.8847970984309379, 0.46597649576796596),
+    TW(0.35129275608556715, -0.9362656671702783), TW(-0.7531867990436124, -0.6578066932970787),
+    TW(-0.8804708890521609, 0.47410021465054986), TW(0.3484186802494345, -0.937339011912575),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(-0.8760700941954066, 0.48218377207912266),
+    TW(0.34554132496398915, -0.9384035340631081), TW(-0.7612023854842617, -0.6485144010221126),
+    TW(-0.871595086655951, 0.49022648328829116), TW(0.3426607173119944, -0.9394592236021899),
+    TW(-0.765167265622459, -0.6438315428897914), TW(-0.8670462455156929, 0.49822766697278154),
+    TW(0.33977688440682696, -0.9405060705932683), TW(-0.7691033376455795, -0.6391244448637758),
+    TW(-0.8624239561110407, 0.506186645345155), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.3339996514420095, -0.9425731976014469), TW(-0.7768884656732323, -0.6296382389149272),
+    TW(-0.8529606049303637, 0.5219752929371543), TW(0.33110630575987643, -0.9435934581619604),
+    TW(-0.7807372285720945, -0.6248594881423863), TW(-0.8481203448032972, 0.5298036246862946),
+    TW(0.32820984357909266, -0.9446048372614803), TW(-0.784556597155575, -0.6200572117632894),
+    TW(-0.8432082396418454, 0.5375870762956455), TW(0.325310292162263, -0.9456073253805213),
+    TW(-0.7883464276266062, -0.6152315905806269), TW(-0.8382247055548382, 0.5453249884220461),
+    TW(0.32240767880107, -0.9466009130832835), TW(-0.7921065773002122, -0.6103828062763097),
+    TW(-0.8331701647019133, 0.5530167055800274), TW(0.31950203081601575, -0.9475855910177411),
+    TW(-0.7958369046088835, -0.6055110414043257), TW(-0.8280450452577558, 0.5606615761973359),
+    TW(0.31659337555616585, -0.9485613499157303), TW(-0.7995372691079051, -0.6006164793838689),
+    TW(-0.8228497813758264, 0.5682589526701315), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(-0.8175848131515837, 0.5758081914178453),
+    TW(0.3107671527496115, -0.9504860739494817), TW(-0.8068475535437993, -0.5907597018588742),
+    TW(-0.8122505865852039, 0.5833086529376984), TW(0.307849640041535, -0.9514350209690083),
+    TW(-0.8104571982525947, -0.585797857456439), TW(-0.8068475535437994, 0.5907597018588739),
+    TW(0.30492922973540243, -0.9523750127197659), TW(-0.8140363297059484, -0.5808139580957645),
+    TW(-0.8013761717231404, 0.5981607069963422), TW(0.3020059493192282, -0.9533060403541938),
+    TW(-0.8175848131515836, -0.5758081914178454), TW(-0.7958369046088836, 0.6055110414043254),
+    TW(0.2990798263080405, -0.9542280951091057), TW(-0.8211025149911046, -0.5707807458869673),
+    TW(-0.7902302214373101, 0.6128100824294097), TW(0.29615088824362396, -0.9551411683057707),
+    TW(-0.8245893027850251, -0.5657318107836135), TW(-0.7845565971555752, 0.6200572117632892),
+    TW(0.2932191626942587, -0.9560452513499964), TW(-0.8280450452577557, -0.5606615761973361),
+    TW(-0.7788165123814762, 0.6272518154951439), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.28734745954472957, -0.9578264130275329), TW(-0.83486287498638, -0.5504579729366049),
+    TW(-0.7671389119358205, 0.641481012808583), TW(0.2844075372112718, -0.9587034748958716),
+    TW(-0.8382247055548381, -0.5453249884220464), TW(-0.7612023854842619, 0.6485144010221123),
+    TW(0.28146493792575805, -0.9595715130819845), TW(-0.8415549774368983, -0.540171472729893),
+    TW(-0.7552013768965365, 0.6554928529996153), TW(0.27851968938505306, -0.9604305194155658),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(-0.7491363945234593, 0.6624157775901718),
+    TW(0.27557181931095825, -0.9612804858113206), TW(-0.8481203448032971, -0.5298036246862948),
+    TW(-0.7430079521351219, 0.6692825883466358), TW(0.272621355449949, -0.9621214042690416),
+    TW(-0.8513551931052652, -0.524589682678469), TW(-0.73681656887737, 0.6760927035753158),
+    TW(0.2696683255729152, -0.9629532668736839), TW(-0.8545579883654004, -0.5193559901655898),
+    TW(-0.7305627692278277, 0.682845546385248), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.857728610000272, -0.5141027441932218), TW(-0.724247082951467, 0.6895405447370668),
+    TW(0.2637546789748315, -0.9645897932898126), TW(-0.8608669386377671, -0.5088301425431073),
+    TW(-0.7178700450557317, 0.696177131491463), TW(0.26079411791527557, -0.9653944416976894),
+    TW(-0.8639728561215867, -0.5035383837257177), TW(-0.7114321957452167, 0.7027547444572251),
+    TW(0.25783110216215893, -0.9661900034454126), TW(-0.8670462455156928, -0.49822766697278176),
+    TW(-0.7049340803759051, 0.7092728264388655), TW(0.2548656596045146, -0.9669764710448521),
+    TW(-0.8700869911087113, -0.49289819222978415), TW(-0.698376249408973, 0.7157308252838185),
+    TW(0.2518978181542169, -0.9677538370934755), TW(-0.8730949784182901, -0.4875501601484359),
+    TW(-0.6917592583641579, 0.7221281939292152), TW(0.24892760574572026, -0.9685220942744173),
+    TW(-0.8760700941954065, -0.4821837720791229), TW(-0.6850836677727004, 0.7284643904482252),
+    TW(0.2459550503357946, -0.9692812353565485), TW(-0.8790122264286335, -0.4767992300633221),
+    TW(-0.6783500431298615, 0.7347388780959635), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.2400030224487415, -0.9707721407289504), TW(-0.8847970984309378, -0.4659764957679662),
+    TW(-0.664710978203345, 0.74710060598018), TW(0.23702360599436734, -0.9715038909862518),
+    TW(-0.8876396204028538, -0.4605387109582402), TW(-0.6578066932970787, 0.7531867990436124),
+    TW(0.23404195858354346, -0.9722264970789363), TW(-0.8904487232447579, -0.4550835871263439),
+    TW(-0.650846684996381, 0.759209188978388), TW(0.23105810828067128, -0.9729399522055601),
+    TW(-0.8932243011955152, -0.4496113296546069), TW(-0.6438315428897915, 0.765167265622459),
+    TW(0.2280720831708858, -0.9736442496508119), TW(-0.8959662497561851, -0.4441221445704293),
+    TW(-0.6367618612362842, 0.7710605242618138), TW(0.22508391135979278, -0.9743393827855759),
+    TW(-0.8986744656939539, -0.43861623853852755), TW(-0.6296382389149269, 0.7768884656732326),
+    TW(0.2220936209732036, -0.9750253450669941), TW(-0.9013488470460219, -0.43309381885315207),
+    TW(-0.6224612793741497, 0.7826505961665758), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.9039892931234433, -0.42755509343028203), TW(-0.6152315905806273, 0.7883464276266059),
+    TW(0.2161067970762196, -0.9763697313300211), TW(-0.9065957045149153, -0.42200027079979985),
+    TW(-0.6079497849677741, 0.7939754775543368), TW(0.21311031991609136, -0.9770281426577544),
+    TW(-0.9091679830905224, -0.41642956009763715), TW(-0.6006164793838693, 0.7995372691079048),
+    TW(0.21011183688046972, -0.9776773578245099), TW(-0.9117060320054298, -0.41084317105790413),
+    TW(-0.5932322950398001, 0.8050313311429634), TW(0.20711137619221856, -0.9783173707196277),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(-0.5857978574564391, 0.8104571982525947),
+    TW(0.204108966092817, -0.9789481753190622), TW(-0.9166790599210426, -0.39962419984564707),
+    TW(-0.5783137964116557, 0.8158144108067337), TW(0.20110463484209196, -0.9795697656854405),
+    TW(-0.9191138516900578, -0.39399204006104815), TW(-0.5707807458869674, 0.8211025149911046),
+    TW(0.19809841071795373, -0.9801821359681173), TW(-0.9215140393420418, -0.3883450466988266),
+    TW(-0.5631993440138341, 0.8263210628456634), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.19208039704989238, -0.9813791933137546), TW(-0.9262102421383114, -0.37700741021641815),
+    TW(-0.5478940591731001, 0.8365477272235121), TW(0.18906866414980628, -0.9819638691095552),
+    TW(-0.9285060804732155, -0.3713171939518377), TW(-0.5401714727298927, 0.8415549774368986),
+    TW(0.18605515166344663, -0.9825393022874412), TW(-0.9307669610789837, -0.3656129978047738),
+    TW(-0.5324031278771985, 0.8464909387740518), TW(0.18303988795514106, -0.9831054874312163),
+    TW(-0.9329927988347388, -0.35989503653498833), TW(-0.5245896826784694, 0.8513551931052649),
+    TW(0.18002290140569951, -0.9836624192117303), TW(-0.9351835099389476, -0.3541635254204904),
+    TW(-0.5167317990176502, 0.8561473283751942), TW(0.17700422041214886, -0.984210092386929),
+    TW(-0.9373390119125748, -0.3484186802494348), TW(-0.5088301425431073, 0.8608669386377671),
+    TW(0.17398387338746385, -0.9847485018019042), TW(-0.9394592236021899, -0.34266071731199443),
+    TW(-0.500885382611241, 0.865513624090569), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(-0.4928981922297842, 0.8700869911087113),
+    TW(0.16793829497473123, -0.9857975091675674), TW(-0.9435934581619604, -0.3311063057598765),
+    TW(-0.4848692480007912, 0.8745866522781761), TW(0.1649131204899701, -0.9863080972445987),
+    TW(-0.9456073253805212, -0.32531029216226326), TW(-0.47679923006332214, 0.8790122264286334),
+    TW(0.16188639378011188, -0.9868094018141854), TW(-0.9475855910177411, -0.3195020308160158),
+    TW(-0.4686888220358279, 0.8833633386657316), TW(0.1588581433338614, -0.9873014181578584),
+    TW(-0.9495281805930367, -0.3136817403988914), TW(-0.4605387109582399, 0.887639620402854),
+    TW(0.15582839765426532, -0.9877841416445722), TW(-0.9514350209690083, -0.30784964004153503),
+    TW(-0.45234958723377067, 0.8918407093923428), TW(0.1527971852584434, -0.9882575677307495),
+    TW(-0.9533060403541939, -0.30200594931922803), TW(-0.44412214457042976, 0.8959662497561849),
+    TW(0.14976453467732162, -0.9887216919603238), TW(-0.9551411683057707, -0.296150888243624),
+    TW(-0.435857079922256, 0.90001589201616), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.14369503315029458, -0.9896220174632008), TW(-0.9587034748958715, -0.2844075372112721),
+    TW(-0.4192168883632243, 0.907886116487666), TW(0.14065823933284924, -0.9900582102622971),
+    TW(-0.9604305194155658, -0.27851968938505317), TW(-0.4108431710579042, 0.9117060320054298),
+    TW(0.13762012158648618, -0.990485084256457), TW(-0.9621214042690415, -0.27262135544994925),
+    TW(-0.40243465085941865, 0.9154487160882677), TW(0.13458070850712622, -0.99090263542778),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(-0.3939920400610482, 0.9191138516900577),
+    TW(0.13154002870288328, -0.9913108598461154), TW(-0.9653944416976893, -0.26079411791527585),
+    TW(-0.3855160538439189, 0.9227011283338785), TW(0.12849811079379322, -0.9917097536690995),
+    TW(-0.9669764710448521, -0.2548656596045147), TW(-0.3770074102164182, 0.9262102421383114),
+    TW(0.1254549834115462, -0.9920993131421918), TW(-0.9685220942744174, -0.2489276057457201),
+    TW(-0.3684668299533722, 0.9296408958431813), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.970031253194544, -0.24298017990326407), TW(-0.35989503653498794, 0.932992798834739),
+    TW(0.11936521481099135, -0.9928504144598651), TW(-0.9715038909862518, -0.23702360599436717),
+    TW(-0.35129275608556687, 0.9362656671702784), TW(0.11631863091190488, -0.9932119492347945),
+    TW(-0.9729399522055601, -0.23105810828067133), TW(-0.3426607173119949, 0.9394592236021897),
+    TW(0.11327095217756436, -0.9935641355205953), TW(-0.9743393827855759, -0.22508391135979283),
+    TW(-0.3339996514420098, 0.9425731976014468), TW(0.11022220729388318, -0.9939069700023561),
+    TW(-0.9757021300385285, -0.21910124015687005), TW(-0.3253102921622633, 0.9456073253805212),
+    TW(0.10717242495680887, -0.9942404494531879), TW(-0.9770281426577544, -0.21311031991609142),
+    TW(-0.3165933755561662, 0.9485613499157302), TW(0.10412163387205473, -0.9945645707342554),
+    TW(-0.9783173707196275, -0.20711137619221884), TW(-0.3078496400415351, 0.9514350209690083),
+    TW(0.10106986275482788, -0.9948793307948056), TW(-0.9795697656854405, -0.201104634842092),
+    TW(-0.2990798263080406, 0.9542280951091056), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.09496349532963906, -0.9954807554919269), TW(-0.9819638691095552, -0.18906866414980636),
+    TW(-0.28146493792575794, 0.9595715130819845), TW(0.0919089564971327, -0.9957674144676598),
+    TW(-0.9831054874312163, -0.1830398879551409), TW(-0.27262135544994887, 0.9621214042690416),
+    TW(0.08885355258252468, -0.996044700901252), TW(-0.984210092386929, -0.17700422041214894),
+    TW(-0.26375467897483124, 0.9645897932898128), TW(0.08579731234443988, -0.996312612182778),
+    TW(-0.9852776423889412, -0.17096188876030122), TW(-0.25486565960451435, 0.9669764710448522),
+    TW(0.0827402645493758, -0.9965711457905548), TW(-0.9863080972445986, -0.16491312048997014),
+    TW(-0.24595505033579515, 0.9692812353565483), TW(0.07968243797143013, -0.9968202992911657),
+    TW(-0.9873014181578584, -0.15885814333386147), TW(-0.23702360599436767, 0.9715038909862517),
+    TW(0.07662386139203162, -0.997060070339483), TW(-0.9882575677307495, -0.15279718525844369),
+    TW(-0.22807208317088612, 0.9736442496508119), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.989176509964781, -0.1467304744553618), TW(-0.2191012401568701, 0.9757021300385285),
+    TW(0.07050457338961401, -0.9975114561403035), TW(-0.990058210262297, -0.14065823933284954),
+    TW(-0.21011183688046986, 0.9776773578245099), TW(0.0674439195636641, -0.9977230666441916),
+    TW(-0.99090263542778, -0.13458070850712628), TW(-0.20110463484209207, 0.9795697656854405),
+    TW(0.06438263092985741, -0.997925286198596), TW(-0.9917097536690995, -0.12849811079379309),
+    TW(-0.19208039704989252, 0.9813791933137546), TW(0.06132073630220865, -0.9981181129001492),
+    TW(-0.99247953459871, -0.12241067519921635), TW(-0.18303988795514095, 0.9831054874312163),
+    TW(0.05825826450043573, -0.9983015449338929), TW(-0.9932119492347945, -0.11631863091190471),
+    TW(-0.17398387338746374, 0.9847485018019042), TW(0.05519524434969003, -0.9984755805732948),
+    TW(-0.9939069700023561, -0.11022220729388324), TW(-0.16491312048996976, 0.9863080972445987),
+    TW(0.05213170468028332, -0.9986402181802653), TW(-0.9945645707342554, -0.10412163387205457),
+    TW(-0.15582839765426498, 0.9877841416445722), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.046003182130914644, -0.9989412931868569), TW(-0.9957674144676598, -0.09190895649713275),
+    TW(-0.13762012158648654, 0.990485084256457), TW(0.04293825693494096, -0.9990777277526454),
+    TW(-0.996312612182778, -0.08579731234444016), TW(-0.12849811079379359, 0.9917097536690995),
+    TW(0.039872927587739845, -0.9992047586183639), TW(-0.9968202992911657, -0.0796824379714302),
+    TW(-0.11936521481099169, 0.9928504144598651), TW(0.03680722294135899, -0.9993223845883495),
+    TW(-0.9972904566786902, -0.07356456359966773), TW(-0.11022220729388331, 0.9939069700023561),
+    TW(0.03374117185137764, -0.9994306045554617), TW(-0.9977230666441916, -0.06744391956366418),
+    TW(-0.10106986275482799, 0.9948793307948056), TW(0.03067480317663658, -0.9995294175010931),
+    TW(-0.9981181129001492, -0.06132073630220849), TW(-0.09190895649713282, 0.9957674144676598),
+    TW(0.02760814577896582, -0.9996188224951786), TW(-0.9984755805732948, -0.055195244349690094),
+    TW(-0.0827402645493757, 0.9965711457905548), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(-0.07356456359966736, 0.9972904566786902),
+    TW(0.021474080275469605, -0.9997694053512153), TW(-0.9990777277526454, -0.04293825693494102),
+    TW(-0.06438263092985731, 0.997925286198596), TW(0.01840672990580482, -0.9998305817958234),
+    TW(-0.9993223845883495, -0.03680722294135883), TW(-0.05519524434968971, 0.9984755805732948),
+    TW(0.01533920628498822, -0.9998823474542126), TW(-0.9995294175010931, -0.030674803176636865),
+    TW(-0.046003182130915206, 0.9989412931868569), TW(0.012271538285719944, -0.9999247018391445),
+    TW(-0.9996988186962042, -0.024541228522912326), TW(-0.03680722294135933, 0.9993223845883494),
+    TW(0.00920375478205996, -0.9999576445519639), TW(-0.9998305817958234, -0.0184067299058051),
+    TW(-0.027608145778966163, 0.9996188224951786), TW(0.006135884649154515, -0.9999811752826011),
+    TW(-0.9999247018391445, -0.012271538285720007), TW(-0.018406729905805164, 0.9998305817958234),
+    TW(0.003067956762966138, -0.9999952938095762), TW(-0.9999811752826011, -0.006135884649154799),
+    TW(-0.009203754782060083, 0.9999576445519639),
+};
+#endif
+
+static const kiss_fft_index swaps_8192[4032] = {
+    1, 1024, 2, 2048, 3, 3072, 4, 256, 5, 1280, 6, 2304, 7, 3328, 8, 512,
+    9, 1536, 10, 2560, 11, 3584, 12, 768, 13, 1792, 14, 2816, 15, 3840, 16, 64,
+    17, 1088, 18, 2112, 19, 3136, 20, 320, 21, 1344, 22, 2368, 23, 3392, 24, 576,
+    25, 1600, 26, 2624, 27, 3648, 28, 832, 29, 1856, 30, 2880, 31, 3904, 32, 128,
+    33, 1152, 34, 2176, 35, 3200, 36, 384, 37, 1408, 38, 2432, 39, 3456, 40, 640,
+    41, 1664, 42, 2688, 43, 3712, 44, 896, 45, 1920, 46, 2944, 47, 3968, 48, 192,
+    49, 1216, 50, 2240, 51, 3264, 52, 448, 53, 1472, 54, 2496, 55, 3520, 56, 704,
+    57, 1728, 58, 2752, 59, 3776, 60, 960, 61, 1984, 62, 3008, 63, 4032, 65, 1040,
+    66, 2064, 67, 3088, 68, 272, 69, 1296, 70, 2320, 71, 3344, 72, 528, 73, 1552,
+    74, 2576, 75, 3600, 76, 784, 77, 1808, 78, 2832, 79, 3856, 81, 1104, 82, 2128,
+    83, 3152, 84, 336, 85, 1360, 86, 2384, 87, 3408, 88, 592, 89, 1616, 90, 2640,
+    91, 3664, 92, 848, 93, 1872, 94, 2896, 95, 3920, 96, 144, 97, 1168, 98, 2192,
+    99, 3216, 100, 400, 101, 1424, 102, 2448, 103, 3472, 104, 656, 105, 1680, 106, 2704,
+    107, 3728, 108, 912, 109, 1936, 110, 2960, 111, 3984, 112, 208, 113, 1232, 114, 2256,
+    115, 3280, 116, 464, 117, 1488, 118, 2512, 119, 3536, 120, 720, 121, 1744, 122, 2768,
+    123, 3792, 124, 976, 125, 2000, 126, 3024, 127, 4048, 129, 1056, 130, 2080, 131, 3104,
+    132, 288, 133, 1312, 134, 2336, 135, 3360, 136, 544, 137, 1568, 138, 2592, 139, 3616,
+    140, 800, 141, 1824, 142, 2848, 143, 3872, 145, 1120, 146, 2144, 147, 3168, 148, 352,
+    149, 1376, 150, 2400, 151, 3424, 152, 608, 153, 1632, 154, 2656, 155, 3680, 156, 864,
+    157, 1888, 158, 2912, 159, 3936, 161, 1184, 162, 2208, 163, 3232, 164, 416, 165, 1440,
+    166, 2464, 167, 3488, 168, 672, 169, 1696, 170, 2720, 171, 3744, 172, 928, 173, 1952,
+    174, 2976, 175, 4000, 176, 224, 177, 1248, 178, 2272, 179, 3296, 180, 480, 181, 1504,
+    182, 2528, 183, 3552, 184, 736, 185, 1760, 186, 2784, 187, 3808, 188, 992, 189, 2016,
+    190, 3040, 191, 4064, 193, 1072, 194, 2096, 195, 3120, 196, 304, 197, 1328, 198, 2352,
+    199, 3376, 200, 560, 201, 1584, 202, 2608, 203, 3632, 204, 816, 205, 1840, 206, 2864,
+    207, 3888, 209, 1136, 210, 2160, 211, 3184, 212, 368, 213, 1392, 214, 2416, 215, 3440,
+    216, 624, 217, 1648, 218, 2672, 219, 3696, 220, 880, 221, 1904, 222, 2928, 223, 3952,
+    225, 1200, 226, 2224, 227, 3248, 228, 432, 229, 1456, 230, 2480, 231, 3504, 232, 688,
+    233, 1712, 234, 2736, 235, 3760, 236, 944, 237, 1968, 238, 2992, 239, 4016, 241, 1264,
+    242, 2288, 243, 3312, 244, 496, 245, 1520, 246, 2544, 247, 3568, 248, 752, 249, 1776,
+    250, 2800, 251, 3824, 252, 1008, 253, 2032, 254, 3056, 255, 4080, 257, 1028, 258, 2052,
+    259, 3076, 261, 1284, 262, 2308, 263, 3332, 264, 516, 265, 1540, 266, 2564, 267, 3588,
+    268, 772, 269, 1796, 270, 2820, 271, 3844, 273, 1092, 274, 2116, 275, 3140, 276, 324,
+    277, 1348, 278, 2372, 279, 3396, 280, 580, 281, 1604, 282, 2628, 283, 3652, 284, 836,
+    285, 1860, 286, 2884, 287, 3908, 289, 1156, 290, 2180, 291, 3204, 292, 388, 293, 1412,
+    294, 2436, 295, 3460, 296, 644, 297, 1668, 298, 2692, 299, 3716, 300, 900, 301, 1924,
+    302, 2948, 303, 3972, 305, 1220, 306, 2244, 307, 3268, 308, 452, 309, 1476, 310, 2500,
+    311, 3524, 312, 708, 313, 1732, 314, 2756, 315, 3780, 316, 964, 317, 1988, 318, 3012,
+    319, 4036, 321, 1044, 322, 2068, 323, 3092, 325, 1300, 326, 2324, 327, 3348, 328, 532,
+    329, 1556, 330, 2580, 331, 3604, 332, 788, 333, 1812, 334, 2836, 335, 3860, 337, 1108,
+    338, 2132, 339, 3156, 341, 1364, 342, 2388, 343, 3412, 344, 596, 345, 1620, 346, 2644,
+    347, 3668, 348, 852, 349, 1876, 350, 2900, 351, 3924, 353, 1172, 354, 2196, 355, 3220,
+    356, 404, 357, 1428, 358, 2452, 359, 3476, 360, 660, 361, 1684, 362, 2708, 363, 3732,
+    364, 916, 365, 1940, 366, 2964, 367, 3988, 369, 1236, 370, 2260, 371, 3284, 372, 468,
+    373, 1492, 374, 2516, 375, 3540, 376, 724, 377, 1748, 378, 2772, 379, 3796, 380, 980,
+    381, 2004, 382, 3028, 383, 4052, 385, 1060, 386, 2084, 387, 3108, 389, 1316, 390, 2340,
+    391, 3364, 392, 548, 393, 1572, 394, 2596, 395, 3620, 396, 804, 397, 1828, 398, 2852,
+    399, 3876, 401, 1124, 402, 2148, 403, 3172, 405, 1380, 406, 2404, 407, 3428, 408, 612,
+    409, 1636, 410, 2660, 411, 3684, 412, 868, 413, 1892, 414, 2916, 415, 3940, 417, 1188,
+    418, 2212, 419, 3236, 421, 1444, 422, 2468, 423, 3492, 424, 676, 425, 1700, 426, 2724,
+    427, 3748, 428, 932, 429, 1956, 430, 2980, 431, 4004, 433, 1252, 434, 2276, 435, 3300,
+    436, 484, 437, 1508, 438, 2532, 439, 3556, 440, 740, 441, 1764, 442, 2788, 443, 3812,
+    444, 996, 445, 2020, 446, 3044, 447, 4068, 449, 1076, 450, 2100, 451, 3124, 453, 1332,
+    454, 2356, 455, 3380, 456, 564, 457, 1588, 458, 2612, 459, 3636, 460, 820, 461, 1844,
+    462, 2868, 463, 3892, 465, 1140, 466, 2164, 467, 3188, 469, 1396, 470, 2420, 471, 3444,
+    472, 628, 473, 1652, 474, 2676, 475, 3700, 476, 884, 477, 1908, 478, 2932, 479, 3956,
+    481, 1204, 482, 2228, 483, 3252, 485, 1460, 486, 2484, 487, 3508, 488, 692, 489, 1716,
+    490, 2740, 491, 3764, 492, 948, 493, 1972, 494, 2996, 495, 4020, 497, 1268, 498, 2292,
+    499, 3316, 501, 1524, 502, 2548, 503, 3572, 504, 756, 505, 1780, 506, 2804, 507, 3828,
+    508, 1012, 509, 2036, 510, 3060, 511, 4084, 513, 1032, 514, 2056, 515, 3080, 517, 1288,
+    518, 2312, 519, 3336, 521, 1544, 522, 2568, 523, 3592, 524, 776, 525, 1800, 526, 2824,
+    527, 3848, 529, 1096, 530, 2120, 531, 3144, 533, 1352, 534, 2376, 535, 3400, 536, 584,
+    537, 1608, 538, 2632, 539, 3656, 540, 840, 541, 1864, 542, 2888, 543, 3912, 545, 1160,
+    546, 2184, 547, 3208, 549, 1416, 550, 2440, 551, 3464, 552, 648, 553, 1672, 554, 2696,
+    555, 3720, 556, 904, 557, 1928, 558, 2952, 559, 3976, 561, 1224, 562, 2248, 563, 3272,
+    565, 1480, 566, 2504, 567, 3528, 568, 712, 569, 1736, 570, 2760, 571, 3784, 572, 968,
+    573, 1992, 574, 3016, 575, 4040, 577, 1048, 578, 2072, 579, 3096, 581, 1304, 582, 2328,
+    583, 3352, 585, 1560, 586, 2584, 587, 3608, 588, 792, 589, 1816, 590, 2840, 591, 3864,
+    593, 1112, 594, 2136, 595, 3160, 597, 1368, 598, 2392, 599, 3416, 601, 1624, 602, 2648,
+    603, 3672, 604, 856, 605, 1880, 606, 2904, 607, 3928, 609, 1176, 610, 2200, 611, 3224,
+    613, 1432, 614, 2456, 615, 3480, 616, 664, 617, 1688, 618, 2712, 619, 3736, 620, 920,
+    621, 1944, 622, 2968, 623, 3992, 625, 1240, 626, 2264, 627, 3288, 629, 1496, 630, 2520,
+    631, 3544, 632, 728, 633, 1752, 634, 2776, 635, 3800, 636, 984, 637, 2008, 638, 3032,
+    639, 4056, 641, 1064, 642, 2088, 643, 3112, 645, 1320, 646, 2344, 647, 3368, 649, 1576,
+    650, 2600, 651, 3624, 652, 808, 653, 1832, 654, 2856, 655, 3880, 657, 1128, 658, 2152,
+    659, 3176, 661, 1384, 662, 2408, 663, 3432, 665, 1640, 666, 2664, 667, 3688, 668, 872,
+    669, 1896, 670, 2920, 671, 3944, 673, 1192, 674, 2216, 675, 3240, 677, 1448, 678, 2472,
+    679, 3496, 681, 1704, 682, 2728, 683, 3752, 684, 936, 685, 1960, 686, 2984, 687, 4008,
+    689, 1256, 690, 2280, 691, 3304, 693, 1512, 694, 2536, 695, 3560, 696, 744, 697, 1768,
+    698, 2792, 699, 3816, 700, 1000, 701, 2024, 702, 3048, 703, 4072, 705, 1080, 706, 2104,
+    707, 3128, 709, 1336, 710, 2360, 711, 3384, 713, 1592, 714, 2616, 715, 3640, 716, 824,
+    717, 1848, 718, 2872, 719, 3896, 721, 1144, 722, 2168, 723, 3192, 725, 1400, 726, 2424,
+    727, 3448, 729, 1656, 730, 2680, 731, 3704, 732, 888, 733, 1912, 734, 2936, 735, 3960,
+    737, 1208, 738, 2232, 739, 3256, 741, 1464, 742, 2488, 743, 3512, 745, 1720, 746, 2744,
+    747, 3768, 748, 952, 749, 1976, 750, 3000, 751, 4024, 753, 1272, 754, 2296, 755, 3320,
+    757, 1528, 758, 2552, 759, 3576, 761, 1784, 762, 2808, 763, 3832, 764, 1016, 765, 2040,
+    766, 3064, 767, 4088, 769, 1036, 770, 2060, 771, 3084, 773, 1292, 774, 2316, 775, 3340,
+    777, 1548, 778, 2572, 779, 3596, 781, 1804, 782, 2828, 783, 3852, 785, 1100, 786, 2124,
+    787, 3148, 789, 1356, 790, 2380, 791, 3404, 793, 1612, 794, 2636, 795, 3660, 796, 844,
+    797, 1868, 798, 2892, 799, 3916, 801, 1164, 802, 2188, 803, 3212, 805, 1420, 806, 2444,
+    807, 3468, 809, 1676, 810, 2700, 811, 3724, 812, 908, 813, 1932, 814, 2956, 815, 3980,
+    817, 1228, 818, 2252, 819, 3276, 821, 1484, 822, 2508, 823, 3532, 825, 1740, 826, 2764,
+    827, 3788, 828, 972, 829, 1996, 830, 3020, 831, 4044, 833, 1052, 834, 2076, 835, 3100,
+    837, 1308, 838, 2332, 839, 3356, 841, 1564, 842, 2588, 843, 3612, 845, 1820, 846, 2844,
+    847, 3868, 849, 1116, 850, 2140, 851, 3164, 853, 1372, 854, 2396, 855, 3420, 857, 1628,
+    858, 2652, 859, 3676, 861, 1884, 862, 2908, 863, 3932, 865, 1180, 866, 2204, 867, 3228,
+    869, 1436, 870, 2460, 871, 3484, 873, 1692, 874, 2716, 875, 3740, 876, 924, 877, 1948,
+    878, 2972, 879, 3996, 881, 1244, 882, 2268, 883, 3292, 885, 1500, 886, 2524, 887, 3548,
+    889, 1756, 890, 2780, 891, 3804, 892, 988, 893, 2012, 894, 3036, 895, 4060, 897, 1068,
+    898, 2092, 899, 3116, 901, 1324, 902, 2348, 903, 3372, 905, 1580, 906, 2604, 907, 3628,
+    909, 1836, 910, 2860, 911, 3884, 913, 1132, 914, 2156, 915, 3180, 917, 1388, 918, 2412,
+    919, 3436, 921, 1644, 922, 2668, 923, 3692, 925, 1900, 926, 2924, 927, 3948, 929, 1196,
+    930, 2220, 931, 3244, 933, 1452, 934, 2476, 935, 3500, 937, 1708, 938, 2732, 939, 3756,
+    941, 1964, 942, 2988, 943, 4012, 945, 1260, 946, 2284, 947, 3308, 949, 1516, 950, 2540,
+    951, 3564, 953, 1772, 954, 2796, 955, 3820, 956, 1004, 957, 2028, 958, 3052, 959, 4076,
+    961, 1084, 962, 2108, 963, 3132, 965, 1340, 966, 2364, 967, 3388, 969, 1596, 970, 2620,
+    971, 3644, 973, 1852, 974, 2876, 975, 3900, 977, 1148, 978, 2172, 979, 3196, 981, 1404,
+    982, 2428, 983, 3452, 985, 1660, 986, 2684, 987, 3708, 989, 1916, 990, 2940, 991, 3964,
+    993, 1212, 994, 2236, 995, 3260, 997, 1468, 998, 2492, 999, 3516, 1001, 1724, 1002, 2748,
+    1003, 3772, 1005, 1980, 1006, 3004, 1007, 4028, 1009, 1276, 1010, 2300, 1011, 3324, 1013, 1532,
+    1014, 2556, 1015, 3580, 1017, 1788, 1018, 2812, 1019, 3836, 1021, 2044, 1022, 3068, 1023, 4092,
+    1026, 2049, 1027, 3073, 1029, 1281, 1030, 2305, 1031, 3329, 1033, 1537, 1034, 2561, 1035, 3585,
+    1037, 1793, 1038, 2817, 1039, 3841, 1041, 1089, 1042, 2113, 1043, 3137, 1045, 1345, 1046, 2369,
+    1047, 3393, 1049, 1601, 1050, 2625, 1051, 3649, 1053, 1857, 1054, 2881, 1055, 3905, 1057, 1153,
+    1058, 2177, 1059, 3201, 1061, 1409, 1062, 2433, 1063, 3457, 1065, 1665, 1066, 2689, 1067, 3713,
+    1069, 1921, 1070, 2945, 1071, 3969, 1073, 1217, 1074, 2241, 1075, 3265, 1077, 1473, 1078, 2497,
+    1079, 3521, 1081, 1729, 1082, 2753, 1083, 3777, 1085, 1985, 1086, 3009, 1087, 4033, 1090, 2065,
+    1091, 3089, 1093, 1297, 1094, 2321, 1095, 3345, 1097, 1553, 1098, 2577, 1099, 3601, 1101, 1809,
+    1102, 2833, 1103, 3857, 1106, 2129, 1107, 3153, 1109, 1361, 1110, 2385, 1111, 3409, 1113, 1617,
+    1114, 2641, 1115, 3665, 1117, 1873, 1118, 2897, 1119, 3921, 1121, 1169, 1122, 2193, 1123, 3217,
+    1125, 1425, 1126, 2449, 1127, 3473, 1129, 1681, 1130, 2705, 1131, 3729, 1133, 1937, 1134, 2961,
+    1135, 3985, 1137, 1233, 1138, 2257, 1139, 3281, 1141, 1489, 1142, 2513, 1143, 3537, 1145, 1745,
+    1146, 2769, 1147, 3793, 1149, 2001, 1150, 3025, 1151, 4049, 1154, 2081, 1155, 3105, 1157, 1313,
+    1158, 2337, 1159, 3361, 1161, 1569, 1162, 2593, 1163, 3617, 1165, 1825, 1166, 2849, 1167, 3873,
+    1170, 2145, 1171, 3169, 1173, 1377, 1174, 2401, 1175, 3425, 1177, 1633, 1178, 2657, 1179, 3681,
+    1181, 1889, 1182, 2913, 1183, 3937, 1186, 2209, 1187, 3233, 1189, 1441, 1190, 2465, 1191, 3489,
+    1193, 1697, 1194, 2721, 1195, 3745, 1197, 1953, 1198, 2977, 1199, 4001, 1201, 1249, 1202, 2273,
+    1203, 3297, 1205, 1505, 1206, 2529, 1207, 3553, 1209, 1761, 1210, 2785, 1211, 3809, 1213, 2017,
+    1214, 3041, 1215, 4065, 1218, 2097, 1219, 3121, 1221, 1329, 1222, 2353, 1223, 3377, 1225, 1585,
+    1226, 2609, 1227, 3633, 1229, 1841, 1230, 2865, 1231, 3889, 1234, 2161, 1235, 3185, 1237, 1393,
+    1238, 2417, 1239, 3441, 1241, 1649, 1242, 2673, 1243, 3697, 1245, 1905, 1246, 2929, 1247, 3953,
+    1250, 2225, 1251, 3249, 1253, 1457, 1254, 2481, 1255, 3505, 1257, 1713, 1258, 2737, 1259, 3761,
+    1261, 1969, 1262, 2993, 1263, 4017, 1266, 2289, 1267, 3313, 1269, 1521, 1270, 2545, 1271, 3569,
+    1273, 1777, 1274, 2801, 1275, 3825, 1277, 2033, 1278, 3057, 1279, 4081, 1282, 2053, 1283, 3077,
+    1286, 2309, 1287, 3333, 1289, 1541, 1290, 2565, 1291, 3589, 1293, 1797, 1294, 2821, 1295, 3845,
+    1298, 2117, 1299, 3141, 1301, 1349, 1302, 2373, 1303, 3397, 1305, 1605, 1306, 2629, 1307, 3653,
+    1309, 1861, 1310, 2885, 1311, 3909, 1314, 2181, 1315, 3205, 1317, 1413, 1318, 2437, 1319, 3461,
+    1321, 1669, 1322, 2693, 1323, 3717, 1325, 1925, 1326, 2949, 1327, 3973, 1330, 2245, 1331, 3269,
+    1333, 1477, 1334, 2501, 1335, 3525, 1337, 1733, 1338, 2757, 1339, 3781, 1341, 1989, 1342, 3013,
+    1343, 4037, 1346, 2069, 1347, 3093, 1350, 2325, 1351, 3349, 1353, 1557, 1354, 2581, 1355, 3605,
+    1357, 1813, 1358, 2837, 1359, 3861, 1362, 2133, 1363, 3157, 1366, 2389, 1367, 3413, 1369, 1621,
+    1370, 2645, 1371, 3669, 1373, 1877, 1374, 2901, 1375, 3925, 1378, 2197, 1379, 3221, 1381, 1429,
+    1382, 2453, 1383, 3477, 1385, 1685, 1386, 2709, 1387, 3733, 1389, 1941, 1390, 2965, 1391, 3989,
+    1394, 2261, 1395, 3285, 1397, 1493, 1398, 2517, 1399, 3541, 1401, 1749, 1402, 2773, 1403, 3797,
+    1405, 2005, 1406, 3029, 1407, 4053, 1410, 2085, 1411, 3109, 1414, 2341, 1415, 3365, 1417, 1573,
+    1418, 2597, 1419, 3621, 1421, 1829, 1422, 2853, 1423, 3877, 1426, 2149, 1427, 3173, 1430, 2405,
+    1431, 3429, 1433, 1637, 1434, 2661, 1435, 3685, 1437, 1893, 1438, 2917, 1439, 3941, 1442, 2213,
+    1443, 3237, 1446, 2469, 1447, 3493, 1449, 1701, 1450, 2725, 1451, 3749, 1453, 1957, 1454, 2981,
+    1455, 4005, 1458, 2277, 1459, 3301, 1461, 1509, 1462, 2533, 1463, 3557, 1465, 1765, 1466, 2789,
+    1467, 3813, 1469, 2021, 1470, 3045, 1471, 4069, 1474, 2101, 1475, 3125, 1478, 2357, 1479, 3381,
+    1481, 1589, 1482, 2613, 1483, 3637, 1485, 1845, 1486, 2869, 1487, 3893, 1490, 2165, 1491, 3189,
+    1494, 2421, 1495, 3445, 1497, 1653, 1498, 2677, 1499, 3701, 1501, 1909, 1502, 2933, 1503, 3957,
+    1506, 2229, 1507, 3253, 1510, 2485, 1511, 3509, 1513, 1717, 1514, 2741, 1515, 3765, 1517, 1973,
+    1518, 2997, 1519, 4021, 1522, 2293, 1523, 3317, 1526, 2549, 1527, 3573, 1529, 1781, 1530, 2805,
+    1531, 3829, 1533, 2037, 1534, 3061, 1535, 4085, 1538, 2057, 1539, 3081, 1542, 2313, 1543, 3337,
+    1546, 2569, 1547, 3593, 1549, 1801, 1550, 2825, 1551, 3849, 1554, 2121, 1555, 3145, 1558, 2377,
+    1559, 3401, 1561, 1609, 1562, 2633, 1563, 3657, 1565, 1865, 1566, 2889, 1567, 3913, 1570, 2185,
+    1571, 3209, 1574, 2441, 1575, 3465, 1577, 1673, 1578, 2697, 1579, 3721, 1581, 1929, 1582, 2953,
+    1583, 3977, 1586, 2249, 1587, 3273, 1590, 2505, 1591, 3529, 1593, 1737, 1594, 2761, 1595, 3785,
+    1597, 1993, 1598, 3017, 1599, 4041, 1602, 2073, 1603, 3097, 1606, 2329, 1607, 3353, 1610, 2585,
+    1611, 3609, 1613, 1817, 1614, 2841, 1615, 3865, 1618, 2137, 1619, 3161, 1622, 2393, 1623, 3417,
+    1626, 2649, 1627, 3673, 1629, 1881, 1630, 2905, 1631, 3929, 1634, 2201, 1635, 3225, 1638, 2457,
+    1639, 3481, 1641, 1689, 1642, 2713, 1643, 3737, 1645, 1945, 1646, 2969, 1647, 3993, 1650, 2265,
+    1651, 3289, 1654, 2521, 1655, 3545, 1657, 1753, 1658, 2777, 1659, 3801, 1661, 2009, 1662, 3033,
+    1663, 4057, 1666, 2089, 1667, 3113, 1670, 2345, 1671, 3369, 1674, 2601, 1675, 3625, 1677, 1833,
+    1678, 2857, 1679, 3881, 1682, 2153, 1683, 3177, 1686, 2409, 1687, 3433, 1690, 2665, 1691, 3689,
+    1693, 1897, 1694, 2921, 1695, 3945, 1698, 2217, 1699, 3241, 1702, 2473, 1703, 3497, 1706, 2729,
+    1707, 3753, 1709, 1961, 1710, 2985, 1711, 4009, 1714, 2281, 1715, 3305, 1718, 2537, 1719, 3561,
+    1721, 1769, 1722, 2793, 1723, 3817, 1725, 2025, 1726, 3049, 1727, 4073, 1730, 2105, 1731, 3129,
+    1734, 2361, 1735, 3385, 1738, 2617, 1739, 3641, 1741, 1849, 1742, 2873, 1743, 3897, 1746, 2169,
+    1747, 3193, 1750, 2425, 1751, 3449, 1754, 2681, 1755, 3705, 1757, 1913, 1758, 2937, 1759, 3961,
+    1762, 2233, 1763, 3257, 1766, 2489, 1767, 3513, 1770, 2745, 1771, 3769, 1773, 1977, 1774, 3001,
+    1775, 4025, 1778, 2297, 1779, 3321, 1782, 2553, 1783, 3577, 1786, 2809, 1787, 3833, 1789, 2041,
+    1790, 3065, 1791, 4089, 1794, 2061, 1795, 3085, 1798, 2317, 1799, 3341, 1802, 2573, 1803, 3597,
+    1806, 2829, 1807, 3853, 1810, 2125, 1811, 3149, 1814, 2381, 1815, 3405, 1818, 2637, 1819, 3661,
+    1821, 1869, 1822, 2893, 1823, 3917, 1826, 2189, 1827, 3213, 1830, 2445, 1831, 3469, 1834, 2701,
+    1835, 3725, 1837, 1933, 1838, 2957, 1839, 3981, 1842, 2253, 1843, 3277, 1846, 2509, 1847, 3533,
+    1850, 2765, 1851, 3789, 1853, 1997, 1854, 3021, 1855, 4045, 1858, 2077, 1859, 3101, 1862, 2333,
+    1863, 3357, 1866, 2589, 1867, 3613, 1870, 2845, 1871, 3869, 1874, 2141, 1875, 3165, 1878, 2397,
+    1879, 3421, 1882, 2653, 1883, 3677, 1886, 2909, 1887, 3933, 1890, 2205, 1891, 3229, 1894, 2461,
+    1895, 3485, 1898, 2717, 1899, 3741, 1901, 1949, 1902, 2973, 1903, 3997, 1906, 2269, 1907, 3293,
+    1910, 2525, 1911, 3549, 1914, 2781, 1915, 3805, 1917, 2013, 1918, 3037, 1919, 4061, 1922, 2093,
+    1923, 3117, 1926, 2349, 1927, 3373, 1930, 2605, 1931, 3629, 1934, 2861, 1935, 3885, 1938, 2157,
+    1939, 3181, 1942, 2413, 1943, 3437, 1946, 2669, 1947, 3693, 1950, 2925, 1951, 3949, 1954, 2221,
+    1955, 3245, 1958, 2477, 1959, 3501, 1962, 2733, 1963, 3757, 1966, 2989, 1967, 4013, 1970, 2285,
+    1971, 3309, 1974, 2541, 1975, 3565, 1978, 2797, 1979, 3821, 1981, 2029, 1982, 3053, 1983, 4077,
+    1986, 2109, 1987, 3133, 1990, 2365, 1991, 3389, 1994, 2621, 1995, 3645, 1998, 2877, 1999, 3901,
+    2002, 2173, 2003, 3197, 2006, 2429, 2007, 3453, 2010, 2685, 2011, 3709, 2014, 2941, 2015, 3965,
+    2018, 2237, 2019, 3261, 2022, 2493, 2023, 3517, 2026, 2749, 2027, 3773, 2030, 3005, 2031, 4029,
+    2034, 2301, 2035, 3325, 2038, 2557, 2039, 3581, 2042, 2813, 2043, 3837, 2046, 3069, 2047, 4093,
+    2051, 3074, 2054, 2306, 2055, 3330, 2058, 2562, 2059, 3586, 2062, 2818, 2063, 3842, 2066, 2114,
+    2067, 3138, 2070, 2370, 2071, 3394, 2074, 2626, 2075, 3650, 2078, 2882, 2079, 3906, 2082, 2178,
+    2083, 3202, 2086, 2434, 2087, 3458, 2090, 2690, 2091, 3714, 2094, 2946, 2095, 3970, 2098, 2242,
+    2099, 3266, 2102, 2498, 2103, 3522, 2106, 2754, 2107, 3778, 2110, 3010, 2111, 4034, 2115, 3090,
+    2118, 2322, 2119, 3346, 2122, 2578, 2123, 3602, 2126, 2834, 2127, 3858, 2131, 3154, 2134, 2386,
+    2135, 3410, 2138, 2642, 2139, 3666, 2142, 2898, 2143, 3922, 2146, 2194, 2147, 3218, 2150, 2450,
+    2151, 3474, 2154, 2706, 2155, 3730, 2158, 2962, 2159, 3986, 2162, 2258, 2163, 3282, 2166, 2514,
+    2167, 3538, 2170, 2770, 2171, 3794, 2174, 3026, 2175, 4050, 2179, 3106, 2182, 2338, 2183, 3362,
+    2186, 2594, 2187, 3618, 2190, 2850, 2191, 3874, 2195, 3170, 2198, 2402, 2199, 3426, 2202, 2658,
+    2203, 3682, 2206, 2914, 2207, 3938, 2211, 3234, 2214, 2466, 2215, 3490, 2218, 2722, 2219, 3746,
+    2222, 2978, 2223, 4002, 2226, 2274, 2227, 3298, 2230, 2530, 2231, 3554, 2234, 2786, 2235, 3810,
+    2238, 3042, 2239, 4066, 2243, 3122, 2246, 2354, 2247, 3378, 2250, 2610, 2251, 3634, 2254, 2866,
+    2255, 3890, 2259, 3186, 2262, 2418, 2263, 3442, 2266, 2674, 2267, 3698, 2270, 2930, 2271, 3954,
+    2275, 3250, 2278, 2482, 2279, 3506, 2282, 2738, 2283, 3762, 2286, 2994, 2287, 4018, 2291, 3314,
+    2294, 2546, 2295, 3570, 2298, 2802, 2299, 3826, 2302, 3058, 2303, 4082, 2307, 3078, 2311, 3334,
+    2314, 2566, 2315, 3590, 2318, 2822, 2319, 3846, 2323, 3142, 2326, 2374, 2327, 3398, 2330, 2630,
+    2331, 3654, 2334, 2886, 2335, 3910, 2339, 3206, 2342, 2438, 2343, 3462, 2346, 2694, 2347, 3718,
+    2350, 2950, 2351, 3974, 2355, 3270, 2358, 2502, 2359, 3526, 2362, 2758, 2363, 3782, 2366, 3014,
+    2367, 4038, 2371, 3094, 2375, 3350, 2378, 2582, 2379, 3606, 2382, 2838, 2383, 3862, 2387, 3158,
+    2391, 3414, 2394, 2646, 2395, 3670, 2398, 2902, 2399, 3926, 2403, 3222, 2406, 2454, 2407, 3478,
+    2410, 2710, 2411, 3734, 2414, 2966, 2415, 3990, 2419, 3286, 2422, 2518, 2423, 3542, 2426, 2774,
+    2427, 3798, 2430, 3030, 2431, 4054, 2435, 3110, 2439, 3366, 2442, 2598, 2443, 3622, 2446, 2854,
+    2447, 3878, 2451, 3174, 2455, 3430, 2458, 2662, 2459, 3686, 2462, 2918, 2463, 3942, 2467, 3238,
+    2471, 3494, 2474, 2726, 2475, 3750, 2478, 2982, 2479, 4006, 2483, 3302, 2486, 2534, 2487, 3558,
+    2490, 2790, 2491, 3814, 2494, 3046, 2495, 4070, 2499, 3126, 2503, 3382, 2506, 2614, 2507, 3638,
+    2510, 2870, 2511, 3894, 2515, 3190, 2519, 3446, 2522, 2678, 2523, 3702, 2526, 2934, 2527, 3958,
+    2531, 3254, 2535, 3510, 2538, 2742, 2539, 3766, 2542, 2998, 2543, 4022, 2547, 3318, 2551, 3574,
+    2554, 2806, 2555, 3830, 2558, 3062, 2559, 4086, 2563, 3082, 2567, 3338, 2571, 3594, 2574, 2826,
+    2575, 3850, 2579, 3146, 2583, 3402, 2586, 2634, 2587, 3658, 2590, 2890, 2591, 3914, 2595, 3210,
+    2599, 3466, 2602, 2698, 2603, 3722, 2606, 2954, 2607, 3978, 2611, 3274, 2615, 3530, 2618, 2762,
+    2619, 3786, 2622, 3018, 2623, 4042, 2627, 3098, 2631, 3354, 2635, 3610, 2638, 2842, 2639, 3866,
+    2643, 3162, 2647, 3418, 2651, 3674, 2654, 2906, 2655, 3930, 2659, 3226, 2663, 3482, 2666, 2714,
+    2667, 3738, 2670, 2970, 2671, 3994, 2675, 3290, 2679, 3546, 2682, 2778, 2683, 3802, 2686, 3034,
+    2687, 4058, 2691, 3114, 2695, 3370, 2699, 3626, 2702, 2858, 2703, 3882, 2707, 3178, 2711, 3434,
+    2715, 3690, 2718, 2922, 2719, 3946, 2723, 3242, 2727, 3498, 2731, 3754, 2734, 2986, 2735, 4010,
+    2739, 3306, 2743, 3562, 2746, 2794, 2747, 3818, 2750, 3050, 2751, 4074, 2755, 3130, 2759, 3386,
+    2763, 3642, 2766, 2874, 2767, 3898, 2771, 3194, 2775, 3450, 2779, 3706, 2782, 2938, 2783, 3962,
+    2787, 3258, 2791, 3514, 2795, 3770, 2798, 3002, 2799, 4026, 2803, 3322, 2807, 3578, 2811, 3834,
+    2814, 3066, 2815, 4090, 2819, 3086, 2823, 3342, 2827, 3598, 2831, 3854, 2835, 3150, 2839, 3406,
+    2843, 3662, 2846, 2894, 2847, 3918, 2851, 3214, 2855, 3470, 2859, 3726, 2862, 2958, 2863, 3982,
+    2867, 3278, 2871, 3534, 2875, 3790, 2878, 3022, 2879, 4046, 2883, 3102, 2887, 3358, 2891, 3614,
+    2895, 3870, 2899, 3166, 2903, 3422, 2907, 3678, 2911, 3934, 2915, 3230, 2919, 3486, 2923, 3742,
+    2926, 2974, 2927, 3998, 2931, 3294, 2935, 3550, 2939, 3806, 2942, 3038, 2943, 4062, 2947, 3118,
+    2951, 3374, 2955, 3630, 2959, 3886, 2963, 3182, 2967, 3438, 2971, 3694, 2975, 3950, 2979, 3246,
+    2983, 3502, 2987, 3758, 2991, 4014, 2995, 3310, 2999, 3566, 3003, 3822, 3006, 3054, 3007, 4078,
+    3011, 3134, 3015, 3390, 3019, 3646, 3023, 3902, 3027, 3198, 3031, 3454, 3035, 3710, 3039, 3966,
+    3043, 3262, 3047, 3518, 3051, 3774, 3055, 4030, 3059, 3326, 3063, 3582, 3067, 3838, 3071, 4094,
+    3079, 3331, 3083, 3587, 3087, 3843, 3091, 3139, 3095, 3395, 3099, 3651, 3103, 3907, 3107, 3203,
+    3111, 3459, 3115, 3715, 3119, 3971, 3123, 3267, 3127, 3523, 3131, 3779, 3135, 4035, 3143, 3347,
+    3147, 3603, 3151, 3859, 3159, 3411, 3163, 3667, 3167, 3923, 3171, 3219, 3175, 3475, 3179, 3731,
+    3183, 3987, 3187, 3283, 3191, 3539, 3195, 3795, 3199, 4051, 3207, 3363, 3211, 3619, 3215, 3875,
+    3223, 3427, 3227, 3683, 3231, 3939, 3239, 3491, 3243, 3747, 3247, 4003, 3251, 3299, 3255, 3555,
+    3259, 3811, 3263, 4067, 3271, 3379, 3275, 3635, 3279, 3891, 3287, 3443, 3291, 3699, 3295, 3955,
+    3303, 3507, 3307, 3763, 3311, 4019, 3319, 3571, 3323, 3827, 3327, 4083, 3339, 3591, 3343, 3847,
+    3351, 3399, 3355, 3655, 3359, 3911, 3367, 3463, 3371, 3719, 3375, 3975, 3383, 3527, 3387, 3783,
+    3391, 4039, 3403, 3607, 3407, 3863, 3419, 3671, 3423, 3927, 3431, 3479, 3435, 3735, 3439, 3991,
+    3447, 3543, 3451, 3799, 3455, 4055, 3467, 3623, 3471, 3879, 3483, 3687, 3487, 3943, 3499, 3751,
+    3503, 4007, 3511, 3559, 3515, 3815, 3519, 4071, 3531, 3639, 3535, 3895, 3547, 3703, 3551, 3959,
+    3563, 3767, 3567, 4023, 3579, 3831, 3583, 4087, 3599, 3851, 3611, 3659, 3615, 3915, 3627, 3723,
+    3631, 3979, 3643, 3787, 3647, 4043, 3663, 3867, 3679, 3931, 3691, 3739, 3695, 3995, 3707, 3803,
+    3711, 4059, 3727, 3883, 3743, 3947, 3759, 4011, 3771, 3819, 3775, 4075, 3791, 3899, 3807, 3963,
+    3823, 4027, 3839, 4091, 3871, 3919, 3887, 3983, 3903, 4047, 3951, 3999, 3967, 4063, 4031, 4079,
+};
+
+static const fft_window_t window_8192[4096] = {
+    WIN(-1.3877787807814457e-17), WIN(5.2957623355998074e-08), WIN(2.1183062846874545e-07), WIN(4.766194204586238e-07),
+    WIN(8.473246744661322e-07), WIN(1.323947335665765e-06), WIN(1.9064886194047892e-06), WIN(2.5949500109256896e-06),
+    WIN(3.3893332656437236e-06), WIN(4.289640409022022e-06), WIN(5.295873736418932e-06), WIN(6.408035813351698e-06),
+    WIN(7.626129475246657e-06), WIN(8.95015782770292e-06), WIN(1.0380124246076039e-05), WIN(1.1916032376019237e-05),
+    WIN(1.3557886132817276e-05), WIN(1.5305689701927694e-05), WIN(1.7159447538675487e-05), WIN(1.9119164368391894e-05),
+    WIN(2.1184845186220103e-05), WIN(2.335649525724015e-05), WIN(2.5634120116441172e-05), WIN(2.8017725568596497e-05),
+    WIN(3.050731768830528e-05), WIN(3.310290282010353e-05), WIN(3.580448757825594e-05), WIN(3.861207884676976e-05),
+    WIN(4.1525683779339295e-05), WIN(4.4545309799567945e-05), WIN(4.767096460052411e-05), WIN(5.0902656145143665e-05),
+    WIN(5.424039266591074e-05), WIN(5.7684182664913264e-05), WIN(6.12340349138013e-05), WIN(6.48899584538426e-05),
+    WIN(6.865196259583928e-05), WIN(7.252005691994745e-05), WIN(7.649425127591314e-05), WIN(8.05745557828641e-05),
+    WIN(8.476098082928207e-05), WIN(8.905353707303054e-05), WIN(9.34522354412437e-05), WIN(9.79570871303681e-05),
+    WIN(0.00010256810360607937), WIN(0.0001072852966032406), WIN(0.00011210867812583292), WIN(0.00011703826044699717),
+    WIN(0.0001220740561089645), WIN(0.00012721607792291756), WIN(0.0001324643389690322), WIN(0.00013781885259646354),
+    WIN(0.00014327963242320718), WIN(0.00014884669233616865), WIN(0.00015452004649099682), WIN(0.00016029970931208393),
+    WIN(0.00016618569549244067), WIN(0.00017217801999391824), WIN(0.00017827669804666713), WIN(0.00018448174514971993),
+    WIN(0.00019079317707029753), WIN(0.00019721100984418372), WIN(0.00020373525977548934), WIN(0.00021036594343670778),
+    WIN(0.0002171030776684929), WIN(0.00022394667957981174), WIN(0.00023089676654756974), WIN(0.00023795335621704106),
+    WIN(0.0002451164665012162), WIN(0.00025238611558124624), WIN(0.0002597623219060402), WIN(0.000267245104192515),
+    WIN(0.00027483448142508193), WIN(0.0002825304728561462), WIN(0.0002903330980054408), WIN(0.00029824237666044306),
+    WIN(0.00030625832887608284), WIN(0.00031438097497471507), WIN(0.0003226103355460641), WIN(0.00033094643144700175),
+    WIN(0.0003393892838018109), WIN(0.0003479389140017136), WIN(0.00035659534370516277), WIN(0.0003653585948373561),
+    WIN(0.0003742286895906388), WIN(0.00038320565042408716), WIN(0.0003922895000634946), WIN(0.00040148026150130245),
+    WIN(0.00041077795799662753), WIN(0.000420182613075068), WIN(0.00042969425052864774), WIN(0.00043931289441563603),
+    WIN(0.0004490385690607279), WIN(0.000458871299054614), WIN(0.0004688111092542441), WIN(0.00047885802478243866),
+    WIN(0.000489012071027986), WIN(0.000499273273645448), WIN(0.000509641658555271), WIN(0.000520117251943425),
+    WIN(0.0005307000802613621), WIN(0.0005413901702261276), WIN(0.0005521875488200961), WIN(0.0005630922432909025),
+    WIN(0.0005741042811513719), WIN(0.0005852236901793956), WIN(0.000596450498417847), WIN(0.0006077847341744991),
+    WIN(0.0006192264260219543), WIN(0.0006307756027973677), WIN(0.0006424322936027238), WIN(0.0006541965278041989),
+    WIN(0.0006660683350326047), WIN(0.0006780477451828332), WIN(0.0006901347884141623), WIN(0.0007023294951497422),
+    WIN(0.0007146318960768033), WIN(0.0007270420221463653), WIN(0.0007395599045732781), WIN(0.000752185574835959),
+    WIN(0.000764919064676392), WIN(0.0007777604060999754), WIN(0.0007907096313754247), WIN(0.0008037667730345921),
+    WIN(0.0008169318638724943), WIN(0.0008302049369470349), WIN(0.0008435860255790323), WIN(0.0008570751633519835),
+    WIN(0.0008706723841121478), WIN(0.0008843777219680188), WIN(0.0008981912112906998), WIN(0.0009121128867135009),
+    WIN(0.0009261427831318142), WIN(0.0009402809357030167), WIN(0.0009545273798465398), WIN(0.0009688821512434803),
+    WIN(0.0009833452858365038), WIN(0.0009979168198299276), WIN(0.0010125967896894156), WIN(0.0010273852321419363),
+    WIN(0.0010422821841754998), WIN(0.0010572876830391431), WIN(0.0010724017662429308), WIN(0.0010876244715574551),
+    WIN(0.0011029558370140857), WIN(0.0011183959009045674), WIN(0.0011339447017811033), WIN(0.0011496022784560356),
+    WIN(0.0011653686700017762), WIN(0.0011812439157506405), WIN(0.001197228055294916), WIN(0.0012133211284863915),
+    WIN(0.0012295231754364255), WIN(0.0012458342365157388), WIN(0.0012622543523543306), WIN(0.001278783563841382),
+    WIN(0.0012954219121248806), WIN(0.0013121694386116767), WIN(0.0013290261849673024), WIN(0.0013459921931159025),
+    WIN(0.0013630675052398594), WIN(0.0013802521637797799), WIN(0.0013975462114345222), WIN(0.001414949691160669),
+    WIN(0.0014324626461727913), WIN(0.0014500851199428788), WIN(0.001467817156200521), WIN(0.001485658798932657),
+    WIN(0.0015036100923833534), WIN(0.0015216710810536382), WIN(0.0015398418097015004), WIN(0.0015581223233415986),
+    WIN(0.0015765126672450391), WIN(0.001595012886939473), WIN(0.0016136230282086522), WIN(0.00163234313709254),
+    WIN(0.0016511732598868817), WIN(0.0016701134431431203), WIN(0.0016891637336684945), WIN(0.0017083241785253722),
+    WIN(0.0017275948250317225), WIN(0.001746975720760241), WIN(0.0017664669135387528), WIN(0.0017860684514498654),
+    WIN(0.0018057803828306351), WIN(0.0018256027562725818), WIN(0.0018455356206215356), WIN(0.0018655790249772763),
+    WIN(0.0018857330186936444), WIN(0.0019059976513781107), WIN(0.0019263729728916101), WIN(0.001946859033348694),
+    WIN(0.001967455883116892), WIN(0.0019881635728168506), WIN(0.002008982153322167), WIN(0.002029911675758847),
+    WIN(0.002050952191505695), WIN(0.002072103752193577), WIN(0.0020933664097056853), WIN(0.0021147402161770107),
+    WIN(0.0021362252239944535), WIN(0.002157821485796324), WIN(0.0021795290544724816), WIN(0.00220134798316389),
+    WIN(0.0022232783252626315), WIN(0.0022453201344115603), WIN(0.0022674734645042327), WIN(0.0022897383696845602),
+    WIN(0.0023121149043469624), WIN(0.0023346031231356174), WIN(0.0023572030809448363), WIN(0.0023799148329185366),
+    WIN(0.002402738434450158), WIN(0.002425673941182413), WIN(0.0024487214090071624), WIN(0.0024718808940651787),
+    WIN(0.002495152452745966), WIN(0.0025185361416875107), WIN(0.0025420320177762246), WIN(0.002565640138146419),
+    WIN(0.0025893605601805675), WIN(0.0026131933415087377), WIN(0.002637138540008549), WIN(0.002661196213804992),
+    WIN(0.0026853664212700135), WIN(0.002709649221022681), WIN(0.0027340446719285594), WIN(0.002758552833099795),
+    WIN(0.0027831737638948223), WIN(0.0028079075239182127), WIN(0.0028327541730202577), WIN(0.002857713771297024),
+    WIN(0.00288278637908998), WIN(0.0029079720569858553), WIN(0.0029332708658163092), WIN(0.0029586828666579995),
+    WIN(0.0029842081208319993), WIN(0.003009846689903839), WIN(0.0030355986356831455), WIN(0.003061464020223531),
+    WIN(0.0030874429058223296), WIN(0.003113535355020458), WIN(0.0031397414306019583), WIN(0.0031660611955940665),
+    WIN(0.003192494713266783), WIN(0.003219042047132817), WIN(0.0032457032609471553), WIN(0.003272478418707106),
+    WIN(0.0032993675846517273), WIN(0.003326370823262065), WIN(0.00335348819926036), WIN(0.0033807197776103415),
+    WIN(0.0034080656235166568), WIN(0.0034355258024248436), WIN(0.0034631003800210253), WIN(0.003490789422231508),
+    WIN(0.003518592995222919), WIN(0.0035465111654016945), WIN(0.003574543999413843), WIN(0.0036026915641448887),
+    WIN(0.0036309539267194157), WIN(0.003659331154501122), WIN(0.0036878233150922923), WIN(0.0037164304763336597),
+    WIN(0.0037451527063041556), WIN(0.0037739900733209097), WIN(0.00380294264593857), WIN(0.003832010492949331),
+    WIN(0.003861193683382738), WIN(0.003890492286505301), WIN(0.003919906371820256), WIN(0.003949436009067442),
+    WIN(0.003979081268222981), WIN(0.004008842219498945), WIN(0.004038718933343302), WIN(0.004068711480439496),
+    WIN(0.004098819931706285), WIN(0.004129044358297446), WIN(0.0041593848316015675), WIN(0.004189841423241705),
+    WIN(0.004220414205075365), WIN(0.004251103249193894), WIN(0.004281908627922548), WIN(0.00431283041382001),
+    WIN(0.004343868679678342), WIN(0.004375023498522507), WIN(0.004406294943610306), WIN(0.0044376830884318985),
+    WIN(0.004469188006709826), WIN(0.00450080977239857), WIN(0.004532548459684191), WIN(0.004564404142984355),
+    WIN(0.004596376896947904), WIN(0.004628466796454442), WIN(0.004660673916614483), WIN(0.004692998332768705),
+    WIN(0.004725440120488006), WIN(0.004757999355573098), WIN(0.004790676114054426), WIN(0.004823470472191602),
+    WIN(0.004856382506473328), WIN(0.0048894122936171125), WIN(0.004922559910568947), WIN(0.004955825434503111),
+    WIN(0.0049892089428218295), WIN(0.00502271051315499), WIN(0.005056330223359856), WIN(0.005090068151520952),
+    WIN(0.005123924375949607), WIN(0.005157898975183678), WIN(0.005191992027987494), WIN(0.005226203613351188),
+    WIN(0.005260533810490811), WIN(0.0052949826988479415), WIN(0.005329550358089144), WIN(0.00536423686810604),
+    WIN(0.005399042309014765), WIN(0.005433966761155984), WIN(0.005469010305094182), WIN(0.005504173021617792),
+    WIN(0.005539454991738663), WIN(0.005574856296691855), WIN(0.005610377017935278), WIN(0.0056460172371496226),
+    WIN(0.00568177703623772), WIN(0.005717656497324641), WIN(0.005753655702756974), WIN(0.0057897747351029205),
+    WIN(0.005826013677151798), WIN(0.005862372611913927), WIN(0.005898851622620008), WIN(0.005935450792721106),
+    WIN(0.0059721702058882775), WIN(0.006009009946012264), WIN(0.006045970097203285), WIN(0.006083050743790452),
+    WIN(0.006120251970321858), WIN(0.006157573861563959), WIN(0.006195016502501566), WIN(0.006232579978337233),
+    WIN(0.006270264374491116), WIN(0.006308069776600797), WIN(0.006345996270520557), WIN(0.0063840439423217266),
+    WIN(0.006422212878291714), WIN(0.006460503164934059), WIN(0.006498914888968185), WIN(0.006537448137328761),
+    WIN(0.006576102997165836), WIN(0.006614879555844), WIN(0.006653777900942612), WIN(0.0066927981202551945),
+    WIN(0.006731940301789002), WIN(0.006771204533765063), WIN(0.006810590904617553), WIN(0.006850099502993701),
+    WIN(0.006889730417753245), WIN(0.0069294837379684365), WIN(0.006969359552923285), WIN(0.007009357952113701),
+    WIN(0.007049479025246941), WIN(0.00708972286224116), WIN(0.007130089553225333), WIN(0.0071705791885389725),
+    WIN(0.007211191858731397), WIN(0.007251927654562021), WIN(0.00729278666699941), WIN(0.007333768987221434),
+    WIN(0.007374874706614645), WIN(0.007416103916774122), WIN(0.007457456709503096), WIN(0.007498933176812592),
+    WIN(0.007540533410921063), WIN(0.007582257504254286), WIN(0.007624105549444649), WIN(0.007666077639331165),
+    WIN(0.007708173866959003), WIN(0.007750394325579141), WIN(0.00779273910864807), WIN(0.007835208309827521),
+    WIN(0.00787780202298391), WIN(0.007920520342188209), WIN(0.00796336336171563), WIN(0.008006331176045142),
+    WIN(0.008049423879859269), WIN(0.00809264156804354), WIN(0.008135984335686477), WIN(0.008179452278078925),
+    WIN(0.008223045490713968), WIN(0.008266764069286434), WIN(0.0083106081096926), WIN(0.008354577708029803),
+    WIN(0.008398672960596335), WIN(0.00844289396389064), WIN(0.0084872408146114), WIN(0.00853171360965703),
+    WIN(0.008576312446125306), WIN(0.008621037421312927), WIN(0.008665888632715432), WIN(0.008710866178026619),
+    WIN(0.008755970155138293), WIN(0.008801200662139949), WIN(0.00884655779731823), WIN(0.008892041659156885),
+    WIN(0.008937652346336103), WIN(0.008983389957732402), WIN(0.009029254592418143), WIN(0.009075246349661129),
+    WIN(0.009121365328924519), WIN(0.009167611629865999), WIN(0.009213985352337986), WIN(0.00926048659638691),
+    WIN(0.009307115462252755), WIN(0.009353872050369125), WIN(0.009400756461362514), WIN(0.009447768796052067),
+    WIN(0.009494909155449344), WIN(0.009542177640757585), WIN(0.009589574353371946), WIN(0.009637099394878446),
+    WIN(0.009684752867054142), WIN(0.009732534871866538), WIN(0.009780445511473237), WIN(0.009828484888221523),
+    WIN(0.009876653104648123), WIN(0.009924950263478824), WIN(0.009973376467627887), WIN(0.010021931820197907),
+    WIN(0.01007061642447947), WIN(0.010119430383950634), WIN(0.010168373802276559), WIN(0.010217446783309186),
+    WIN(0.01026664943108696), WIN(0.01031598184983426), WIN(0.01036544414396122), WIN(0.01041503641806317),
+    WIN(0.010464758776920324), WIN(0.010514611325497608), WIN(0.010564594168943856), WIN(0.01061470741259185),
+    WIN(0.010664951161957759), WIN(0.010715325522740612), WIN(0.010765830600822278), WIN(0.010816466502266704),
+    WIN(0.010867233333319896), WIN(0.010918131200409152), WIN(0.010969160210142978), WIN(0.011020320469310611),
+    WIN(0.011071612084881624), WIN(0.011123035164005458), WIN(0.011174589814011225), WIN(0.011226276142407163),
+    WIN(0.011278094256880318), WIN(0.011330044265296171), WIN(0.011382126275698061), WIN(0.011434340396307086),
+    WIN(0.011486686735521598), WIN(0.011539165401916733), WIN(0.011591776504244068), WIN(0.01164452015143131),
+    WIN(0.011697396452581693), WIN(0.01175040551697381), WIN(0.011803547454061154), WIN(0.011856822373471673),
+    WIN(0.011910230385007325), WIN(0.011963771598643827), WIN(0.012017446124530227), WIN(0.012071254072988341),
+    WIN(0.012125195554512573), WIN(0.012179270679769406), WIN(0.012233479559597034), WIN(0.012287822305004761),
+    WIN(0.012342299027173043), WIN(0.012396909837452667), WIN(0.01245165484736454), WIN(0.012506534168599252),
+    WIN(0.012561547913016634), WIN(0.01261669619264548), WIN(0.012671979119682895), WIN(0.012727396806494179),
+    WIN(0.012782949365612264), WIN(0.012838636909737224), WIN(0.01289445955173607), WIN(0.012950417404642256),
+    WIN(0.013006510581655112), WIN(0.013062739196139705), WIN(0.013119103361626257), WIN(0.013175603191809736),
+    WIN(0.013232238800549585), WIN(0.013289010301869054), WIN(0.01334591780995497), WIN(0.01340296143915741),
+    WIN(0.013460141303989093), WIN(0.013517457519124906), WIN(0.013574910199401859), WIN(0.013632499459818155),
+    WIN(0.013690225415533323), WIN(0.013748088181867298), WIN(0.013806087874300217), WIN(0.013864224608472274),
+    WIN(0.013922498500182678), WIN(0.013980909665389847), WIN(0.014039458220210514), WIN(0.01409814428091976),
+    WIN(0.014156967963950065), WIN(0.014215929385891383), WIN(0.014275028663490341), WIN(0.014334265913650106),
+    WIN(0.014393641253429734), WIN(0.014453154800043867), WIN(0.014512806670862306), WIN(0.014572596983409375),
+    WIN(0.014632525855363905), WIN(0.01469259340455848), WIN(0.01475279974897896), WIN(0.014813145006764346),
+    WIN(0.01487362929620619), WIN(0.014934252735748048), WIN(0.014995015443985238), WIN(0.015055917539664336),
+    WIN(0.015116959141682665), WIN(0.015178140369087982), WIN(0.015239461341078037), WIN(0.015300922177000006),
+    WIN(0.015362522996350228), WIN(0.0154242639187736), WIN(0.01548614506406324), WIN(0.015548166552160167),
+    WIN(0.015610328503152512), WIN(0.01567263103727537), WIN(0.015735074274910443), WIN(0.015797658336585176),
+    WIN(0.01586038334297278), WIN(0.01592324941489151), WIN(0.01598625667330436), WIN(0.016049405239318422),
+    WIN(0.016112695234184793), WIN(0.01617612677929771), WIN(0.016239699996194554), WIN(0.016303415006554897),
+    WIN(0.0163672719322005), WIN(0.016431270895094732), WIN(0.01649541201734197), WIN(0.016559695421187223),
+    WIN(0.016624121229015916), WIN(0.01668868956335308), WIN(0.016753400546863133), WIN(0.016818254302349386),
+    WIN(0.016883250952753594), WIN(0.016948390621155343), WIN(0.017013673430771946), WIN(0.017079099504957694),
+    WIN(0.017144668967203396), WIN(0.017210381941136207), WIN(0.01727623855051886), WIN(0.01734223891924931),
+    WIN(0.017408383171360453), WIN(0.017474671431019446), WIN(0.017541103822527333), WIN(0.017607680470318528),
+    WIN(0.017674401498960504), WIN(0.017741267033153152), WIN(0.017808277197728546), WIN(0.017875432117650178),
+    WIN(0.017942731918012864), WIN(0.018010176724041885), WIN(0.01807776666109283), WIN(0.01814550185465108),
+    WIN(0.018213382430331264), WIN(0.018281408513876732), WIN(0.018349580231159297), WIN(0.018417897708178664),
+    WIN(0.018486361071061906), WIN(0.018554970446063024), WIN(0.0186237259595627), WIN(0.018692627738067402),
+    WIN(0.018761675908209242), WIN(0.01883087059674554), WIN(0.018900211930558075), WIN(0.018969700036652826),
+    WIN(0.019039335042159544), WIN(0.019109117074331092), WIN(0.019179046260543037), WIN(0.0192491227282934),
+    WIN(0.01931934660520178), WIN(0.019389718019009294), WIN(0.019460237097577757), WIN(0.01953090396888943),
+    WIN(0.019601718761046515), WIN(0.019672681602270564), WIN(0.019743792620902194), WIN(0.01981505194540044),
+    WIN(0.019886459704342205), WIN(0.01995801602642218), WIN(0.02002972104045197), WIN(0.020101574875359657),
+    WIN(0.020173577660189554), WIN(0.020245729524101558), WIN(0.020318030596370697), WIN(0.02039048100638663),
+    WIN(0.020463080883653104), WIN(0.02053583035778779), WIN(0.020608729558521298), WIN(0.0206817786156972),
+    WIN(0.020754977659271118), WIN(0.02082832681931051), WIN(0.020901826225994173), WIN(0.020975476009611617),
+    WIN(0.021049276300562615), WIN(0.021123227229356896), WIN(0.02119732892661346), WIN(0.021271581523060086),
+    WIN(0.021345985149532974), WIN(0.021420539936976263), WIN(0.021495246016441316), WIN(0.02157010351908651),
+    WIN(0.0216451125761766), WIN(0.02172027331908219), WIN(0.02179558587927951), WIN(0.02187105038834951),
+    WIN(0.021946666977977633), WIN(0.022022435779953366), WIN(0.022098356926169516), WIN(0.022174430548621976),
+    WIN(0.02225065677940906), WIN(0.022327035750731007), WIN(0.022403567594889658), WIN(0.0224802524442878),
+    WIN(0.02255709043142865), WIN(0.022634081688915432), WIN(0.02271122634945099), WIN(0.022788524545837012),
+    WIN(0.022865976410973793), WIN(0.022943582077859667), WIN(0.023021341679590288), WIN(0.02309925534935857),
+    WIN(0.02317732322045376), WIN(0.023255545426261175), WIN(0.023333922100261605), WIN(0.023412453376030998),
+    WIN(0.023491139387239596), WIN(0.02356998026765178), WIN(0.0236489761511254), WIN(0.02372812717161131),
+    WIN(0.023807433463152887), WIN(0.023886895159885395), WIN(0.023966512396035686), WIN(0.024046285305921594),
+    WIN(0.02412621402395139), WIN(0.02420629868462338), WIN(0.024286539422525205), WIN(0.024366936372333572),
+    WIN(0.02444748966881366), WIN(0.024528199446818555), WIN(0.02460906584128865), WIN(0.024690088987251495),
+    WIN(0.02477126901982092), WIN(0.024852606074196676), WIN(0.024934100285663924), WIN(0.025015751789592665),
+    WIN(0.025097560721437387), WIN(0.02517952721673635), WIN(0.02526165141111119), WIN(0.025343933440266295),
+    WIN(0.025426373439988645), WIN(0.025508971546146654), WIN(0.025591727894690358), WIN(0.02567464262165038),
+    WIN(0.02575771586313775), WIN(0.025840947755343152), WIN(0.02592433843453653), WIN(0.026007888037066537),
+    WIN(0.0260915966993601), WIN(0.02617546455792183), WIN(0.026259491749333348), WIN(0.026343678410253167),
+    WIN(0.026428024677415722), WIN(0.026512530687631167), WIN(0.026597196577784796), WIN(0.02668202248483642),
+    WIN(0.02676700854581987), WIN(0.026852154897842602), WIN(0.026937461678084966), WIN(0.027022929023799977),
+    WIN(0.027108557072312446), WIN(0.027194345961018725), WIN(0.027280295827386114), WIN(0.027366406808952234),
+    WIN(0.027452679043324595), WIN(0.027539112668180127), WIN(0.027625707821264618), WIN(0.02771246464039199),
+    WIN(0.027799383263444152), WIN(0.02788646382837008), WIN(0.027973706473185714), WIN(0.028061111335972895),
+    WIN(0.028148678554879326), WIN(0.028236408268117873), WIN(0.02832430061396593), WIN(0.028412355730765046),
+    WIN(0.028500573756920305), WIN(0.028588954830899793), WIN(0.028677499091234175), WIN(0.02876620667651599),
+    WIN(0.028855077725399345), WIN(0.028944112376599156), WIN(0.02903331076889072), WIN(0.02912267304110923),
+    WIN(0.029212199332149233), WIN(0.02930188978096395), WIN(0.02939174452656497), WIN(0.02948176370802147),
+    WIN(0.029571947464459958), WIN(0.029662295935063407), WIN(0.02975280925907113), WIN(0.029843487575777913),
+    WIN(0.029934331024533523), WIN(0.030025339744742315), WIN(0.030116513875862616), WIN(0.030207853557406197),
+    WIN(0.030299358928937682), WIN(0.030391030130074118), WIN(0.030482867300484343), WIN(0.030574870579888495),
+    WIN(0.030667040108057493), WIN(0.030759376024812393), WIN(0.030851878470024012), WIN(0.03094454758361225),
+    WIN(0.031037383505545593), WIN(0.031130386375840625), WIN(0.031223556334561392), WIN(0.03131689352181896),
+    WIN(0.03141039807777084), WIN(0.031504070142620355), WIN(0.031597909856616195), WIN(0.031691917360051926),
+    WIN(0.03178609279326534), WIN(0.03188043629663795), WIN(0.03197494801059435), WIN(0.032069628075602),
+    WIN(0.032164476632170105), WIN(0.032259493820849805), WIN(0.032354679782233), WIN(0.03245003465695195),
+    WIN(0.032545558585679174), WIN(0.032641251709126136), WIN(0.03273711416804348), WIN(0.0328331461032199),
+    WIN(0.032929347655481875), WIN(0.033025718965693056), WIN(0.033122260174753726), WIN(0.03321897142360024),
+    WIN(0.03331585285320446), WIN(0.03341290460457336), WIN(0.03351012681874816), WIN(0.03360751963680401),
+    WIN(0.03370508319984959), WIN(0.033802817649026075), WIN(0.03390072312550701), WIN(0.03399879977049775),
+    WIN(0.03409704772523448), WIN(0.034195467130984265), WIN(0.03429405812904402), WIN(0.034392820860740254),
+    WIN(0.034491755467428234), WIN(0.03459086209049175), WIN(0.034690140871342375), WIN(0.03478959195141895),
+    WIN(0.034889215472187), WIN(0.03498901157513823), WIN(0.03508898040178991), WIN(0.03518912209368445),
+    WIN(0.035289436792388634), WIN(0.035389924639493295), WIN(0.035490585776612564), WIN(0.03559142034538344),
+    WIN(0.03569242848746525), WIN(0.03579361034453893), WIN(0.03589496605830665), WIN(0.03599649577049109),
+    WIN(0.036098199622835114), WIN(0.03620007775710099), WIN(0.0363021303150699), WIN(0.03640435743854145),
+    WIN(0.03650675926933296), WIN(0.03660933594927916), WIN(0.036712087620231315), WIN(0.036815014424056935),
+    WIN(0.03691811650263911), WIN(0.037021393997875796), WIN(0.03712484705167958), WIN(0.03722847580597689),
+    WIN(0.03733228040270736), WIN(0.03743626098382366), WIN(0.037540417691290365), WIN(0.037644750667083934),
+    WIN(0.03774926005319185), WIN(0.0378539459916121), WIN(0.03795880862435255), WIN(0.038063848093430636),
+    WIN(0.038169064540872516), WIN(0.038274458108712696), WIN(0.03838002893899324), WIN(0.038485777173763586),
+    WIN(0.03859170295507954), WIN(0.038697806425003034), WIN(0.03880408772560151), WIN(0.03891054699894713),
+    WIN(0.039017184387116544), WIN(0.03912400003219004), WIN(0.039230994076251205), WIN(0.039338166661386106),
+    WIN(0.03944551792968302), WIN(0.03955304802323163), WIN(0.03966075708412258), WIN(0.03976864525444688),
+    WIN(0.03987671267629526), WIN(0.0399849594917578), WIN(0.040093385842923046), WIN(0.04020199187187788),
+    WIN(0.0403107777207065), WIN(0.04041974353149019), WIN(0.0405288894463065), WIN(0.040638215607228856),
+    WIN(0.040747722156325925), WIN(0.04085740923566114), WIN(0.04096727698729187), WIN(0.04107732555326914),
+    WIN(0.04118755507563683), WIN(0.04129796569643139), WIN(0.04140855755768097), WIN(0.04151933080140495),
+    WIN(0.04163028556961354), WIN(0.041741422004306875), WIN(0.04185274024747479), WIN(0.041964240441095965),
+    WIN(0.042075922727137574), WIN(0.042187787247554606), WIN(0.0422998341442892), WIN(0.04241206355927031),
+    WIN(0.04252447563441297), WIN(0.042637070511617664), WIN(0.042749848332769874), WIN(0.04286280923973956),
+    WIN(0.04297595337438034), WIN(0.04308928087852923), WIN(0.04320279189400583), WIN(0.0433164865626119),
+    WIN(0.04343036502613057), WIN(0.043544427426325985), WIN(0.043658673904942755), WIN(0.04377310460370523),
+    WIN(0.043887719664316885), WIN(0.04400251922845999), WIN(0.04411750343779479), WIN(0.044232672433958925),
+    WIN(0.04434802635856723), WIN(0.044463565353210645), WIN(0.044579289559455906), WIN(0.044695199118845064),
+    WIN(0.04481129417289457), WIN(0.04492757486309515), WIN(0.04504404133091079), WIN(0.045160693717778484),
+    WIN(0.04527753216510737), WIN(0.04539455681427855), WIN(0.04551176780664408), WIN(0.045629165283526625),
+    WIN(0.04574674938621892), WIN(0.04586452025598295), WIN(0.045982478034049694), WIN(0.046100622861618326),
+    WIN(0.046218954879855736), WIN(0.0463374742298958), WIN(0.04645618105283901), WIN(0.04657507548975181),
+    WIN(0.04669415768166588), WIN(0.04681342776957786), WIN(0.046932885894448384), WIN(0.047052532197201916),
+    WIN(0.0471723668187259), WIN(0.047292389899870016), WIN(0.0474126015814462), WIN(0.047533002004227394),
+    WIN(0.04765359130894743), WIN(0.047774369636300135), WIN(0.047895337126939), WIN(0.04801649392147647),
+    WIN(0.048137840160483364), WIN(0.04825937598448837), WIN(0.04838110153397726), WIN(0.04850301694939259),
+    WIN(0.048625122371133034), WIN(0.048747417939552576), WIN(0.048869903794960284), WIN(0.04899258007761938),
+    WIN(0.049115446927746956), WIN(0.049238504485513125), WIN(0.04936175289104084), WIN(0.04948519228440469),
+    WIN(0.04960882280563093), WIN(0.049732644594696576), WIN(0.0498566577915289), WIN(0.04998086253600473),
+    WIN(0.05010525896795012), WIN(0.050229847227139475), WIN(0.0503546274532953), WIN(0.05047959978608716),
+    WIN(0.050604764365131616), WIN(0.05073012132999132), WIN(0.05085567082017431), WIN(0.05098141297513395),
+    WIN(0.051107347934267654), WIN(0.05123347583691696), WIN(0.05135979682236644), WIN(0.05148631102984346),
+    WIN(0.05161301859851734), WIN(0.05173991966749897), WIN(0.051867014375840056), WIN(0.05199430286253275),
+    WIN(0.05212178526650876), WIN(0.05224946172663912), WIN(0.05237733238173326), WIN(0.05250539737053868),
+    WIN(0.05263365683174025), WIN(0.05276211090395966), WIN(0.05289075972575478), WIN(0.05301960343561916),
+    WIN(0.05314864217198128), WIN(0.05327787607320427), WIN(0.053407305277585), WIN(0.05353692992335365),
+    WIN(0.05366675014867315), WIN(0.05379676609163844), WIN(0.0539269778902762), WIN(0.054057385682543854),
+    WIN(0.05418798960632924), WIN(0.054318789799449985), WIN(0.05444978639965285), WIN(0.05458097954461338),
+    WIN(0.05471236937193492), WIN(0.054843956019148335), WIN(0.054975739623711384), WIN(0.05510772032300786),
+    WIN(0.05523989825434751), WIN(0.05537227355496498), WIN(0.05550484636201947), WIN(0.055637616812594104),
+    WIN(0.05577058504369527), WIN(0.055903751192252056), WIN(0.05603711539511588), WIN(0.05617067778905953),
+    WIN(0.05630443851077681), WIN(0.05643839769688202), WIN(0.05657255548390903), WIN(0.056706912008311176),
+    WIN(0.05684146740646029), WIN(0.05697622181464615), WIN(0.057111175369076186), WIN(0.057246328205874525),
+    WIN(0.057381680461081705), WIN(0.057517232270653786), WIN(0.05765298377046201), WIN(0.05778893509629222),
+    WIN(0.05792508638384397), WIN(0.058061437768730385), WIN(0.05819798938647722), WIN(0.058334741372522286),
+    WIN(0.05847169386221527), WIN(0.05860884699081648), WIN(0.058746200893496865), WIN(0.058883755705337194),
+    WIN(0.05902151156132729), WIN(0.05915946859636572), WIN(0.05929762694525911), WIN(0.05943598674272148),
+    WIN(0.059574548123373795), WIN(0.05971331122174326), WIN(0.05985227617226278), WIN(0.05999144310927042),
+    WIN(0.06013081216700868), WIN(0.06027038347962402), WIN(0.06041015718116637), WIN(0.0605501334055882),
+    WIN(0.060690312286744284), WIN(0.06083069395839097), WIN(0.06097127855418563), WIN(0.061112066207685986),
+    WIN(0.06125305705234957), WIN(0.06139425122153314), WIN(0.061535648848492275), WIN(0.06167725006638031),
+    WIN(0.06181905500824828), WIN(0.061961063807044046), WIN(0.062103276595611746), WIN(0.06224569350669121),
+    WIN(0.06238831467291738), WIN(0.06253114022681985), WIN(0.06267417030082201), WIN(0.0628174050272406),
+    WIN(0.06296084453828528), WIN(0.0631044889660578), WIN(0.06324833844255148), WIN(0.06339239309965064),
+    WIN(0.06353665306913016), WIN(0.06368111848265459), WIN(0.06382578947177776), WIN(0.06397066616794227),
+    WIN(0.06411574870247869), WIN(0.06426103720660507), WIN(0.06440653181142636), WIN(0.06455223264793389),
+    WIN(0.0646981398470047), WIN(0.06484425353940083), WIN(0.06499057385576912), WIN(0.06513710092664016),
+    WIN(0.06528383488242795), WIN(0.06543077585342932), WIN(0.0655779239698234), WIN(0.06572527936167082),
+    WIN(0.0658728421589132), WIN(0.0660206124913727), WIN(0.0661685904887513), WIN(0.06631677628063032),
+    WIN(0.06646516999646962), WIN(0.06661377176560732), WIN(0.06676258171725892), WIN(0.06691159998051693),
+    WIN(0.06706082668435016), WIN(0.06721026195760325), WIN(0.06735990592899596), WIN(0.06750975872712257),
+    WIN(0.06765982048045145), WIN(0.06781009131732432), WIN(0.06796057136595587), WIN(0.06811126075443284),
+    WIN(0.0682621596107137), WIN(0.06841326806262805), WIN(0.06856458623787591), WIN(0.06871611426402727),
+    WIN(0.06886785226852138), WIN(0.06901980037866619), WIN(0.0691719587216379), WIN(0.06932432742448014),
+    WIN(0.06947690661410373), WIN(0.06962969641728568), WIN(0.06978269696066884), WIN(0.0699359083707614),
+    WIN(0.07008933077393606), WIN(0.0702429642964297), WIN(0.07039680906434262), WIN(0.07055086520363793),
+    WIN(0.07070513284014121), WIN(0.07085961209953959), WIN(0.07101430310738145), WIN(0.07116920598907575),
+    WIN(0.07132432086989136), WIN(0.07147964787495653), WIN(0.07163518712925836), WIN(0.07179093875764211),
+    WIN(0.07194690288481079), WIN(0.07210307963532434), WIN(0.0722594691335993), WIN(0.0724160715039081),
+    WIN(0.07257288687037824), WIN(0.07272991535699232), WIN(0.07288715708758682), WIN(0.07304461218585197),
+    WIN(0.07320228077533078), WIN(0.07336016297941879), WIN(0.07351825892136339), WIN(0.07367656872426313),
+    WIN(0.07383509251106726), WIN(0.07399383040457512), WIN(0.0741527825274355), WIN(0.07431194900214615),
+    WIN(0.07447132995105314), WIN(0.07463092549635031), WIN(0.07479073576007865), WIN(0.0749507608641257),
+    WIN(0.07511100093022516), WIN(0.07527145607995607), WIN(0.07543212643474229), WIN(0.07559301211585207),
+    WIN(0.07575411324439715), WIN(0.0759154299413327), WIN(0.0760769623274562), WIN(0.07623871052340706),
+    WIN(0.07640067464966628), WIN(0.07656285482655545), WIN(0.07672525117423652), WIN(0.07688786381271107),
+    WIN(0.07705069286181972), WIN(0.0772137384412415), WIN(0.07737700067049355), WIN(0.0775404796689301),
+    WIN(0.07770417555574247), WIN(0.07786808844995778), WIN(0.078032218470439), WIN(0.07819656573588415),
+    WIN(0.07836113036482543), WIN(0.07852591247562934), WIN(0.07869091218649524), WIN(0.07885612961545557),
+    WIN(0.07902156488037465), WIN(0.07918721809894852), WIN(0.0793530893887042), WIN(0.07951917886699911),
+    WIN(0.07968548665102052), WIN(0.07985201285778495), WIN(0.0800187576041377), WIN(0.08018572100675204),
+    WIN(0.08035290318212894), WIN(0.08052030424659626), WIN(0.08068792431630832), WIN(0.08085576350724513),
+    WIN(0.08102382193521213), WIN(0.08119209971583936), WIN(0.08136059696458099), WIN(0.08152931379671469),
+    WIN(0.08169825032734104), WIN(0.08186740667138316), WIN(0.08203678294358588), WIN(0.08220637925851529),
+    WIN(0.08237619573055822), WIN(0.08254623247392148), WIN(0.08271648960263145), WIN(0.08288696723053357),
+    WIN(0.08305766547129159), WIN(0.08322858443838713), WIN(0.0833997242451189), WIN(0.08357108500460252),
+    WIN(0.08374266682976954), WIN(0.08391446983336714), WIN(0.08408649412795745), WIN(0.08425873982591701),
+    WIN(0.08443120703943618), WIN(0.08460389588051852), WIN(0.08477680646098042), WIN(0.08494993889245031),
+    WIN(0.08512329328636821), WIN(0.0852968697539851), WIN(0.08547066840636229), WIN(0.08564468935437133),
+    WIN(0.08581893270869252), WIN(0.08599339857981533), WIN(0.08616808707803712), WIN(0.08634299831346294),
+    WIN(0.08651813239600491), WIN(0.08669348943538147), WIN(0.0868690695411171), WIN(0.0870448728225416),
+    WIN(0.08722089938878935), WIN(0.08739714934879914), WIN(0.08757362281131334), WIN(0.08775031988487733),
+    WIN(0.08792724067783907), WIN(0.08810438529834837), WIN(0.08828175385435658), WIN(0.0884593464536157),
+    WIN(0.08863716320367807), WIN(0.08881520421189575), WIN(0.08899346958541986), WIN(0.08917195943120004),
+    WIN(0.0893506738559842), WIN(0.08952961296631738), WIN(0.08970877686854167), WIN(0.0898881656687954),
+    WIN(0.09006777947301281), WIN(0.09024761838692319), WIN(0.09042768251605059), WIN(0.09060797196571307),
+    WIN(0.09078848684102223), WIN(0.09096922724688263), WIN(0.09115019328799123), WIN(0.09133138506883695),
+    WIN(0.09151280269369985), WIN(0.09169444626665077), WIN(0.09187631589155076), WIN(0.09205841167205048),
+    WIN(0.09224073371158964), WIN(0.09242328211339644), WIN(0.09260605698048711), WIN(0.09278905841566515),
+    WIN(0.09297228652152101), WIN(0.09315574140043131), WIN(0.09333942315455859), WIN(0.0935233318858503),
+    WIN(0.0937074676960387), WIN(0.09389183068664), WIN(0.09407642095895412), WIN(0.0942612386140637),
+    WIN(0.0944462837528339), WIN(0.09463155647591169), WIN(0.09481705688372541), WIN(0.09500278507648408),
+    WIN(0.09518874115417694), WIN(0.09537492521657291), WIN(0.09556133736321995), WIN(0.09574797769344454),
+    WIN(0.09593484630635123), WIN(0.09612194330082197), WIN(0.09630926877551563), WIN(0.09649682282886736),
+    WIN(0.09668460555908816), WIN(0.09687261706416422), WIN(0.09706085744185663), WIN(0.0972493267897003),
+    WIN(0.0974380252050039), WIN(0.09762695278484931), WIN(0.0978161096260906), WIN(0.09800549582535409),
+    WIN(0.09819511147903737), WIN(0.09838495668330896), WIN(0.09857503153410754), WIN(0.09876533612714178),
+    WIN(0.09895587055788949), WIN(0.09914663492159723), WIN(0.09933762931327957), WIN(0.09952885382771877),
+    WIN(0.09972030855946416), WIN(0.09991199360283154), WIN(0.10010390905190272), WIN(0.10029605500052491),
+    WIN(0.10048843154231032), WIN(0.10068103877063522), WIN(0.10087387677863996), WIN(0.10106694565922811),
+    WIN(0.1012602455050659), WIN(0.1014537764085817), WIN(0.10164753846196567), WIN(0.10184153175716891),
+    WIN(0.1020357563859032), WIN(0.10223021243964034), WIN(0.10242490000961157), WIN(0.1026198191868071),
+    WIN(0.10281497006197553), WIN(0.1030103527256234), WIN(0.10320596726801456), WIN(0.10340181377916967),
+    WIN(0.10359789234886559), WIN(0.10379420306663498), WIN(0.1039907460217658), WIN(0.10418752130330046),
+    WIN(0.10438452900003563), WIN(0.10458176920052152), WIN(0.10477924199306149), WIN(0.10497694746571129),
+    WIN(0.1051748857062788), WIN(0.10537305680232334), WIN(0.1055714608411551), WIN(0.10577009790983471),
+    WIN(0.10596896809517264), WIN(0.10616807148372881), WIN(0.10636740816181181), WIN(0.10656697821547856),
+    WIN(0.10676678173053378), WIN(0.10696681879252931), WIN(0.1071670894867638), WIN(0.10736759389828204),
+    WIN(0.10756833211187442), WIN(0.1077693042120764), WIN(0.10797051028316802), WIN(0.10817195040917357),
+    WIN(0.10837362467386075), WIN(0.10857553316074016), WIN(0.10877767595306496), WIN(0.1089800531338304),
+    WIN(0.10918266478577296), WIN(0.10938551099137012), WIN(0.10958859183283978), WIN(0.10979190739213965),
+    WIN(0.1099954577509668), WIN(0.1101992429907571), WIN(0.11040326319268473), WIN(0.11060751843766178),
+    WIN(0.11081200880633729), WIN(0.11101673437909726), WIN(0.11122169523606386), WIN(0.11142689145709508),
+    WIN(0.11163232312178378), WIN(0.1118379903094578), WIN(0.11204389309917892), WIN(0.11225003156974259),
+    WIN(0.11245640579967744), WIN(0.11266301586724466), WIN(0.11286986185043746), WIN(0.11307694382698058),
+    WIN(0.11328426187432988), WIN(0.1134918160696719), WIN(0.11369960648992286), WIN(0.11390763321172873),
+    WIN(0.11411589631146431), WIN(0.1143243958652331), WIN(0.11453313194886622), WIN(0.11474210463792259),
+    WIN(0.11495131400768792), WIN(0.11516076013317428), WIN(0.11537044308911976), WIN(0.11558036294998775),
+    WIN(0.11579051978996677), WIN(0.11600091368296947), WIN(0.11621154470263256), WIN(0.11642241292231593),
+    WIN(0.1166335184151025), WIN(0.11684486125379759), WIN(0.11705644151092819), WIN(0.11726825925874271),
+    WIN(0.11748031456921061), WIN(0.11769260751402122), WIN(0.11790513816458426), WIN(0.11811790659202828),
+    WIN(0.11833091286720089), WIN(0.11854415706066815), WIN(0.11875763924271368), WIN(0.11897135948333848),
+    WIN(0.11918531785226052), WIN(0.11939951441891392), WIN(0.11961394925244861), WIN(0.11982862242172995),
+    WIN(0.12004353399533801), WIN(0.12025868404156725), WIN(0.12047407262842579), WIN(0.12068969982363531),
+    WIN(0.12090556569463015), WIN(0.121121670308557), WIN(0.12133801373227422), WIN(0.12155459603235196),
+    WIN(0.1217714172750706), WIN(0.12198847752642131), WIN(0.12220577685210499), WIN(0.12242331531753164),
+    WIN(0.1226410929878207), WIN(0.12285910992779928), WIN(0.1230773662020027), WIN(0.1232958618746739),
+    WIN(0.12351459700976228), WIN(0.12373357167092383), WIN(0.12395278592152041), WIN(0.12417223982461939),
+    WIN(0.12439193344299296), WIN(0.12461186683911776), WIN(0.12483204007517448), WIN(0.1250524532130472),
+    WIN(0.125273106314323), WIN(0.12549399944029135), WIN(0.12571513265194392), WIN(0.1259365060099738),
+    WIN(0.12615811957477496), WIN(0.12637997340644222), WIN(0.12660206756477033), WIN(0.12682440210925344),
+    WIN(0.12704697709908525), WIN(0.12726979259315752), WIN(0.1274928486500606), WIN(0.12771614532808243),
+    WIN(0.1279396826852077), WIN(0.1281634607791185), WIN(0.1283874796671925), WIN(0.12861173940650333),
+    WIN(0.12883624005382024), WIN(0.12906098166560662), WIN(0.1292859642980207), WIN(0.1295111880069142),
+    WIN(0.1297366528478323), WIN(0.12996235887601332), WIN(0.13018830614638752), WIN(0.13041449471357736),
+    WIN(0.1306409246318967), WIN(0.13086759595535044), WIN(0.13109450873763395), WIN(0.13132166303213255),
+    WIN(0.1315490588919214), WIN(0.13177669636976427), WIN(0.13200457551811415), WIN(0.13223269638911161),
+    WIN(0.1324610590345854), WIN(0.13268966350605124), WIN(0.1329185098547115), WIN(0.13314759813145519),
+    WIN(0.13337692838685672), WIN(0.13360650067117602), WIN(0.13383631503435822), WIN(0.13406637152603232),
+    WIN(0.1342966701955116), WIN(0.1345272110917928), WIN(0.1347579942635556), WIN(0.1349890197591625),
+    WIN(0.13522028762665772), WIN(0.13545179791376735), WIN(0.13568355066789872), WIN(0.1359155459361397),
+    WIN(0.13614778376525857), WIN(0.1363802642017034), WIN(0.1366129872916016), WIN(0.13684595308075925),
+    WIN(0.13707916161466122), WIN(0.13731261293847014), WIN(0.1375463070970262), WIN(0.1377802441348468),
+    WIN(0.13801442409612552), WIN(0.13824884702473264), WIN(0.13848351296421385), WIN(0.13871842195778997),
+    WIN(0.13895357404835704), WIN(0.13918896927848495), WIN(0.1394246076904177), WIN(0.13966048932607303),
+    WIN(0.13989661422704108), WIN(0.1401329824345851), WIN(0.14036959398964), WIN(0.14060644893281257),
+    WIN(0.14084354730438092), WIN(0.14108088914429356), WIN(0.14131847449216958), WIN(0.14155630338729788),
+    WIN(0.14179437586863675), WIN(0.14203269197481347), WIN(0.14227125174412383), WIN(0.1425100552145318),
+    WIN(0.14274910242366878), WIN(0.14298839340883374), WIN(0.1432279282069919), WIN(0.1434677068547754),
+    WIN(0.14370772938848192), WIN(0.14394799584407444), WIN(0.14418850625718144), WIN(0.14442926066309544),
+    WIN(0.1446702590967734), WIN(0.144911501592836), WIN(0.14515298818556702), WIN(0.14539471890891312),
+    WIN(0.14563669379648342), WIN(0.14587891288154886), WIN(0.14612137619704224), WIN(0.14636408377555699),
+    WIN(0.14660703564934752), WIN(0.1468502318503283), WIN(0.1470936724100738), WIN(0.14733735735981768),
+    WIN(0.14758128673045257), WIN(0.1478254605525298), WIN(0.14806987885625836), WIN(0.1483145416715054),
+    WIN(0.148559449027795), WIN(0.1488046009543082), WIN(0.1490499974798823), WIN(0.14929563863301049),
+    WIN(0.1495415244418417), WIN(0.14978765493418003), WIN(0.15003403013748381), WIN(0.15028065007886623),
+    WIN(0.15052751478509388), WIN(0.1507746242825869), WIN(0.1510219785974187), WIN(0.15126957775531474),
+    WIN(0.15151742178165326), WIN(0.15176551070146374), WIN(0.15201384453942718), WIN(0.15226242331987577),
+    WIN(0.15251124706679176), WIN(0.1527603158038077), WIN(0.15300962955420583), WIN(0.15325918834091756),
+    WIN(0.1535089921865233), WIN(0.15375904111325178), WIN(0.15400933514297974), WIN(0.15425987429723154),
+    WIN(0.15451065859717888), WIN(0.15476168806364), WIN(0.15501296271707976), WIN(0.155264482577609),
+    WIN(0.1555162476649838), WIN(0.15576825799860589), WIN(0.15602051359752137), WIN(0.15627301448042077),
+    WIN(0.1565257606656389), WIN(0.15677875217115353), WIN(0.15703198901458618), WIN(0.15728547121320066),
+    WIN(0.15753919878390324), WIN(0.15779317174324237), WIN(0.15804739010740765), WIN(0.1583018538922301),
+    WIN(0.1585565631131813), WIN(0.1588115177853733), WIN(0.15906671792355814), WIN(0.15932216354212722),
+    WIN(0.1595778546551112), WIN(0.15983379127617953), WIN(0.16008997341863992), WIN(0.16034640109543818),
+    WIN(0.1606030743191576), WIN(0.1608599931020188), WIN(0.16111715745587876), WIN(0.1613745673922315),
+    WIN(0.16163222292220664), WIN(0.16189012405656938), WIN(0.16214827080572053), WIN(0.1624066631796952),
+    WIN(0.16266530118816355), WIN(0.16292418484042942), WIN(0.16318331414543036), WIN(0.16344268911173748),
+    WIN(0.1637023097475545), WIN(0.16396217606071775), WIN(0.16422228805869604), WIN(0.16448264574858945),
+    WIN(0.1647432491371298), WIN(0.1650040982306797), WIN(0.16526519303523254), WIN(0.16552653355641206),
+    WIN(0.16578811979947156), WIN(0.16604995176929405), WIN(0.16631202947039164), WIN(0.16657435290690517),
+    WIN(0.16683692208260367), WIN(0.1670997370008845), WIN(0.16736279766477252), WIN(0.16762610407691955),
+    WIN(0.16788965623960478), WIN(0.16815345415473337), WIN(0.1684174978238371), WIN(0.16868178724807337),
+    WIN(0.16894632242822455), WIN(0.16921110336469875), WIN(0.16947613005752815), WIN(0.16974140250636943),
+    WIN(0.17000692071050344), WIN(0.1702726846688342), WIN(0.17053869437988903), WIN(0.17080494984181824),
+    WIN(0.1710714510523944), WIN(0.1713381980090125), WIN(0.17160519070868885), WIN(0.1718724291480615),
+    WIN(0.17213991332338927), WIN(0.17240764323055183), WIN(0.1726756188650491), WIN(0.17294384022200088),
+    WIN(0.17321230729614673), WIN(0.17348102008184513), WIN(0.1737499785730738), WIN(0.17401918276342884),
+    WIN(0.17428863264612454), WIN(0.17455832821399295), WIN(0.17482826945948346), WIN(0.175098456374663),
+    WIN(0.17536888895121494), WIN(0.17563956718043902), WIN(0.17591049105325135), WIN(0.17618166056018342),
+    WIN(0.17645307569138222), WIN(0.17672473643661002), WIN(0.17699664278524324), WIN(0.17726879472627327),
+    WIN(0.1775411922483049), WIN(0.1778138353395568), WIN(0.1780867239878613), WIN(0.17835985818066302),
+    WIN(0.1786332379050197), WIN(0.17890686314760118), WIN(0.1791807338946894), WIN(0.17945485013217743),
+    WIN(0.17972921184557025), WIN(0.1800038190199834), WIN(0.18027867164014308), WIN(0.18055376969038583),
+    WIN(0.1808291131546578), WIN(0.18110470201651518), WIN(0.18138053625912326), WIN(0.18165661586525586),
+    WIN(0.1819329408172961), WIN(0.18220951109723474), WIN(0.18248632668667075), WIN(0.18276338756681088),
+    WIN(0.18304069371846862), WIN(0.18331824512206513), WIN(0.18359604175762745), WIN(0.18387408360478938),
+    WIN(0.18415237064279075), WIN(0.18443090285047664), WIN(0.1847096802062978), WIN(0.18498870268830978),
+    WIN(0.18526797027417297), WIN(0.185547482941152), WIN(0.1858272406661156), WIN(0.18610724342553622),
+    WIN(0.18638749119548964), WIN(0.18666798395165485), WIN(0.1869487216693135), WIN(0.18722970432334973),
+    WIN(0.1875109318882499), WIN(0.1877924043381019), WIN(0.18807412164659554), WIN(0.18835608378702168),
+    WIN(0.18863829073227176), WIN(0.1889207424548384), WIN(0.18920343892681377), WIN(0.1894863801198906),
+    WIN(0.1897695660053611), WIN(0.19005299655411656), WIN(0.19033667173664764), WIN(0.1906205915230435),
+    WIN(0.19090475588299188), WIN(0.19118916478577855), WIN(0.19147381820028714), WIN(0.19175871609499878),
+    WIN(0.19204385843799177), WIN(0.19232924519694133), WIN(0.19261487633911945), WIN(0.1929007518313942),
+    WIN(0.19318687164022988), WIN(0.19347323573168626), WIN(0.19375984407141883), WIN(0.19404669662467788),
+    WIN(0.19433379335630885), WIN(0.19462113423075156), WIN(0.19490871921203995), WIN(0.19519654826380228),
+    WIN(0.19548462134925987), WIN(0.19577293843122812), WIN(0.19606149947211518), WIN(0.19635030443392165),
+    WIN(0.19663935327824134), WIN(0.1969286459662597), WIN(0.19721818245875417), WIN(0.1975079627160945),
+    WIN(0.19779798669824078), WIN(0.19808825436474486), WIN(0.19837876567474927), WIN(0.19866952058698684),
+    WIN(0.19896051905978104), WIN(0.19925176105104483), WIN(0.19954324651828112), WIN(0.1998349754185821),
+    WIN(0.20012694770862927), WIN(0.20041916334469267), WIN(0.20071162228263115), WIN(0.2010043244778918),
+    WIN(0.20129726988550956), WIN(0.2015904584601073), WIN(0.20188389015589542), WIN(0.20217756492667138),
+    WIN(0.2024714827258195), WIN(0.20276564350631088), WIN(0.20306004722070303), WIN(0.2033546938211396),
+    WIN(0.2036495832593499), WIN(0.20394471548664916), WIN(0.20424009045393757), WIN(0.2045357081117007),
+    WIN(0.2048315684100086), WIN(0.20512767129851608), WIN(0.20542401672646252), WIN(0.20572060464267056),
+    WIN(0.20601743499554714), WIN(0.20631450773308257), WIN(0.2066118228028504), WIN(0.20690938015200705),
+    WIN(0.20720717972729188), WIN(0.20750522147502662), WIN(0.20780350534111497), WIN(0.208102031271043),
+    WIN(0.2084007992098783), WIN(0.20869980910226973), WIN(0.2089990608924478), WIN(0.2092985545242234),
+    WIN(0.20959828994098867), WIN(0.2098982670857159), WIN(0.21019848590095758), WIN(0.21049894632884633),
+    WIN(0.21079964831109438), WIN(0.21110059178899326), WIN(0.21140177670341426), WIN(0.2117032029948071),
+    WIN(0.21200487060320045), WIN(0.21230677946820153), WIN(0.21260892952899568), WIN(0.21291132072434668),
+    WIN(0.2132139529925954), WIN(0.2135168262716608), WIN(0.2138199404990391), WIN(0.21412329561180327),
+    WIN(0.2144268915466035), WIN(0.21473072823966632), WIN(0.2150348056267949), WIN(0.21533912364336813),
+    WIN(0.21564368222434122), WIN(0.215948481304245), WIN(0.21625352081718546), WIN(0.2165588006968443),
+    WIN(0.21686432087647767), WIN(0.2171700812889169), WIN(0.21747608186656775), WIN(0.21778232254141006),
+    WIN(0.2180888032449983), WIN(0.21839552390846023), WIN(0.21870248446249768), WIN(0.21900968483738567),
+    WIN(0.21931712496297248), WIN(0.21962480476867963), WIN(0.21993272418350096), WIN(0.2202408831360032),
+    WIN(0.2205492815543254), WIN(0.22085791936617866), WIN(0.22116679649884585), WIN(0.22147591287918184),
+    WIN(0.2217852684336129), WIN(0.22209486308813609), WIN(0.22240469676832036), WIN(0.222714769399305),
+    WIN(0.2230250809058), WIN(0.22333563121208588), WIN(0.22364642024201317), WIN(0.22395744791900268),
+    WIN(0.22426871416604516), WIN(0.22458021890570032), WIN(0.22489196206009815), WIN(0.22520394355093715),
+    WIN(0.22551616329948504), WIN(0.2258286212265787), WIN(0.22614131725262304), WIN(0.22645425129759184),
+    WIN(0.22676742328102675), WIN(0.22708083312203753), WIN(0.22739448073930218), WIN(0.22770836605106554),
+    WIN(0.22802248897514046), WIN(0.22833684942890692), WIN(0.22865144732931172), WIN(0.22896628259286883),
+    WIN(0.22928135513565873), WIN(0.22959666487332828), WIN(0.22991221172109078), WIN(0.23022799559372556),
+    WIN(0.23054401640557792), WIN(0.23086027407055876), WIN(0.2311767685021447), WIN(0.2314934996133774),
+    WIN(0.23181046731686422), WIN(0.2321276715247771), WIN(0.23244511214885266), WIN(0.23276278910039283),
+    WIN(0.23308070229026323), WIN(0.23339885162889434), WIN(0.2337172370262803), WIN(0.23403585839197943),
+    WIN(0.2343547156351139), WIN(0.23467380866436913), WIN(0.2349931373879941), WIN(0.23531270171380117),
+    WIN(0.23563250154916554), WIN(0.2359525368010254), WIN(0.2362728073758817), WIN(0.23659331317979787),
+    WIN(0.23691405411839972), WIN(0.23723503009687538), WIN(0.23755624101997497), WIN(0.23787768679201043),
+    WIN(0.23819936731685565), WIN(0.23852128249794563), WIN(0.23884343223827736), WIN(0.2391658164404088),
+    WIN(0.23948843500645867), WIN(0.2398112878381074), WIN(0.24013437483659528), WIN(0.24045769590272387),
+    WIN(0.2407812509368551), WIN(0.24110503983891063), WIN(0.2414290625083732), WIN(0.24175331884428472),
+    WIN(0.24207780874524726), WIN(0.24240253210942297), WIN(0.2427274888345327), WIN(0.24305267881785741),
+    WIN(0.24337810195623705), WIN(0.24370375814607045), WIN(0.24402964728331603), WIN(0.24435576926349029),
+    WIN(0.24468212398166875), WIN(0.24500871133248542), WIN(0.2453355312101328), WIN(0.24566258350836134),
+    WIN(0.24598986812047985), WIN(0.24631738493935507), WIN(0.2466451338574113), WIN(0.24697311476663086),
+    WIN(0.24730132755855347), WIN(0.2476297721242762), WIN(0.2479584483544537), WIN(0.2482873561392971),
+    WIN(0.2486164953685754), WIN(0.24894586593161383), WIN(0.24927546771729459), WIN(0.24960530061405672),
+    WIN(0.24993536450989534), WIN(0.2502656592923622), WIN(0.2505961848485653), WIN(0.2509269410651685),
+    WIN(0.25125792782839224), WIN(0.251589145024012), WIN(0.2519205925373596), WIN(0.25225227025332236),
+    WIN(0.25258417805634303), WIN(0.25291631583041974), WIN(0.253248683459106), WIN(0.25358128082551046),
+    WIN(0.25391410781229645), WIN(0.25424716430168265), WIN(0.2545804501754425), WIN(0.25491396531490396),
+    WIN(0.25524770960094967), WIN(0.2555816829140164), WIN(0.25591588513409597), WIN(0.2562503161407339),
+    WIN(0.25658497581302975), WIN(0.25691986402963773), WIN(0.25725498066876534), WIN(0.25759032560817413),
+    WIN(0.2579258987251797), WIN(0.2582616998966505), WIN(0.2585977289990093), WIN(0.2589339859082317),
+    WIN(0.25927047049984664), WIN(0.2596071826489369), WIN(0.2599441222301375), WIN(0.26028128911763704),
+    WIN(0.2606186831851768), WIN(0.26095630430605093), WIN(0.2612941523531064), WIN(0.26163222719874263),
+    WIN(0.26197052871491167), WIN(0.26230905677311805), WIN(0.2626478112444186), WIN(0.26298679199942243),
+    WIN(0.2633259989082908), WIN(0.2636654318407372), WIN(0.26400509066602684), WIN(0.2643449752529773),
+    WIN(0.26468508546995734), WIN(0.2650254211848879), WIN(0.265365982265242), WIN(0.26570676857804304),
+    WIN(0.26604777998986734), WIN(0.26638901636684154), WIN(0.26673047757464413), WIN(0.26707216347850504),
+    WIN(0.26741407394320477), WIN(0.26775620883307555), WIN(0.2680985680120003), WIN(0.2684411513434132),
+    WIN(0.268783958690299), WIN(0.26912698991519346), WIN(0.26947024488018306), WIN(0.2698137234469051),
+    WIN(0.27015742547654714), WIN(0.27050135082984783), WIN(0.2708454993670958), WIN(0.27118987094813035),
+    WIN(0.27153446543234094), WIN(0.27187928267866773), WIN(0.2722243225456008), WIN(0.2725695848911802),
+    WIN(0.2729150695729967), WIN(0.27326077644819047), WIN(0.2736067053734521), WIN(0.2739528562050221),
+    WIN(0.27429922879869034), WIN(0.2746458230097973), WIN(0.27499263869323265), WIN(0.2753396757034358),
+    WIN(0.2756869338943964), WIN(0.27603441311965304), WIN(0.2763821132322941), WIN(0.27673003408495755),
+    WIN(0.27707817552983066), WIN(0.27742653741865053), WIN(0.2777751196027032), WIN(0.27812392193282404),
+    WIN(0.278472944259398), WIN(0.278822186432359), WIN(0.2791716483011904), WIN(0.2795213297149245),
+    WIN(0.2798712305221429), WIN(0.28022135057097597), WIN(0.2805716897091036), WIN(0.28092224778375424),
+    WIN(0.2812730246417056), WIN(0.2816240201292843), WIN(0.28197523409236547), WIN(0.28232666637637377),
+    WIN(0.28267831682628214), WIN(0.2830301852866125), WIN(0.2833822716014358), WIN(0.2837345756143713),
+    WIN(0.28408709716858727), WIN(0.2844398361068006), WIN(0.28479279227127674), WIN(0.2851459655038302),
+    WIN(0.2854993556458235), WIN(0.2858529625381683), WIN(0.28620678602132427), WIN(0.2865608259353002),
+    WIN(0.2869150821196532), WIN(0.2872695544134888), WIN(0.28762424265546127), WIN(0.2879791466837728),
+    WIN(0.28833426633617487), WIN(0.2886896014499668), WIN(0.28904515186199664), WIN(0.2894009174086609),
+    WIN(0.2897568979259041), WIN(0.2901130932492196), WIN(0.2904695032136492), WIN(0.2908261276537826),
+    WIN(0.29118296640375857), WIN(0.2915400192972636), WIN(0.29189728616753285), WIN(0.2922547668473502),
+    WIN(0.292612461169047), WIN(0.292970368964504), WIN(0.2933284900651496), WIN(0.29368682430196075),
+    WIN(0.29404537150546306), WIN(0.2944041315057301), WIN(0.29476310413238394), WIN(0.29512228921459505),
+    WIN(0.29548168658108237), WIN(0.29584129606011317), WIN(0.29620111747950306), WIN(0.29656115066661615),
+    WIN(0.2969213954483647), WIN(0.29728185165121), WIN(0.2976425191011609), WIN(0.29800339762377565),
+    WIN(0.2983644870441603), WIN(0.29872578718696935), WIN(0.2990872978764064), WIN(0.299449018936223),
+    WIN(0.2998109501897193), WIN(0.3001730914597444), WIN(0.30053544256869547), WIN(0.3008980033385184),
+    WIN(0.3012607735907079), WIN(0.30162375314630707), WIN(0.301986941825908), WIN(0.30235033944965106),
+    WIN(0.3027139458372255), WIN(0.3030777608078693), WIN(0.3034417841803693), WIN(0.303806015773061),
+    WIN(0.3041704554038288), WIN(0.304535102890106), WIN(0.3048999580488745), WIN(0.3052650206966655),
+    WIN(0.305630290649559), WIN(0.30599576772318393), WIN(0.3063614517327184), WIN(0.3067273424928893),
+    WIN(0.30709343981797294), WIN(0.3074597435217948), WIN(0.30782625341772907), WIN(0.30819296931869977),
+    WIN(0.30855989103717973), WIN(0.30892701838519115), WIN(0.30929435117430615), WIN(0.3096618892156453),
+    WIN(0.3100296323198796), WIN(0.31039758029722875), WIN(0.31076573295746235), WIN(0.31113409010989984),
+    WIN(0.3115026515634098), WIN(0.31187141712641075), WIN(0.31224038660687103), WIN(0.31260955981230876),
+    WIN(0.31297893654979186), WIN(0.31334851662593827), WIN(0.3137182998469157), WIN(0.31408828601844213),
+    WIN(0.3144584749457856), WIN(0.31482886643376395), WIN(0.31519946028674595), WIN(0.3155702563086501),
+    WIN(0.3159412543029451), WIN(0.31631245407265074), WIN(0.31668385542033667), WIN(0.31705545814812314),
+    WIN(0.3174272620576816), WIN(0.3177992669502332), WIN(0.31817147262655093), WIN(0.3185438788869576),
+    WIN(0.31891648553132745), WIN(0.3192892923590859), WIN(0.31966229916920863), WIN(0.3200355057602232),
+    WIN(0.32040891193020793), WIN(0.32078251747679265), WIN(0.3211563221971583), WIN(0.32153032588803737),
+    WIN(0.32190452834571387), WIN(0.3222789293660234), WIN(0.3226535287443532), WIN(0.3230283262756422),
+    WIN(0.32340332175438125), WIN(0.3237785149746133), WIN(0.3241539057299326), WIN(0.32452949381348634),
+    WIN(0.32490527901797367), WIN(0.3252812611356455), WIN(0.325657439958306), WIN(0.3260338152773108),
+    WIN(0.3264103868835688), WIN(0.3267871545675416), WIN(0.3271641181192427), WIN(0.32754127732823946),
+    WIN(0.3279186319836514), WIN(0.3282961818741514), WIN(0.3286739267879657), WIN(0.32905186651287327),
+    WIN(0.32943000083620666), WIN(0.3298083295448519), WIN(0.33018685242524837), WIN(0.33056556926338954),
+    WIN(0.330944479844822), WIN(0.33132358395464656), WIN(0.33170288137751797), WIN(0.3320823718976451),
+    WIN(0.33246205529879047), WIN(0.33284193136427176), WIN(0.33322199987696055), WIN(0.33360226061928266),
+    WIN(0.3339827133732192), WIN(0.33436335792030547), WIN(0.33474419404163197), WIN(0.3351252215178442),
+    WIN(0.3355064401291421), WIN(0.3358878496552818), WIN(0.33626944987557394), WIN(0.33665124056888507),
+    WIN(0.3370332215136373), WIN(0.3374153924878081), WIN(0.3377977532689312), WIN(0.3381803036340959),
+    WIN(0.33856304335994764), WIN(0.3389459722226886), WIN(0.33932908999807637), WIN(0.3397123964614257),
+    WIN(0.3400958913876076), WIN(0.3404795745510499), WIN(0.34086344572573735), WIN(0.3412475046852115),
+    WIN(0.34163175120257133), WIN(0.3420161850504725), WIN(0.3424008060011289), WIN(0.3427856138263112),
+    WIN(0.34317060829734797), WIN(0.343555789185126), WIN(0.34394115626008925), WIN(0.34432670929224046),
+    WIN(0.34471244805114043), WIN(0.3450983723059078), WIN(0.3454844818252208), WIN(0.3458707763773152),
+    WIN(0.3462572557299862), WIN(0.3466439196505883), WIN(0.347030767906034), WIN(0.34741780026279634),
+    WIN(0.3478050164869068), WIN(0.3481924163439569), WIN(0.3485799995990979), WIN(0.3489677660170407),
+    WIN(0.3493557153620565), WIN(0.34974384739797637), WIN(0.35013216188819213), WIN(0.3505206585956554),
+    WIN(0.3509093372828795), WIN(0.3512981977119377), WIN(0.3516872396444647), WIN(0.35207646284165617),
+    WIN(0.35246586706426897), WIN(0.35285545207262187), WIN(0.353245217626595), WIN(0.35363516348562996),
+    WIN(0.35402528940873124), WIN(0.3544155951544644), WIN(0.35480608048095813), WIN(0.35519674514590344),
+    WIN(0.35558758890655345), WIN(0.35597861151972504), WIN(0.35636981274179724), WIN(0.3567611923287126),
+    WIN(0.35715275003597746), WIN(0.3575444856186609), WIN(0.35793639883139616), WIN(0.3583284894283804),
+    WIN(0.3587207571633747), WIN(0.3591132017897046), WIN(0.3595058230602598), WIN(0.3598986207274948),
+    WIN(0.36029159454342896), WIN(0.3606847442596464), WIN(0.36107806962729666), WIN(0.36147157039709443),
+    WIN(0.3618652463193204), WIN(0.36225909714382015), WIN(0.36265312262000615), WIN(0.3630473224968565),
+    WIN(0.3634416965229154), WIN(0.3638362444462943), WIN(0.3642309660146704), WIN(0.3646258609752889),
+    WIN(0.36502092907496114), WIN(0.365416170060066), WIN(0.3658115836765505), WIN(0.3662071696699284),
+    WIN(0.366602927785282), WIN(0.36699885776726143), WIN(0.36739495936008526), WIN(0.3677912323075405),
+    WIN(0.36818767635298305), WIN(0.36858429123933734), WIN(0.3689810767090973), WIN(0.369378032504326),
+    WIN(0.36977515836665614), WIN(0.37017245403729016), WIN(0.37056991925700056), WIN(0.3709675537661295),
+    WIN(0.3713653573045904), WIN(0.3717633296118668), WIN(0.37216147042701275), WIN(0.37255977948865415),
+    WIN(0.37295825653498726), WIN(0.37335690130378063), WIN(0.373755713532374), WIN(0.3741546929576789),
+    WIN(0.3745538393161798), WIN(0.37495315234393245), WIN(0.37535263177656586), WIN(0.375752277349282),
+    WIN(0.37615208879685524), WIN(0.3765520658536337), WIN(0.3769522082535388), WIN(0.37735251573006573),
+    WIN(0.37775298801628376), WIN(0.37815362484483606), WIN(0.3785544259479403), WIN(0.378955391057389),
+    WIN(0.37935651990454927), WIN(0.3797578122203636), WIN(0.38015926773534964), WIN(0.38056088617960077),
+    WIN(0.3809626672827857), WIN(0.3813646107741502), WIN(0.38176671638251547), WIN(0.3821689838362795),
+    WIN(0.38257141286341734), WIN(0.3829740031914805), WIN(0.38337675454759834), WIN(0.3837796666584776),
+    WIN(0.38418273925040236), WIN(0.3845859720492354), WIN(0.3849893647804172), WIN(0.38539291716896695),
+    WIN(0.3857966289394827), WIN(0.38620049981614124), WIN(0.38660452952269925), WIN(0.387008717782492),
+    WIN(0.3874130643184353), WIN(0.3878175688530246), WIN(0.38822223110833576), WIN(0.3886270508060251),
+    WIN(0.38903202766733), WIN(0.38943716141306867), WIN(0.3898424517636404), WIN(0.39024789843902663),
+    WIN(0.3906535011587904), WIN(0.3910592596420764), WIN(0.3914651736076127), WIN(0.39187124277370877),
+    WIN(0.3922774668582582), WIN(0.39268384557873703), WIN(0.39309037865220453), WIN(0.3934970657953046),
+    WIN(0.39390390672426423), WIN(0.3943109011548949), WIN(0.3947180488025932), WIN(0.39512534938233956),
+    WIN(0.3955328026087001), WIN(0.3959404081958262), WIN(0.39634816585745475), WIN(0.3967560753069088),
+    WIN(0.39716413625709723), WIN(0.39757234842051553), WIN(0.3979807115092461), WIN(0.398389225234958),
+    WIN(0.39879788930890797), WIN(0.39920670344194015), WIN(0.3996156673444867), WIN(0.40002478072656755),
+    WIN(0.40043404329779164), WIN(0.4008434547673563), WIN(0.40125301484404785), WIN(0.4016627232362423),
+    WIN(0.40207257965190457), WIN(0.4024825837985903), WIN(0.4028927353834449), WIN(0.40330303411320395),
+    WIN(0.4037134796941946), WIN(0.40412407183233423), WIN(0.4045348102331322), WIN(0.4049456946016893),
+    WIN(0.4053567246426982), WIN(0.4057679000604442), WIN(0.40617922055880473), WIN(0.4065906858412503),
+    WIN(0.40700229561084467), WIN(0.40741404957024485), WIN(0.40782594742170186), WIN(0.40823798886706064),
+    WIN(0.40865017360776085), WIN(0.4090625013448361), WIN(0.4094749717789159), WIN(0.4098875846102246),
+    WIN(0.4103003395385823), WIN(0.4107132362634051), WIN(0.41112627448370487), WIN(0.4115394538980909),
+    WIN(0.4119527742047687), WIN(0.4123662351015412), WIN(0.412779836285809), WIN(0.41319357745457014),
+    WIN(0.413607458304421), WIN(0.4140214785315569), WIN(0.414435637831771), WIN(0.4148499359004566),
+    WIN(0.4152643724326056), WIN(0.41567894712281), WIN(0.41609365966526224), WIN(0.4165085097537545),
+    WIN(0.41692349708168), WIN(0.41733862134203314), WIN(0.4177538822274097), WIN(0.418169279430007),
+    WIN(0.41858481264162445), WIN(0.419000481553664), WIN(0.4194162858571302), WIN(0.4198322252426307),
+    WIN(0.42024829940037645), WIN(0.4206645080201823), WIN(0.42108085079146695), WIN(0.4214973274032534),
+    WIN(0.4219139375441699), WIN(0.4223306809024493), WIN(0.4227475571659298), WIN(0.423164566022056),
+    WIN(0.4235817071578776), WIN(0.42399898026005167), WIN(0.4244163850148415), WIN(0.4248339211081178),
+    WIN(0.42525158822535863), WIN(0.4256693860516498), WIN(0.4260873142716853), WIN(0.42650537256976784),
+    WIN(0.4269235606298089), WIN(0.427341878135329), WIN(0.4277603247694585), WIN(0.42817890021493743),
+    WIN(0.4285976041541164), WIN(0.42901643626895636), WIN(0.42943539624102944), WIN(0.4298544837515189),
+    WIN(0.4302736984812201), WIN(0.43069304011053977), WIN(0.43111250831949804), WIN(0.43153210278772713),
+    WIN(0.43195182319447206), WIN(0.43237166921859266), WIN(0.4327916405385611), WIN(0.43321173683246494),
+    WIN(0.43363195777800595), WIN(0.4340523030525003), WIN(0.4344727723328808), WIN(0.43489336529569456),
+    WIN(0.43531408161710533), WIN(0.43573492097289396), WIN(0.4361558830384571), WIN(0.4365769674888089),
+    WIN(0.4369981739985813), WIN(0.43741950224202397), WIN(0.43784095189300526), WIN(0.43826252262501136),
+    WIN(0.43868421411114844), WIN(0.4391060260241416), WIN(0.43952795803633593), WIN(0.4399500098196965),
+    WIN(0.4403721810458092), WIN(0.440794471385881), WIN(0.4412168805107397), WIN(0.4416394080908353),
+    WIN(0.44206205379623964), WIN(0.4424848172966474), WIN(0.4429076982613758), WIN(0.4433306963593651),
+    WIN(0.44375381125918006), WIN(0.4441770426290087), WIN(0.44460039013666364), WIN(0.44502385344958284),
+    WIN(0.4454474322348288), WIN(0.44587112615908986), WIN(0.4462949348886805), WIN(0.4467188580895416),
+    WIN(0.4471428954272409), WIN(0.44756704656697277), WIN(0.44799131117356), WIN(0.44841568891145284),
+    WIN(0.44884017944473), WIN(0.4492647824370991), WIN(0.44968949755189686), WIN(0.45011432445209),
+    WIN(0.4505392628002741), WIN(0.45096431225867656), WIN(0.4513894724891549), WIN(0.4518147431531977),
+    WIN(0.4522401239119256), WIN(0.45266561442609055), WIN(0.4530912143560779), WIN(0.4535169233619053),
+    WIN(0.4539427411032235), WIN(0.4543686672393176), WIN(0.45479470142910583), WIN(0.45522084333114154),
+    WIN(0.4556470926036133), WIN(0.456073448904344), WIN(0.4564999118907934), WIN(0.4569264812200566),
+    WIN(0.4573531565488652), WIN(0.45777993753358903), WIN(0.4582068238302338), WIN(0.4586338150944439),
+    WIN(0.4590609109815018), WIN(0.45948811114632876), WIN(0.45991541524348495), WIN(0.46034282292717016),
+    WIN(0.4607703338512244), WIN(0.4611979476691274), WIN(0.4616256640340005), WIN(0.4620534825986058),
+    WIN(0.4624814030153471), WIN(0.4629094249362705), WIN(0.4633375480130643), WIN(0.4637657718970602),
+    WIN(0.46419409623923297), WIN(0.4646225206902011), WIN(0.465051044900228), WIN(0.46547966851922085),
+    WIN(0.465908391196733), WIN(0.46633721258196226), WIN(0.46676613232375325), WIN(0.46719515007059703),
+    WIN(0.46762426547063096), WIN(0.4680534781716403), WIN(0.4684827878210578), WIN(0.4689121940659646),
+    WIN(0.46934169655309044), WIN(0.46977129492881403), WIN(0.4702009888391638), WIN(0.4706307779298181),
+    WIN(0.47106066184610584), WIN(0.4714906402330067), WIN(0.4719207127351516), WIN(0.4723508789968237),
+    WIN(0.4727811386619576), WIN(0.47321149137414154), WIN(0.47364193677661637), WIN(0.47407247451227624),
+    WIN(0.4745031042236705), WIN(0.47493382555300134), WIN(0.47536463814212754), WIN(0.47579554163256255),
+    WIN(0.47622653566547524), WIN(0.47665761988169203), WIN(0.4770887939216949), WIN(0.47752005742562365),
+    WIN(0.47795141003327624), WIN(0.47838285138410813), WIN(0.4788143811172335), WIN(0.4792459988714261),
+    WIN(0.47967770428511863), WIN(0.4801094969964048), WIN(0.48054137664303753), WIN(0.48097334286243176),
+    WIN(0.4814053952916635), WIN(0.4818375335674708), WIN(0.4822697573262537), WIN(0.4827020662040756),
+    WIN(0.4831344598366632), WIN(0.4835669378594063), WIN(0.4839994999073602), WIN(0.4844321456152437),
+    WIN(0.48486487461744177), WIN(0.48529768654800465), WIN(0.4857305810406486), WIN(0.4861635577287572),
+    WIN(0.48659661624538025), WIN(0.4870297562232359), WIN(0.4874629772947104), WIN(0.48789627909185795),
+    WIN(0.4883296612464024), WIN(0.4887631233897371), WIN(0.48919666515292487), WIN(0.48963028616670007),
+    WIN(0.49006398606146695), WIN(0.49049776446730203), WIN(0.4909316210139535), WIN(0.49136555533084203),
+    WIN(0.49179956704706124), WIN(0.4922336557913784), WIN(0.49266782119223457), WIN(0.4931020628777448),
+    WIN(0.49353638047570003), WIN(0.4939707736135659), WIN(0.49440524191848406), WIN(0.49483978501727277),
+    WIN(0.49527440253642674), WIN(0.49570909410211883), WIN(0.49614385934019933), WIN(0.49657869787619663),
+    WIN(0.49701360933531885), WIN(0.4974485933424525), WIN(0.4978836495221647), WIN(0.4983187774987031),
+    WIN(0.4987539768959954), WIN(0.49918924733765174), WIN(0.4996245884469632), WIN(0.5000599998469039),
+    WIN(0.500495481160131), WIN(0.5009310320089844), WIN(0.5013666520154887), WIN(0.5018023408013523),
+    WIN(0.5022380979879691), WIN(0.5026739231964181), WIN(0.5031098160474645), WIN(0.5035457761615598),
+    WIN(0.5039818031588426), WIN(0.5044178966591392), WIN(0.5048540562819633), WIN(0.5052902816465181),
+    WIN(0.5057265723716953), WIN(0.5061629280760757), WIN(0.5065993483779314), WIN(0.5070358328952241),
+    WIN(0.5074723812456071), WIN(0.5079089930464254), WIN(0.5083456679147158), WIN(0.5087824054672081),
+    WIN(0.5092192053203253), WIN(0.5096560670901839), WIN(0.5100929903925951), WIN(0.5105299748430648),
+    WIN(0.5109670200567937), WIN(0.5114041256486792), WIN(0.5118412912333143), WIN(0.5122785164249893),
+    WIN(0.512715800837692), WIN(0.513153144085108), WIN(0.5135905457806211), WIN(0.5140280055373149),
+    WIN(0.5144655229679719), WIN(0.5149030976850749), WIN(0.5153407293008075), WIN(0.5157784174270541),
+    WIN(0.5162161616754013), WIN(0.5166539616571376), WIN(0.5170918169832539), WIN(0.5175297272644453),
+    WIN(0.51796769211111), WIN(0.518405711133351), WIN(0.5188437839409761), WIN(0.5192819101434984),
+    WIN(0.5197200893501376), WIN(0.5201583211698191), WIN(0.520596605211176), WIN(0.5210349410825492),
+    WIN(0.521473328391987), WIN(0.5219117667472473), WIN(0.5223502557557965), WIN(0.5227887950248117),
+    WIN(0.5232273841611795), WIN(0.5236660227714981), WIN(0.524104710462077), WIN(0.5245434468389375),
+    WIN(0.5249822315078136), WIN(0.5254210640741525), WIN(0.5258599441431151), WIN(0.5262988713195768),
+    WIN(0.5267378452081267), WIN(0.527176865413071), WIN(0.5276159315384301), WIN(0.5280550431879418),
+    WIN(0.5284941999650611), WIN(0.5289334014729599), WIN(0.5293726473145286), WIN(0.5298119370923764),
+    WIN(0.5302512704088312), WIN(0.5306906468659418), WIN(0.5311300660654764), WIN(0.5315695276089242),
+    WIN(0.5320090310974966), WIN(0.5324485761321265), WIN(0.5328881623134696), WIN(0.5333277892419047),
+    WIN(0.5337674565175348), WIN(0.5342071637401866), WIN(0.5346469105094123), WIN(0.5350866964244892),
+    WIN(0.5355265210844208), WIN(0.5359663840879372), WIN(0.5364062850334955), WIN(0.536846223519281),
+    WIN(0.5372861991432072), WIN(0.5377262115029159), WIN(0.5381662601957795), WIN(0.5386063448188991),
+    WIN(0.539046464969108), WIN(0.5394866202429693), WIN(0.5399268102367788), WIN(0.5403670345465642),
+    WIN(0.5408072927680864), WIN(0.5412475844968394), WIN(0.5416879093280522), WIN(0.5421282668566876),
+    WIN(0.5425686566774439), WIN(0.5430090783847554), WIN(0.5434495315727931), WIN(0.5438900158354643),
+    WIN(0.5443305307664145), WIN(0.5447710759590272), WIN(0.5452116510064245), WIN(0.5456522555014685),
+    WIN(0.5460928890367601), WIN(0.5465335512046421), WIN(0.5469742415971974), WIN(0.547414959806251),
+    WIN(0.5478557054233704), WIN(0.5482964780398654), WIN(0.54873727724679), WIN(0.5491781026349422),
+    WIN(0.5496189537948637), WIN(0.5500598303168429), WIN(0.5505007317909132), WIN(0.5509416578068543),
+    WIN(0.5513826079541939), WIN(0.5518235818222065), WIN(0.552264578999915), WIN(0.5527055990760914),
+    WIN(0.5531466416392569), WIN(0.5535877062776831), WIN(0.5540287925793919), WIN(0.5544699001321566),
+    WIN(0.5549110285235023), WIN(0.5553521773407066), WIN(0.5557933461708002), WIN(0.5562345346005675),
+    WIN(0.5566757422165471), WIN(0.5571169686050322), WIN(0.557558213352072), WIN(0.5579994760434714),
+    WIN(0.5584407562647924), WIN(0.5588820536013539), WIN(0.5593233676382324), WIN(0.5597646979602641),
+    WIN(0.5602060441520433), WIN(0.5606474057979242), WIN(0.5610887824820219), WIN(0.5615301737882116),
+    WIN(0.5619715793001308), WIN(0.5624129986011789), WIN(0.5628544312745182), WIN(0.5632958769030745),
+    WIN(0.5637373350695373), WIN(0.5641788053563611), WIN(0.5646202873457655), WIN(0.5650617806197361),
+    WIN(0.5655032847600249), WIN(0.5659447993481511), WIN(0.5663863239654017), WIN(0.5668278581928317),
+    WIN(0.5672694016112657), WIN(0.5677109538012977), WIN(0.5681525143432914), WIN(0.5685940828173822),
+    WIN(0.5690356588034761), WIN(0.5694772418812521), WIN(0.5699188316301614), WIN(0.5703604276294285),
+    WIN(0.5708020294580524), WIN(0.5712436366948059), WIN(0.5716852489182376), WIN(0.572126865706672),
+    WIN(0.5725684866382098), WIN(0.5730101112907292), WIN(0.5734517392418857), WIN(0.5738933700691133),
+    WIN(0.5743350033496256), WIN(0.574776638660415), WIN(0.5752182755782544), WIN(0.575659913679698),
+    WIN(0.5761015525410813), WIN(0.5765431917385221), WIN(0.576984830847921), WIN(0.5774264694449617),
+    WIN(0.5778681071051122), WIN(0.5783097434036253), WIN(0.5787513779155394), WIN(0.5791930102156791),
+    WIN(0.5796346398786544), WIN(0.5800762664788638), WIN(0.5805178895904928), WIN(0.5809595087875169),
+    WIN(0.5814011236436997), WIN(0.5818427337325943), WIN(0.5822843386275454), WIN(0.5827259379016878),
+    WIN(0.5831675311279487), WIN(0.5836091178790483), WIN(0.5840506977274984), WIN(0.5844922702456055),
+    WIN(0.5849338350054702), WIN(0.5853753915789881), WIN(0.5858169395378512), WIN(0.5862584784535462),
+    WIN(0.5867000078973583), WIN(0.5871415274403694), WIN(0.5875830366534603), WIN(0.5880245351073101),
+    WIN(0.588466022372398), WIN(0.5889074980190028), WIN(0.5893489616172047), WIN(0.5897904127368855),
+    WIN(0.5902318509477283), WIN(0.5906732758192204), WIN(0.5911146869206514), WIN(0.5915560838211154),
+    WIN(0.5919974660895115), WIN(0.5924388332945445), WIN(0.5928801850047241), WIN(0.5933215207883681),
+    WIN(0.5937628402136013), WIN(0.5942041428483564), WIN(0.5946454282603753), WIN(0.595086696017208),
+    WIN(0.5955279456862166), WIN(0.5959691768345723), WIN(0.5964103890292588), WIN(0.5968515818370707),
+    WIN(0.5972927548246161), WIN(0.5977339075583162), WIN(0.598175039604407), WIN(0.5986161505289384),
+    WIN(0.5990572398977753), WIN(0.5994983072765997), WIN(0.5999393522309093), WIN(0.6003803743260205),
+    WIN(0.6008213731270668), WIN(0.6012623481990002), WIN(0.6017032991065925), WIN(0.6021442254144355),
+    WIN(0.6025851266869416), WIN(0.6030260024883456), WIN(0.6034668523827027), WIN(0.6039076759338918),
+    WIN(0.604348472705615), WIN(0.6047892422613984), WIN(0.605229984164594), WIN(0.6056706979783769),
+    WIN(0.6061113832657505), WIN(0.6065520395895437), WIN(0.6069926665124136), WIN(0.607433263596845),
+    WIN(0.6078738304051515), WIN(0.6083143664994765), WIN(0.6087548714417933), WIN(0.6091953447939064),
+    WIN(0.6096357861174512), WIN(0.6100761949738959), WIN(0.6105165709245414), WIN(0.6109569135305221),
+    WIN(0.6113972223528066), WIN(0.6118374969521987), WIN(0.6122777368893371), WIN(0.612717941724698),
+    WIN(0.6131581110185935), WIN(0.6135982443311739), WIN(0.6140383412224281), WIN(0.6144784012521827),
+    WIN(0.6149184239801055), WIN(0.6153584089657044), WIN(0.6157983557683278), WIN(0.6162382639471666),
+    WIN(0.6166781330612535), WIN(0.6171179626694642), WIN(0.6175577523305196), WIN(0.6179975016029837),
+    WIN(0.6184372100452667), WIN(0.6188768772156237), WIN(0.619316502672157), WIN(0.6197560859728164),
+    WIN(0.6201956266753994), WIN(0.6206351243375525), WIN(0.6210745785167707), WIN(0.6215139887704),
+    WIN(0.6219533546556364), WIN(0.6223926757295283), WIN(0.6228319515489756), WIN(0.6232711816707309),
+    WIN(0.6237103656514006), WIN(0.6241495030474452), WIN(0.6245885934151806), WIN(0.625027636310778),
+    WIN(0.6254666312902645), WIN(0.6259055779095246), WIN(0.6263444757243009), WIN(0.6267833242901935),
+    WIN(0.6272221231626628), WIN(0.6276608718970281), WIN(0.6280995700484695), WIN(0.6285382171720282),
+    WIN(0.6289768128226073), WIN(0.6294153565549736), WIN(0.6298538479237553), WIN(0.6302922864834462),
+    WIN(0.6307306717884038), WIN(0.6311690033928519), WIN(0.6316072808508797), WIN(0.6320455037164439),
+    WIN(0.6324836715433684), WIN(0.6329217838853453), WIN(0.6333598402959358), WIN(0.6337978403285707),
+    WIN(0.6342357835365513), WIN(0.6346736694730499), WIN(0.6351114976911105), WIN(0.63554926774365),
+    WIN(0.6359869791834576), WIN(0.6364246315631973), WIN(0.6368622244354077), WIN(0.6372997573525023),
+    WIN(0.6377372298667713), WIN(0.6381746415303804), WIN(0.6386119918953738), WIN(0.6390492805136742),
+    WIN(0.6394865069370821), WIN(0.6399236707172788), WIN(0.6403607714058247), WIN(0.6407978085541621),
+    WIN(0.6412347817136145), WIN(0.6416716904353889), WIN(0.6421085342705743), WIN(0.642545312770144),
+    WIN(0.642982025484956), WIN(0.6434186719657534), WIN(0.6438552517631662), WIN(0.6442917644277103),
+    WIN(0.6447282095097889), WIN(0.6451645865596941), WIN(0.6456008951276065), WIN(0.6460371347635964),
+    WIN(0.6464733050176251), WIN(0.6469094054395439), WIN(0.6473454355790964), WIN(0.6477813949859188),
+    WIN(0.6482172832095404), WIN(0.6486530997993849), WIN(0.64908884430477), WIN(0.6495245162749093),
+    WIN(0.649960115258912), WIN(0.6503956408057848), WIN(0.6508310924644318), WIN(0.651266469783655),
+    WIN(0.651701772312156), WIN(0.6521369995985354), WIN(0.6525721511912954), WIN(0.6530072266388381),
+    WIN(0.6534422254894687), WIN(0.6538771472913942), WIN(0.6543119915927255), WIN(0.6547467579414772),
+    WIN(0.6551814458855694), WIN(0.6556160549728263), WIN(0.6560505847509803), WIN(0.6564850347676697),
+    WIN(0.6569194045704408), WIN(0.6573536937067485), WIN(0.6577879017239561), WIN(0.6582220281693382),
+    WIN(0.6586560725900789), WIN(0.6590900345332744), WIN(0.659523913545933), WIN(0.6599577091749752),
+    WIN(0.6603914209672355), WIN(0.6608250484694632), WIN(0.6612585912283221), WIN(0.6616920487903923),
+    WIN(0.6621254207021693), WIN(0.6625587065100667), WIN(0.6629919057604166), WIN(0.6634250179994688),
+    WIN(0.6638580427733937), WIN(0.6642909796282802), WIN(0.6647238281101396), WIN(0.6651565877649044),
+    WIN(0.6655892581384296), WIN(0.6660218387764936), WIN(0.6664543292247979), WIN(0.666886729028969),
+    WIN(0.6673190377345587), WIN(0.6677512548870458), WIN(0.668183380031835), WIN(0.6686154127142581),
+    WIN(0.6690473524795764), WIN(0.6694791988729795), WIN(0.6699109514395866), WIN(0.6703426097244489),
+    WIN(0.6707741732725468), WIN(0.6712056416287943), WIN(0.6716370143380374), WIN(0.6720682909450555),
+    WIN(0.6724994709945629), WIN(0.6729305540312083), WIN(0.6733615395995765), WIN(0.6737924272441883),
+    WIN(0.6742232165095021), WIN(0.6746539069399142), WIN(0.6750844980797596), WIN(0.6755149894733125),
+    WIN(0.6759453806647876), WIN(0.6763756711983406), WIN(0.676805860618068), WIN(0.6772359484680097),
+    WIN(0.6776659342921488), WIN(0.6780958176344118), WIN(0.6785255980386703), WIN(0.6789552750487402),
+    WIN(0.6793848482083849), WIN(0.6798143170613142), WIN(0.6802436811511856), WIN(0.6806729400216049),
+    WIN(0.6811020932161268), WIN(0.6815311402782563), WIN(0.6819600807514489), WIN(0.6823889141791116),
+    WIN(0.6828176401046037), WIN(0.6832462580712364), WIN(0.6836747676222756), WIN(0.6841031683009411),
+    WIN(0.6845314596504083), WIN(0.6849596412138081), WIN(0.6853877125342278), WIN(0.6858156731547128),
+    WIN(0.6862435226182658), WIN(0.6866712604678488), WIN(0.6870988862463842), WIN(0.6875263994967534),
+    WIN(0.6879537997617997), WIN(0.6883810865843284), WIN(0.688808259507107), WIN(0.6892353180728674),
+    WIN(0.6896622618243043), WIN(0.6900890903040781), WIN(0.690515803054815), WIN(0.690942399619107),
+    WIN(0.691368879539514), WIN(0.6917952423585633), WIN(0.6922214876187511), WIN(0.6926476148625433),
+    WIN(0.6930736236323755), WIN(0.6934995134706545), WIN(0.6939252839197589), WIN(0.6943509345220398),
+    WIN(0.6947764648198211), WIN(0.6952018743554013), WIN(0.6956271626710536), WIN(0.6960523293090255),
+    WIN(0.6964773738115426), WIN(0.6969022957208063), WIN(0.6973270945789963), WIN(0.6977517699282706),
+    WIN(0.6981763213107661), WIN(0.6986007482686007), WIN(0.6990250503438724), WIN(0.6994492270786609),
+    WIN(0.6998732780150286), WIN(0.7002972026950205), WIN(0.700721000660665), WIN(0.7011446714539766),
+    WIN(0.7015682146169541), WIN(0.7019916296915828), WIN(0.7024149162198342), WIN(0.702838073743668),
+    WIN(0.7032611018050329), WIN(0.7036839999458658), WIN(0.7041067677080943), WIN(0.7045294046336357),
+    WIN(0.7049519102643995), WIN(0.7053742841422872), WIN(0.705796525809194), WIN(0.706218634807008),
+    WIN(0.7066406106776117), WIN(0.7070624529628834), WIN(0.7074841612046971), WIN(0.7079057349449241),
+    WIN(0.7083271737254332), WIN(0.7087484770880904), WIN(0.7091696445747622), WIN(0.7095906757273143),
+    WIN(0.7100115700876127), WIN(0.7104323271975265), WIN(0.7108529465989244), WIN(0.7112734278336797),
+    WIN(0.7116937704436692), WIN(0.7121139739707736), WIN(0.7125340379568796), WIN(0.712953961943879),
+    WIN(0.7133737454736709), WIN(0.7137933880881618), WIN(0.7142128893292666), WIN(0.7146322487389091),
+    WIN(0.7150514658590227), WIN(0.7154705402315518), WIN(0.7158894713984518), WIN(0.7163082589016908),
+    WIN(0.7167269022832485), WIN(0.7171454010851198), WIN(0.7175637548493135), WIN(0.7179819631178527),
+    WIN(0.7184000254327777), WIN(0.7188179413361447), WIN(0.7192357103700274), WIN(0.7196533320765187),
+    WIN(0.7200708059977295), WIN(0.7204881316757911), WIN(0.7209053086528545), WIN(0.7213223364710928),
+    WIN(0.7217392146727016), WIN(0.7221559427998984), WIN(0.7225725203949249), WIN(0.7229889470000469),
+    WIN(0.7234052221575555), WIN(0.7238213454097677), WIN(0.7242373162990279), WIN(0.7246531343677072),
+    WIN(0.7250687991582047), WIN(0.7254843102129493), WIN(0.7258996670743992), WIN(0.7263148692850437),
+    WIN(0.7267299163874034), WIN(0.7271448079240299), WIN(0.727559543437509), WIN(0.7279741224704597),
+    WIN(0.7283885445655348), WIN(0.7288028092654241), WIN(0.729216916112851), WIN(0.7296308646505774),
+    WIN(0.7300446544214019), WIN(0.7304582849681615), WIN(0.730871755833733), WIN(0.7312850665610318),
+    WIN(0.7316982166930144), WIN(0.7321112057726793), WIN(0.7325240333430661), WIN(0.7329366989472582),
+    WIN(0.7333492021283821), WIN(0.7337615424296091), WIN(0.7341737193941557), WIN(0.734585732565284),
+    WIN(0.7349975814863036), WIN(0.7354092657005712), WIN(0.7358207847514917), WIN(0.7362321381825195),
+    WIN(0.7366433255371586), WIN(0.737054346358964), WIN(0.7374652001915412), WIN(0.737875886578549),
+    WIN(0.7382864050636988), WIN(0.7386967551907554), WIN(0.7391069365035388), WIN(0.7395169485459229),
+    WIN(0.7399267908618397), WIN(0.7403364629952764), WIN(0.7407459644902785), WIN(0.74115529489095),
+    WIN(0.7415644537414534), WIN(0.7419734405860114), WIN(0.7423822549689082), WIN(0.7427908964344886),
+    WIN(0.74319936452716), WIN(0.7436076587913923), WIN(0.7440157787717199), WIN(0.7444237240127416),
+    WIN(0.7448314940591215), WIN(0.74523908845559), WIN(0.7456465067469438), WIN(0.7460537484780477),
+    WIN(0.746460813193835), WIN(0.7468677004393084), WIN(0.7472744097595405), WIN(0.7476809406996742),
+    WIN(0.7480872928049244), WIN(0.7484934656205778), WIN(0.7488994586919957), WIN(0.7493052715646117),
+    WIN(0.7497109037839343), WIN(0.750116354895548), WIN(0.7505216244451131), WIN(0.7509267119783669),
+    WIN(0.7513316170411252), WIN(0.7517363391792807), WIN(0.752140877938807), WIN(0.7525452328657571),
+    WIN(0.7529494035062645), WIN(0.7533533894065457), WIN(0.7537571901128977), WIN(0.754160805171702),
+    WIN(0.7545642341294237), WIN(0.754967476532613), WIN(0.7553705319279043), WIN(0.75577339986202),
+    WIN(0.7561760798817685), WIN(0.7565785715340464), WIN(0.7569808743658392), WIN(0.7573829879242203),
+    WIN(0.7577849117563555), WIN(0.7581866454094999), WIN(0.758588188431001), WIN(0.7589895403682986),
+    WIN(0.7593907007689253), WIN(0.7597916691805086), WIN(0.7601924451507704), WIN(0.7605930282275284),
+    WIN(0.7609934179586963), WIN(0.7613936138922849), WIN(0.7617936155764029), WIN(0.7621934225592586),
+    WIN(0.7625930343891587), WIN(0.7629924506145107), WIN(0.7633916707838225), WIN(0.7637906944457046),
+    WIN(0.7641895211488692), WIN(0.764588150442133), WIN(0.7649865818744158), WIN(0.7653848149947426),
+    WIN(0.765782849352244), WIN(0.766180684496157), WIN(0.7665783199758264), WIN(0.7669757553407045),
+    WIN(0.7673729901403519), WIN(0.7677700239244395), WIN(0.7681668562427484), WIN(0.7685634866451702),
+    WIN(0.7689599146817095), WIN(0.7693561399024822), WIN(0.7697521618577186), WIN(0.7701479800977626),
+    WIN(0.7705435941730733), WIN(0.7709390036342261), WIN(0.7713342080319117), WIN(0.7717292069169388),
+    WIN(0.7721239998402345), WIN(0.7725185863528438), WIN(0.7729129660059323), WIN(0.7733071383507852),
+    WIN(0.7737011029388093), WIN(0.7740948593215331), WIN(0.774488407050608), WIN(0.7748817456778088),
+    WIN(0.7752748747550343), WIN(0.7756677938343088), WIN(0.7760605024677822), WIN(0.7764530002077307),
+    WIN(0.7768452866065584), WIN(0.7772373612167963), WIN(0.7776292235911062), WIN(0.7780208732822782),
+    WIN(0.7784123098432331), WIN(0.778803532827023), WIN(0.7791945417868316), WIN(0.7795853362759764),
+    WIN(0.7799759158479073), WIN(0.7803662800562091), WIN(0.7807564284546018), WIN(0.7811463605969404),
+    WIN(0.7815360760372172), WIN(0.7819255743295621), WIN(0.7823148550282426), WIN(0.7827039176876658),
+    WIN(0.7830927618623773), WIN(0.7834813871070643), WIN(0.7838697929765551), WIN(0.7842579790258198),
+    WIN(0.7846459448099714), WIN(0.7850336898842659), WIN(0.7854212138041046), WIN(0.7858085161250328),
+    WIN(0.7861955964027431), WIN(0.7865824541930737), WIN(0.7869690890520101), WIN(0.7873555005356865),
+    WIN(0.7877416882003859), WIN(0.7881276516025414), WIN(0.7885133902987362), WIN(0.7888989038457042),
+    WIN(0.7892841918003325), WIN(0.7896692537196601), WIN(0.7900540891608799), WIN(0.79043869768134),
+    WIN(0.7908230788385419), WIN(0.7912072321901442), WIN(0.7915911572939618), WIN(0.791974853707967),
+    WIN(0.7923583209902906), WIN(0.7927415586992218), WIN(0.7931245663932103), WIN(0.7935073436308654),
+    WIN(0.7938898899709584), WIN(0.794272204972422), WIN(0.7946542881943526), WIN(0.7950361391960091),
+    WIN(0.7954177575368157), WIN(0.7957991427763612), WIN(0.7961802944743999), WIN(0.7965612121908536),
+    WIN(0.7969418954858112), WIN(0.7973223439195293), WIN(0.7977025570524343), WIN(0.7980825344451212),
+    WIN(0.798462275658356), WIN(0.798841780253077), WIN(0.7992210477903926), WIN(0.7996000778315854),
+    WIN(0.7999788699381107), WIN(0.8003574236715986), WIN(0.800735738593854), WIN(0.8011138142668579),
+    WIN(0.8014916502527678), WIN(0.8018692461139183), WIN(0.8022466014128221), WIN(0.8026237157121711),
+    WIN(0.803000588574837), WIN(0.803377219563872), WIN(0.8037536082425083), WIN(0.8041297541741612),
+    WIN(0.8045056569224285), WIN(0.8048813160510914), WIN(0.8052567311241156), WIN(0.8056319017056507),
+    WIN(0.8060068273600335), WIN(0.8063815076517865), WIN(0.8067559421456192), WIN(0.8071301304064306),
+    WIN(0.8075040719993066), WIN(0.8078777664895241), WIN(0.8082512134425495), WIN(0.8086244124240405),
+    WIN(0.8089973629998473), WIN(0.8093700647360115), WIN(0.8097425171987689), WIN(0.8101147199545494),
+    WIN(0.8104866725699774), WIN(0.8108583746118735), WIN(0.811229825647254), WIN(0.8116010252433331),
+    WIN(0.8119719729675223), WIN(0.8123426683874324), WIN(0.8127131110708729), WIN(0.8130833005858542),
+    WIN(0.8134532365005872), WIN(0.8138229183834849), WIN(0.8141923458031625), WIN(0.8145615183284384),
+    WIN(0.8149304355283348), WIN(0.8152990969720794), WIN(0.8156675022291048), WIN(0.8160356508690499),
+    WIN(0.816403542461761), WIN(0.8167711765772911), WIN(0.8171385527859033), WIN(0.8175056706580688),
+    WIN(0.8178725297644691), WIN(0.8182391296759973), WIN(0.8186054699637564), WIN(0.8189715501990629),
+    WIN(0.8193373699534465), WIN(0.8197029287986499), WIN(0.8200682263066311), WIN(0.8204332620495628),
+    WIN(0.8207980355998339), WIN(0.8211625465300506), WIN(0.8215267944130361), WIN(0.8218907788218324),
+    WIN(0.8222544993296999), WIN(0.8226179555101194), WIN(0.822981146936792), WIN(0.8233440731836407),
+    WIN(0.82370673382481), WIN(0.824069128434667), WIN(0.8244312565878026), WIN(0.8247931178590324),
+    WIN(0.8251547118233973), WIN(0.8255160380561629), WIN(0.8258770961328222), WIN(0.8262378856290953),
+    WIN(0.8265984061209306), WIN(0.826958657184505), WIN(0.8273186383962251), WIN(0.8276783493327279),
+    WIN(0.8280377895708814), WIN(0.8283969586877852), WIN(0.8287558562607718), WIN(0.8291144818674067),
+    WIN(0.8294728350854899), WIN(0.8298309154930554), WIN(0.8301887226683736), WIN(0.830546256189951),
+    WIN(0.8309035156365301), WIN(0.8312605005870927), WIN(0.8316172106208582), WIN(0.8319736453172855),
+    WIN(0.8323298042560735), WIN(0.8326856870171615), WIN(0.833041293180731), WIN(0.8333966223272051),
+    WIN(0.8337516740372503), WIN(0.8341064478917766), WIN(0.834460943471938), WIN(0.8348151603591343),
+    WIN(0.8351690981350116), WIN(0.8355227563814618), WIN(0.8358761346806248), WIN(0.836229232614888),
+    WIN(0.8365820497668882), WIN(0.8369345857195122), WIN(0.8372868400558964), WIN(0.837638812359429),
+    WIN(0.8379905022137493), WIN(0.8383419092027494), WIN(0.8386930329105753), WIN(0.8390438729216266),
+    WIN(0.8393944288205579), WIN(0.8397447001922789), WIN(0.8400946866219559), WIN(0.840444387695012),
+    WIN(0.8407938029971286), WIN(0.8411429321142451), WIN(0.8414917746325598), WIN(0.8418403301385315),
+    WIN(0.8421885982188797), WIN(0.8425365784605847), WIN(0.84288427045089), WIN(0.8432316737773006),
+    WIN(0.843578788027586), WIN(0.84392561278978), WIN(0.8442721476521811), WIN(0.8446183922033542),
+    WIN(0.8449643460321301), WIN(0.845310008727607), WIN(0.8456553798791512), WIN(0.8460004590763979),
+    WIN(0.8463452459092514), WIN(0.8466897399678864), WIN(0.8470339408427485), WIN(0.8473778481245549),
+    WIN(0.8477214614042949), WIN(0.8480647802732312), WIN(0.8484078043229003), WIN(0.8487505331451132),
+    WIN(0.8490929663319561), WIN(0.8494351034757911), WIN(0.8497769441692575), WIN(0.8501184880052711),
+    WIN(0.8504597345770268), WIN(0.850800683477998), WIN(0.851141334301938), WIN(0.8514816866428799),
+    WIN(0.8518217400951379), WIN(0.8521614942533088), WIN(0.8525009487122708), WIN(0.8528401030671862),
+    WIN(0.8531789569135009), WIN(0.8535175098469452), WIN(0.8538557614635348), WIN(0.8541937113595723),
+    WIN(0.8545313591316466), WIN(0.8548687043766336), WIN(0.8552057466916985), WIN(0.8555424856742943),
+    WIN(0.8558789209221648), WIN(0.8562150520333439), WIN(0.8565508786061563), WIN(0.8568864002392185),
+    WIN(0.8572216165314401), WIN(0.8575565270820233), WIN(0.8578911314904654), WIN(0.8582254293565569),
+    WIN(0.8585594202803849), WIN(0.8588931038623321), WIN(0.8592264797030781), WIN(0.8595595474036005),
+    WIN(0.8598923065651746), WIN(0.8602247567893745), WIN(0.8605568976780751), WIN(0.8608887288334505),
+    WIN(0.8612202498579764), WIN(0.8615514603544306), WIN(0.8618823599258932), WIN(0.8622129481757473),
+    WIN(0.8625432247076803), WIN(0.8628731891256841), WIN(0.863202841034056), WIN(0.8635321800373994),
+    WIN(0.8638612057406244), WIN(0.8641899177489489), WIN(0.8645183156678987), WIN(0.8648463991033082),
+    WIN(0.8651741676613222), WIN(0.8655016209483951), WIN(0.8658287585712928), WIN(0.8661555801370928),
+    WIN(0.8664820852531846), WIN(0.8668082735272711), WIN(0.8671341445673694), WIN(0.8674596979818107),
+    WIN(0.8677849333792417), WIN(0.8681098503686246), WIN(0.8684344485592382), WIN(0.8687587275606797),
+    WIN(0.869082686982863), WIN(0.8694063264360217), WIN(0.8697296455307079), WIN(0.8700526438777946),
+    WIN(0.8703753210884749), WIN(0.8706976767742646), WIN(0.8710197105470007), WIN(0.8713414220188431),
+    WIN(0.8716628108022757), WIN(0.8719838765101064), WIN(0.8723046187554688), WIN(0.8726250371518214),
+    WIN(0.8729451313129489), WIN(0.873264900852964), WIN(0.8735843453863065), WIN(0.8739034645277444),
+    WIN(0.874222257892376), WIN(0.8745407250956281), WIN(0.8748588657532589), WIN(0.8751766794813572),
+    WIN(0.8754941658963443), WIN(0.8758113246149739), WIN(0.8761281552543327), WIN(0.8764446574318416),
+    WIN(0.876760830765256), WIN(0.8770766748726668), WIN(0.8773921893725012), WIN(0.8777073738835223),
+    WIN(0.8780222280248313), WIN(0.8783367514158672), WIN(0.8786509436764081), WIN(0.8789648044265708),
+    WIN(0.879278333286813), WIN(0.8795915298779328), WIN(0.87990439382107), WIN(0.8802169247377063),
+    WIN(0.8805291222496667), WIN(0.880840985979119), WIN(0.8811525155485761), WIN(0.881463710580895),
+    WIN(0.881774570699279), WIN(0.882085095527277), WIN(0.882395284688785), WIN(0.882705137808047),
+    WIN(0.8830146545096549), WIN(0.8833238344185496), WIN(0.8836326771600215), WIN(0.8839411823597115),
+    WIN(0.8842493496436111), WIN(0.8845571786380645), WIN(0.884864668969767), WIN(0.8851718202657677),
+    WIN(0.8854786321534684), WIN(0.8857851042606263), WIN(0.8860912362153532), WIN(0.8863970276461166),
+    WIN(0.8867024781817404), WIN(0.8870075874514048), WIN(0.8873123550846487), WIN(0.8876167807113688),
+    WIN(0.8879208639618213), WIN(0.8882246044666213), WIN(0.8885280018567447), WIN(0.8888310557635286),
+    WIN(0.8891337658186712), WIN(0.889436131654234), WIN(0.88973815290264), WIN(0.8900398291966776),
+    WIN(0.890341160169498), WIN(0.8906421454546186), WIN(0.8909427846859216), WIN(0.8912430774976561),
+    WIN(0.8915430235244373), WIN(0.8918426224012492), WIN(0.8921418737634433), WIN(0.8924407772467404),
+    WIN(0.8927393324872306), WIN(0.8930375391213743), WIN(0.8933353967860032), WIN(0.8936329051183199),
+    WIN(0.8939300637559003), WIN(0.8942268723366916), WIN(0.8945233304990161), WIN(0.8948194378815694),
+    WIN(0.8951151941234221), WIN(0.8954105988640205), WIN(0.8957056517431866), WIN(0.8960003524011196),
+    WIN(0.8962947004783962), WIN(0.8965886956159709), WIN(0.8968823374551771), WIN(0.8971756256377272),
+    WIN(0.8974685598057143), WIN(0.8977611396016119), WIN(0.8980533646682745), WIN(0.8983452346489391),
+    WIN(0.8986367491872249), WIN(0.8989279079271344), WIN(0.8992187105130546), WIN(0.8995091565897563),
+    WIN(0.8997992458023958), WIN(0.9000889777965151), WIN(0.9003783522180431), WIN(0.9006673687132949),
+    WIN(0.9009560269289746), WIN(0.901244326512174), WIN(0.9015322671103735), WIN(0.901819848371444),
+    WIN(0.9021070699436463), WIN(0.9023939314756322), WIN(0.9026804326164454), WIN(0.9029665730155209),
+    WIN(0.9032523523226875), WIN(0.903537770188167), WIN(0.9038228262625755), WIN(0.904107520196924),
+    WIN(0.9043918516426185), WIN(0.9046758202514611), WIN(0.9049594256756508), WIN(0.9052426675677834),
+    WIN(0.9055255455808535), WIN(0.9058080593682533), WIN(0.9060902085837743), WIN(0.9063719928816084),
+    WIN(0.9066534119163473), WIN(0.9069344653429838), WIN(0.9072151528169128), WIN(0.9074954739939312),
+    WIN(0.9077754285302384), WIN(0.9080550160824382), WIN(0.908334236307538), WIN(0.9086130888629499),
+    WIN(0.9088915734064918), WIN(0.9091696895963873), WIN(0.9094474370912669), WIN(0.9097248155501683),
+    WIN(0.9100018246325362), WIN(0.9102784639982258), WIN(0.9105547333074993), WIN(0.9108306322210301),
+    WIN(0.9111061603999011), WIN(0.9113813175056064), WIN(0.9116561032000519), WIN(0.9119305171455555),
+    WIN(0.9122045590048479), WIN(0.9124782284410734), WIN(0.9127515251177898), WIN(0.91302444869897),
+    WIN(0.9132969988490023), WIN(0.9135691752326905), WIN(0.9138409775152552), WIN(0.9141124053623332),
+    WIN(0.91438345843998), WIN(0.9146541364146692), WIN(0.9149244389532931), WIN(0.9151943657231632),
+    WIN(0.9154639163920117), WIN(0.915733090627991), WIN(0.916001888099675), WIN(0.91627030847606),
+    WIN(0.9165383514265639), WIN(0.9168060166210283), WIN(0.9170733037297184), WIN(0.9173402124233235),
+    WIN(0.9176067423729587), WIN(0.9178728932501633), WIN(0.9181386647269033), WIN(0.9184040564755718),
+    WIN(0.9186690681689885), WIN(0.9189336994804016), WIN(0.9191979500834875), WIN(0.9194618196523516),
+    WIN(0.9197253078615291), WIN(0.9199884143859854), WIN(0.920251138901117), WIN(0.9205134810827517),
+    WIN(0.920775440607149), WIN(0.9210370171510014), WIN(0.9212982103914348), WIN(0.9215590200060086),
+    WIN(0.9218194456727163), WIN(0.9220794870699872), WIN(0.9223391438766855), WIN(0.9225984157721115),
+    WIN(0.9228573024360031), WIN(0.923115803548534), WIN(0.9233739187903174), WIN(0.9236316478424041),
+    WIN(0.923888990386284), WIN(0.924145946103887), WIN(0.9244025146775826), WIN(0.9246586957901817),
+    WIN(0.9249144891249366), WIN(0.9251698943655409), WIN(0.9254249111961316), WIN(0.925679539301288),
+    WIN(0.9259337783660333), WIN(0.9261876280758353), WIN(0.9264410881166067), WIN(0.9266941581747052),
+    WIN(0.9269468379369342), WIN(0.9271991270905444), WIN(0.927451025323233), WIN(0.9277025323231454),
+    WIN(0.9279536477788748), WIN(0.9282043713794634), WIN(0.928454702814403), WIN(0.9287046417736347),
+    WIN(0.9289541879475509), WIN(0.9292033410269948), WIN(0.929452100703261), WIN(0.9297004666680965),
+    WIN(0.9299484386137011), WIN(0.9301960162327277), WIN(0.930443199218284), WIN(0.9306899872639307),
+    WIN(0.9309363800636845), WIN(0.9311823773120176), WIN(0.9314279787038579), WIN(0.9316731839345905),
+    WIN(0.9319179927000573), WIN(0.9321624046965583), WIN(0.9324064196208518), WIN(0.9326500371701548),
+    WIN(0.9328932570421441), WIN(0.9331360789349562), WIN(0.9333785025471885), WIN(0.9336205275778989),
+    WIN(0.9338621537266075), WIN(0.9341033806932969), WIN(0.9343442081784116), WIN(0.9345846358828599),
+    WIN(0.934824663508014), WIN(0.9350642907557103), WIN(0.9353035173282506), WIN(0.935542342928401),
+    WIN(0.9357807672593953), WIN(0.9360187900249325), WIN(0.9362564109291797), WIN(0.9364936296767709),
+    WIN(0.9367304459728084), WIN(0.9369668595228641), WIN(0.9372028700329778), WIN(0.9374384772096602),
+    WIN(0.937673680759892), WIN(0.9379084803911245), WIN(0.9381428758112806), WIN(0.9383768667287555),
+    WIN(0.9386104528524167), WIN(0.9388436338916042), WIN(0.9390764095561321), WIN(0.9393087795562886),
+    WIN(0.9395407436028362), WIN(0.9397723014070131), WIN(0.9400034526805322), WIN(0.9402341971355833),
+    WIN(0.9404645344848328), WIN(0.9406944644414243), WIN(0.9409239867189797), WIN(0.941153101031598),
+    WIN(0.9413818070938581), WIN(0.9416101046208176), WIN(0.9418379933280142), WIN(0.9420654729314666),
+    WIN(0.9422925431476731), WIN(0.9425192036936144), WIN(0.9427454542867529), WIN(0.9429712946450335),
+    WIN(0.9431967244868837), WIN(0.9434217435312151), WIN(0.9436463514974228), WIN(0.9438705481053868),
+    WIN(0.944094333075472), WIN(0.9443177061285286), WIN(0.944540666985893), WIN(0.9447632153693885),
+    WIN(0.9449853510013249), WIN(0.9452070736045001), WIN(0.9454283829022001), WIN(0.9456492786181985),
+    WIN(0.9458697604767594), WIN(0.9460898282026359), WIN(0.946309481521071), WIN(0.9465287201577988),
+    WIN(0.9467475438390437), WIN(0.9469659522915228), WIN(0.9471839452424446), WIN(0.9474015224195105),
+    WIN(0.947618683550915), WIN(0.9478354283653461), WIN(0.9480517565919858), WIN(0.9482676679605111),
+    WIN(0.948483162201094), WIN(0.9486982390444021), WIN(0.9489128982215986), WIN(0.9491271394643439),
+    WIN(0.9493409625047956), WIN(0.9495543670756085), WIN(0.9497673529099355), WIN(0.9499799197414279),
+    WIN(0.9501920673042366), WIN(0.9504037953330112), WIN(0.9506151035629025), WIN(0.9508259917295608),
+    WIN(0.9510364595691376), WIN(0.9512465068182862), WIN(0.9514561332141612), WIN(0.9516653384944208),
+    WIN(0.951874122397225), WIN(0.9520824846612378), WIN(0.9522904250256267), WIN(0.9524979432300638),
+    WIN(0.952705039014726), WIN(0.9529117121202958), WIN(0.9531179622879611), WIN(0.953323789259416),
+    WIN(0.9535291927768617), WIN(0.9537341725830062), WIN(0.9539387284210661), WIN(0.9541428600347647),
+    WIN(0.9543465671683353), WIN(0.9545498495665194), WIN(0.9547527069745687), WIN(0.9549551391382445),
+    WIN(0.9551571458038185), WIN(0.955358726718074), WIN(0.9555598816283051), WIN(0.9557606102823182),
+    WIN(0.9559609124284321), WIN(0.9561607878154779), WIN(0.9563602361928002), WIN(0.9565592573102581),
+    WIN(0.956757850918224), WIN(0.956956016767585), WIN(0.9571537546097437), WIN(0.9573510641966185),
+    WIN(0.9575479452806434), WIN(0.9577443976147688), WIN(0.9579404209524621), WIN(0.9581360150477086),
+    WIN(0.9583311796550111), WIN(0.9585259145293905), WIN(0.958720219426387), WIN(0.9589140941020592),
+    WIN(0.9591075383129859), WIN(0.9593005518162662), WIN(0.9594931343695193), WIN(0.9596852857308859),
+    WIN(0.9598770056590271), WIN(0.9600682939131271), WIN(0.9602591502528917), WIN(0.9604495744385497),
+    WIN(0.9606395662308534), WIN(0.9608291253910781), WIN(0.9610182516810236), WIN(0.961206944863014),
+    WIN(0.9613952046998986), WIN(0.9615830309550522), WIN(0.961770423392375), WIN(0.9619573817762938),
+    WIN(0.962143905871762), WIN(0.9623299954442601), WIN(0.9625156502597965), WIN(0.9627008700849069),
+    WIN(0.962885654686656), WIN(0.9630700038326373), WIN(0.9632539172909734), WIN(0.9634373948303167),
+    WIN(0.9636204362198497), WIN(0.9638030412292855), WIN(0.9639852096288684), WIN(0.9641669411893736),
+    WIN(0.9643482356821084), WIN(0.9645290928789125), WIN(0.9647095125521584), WIN(0.964889494474751),
+    WIN(0.9650690384201294), WIN(0.9652481441622665), WIN(0.9654268114756687), WIN(0.9656050401353787),
+    WIN(0.9657828299169733), WIN(0.965960180596565), WIN(0.9661370919508028), WIN(0.966313563756871),
+    WIN(0.9664895957924924), WIN(0.9666651878359254), WIN(0.9668403396659672), WIN(0.9670150510619523),
+    WIN(0.9671893218037542), WIN(0.9673631516717844), WIN(0.9675365404469951), WIN(0.9677094879108766),
+    WIN(0.9678819938454608), WIN(0.9680540580333186), WIN(0.9682256802575625), WIN(0.9683968603018468),
+    WIN(0.9685675979503662), WIN(0.9687378929878586), WIN(0.9689077451996038), WIN(0.9690771543714246),
+    WIN(0.9692461202896869), WIN(0.9694146427413007), WIN(0.9695827215137197), WIN(0.9697503563949419),
+    WIN(0.9699175471735104), WIN(0.9700842936385133), WIN(0.9702505955795848), WIN(0.9704164527869045),
+    WIN(0.9705818650511985), WIN(0.9707468321637399), WIN(0.9709113539163489), WIN(0.9710754301013929),
+    WIN(0.971239060511788), WIN(0.9714022449409976), WIN(0.9715649831830343), WIN(0.97172727503246),
+    WIN(0.9718891202843856), WIN(0.9720505187344721), WIN(0.9722114701789304), WIN(0.9723719744145223),
+    WIN(0.9725320312385602), WIN(0.9726916404489084), WIN(0.9728508018439824), WIN(0.9730095152227497),
+    WIN(0.9731677803847305), WIN(0.9733255971299977), WIN(0.9734829652591777), WIN(0.97363988457345),
+    WIN(0.9737963548745477), WIN(0.9739523759647594), WIN(0.9741079476469271), WIN(0.9742630697244486),
+    WIN(0.9744177420012764), WIN(0.9745719642819193), WIN(0.9747257363714419), WIN(0.9748790580754656),
+    WIN(0.9750319292001681), WIN(0.9751843495522845), WIN(0.9753363189391075), WIN(0.9754878371684877),
+    WIN(0.9756389040488339), WIN(0.9757895193891134), WIN(0.9759396829988523), WIN(0.9760893946881364),
+    WIN(0.9762386542676108), WIN(0.976387461548481), WIN(0.9765358163425124), WIN(0.9766837184620312),
+    WIN(0.9768311677199247), WIN(0.9769781639296417), WIN(0.9771247069051926), WIN(0.97727079646115),
+    WIN(0.9774164324126485), WIN(0.9775616145753863), WIN(0.9777063427656236), WIN(0.9778506168001847),
+    WIN(0.977994436496458), WIN(0.9781378016723952), WIN(0.9782807121465129), WIN(0.9784231677378925),
+    WIN(0.9785651682661802), WIN(0.9787067135515884), WIN(0.9788478034148943), WIN(0.9789884376774419),
+    WIN(0.9791286161611414), WIN(0.97926833868847), WIN(0.9794076050824715), WIN(0.9795464151667577),
+    WIN(0.9796847687655077), WIN(0.9798226657034691), WIN(0.9799601058059575), WIN(0.9800970888988575),
+    WIN(0.9802336148086227), WIN(0.9803696833622761), WIN(0.9805052943874103), WIN(0.9806404477121878),
+    WIN(0.9807751431653419), WIN(0.9809093805761757), WIN(0.9810431597745644), WIN(0.9811764805909533),
+    WIN(0.9813093428563602), WIN(0.9814417464023745), WIN(0.9815736910611573), WIN(0.9817051766654431),
+    WIN(0.9818362030485386), WIN(0.981966770044324), WIN(0.9820968774872527), WIN(0.982226525212352),
+    WIN(0.9823557130552231), WIN(0.9824844408520418), WIN(0.9826127084395583), WIN(0.9827405156550982),
+    WIN(0.9828678623365618), WIN(0.9829947483224252), WIN(0.9831211734517407), WIN(0.9832471375641363),
+    WIN(0.9833726404998167), WIN(0.9834976820995632), WIN(0.9836222622047345), WIN(0.9837463806572658),
+    WIN(0.9838700372996714), WIN(0.9839932319750421), WIN(0.9841159645270477), WIN(0.9842382347999362),
+    WIN(0.9843600426385344), WIN(0.9844813878882485), WIN(0.9846022703950639), WIN(0.9847226900055454),
+    WIN(0.984842646566838), WIN(0.9849621399266668), WIN(0.9850811699333377), WIN(0.9851997364357372),
+    WIN(0.9853178392833326), WIN(0.9854354783261728), WIN(0.9855526534148886), WIN(0.9856693644006922),
+    WIN(0.985785611135378), WIN(0.9859013934713232), WIN(0.9860167112614877), WIN(0.9861315643594138),
+    WIN(0.9862459526192282), WIN(0.9863598758956397), WIN(0.9864733340439421), WIN(0.9865863269200126),
+    WIN(0.9866988543803132), WIN(0.9868109162818901), WIN(0.9869225124823745), WIN(0.9870336428399828),
+    WIN(0.987144307213517), WIN(0.987254505462364), WIN(0.9873642374464978), WIN(0.9874735030264773),
+    WIN(0.9875823020634489), WIN(0.987690634419145), WIN(0.9877984999558851), WIN(0.9879058985365765),
+    WIN(0.988012830024713), WIN(0.9881192942843766), WIN(0.9882252911802373), WIN(0.9883308205775534),
+    WIN(0.9884358823421714), WIN(0.9885404763405267), WIN(0.9886446024396432), WIN(0.9887482605071347),
+    WIN(0.9888514504112044), WIN(0.9889541720206446), WIN(0.9890564252048378), WIN(0.9891582098337568),
+    WIN(0.9892595257779649), WIN(0.9893603729086158), WIN(0.9894607510974546), WIN(0.9895606602168167),
+    WIN(0.9896601001396294), WIN(0.9897590707394117), WIN(0.9898575718902742), WIN(0.98995560346692),
+    WIN(0.9900531653446438), WIN(0.9901502573993332), WIN(0.9902468795074688), WIN(0.9903430315461241),
+    WIN(0.9904387133929653), WIN(0.9905339249262529), WIN(0.9906286660248403), WIN(0.9907229365681754),
+    WIN(0.9908167364363001), WIN(0.9909100655098501), WIN(0.9910029236700565), WIN(0.9910953107987447),
+    WIN(0.991187226778335), WIN(0.9912786714918437), WIN(0.9913696448228813), WIN(0.9914601466556549),
+    WIN(0.9915501768749673), WIN(0.9916397353662174), WIN(0.9917288220154), WIN(0.9918174367091072),
+    WIN(0.9919055793345268), WIN(0.9919932497794444), WIN(0.9920804479322424), WIN(0.9921671736819007),
+    WIN(0.9922534269179963), WIN(0.9923392075307045), WIN(0.9924245154107981), WIN(0.9925093504496487),
+    WIN(0.9925937125392257), WIN(0.9926776015720972), WIN(0.9927610174414302), WIN(0.9928439600409903),
+    WIN(0.9929264292651429), WIN(0.9930084250088522), WIN(0.9930899471676823), WIN(0.9931709956377966),
+    WIN(0.9932515703159589), WIN(0.9933316710995329), WIN(0.993411297886483), WIN(0.9934904505753732),
+    WIN(0.9935691290653693), WIN(0.9936473332562371), WIN(0.9937250630483441), WIN(0.9938023183426585),
+    WIN(0.9938790990407506), WIN(0.9939554050447917), WIN(0.9940312362575553), WIN(0.9941065925824164),
+    WIN(0.9941814739233528), WIN(0.9942558801849445), WIN(0.9943298112723735), WIN(0.994403267091425),
+    WIN(0.9944762475484868), WIN(0.9945487525505501), WIN(0.994620782005209), WIN(0.994692335820661),
+    WIN(0.9947634139057072), WIN(0.9948340161697524), WIN(0.9949041425228055), WIN(0.9949737928754789),
+    WIN(0.9950429671389903), WIN(0.9951116652251607), WIN(0.9951798870464159), WIN(0.9952476325157871),
+    WIN(0.9953149015469094), WIN(0.9953816940540235), WIN(0.9954480099519754), WIN(0.9955138491562161),
+    WIN(0.9955792115828023), WIN(0.9956440971483963), WIN(0.9957085057702664), WIN(0.9957724373662866),
+    WIN(0.9958358918549371), WIN(0.9958988691553049), WIN(0.9959613691870824), WIN(0.9960233918705695),
+    WIN(0.9960849371266726), WIN(0.9961460048769044), WIN(0.9962065950433855), WIN(0.9962667075488432),
+    WIN(0.9963263423166121), WIN(0.9963854992706341), WIN(0.9964441783354593), WIN(0.9965023794362449),
+    WIN(0.9965601024987562), WIN(0.9966173474493665), WIN(0.9966741142150574), WIN(0.9967304027234185),
+    WIN(0.9967862129026481), WIN(0.9968415446815527), WIN(0.9968963979895479), WIN(0.9969507727566578),
+    WIN(0.9970046689135155), WIN(0.9970580863913633), WIN(0.9971110251220525), WIN(0.997163485038044),
+    WIN(0.9972154660724077), WIN(0.9972669681588235), WIN(0.9973179912315812), WIN(0.9973685352255794),
+    WIN(0.9974186000763279), WIN(0.9974681857199457), WIN(0.9975172920931623), WIN(0.9975659191333175),
+    WIN(0.9976140667783613), WIN(0.9976617349668545), WIN(0.9977089236379686), WIN(0.9977556327314853),
+    WIN(0.9978018621877979), WIN(0.9978476119479102), WIN(0.9978928819534372), WIN(0.997937672146605),
+    WIN(0.9979819824702514), WIN(0.9980258128678252), WIN(0.9980691632833867), WIN(0.998112033661608),
+    WIN(0.9981544239477729), WIN(0.9981963340877772), WIN(0.9982377640281281), WIN(0.9982787137159455),
+    WIN(0.9983191830989605), WIN(0.9983591721255176), WIN(0.9983986807445725), WIN(0.998437708905694),
+    WIN(0.9984762565590634), WIN(0.998514323655474), WIN(0.9985519101463324), WIN(0.9985890159836578),
+    WIN(0.9986256411200822), WIN(0.9986617855088504), WIN(0.9986974491038204), WIN(0.9987326318594636),
+    WIN(0.9987673337308641), WIN(0.9988015546737197), WIN(0.9988352946443413), WIN(0.9988685535996535),
+    WIN(0.9989013314971941), WIN(0.9989336282951148), WIN(0.9989654439521811), WIN(0.9989967784277718),
+    WIN(0.9990276316818799), WIN(0.9990580036751125), WIN(0.9990878943686902), WIN(0.9991173037244478),
+    WIN(0.9991462317048346), WIN(0.9991746782729138), WIN(0.9992026433923628), WIN(0.9992301270274733),
+    WIN(0.999257129143152), WIN(0.9992836497049193), WIN(0.9993096886789108), WIN(0.999335246031876),
+    WIN(0.9993603217311796), WIN(0.9993849157448009), WIN(0.9994090280413339), WIN(0.9994326585899876),
+    WIN(0.9994558073605856), WIN(0.9994784743235667), WIN(0.9995006594499847), WIN(0.9995223627115082),
+    WIN(0.9995435840804214), WIN(0.9995643235296232), WIN(0.999584581032628), WIN(0.9996043565635654),
+    WIN(0.99962365009718), WIN(0.9996424616088323), WIN(0.9996607910744979), WIN(0.999678638470768),
+    WIN(0.9996960037748488), WIN(0.9997128869645627), WIN(0.9997292880183477), WIN(0.9997452069152566),
+    WIN(0.9997606436349588), WIN(0.9997755981577385), WIN(0.9997900704644965), WIN(0.9998040605367489),
+    WIN(0.9998175683566276), WIN(0.9998305939068803), WIN(0.999843137170871), WIN(0.9998551981325791),
+    WIN(0.9998667767766), WIN(0.9998778730881451), WIN(0.9998884870530422), WIN(0.9998986186577346),
+    WIN(0.9999082678892814), WIN(0.9999174347353585), WIN(0.9999261191842578), WIN(0.9999343212248865),
+    WIN(0.9999420408467685), WIN(0.9999492780400441), WIN(0.9999560327954692), WIN(0.9999623051044162),
+    WIN(0.9999680949588738), WIN(0.9999734023514464), WIN(0.9999782272753553), WIN(0.9999825697244376),
+    WIN(0.9999864296931466), WIN(0.9999898071765521), WIN(0.9999927021703401), WIN(0.9999951146708127),
+    WIN(0.9999970446748887), WIN(0.9999984921801027), WIN(0.9999994571846058), WIN(0.9999999396871655),
+};
+
+#ifdef KISS_FFT_STAGE_TWIDDLES
+static const kiss_fft_cpx stage_twiddles_8192[4095] = {
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.7071067811865476, -0.7071067811865475),
+    TW(0.38268343236508984, -0.9238795325112867), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(-0.9238795325112868, 0.38268343236508967), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.5555702330196023, -0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.4713967368259977, -0.881921264348355), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6343932841636455, -0.773010453362737), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.555570233019602, -0.8314696123025455),
+    TW(-0.9951847266721969, 0.09801714032956059), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.8314696123025453, -0.5555702330196022),
+    TW(-0.7730104533627371, 0.6343932841636453), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(-0.29028467725446244, 0.9569403357322088), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.4496113296546066, -0.8932243011955153), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.6715589548470183, -0.7409511253549591),
+    TW(0.3136817403988916, -0.9495281805930367), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.5956993044924335, -0.8032075314806448),
+    TW(0.17096188876030136, -0.9852776423889412), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.024541228522912264, -0.9996988186962042), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.12241067519921615, -0.99247953459871), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.534997619887097, -0.8448535652497072), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.6895405447370669, -0.7242470829514669), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6531728429537768, -0.7572088465064845), TW(-0.14673047445536164, -0.989176509964781),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6152315905806268, -0.7883464276266062), TW(-0.24298017990326387, -0.970031253194544),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5758081914178453, -0.8175848131515837), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5349976198870973, -0.844853565249707), TW(-0.42755509343028186, -0.9039892931234434),
+    TW(-0.99247953459871, -0.12241067519921635), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.4928981922297841, -0.8700869911087113), TW(-0.5141027441932217, -0.8577286100002721),
+    TW(-0.9996988186962042, 0.02454122852291208), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4496113296546066, -0.8932243011955153), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(-0.9852776423889413, 0.17096188876030097), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.40524131400498986, -0.9142097557035307), TW(-0.6715589548470184, -0.740951125354959),
+    TW(-0.9495281805930368, 0.3136817403988912), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3598950365349883, -0.9329927988347388), TW(-0.7409511253549589, -0.6715589548470186),
+    TW(-0.8932243011955153, 0.44961132965460665), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.3136817403988916, -0.9495281805930367), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(-0.8175848131515837, 0.5758081914178453), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.2667127574748984, -0.9637760657954398), TW(-0.857728610000272, -0.5141027441932218),
+    TW(-0.724247082951467, 0.6895405447370668), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.21910124015686977, -0.9757021300385286), TW(-0.9039892931234433, -0.42755509343028203),
+    TW(-0.6152315905806273, 0.7883464276266059), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.17096188876030136, -0.9852776423889412), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(-0.4928981922297842, 0.8700869911087113), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.12241067519921628, -0.99247953459871), TW(-0.970031253194544, -0.24298017990326407),
+    TW(-0.35989503653498794, 0.932992798834739), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.07356456359966745, -0.9972904566786902), TW(-0.989176509964781, -0.1467304744553618),
+    TW(-0.2191012401568701, 0.9757021300385285), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.024541228522912264, -0.9996988186962042), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(-0.07356456359966736, 0.9972904566786902), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9999811752826011, -0.006135884649154475), TW(0.9999247018391445, -0.012271538285719925),
+    TW(0.9998305817958234, -0.01840672990580482), TW(0.9999247018391445, -0.012271538285719925),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9998305817958234, -0.01840672990580482), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9984755805732948, -0.055195244349689934), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9995294175010931, -0.030674803176636626), TW(0.9981181129001492, -0.06132073630220858),
+    TW(0.9957674144676598, -0.09190895649713272), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9990777277526454, -0.04293825693494082), TW(0.996312612182778, -0.0857973123444399),
+    TW(0.9917097536690995, -0.12849811079379317), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9984755805732948, -0.055195244349689934), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9863080972445987, -0.16491312048996992), TW(0.9981181129001492, -0.06132073630220858),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.9977230666441916, -0.06744391956366405), TW(0.99090263542778, -0.13458070850712617),
+    TW(0.9795697656854405, -0.2011046348420919), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9968202992911657, -0.07968243797143013), TW(0.9873014181578584, -0.15885814333386145),
+    TW(0.9715038909862518, -0.2370236059943672), TW(0.996312612182778, -0.0857973123444399),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.9957674144676598, -0.09190895649713272), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.9621214042690416, -0.272621355449949), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9945645707342554, -0.10412163387205459), TW(0.9783173707196277, -0.20711137619221856),
+    TW(0.9514350209690083, -0.30784964004153487), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.9932119492347945, -0.11631863091190475), TW(0.9729399522055602, -0.2310581082806711),
+    TW(0.9394592236021899, -0.3426607173119944), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.9917097536690995, -0.12849811079379317), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.9262102421383114, -0.37700741021641826), TW(0.99090263542778, -0.13458070850712617),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.9900582102622971, -0.1406582393328492), TW(0.9604305194155658, -0.27851968938505306),
+    TW(0.9117060320054299, -0.4108431710579039), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.9882575677307495, -0.15279718525844344), TW(0.9533060403541939, -0.3020059493192281),
+    TW(0.8959662497561852, -0.4441221445704292), TW(0.9873014181578584, -0.15885814333386145),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.9863080972445987, -0.16491312048996992), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.8790122264286335, -0.4767992300633221), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.984210092386929, -0.17700422041214875), TW(0.937339011912575, -0.34841868024943456),
+    TW(0.8608669386377673, -0.508830142543107), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.9819638691095552, -0.1890686641498062), TW(0.9285060804732156, -0.37131719395183754),
+    TW(0.8415549774368984, -0.5401714727298929), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9795697656854405, -0.2011046348420919), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.8211025149911046, -0.5707807458869673), TW(0.9783173707196277, -0.20711137619221856),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.9770281426577544, -0.21311031991609136), TW(0.9091679830905224, -0.41642956009763715),
+    TW(0.799537269107905, -0.600616479383869), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.9743393827855759, -0.22508391135979283), TW(0.8986744656939538, -0.43861623853852766),
+    TW(0.7768884656732324, -0.629638238914927), TW(0.9729399522055602, -0.2310581082806711),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.9715038909862518, -0.2370236059943672), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.7531867990436125, -0.6578066932970786), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9685220942744174, -0.24892760574572015), TW(0.8760700941954066, -0.4821837720791227),
+    TW(0.7284643904482252, -0.6850836677727004), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.9653944416976894, -0.2607941179152755), TW(0.8639728561215868, -0.5035383837257176),
+    TW(0.7027547444572253, -0.7114321957452164), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.9621214042690416, -0.272621355449949), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.676092703575316, -0.7368165688773698), TW(0.9604305194155658, -0.27851968938505306),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.6624157775901718, -0.7491363945234593),
+    TW(0.9587034748958716, -0.2844075372112719), TW(0.8382247055548381, -0.5453249884220465),
+    TW(0.6485144010221126, -0.7612023854842618), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9551411683057708, -0.2961508882436238), TW(0.8245893027850253, -0.5657318107836131),
+    TW(0.6200572117632892, -0.7845565971555752), TW(0.9533060403541939, -0.3020059493192281),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.6055110414043255, -0.7958369046088835),
+    TW(0.9514350209690083, -0.30784964004153487), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.5907597018588743, -0.8068475535437992), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.9475855910177411, -0.3195020308160157), TW(0.7958369046088836, -0.6055110414043255),
+    TW(0.560661576197336, -0.8280450452577558), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.5453249884220465, -0.838224705554838),
+    TW(0.9435934581619604, -0.33110630575987643), TW(0.7807372285720945, -0.6248594881423863),
+    TW(0.5298036246862948, -0.8481203448032971), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.9394592236021899, -0.3426607173119944), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.49822766697278187, -0.8670462455156926), TW(0.937339011912575, -0.34841868024943456),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.48218377207912283, -0.8760700941954066),
+    TW(0.9351835099389476, -0.35416352542049034), TW(0.7491363945234594, -0.6624157775901718),
+    TW(0.4659764957679661, -0.8847970984309378), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.4496113296546066, -0.8932243011955153),
+    TW(0.9307669610789837, -0.36561299780477385), TW(0.7326542716724128, -0.680600997795453),
+    TW(0.433093818853152, -0.901348847046022), TW(0.9285060804732156, -0.37131719395183754),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.4164295600976373, -0.9091679830905223),
+    TW(0.9262102421383114, -0.37700741021641826), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.3996241998456468, -0.9166790599210427), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.921514039342042, -0.38834504669882625), TW(0.6983762494089729, -0.7157308252838186),
+    TW(0.36561299780477396, -0.9307669610789837), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.3484186802494345, -0.937339011912575),
+    TW(0.9166790599210427, -0.3996241998456468), TW(0.6806009977954531, -0.7326542716724128),
+    TW(0.33110630575987643, -0.9435934581619604), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.6715589548470183, -0.7409511253549591), TW(0.3136817403988916, -0.9495281805930367),
+    TW(0.9117060320054299, -0.4108431710579039), TW(0.6624157775901718, -0.7491363945234593),
+    TW(0.29615088824362396, -0.9551411683057707), TW(0.9091679830905224, -0.41642956009763715),
+    TW(0.6531728429537768, -0.7572088465064845), TW(0.27851968938505306, -0.9604305194155658),
+    TW(0.9065957045149153, -0.4220002707997997), TW(0.6438315428897915, -0.765167265622459),
+    TW(0.26079411791527557, -0.9653944416976894), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.901348847046022, -0.43309381885315196), TW(0.6248594881423865, -0.7807372285720944),
+    TW(0.22508391135979278, -0.9743393827855759), TW(0.8986744656939538, -0.43861623853852766),
+    TW(0.6152315905806268, -0.7883464276266062), TW(0.20711137619221856, -0.9783173707196277),
+    TW(0.8959662497561852, -0.4441221445704292), TW(0.6055110414043255, -0.7958369046088835),
+    TW(0.18906866414980628, -0.9819638691095552), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.5956993044924335, -0.8032075314806448), TW(0.17096188876030136, -0.9852776423889412),
+    TW(0.8904487232447579, -0.45508358712634384), TW(0.5857978574564389, -0.8104571982525948),
+    TW(0.1527971852584434, -0.9882575677307495), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.13458070850712622, -0.99090263542778),
+    TW(0.8847970984309378, -0.4659764957679662), TW(0.5657318107836132, -0.8245893027850253),
+    TW(0.11631863091190488, -0.9932119492347945), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8790122264286335, -0.4767992300633221), TW(0.5453249884220465, -0.838224705554838),
+    TW(0.07968243797143013, -0.9968202992911657), TW(0.8760700941954066, -0.4821837720791227),
+    TW(0.5349976198870973, -0.844853565249707), TW(0.06132073630220865, -0.9981181129001492),
+    TW(0.8730949784182901, -0.487550160148436), TW(0.5245896826784688, -0.8513551931052652),
+    TW(0.04293825693494096, -0.9990777277526454), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.024541228522912264, -0.9996988186962042),
+    TW(0.8670462455156926, -0.49822766697278187), TW(0.5035383837257176, -0.8639728561215867),
+    TW(0.006135884649154515, -0.9999811752826011), TW(0.8639728561215868, -0.5035383837257176),
+    TW(0.4928981922297841, -0.8700869911087113), TW(-0.012271538285719823, -0.9999247018391445),
+    TW(0.8608669386377673, -0.508830142543107), TW(0.48218377207912283, -0.8760700941954066),
+    TW(-0.03067480317663646, -0.9995294175010931), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8545579883654005, -0.5193559901655896), TW(0.46053871095824, -0.8876396204028539),
+    TW(-0.06744391956366398, -0.9977230666441916), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.4496113296546066, -0.8932243011955153), TW(-0.08579731234443976, -0.996312612182778),
+    TW(0.8481203448032972, -0.5298036246862946), TW(0.4386162385385277, -0.8986744656939538),
+    TW(-0.1041216338720546, -0.9945645707342554), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.12241067519921615, -0.99247953459871),
+    TW(0.8415549774368984, -0.5401714727298929), TW(0.4164295600976373, -0.9091679830905223),
+    TW(-0.14065823933284913, -0.9900582102622971), TW(0.8382247055548381, -0.5453249884220465),
+    TW(0.40524131400498986, -0.9142097557035307), TW(-0.15885814333386128, -0.9873014181578584),
+    TW(0.83486287498638, -0.5504579729366048), TW(0.3939920400610481, -0.9191138516900578),
+    TW(-0.17700422041214875, -0.984210092386929), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8280450452577558, -0.560661576197336), TW(0.3713171939518376, -0.9285060804732155),
+    TW(-0.21311031991609125, -0.9770281426577544), TW(0.8245893027850253, -0.5657318107836131),
+    TW(0.3598950365349883, -0.9329927988347388), TW(-0.23105810828067114, -0.9729399522055602),
+    TW(0.8211025149911046, -0.5707807458869673), TW(0.3484186802494345, -0.937339011912575),
+    TW(-0.24892760574572012, -0.9685220942744174), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(0.8140363297059484, -0.5808139580957645), TW(0.325310292162263, -0.9456073253805213),
+    TW(-0.2844075372112717, -0.9587034748958716), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.3136817403988916, -0.9495281805930367), TW(-0.3020059493192281, -0.9533060403541939),
+    TW(0.8068475535437993, -0.5907597018588742), TW(0.3020059493192282, -0.9533060403541938),
+    TW(-0.31950203081601564, -0.9475855910177412), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.799537269107905, -0.600616479383869), TW(0.27851968938505306, -0.9604305194155658),
+    TW(-0.3541635254204904, -0.9351835099389476), TW(0.7958369046088836, -0.6055110414043255),
+    TW(0.2667127574748984, -0.9637760657954398), TW(-0.3713171939518375, -0.9285060804732156),
+    TW(0.7921065773002124, -0.6103828062763095), TW(0.2548656596045146, -0.9669764710448521),
+    TW(-0.3883450466988262, -0.921514039342042), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(0.7845565971555752, -0.6200572117632891), TW(0.23105810828067128, -0.9729399522055601),
+    TW(-0.4220002707997997, -0.9065957045149153), TW(0.7807372285720945, -0.6248594881423863),
+    TW(0.21910124015686977, -0.9757021300385286), TW(-0.4386162385385274, -0.8986744656939539),
+    TW(0.7768884656732324, -0.629638238914927), TW(0.20711137619221856, -0.9783173707196277),
+    TW(-0.4550835871263437, -0.890448723244758), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7691033376455797, -0.6391244448637757), TW(0.18303988795514106, -0.9831054874312163),
+    TW(-0.4875501601484357, -0.8730949784182902), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.17096188876030136, -0.9852776423889412), TW(-0.5035383837257175, -0.8639728561215868),
+    TW(0.7612023854842618, -0.6485144010221124), TW(0.1588581433338614, -0.9873014181578584),
+    TW(-0.5193559901655896, -0.8545579883654005), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.534997619887097, -0.8448535652497072),
+    TW(0.7531867990436125, -0.6578066932970786), TW(0.13458070850712622, -0.99090263542778),
+    TW(-0.5504579729366047, -0.8348628749863801), TW(0.7491363945234594, -0.6624157775901718),
+    TW(0.12241067519921628, -0.99247953459871), TW(-0.5657318107836132, -0.8245893027850252),
+    TW(0.7450577854414661, -0.6669999223036375), TW(0.11022220729388318, -0.9939069700023561),
+    TW(-0.5808139580957644, -0.8140363297059485), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.7368165688773699, -0.6760927035753159), TW(0.08579731234443988, -0.996312612182778),
+    TW(-0.6103828062763096, -0.7921065773002123), TW(0.7326542716724128, -0.680600997795453),
+    TW(0.07356456359966745, -0.9972904566786902), TW(-0.6248594881423862, -0.7807372285720946),
+    TW(0.7284643904482252, -0.6850836677727004), TW(0.06132073630220865, -0.9981181129001492),
+    TW(-0.6391244448637757, -0.7691033376455796), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(0.7200025079613817, -0.693971460889654), TW(0.03680722294135899, -0.9993223845883495),
+    TW(-0.6669999223036374, -0.7450577854414661), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.024541228522912264, -0.9996988186962042), TW(-0.680600997795453, -0.7326542716724128),
+    TW(0.7114321957452164, -0.7027547444572253), TW(0.012271538285719944, -0.9999247018391445),
+    TW(-0.6939714608896538, -0.7200025079613818), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.7027547444572253, -0.7114321957452164), TW(-0.012271538285719823, -0.9999247018391445),
+    TW(-0.7200025079613817, -0.693971460889654), TW(0.6983762494089729, -0.7157308252838186),
+    TW(-0.024541228522912142, -0.9996988186962042), TW(-0.7326542716724127, -0.6806009977954532),
+    TW(0.693971460889654, -0.7200025079613817), TW(-0.036807222941358866, -0.9993223845883495),
+    TW(-0.745057785441466, -0.6669999223036376), TW(0.6895405447370669, -0.7242470829514669),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(0.6850836677727004, -0.7284643904482252), TW(-0.06132073630220853, -0.9981181129001492),
+    TW(-0.7691033376455795, -0.6391244448637758), TW(0.6806009977954531, -0.7326542716724128),
+    TW(-0.07356456359966733, -0.9972904566786902), TW(-0.7807372285720945, -0.6248594881423863),
+    TW(0.676092703575316, -0.7368165688773698), TW(-0.08579731234443976, -0.996312612182778),
+    TW(-0.7921065773002122, -0.6103828062763097), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6669999223036375, -0.745057785441466), TW(-0.11022220729388306, -0.9939069700023561),
+    TW(-0.8140363297059484, -0.5808139580957645), TW(0.6624157775901718, -0.7491363945234593),
+    TW(-0.12241067519921615, -0.99247953459871), TW(-0.8245893027850251, -0.5657318107836135),
+    TW(0.6578066932970786, -0.7531867990436124), TW(-0.1345807085071261, -0.99090263542778),
+    TW(-0.83486287498638, -0.5504579729366049), TW(0.6531728429537768, -0.7572088465064845),
+    TW(-0.14673047445536164, -0.989176509964781), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(0.6485144010221126, -0.7612023854842618), TW(-0.15885814333386128, -0.9873014181578584),
+    TW(-0.8545579883654004, -0.5193559901655898), TW(0.6438315428897915, -0.765167265622459),
+    TW(-0.17096188876030124, -0.9852776423889412), TW(-0.8639728561215867, -0.5035383837257177),
+    TW(0.6391244448637757, -0.7691033376455796), TW(-0.18303988795514092, -0.9831054874312163),
+    TW(-0.8730949784182901, -0.4875501601484359), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6296382389149271, -0.7768884656732324), TW(-0.20711137619221845, -0.9783173707196277),
+    TW(-0.8904487232447579, -0.4550835871263439), TW(0.6248594881423865, -0.7807372285720944),
+    TW(-0.21910124015686966, -0.9757021300385286), TW(-0.8986744656939539, -0.43861623853852755),
+    TW(0.6200572117632892, -0.7845565971555752), TW(-0.23105810828067114, -0.9729399522055602),
+    TW(-0.9065957045149153, -0.42200027079979985), TW(0.6152315905806268, -0.7883464276266062),
+    TW(-0.24298017990326387, -0.970031253194544), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(0.6103828062763095, -0.7921065773002124), TW(-0.2548656596045145, -0.9669764710448521),
+    TW(-0.9215140393420418, -0.3883450466988266), TW(0.6055110414043255, -0.7958369046088835),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(-0.9285060804732155, -0.3713171939518377),
+    TW(0.600616479383869, -0.799537269107905), TW(-0.27851968938505295, -0.9604305194155659),
+    TW(-0.9351835099389476, -0.3541635254204904), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5907597018588743, -0.8068475535437992), TW(-0.3020059493192281, -0.9533060403541939),
+    TW(-0.9475855910177411, -0.3195020308160158), TW(0.5857978574564389, -0.8104571982525948),
+    TW(-0.3136817403988914, -0.9495281805930367), TW(-0.9533060403541939, -0.30200594931922803),
+    TW(0.5808139580957645, -0.8140363297059483), TW(-0.32531029216226287, -0.9456073253805214),
+    TW(-0.9587034748958715, -0.2844075372112721), TW(0.5758081914178453, -0.8175848131515837),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(0.5707807458869674, -0.8211025149911046), TW(-0.3484186802494344, -0.937339011912575),
+    TW(-0.9685220942744174, -0.2489276057457201), TW(0.5657318107836132, -0.8245893027850253),
+    TW(-0.35989503653498817, -0.9329927988347388), TW(-0.9729399522055601, -0.23105810828067133),
+    TW(0.560661576197336, -0.8280450452577558), TW(-0.3713171939518375, -0.9285060804732156),
+    TW(-0.9770281426577544, -0.21311031991609142), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5504579729366048, -0.83486287498638), TW(-0.393992040061048, -0.9191138516900578),
+    TW(-0.984210092386929, -0.17700422041214894), TW(0.5453249884220465, -0.838224705554838),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(-0.9873014181578584, -0.15885814333386147),
+    TW(0.540171472729893, -0.8415549774368983), TW(-0.416429560097637, -0.9091679830905225),
+    TW(-0.990058210262297, -0.14065823933284954), TW(0.5349976198870973, -0.844853565249707),
+    TW(-0.42755509343028186, -0.9039892931234434), TW(-0.99247953459871, -0.12241067519921635),
+    TW(0.5298036246862948, -0.8481203448032971), TW(-0.4386162385385274, -0.8986744656939539),
+    TW(-0.9945645707342554, -0.10412163387205457), TW(0.5245896826784688, -0.8513551931052652),
+    TW(-0.4496113296546067, -0.8932243011955152), TW(-0.996312612182778, -0.08579731234444016),
+    TW(0.5193559901655895, -0.8545579883654005), TW(-0.46053871095824006, -0.8876396204028539),
+    TW(-0.9977230666441916, -0.06744391956366418), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.508830142543107, -0.8608669386377673), TW(-0.4821837720791227, -0.8760700941954066),
+    TW(-0.9995294175010931, -0.030674803176636865), TW(0.5035383837257176, -0.8639728561215867),
+    TW(-0.492898192229784, -0.8700869911087115), TW(-0.9999247018391445, -0.012271538285720007),
+    TW(0.49822766697278187, -0.8670462455156926), TW(-0.5035383837257175, -0.8639728561215868),
+    TW(-0.9999811752826011, 0.006135884649154554), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.5141027441932217, -0.8577286100002721), TW(-0.9996988186962042, 0.02454122852291208),
+    TW(0.48755016014843605, -0.8730949784182901), TW(-0.5245896826784687, -0.8513551931052652),
+    TW(-0.9990777277526454, 0.04293825693494078), TW(0.48218377207912283, -0.8760700941954066),
+    TW(-0.534997619887097, -0.8448535652497072), TW(-0.9981181129001492, 0.061320736302208245),
+    TW(0.47679923006332225, -0.8790122264286334), TW(-0.5453249884220462, -0.8382247055548382),
+    TW(-0.9968202992911658, 0.07968243797142995), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4659764957679661, -0.8847970984309378), TW(-0.5657318107836132, -0.8245893027850252),
+    TW(-0.9932119492347946, 0.11631863091190447), TW(0.46053871095824, -0.8876396204028539),
+    TW(-0.5758081914178453, -0.8175848131515837), TW(-0.99090263542778, 0.13458070850712606),
+    TW(0.45508358712634384, -0.8904487232447579), TW(-0.5857978574564389, -0.8104571982525948),
+    TW(-0.9882575677307495, 0.15279718525844344), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(-0.9852776423889413, 0.17096188876030097),
+    TW(0.44412214457042926, -0.8959662497561851), TW(-0.6055110414043254, -0.7958369046088836),
+    TW(-0.9819638691095552, 0.1890686641498061), TW(0.4386162385385277, -0.8986744656939538),
+    TW(-0.6152315905806267, -0.7883464276266063), TW(-0.9783173707196277, 0.2071113761922186),
+    TW(0.433093818853152, -0.901348847046022), TW(-0.6248594881423862, -0.7807372285720946),
+    TW(-0.9743393827855759, 0.2250839113597926), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.4220002707997998, -0.9065957045149153), TW(-0.6438315428897913, -0.7651672656224591),
+    TW(-0.9653944416976894, 0.2607941179152756), TW(0.4164295600976373, -0.9091679830905223),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(-0.9604305194155659, 0.2785196893850529),
+    TW(0.4108431710579039, -0.9117060320054299), TW(-0.6624157775901719, -0.7491363945234593),
+    TW(-0.9551411683057708, 0.2961508882436238), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.6715589548470184, -0.740951125354959), TW(-0.9495281805930368, 0.3136817403988912),
+    TW(0.3996241998456468, -0.9166790599210427), TW(-0.680600997795453, -0.7326542716724128),
+    TW(-0.9435934581619604, 0.33110630575987626), TW(0.3939920400610481, -0.9191138516900578),
+    TW(-0.6895405447370669, -0.7242470829514669), TW(-0.937339011912575, 0.34841868024943456),
+    TW(0.3883450466988263, -0.9215140393420419), TW(-0.6983762494089728, -0.7157308252838187),
+    TW(-0.9307669610789838, 0.3656129978047736), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3770074102164183, -0.9262102421383113), TW(-0.7157308252838186, -0.6983762494089729),
+    TW(-0.9166790599210427, 0.39962419984564684), TW(0.3713171939518376, -0.9285060804732155),
+    TW(-0.7242470829514668, -0.689540544737067), TW(-0.9091679830905225, 0.41642956009763693),
+    TW(0.36561299780477396, -0.9307669610789837), TW(-0.7326542716724127, -0.6806009977954532),
+    TW(-0.901348847046022, 0.43309381885315185), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.7409511253549589, -0.6715589548470186), TW(-0.8932243011955153, 0.44961132965460665),
+    TW(0.3541635254204905, -0.9351835099389475), TW(-0.7491363945234591, -0.662415777590172),
+    TW(-0.8847970984309379, 0.46597649576796596), TW(0.3484186802494345, -0.937339011912575),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(-0.8760700941954066, 0.48218377207912266),
+    TW(0.3426607173119944, -0.9394592236021899), TW(-0.765167265622459, -0.6438315428897914),
+    TW(-0.8670462455156929, 0.49822766697278154), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.33110630575987643, -0.9435934581619604), TW(-0.7807372285720945, -0.6248594881423863),
+    TW(-0.8481203448032972, 0.5298036246862946), TW(0.325310292162263, -0.9456073253805213),
+    TW(-0.7883464276266062, -0.6152315905806269), TW(-0.8382247055548382, 0.5453249884220461),
+    TW(0.31950203081601575, -0.9475855910177411), TW(-0.7958369046088835, -0.6055110414043257),
+    TW(-0.8280450452577558, 0.5606615761973359), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(-0.8175848131515837, 0.5758081914178453),
+    TW(0.307849640041535, -0.9514350209690083), TW(-0.8104571982525947, -0.585797857456439),
+    TW(-0.8068475535437994, 0.5907597018588739), TW(0.3020059493192282, -0.9533060403541938),
+    TW(-0.8175848131515836, -0.5758081914178454), TW(-0.7958369046088836, 0.6055110414043254),
+    TW(0.29615088824362396, -0.9551411683057707), TW(-0.8245893027850251, -0.5657318107836135),
+    TW(-0.7845565971555752, 0.6200572117632892), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.2844075372112718, -0.9587034748958716), TW(-0.8382247055548381, -0.5453249884220464),
+    TW(-0.7612023854842619, 0.6485144010221123), TW(0.27851968938505306, -0.9604305194155658),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(-0.7491363945234593, 0.6624157775901718),
+    TW(0.272621355449949, -0.9621214042690416), TW(-0.8513551931052652, -0.524589682678469),
+    TW(-0.73681656887737, 0.6760927035753158), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.857728610000272, -0.5141027441932218), TW(-0.724247082951467, 0.6895405447370668),
+    TW(0.26079411791527557, -0.9653944416976894), TW(-0.8639728561215867, -0.5035383837257177),
+    TW(-0.7114321957452167, 0.7027547444572251), TW(0.2548656596045146, -0.9669764710448521),
+    TW(-0.8700869911087113, -0.49289819222978415), TW(-0.698376249408973, 0.7157308252838185),
+    TW(0.24892760574572026, -0.9685220942744173), TW(-0.8760700941954065, -0.4821837720791229),
+    TW(-0.6850836677727004, 0.7284643904482252), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.23702360599436734, -0.9715038909862518), TW(-0.8876396204028538, -0.4605387109582402),
+    TW(-0.6578066932970787, 0.7531867990436124), TW(0.23105810828067128, -0.9729399522055601),
+    TW(-0.8932243011955152, -0.4496113296546069), TW(-0.6438315428897915, 0.765167265622459),
+    TW(0.22508391135979278, -0.9743393827855759), TW(-0.8986744656939539, -0.43861623853852755),
+    TW(-0.6296382389149269, 0.7768884656732326), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.9039892931234433, -0.42755509343028203), TW(-0.6152315905806273, 0.7883464276266059),
+    TW(0.21311031991609136, -0.9770281426577544), TW(-0.9091679830905224, -0.41642956009763715),
+    TW(-0.6006164793838693, 0.7995372691079048), TW(0.20711137619221856, -0.9783173707196277),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(-0.5857978574564391, 0.8104571982525947),
+    TW(0.20110463484209196, -0.9795697656854405), TW(-0.9191138516900578, -0.39399204006104815),
+    TW(-0.5707807458869674, 0.8211025149911046), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.18906866414980628, -0.9819638691095552), TW(-0.9285060804732155, -0.3713171939518377),
+    TW(-0.5401714727298927, 0.8415549774368986), TW(0.18303988795514106, -0.9831054874312163),
+    TW(-0.9329927988347388, -0.35989503653498833), TW(-0.5245896826784694, 0.8513551931052649),
+    TW(0.17700422041214886, -0.984210092386929), TW(-0.9373390119125748, -0.3484186802494348),
+    TW(-0.5088301425431073, 0.8608669386377671), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(-0.4928981922297842, 0.8700869911087113),
+    TW(0.1649131204899701, -0.9863080972445987), TW(-0.9456073253805212, -0.32531029216226326),
+    TW(-0.47679923006332214, 0.8790122264286334), TW(0.1588581433338614, -0.9873014181578584),
+    TW(-0.9495281805930367, -0.3136817403988914), TW(-0.4605387109582399, 0.887639620402854),
+    TW(0.1527971852584434, -0.9882575677307495), TW(-0.9533060403541939, -0.30200594931922803),
+    TW(-0.44412214457042976, 0.8959662497561849), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.14065823933284924, -0.9900582102622971), TW(-0.9604305194155658, -0.27851968938505317),
+    TW(-0.4108431710579042, 0.9117060320054298), TW(0.13458070850712622, -0.99090263542778),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(-0.3939920400610482, 0.9191138516900577),
+    TW(0.12849811079379322, -0.9917097536690995), TW(-0.9669764710448521, -0.2548656596045147),
+    TW(-0.3770074102164182, 0.9262102421383114), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.970031253194544, -0.24298017990326407), TW(-0.35989503653498794, 0.932992798834739),
+    TW(0.11631863091190488, -0.9932119492347945), TW(-0.9729399522055601, -0.23105810828067133),
+    TW(-0.3426607173119949, 0.9394592236021897), TW(0.11022220729388318, -0.9939069700023561),
+    TW(-0.9757021300385285, -0.21910124015687005), TW(-0.3253102921622633, 0.9456073253805212),
+    TW(0.10412163387205473, -0.9945645707342554), TW(-0.9783173707196275, -0.20711137619221884),
+    TW(-0.3078496400415351, 0.9514350209690083), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.0919089564971327, -0.9957674144676598), TW(-0.9831054874312163, -0.1830398879551409),
+    TW(-0.27262135544994887, 0.9621214042690416), TW(0.08579731234443988, -0.996312612182778),
+    TW(-0.9852776423889412, -0.17096188876030122), TW(-0.25486565960451435, 0.9669764710448522),
+    TW(0.07968243797143013, -0.9968202992911657), TW(-0.9873014181578584, -0.15885814333386147),
+    TW(-0.23702360599436767, 0.9715038909862517), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.989176509964781, -0.1467304744553618), TW(-0.2191012401568701, 0.9757021300385285),
+    TW(0.0674439195636641, -0.9977230666441916), TW(-0.99090263542778, -0.13458070850712628),
+    TW(-0.20110463484209207, 0.9795697656854405), TW(0.06132073630220865, -0.9981181129001492),
+    TW(-0.99247953459871, -0.12241067519921635), TW(-0.18303988795514095, 0.9831054874312163),
+    TW(0.05519524434969003, -0.9984755805732948), TW(-0.9939069700023561, -0.11022220729388324),
+    TW(-0.16491312048996976, 0.9863080972445987), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.04293825693494096, -0.9990777277526454), TW(-0.996312612182778, -0.08579731234444016),
+    TW(-0.12849811079379359, 0.9917097536690995), TW(0.03680722294135899, -0.9993223845883495),
+    TW(-0.9972904566786902, -0.07356456359966773), TW(-0.11022220729388331, 0.9939069700023561),
+    TW(0.03067480317663658, -0.9995294175010931), TW(-0.9981181129001492, -0.06132073630220849),
+    TW(-0.09190895649713282, 0.9957674144676598), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(-0.07356456359966736, 0.9972904566786902),
+    TW(0.01840672990580482, -0.9998305817958234), TW(-0.9993223845883495, -0.03680722294135883),
+    TW(-0.05519524434968971, 0.9984755805732948), TW(0.012271538285719944, -0.9999247018391445),
+    TW(-0.9996988186962042, -0.024541228522912326), TW(-0.03680722294135933, 0.9993223845883494),
+    TW(0.006135884649154515, -0.9999811752826011), TW(-0.9999247018391445, -0.012271538285720007),
+    TW(-0.018406729905805164, 0.9998305817958234), TW(1.0, -0.0),
+    TW(1.0, -0.0), TW(1.0, -0.0),
+    TW(0.9999988234517019, -0.0015339801862847655), TW(0.9999952938095762, -0.003067956762965976),
+    TW(0.9999894110819284, -0.0046019261204485705), TW(0.9999952938095762, -0.003067956762965976),
+    TW(0.9999811752826011, -0.006135884649154475), TW(0.9999576445519639, -0.00920375478205982),
+    TW(0.9999894110819284, -0.0046019261204485705), TW(0.9999576445519639, -0.00920375478205982),
+    TW(0.9999047010828529, -0.01380538852806039), TW(0.9999811752826011, -0.006135884649154475),
+    TW(0.9999247018391445, -0.012271538285719925), TW(0.9998305817958234, -0.01840672990580482),
+    TW(0.9999705864309741, -0.007669828739531097), TW(0.9998823474542126, -0.0153392062849881),
+    TW(0.9997352882605617, -0.02300768146883937), TW(0.9999576445519639, -0.00920375478205982),
+    TW(0.9998305817958234, -0.01840672990580482), TW(0.9996188224951786, -0.02760814577896574),
+    TW(0.9999423496760239, -0.01073765916726449), TW(0.9997694053512153, -0.021474080275469508),
+    TW(0.999481186966167, -0.032208025408304586), TW(0.9999247018391445, -0.012271538285719925),
+    TW(0.9996988186962042, -0.024541228522912288), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9999047010828529, -0.01380538852806039), TW(0.9996188224951786, -0.02760814577896574),
+    TW(0.9991424187248169, -0.04140564097707674), TW(0.9998823474542126, -0.0153392062849881),
+    TW(0.9995294175010931, -0.030674803176636626), TW(0.9989412931868569, -0.04600318213091462),
+    TW(0.9998576410058239, -0.01687298794728171), TW(0.9994306045554617, -0.03374117185137758),
+    TW(0.9987190122338729, -0.05059974903689928), TW(0.9998305817958234, -0.01840672990580482),
+    TW(0.9993223845883495, -0.03680722294135883), TW(0.9984755805732948, -0.055195244349689934),
+    TW(0.9998011698878843, -0.01994042855151444), TW(0.9992047586183639, -0.03987292758773981),
+    TW(0.9982110033604782, -0.05978957074663987), TW(0.9997694053512153, -0.021474080275469508),
+    TW(0.9990777277526454, -0.04293825693494082), TW(0.997925286198596, -0.06438263092985747),
+    TW(0.9997352882605617, -0.02300768146883937), TW(0.9989412931868569, -0.04600318213091462),
+    TW(0.9976184351385196, -0.06897432762826675), TW(0.9996988186962042, -0.024541228522912288),
+    TW(0.9987954562051724, -0.049067674327418015), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.9996599967439592, -0.0260747178291039), TW(0.9986402181802653, -0.052131704680283324),
+    TW(0.9969413577649822, -0.07815324163279423), TW(0.9996188224951786, -0.02760814577896574),
+    TW(0.9984755805732948, -0.055195244349689934), TW(0.9965711457905548, -0.08274026454937569),
+    TW(0.9995752960467492, -0.029141508764193722), TW(0.9983015449338929, -0.05825826450043575),
+    TW(0.996179828595697, -0.08732553520619206), TW(0.9995294175010931, -0.030674803176636626),
+    TW(0.9981181129001492, -0.06132073630220858), TW(0.9957674144676598, -0.09190895649713272),
+    TW(0.999481186966167, -0.032208025408304586), TW(0.997925286198596, -0.06438263092985747),
+    TW(0.9953339121404823, -0.09649043135525259), TW(0.9994306045554617, -0.03374117185137758),
+    TW(0.9977230666441916, -0.06744391956366405), TW(0.9948793307948056, -0.10106986275482782),
+    TW(0.9993776703880028, -0.03527423889821395), TW(0.9975114561403035, -0.07050457338961386),
+    TW(0.9944036800576791, -0.10564715371341062), TW(0.9993223845883495, -0.03680722294135883),
+    TW(0.9972904566786902, -0.07356456359966743), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9992647472865944, -0.038340120373552694), TW(0.997060070339483, -0.07662386139203149),
+    TW(0.9933892111480807, -0.11479492660651008), TW(0.9992047586183639, -0.03987292758773981),
+    TW(0.9968202992911657, -0.07968243797143013), TW(0.9928504144598651, -0.11936521481099135),
+    TW(0.9991424187248169, -0.04140564097707674), TW(0.9965711457905548, -0.08274026454937569),
+    TW(0.9922905913482574, -0.12393297511851216), TW(0.9990777277526454, -0.04293825693494082),
+    TW(0.996312612182778, -0.0857973123444399), TW(0.9917097536690995, -0.12849811079379317),
+    TW(0.9990106858540734, -0.04447077185493867), TW(0.996044700901252, -0.0888535525825246),
+    TW(0.9911079137232769, -0.13306052515713906), TW(0.9989412931868569, -0.04600318213091462),
+    TW(0.9957674144676598, -0.09190895649713272), TW(0.9904850842564571, -0.13762012158648604),
+    TW(0.9988695499142836, -0.0475354841569593), TW(0.9954807554919269, -0.09496349532963899),
+    TW(0.9898412784588205, -0.14217680351944803), TW(0.9987954562051724, -0.049067674327418015),
+    TW(0.9951847266721969, -0.0980171403295606), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9987190122338729, -0.05059974903689928), TW(0.9948793307948056, -0.10106986275482782),
+    TW(0.9884907928526966, -0.15128103795733022), TW(0.9986402181802653, -0.052131704680283324),
+    TW(0.9945645707342554, -0.10412163387205459), TW(0.9877841416445722, -0.15582839765426523),
+    TW(0.9985590742297593, -0.05366353765273052), TW(0.9942404494531879, -0.10717242495680884),
+    TW(0.987056571305751, -0.16037245724292828), TW(0.9984755805732948, -0.055195244349689934),
+    TW(0.9939069700023561, -0.11022220729388306), TW(0.9863080972445987, -0.16491312048996992),
+    TW(0.9983897374073402, -0.05672682116690775), TW(0.9935641355205953, -0.11327095217756435),
+    TW(0.9855387353121761, -0.16945029123396796), TW(0.9983015449338929, -0.05825826450043575),
+    TW(0.9932119492347945, -0.11631863091190475), TW(0.9847485018019042, -0.17398387338746382),
+    TW(0.9982110033604782, -0.05978957074663987), TW(0.9928504144598651, -0.11936521481099135),
+    TW(0.9839374134492189, -0.1785137709389975), TW(0.9981181129001492, -0.06132073630220858),
+    TW(0.99247953459871, -0.1224106751992162), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.9980228737714862, -0.0628517575641614), TW(0.9920993131421918, -0.12545498341154623),
+    TW(0.9822527413662894, -0.1875621285825296), TW(0.997925286198596, -0.06438263092985747),
+    TW(0.9917097536690995, -0.12849811079379317), TW(0.9813791933137546, -0.19208039704989244),
+    TW(0.9978253504111116, -0.0659133527970038), TW(0.9913108598461154, -0.13154002870288312),
+    TW(0.9804848617734694, -0.19659459767008022), TW(0.9977230666441916, -0.06744391956366405),
+    TW(0.99090263542778, -0.13458070850712617), TW(0.9795697656854405, -0.2011046348420919),
+    TW(0.9976184351385196, -0.06897432762826675), TW(0.9904850842564571, -0.13762012158648604),
+    TW(0.9786339244294232, -0.20561041305309924), TW(0.9975114561403035, -0.07050457338961386),
+    TW(0.9900582102622971, -0.1406582393328492), TW(0.9776773578245099, -0.2101118368804696),
+    TW(0.9974021299012753, -0.07203465324688933), TW(0.9896220174632009, -0.14369503315029447),
+    TW(0.9767000861287118, -0.21460881099378676), TW(0.9972904566786902, -0.07356456359966743),
+    TW(0.989176509964781, -0.14673047445536175), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9971764367353262, -0.0750943008479213), TW(0.9887216919603238, -0.1497645346773215),
+    TW(0.9746835106885107, -0.22358902922979), TW(0.997060070339483, -0.07662386139203149),
+    TW(0.9882575677307495, -0.15279718525844344), TW(0.973644249650812, -0.22807208317088573),
+    TW(0.9969413577649822, -0.07815324163279423), TW(0.9877841416445722, -0.15582839765426523),
+    TW(0.9725843689347322, -0.23255030703877524), TW(0.9968202992911657, -0.07968243797143013),
+    TW(0.9873014181578584, -0.15885814333386145), TW(0.9715038909862518, -0.2370236059943672),
+    TW(0.9966968952028961, -0.08121144680959244), TW(0.9868094018141855, -0.16188639378011183),
+    TW(0.9704028386875555, -0.24149188530286933), TW(0.9965711457905548, -0.08274026454937569),
+    TW(0.9863080972445987, -0.16491312048996992), TW(0.9692812353565485, -0.2459550503357946),
+    TW(0.9964430513500426, -0.08426888759332407), TW(0.9857975091675675, -0.16793829497473117),
+    TW(0.9681391047463624, -0.2504130065729652), TW(0.996312612182778, -0.0857973123444399),
+    TW(0.9852776423889412, -0.17096188876030122), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.996179828595697, -0.08732553520619206), TW(0.9847485018019042, -0.17398387338746382),
+    TW(0.9657933588740837, -0.25931291513288623), TW(0.996044700901252, -0.0888535525825246),
+    TW(0.984210092386929, -0.17700422041214875), TW(0.9645897932898128, -0.26375467897483135),
+    TW(0.9959072294174117, -0.09038136087786498), TW(0.9836624192117303, -0.18002290140569951),
+    TW(0.963365799780954, -0.2681908570634032), TW(0.9957674144676598, -0.09190895649713272),
+    TW(0.9831054874312163, -0.18303988795514095), TW(0.9621214042690416, -0.272621355449949),
+    TW(0.9956252563809943, -0.09343633584574779), TW(0.9825393022874412, -0.18605515166344663),
+    TW(0.9608566331076797, -0.2770460803060999), TW(0.9954807554919269, -0.09496349532963899),
+    TW(0.9819638691095552, -0.1890686641498062), TW(0.9595715130819845, -0.28146493792575794),
+    TW(0.9953339121404823, -0.09649043135525259), TW(0.9813791933137546, -0.19208039704989244),
+    TW(0.9582660714080177, -0.2858778347270806), TW(0.9951847266721969, -0.0980171403295606),
+    TW(0.9807852804032304, -0.19509032201612825), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.9950331994381186, -0.09954361866006932), TW(0.9801821359681174, -0.19809841071795356),
+    TW(0.9555943341307711, -0.2946853721805143), TW(0.9948793307948056, -0.10106986275482782),
+    TW(0.9795697656854405, -0.2011046348420919), TW(0.9542280951091057, -0.2990798263080405),
+    TW(0.9947231211043257, -0.10259586902243628), TW(0.9789481753190622, -0.20410896609281687),
+    TW(0.9528416476011987, -0.3034679465720113), TW(0.9945645707342554, -0.10412163387205459),
+    TW(0.9783173707196277, -0.20711137619221856), TW(0.9514350209690083, -0.30784964004153487),
+    TW(0.9944036800576791, -0.10564715371341062), TW(0.9776773578245099, -0.2101118368804696),
+    TW(0.950008245001843, -0.3122248139218249), TW(0.9942404494531879, -0.10717242495680884),
+    TW(0.9770281426577544, -0.21311031991609136), TW(0.9485613499157303, -0.31659337555616585),
+    TW(0.9940748793048794, -0.10869744401313872), TW(0.9763697313300211, -0.21610679707621952),
+    TW(0.9470943663527772, -0.3209552324278752), TW(0.9939069700023561, -0.11022220729388306),
+    TW(0.9757021300385286, -0.2191012401568698), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.9937367219407246, -0.11174671121112659), TW(0.9750253450669941, -0.2220936209732035),
+    TW(0.9441002584912727, -0.3296584625285875), TW(0.9935641355205953, -0.11327095217756435),
+    TW(0.9743393827855759, -0.22508391135979283), TW(0.9425731976014469, -0.3339996514420094),
+    TW(0.9933892111480807, -0.11479492660651008), TW(0.973644249650812, -0.22807208317088573),
+    TW(0.9410261750508893, -0.3383337669655411), TW(0.9932119492347945, -0.11631863091190475),
+    TW(0.9729399522055602, -0.2310581082806711), TW(0.9394592236021899, -0.3426607173119944),
+    TW(0.9930323501978514, -0.11784206150832498), TW(0.9722264970789363, -0.23404195858354343),
+    TW(0.9378723764399899, -0.3469804108459237), TW(0.9928504144598651, -0.11936521481099135),
+    TW(0.9715038909862518, -0.2370236059943672), TW(0.9362656671702783, -0.3512927560855671),
+    TW(0.992666142448948, -0.12088808723577708), TW(0.9707721407289504, -0.2400030224487415),
+    TW(0.9346391298196808, -0.35559766170478385), TW(0.99247953459871, -0.1224106751992162),
+    TW(0.970031253194544, -0.24298017990326387), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.9922905913482574, -0.12393297511851216), TW(0.9692812353565485, -0.2459550503357946),
+    TW(0.9313267090811804, -0.3641847895670799), TW(0.9920993131421918, -0.12545498341154623),
+    TW(0.9685220942744174, -0.24892760574572015), TW(0.9296408958431813, -0.3684668299533723),
+    TW(0.9919057004306093, -0.12697669649688587), TW(0.9677538370934755, -0.25189781815421697),
+    TW(0.9279353948226179, -0.37274106700951576), TW(0.9917097536690995, -0.12849811079379317),
+    TW(0.9669764710448521, -0.25486565960451457), TW(0.9262102421383114, -0.37700741021641826),
+    TW(0.9915114733187439, -0.13001922272223335), TW(0.9661900034454125, -0.257831102162159),
+    TW(0.9244654743252626, -0.3812657692221624), TW(0.9913108598461154, -0.13154002870288312),
+    TW(0.9653944416976894, -0.2607941179152755), TW(0.9227011283338786, -0.38551605384391885),
+    TW(0.9911079137232769, -0.13306052515713906), TW(0.9645897932898128, -0.26375467897483135),
+    TW(0.9209172415291895, -0.3897581740698564), TW(0.99090263542778, -0.13458070850712617),
+    TW(0.9637760657954398, -0.26671275747489837), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.9906950254426646, -0.1361005751757062), TW(0.9629532668736839, -0.2696683255729151),
+    TW(0.9172909970083779, -0.39821756215337356), TW(0.9904850842564571, -0.13762012158648604),
+    TW(0.9621214042690416, -0.272621355449949), TW(0.9154487160882678, -0.40243465085941843),
+    TW(0.9902728123631691, -0.1391393441638262), TW(0.9612804858113206, -0.27557181931095814),
+    TW(0.9135870479452508, -0.40664321687036903), TW(0.9900582102622971, -0.1406582393328492),
+    TW(0.9604305194155658, -0.27851968938505306), TW(0.9117060320054299, -0.4108431710579039),
+    TW(0.9898412784588205, -0.14217680351944803), TW(0.9595715130819845, -0.28146493792575794),
+    TW(0.9098057081046522, -0.41503442447608163), TW(0.9896220174632009, -0.14369503315029447),
+    TW(0.9587034748958716, -0.2844075372112719), TW(0.9078861164876663, -0.4192168883632239),
+    TW(0.9894004277913804, -0.14521292465284746), TW(0.9578264130275329, -0.2873474595447295),
+    TW(0.9059472978072685, -0.42339047414379605), TW(0.989176509964781, -0.14673047445536175),
+    TW(0.9569403357322088, -0.29028467725446233), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.988950264510303, -0.14824767898689603), TW(0.9560452513499964, -0.29321916269425863),
+    TW(0.9020121439024932, -0.43171065802505726), TW(0.9887216919603238, -0.1497645346773215),
+    TW(0.9551411683057708, -0.2961508882436238), TW(0.9000158920161603, -0.4358570799222555),
+    TW(0.9884907928526966, -0.15128103795733022), TW(0.9542280951091057, -0.2990798263080405),
+    TW(0.8980005797407399, -0.43999427130963326), TW(0.9882575677307495, -0.15279718525844344),
+    TW(0.9533060403541939, -0.3020059493192281), TW(0.8959662497561852, -0.4441221445704292),
+    TW(0.9880220171432835, -0.1543129730130201), TW(0.9523750127197659, -0.3049292297354024),
+    TW(0.8939129451452033, -0.4482406122852199), TW(0.9877841416445722, -0.15582839765426523),
+    TW(0.9514350209690083, -0.30784964004153487), TW(0.8918407093923427, -0.4523495872337709),
+    TW(0.9875439417943592, -0.15734345561623825), TW(0.9504860739494817, -0.3107671527496115),
+    TW(0.8897495863830728, -0.4564489823968839), TW(0.9873014181578584, -0.15885814333386145),
+    TW(0.9495281805930367, -0.3136817403988915), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.987056571305751, -0.16037245724292828), TW(0.9485613499157303, -0.31659337555616585),
+    TW(0.8855108561362, -0.4646186863062378), TW(0.9868094018141855, -0.16188639378011183),
+    TW(0.9475855910177411, -0.3195020308160157), TW(0.8833633386657316, -0.4686888220358279),
+    TW(0.9865599102647754, -0.16339994938297323), TW(0.9466009130832835, -0.32240767880106985),
+    TW(0.8811971134712221, -0.4727490319503428), TW(0.9863080972445987, -0.16491312048996992),
+    TW(0.9456073253805213, -0.3253102921622629), TW(0.8790122264286335, -0.4767992300633221),
+    TW(0.9860539633461954, -0.1664259035404641), TW(0.9446048372614803, -0.3282098435790925),
+    TW(0.8768087238091457, -0.48083933060033396), TW(0.9857975091675675, -0.16793829497473117),
+    TW(0.9435934581619604, -0.33110630575987643), TW(0.8745866522781761, -0.48486924800079106),
+    TW(0.9855387353121761, -0.16945029123396796), TW(0.9425731976014469, -0.3339996514420094),
+    TW(0.8723460588943915, -0.48888889691976317), TW(0.9852776423889412, -0.17096188876030122),
+    TW(0.9415440651830208, -0.33688985339222005), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.9850142310122398, -0.17247308399679595), TW(0.9405060705932683, -0.33977688440682685),
+    TW(0.8678094967633033, -0.49689704902265447), TW(0.9847485018019042, -0.17398387338746382),
+    TW(0.9394592236021899, -0.3426607173119944), TW(0.8655136240905691, -0.5008853826112407),
+    TW(0.9844804553832209, -0.17549425337727143), TW(0.9384035340631081, -0.3455413249639891),
+    TW(0.8631994217121242, -0.5048631085312676), TW(0.984210092386929, -0.17700422041214875),
+    TW(0.937339011912575, -0.34841868024943456), TW(0.8608669386377673, -0.508830142543107),
+    TW(0.9839374134492189, -0.1785137709389975), TW(0.9362656671702783, -0.3512927560855671),
+    TW(0.8585162242644427, -0.512786400633563), TW(0.9836624192117303, -0.18002290140569951),
+    TW(0.9351835099389476, -0.35416352542049034), TW(0.8561473283751945, -0.5167317990176499),
+    TW(0.9833851103215512, -0.18153160826112497), TW(0.934092550404259, -0.35703096123343),
+    TW(0.8537603011381114, -0.5206662541403672), TW(0.9831054874312163, -0.18303988795514095),
+    TW(0.932992798834739, -0.3598950365349881), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.9828235511987052, -0.18454773693861962), TW(0.9318842655816681, -0.3627557243673972),
+    TW(0.8489320552116396, -0.5285020015422285), TW(0.9825393022874412, -0.18605515166344663),
+    TW(0.9307669610789837, -0.36561299780477385), TW(0.8464909387740521, -0.5324031278771979),
+    TW(0.9822527413662894, -0.1875621285825296), TW(0.9296408958431813, -0.3684668299533723),
+    TW(0.8440318954900664, -0.5362929790659632), TW(0.9819638691095552, -0.1890686641498062),
+    TW(0.9285060804732156, -0.37131719395183754), TW(0.8415549774368984, -0.5401714727298929),
+    TW(0.9816726861969831, -0.19057475482025274), TW(0.9273625256504011, -0.37416406297145793),
+    TW(0.8390602370703127, -0.5440385267308838), TW(0.9813791933137546, -0.19208039704989244),
+    TW(0.9262102421383114, -0.37700741021641826), TW(0.836547727223512, -0.5478940591731002),
+    TW(0.9810833911504867, -0.1935855872958036), TW(0.9250492407826776, -0.37984720892405116),
+    TW(0.8340175011060181, -0.5517379884047073), TW(0.9807852804032304, -0.19509032201612825),
+    TW(0.9238795325112867, -0.3826834323650898), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.9804848617734694, -0.19659459767008022), TW(0.9227011283338786, -0.38551605384391885),
+    TW(0.8289041147718649, -0.5593907118591361), TW(0.9801821359681174, -0.19809841071795356),
+    TW(0.921514039342042, -0.38834504669882625), TW(0.8263210628456635, -0.5631993440138341),
+    TW(0.9798771036995176, -0.19960175762113097), TW(0.9203182767091106, -0.39117038430225387),
+    TW(0.8237205112273914, -0.5669960488251087), TW(0.9795697656854405, -0.2011046348420919),
+    TW(0.9191138516900578, -0.3939920400610481), TW(0.8211025149911046, -0.5707807458869673),
+    TW(0.979260122649082, -0.20260703884442113), TW(0.9179007756213905, -0.3968099874167103),
+    TW(0.8184671295802987, -0.5745533550477158), TW(0.9789481753190622, -0.20410896609281687),
+    TW(0.9166790599210427, -0.3996241998456468), TW(0.8158144108067338, -0.5783137964116556),
+    TW(0.9786339244294232, -0.20561041305309924), TW(0.9154487160882678, -0.40243465085941843),
+    TW(0.8131444148492536, -0.5820619903407754), TW(0.9783173707196277, -0.20711137619221856),
+    TW(0.9142097557035307, -0.40524131400498986), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.9779985149345571, -0.20861185197826349), TW(0.9129621904283982, -0.4080441628649787),
+    TW(0.8077528179261904, -0.5895213186410639), TW(0.9776773578245099, -0.2101118368804696),
+    TW(0.9117060320054299, -0.4108431710579039), TW(0.8050313311429637, -0.5932322950397998),
+    TW(0.9773539001452, -0.21161132736922755), TW(0.9104412922580672, -0.4136383122384345),
+    TW(0.8022927955381157, -0.5969307080621965), TW(0.9770281426577544, -0.21311031991609136),
+    TW(0.9091679830905224, -0.41642956009763715), TW(0.799537269107905, -0.600616479383869),
+    TW(0.9767000861287118, -0.21460881099378676), TW(0.9078861164876663, -0.4192168883632239),
+    TW(0.7967648102084188, -0.604289530948156), TW(0.9763697313300211, -0.21610679707621952),
+    TW(0.9065957045149153, -0.4220002707997997), TW(0.7939754775543372, -0.6079497849677736),
+    TW(0.976037079039039, -0.21760427463848364), TW(0.9052967593181188, -0.4247796812091088),
+    TW(0.7911693302176902, -0.6115971639264619), TW(0.9757021300385286, -0.2191012401568698),
+    TW(0.9039892931234433, -0.4275550934302821), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.975364885116657, -0.2205976901088735), TW(0.9026733182372588, -0.4303264813400826),
+    TW(0.7855068295640539, -0.6188529879609763), TW(0.9750253450669941, -0.2220936209732035),
+    TW(0.901348847046022, -0.43309381885315196), TW(0.7826505961665757, -0.62246127937415),
+    TW(0.9746835106885107, -0.22358902922979), TW(0.9000158920161603, -0.4358570799222555),
+    TW(0.7797777879230146, -0.6260563884043435), TW(0.9743393827855759, -0.22508391135979283),
+    TW(0.8986744656939538, -0.43861623853852766), TW(0.7768884656732324, -0.629638238914927),
+    TW(0.9739929621679558, -0.22657826384561), TW(0.8973245807054183, -0.44137126873171667),
+    TW(0.7739826906068229, -0.6332067550500572), TW(0.973644249650812, -0.22807208317088573),
+    TW(0.8959662497561852, -0.4441221445704292), TW(0.7710605242618138, -0.6367618612362842),
+    TW(0.9732932460546982, -0.22956536582051887), TW(0.8945994856313827, -0.44686884016237416),
+    TW(0.7681220285233654, -0.6403034821841517), TW(0.9729399522055602, -0.2310581082806711),
+    TW(0.8932243011955153, -0.44961132965460654), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.9725843689347322, -0.23255030703877524), TW(0.8918407093923427, -0.4523495872337709),
+    TW(0.7621962981345789, -0.6473459686365121), TW(0.9722264970789363, -0.23404195858354343),
+    TW(0.8904487232447579, -0.45508358712634384), TW(0.7592091889783881, -0.6508466849963809),
+    TW(0.9718663374802794, -0.2355330594049755), TW(0.8890483558546646, -0.4578133035988772),
+    TW(0.7562060014143945, -0.6543336178318004), TW(0.9715038909862518, -0.2370236059943672),
+    TW(0.8876396204028539, -0.46053871095824), TW(0.7531867990436125, -0.6578066932970786),
+    TW(0.9711391584497251, -0.23851359484431842), TW(0.8862225301488806, -0.46325978355186015),
+    TW(0.7501516458062151, -0.6612658378399923), TW(0.9707721407289504, -0.2400030224487415),
+    TW(0.8847970984309378, -0.4659764957679662), TW(0.7471006059801801, -0.6647109782033448),
+    TW(0.9704028386875555, -0.24149188530286933), TW(0.8833633386657316, -0.4686888220358279),
+    TW(0.7440337441799293, -0.6681420414265185), TW(0.970031253194544, -0.24298017990326387),
+    TW(0.881921264348355, -0.47139673682599764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.9696573851242924, -0.24446790274782415), TW(0.8804708890521608, -0.47410021465054997),
+    TW(0.737852814788466, -0.6749616461020119), TW(0.9692812353565485, -0.2459550503357946),
+    TW(0.8790122264286335, -0.4767992300633221), TW(0.7347388780959635, -0.6783500431298615),
+    TW(0.9689028047764289, -0.24744161916777327), TW(0.8775452902072614, -0.479493757660153),
+    TW(0.7316093812238926, -0.6817240741716497), TW(0.9685220942744174, -0.24892760574572015),
+    TW(0.8760700941954066, -0.4821837720791227), TW(0.7284643904482252, -0.6850836677727004),
+    TW(0.9681391047463624, -0.2504130065729652), TW(0.8745866522781761, -0.48486924800079106),
+    TW(0.7253039723730608, -0.6884287527840904), TW(0.9677538370934755, -0.25189781815421697),
+    TW(0.8730949784182901, -0.487550160148436), TW(0.7221281939292153, -0.6917592583641577),
+    TW(0.9673662922223285, -0.25338203699557016), TW(0.871595086655951, -0.49022648328829116),
+    TW(0.7189371223728045, -0.6950751139800009), TW(0.9669764710448521, -0.25486565960451457),
+    TW(0.8700869911087115, -0.49289819222978404), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.9665843744783331, -0.2563486824899429), TW(0.8685707059713409, -0.49556526182577254),
+    TW(0.7125093705646923, -0.7016625947401685), TW(0.9661900034454125, -0.257831102162159),
+    TW(0.8670462455156926, -0.49822766697278187), TW(0.7092728264388657, -0.7049340803759049),
+    TW(0.9657933588740837, -0.25931291513288623), TW(0.8655136240905691, -0.5008853826112407),
+    TW(0.7060212614493397, -0.7081906370331953), TW(0.9653944416976894, -0.2607941179152755),
+    TW(0.8639728561215868, -0.5035383837257176), TW(0.7027547444572253, -0.7114321957452164),
+    TW(0.9649932528549203, -0.2622747070239136), TW(0.8624239561110406, -0.5061866453451552),
+    TW(0.6994733446402838, -0.714658687862769), TW(0.9645897932898128, -0.26375467897483135),
+    TW(0.8608669386377673, -0.508830142543107), TW(0.696177131491463, -0.7178700450557317),
+    TW(0.9641840639517458, -0.2652340302855118), TW(0.8593018183570085, -0.5114688504379703),
+    TW(0.6928661748174247, -0.7210661993145081), TW(0.9637760657954398, -0.26671275747489837),
+    TW(0.8577286100002721, -0.5141027441932217), TW(0.6895405447370669, -0.7242470829514669),
+    TW(0.963365799780954, -0.2681908570634032), TW(0.8561473283751945, -0.5167317990176499),
+    TW(0.6862003116800387, -0.7274126286023758), TW(0.9629532668736839, -0.2696683255729151),
+    TW(0.8545579883654005, -0.5193559901655896), TW(0.6828455463852481, -0.7305627692278276),
+    TW(0.9625384680443592, -0.271145159526808), TW(0.8529606049303636, -0.5219752929371544),
+    TW(0.6794763198993651, -0.7336974381146603), TW(0.9621214042690416, -0.272621355449949),
+    TW(0.8513551931052652, -0.524589682678469), TW(0.676092703575316, -0.7368165688773698),
+    TW(0.9617020765291225, -0.2740969098687064), TW(0.8497417680008525, -0.5271991347819013),
+    TW(0.672694769070773, -0.7399200954595161), TW(0.9612804858113206, -0.27557181931095814),
+    TW(0.8481203448032972, -0.5298036246862946), TW(0.669282588346636, -0.7430079521351217),
+    TW(0.9608566331076797, -0.2770460803060999), TW(0.8464909387740521, -0.5324031278771979),
+    TW(0.6658562336655097, -0.7460800735100638), TW(0.9604305194155658, -0.27851968938505306),
+    TW(0.8448535652497071, -0.5349976198870972), TW(0.6624157775901718, -0.7491363945234593),
+    TW(0.960002145737666, -0.2799926430802732), TW(0.8432082396418454, -0.5375870762956454),
+    TW(0.6589612929820373, -0.7521768504490427), TW(0.9595715130819845, -0.28146493792575794),
+    TW(0.8415549774368984, -0.5401714727298929), TW(0.6554928529996155, -0.7552013768965365),
+    TW(0.9591386224618419, -0.2829365704570554), TW(0.8398937941959995, -0.5427507848645159),
+    TW(0.6520105310969595, -0.7582099098130153), TW(0.9587034748958716, -0.2844075372112719),
+    TW(0.8382247055548381, -0.5453249884220465), TW(0.6485144010221126, -0.7612023854842618),
+    TW(0.9582660714080177, -0.2858778347270806), TW(0.836547727223512, -0.5478940591731002),
+    TW(0.645004536815544, -0.7641787405361167), TW(0.9578264130275329, -0.2873474595447295),
+    TW(0.83486287498638, -0.5504579729366048), TW(0.6414810128085832, -0.7671389119358204),
+    TW(0.9573845007889759, -0.2888164082060495), TW(0.8331701647019132, -0.5530167055800275),
+    TW(0.6379439036218442, -0.7700828369933479), TW(0.9569403357322088, -0.29028467725446233),
+    TW(0.8314696123025452, -0.5555702330196022), TW(0.6343932841636455, -0.773010453362737),
+    TW(0.9564939189023951, -0.29175226323498926), TW(0.829761233794523, -0.5581185312205561),
+    TW(0.6308292296284245, -0.7759216990434076), TW(0.9560452513499964, -0.29321916269425863),
+    TW(0.8280450452577558, -0.560661576197336), TW(0.6272518154951442, -0.7788165123814759),
+    TW(0.9555943341307711, -0.2946853721805143), TW(0.8263210628456635, -0.5631993440138341),
+    TW(0.6236611175256946, -0.7816948320710594), TW(0.9551411683057708, -0.2961508882436238),
+    TW(0.8245893027850253, -0.5657318107836131), TW(0.6200572117632892, -0.7845565971555752),
+    TW(0.9546857549413383, -0.2976157074350862), TW(0.8228497813758264, -0.5682589526701315),
+    TW(0.6164401745308536, -0.7874017470290313), TW(0.9542280951091057, -0.2990798263080405),
+    TW(0.8211025149911046, -0.5707807458869673), TW(0.6128100824294097, -0.79023022143731),
+    TW(0.9537681898859903, -0.30054324141727345), TW(0.8193475200767969, -0.5732971666980422),
+    TW(0.6091670123364532, -0.7930419604794436), TW(0.9533060403541939, -0.3020059493192281),
+    TW(0.8175848131515837, -0.5758081914178453), TW(0.6055110414043255, -0.7958369046088835),
+    TW(0.9528416476011987, -0.3034679465720113), TW(0.8158144108067338, -0.5783137964116556),
+    TW(0.60184224705858, -0.7986149946347608), TW(0.9523750127197659, -0.3049292297354024),
+    TW(0.8140363297059484, -0.5808139580957645), TW(0.5981607069963424, -0.8013761717231401),
+    TW(0.9519061368079323, -0.3063897953708609), TW(0.8122505865852039, -0.5833086529376983),
+    TW(0.5944664991846645, -0.8041203773982657), TW(0.9514350209690083, -0.30784964004153487),
+    TW(0.8104571982525948, -0.5857978574564389), TW(0.5907597018588743, -0.8068475535437992),
+    TW(0.9509616663115751, -0.3093087603122687), TW(0.808656181588175, -0.5882815482226452),
+    TW(0.5870403935209181, -0.8095576424040513), TW(0.9504860739494817, -0.3107671527496115),
+    TW(0.8068475535437993, -0.5907597018588742), TW(0.5833086529376983, -0.8122505865852039),
+    TW(0.950008245001843, -0.3122248139218249), TW(0.8050313311429637, -0.5932322950397998),
+    TW(0.5795645591394057, -0.8149263290565266), TW(0.9495281805930367, -0.3136817403988915),
+    TW(0.8032075314806449, -0.5956993044924334), TW(0.5758081914178453, -0.8175848131515837),
+    TW(0.9490458818527006, -0.31513792875252244), TW(0.8013761717231402, -0.5981607069963423),
+    TW(0.572039629324757, -0.8202259825694347), TW(0.9485613499157303, -0.31659337555616585),
+    TW(0.799537269107905, -0.600616479383869), TW(0.5682589526701315, -0.8228497813758263),
+    TW(0.9480745859222762, -0.31804807738501495), TW(0.7976908409433912, -0.6030665985403482),
+    TW(0.5644662415205195, -0.8254561540043774), TW(0.9475855910177411, -0.3195020308160157),
+    TW(0.7958369046088836, -0.6055110414043255), TW(0.560661576197336, -0.8280450452577558),
+    TW(0.9470943663527772, -0.3209552324278752), TW(0.7939754775543372, -0.6079497849677736),
+    TW(0.5568450372751601, -0.8306164003088462), TW(0.9466009130832835, -0.32240767880106985),
+    TW(0.7921065773002124, -0.6103828062763095), TW(0.5530167055800276, -0.8331701647019132),
+    TW(0.9461052323704034, -0.32385936651785285), TW(0.79023022143731, -0.6128100824294097),
+    TW(0.5491766621877198, -0.8357062843537526), TW(0.9456073253805213, -0.3253102921622629),
+    TW(0.7883464276266063, -0.6152315905806268), TW(0.5453249884220465, -0.838224705554838),
+    TW(0.9451071932852606, -0.32676045232013173), TW(0.7864552135990858, -0.6176473079378039),
+    TW(0.5414617658531236, -0.8407253749704581), TW(0.9446048372614803, -0.3282098435790925),
+    TW(0.7845565971555752, -0.6200572117632891), TW(0.5375870762956455, -0.8432082396418454),
+    TW(0.9441002584912727, -0.3296584625285875), TW(0.7826505961665757, -0.62246127937415),
+    TW(0.533701001807153, -0.8456732469872991), TW(0.9435934581619604, -0.33110630575987643),
+    TW(0.7807372285720945, -0.6248594881423863), TW(0.5298036246862948, -0.8481203448032971),
+    TW(0.9430844374660935, -0.3325533698660442), TW(0.778816512381476, -0.6272518154951441),
+    TW(0.5258950274710847, -0.8505494812656034), TW(0.9425731976014469, -0.3339996514420094),
+    TW(0.7768884656732324, -0.629638238914927), TW(0.5219752929371544, -0.8529606049303636),
+    TW(0.9420597397710173, -0.3354451470845316), TW(0.7749531065948739, -0.6320187359398091),
+    TW(0.5180445040959993, -0.855353664735196), TW(0.9415440651830208, -0.33688985339222005),
+    TW(0.773010453362737, -0.6343932841636455), TW(0.5141027441932217, -0.8577286100002721),
+    TW(0.9410261750508893, -0.3383337669655411), TW(0.7710605242618138, -0.6367618612362842),
+    TW(0.5101500967067667, -0.8600853904293901), TW(0.9405060705932683, -0.33977688440682685),
+    TW(0.7691033376455797, -0.6391244448637757), TW(0.5061866453451555, -0.8624239561110405),
+    TW(0.939983753034014, -0.34121920232028236), TW(0.7671389119358204, -0.6414810128085832),
+    TW(0.5022124740457109, -0.8647442575194624), TW(0.9394592236021899, -0.3426607173119944),
+    TW(0.765167265622459, -0.6438315428897914), TW(0.49822766697278187, -0.8670462455156926),
+    TW(0.9389324835320646, -0.3441014259899388), TW(0.7631884172633813, -0.6461760129833163),
+    TW(0.49423230851595973, -0.8693298713486067), TW(0.9384035340631081, -0.3455413249639891),
+    TW(0.7612023854842618, -0.6485144010221124), TW(0.4902264832882911, -0.8715950866559511),
+    TW(0.9378723764399899, -0.3469804108459237), TW(0.7592091889783881, -0.6508466849963809),
+    TW(0.48621027612448653, -0.8738418434653668), TW(0.937339011912575, -0.34841868024943456),
+    TW(0.7572088465064846, -0.6531728429537768), TW(0.48218377207912283, -0.8760700941954066),
+    TW(0.9368034417359216, -0.3498561297901349), TW(0.7552013768965365, -0.6554928529996153),
+    TW(0.4781470564248431, -0.8782797916565415), TW(0.9362656671702783, -0.3512927560855671),
+    TW(0.7531867990436125, -0.6578066932970786), TW(0.47410021465055, -0.8804708890521608),
+    TW(0.9357256894810804, -0.3527285557552107), TW(0.7511651319096865, -0.6601143420674205),
+    TW(0.4700433324595956, -0.8826433399795628), TW(0.9351835099389476, -0.35416352542049034),
+    TW(0.7491363945234594, -0.6624157775901718), TW(0.4659764957679661, -0.8847970984309378),
+    TW(0.9346391298196808, -0.35559766170478385), TW(0.7471006059801801, -0.6647109782033448),
+    TW(0.46189979070246284, -0.8869321187943421), TW(0.934092550404259, -0.35703096123343),
+    TW(0.7450577854414661, -0.6669999223036375), TW(0.4578133035988773, -0.8890483558546646),
+    TW(0.9335437729788362, -0.35846342063373654), TW(0.7430079521351217, -0.669282588346636),
+    TW(0.4537171210001639, -0.8911457647945832), TW(0.932992798834739, -0.3598950365349881),
+    TW(0.7409511253549591, -0.6715589548470183), TW(0.4496113296546066, -0.8932243011955153),
+    TW(0.9324396292684624, -0.3613258055684543), TW(0.7388873244606151, -0.673829000378756),
+    TW(0.44549601651398174, -0.8952839210385576), TW(0.9318842655816681, -0.3627557243673972),
+    TW(0.7368165688773699, -0.6760927035753159), TW(0.4413712687317166, -0.8973245807054183),
+    TW(0.9313267090811804, -0.3641847895670799), TW(0.7347388780959635, -0.6783500431298615),
+    TW(0.4372371736610442, -0.8993462369793415), TW(0.9307669610789837, -0.36561299780477385),
+    TW(0.7326542716724128, -0.680600997795453), TW(0.433093818853152, -0.901348847046022),
+    TW(0.9302050228922191, -0.3670403457197672), TW(0.7305627692278276, -0.6828455463852481),
+    TW(0.42894129205532955, -0.9033323684945118), TW(0.9296408958431813, -0.3684668299533723),
+    TW(0.7284643904482252, -0.6850836677727004), TW(0.4247796812091088, -0.9052967593181188),
+    TW(0.9290745812593159, -0.3698924471489341), TW(0.726359155084346, -0.687315340891759),
+    TW(0.4206090744484025, -0.9072419779152959), TW(0.9285060804732156, -0.37131719395183754),
+    TW(0.724247082951467, -0.6895405447370668), TW(0.4164295600976373, -0.9091679830905223),
+    TW(0.9279353948226179, -0.37274106700951576), TW(0.7221281939292153, -0.6917592583641577),
+    TW(0.412241226669883, -0.9110747340551762), TW(0.9273625256504011, -0.37416406297145793),
+    TW(0.7200025079613817, -0.693971460889654), TW(0.40804416286497874, -0.9129621904283981),
+    TW(0.9267874743045817, -0.3755861784892172), TW(0.7178700450557317, -0.696177131491463),
+    TW(0.40383845756765413, -0.9148303122379461), TW(0.9262102421383114, -0.37700741021641826),
+    TW(0.7157308252838186, -0.6983762494089729), TW(0.3996241998456468, -0.9166790599210427),
+    TW(0.9256308305098727, -0.37842775480876556), TW(0.7135848687807936, -0.7005687939432483),
+    TW(0.3954014789478163, -0.9185083943252123), TW(0.9250492407826776, -0.37984720892405116),
+    TW(0.7114321957452164, -0.7027547444572253), TW(0.391170384302254, -0.9203182767091105),
+    TW(0.9244654743252626, -0.3812657692221624), TW(0.7092728264388657, -0.7049340803759049),
+    TW(0.3869310055143887, -0.9221086687433451), TW(0.9238795325112867, -0.3826834323650898),
+    TW(0.7071067811865476, -0.7071067811865475), TW(0.38268343236508984, -0.9238795325112867),
+    TW(0.9232914167195276, -0.38410019501693504), TW(0.704934080375905, -0.7092728264388656),
+    TW(0.3784277548087656, -0.9256308305098727), TW(0.9227011283338786, -0.38551605384391885),
+    TW(0.7027547444572253, -0.7114321957452164), TW(0.374164062971458, -0.9273625256504011),
+    TW(0.9221086687433452, -0.3869310055143886), TW(0.7005687939432484, -0.7135848687807935),
+    TW(0.36989244714893427, -0.9290745812593157), TW(0.921514039342042, -0.38834504669882625),
+    TW(0.6983762494089729, -0.7157308252838186), TW(0.36561299780477396, -0.9307669610789837),
+    TW(0.9209172415291895, -0.3897581740698564), TW(0.696177131491463, -0.7178700450557317),
+    TW(0.36132580556845434, -0.9324396292684624), TW(0.9203182767091106, -0.39117038430225387),
+    TW(0.693971460889654, -0.7200025079613817), TW(0.35703096123343003, -0.9340925504042589),
+    TW(0.9197171462912274, -0.39258167407295147), TW(0.6917592583641577, -0.7221281939292153),
+    TW(0.3527285557552107, -0.9357256894810804), TW(0.9191138516900578, -0.3939920400610481),
+    TW(0.6895405447370669, -0.7242470829514669), TW(0.3484186802494345, -0.937339011912575),
+    TW(0.9185083943252123, -0.39540147894781635), TW(0.6873153408917592, -0.726359155084346),
+    TW(0.344101425989939, -0.9389324835320645), TW(0.9179007756213905, -0.3968099874167103),
+    TW(0.6850836677727004, -0.7284643904482252), TW(0.33977688440682696, -0.9405060705932683),
+    TW(0.9172909970083779, -0.39821756215337356), TW(0.6828455463852481, -0.7305627692278276),
+    TW(0.33544514708453166, -0.9420597397710173), TW(0.9166790599210427, -0.3996241998456468),
+    TW(0.6806009977954531, -0.7326542716724128), TW(0.33110630575987643, -0.9435934581619604),
+    TW(0.9160649657993317, -0.4010298971835756), TW(0.6783500431298616, -0.7347388780959634),
+    TW(0.3267604523201318, -0.9451071932852606), TW(0.9154487160882678, -0.40243465085941843),
+    TW(0.676092703575316, -0.7368165688773698), TW(0.32240767880107, -0.9466009130832835),
+    TW(0.9148303122379462, -0.4038384575676541), TW(0.6738290003787561, -0.7388873244606151),
+    TW(0.31804807738501506, -0.9480745859222762), TW(0.9142097557035307, -0.40524131400498986),
+    TW(0.6715589548470183, -0.7409511253549591), TW(0.3136817403988916, -0.9495281805930367),
+    TW(0.9135870479452508, -0.40664321687036903), TW(0.669282588346636, -0.7430079521351217),
+    TW(0.3093087603122688, -0.9509616663115751), TW(0.9129621904283982, -0.4080441628649787),
+    TW(0.6669999223036375, -0.745057785441466), TW(0.30492922973540243, -0.9523750127197659),
+    TW(0.9123351846233227, -0.4094441486922576), TW(0.6647109782033449, -0.7471006059801801),
+    TW(0.3005432414172734, -0.9537681898859903), TW(0.9117060320054299, -0.4108431710579039),
+    TW(0.6624157775901718, -0.7491363945234593), TW(0.29615088824362396, -0.9551411683057707),
+    TW(0.9110747340551764, -0.4122412266698829), TW(0.6601143420674205, -0.7511651319096864),
+    TW(0.2917522632349894, -0.956493918902395), TW(0.9104412922580672, -0.4136383122384345),
+    TW(0.6578066932970786, -0.7531867990436124), TW(0.28734745954472957, -0.9578264130275329),
+    TW(0.9098057081046522, -0.41503442447608163), TW(0.6554928529996155, -0.7552013768965365),
+    TW(0.2829365704570554, -0.9591386224618419), TW(0.9091679830905224, -0.41642956009763715),
+    TW(0.6531728429537768, -0.7572088465064845), TW(0.27851968938505306, -0.9604305194155658),
+    TW(0.9085281187163061, -0.41782371582021227), TW(0.650846684996381, -0.759209188978388),
+    TW(0.27409690986870633, -0.9617020765291225), TW(0.9078861164876663, -0.4192168883632239),
+    TW(0.6485144010221126, -0.7612023854842618), TW(0.2696683255729152, -0.9629532668736839),
+    TW(0.9072419779152958, -0.4206090744484025), TW(0.6461760129833164, -0.7631884172633813),
+    TW(0.2652340302855119, -0.9641840639517457), TW(0.9065957045149153, -0.4220002707997997),
+    TW(0.6438315428897915, -0.765167265622459), TW(0.26079411791527557, -0.9653944416976894),
+    TW(0.9059472978072685, -0.42339047414379605), TW(0.6414810128085832, -0.7671389119358204),
+    TW(0.2563486824899429, -0.9665843744783331), TW(0.9052967593181188, -0.4247796812091088),
+    TW(0.6391244448637757, -0.7691033376455796), TW(0.2518978181542169, -0.9677538370934755),
+    TW(0.9046440905782462, -0.4261678887267996), TW(0.6367618612362842, -0.7710605242618137),
+    TW(0.24744161916777344, -0.9689028047764289), TW(0.9039892931234433, -0.4275550934302821),
+    TW(0.6343932841636455, -0.773010453362737), TW(0.24298017990326398, -0.970031253194544),
+    TW(0.9033323684945118, -0.4289412920553295), TW(0.6320187359398091, -0.7749531065948738),
+    TW(0.2385135948443185, -0.9711391584497251), TW(0.9026733182372588, -0.4303264813400826),
+    TW(0.6296382389149271, -0.7768884656732324), TW(0.23404195858354346, -0.9722264970789363),
+    TW(0.9020121439024932, -0.43171065802505726), TW(0.6272518154951442, -0.7788165123814759),
+    TW(0.22956536582051887, -0.9732932460546982), TW(0.901348847046022, -0.43309381885315196),
+    TW(0.6248594881423865, -0.7807372285720944), TW(0.22508391135979278, -0.9743393827855759),
+    TW(0.900683429228647, -0.43447596056965565), TW(0.6224612793741501, -0.7826505961665757),
+    TW(0.22059769010887365, -0.9753648851166569), TW(0.9000158920161603, -0.4358570799222555),
+    TW(0.6200572117632892, -0.7845565971555752), TW(0.2161067970762196, -0.9763697313300211),
+    TW(0.8993462369793416, -0.4372371736610441), TW(0.617647307937804, -0.7864552135990858),
+    TW(0.2116113273692276, -0.9773539001452), TW(0.8986744656939538, -0.43861623853852766),
+    TW(0.6152315905806268, -0.7883464276266062), TW(0.20711137619221856, -0.9783173707196277),
+    TW(0.8980005797407399, -0.43999427130963326), TW(0.6128100824294097, -0.79023022143731),
+    TW(0.2026070388444211, -0.979260122649082), TW(0.8973245807054183, -0.44137126873171667),
+    TW(0.6103828062763095, -0.7921065773002124), TW(0.19809841071795373, -0.9801821359681173),
+    TW(0.8966464701786802, -0.44274722756457), TW(0.6079497849677737, -0.7939754775543372),
+    TW(0.19358558729580375, -0.9810833911504866), TW(0.8959662497561852, -0.4441221445704292),
+    TW(0.6055110414043255, -0.7958369046088835), TW(0.18906866414980628, -0.9819638691095552),
+    TW(0.8952839210385576, -0.44549601651398174), TW(0.6030665985403483, -0.797690840943391),
+    TW(0.18454773693861964, -0.9828235511987052), TW(0.8945994856313827, -0.44686884016237416),
+    TW(0.600616479383869, -0.799537269107905), TW(0.18002290140569951, -0.9836624192117303),
+    TW(0.8939129451452033, -0.4482406122852199), TW(0.5981607069963424, -0.8013761717231401),
+    TW(0.17549425337727137, -0.9844804553832209), TW(0.8932243011955153, -0.44961132965460654),
+    TW(0.5956993044924335, -0.8032075314806448), TW(0.17096188876030136, -0.9852776423889412),
+    TW(0.8925335554027646, -0.45098098904510386), TW(0.5932322950397998, -0.8050313311429637),
+    TW(0.16642590354046422, -0.9860539633461954), TW(0.8918407093923427, -0.4523495872337709),
+    TW(0.5907597018588743, -0.8068475535437992), TW(0.16188639378011188, -0.9868094018141854),
+    TW(0.8911457647945832, -0.45371712100016387), TW(0.5882815482226453, -0.808656181588175),
+    TW(0.15734345561623828, -0.9875439417943592), TW(0.8904487232447579, -0.45508358712634384),
+    TW(0.5857978574564389, -0.8104571982525948), TW(0.1527971852584434, -0.9882575677307495),
+    TW(0.8897495863830728, -0.4564489823968839), TW(0.5833086529376983, -0.8122505865852039),
+    TW(0.1482476789868962, -0.988950264510303), TW(0.8890483558546646, -0.4578133035988772),
+    TW(0.5808139580957645, -0.8140363297059483), TW(0.14369503315029458, -0.9896220174632008),
+    TW(0.8883450333095964, -0.4591765475219441), TW(0.5783137964116556, -0.8158144108067338),
+    TW(0.13913934416382628, -0.9902728123631691), TW(0.8876396204028539, -0.46053871095824),
+    TW(0.5758081914178453, -0.8175848131515837), TW(0.13458070850712622, -0.99090263542778),
+    TW(0.8869321187943422, -0.46189979070246273), TW(0.5732971666980423, -0.8193475200767969),
+    TW(0.13001922272223335, -0.9915114733187439), TW(0.8862225301488806, -0.46325978355186015),
+    TW(0.5707807458869674, -0.8211025149911046), TW(0.1254549834115462, -0.9920993131421918),
+    TW(0.8855108561362, -0.4646186863062378), TW(0.5682589526701315, -0.8228497813758263),
+    TW(0.12088808723577722, -0.992666142448948), TW(0.8847970984309378, -0.4659764957679662),
+    TW(0.5657318107836132, -0.8245893027850253), TW(0.11631863091190488, -0.9932119492347945),
+    TW(0.884081258712635, -0.4673332087419884), TW(0.5631993440138341, -0.8263210628456634),
+    TW(0.11174671121112666, -0.9937367219407246), TW(0.8833633386657316, -0.4686888220358279),
+    TW(0.560661576197336, -0.8280450452577558), TW(0.10717242495680887, -0.9942404494531879),
+    TW(0.8826433399795628, -0.4700433324595956), TW(0.5581185312205561, -0.829761233794523),
+    TW(0.10259586902243628, -0.9947231211043257), TW(0.881921264348355, -0.47139673682599764),
+    TW(0.5555702330196023, -0.8314696123025452), TW(0.09801714032956077, -0.9951847266721968),
+    TW(0.8811971134712221, -0.4727490319503428), TW(0.5530167055800276, -0.8331701647019132),
+    TW(0.09343633584574791, -0.9956252563809943), TW(0.8804708890521608, -0.47410021465054997),
+    TW(0.5504579729366048, -0.83486287498638), TW(0.08885355258252468, -0.996044700901252),
+    TW(0.8797425928000474, -0.47545028174715587), TW(0.5478940591731002, -0.8365477272235119),
+    TW(0.08426888759332413, -0.9964430513500426), TW(0.8790122264286335, -0.4767992300633221),
+    TW(0.5453249884220465, -0.838224705554838), TW(0.07968243797143013, -0.9968202992911657),
+    TW(0.8782797916565416, -0.478147056424843), TW(0.542750784864516, -0.8398937941959994),
+    TW(0.07509430084792129, -0.9971764367353262), TW(0.8775452902072614, -0.479493757660153),
+    TW(0.540171472729893, -0.8415549774368983), TW(0.07050457338961401, -0.9975114561403035),
+    TW(0.8768087238091457, -0.48083933060033396), TW(0.5375870762956455, -0.8432082396418454),
+    TW(0.06591335279700393, -0.9978253504111116), TW(0.8760700941954066, -0.4821837720791227),
+    TW(0.5349976198870973, -0.844853565249707), TW(0.06132073630220865, -0.9981181129001492),
+    TW(0.8753294031041109, -0.48352707893291874), TW(0.532403127877198, -0.846490938774052),
+    TW(0.05672682116690778, -0.9983897374073402), TW(0.8745866522781761, -0.48486924800079106),
+    TW(0.5298036246862948, -0.8481203448032971), TW(0.05213170468028332, -0.9986402181802653),
+    TW(0.8738418434653669, -0.4862102761244864), TW(0.5271991347819014, -0.8497417680008524),
+    TW(0.04753548415695926, -0.9988695499142836), TW(0.8730949784182901, -0.487550160148436),
+    TW(0.5245896826784688, -0.8513551931052652), TW(0.04293825693494096, -0.9990777277526454),
+    TW(0.8723460588943915, -0.48888889691976317), TW(0.5219752929371544, -0.8529606049303636),
+    TW(0.03834012037355279, -0.9992647472865944), TW(0.871595086655951, -0.49022648328829116),
+    TW(0.5193559901655895, -0.8545579883654005), TW(0.03374117185137764, -0.9994306045554617),
+    TW(0.870842063470079, -0.4915629161065499), TW(0.51673179901765, -0.8561473283751945),
+    TW(0.02914150876419374, -0.9995752960467492), TW(0.8700869911087115, -0.49289819222978404),
+    TW(0.5141027441932217, -0.8577286100002721), TW(0.024541228522912264, -0.9996988186962042),
+    TW(0.8693298713486068, -0.4942323085159597), TW(0.5114688504379705, -0.8593018183570084),
+    TW(0.019940428551514598, -0.9998011698878843), TW(0.8685707059713409, -0.49556526182577254),
+    TW(0.508830142543107, -0.8608669386377673), TW(0.01533920628498822, -0.9998823474542126),
+    TW(0.8678094967633033, -0.49689704902265447), TW(0.5061866453451555, -0.8624239561110405),
+    TW(0.010737659167264572, -0.9999423496760239), TW(0.8670462455156926, -0.49822766697278187),
+    TW(0.5035383837257176, -0.8639728561215867), TW(0.006135884649154515, -0.9999811752826011),
+    TW(0.866280954024513, -0.49955711254508184), TW(0.5008853826112409, -0.865513624090569),
+    TW(0.0015339801862847662, -0.9999988234517019), TW(0.8655136240905691, -0.5008853826112407),
+    TW(0.49822766697278187, -0.8670462455156926), TW(-0.0030679567629660156, -0.9999952938095762),
+    TW(0.8647442575194624, -0.5022124740457108), TW(0.4955652618257725, -0.8685707059713409),
+    TW(-0.007669828739530955, -0.9999705864309741), TW(0.8639728561215868, -0.5035383837257176),
+    TW(0.4928981922297841, -0.8700869911087113), TW(-0.012271538285719823, -0.9999247018391445),
+    TW(0.8631994217121242, -0.5048631085312676), TW(0.4902264832882911, -0.8715950866559511),
+    TW(-0.01687298794728165, -0.9998576410058239), TW(0.8624239561110406, -0.5061866453451552),
+    TW(0.48755016014843605, -0.8730949784182901), TW(-0.021474080275469484, -0.9997694053512153),
+    TW(0.8616464611430813, -0.5075089910529709), TW(0.4848692480007911, -0.8745866522781761),
+    TW(-0.026074717829103915, -0.9996599967439592), TW(0.8608669386377673, -0.508830142543107),
+    TW(0.48218377207912283, -0.8760700941954066), TW(-0.03067480317663646, -0.9995294175010931),
+    TW(0.8600853904293901, -0.5101500967067668), TW(0.479493757660153, -0.8775452902072612),
+    TW(-0.03527423889821382, -0.9993776703880028), TW(0.8593018183570085, -0.5114688504379703),
+    TW(0.47679923006332225, -0.8790122264286334), TW(-0.03987292758773973, -0.9992047586183639),
+    TW(0.8585162242644427, -0.512786400633563), TW(0.47410021465055, -0.8804708890521608),
+    TW(-0.04447077185493862, -0.9990106858540734), TW(0.8577286100002721, -0.5141027441932217),
+    TW(0.4713967368259978, -0.8819212643483549), TW(-0.04906767432741801, -0.9987954562051724),
+    TW(0.8569389774178288, -0.5154178780194629), TW(0.46868882203582796, -0.8833633386657316),
+    TW(-0.053663537652730554, -0.9985590742297593), TW(0.8561473283751945, -0.5167317990176499),
+    TW(0.4659764957679661, -0.8847970984309378), TW(-0.05825826450043561, -0.9983015449338929),
+    TW(0.855353664735196, -0.5180445040959993), TW(0.46325978355186026, -0.8862225301488806),
+    TW(-0.06285175756416131, -0.9980228737714862), TW(0.8545579883654005, -0.5193559901655896),
+    TW(0.46053871095824, -0.8876396204028539), TW(-0.06744391956366398, -0.9977230666441916),
+    TW(0.8537603011381114, -0.5206662541403672), TW(0.4578133035988773, -0.8890483558546646),
+    TW(-0.07203465324688929, -0.9974021299012753), TW(0.8529606049303636, -0.5219752929371544),
+    TW(0.45508358712634384, -0.8904487232447579), TW(-0.0766238613920315, -0.997060070339483),
+    TW(0.8521589016239198, -0.5232831034756564), TW(0.452349587233771, -0.8918407093923427),
+    TW(-0.08121144680959226, -0.9966968952028961), TW(0.8513551931052652, -0.524589682678469),
+    TW(0.4496113296546066, -0.8932243011955153), TW(-0.08579731234443976, -0.996312612182778),
+    TW(0.8505494812656035, -0.5258950274710846), TW(0.4468688401623743, -0.8945994856313826),
+    TW(-0.09038136087786489, -0.9959072294174117), TW(0.8497417680008525, -0.5271991347819013),
+    TW(0.44412214457042926, -0.8959662497561851), TW(-0.09496349532963895, -0.9954807554919269),
+    TW(0.8489320552116396, -0.5285020015422285), TW(0.4413712687317166, -0.8973245807054183),
+    TW(-0.09954361866006932, -0.9950331994381186), TW(0.8481203448032972, -0.5298036246862946),
+    TW(0.4386162385385277, -0.8986744656939538), TW(-0.1041216338720546, -0.9945645707342554),
+    TW(0.8473066386858583, -0.531104001151255), TW(0.4358570799222555, -0.9000158920161603),
+    TW(-0.10869744401313856, -0.9940748793048795), TW(0.8464909387740521, -0.5324031278771979),
+    TW(0.433093818853152, -0.901348847046022), TW(-0.11327095217756424, -0.9935641355205953),
+    TW(0.8456732469872991, -0.533701001807153), TW(0.4303264813400826, -0.9026733182372588),
+    TW(-0.1178420615083249, -0.9930323501978514), TW(0.8448535652497071, -0.5349976198870972),
+    TW(0.4275550934302822, -0.9039892931234433), TW(-0.12241067519921615, -0.99247953459871),
+    TW(0.8440318954900664, -0.5362929790659632), TW(0.4247796812091088, -0.9052967593181188),
+    TW(-0.12697669649688587, -0.9919057004306093), TW(0.8432082396418454, -0.5375870762956454),
+    TW(0.4220002707997998, -0.9065957045149153), TW(-0.13154002870288314, -0.9913108598461154),
+    TW(0.8423825996431858, -0.5388799085310084), TW(0.41921688836322396, -0.9078861164876662),
+    TW(-0.13610057517570606, -0.9906950254426646), TW(0.8415549774368984, -0.5401714727298929),
+    TW(0.4164295600976373, -0.9091679830905223), TW(-0.14065823933284913, -0.9900582102622971),
+    TW(0.8407253749704581, -0.5414617658531234), TW(0.41363831223843456, -0.9104412922580671),
+    TW(-0.1452129246528474, -0.9894004277913804), TW(0.8398937941959995, -0.5427507848645159),
+    TW(0.4108431710579039, -0.9117060320054299), TW(-0.1497645346773215, -0.9887216919603238),
+    TW(0.8390602370703127, -0.5440385267308838), TW(0.40804416286497874, -0.9129621904283981),
+    TW(-0.15431297301302013, -0.9880220171432835), TW(0.8382247055548381, -0.5453249884220465),
+    TW(0.40524131400498986, -0.9142097557035307), TW(-0.15885814333386128, -0.9873014181578584),
+    TW(0.8373872016156619, -0.5466101669108349), TW(0.40243465085941854, -0.9154487160882678),
+    TW(-0.16339994938297311, -0.9865599102647755), TW(0.836547727223512, -0.5478940591731002),
+    TW(0.3996241998456468, -0.9166790599210427), TW(-0.1679382949747311, -0.9857975091675675),
+    TW(0.8357062843537526, -0.5491766621877197), TW(0.3968099874167104, -0.9179007756213904),
+    TW(-0.17247308399679592, -0.9850142310122398), TW(0.83486287498638, -0.5504579729366048),
+    TW(0.3939920400610481, -0.9191138516900578), TW(-0.17700422041214875, -0.984210092386929),
+    TW(0.8340175011060181, -0.5517379884047073), TW(0.391170384302254, -0.9203182767091105),
+    TW(-0.18153160826112502, -0.9833851103215512), TW(0.8331701647019132, -0.5530167055800275),
+    TW(0.3883450466988263, -0.9215140393420419), TW(-0.1860551516634465, -0.9825393022874412),
+    TW(0.8323208677679297, -0.55429412145362), TW(0.385516053843919, -0.9227011283338785),
+    TW(-0.19057475482025266, -0.9816726861969831), TW(0.8314696123025452, -0.5555702330196022),
+    TW(0.38268343236508984, -0.9238795325112867), TW(-0.1950903220161282, -0.9807852804032304),
+    TW(0.8306164003088463, -0.5568450372751601), TW(0.3798472089240511, -0.9250492407826776),
+    TW(-0.19960175762113094, -0.9798771036995176), TW(0.829761233794523, -0.5581185312205561),
+    TW(0.3770074102164183, -0.9262102421383113), TW(-0.2041089660928169, -0.9789481753190622),
+    TW(0.8289041147718649, -0.5593907118591361), TW(0.374164062971458, -0.9273625256504011),
+    TW(-0.20861185197826332, -0.9779985149345571), TW(0.8280450452577558, -0.560661576197336),
+    TW(0.3713171939518376, -0.9285060804732155), TW(-0.21311031991609125, -0.9770281426577544),
+    TW(0.8271840272736691, -0.5619311212446895), TW(0.3684668299533723, -0.9296408958431813),
+    TW(-0.21760427463848356, -0.9760370790390391), TW(0.8263210628456635, -0.5631993440138341),
+    TW(0.36561299780477396, -0.9307669610789837), TW(-0.22209362097320348, -0.9750253450669941),
+    TW(0.8254561540043776, -0.5644662415205195), TW(0.3627557243673972, -0.9318842655816681),
+    TW(-0.22657826384561, -0.9739929621679558), TW(0.8245893027850253, -0.5657318107836131),
+    TW(0.3598950365349883, -0.9329927988347388), TW(-0.23105810828067114, -0.9729399522055602),
+    TW(0.8237205112273914, -0.5669960488251087), TW(0.35703096123343003, -0.9340925504042589),
+    TW(-0.23553305940497535, -0.9718663374802794), TW(0.8228497813758264, -0.5682589526701315),
+    TW(0.3541635254204905, -0.9351835099389475), TW(-0.2400030224487414, -0.9707721407289504),
+    TW(0.8219771152792416, -0.5695205193469471), TW(0.35129275608556715, -0.9362656671702783),
+    TW(-0.2444679027478241, -0.9696573851242924), TW(0.8211025149911046, -0.5707807458869673),
+    TW(0.3484186802494345, -0.937339011912575), TW(-0.24892760574572012, -0.9685220942744174),
+    TW(0.8202259825694347, -0.572039629324757), TW(0.34554132496398915, -0.9384035340631081),
+    TW(-0.25338203699557016, -0.9673662922223285), TW(0.8193475200767969, -0.5732971666980422),
+    TW(0.3426607173119944, -0.9394592236021899), TW(-0.2578311021621588, -0.9661900034454126),
+    TW(0.8184671295802987, -0.5745533550477158), TW(0.33977688440682696, -0.9405060705932683),
+    TW(-0.2622747070239135, -0.9649932528549204), TW(0.8175848131515837, -0.5758081914178453),
+    TW(0.33688985339222005, -0.9415440651830208), TW(-0.2667127574748983, -0.9637760657954398),
+    TW(0.8167005728668278, -0.5770616728556794), TW(0.3339996514420095, -0.9425731976014469),
+    TW(-0.27114515952680796, -0.9625384680443592), TW(0.8158144108067338, -0.5783137964116556),
+    TW(0.33110630575987643, -0.9435934581619604), TW(-0.27557181931095814, -0.9612804858113206),
+    TW(0.8149263290565266, -0.5795645591394056), TW(0.32820984357909266, -0.9446048372614803),
+    TW(-0.2799926430802733, -0.9600021457376658), TW(0.8140363297059484, -0.5808139580957645),
+    TW(0.325310292162263, -0.9456073253805213), TW(-0.2844075372112717, -0.9587034748958716),
+    TW(0.8131444148492536, -0.5820619903407754), TW(0.32240767880107, -0.9466009130832835),
+    TW(-0.28881640820604937, -0.957384500788976), TW(0.8122505865852039, -0.5833086529376983),
+    TW(0.31950203081601575, -0.9475855910177411), TW(-0.2932191626942586, -0.9560452513499965),
+    TW(0.8113548470170637, -0.5845539429530153), TW(0.31659337555616585, -0.9485613499157303),
+    TW(-0.2976157074350862, -0.9546857549413383), TW(0.8104571982525948, -0.5857978574564389),
+    TW(0.3136817403988916, -0.9495281805930367), TW(-0.3020059493192281, -0.9533060403541939),
+    TW(0.8095576424040513, -0.587040393520918), TW(0.3107671527496115, -0.9504860739494817),
+    TW(-0.306389795370861, -0.9519061368079323), TW(0.808656181588175, -0.5882815482226452),
+    TW(0.307849640041535, -0.9514350209690083), TW(-0.31076715274961136, -0.9504860739494818),
+    TW(0.8077528179261904, -0.5895213186410639), TW(0.30492922973540243, -0.9523750127197659),
+    TW(-0.31513792875252233, -0.9490458818527007), TW(0.8068475535437993, -0.5907597018588742),
+    TW(0.3020059493192282, -0.9533060403541938), TW(-0.31950203081601564, -0.9475855910177412),
+    TW(0.8059403905711763, -0.591996694962041), TW(0.2990798263080405, -0.9542280951091057),
+    TW(-0.32385936651785285, -0.9461052323704034), TW(0.8050313311429637, -0.5932322950397998),
+    TW(0.29615088824362396, -0.9551411683057707), TW(-0.32820984357909255, -0.9446048372614803),
+    TW(0.8041203773982658, -0.5944664991846644), TW(0.2932191626942587, -0.9560452513499964),
+    TW(-0.33255336986604406, -0.9430844374660935), TW(0.8032075314806449, -0.5956993044924334),
+    TW(0.29028467725446233, -0.9569403357322089), TW(-0.33688985339221994, -0.9415440651830208),
+    TW(0.8022927955381157, -0.5969307080621965), TW(0.28734745954472957, -0.9578264130275329),
+    TW(-0.3412192023202823, -0.939983753034014), TW(0.8013761717231402, -0.5981607069963423),
+    TW(0.2844075372112718, -0.9587034748958716), TW(-0.34554132496398904, -0.9384035340631082),
+    TW(0.8004576621926228, -0.5993892984005645), TW(0.28146493792575805, -0.9595715130819845),
+    TW(-0.3498561297901349, -0.9368034417359216), TW(0.799537269107905, -0.600616479383869),
+    TW(0.27851968938505306, -0.9604305194155658), TW(-0.3541635254204904, -0.9351835099389476),
+    TW(0.7986149946347608, -0.60184224705858), TW(0.27557181931095825, -0.9612804858113206),
+    TW(-0.35846342063373643, -0.9335437729788363), TW(0.7976908409433912, -0.6030665985403482),
+    TW(0.272621355449949, -0.9621214042690416), TW(-0.3627557243673971, -0.9318842655816681),
+    TW(0.7967648102084188, -0.604289530948156), TW(0.2696683255729152, -0.9629532668736839),
+    TW(-0.3670403457197671, -0.9302050228922191), TW(0.7958369046088836, -0.6055110414043255),
+    TW(0.2667127574748984, -0.9637760657954398), TW(-0.3713171939518375, -0.9285060804732156),
+    TW(0.794907126328237, -0.6067311270345245), TW(0.2637546789748315, -0.9645897932898126),
+    TW(-0.3755861784892172, -0.9267874743045817), TW(0.7939754775543372, -0.6079497849677736),
+    TW(0.26079411791527557, -0.9653944416976894), TW(-0.379847208924051, -0.9250492407826777),
+    TW(0.7930419604794436, -0.6091670123364532), TW(0.25783110216215893, -0.9661900034454126),
+    TW(-0.38410019501693493, -0.9232914167195277), TW(0.7921065773002124, -0.6103828062763095),
+    TW(0.2548656596045146, -0.9669764710448521), TW(-0.3883450466988262, -0.921514039342042),
+    TW(0.7911693302176902, -0.6115971639264619), TW(0.2518978181542169, -0.9677538370934755),
+    TW(-0.3925816740729514, -0.9197171462912274), TW(0.79023022143731, -0.6128100824294097),
+    TW(0.24892760574572026, -0.9685220942744173), TW(-0.3968099874167103, -0.9179007756213905),
+    TW(0.7892892531688857, -0.6140215589310384), TW(0.2459550503357946, -0.9692812353565485),
+    TW(-0.4010298971835757, -0.9160649657993317), TW(0.7883464276266063, -0.6152315905806268),
+    TW(0.24298017990326398, -0.970031253194544), TW(-0.40524131400498975, -0.9142097557035307),
+    TW(0.7874017470290314, -0.6164401745308536), TW(0.2400030224487415, -0.9707721407289504),
+    TW(-0.4094441486922575, -0.9123351846233229), TW(0.7864552135990858, -0.6176473079378039),
+    TW(0.23702360599436734, -0.9715038909862518), TW(-0.41363831223843445, -0.9104412922580672),
+    TW(0.7855068295640539, -0.6188529879609763), TW(0.23404195858354346, -0.9722264970789363),
+    TW(-0.41782371582021227, -0.9085281187163061), TW(0.7845565971555752, -0.6200572117632891),
+    TW(0.23105810828067128, -0.9729399522055601), TW(-0.4220002707997997, -0.9065957045149153),
+    TW(0.7836045186096382, -0.6212599765110876), TW(0.2280720831708858, -0.9736442496508119),
+    TW(-0.42616788872679967, -0.9046440905782461), TW(0.7826505961665757, -0.62246127937415),
+    TW(0.22508391135979278, -0.9743393827855759), TW(-0.4303264813400827, -0.9026733182372588),
+    TW(0.7816948320710594, -0.6236611175256945), TW(0.2220936209732036, -0.9750253450669941),
+    TW(-0.4344759605696558, -0.9006834292286469), TW(0.7807372285720945, -0.6248594881423863),
+    TW(0.21910124015686977, -0.9757021300385286), TW(-0.4386162385385274, -0.8986744656939539),
+    TW(0.7797777879230146, -0.6260563884043435), TW(0.2161067970762196, -0.9763697313300211),
+    TW(-0.4427472275645698, -0.8966464701786803), TW(0.778816512381476, -0.6272518154951441),
+    TW(0.21311031991609136, -0.9770281426577544), TW(-0.446868840162374, -0.8945994856313828),
+    TW(0.7778534042094531, -0.6284457666018327), TW(0.21011183688046972, -0.9776773578245099),
+    TW(-0.4509809890451037, -0.8925335554027647), TW(0.7768884656732324, -0.629638238914927),
+    TW(0.20711137619221856, -0.9783173707196277), TW(-0.4550835871263437, -0.890448723244758),
+    TW(0.7759216990434077, -0.6308292296284245), TW(0.204108966092817, -0.9789481753190622),
+    TW(-0.45917654752194403, -0.8883450333095964), TW(0.7749531065948739, -0.6320187359398091),
+    TW(0.20110463484209196, -0.9795697656854405), TW(-0.46325978355186015, -0.8862225301488806),
+    TW(0.7739826906068229, -0.6332067550500572), TW(0.19809841071795373, -0.9801821359681173),
+    TW(-0.4673332087419884, -0.884081258712635), TW(0.773010453362737, -0.6343932841636455),
+    TW(0.19509032201612833, -0.9807852804032304), TW(-0.4713967368259977, -0.881921264348355),
+    TW(0.7720363971503845, -0.6355783204885561), TW(0.19208039704989238, -0.9813791933137546),
+    TW(-0.475450281747156, -0.8797425928000474), TW(0.7710605242618138, -0.6367618612362842),
+    TW(0.18906866414980628, -0.9819638691095552), TW(-0.4794937576601531, -0.8775452902072612),
+    TW(0.7700828369933479, -0.637943903621844), TW(0.18605515166344663, -0.9825393022874412),
+    TW(-0.48352707893291846, -0.875329403104111), TW(0.7691033376455797, -0.6391244448637757),
+    TW(0.18303988795514106, -0.9831054874312163), TW(-0.4875501601484357, -0.8730949784182902),
+    TW(0.7681220285233654, -0.6403034821841517), TW(0.18002290140569951, -0.9836624192117303),
+    TW(-0.4915629161065498, -0.870842063470079), TW(0.7671389119358204, -0.6414810128085832),
+    TW(0.17700422041214886, -0.984210092386929), TW(-0.4955652618257724, -0.868570705971341),
+    TW(0.7661539901963129, -0.6426570339662269), TW(0.17398387338746385, -0.9847485018019042),
+    TW(-0.4995571125450818, -0.8662809540245131), TW(0.765167265622459, -0.6438315428897914),
+    TW(0.17096188876030136, -0.9852776423889412), TW(-0.5035383837257175, -0.8639728561215868),
+    TW(0.7641787405361167, -0.6450045368155439), TW(0.16793829497473123, -0.9857975091675674),
+    TW(-0.5075089910529708, -0.8616464611430813), TW(0.7631884172633813, -0.6461760129833163),
+    TW(0.1649131204899701, -0.9863080972445987), TW(-0.5114688504379704, -0.8593018183570084),
+    TW(0.7621962981345789, -0.6473459686365121), TW(0.16188639378011188, -0.9868094018141854),
+    TW(-0.515417878019463, -0.8569389774178288), TW(0.7612023854842618, -0.6485144010221124),
+    TW(0.1588581433338614, -0.9873014181578584), TW(-0.5193559901655896, -0.8545579883654005),
+    TW(0.7602066816512024, -0.6496813073906832), TW(0.15582839765426532, -0.9877841416445722),
+    TW(-0.5232831034756565, -0.8521589016239197), TW(0.7592091889783881, -0.6508466849963809),
+    TW(0.1527971852584434, -0.9882575677307495), TW(-0.5271991347819011, -0.8497417680008527),
+    TW(0.7582099098130153, -0.6520105310969595), TW(0.14976453467732162, -0.9887216919603238),
+    TW(-0.5311040011512548, -0.8473066386858585), TW(0.7572088465064846, -0.6531728429537768),
+    TW(0.14673047445536175, -0.989176509964781), TW(-0.534997619887097, -0.8448535652497072),
+    TW(0.7562060014143945, -0.6543336178318004), TW(0.14369503315029458, -0.9896220174632008),
+    TW(-0.5388799085310083, -0.842382599643186), TW(0.7552013768965365, -0.6554928529996153),
+    TW(0.14065823933284924, -0.9900582102622971), TW(-0.5427507848645158, -0.8398937941959996),
+    TW(0.7541949753168892, -0.6566505457294289), TW(0.13762012158648618, -0.990485084256457),
+    TW(-0.5466101669108349, -0.8373872016156619), TW(0.7531867990436125, -0.6578066932970786),
+    TW(0.13458070850712622, -0.99090263542778), TW(-0.5504579729366047, -0.8348628749863801),
+    TW(0.7521768504490428, -0.6589612929820373), TW(0.13154002870288328, -0.9913108598461154),
+    TW(-0.5542941214536201, -0.8323208677679297), TW(0.7511651319096865, -0.6601143420674205),
+    TW(0.12849811079379322, -0.9917097536690995), TW(-0.5581185312205561, -0.829761233794523),
+    TW(0.7501516458062151, -0.6612658378399923), TW(0.1254549834115462, -0.9920993131421918),
+    TW(-0.5619311212446895, -0.8271840272736691), TW(0.7491363945234594, -0.6624157775901718),
+    TW(0.12241067519921628, -0.99247953459871), TW(-0.5657318107836132, -0.8245893027850252),
+    TW(0.7481193804504036, -0.6635641586120398), TW(0.11936521481099135, -0.9928504144598651),
+    TW(-0.5695205193469473, -0.8219771152792414), TW(0.7471006059801801, -0.6647109782033448),
+    TW(0.11631863091190488, -0.9932119492347945), TW(-0.573297166698042, -0.8193475200767971),
+    TW(0.7460800735100638, -0.6658562336655097), TW(0.11327095217756436, -0.9935641355205953),
+    TW(-0.5770616728556793, -0.816700572866828), TW(0.7450577854414661, -0.6669999223036375),
+    TW(0.11022220729388318, -0.9939069700023561), TW(-0.5808139580957644, -0.8140363297059485),
+    TW(0.7440337441799293, -0.6681420414265185), TW(0.10717242495680887, -0.9942404494531879),
+    TW(-0.5845539429530152, -0.8113548470170638), TW(0.7430079521351217, -0.669282588346636),
+    TW(0.10412163387205473, -0.9945645707342554), TW(-0.5882815482226452, -0.8086561815881751),
+    TW(0.7419804117208311, -0.6704215603801731), TW(0.10106986275482788, -0.9948793307948056),
+    TW(-0.5919966949620409, -0.8059403905711764), TW(0.7409511253549591, -0.6715589548470183),
+    TW(0.09801714032956077, -0.9951847266721968), TW(-0.5956993044924334, -0.8032075314806449),
+    TW(0.7399200954595162, -0.6726947690707729), TW(0.09496349532963906, -0.9954807554919269),
+    TW(-0.5993892984005645, -0.8004576621926228), TW(0.7388873244606151, -0.673829000378756),
+    TW(0.0919089564971327, -0.9957674144676598), TW(-0.6030665985403483, -0.797690840943391),
+    TW(0.737852814788466, -0.6749616461020119), TW(0.08885355258252468, -0.996044700901252),
+    TW(-0.6067311270345246, -0.7949071263282369), TW(0.7368165688773699, -0.6760927035753159),
+    TW(0.08579731234443988, -0.996312612182778), TW(-0.6103828062763096, -0.7921065773002123),
+    TW(0.7357785891657136, -0.6772221701371803), TW(0.0827402645493758, -0.9965711457905548),
+    TW(-0.6140215589310382, -0.7892892531688859), TW(0.7347388780959635, -0.6783500431298615),
+    TW(0.07968243797143013, -0.9968202992911657), TW(-0.6176473079378038, -0.7864552135990859),
+    TW(0.7336974381146604, -0.679476319899365), TW(0.07662386139203162, -0.997060070339483),
+    TW(-0.6212599765110874, -0.7836045186096383), TW(0.7326542716724128, -0.680600997795453),
+    TW(0.07356456359966745, -0.9972904566786902), TW(-0.6248594881423862, -0.7807372285720946),
+    TW(0.7316093812238926, -0.6817240741716497), TW(0.07050457338961401, -0.9975114561403035),
+    TW(-0.6284457666018326, -0.7778534042094531), TW(0.7305627692278276, -0.6828455463852481),
+    TW(0.0674439195636641, -0.9977230666441916), TW(-0.632018735939809, -0.7749531065948739),
+    TW(0.729514438146997, -0.6839654117973154), TW(0.06438263092985741, -0.997925286198596),
+    TW(-0.6355783204885561, -0.7720363971503845), TW(0.7284643904482252, -0.6850836677727004),
+    TW(0.06132073630220865, -0.9981181129001492), TW(-0.6391244448637757, -0.7691033376455796),
+    TW(0.7274126286023758, -0.6862003116800386), TW(0.05825826450043573, -0.9983015449338929),
+    TW(-0.6426570339662269, -0.7661539901963129), TW(0.726359155084346, -0.687315340891759),
+    TW(0.05519524434969003, -0.9984755805732948), TW(-0.6461760129833164, -0.7631884172633813),
+    TW(0.7253039723730608, -0.6884287527840904), TW(0.05213170468028332, -0.9986402181802653),
+    TW(-0.6496813073906833, -0.7602066816512023), TW(0.724247082951467, -0.6895405447370668),
+    TW(0.049067674327418126, -0.9987954562051724), TW(-0.6531728429537765, -0.7572088465064847),
+    TW(0.7231884893065275, -0.6906507141345346), TW(0.046003182130914644, -0.9989412931868569),
+    TW(-0.6566505457294288, -0.7541949753168893), TW(0.7221281939292153, -0.6917592583641577),
+    TW(0.04293825693494096, -0.9990777277526454), TW(-0.6601143420674204, -0.7511651319096866),
+    TW(0.7210661993145081, -0.6928661748174246), TW(0.039872927587739845, -0.9992047586183639),
+    TW(-0.6635641586120397, -0.7481193804504037), TW(0.7200025079613817, -0.693971460889654),
+    TW(0.03680722294135899, -0.9993223845883495), TW(-0.6669999223036374, -0.7450577854414661),
+    TW(0.7189371223728045, -0.6950751139800009), TW(0.03374117185137764, -0.9994306045554617),
+    TW(-0.6704215603801731, -0.7419804117208311), TW(0.7178700450557317, -0.696177131491463),
+    TW(0.03067480317663658, -0.9995294175010931), TW(-0.673829000378756, -0.7388873244606152),
+    TW(0.7168012785210995, -0.6972775108308865), TW(0.02760814577896582, -0.9996188224951786),
+    TW(-0.6772221701371804, -0.7357785891657135), TW(0.7157308252838186, -0.6983762494089729),
+    TW(0.024541228522912264, -0.9996988186962042), TW(-0.680600997795453, -0.7326542716724128),
+    TW(0.7146586878627691, -0.6994733446402838), TW(0.021474080275469605, -0.9997694053512153),
+    TW(-0.6839654117973155, -0.729514438146997), TW(0.7135848687807936, -0.7005687939432483),
+    TW(0.01840672990580482, -0.9998305817958234), TW(-0.6873153408917592, -0.7263591550843459),
+    TW(0.7125093705646923, -0.7016625947401685), TW(0.01533920628498822, -0.9998823474542126),
+    TW(-0.6906507141345344, -0.7231884893065276), TW(0.7114321957452164, -0.7027547444572253),
+    TW(0.012271538285719944, -0.9999247018391445), TW(-0.6939714608896538, -0.7200025079613818),
+    TW(0.7103533468570624, -0.7038452405244849), TW(0.00920375478205996, -0.9999576445519639),
+    TW(-0.6972775108308864, -0.7168012785210996), TW(0.7092728264388657, -0.7049340803759049),
+    TW(0.006135884649154515, -0.9999811752826011), TW(-0.7005687939432482, -0.7135848687807937),
+    TW(0.7081906370331954, -0.7060212614493397), TW(0.003067956762966138, -0.9999952938095762),
+    TW(-0.7038452405244848, -0.7103533468570624), TW(0.7071067811865476, -0.7071067811865475),
+    TW(6.123233995736766e-17, -1.0), TW(-0.7071067811865475, -0.7071067811865476),
+    TW(0.7060212614493397, -0.7081906370331953), TW(-0.0030679567629660156, -0.9999952938095762),
+    TW(-0.7103533468570623, -0.703845240524485), TW(0.704934080375905, -0.7092728264388656),
+    TW(-0.006135884649154393, -0.9999811752826011), TW(-0.7135848687807936, -0.7005687939432483),
+    TW(0.7038452405244849, -0.7103533468570623), TW(-0.009203754782059837, -0.9999576445519639),
+    TW(-0.7168012785210995, -0.6972775108308865), TW(0.7027547444572253, -0.7114321957452164),
+    TW(-0.012271538285719823, -0.9999247018391445), TW(-0.7200025079613817, -0.693971460889654),
+    TW(0.7016625947401686, -0.7125093705646923), TW(-0.015339206284988098, -0.9998823474542126),
+    TW(-0.7231884893065275, -0.6906507141345346), TW(0.7005687939432484, -0.7135848687807935),
+    TW(-0.018406729905804695, -0.9998305817958234), TW(-0.7263591550843458, -0.6873153408917593),
+    TW(0.6994733446402838, -0.714658687862769), TW(-0.021474080275469484, -0.9997694053512153),
+    TW(-0.7295144381469968, -0.6839654117973156), TW(0.6983762494089729, -0.7157308252838186),
+    TW(-0.024541228522912142, -0.9996988186962042), TW(-0.7326542716724127, -0.6806009977954532),
+    TW(0.6972775108308866, -0.7168012785210995), TW(-0.027608145778965698, -0.9996188224951786),
+    TW(-0.7357785891657134, -0.6772221701371806), TW(0.696177131491463, -0.7178700450557317),
+    TW(-0.03067480317663646, -0.9995294175010931), TW(-0.738887324460615, -0.6738290003787561),
+    TW(0.6950751139800009, -0.7189371223728044), TW(-0.03374117185137752, -0.9994306045554617),
+    TW(-0.741980411720831, -0.6704215603801732), TW(0.693971460889654, -0.7200025079613817),
+    TW(-0.036807222941358866, -0.9993223845883495), TW(-0.745057785441466, -0.6669999223036376),
+    TW(0.6928661748174247, -0.7210661993145081), TW(-0.03987292758773973, -0.9992047586183639),
+    TW(-0.7481193804504036, -0.6635641586120398), TW(0.6917592583641577, -0.7221281939292153),
+    TW(-0.042938256934940834, -0.9990777277526454), TW(-0.7511651319096865, -0.6601143420674205),
+    TW(0.6906507141345347, -0.7231884893065273), TW(-0.04600318213091452, -0.9989412931868569),
+    TW(-0.7541949753168892, -0.656650545729429), TW(0.6895405447370669, -0.7242470829514669),
+    TW(-0.04906767432741801, -0.9987954562051724), TW(-0.7572088465064846, -0.6531728429537766),
+    TW(0.6884287527840905, -0.7253039723730607), TW(-0.05213170468028319, -0.9986402181802653),
+    TW(-0.7602066816512022, -0.6496813073906834), TW(0.6873153408917592, -0.726359155084346),
+    TW(-0.05519524434968991, -0.9984755805732948), TW(-0.763188417263381, -0.6461760129833166),
+    TW(0.6862003116800387, -0.7274126286023758), TW(-0.05825826450043561, -0.9983015449338929),
+    TW(-0.7661539901963127, -0.6426570339662271), TW(0.6850836677727004, -0.7284643904482252),
+    TW(-0.06132073630220853, -0.9981181129001492), TW(-0.7691033376455795, -0.6391244448637758),
+    TW(0.6839654117973155, -0.7295144381469969), TW(-0.06438263092985728, -0.997925286198596),
+    TW(-0.7720363971503844, -0.6355783204885562), TW(0.6828455463852481, -0.7305627692278276),
+    TW(-0.06744391956366398, -0.9977230666441916), TW(-0.7749531065948738, -0.6320187359398091),
+    TW(0.6817240741716498, -0.7316093812238925), TW(-0.0705045733896139, -0.9975114561403035),
+    TW(-0.777853404209453, -0.6284457666018327), TW(0.6806009977954531, -0.7326542716724128),
+    TW(-0.07356456359966733, -0.9972904566786902), TW(-0.7807372285720945, -0.6248594881423863),
+    TW(0.6794763198993651, -0.7336974381146603), TW(-0.0766238613920315, -0.997060070339483),
+    TW(-0.7836045186096382, -0.6212599765110876), TW(0.6783500431298616, -0.7347388780959634),
+    TW(-0.07968243797143001, -0.9968202992911658), TW(-0.7864552135990858, -0.6176473079378039),
+    TW(0.6772221701371804, -0.7357785891657135), TW(-0.08274026454937568, -0.9965711457905548),
+    TW(-0.7892892531688858, -0.6140215589310384), TW(0.676092703575316, -0.7368165688773698),
+    TW(-0.08579731234443976, -0.996312612182778), TW(-0.7921065773002122, -0.6103828062763097),
+    TW(0.674961646102012, -0.737852814788466), TW(-0.08885355258252456, -0.996044700901252),
+    TW(-0.7949071263282368, -0.6067311270345247), TW(0.6738290003787561, -0.7388873244606151),
+    TW(-0.09190895649713257, -0.9957674144676598), TW(-0.7976908409433909, -0.6030665985403484),
+    TW(0.672694769070773, -0.7399200954595161), TW(-0.09496349532963895, -0.9954807554919269),
+    TW(-0.8004576621926227, -0.5993892984005647), TW(0.6715589548470183, -0.7409511253549591),
+    TW(-0.09801714032956065, -0.9951847266721969), TW(-0.8032075314806448, -0.5956993044924335),
+    TW(0.6704215603801731, -0.741980411720831), TW(-0.10106986275482775, -0.9948793307948056),
+    TW(-0.8059403905711763, -0.591996694962041), TW(0.669282588346636, -0.7430079521351217),
+    TW(-0.1041216338720546, -0.9945645707342554), TW(-0.808656181588175, -0.5882815482226453),
+    TW(0.6681420414265186, -0.7440337441799292), TW(-0.10717242495680876, -0.9942404494531879),
+    TW(-0.8113548470170637, -0.5845539429530153), TW(0.6669999223036375, -0.745057785441466),
+    TW(-0.11022220729388306, -0.9939069700023561), TW(-0.8140363297059484, -0.5808139580957645),
+    TW(0.6658562336655097, -0.7460800735100638), TW(-0.11327095217756424, -0.9935641355205953),
+    TW(-0.8167005728668278, -0.5770616728556794), TW(0.6647109782033449, -0.7471006059801801),
+    TW(-0.11631863091190475, -0.9932119492347945), TW(-0.819347520076797, -0.5732971666980421),
+    TW(0.6635641586120399, -0.7481193804504035), TW(-0.11936521481099123, -0.9928504144598651),
+    TW(-0.8219771152792413, -0.5695205193469475), TW(0.6624157775901718, -0.7491363945234593),
+    TW(-0.12241067519921615, -0.99247953459871), TW(-0.8245893027850251, -0.5657318107836135),
+    TW(0.6612658378399923, -0.750151645806215), TW(-0.12545498341154607, -0.9920993131421918),
+    TW(-0.827184027273669, -0.5619311212446896), TW(0.6601143420674205, -0.7511651319096864),
+    TW(-0.1284981107937931, -0.9917097536690995), TW(-0.8297612337945229, -0.5581185312205563),
+    TW(0.6589612929820373, -0.7521768504490427), TW(-0.13154002870288314, -0.9913108598461154),
+    TW(-0.8323208677679296, -0.5542941214536202), TW(0.6578066932970786, -0.7531867990436124),
+    TW(-0.1345807085071261, -0.99090263542778), TW(-0.83486287498638, -0.5504579729366049),
+    TW(0.656650545729429, -0.7541949753168892), TW(-0.13762012158648607, -0.990485084256457),
+    TW(-0.8373872016156618, -0.546610166910835), TW(0.6554928529996155, -0.7552013768965365),
+    TW(-0.14065823933284913, -0.9900582102622971), TW(-0.8398937941959995, -0.5427507848645159),
+    TW(0.6543336178318006, -0.7562060014143945), TW(-0.14369503315029444, -0.9896220174632009),
+    TW(-0.8423825996431858, -0.5388799085310084), TW(0.6531728429537768, -0.7572088465064845),
+    TW(-0.14673047445536164, -0.989176509964781), TW(-0.8448535652497071, -0.5349976198870972),
+    TW(0.6520105310969595, -0.7582099098130153), TW(-0.1497645346773215, -0.9887216919603238),
+    TW(-0.8473066386858584, -0.5311040011512549), TW(0.650846684996381, -0.759209188978388),
+    TW(-0.1527971852584433, -0.9882575677307495), TW(-0.8497417680008525, -0.5271991347819013),
+    TW(0.6496813073906832, -0.7602066816512024), TW(-0.1558283976542652, -0.9877841416445722),
+    TW(-0.8521589016239196, -0.5232831034756567), TW(0.6485144010221126, -0.7612023854842618),
+    TW(-0.15885814333386128, -0.9873014181578584), TW(-0.8545579883654004, -0.5193559901655898),
+    TW(0.6473459686365121, -0.7621962981345789), TW(-0.16188639378011177, -0.9868094018141855),
+    TW(-0.8569389774178287, -0.5154178780194631), TW(0.6461760129833164, -0.7631884172633813),
+    TW(-0.16491312048996995, -0.9863080972445987), TW(-0.8593018183570084, -0.5114688504379705),
+    TW(0.645004536815544, -0.7641787405361167), TW(-0.1679382949747311, -0.9857975091675675),
+    TW(-0.8616464611430813, -0.507508991052971), TW(0.6438315428897915, -0.765167265622459),
+    TW(-0.17096188876030124, -0.9852776423889412), TW(-0.8639728561215867, -0.5035383837257177),
+    TW(0.6426570339662269, -0.7661539901963128), TW(-0.1739838733874637, -0.9847485018019042),
+    TW(-0.866280954024513, -0.49955711254508195), TW(0.6414810128085832, -0.7671389119358204),
+    TW(-0.17700422041214875, -0.984210092386929), TW(-0.8685707059713409, -0.49556526182577254),
+    TW(0.6403034821841517, -0.7681220285233653), TW(-0.1800229014056994, -0.9836624192117303),
+    TW(-0.870842063470079, -0.4915629161065499), TW(0.6391244448637757, -0.7691033376455796),
+    TW(-0.18303988795514092, -0.9831054874312163), TW(-0.8730949784182901, -0.4875501601484359),
+    TW(0.6379439036218442, -0.7700828369933479), TW(-0.1860551516634465, -0.9825393022874412),
+    TW(-0.8753294031041109, -0.48352707893291863), TW(0.6367618612362842, -0.7710605242618137),
+    TW(-0.18906866414980616, -0.9819638691095552), TW(-0.8775452902072611, -0.4794937576601533),
+    TW(0.6355783204885562, -0.7720363971503844), TW(-0.19208039704989227, -0.9813791933137546),
+    TW(-0.8797425928000473, -0.4754502817471561), TW(0.6343932841636455, -0.773010453362737),
+    TW(-0.1950903220161282, -0.9807852804032304), TW(-0.8819212643483549, -0.47139673682599786),
+    TW(0.6332067550500572, -0.7739826906068228), TW(-0.19809841071795362, -0.9801821359681174),
+    TW(-0.8840812587126349, -0.4673332087419886), TW(0.6320187359398091, -0.7749531065948738),
+    TW(-0.20110463484209182, -0.9795697656854405), TW(-0.8862225301488805, -0.4632597835518603),
+    TW(0.6308292296284245, -0.7759216990434076), TW(-0.2041089660928169, -0.9789481753190622),
+    TW(-0.8883450333095962, -0.4591765475219442), TW(0.6296382389149271, -0.7768884656732324),
+    TW(-0.20711137619221845, -0.9783173707196277), TW(-0.8904487232447579, -0.4550835871263439),
+    TW(0.6284457666018327, -0.777853404209453), TW(-0.2101118368804696, -0.9776773578245099),
+    TW(-0.8925335554027646, -0.45098098904510386), TW(0.6272518154951442, -0.7788165123814759),
+    TW(-0.21311031991609125, -0.9770281426577544), TW(-0.8945994856313827, -0.44686884016237416),
+    TW(0.6260563884043435, -0.7797777879230144), TW(-0.2161067970762195, -0.9763697313300211),
+    TW(-0.8966464701786803, -0.44274722756456997), TW(0.6248594881423865, -0.7807372285720944),
+    TW(-0.21910124015686966, -0.9757021300385286), TW(-0.8986744656939539, -0.43861623853852755),
+    TW(0.6236611175256946, -0.7816948320710594), TW(-0.22209362097320348, -0.9750253450669941),
+    TW(-0.9006834292286467, -0.434475960569656), TW(0.6224612793741501, -0.7826505961665757),
+    TW(-0.22508391135979267, -0.9743393827855759), TW(-0.9026733182372587, -0.4303264813400829),
+    TW(0.6212599765110877, -0.7836045186096382), TW(-0.22807208317088568, -0.973644249650812),
+    TW(-0.9046440905782461, -0.42616788872679984), TW(0.6200572117632892, -0.7845565971555752),
+    TW(-0.23105810828067114, -0.9729399522055602), TW(-0.9065957045149153, -0.42200027079979985),
+    TW(0.6188529879609763, -0.7855068295640539), TW(-0.23404195858354332, -0.9722264970789364),
+    TW(-0.9085281187163061, -0.41782371582021244), TW(0.617647307937804, -0.7864552135990858),
+    TW(-0.23702360599436723, -0.9715038909862518), TW(-0.9104412922580671, -0.4136383122384346),
+    TW(0.6164401745308536, -0.7874017470290313), TW(-0.2400030224487414, -0.9707721407289504),
+    TW(-0.9123351846233227, -0.40944414869225765), TW(0.6152315905806268, -0.7883464276266062),
+    TW(-0.24298017990326387, -0.970031253194544), TW(-0.9142097557035307, -0.4052413140049899),
+    TW(0.6140215589310385, -0.7892892531688857), TW(-0.24595505033579448, -0.9692812353565485),
+    TW(-0.9160649657993317, -0.4010298971835756), TW(0.6128100824294097, -0.79023022143731),
+    TW(-0.24892760574572012, -0.9685220942744174), TW(-0.9179007756213905, -0.39680998741671025),
+    TW(0.611597163926462, -0.7911693302176901), TW(-0.2518978181542168, -0.9677538370934755),
+    TW(-0.9197171462912274, -0.3925816740729514), TW(0.6103828062763095, -0.7921065773002124),
+    TW(-0.2548656596045145, -0.9669764710448521), TW(-0.9215140393420418, -0.3883450466988266),
+    TW(0.6091670123364532, -0.7930419604794436), TW(-0.2578311021621588, -0.9661900034454126),
+    TW(-0.9232914167195275, -0.3841001950169353), TW(0.6079497849677737, -0.7939754775543372),
+    TW(-0.26079411791527546, -0.9653944416976894), TW(-0.9250492407826775, -0.3798472089240514),
+    TW(0.6067311270345245, -0.794907126328237), TW(-0.2637546789748314, -0.9645897932898128),
+    TW(-0.9267874743045817, -0.3755861784892174), TW(0.6055110414043255, -0.7958369046088835),
+    TW(-0.2667127574748983, -0.9637760657954398), TW(-0.9285060804732155, -0.3713171939518377),
+    TW(0.6042895309481561, -0.7967648102084187), TW(-0.2696683255729151, -0.9629532668736839),
+    TW(-0.9302050228922191, -0.3670403457197673), TW(0.6030665985403483, -0.797690840943391),
+    TW(-0.27262135544994887, -0.9621214042690416), TW(-0.931884265581668, -0.3627557243673973),
+    TW(0.60184224705858, -0.7986149946347608), TW(-0.27557181931095814, -0.9612804858113206),
+    TW(-0.9335437729788362, -0.3584634206337366), TW(0.600616479383869, -0.799537269107905),
+    TW(-0.27851968938505295, -0.9604305194155659), TW(-0.9351835099389476, -0.3541635254204904),
+    TW(0.5993892984005645, -0.8004576621926227), TW(-0.28146493792575794, -0.9595715130819845),
+    TW(-0.9368034417359217, -0.34985612979013486), TW(0.5981607069963424, -0.8013761717231401),
+    TW(-0.2844075372112717, -0.9587034748958716), TW(-0.9384035340631082, -0.345541324963989),
+    TW(0.5969307080621965, -0.8022927955381157), TW(-0.28734745954472946, -0.9578264130275329),
+    TW(-0.9399837530340138, -0.3412192023202827), TW(0.5956993044924335, -0.8032075314806448),
+    TW(-0.29028467725446216, -0.9569403357322089), TW(-0.9415440651830207, -0.33688985339222033),
+    TW(0.5944664991846645, -0.8041203773982657), TW(-0.2932191626942586, -0.9560452513499965),
+    TW(-0.9430844374660934, -0.33255336986604445), TW(0.5932322950397998, -0.8050313311429637),
+    TW(-0.29615088824362384, -0.9551411683057707), TW(-0.9446048372614801, -0.3282098435790927),
+    TW(0.591996694962041, -0.8059403905711763), TW(-0.29907982630804036, -0.9542280951091057),
+    TW(-0.9461052323704033, -0.323859366517853), TW(0.5907597018588743, -0.8068475535437992),
+    TW(-0.3020059493192281, -0.9533060403541939), TW(-0.9475855910177411, -0.3195020308160158),
+    TW(0.5895213186410639, -0.8077528179261904), TW(-0.30492922973540226, -0.9523750127197659),
+    TW(-0.9490458818527006, -0.3151379287525225), TW(0.5882815482226453, -0.808656181588175),
+    TW(-0.30784964004153487, -0.9514350209690083), TW(-0.9504860739494817, -0.31076715274961153),
+    TW(0.5870403935209181, -0.8095576424040513), TW(-0.31076715274961136, -0.9504860739494818),
+    TW(-0.9519061368079323, -0.3063897953708609), TW(0.5857978574564389, -0.8104571982525948),
+    TW(-0.3136817403988914, -0.9495281805930367), TW(-0.9533060403541939, -0.30200594931922803),
+    TW(0.5845539429530153, -0.8113548470170637), TW(-0.31659337555616573, -0.9485613499157304),
+    TW(-0.9546857549413383, -0.29761570743508614), TW(0.5833086529376983, -0.8122505865852039),
+    TW(-0.31950203081601564, -0.9475855910177412), TW(-0.9560452513499963, -0.29321916269425896),
+    TW(0.5820619903407755, -0.8131444148492536), TW(-0.32240767880106985, -0.9466009130832835),
+    TW(-0.9573845007889759, -0.28881640820604976), TW(0.5808139580957645, -0.8140363297059483),
+    TW(-0.32531029216226287, -0.9456073253805214), TW(-0.9587034748958715, -0.2844075372112721),
+    TW(0.5795645591394057, -0.8149263290565266), TW(-0.32820984357909255, -0.9446048372614803),
+    TW(-0.9600021457376658, -0.27999264308027344), TW(0.5783137964116556, -0.8158144108067338),
+    TW(-0.3311063057598763, -0.9435934581619604), TW(-0.9612804858113206, -0.2755718193109583),
+    TW(0.5770616728556796, -0.8167005728668278), TW(-0.3339996514420094, -0.9425731976014469),
+    TW(-0.9625384680443592, -0.2711451595268081), TW(0.5758081914178453, -0.8175848131515837),
+    TW(-0.33688985339221994, -0.9415440651830208), TW(-0.9637760657954398, -0.2667127574748985),
+    TW(0.5745533550477158, -0.8184671295802987), TW(-0.33977688440682685, -0.9405060705932683),
+    TW(-0.9649932528549203, -0.2622747070239137), TW(0.5732971666980423, -0.8193475200767969),
+    TW(-0.34266071731199427, -0.9394592236021899), TW(-0.9661900034454125, -0.257831102162159),
+    TW(0.572039629324757, -0.8202259825694347), TW(-0.34554132496398904, -0.9384035340631082),
+    TW(-0.9673662922223285, -0.2533820369955701), TW(0.5707807458869674, -0.8211025149911046),
+    TW(-0.3484186802494344, -0.937339011912575), TW(-0.9685220942744174, -0.2489276057457201),
+    TW(0.5695205193469473, -0.8219771152792416), TW(-0.35129275608556704, -0.9362656671702783),
+    TW(-0.9696573851242923, -0.24446790274782448), TW(0.5682589526701315, -0.8228497813758263),
+    TW(-0.3541635254204904, -0.9351835099389476), TW(-0.9707721407289502, -0.24000302244874178),
+    TW(0.5669960488251087, -0.8237205112273913), TW(-0.3570309612334299, -0.934092550404259),
+    TW(-0.9718663374802793, -0.23553305940497574), TW(0.5657318107836132, -0.8245893027850253),
+    TW(-0.35989503653498817, -0.9329927988347388), TW(-0.9729399522055601, -0.23105810828067133),
+    TW(0.5644662415205195, -0.8254561540043774), TW(-0.3627557243673971, -0.9318842655816681),
+    TW(-0.9739929621679558, -0.22657826384561017), TW(0.5631993440138341, -0.8263210628456634),
+    TW(-0.36561299780477385, -0.9307669610789837), TW(-0.9750253450669941, -0.22209362097320365),
+    TW(0.5619311212446895, -0.827184027273669), TW(-0.3684668299533722, -0.9296408958431813),
+    TW(-0.976037079039039, -0.21760427463848372), TW(0.560661576197336, -0.8280450452577558),
+    TW(-0.3713171939518375, -0.9285060804732156), TW(-0.9770281426577544, -0.21311031991609142),
+    TW(0.5593907118591361, -0.8289041147718649), TW(-0.3741640629714579, -0.9273625256504011),
+    TW(-0.9779985149345571, -0.2086118519782635), TW(0.5581185312205561, -0.829761233794523),
+    TW(-0.3770074102164182, -0.9262102421383114), TW(-0.9789481753190622, -0.20410896609281684),
+    TW(0.5568450372751601, -0.8306164003088462), TW(-0.379847208924051, -0.9250492407826777),
+    TW(-0.9798771036995176, -0.19960175762113092), TW(0.5555702330196023, -0.8314696123025452),
+    TW(-0.3826834323650897, -0.9238795325112867), TW(-0.9807852804032304, -0.1950903220161286),
+    TW(0.5542941214536201, -0.8323208677679297), TW(-0.3855160538439189, -0.9227011283338785),
+    TW(-0.9816726861969831, -0.19057475482025307), TW(0.5530167055800276, -0.8331701647019132),
+    TW(-0.3883450466988262, -0.921514039342042), TW(-0.9825393022874412, -0.1860551516634469),
+    TW(0.5517379884047074, -0.8340175011060181), TW(-0.39117038430225387, -0.9203182767091106),
+    TW(-0.9833851103215512, -0.18153160826112522), TW(0.5504579729366048, -0.83486287498638),
+    TW(-0.393992040061048, -0.9191138516900578), TW(-0.984210092386929, -0.17700422041214894),
+    TW(0.5491766621877198, -0.8357062843537526), TW(-0.3968099874167103, -0.9179007756213905),
+    TW(-0.9850142310122398, -0.17247308399679612), TW(0.5478940591731002, -0.8365477272235119),
+    TW(-0.3996241998456467, -0.9166790599210427), TW(-0.9857975091675674, -0.16793829497473128),
+    TW(0.5466101669108349, -0.8373872016156619), TW(-0.40243465085941843, -0.9154487160882678),
+    TW(-0.9865599102647754, -0.16339994938297328), TW(0.5453249884220465, -0.838224705554838),
+    TW(-0.40524131400498975, -0.9142097557035307), TW(-0.9873014181578584, -0.15885814333386147),
+    TW(0.5440385267308839, -0.8390602370703126), TW(-0.40804416286497863, -0.9129621904283982),
+    TW(-0.9880220171432835, -0.15431297301302008), TW(0.542750784864516, -0.8398937941959994),
+    TW(-0.4108431710579038, -0.9117060320054299), TW(-0.9887216919603238, -0.14976453467732145),
+    TW(0.5414617658531236, -0.8407253749704581), TW(-0.41363831223843445, -0.9104412922580672),
+    TW(-0.9894004277913804, -0.14521292465284735), TW(0.540171472729893, -0.8415549774368983),
+    TW(-0.416429560097637, -0.9091679830905225), TW(-0.990058210262297, -0.14065823933284954),
+    TW(0.5388799085310084, -0.842382599643186), TW(-0.41921688836322407, -0.9078861164876662),
+    TW(-0.9906950254426646, -0.13610057517570648), TW(0.5375870762956455, -0.8432082396418454),
+    TW(-0.4220002707997997, -0.9065957045149153), TW(-0.9913108598461154, -0.13154002870288334),
+    TW(0.5362929790659632, -0.8440318954900664), TW(-0.4247796812091087, -0.9052967593181188),
+    TW(-0.9919057004306093, -0.12697669649688606), TW(0.5349976198870973, -0.844853565249707),
+    TW(-0.42755509343028186, -0.9039892931234434), TW(-0.99247953459871, -0.12241067519921635),
+    TW(0.533701001807153, -0.8456732469872991), TW(-0.4303264813400827, -0.9026733182372588),
+    TW(-0.9930323501978514, -0.11784206150832509), TW(0.532403127877198, -0.846490938774052),
+    TW(-0.4330938188531519, -0.901348847046022), TW(-0.9935641355205953, -0.11327095217756442),
+    TW(0.531104001151255, -0.8473066386858583), TW(-0.43585707992225536, -0.9000158920161603),
+    TW(-0.9940748793048794, -0.10869744401313874), TW(0.5298036246862948, -0.8481203448032971),
+    TW(-0.4386162385385274, -0.8986744656939539), TW(-0.9945645707342554, -0.10412163387205457),
+    TW(0.5285020015422285, -0.8489320552116396), TW(-0.4413712687317167, -0.8973245807054183),
+    TW(-0.9950331994381186, -0.09954361866006928), TW(0.5271991347819014, -0.8497417680008524),
+    TW(-0.44412214457042914, -0.8959662497561852), TW(-0.9954807554919269, -0.09496349532963891),
+    TW(0.5258950274710847, -0.8505494812656034), TW(-0.446868840162374, -0.8945994856313828),
+    TW(-0.9959072294174117, -0.09038136087786529), TW(0.5245896826784688, -0.8513551931052652),
+    TW(-0.4496113296546067, -0.8932243011955152), TW(-0.996312612182778, -0.08579731234444016),
+    TW(0.5232831034756564, -0.8521589016239198), TW(-0.4523495872337709, -0.8918407093923427),
+    TW(-0.9966968952028961, -0.08121144680959266), TW(0.5219752929371544, -0.8529606049303636),
+    TW(-0.4550835871263437, -0.890448723244758), TW(-0.997060070339483, -0.07662386139203169),
+    TW(0.5206662541403673, -0.8537603011381113), TW(-0.457813303598877, -0.8890483558546647),
+    TW(-0.9974021299012753, -0.07203465324688947), TW(0.5193559901655895, -0.8545579883654005),
+    TW(-0.46053871095824006, -0.8876396204028539), TW(-0.9977230666441916, -0.06744391956366418),
+    TW(0.5180445040959993, -0.855353664735196), TW(-0.46325978355186015, -0.8862225301488806),
+    TW(-0.9980228737714862, -0.06285175756416149), TW(0.51673179901765, -0.8561473283751945),
+    TW(-0.465976495767966, -0.8847970984309379), TW(-0.9983015449338929, -0.058258264500435794),
+    TW(0.5154178780194631, -0.8569389774178287), TW(-0.4686888220358277, -0.8833633386657317),
+    TW(-0.9985590742297593, -0.05366353765273052), TW(0.5141027441932217, -0.8577286100002721),
+    TW(-0.4713967368259977, -0.881921264348355), TW(-0.9987954562051724, -0.049067674327417966),
+    TW(0.5127864006335631, -0.8585162242644427), TW(-0.4741002146505499, -0.8804708890521609),
+    TW(-0.9990106858540734, -0.044470771854938584), TW(0.5114688504379705, -0.8593018183570084),
+    TW(-0.4767992300633219, -0.8790122264286335), TW(-0.9992047586183639, -0.03987292758774013),
+    TW(0.5101500967067667, -0.8600853904293901), TW(-0.4794937576601531, -0.8775452902072612),
+    TW(-0.9993776703880028, -0.03527423889821423), TW(0.508830142543107, -0.8608669386377673),
+    TW(-0.4821837720791227, -0.8760700941954066), TW(-0.9995294175010931, -0.030674803176636865),
+    TW(0.5075089910529709, -0.8616464611430813), TW(-0.484869248000791, -0.8745866522781762),
+    TW(-0.9996599967439592, -0.0260747178291041), TW(0.5061866453451555, -0.8624239561110405),
+    TW(-0.4875501601484357, -0.8730949784182902), TW(-0.9997694053512153, -0.021474080275469667),
+    TW(0.5048631085312675, -0.8631994217121242), TW(-0.4902264832882912, -0.871595086655951),
+    TW(-0.9998576410058239, -0.016872987947281835), TW(0.5035383837257176, -0.8639728561215867),
+    TW(-0.492898192229784, -0.8700869911087115), TW(-0.9999247018391445, -0.012271538285720007),
+    TW(0.5022124740457109, -0.8647442575194624), TW(-0.4955652618257724, -0.868570705971341),
+    TW(-0.9999705864309741, -0.007669828739531138), TW(0.5008853826112409, -0.865513624090569),
+    TW(-0.4982276669727816, -0.8670462455156928), TW(-0.9999952938095762, -0.003067956762965977),
+    TW(0.4995571125450819, -0.866280954024513), TW(-0.5008853826112408, -0.8655136240905691),
+    TW(-0.9999988234517019, 0.0015339801862848043), TW(0.49822766697278187, -0.8670462455156926),
+    TW(-0.5035383837257175, -0.8639728561215868), TW(-0.9999811752826011, 0.006135884649154554),
+    TW(0.49689704902265464, -0.8678094967633032), TW(-0.5061866453451551, -0.8624239561110406),
+    TW(-0.9999423496760239, 0.010737659167264166), TW(0.4955652618257725, -0.8685707059713409),
+    TW(-0.5088301425431071, -0.8608669386377672), TW(-0.9998823474542126, 0.015339206284987816),
+    TW(0.49423230851595973, -0.8693298713486067), TW(-0.5114688504379704, -0.8593018183570084),
+    TW(-0.9998011698878843, 0.01994042855151419), TW(0.4928981922297841, -0.8700869911087113),
+    TW(-0.5141027441932217, -0.8577286100002721), TW(-0.9996988186962042, 0.02454122852291208),
+    TW(0.49156291610655006, -0.8708420634700789), TW(-0.5167317990176497, -0.8561473283751946),
+    TW(-0.9995752960467492, 0.029141508764193556), TW(0.4902264832882911, -0.8715950866559511),
+    TW(-0.5193559901655896, -0.8545579883654005), TW(-0.9994306045554617, 0.033741171851377455),
+    TW(0.4888888969197632, -0.8723460588943915), TW(-0.5219752929371543, -0.8529606049303637),
+    TW(-0.9992647472865944, 0.03834012037355261), TW(0.48755016014843605, -0.8730949784182901),
+    TW(-0.5245896826784687, -0.8513551931052652), TW(-0.9990777277526454, 0.04293825693494078),
+    TW(0.48621027612448653, -0.8738418434653668), TW(-0.5271991347819011, -0.8497417680008527),
+    TW(-0.9988695499142836, 0.047535484156959296), TW(0.4848692480007911, -0.8745866522781761),
+    TW(-0.5298036246862947, -0.8481203448032972), TW(-0.9986402181802653, 0.05213170468028335),
+    TW(0.48352707893291874, -0.8753294031041108), TW(-0.5324031278771979, -0.8464909387740521),
+    TW(-0.9983897374073402, 0.05672682116690782), TW(0.48218377207912283, -0.8760700941954066),
+    TW(-0.534997619887097, -0.8448535652497072), TW(-0.9981181129001492, 0.061320736302208245),
+    TW(0.4808393306003339, -0.8768087238091458), TW(-0.5375870762956456, -0.8432082396418454),
+    TW(-0.9978253504111116, 0.06591335279700353), TW(0.479493757660153, -0.8775452902072612),
+    TW(-0.5401714727298929, -0.8415549774368984), TW(-0.9975114561403035, 0.0705045733896136),
+    TW(0.4781470564248431, -0.8782797916565415), TW(-0.5427507848645158, -0.8398937941959996),
+    TW(-0.9971764367353262, 0.0750943008479211), TW(0.47679923006332225, -0.8790122264286334),
+    TW(-0.5453249884220462, -0.8382247055548382), TW(-0.9968202992911658, 0.07968243797142995),
+    TW(0.47545028174715587, -0.8797425928000474), TW(-0.5478940591731002, -0.836547727223512),
+    TW(-0.9964430513500426, 0.08426888759332393), TW(0.47410021465055, -0.8804708890521608),
+    TW(-0.5504579729366047, -0.8348628749863801), TW(-0.996044700901252, 0.0888535525825245),
+    TW(0.4727490319503429, -0.881197113471222), TW(-0.5530167055800274, -0.8331701647019133),
+    TW(-0.9956252563809943, 0.09343633584574773), TW(0.4713967368259978, -0.8819212643483549),
+    TW(-0.555570233019602, -0.8314696123025455), TW(-0.9951847266721969, 0.09801714032956059),
+    TW(0.4700433324595956, -0.8826433399795628), TW(-0.5581185312205561, -0.829761233794523),
+    TW(-0.9947231211043257, 0.10259586902243631), TW(0.46868882203582796, -0.8833633386657316),
+    TW(-0.5606615761973359, -0.8280450452577558), TW(-0.9942404494531879, 0.10717242495680891),
+    TW(0.4673332087419885, -0.884081258712635), TW(-0.563199344013834, -0.8263210628456636),
+    TW(-0.9937367219407247, 0.11174671121112625), TW(0.4659764957679661, -0.8847970984309378),
+    TW(-0.5657318107836132, -0.8245893027850252), TW(-0.9932119492347946, 0.11631863091190447),
+    TW(0.4646186863062378, -0.8855108561362), TW(-0.5682589526701315, -0.8228497813758263),
+    TW(-0.992666142448948, 0.12088808723577682), TW(0.46325978355186026, -0.8862225301488806),
+    TW(-0.5707807458869671, -0.8211025149911048), TW(-0.9920993131421918, 0.125454983411546),
+    TW(0.46189979070246284, -0.8869321187943421), TW(-0.573297166698042, -0.8193475200767971),
+    TW(-0.991511473318744, 0.13001922272223318), TW(0.46053871095824, -0.8876396204028539),
+    TW(-0.5758081914178453, -0.8175848131515837), TW(-0.99090263542778, 0.13458070850712606),
+    TW(0.45917654752194415, -0.8883450333095962), TW(-0.5783137964116555, -0.8158144108067338),
+    TW(-0.9902728123631691, 0.13913934416382612), TW(0.4578133035988773, -0.8890483558546646),
+    TW(-0.5808139580957644, -0.8140363297059485), TW(-0.9896220174632009, 0.1436950331502944),
+    TW(0.45644898239688386, -0.8897495863830729), TW(-0.5833086529376984, -0.8122505865852039),
+    TW(-0.988950264510303, 0.14824767898689603), TW(0.45508358712634384, -0.8904487232447579),
+    TW(-0.5857978574564389, -0.8104571982525948), TW(-0.9882575677307495, 0.15279718525844344),
+    TW(0.4537171210001639, -0.8911457647945832), TW(-0.5882815482226452, -0.8086561815881751),
+    TW(-0.9875439417943592, 0.1573434556162383), TW(0.452349587233771, -0.8918407093923427),
+    TW(-0.590759701858874, -0.8068475535437994), TW(-0.9868094018141855, 0.1618863937801115),
+    TW(0.4509809890451038, -0.8925335554027647), TW(-0.5932322950397999, -0.8050313311429635),
+    TW(-0.9860539633461954, 0.16642590354046383), TW(0.4496113296546066, -0.8932243011955153),
+    TW(-0.5956993044924334, -0.8032075314806449), TW(-0.9852776423889413, 0.17096188876030097),
+    TW(0.44824061228522, -0.8939129451452033), TW(-0.5981607069963422, -0.8013761717231404),
+    TW(-0.9844804553832209, 0.1754942533772712), TW(0.4468688401623743, -0.8945994856313826),
+    TW(-0.6006164793838688, -0.7995372691079052), TW(-0.9836624192117303, 0.18002290140569935),
+    TW(0.44549601651398174, -0.8952839210385576), TW(-0.6030665985403483, -0.797690840943391),
+    TW(-0.9828235511987053, 0.18454773693861948), TW(0.44412214457042926, -0.8959662497561851),
+    TW(-0.6055110414043254, -0.7958369046088836), TW(-0.9819638691095552, 0.1890686641498061),
+    TW(0.44274722756457013, -0.8966464701786802), TW(-0.6079497849677735, -0.7939754775543373),
+    TW(-0.9810833911504867, 0.19358558729580355), TW(0.4413712687317166, -0.8973245807054183),
+    TW(-0.6103828062763096, -0.7921065773002123), TW(-0.9801821359681174, 0.19809841071795356),
+    TW(0.43999427130963326, -0.8980005797407399), TW(-0.6128100824294097, -0.79023022143731),
+    TW(-0.979260122649082, 0.20260703884442113), TW(0.4386162385385277, -0.8986744656939538),
+    TW(-0.6152315905806267, -0.7883464276266063), TW(-0.9783173707196277, 0.2071113761922186),
+    TW(0.4372371736610442, -0.8993462369793415), TW(-0.6176473079378038, -0.7864552135990859),
+    TW(-0.9773539001452, 0.21161132736922766), TW(0.4358570799222555, -0.9000158920161603),
+    TW(-0.6200572117632892, -0.7845565971555751), TW(-0.9763697313300213, 0.21610679707621921),
+    TW(0.4344759605696557, -0.9006834292286469), TW(-0.62246127937415, -0.7826505961665757),
+    TW(-0.975364885116657, 0.22059769010887326), TW(0.433093818853152, -0.901348847046022),
+    TW(-0.6248594881423862, -0.7807372285720946), TW(-0.9743393827855759, 0.2250839113597926),
+    TW(0.43171065802505737, -0.9020121439024931), TW(-0.6272518154951439, -0.7788165123814761),
+    TW(-0.9732932460546982, 0.2295653658205187), TW(0.4303264813400826, -0.9026733182372588),
+    TW(-0.6296382389149271, -0.7768884656732324), TW(-0.9722264970789364, 0.23404195858354326),
+    TW(0.42894129205532955, -0.9033323684945118), TW(-0.632018735939809, -0.7749531065948739),
+    TW(-0.9711391584497252, 0.23851359484431833), TW(0.4275550934302822, -0.9039892931234433),
+    TW(-0.6343932841636454, -0.7730104533627371), TW(-0.970031253194544, 0.24298017990326382),
+    TW(0.4261678887267996, -0.9046440905782462), TW(-0.6367618612362843, -0.7710605242618137),
+    TW(-0.9689028047764289, 0.24744161916777327), TW(0.4247796812091088, -0.9052967593181188),
+    TW(-0.6391244448637757, -0.7691033376455796), TW(-0.9677538370934755, 0.25189781815421697),
+    TW(0.4233904741437961, -0.9059472978072685), TW(-0.641481012808583, -0.7671389119358205),
+    TW(-0.9665843744783331, 0.2563486824899429), TW(0.4220002707997998, -0.9065957045149153),
+    TW(-0.6438315428897913, -0.7651672656224591), TW(-0.9653944416976894, 0.2607941179152756),
+    TW(0.4206090744484025, -0.9072419779152959), TW(-0.6461760129833164, -0.7631884172633813),
+    TW(-0.9641840639517458, 0.2652340302855115), TW(0.41921688836322396, -0.9078861164876662),
+    TW(-0.6485144010221124, -0.7612023854842619), TW(-0.962953266873684, 0.2696683255729148),
+    TW(0.4178237158202124, -0.9085281187163061), TW(-0.6508466849963808, -0.7592091889783882),
+    TW(-0.9617020765291225, 0.27409690986870616), TW(0.4164295600976373, -0.9091679830905223),
+    TW(-0.6531728429537765, -0.7572088465064847), TW(-0.9604305194155659, 0.2785196893850529),
+    TW(0.41503442447608163, -0.9098057081046522), TW(-0.6554928529996155, -0.7552013768965365),
+    TW(-0.959138622461842, 0.28293657045705517), TW(0.41363831223843456, -0.9104412922580671),
+    TW(-0.6578066932970786, -0.7531867990436125), TW(-0.9578264130275329, 0.2873474595447294),
+    TW(0.412241226669883, -0.9110747340551762), TW(-0.6601143420674204, -0.7511651319096866),
+    TW(-0.9564939189023951, 0.2917522632349892), TW(0.4108431710579039, -0.9117060320054299),
+    TW(-0.6624157775901719, -0.7491363945234593), TW(-0.9551411683057708, 0.2961508882436238),
+    TW(0.4094441486922576, -0.9123351846233227), TW(-0.6647109782033449, -0.7471006059801801),
+    TW(-0.9537681898859903, 0.30054324141727345), TW(0.40804416286497874, -0.9129621904283981),
+    TW(-0.6669999223036374, -0.7450577854414661), TW(-0.9523750127197659, 0.30492922973540243),
+    TW(0.40664321687036914, -0.9135870479452508), TW(-0.6692825883466359, -0.7430079521351218),
+    TW(-0.9509616663115751, 0.3093087603122688), TW(0.40524131400498986, -0.9142097557035307),
+    TW(-0.6715589548470184, -0.740951125354959), TW(-0.9495281805930368, 0.3136817403988912),
+    TW(0.40383845756765413, -0.9148303122379461), TW(-0.673829000378756, -0.7388873244606152),
+    TW(-0.9480745859222763, 0.31804807738501467), TW(0.40243465085941854, -0.9154487160882678),
+    TW(-0.6760927035753158, -0.73681656887737), TW(-0.9466009130832836, 0.32240767880106963),
+    TW(0.4010298971835758, -0.9160649657993316), TW(-0.6783500431298612, -0.7347388780959636),
+    TW(-0.9451071932852606, 0.32676045232013157), TW(0.3996241998456468, -0.9166790599210427),
+    TW(-0.680600997795453, -0.7326542716724128), TW(-0.9435934581619604, 0.33110630575987626),
+    TW(0.3982175621533736, -0.9172909970083779), TW(-0.682845546385248, -0.7305627692278276),
+    TW(-0.9420597397710174, 0.3354451470845315), TW(0.3968099874167104, -0.9179007756213904),
+    TW(-0.6850836677727002, -0.7284643904482253), TW(-0.9405060705932684, 0.3397768844068268),
+    TW(0.3954014789478163, -0.9185083943252123), TW(-0.6873153408917592, -0.7263591550843459),
+    TW(-0.9389324835320646, 0.3441014259899388), TW(0.3939920400610481, -0.9191138516900578),
+    TW(-0.6895405447370669, -0.7242470829514669), TW(-0.937339011912575, 0.34841868024943456),
+    TW(0.3925816740729515, -0.9197171462912274), TW(-0.6917592583641576, -0.7221281939292155),
+    TW(-0.9357256894810804, 0.3527285557552107), TW(0.391170384302254, -0.9203182767091105),
+    TW(-0.6939714608896538, -0.7200025079613818), TW(-0.9340925504042589, 0.3570309612334301),
+    TW(0.3897581740698564, -0.9209172415291895), TW(-0.696177131491463, -0.7178700450557317),
+    TW(-0.9324396292684625, 0.36132580556845395), TW(0.3883450466988263, -0.9215140393420419),
+    TW(-0.6983762494089728, -0.7157308252838187), TW(-0.9307669610789838, 0.3656129978047736),
+    TW(0.3869310055143887, -0.9221086687433451), TW(-0.7005687939432482, -0.7135848687807937),
+    TW(-0.9290745812593159, 0.3698924471489339), TW(0.385516053843919, -0.9227011283338785),
+    TW(-0.7027547444572251, -0.7114321957452167), TW(-0.9273625256504011, 0.3741640629714578),
+    TW(0.38410019501693504, -0.9232914167195276), TW(-0.7049340803759049, -0.7092728264388656),
+    TW(-0.9256308305098728, 0.3784277548087654), TW(0.38268343236508984, -0.9238795325112867),
+    TW(-0.7071067811865475, -0.7071067811865476), TW(-0.9238795325112868, 0.38268343236508967),
+    TW(0.3812657692221625, -0.9244654743252626), TW(-0.7092728264388655, -0.7049340803759051),
+    TW(-0.9221086687433452, 0.3869310055143885), TW(0.3798472089240511, -0.9250492407826776),
+    TW(-0.7114321957452165, -0.7027547444572252), TW(-0.9203182767091106, 0.3911703843022538),
+    TW(0.3784277548087656, -0.9256308305098727), TW(-0.7135848687807936, -0.7005687939432483),
+    TW(-0.9185083943252123, 0.3954014789478163), TW(0.3770074102164183, -0.9262102421383113),
+    TW(-0.7157308252838186, -0.6983762494089729), TW(-0.9166790599210427, 0.39962419984564684),
+    TW(0.3755861784892173, -0.9267874743045817), TW(-0.7178700450557316, -0.6961771314914631),
+    TW(-0.9148303122379461, 0.4038384575676542), TW(0.374164062971458, -0.9273625256504011),
+    TW(-0.7200025079613817, -0.693971460889654), TW(-0.9129621904283983, 0.40804416286497835),
+    TW(0.3727410670095158, -0.9279353948226179), TW(-0.7221281939292152, -0.6917592583641579),
+    TW(-0.9110747340551765, 0.4122412266698826), TW(0.3713171939518376, -0.9285060804732155),
+    TW(-0.7242470829514668, -0.689540544737067), TW(-0.9091679830905225, 0.41642956009763693),
+    TW(0.36989244714893427, -0.9290745812593157), TW(-0.7263591550843458, -0.6873153408917593),
+    TW(-0.9072419779152959, 0.42060907444840234), TW(0.3684668299533723, -0.9296408958431813),
+    TW(-0.7284643904482252, -0.6850836677727004), TW(-0.9052967593181188, 0.42477968120910864),
+    TW(0.36704034571976724, -0.9302050228922191), TW(-0.7305627692278275, -0.6828455463852482),
+    TW(-0.9033323684945119, 0.4289412920553294), TW(0.36561299780477396, -0.9307669610789837),
+    TW(-0.7326542716724127, -0.6806009977954532), TW(-0.901348847046022, 0.43309381885315185),
+    TW(0.36418478956707984, -0.9313267090811804), TW(-0.7347388780959635, -0.6783500431298614),
+    TW(-0.8993462369793416, 0.43723717366104403), TW(0.3627557243673972, -0.9318842655816681),
+    TW(-0.7368165688773699, -0.6760927035753159), TW(-0.8973245807054183, 0.44137126873171667),
+    TW(0.36132580556845434, -0.9324396292684624), TW(-0.738887324460615, -0.6738290003787561),
+    TW(-0.8952839210385575, 0.44549601651398174), TW(0.3598950365349883, -0.9329927988347388),
+    TW(-0.7409511253549589, -0.6715589548470186), TW(-0.8932243011955153, 0.44961132965460665),
+    TW(0.35846342063373654, -0.9335437729788362), TW(-0.7430079521351217, -0.669282588346636),
+    TW(-0.8911457647945834, 0.45371712100016354), TW(0.35703096123343003, -0.9340925504042589),
+    TW(-0.745057785441466, -0.6669999223036376), TW(-0.8890483558546647, 0.45781330359887695),
+    TW(0.35559766170478396, -0.9346391298196808), TW(-0.74710060598018, -0.664710978203345),
+    TW(-0.8869321187943423, 0.4618997907024625), TW(0.3541635254204905, -0.9351835099389475),
+    TW(-0.7491363945234591, -0.662415777590172), TW(-0.8847970984309379, 0.46597649576796596),
+    TW(0.3527285557552107, -0.9357256894810804), TW(-0.7511651319096865, -0.6601143420674205),
+    TW(-0.8826433399795629, 0.47004333245959545), TW(0.35129275608556715, -0.9362656671702783),
+    TW(-0.7531867990436124, -0.6578066932970787), TW(-0.8804708890521609, 0.47410021465054986),
+    TW(0.34985612979013503, -0.9368034417359216), TW(-0.7552013768965364, -0.6554928529996156),
+    TW(-0.8782797916565416, 0.47814705642484295), TW(0.3484186802494345, -0.937339011912575),
+    TW(-0.7572088465064846, -0.6531728429537766), TW(-0.8760700941954066, 0.48218377207912266),
+    TW(0.3469804108459237, -0.9378723764399899), TW(-0.7592091889783881, -0.650846684996381),
+    TW(-0.8738418434653669, 0.48621027612448636), TW(0.34554132496398915, -0.9384035340631081),
+    TW(-0.7612023854842617, -0.6485144010221126), TW(-0.871595086655951, 0.49022648328829116),
+    TW(0.344101425989939, -0.9389324835320645), TW(-0.763188417263381, -0.6461760129833166),
+    TW(-0.8693298713486067, 0.4942323085159598), TW(0.3426607173119944, -0.9394592236021899),
+    TW(-0.765167265622459, -0.6438315428897914), TW(-0.8670462455156929, 0.49822766697278154),
+    TW(0.3412192023202824, -0.9399837530340139), TW(-0.7671389119358203, -0.6414810128085832),
+    TW(-0.8647442575194625, 0.5022124740457106), TW(0.33977688440682696, -0.9405060705932683),
+    TW(-0.7691033376455795, -0.6391244448637758), TW(-0.8624239561110407, 0.506186645345155),
+    TW(0.3383337669655413, -0.9410261750508893), TW(-0.7710605242618136, -0.6367618612362844),
+    TW(-0.8600853904293903, 0.5101500967067666), TW(0.33688985339222005, -0.9415440651830208),
+    TW(-0.773010453362737, -0.6343932841636455), TW(-0.8577286100002721, 0.5141027441932216),
+    TW(0.33544514708453166, -0.9420597397710173), TW(-0.7749531065948738, -0.6320187359398091),
+    TW(-0.8553536647351961, 0.5180445040959992), TW(0.3339996514420095, -0.9425731976014469),
+    TW(-0.7768884656732323, -0.6296382389149272), TW(-0.8529606049303637, 0.5219752929371543),
+    TW(0.3325533698660442, -0.9430844374660935), TW(-0.778816512381476, -0.6272518154951441),
+    TW(-0.8505494812656035, 0.5258950274710846), TW(0.33110630575987643, -0.9435934581619604),
+    TW(-0.7807372285720945, -0.6248594881423863), TW(-0.8481203448032972, 0.5298036246862946),
+    TW(0.32965846252858755, -0.9441002584912727), TW(-0.7826505961665756, -0.6224612793741501),
+    TW(-0.8456732469872991, 0.533701001807153), TW(0.32820984357909266, -0.9446048372614803),
+    TW(-0.784556597155575, -0.6200572117632894), TW(-0.8432082396418454, 0.5375870762956455),
+    TW(0.3267604523201318, -0.9451071932852606), TW(-0.7864552135990858, -0.6176473079378039),
+    TW(-0.8407253749704582, 0.5414617658531232), TW(0.325310292162263, -0.9456073253805213),
+    TW(-0.7883464276266062, -0.6152315905806269), TW(-0.8382247055548382, 0.5453249884220461),
+    TW(0.32385936651785296, -0.9461052323704033), TW(-0.7902302214373099, -0.6128100824294098),
+    TW(-0.8357062843537527, 0.5491766621877195), TW(0.32240767880107, -0.9466009130832835),
+    TW(-0.7921065773002122, -0.6103828062763097), TW(-0.8331701647019133, 0.5530167055800274),
+    TW(0.3209552324278752, -0.9470943663527772), TW(-0.7939754775543372, -0.6079497849677736),
+    TW(-0.8306164003088464, 0.5568450372751599), TW(0.31950203081601575, -0.9475855910177411),
+    TW(-0.7958369046088835, -0.6055110414043257), TW(-0.8280450452577558, 0.5606615761973359),
+    TW(0.31804807738501506, -0.9480745859222762), TW(-0.7976908409433909, -0.6030665985403484),
+    TW(-0.8254561540043776, 0.5644662415205194), TW(0.31659337555616585, -0.9485613499157303),
+    TW(-0.7995372691079051, -0.6006164793838689), TW(-0.8228497813758264, 0.5682589526701315),
+    TW(0.31513792875252244, -0.9490458818527006), TW(-0.8013761717231402, -0.5981607069963424),
+    TW(-0.8202259825694347, 0.572039629324757), TW(0.3136817403988916, -0.9495281805930367),
+    TW(-0.8032075314806448, -0.5956993044924335), TW(-0.8175848131515837, 0.5758081914178453),
+    TW(0.31222481392182505, -0.950008245001843), TW(-0.8050313311429634, -0.5932322950398),
+    TW(-0.8149263290565266, 0.5795645591394057), TW(0.3107671527496115, -0.9504860739494817),
+    TW(-0.8068475535437993, -0.5907597018588742), TW(-0.8122505865852039, 0.5833086529376984),
+    TW(0.3093087603122688, -0.9509616663115751), TW(-0.808656181588175, -0.5882815482226453),
+    TW(-0.8095576424040515, 0.5870403935209177), TW(0.307849640041535, -0.9514350209690083),
+    TW(-0.8104571982525947, -0.585797857456439), TW(-0.8068475535437994, 0.5907597018588739),
+    TW(0.3063897953708611, -0.9519061368079322), TW(-0.8122505865852038, -0.5833086529376985),
+    TW(-0.8041203773982659, 0.5944664991846642), TW(0.30492922973540243, -0.9523750127197659),
+    TW(-0.8140363297059484, -0.5808139580957645), TW(-0.8013761717231404, 0.5981607069963422),
+    TW(0.30346794657201137, -0.9528416476011987), TW(-0.8158144108067337, -0.5783137964116557),
+    TW(-0.7986149946347609, 0.6018422470585799), TW(0.3020059493192282, -0.9533060403541938),
+    TW(-0.8175848131515836, -0.5758081914178454), TW(-0.7958369046088836, 0.6055110414043254),
+    TW(0.3005432414172734, -0.9537681898859903), TW(-0.819347520076797, -0.5732971666980421),
+    TW(-0.7930419604794438, 0.6091670123364531), TW(0.2990798263080405, -0.9542280951091057),
+    TW(-0.8211025149911046, -0.5707807458869673), TW(-0.7902302214373101, 0.6128100824294097),
+    TW(0.2976157074350863, -0.9546857549413383), TW(-0.8228497813758262, -0.5682589526701317),
+    TW(-0.7874017470290314, 0.6164401745308536), TW(0.29615088824362396, -0.9551411683057707),
+    TW(-0.8245893027850251, -0.5657318107836135), TW(-0.7845565971555752, 0.6200572117632892),
+    TW(0.2946853721805143, -0.9555943341307711), TW(-0.8263210628456635, -0.5631993440138341),
+    TW(-0.7816948320710594, 0.6236611175256946), TW(0.2932191626942587, -0.9560452513499964),
+    TW(-0.8280450452577557, -0.5606615761973361), TW(-0.7788165123814762, 0.6272518154951439),
+    TW(0.2917522632349894, -0.956493918902395), TW(-0.8297612337945229, -0.5581185312205563),
+    TW(-0.7759216990434078, 0.6308292296284242), TW(0.29028467725446233, -0.9569403357322089),
+    TW(-0.8314696123025453, -0.5555702330196022), TW(-0.7730104533627371, 0.6343932841636453),
+    TW(0.2888164082060495, -0.9573845007889759), TW(-0.8331701647019132, -0.5530167055800276),
+    TW(-0.7700828369933481, 0.6379439036218439), TW(0.28734745954472957, -0.9578264130275329),
+    TW(-0.83486287498638, -0.5504579729366049), TW(-0.7671389119358205, 0.641481012808583),
+    TW(0.2858778347270807, -0.9582660714080177), TW(-0.8365477272235119, -0.5478940591731004),
+    TW(-0.7641787405361168, 0.6450045368155438), TW(0.2844075372112718, -0.9587034748958716),
+    TW(-0.8382247055548381, -0.5453249884220464), TW(-0.7612023854842619, 0.6485144010221123),
+    TW(0.2829365704570554, -0.9591386224618419), TW(-0.8398937941959995, -0.5427507848645159),
+    TW(-0.7582099098130153, 0.6520105310969595), TW(0.28146493792575805, -0.9595715130819845),
+    TW(-0.8415549774368983, -0.540171472729893), TW(-0.7552013768965365, 0.6554928529996153),
+    TW(0.2799926430802734, -0.9600021457376658), TW(-0.8432082396418453, -0.5375870762956457),
+    TW(-0.7521768504490427, 0.6589612929820373), TW(0.27851968938505306, -0.9604305194155658),
+    TW(-0.8448535652497071, -0.5349976198870972), TW(-0.7491363945234593, 0.6624157775901718),
+    TW(0.27704608030609995, -0.9608566331076797), TW(-0.846490938774052, -0.532403127877198),
+    TW(-0.746080073510064, 0.6658562336655094), TW(0.27557181931095825, -0.9612804858113206),
+    TW(-0.8481203448032971, -0.5298036246862948), TW(-0.7430079521351219, 0.6692825883466358),
+    TW(0.27409690986870633, -0.9617020765291225), TW(-0.8497417680008525, -0.5271991347819013),
+    TW(-0.7399200954595163, 0.6726947690707727), TW(0.272621355449949, -0.9621214042690416),
+    TW(-0.8513551931052652, -0.524589682678469), TW(-0.73681656887737, 0.6760927035753158),
+    TW(0.27114515952680807, -0.9625384680443592), TW(-0.8529606049303636, -0.5219752929371545),
+    TW(-0.7336974381146604, 0.6794763198993649), TW(0.2696683255729152, -0.9629532668736839),
+    TW(-0.8545579883654004, -0.5193559901655898), TW(-0.7305627692278277, 0.682845546385248),
+    TW(0.2681908570634032, -0.963365799780954), TW(-0.8561473283751945, -0.5167317990176498),
+    TW(-0.7274126286023759, 0.6862003116800385), TW(0.2667127574748984, -0.9637760657954398),
+    TW(-0.857728610000272, -0.5141027441932218), TW(-0.724247082951467, 0.6895405447370668),
+    TW(0.2652340302855119, -0.9641840639517457), TW(-0.8593018183570084, -0.5114688504379705),
+    TW(-0.7210661993145081, 0.6928661748174246), TW(0.2637546789748315, -0.9645897932898126),
+    TW(-0.8608669386377671, -0.5088301425431073), TW(-0.7178700450557317, 0.696177131491463),
+    TW(0.2622747070239136, -0.9649932528549203), TW(-0.8624239561110405, -0.5061866453451552),
+    TW(-0.714658687862769, 0.6994733446402839), TW(0.26079411791527557, -0.9653944416976894),
+    TW(-0.8639728561215867, -0.5035383837257177), TW(-0.7114321957452167, 0.7027547444572251),
+    TW(0.25931291513288635, -0.9657933588740836), TW(-0.865513624090569, -0.5008853826112409),
+    TW(-0.7081906370331955, 0.7060212614493395), TW(0.25783110216215893, -0.9661900034454126),
+    TW(-0.8670462455156928, -0.49822766697278176), TW(-0.7049340803759051, 0.7092728264388655),
+    TW(0.2563486824899429, -0.9665843744783331), TW(-0.8685707059713409, -0.49556526182577254),
+    TW(-0.7016625947401687, 0.7125093705646922), TW(0.2548656596045146, -0.9669764710448521),
+    TW(-0.8700869911087113, -0.49289819222978415), TW(-0.698376249408973, 0.7157308252838185),
+    TW(0.25338203699557027, -0.9673662922223285), TW(-0.8715950866559509, -0.4902264832882914),
+    TW(-0.695075113980001, 0.7189371223728044), TW(0.2518978181542169, -0.9677538370934755),
+    TW(-0.8730949784182901, -0.4875501601484359), TW(-0.6917592583641579, 0.7221281939292152),
+    TW(0.2504130065729653, -0.9681391047463623), TW(-0.8745866522781761, -0.4848692480007911),
+    TW(-0.6884287527840905, 0.7253039723730607), TW(0.24892760574572026, -0.9685220942744173),
+    TW(-0.8760700941954065, -0.4821837720791229), TW(-0.6850836677727004, 0.7284643904482252),
+    TW(0.24744161916777344, -0.9689028047764289), TW(-0.8775452902072611, -0.4794937576601533),
+    TW(-0.6817240741716498, 0.7316093812238925), TW(0.2459550503357946, -0.9692812353565485),
+    TW(-0.8790122264286335, -0.4767992300633221), TW(-0.6783500431298615, 0.7347388780959635),
+    TW(0.2444679027478242, -0.9696573851242924), TW(-0.8804708890521608, -0.4741002146505501),
+    TW(-0.6749616461020123, 0.7378528147884658), TW(0.24298017990326398, -0.970031253194544),
+    TW(-0.8819212643483549, -0.47139673682599786), TW(-0.6715589548470187, 0.7409511253549589),
+    TW(0.2414918853028693, -0.9704028386875555), TW(-0.8833633386657317, -0.46868882203582785),
+    TW(-0.6681420414265187, 0.7440337441799291), TW(0.2400030224487415, -0.9707721407289504),
+    TW(-0.8847970984309378, -0.4659764957679662), TW(-0.664710978203345, 0.74710060598018),
+    TW(0.2385135948443185, -0.9711391584497251), TW(-0.8862225301488805, -0.4632597835518603),
+    TW(-0.6612658378399924, 0.750151645806215), TW(0.23702360599436734, -0.9715038909862518),
+    TW(-0.8876396204028538, -0.4605387109582402), TW(-0.6578066932970787, 0.7531867990436124),
+    TW(0.23553305940497546, -0.9718663374802794), TW(-0.8890483558546646, -0.4578133035988772),
+    TW(-0.6543336178318007, 0.7562060014143944), TW(0.23404195858354346, -0.9722264970789363),
+    TW(-0.8904487232447579, -0.4550835871263439), TW(-0.650846684996381, 0.759209188978388),
+    TW(0.23255030703877533, -0.9725843689347322), TW(-0.8918407093923426, -0.45234958723377106),
+    TW(-0.6473459686365125, 0.7621962981345786), TW(0.23105810828067128, -0.9729399522055601),
+    TW(-0.8932243011955152, -0.4496113296546069), TW(-0.6438315428897915, 0.765167265622459),
+    TW(0.22956536582051887, -0.9732932460546982), TW(-0.8945994856313827, -0.44686884016237416),
+    TW(-0.640303482184152, 0.7681220285233651), TW(0.2280720831708858, -0.9736442496508119),
+    TW(-0.8959662497561851, -0.4441221445704293), TW(-0.6367618612362842, 0.7710605242618138),
+    TW(0.2265782638456101, -0.9739929621679558), TW(-0.8973245807054182, -0.4413712687317169),
+    TW(-0.6332067550500575, 0.7739826906068226), TW(0.22508391135979278, -0.9743393827855759),
+    TW(-0.8986744656939539, -0.43861623853852755), TW(-0.6296382389149269, 0.7768884656732326),
+    TW(0.22358902922979002, -0.9746835106885107), TW(-0.9000158920161602, -0.43585707992225553),
+    TW(-0.6260563884043437, 0.7797777879230143), TW(0.2220936209732036, -0.9750253450669941),
+    TW(-0.9013488470460219, -0.43309381885315207), TW(-0.6224612793741497, 0.7826505961665758),
+    TW(0.22059769010887365, -0.9753648851166569), TW(-0.9026733182372587, -0.4303264813400829),
+    TW(-0.6188529879609764, 0.7855068295640538), TW(0.21910124015686977, -0.9757021300385286),
+    TW(-0.9039892931234433, -0.42755509343028203), TW(-0.6152315905806273, 0.7883464276266059),
+    TW(0.21760427463848367, -0.976037079039039), TW(-0.9052967593181187, -0.42477968120910886),
+    TW(-0.611597163926462, 0.7911693302176901), TW(0.2161067970762196, -0.9763697313300211),
+    TW(-0.9065957045149153, -0.42200027079979985), TW(-0.6079497849677741, 0.7939754775543368),
+    TW(0.21460881099378692, -0.9767000861287118), TW(-0.907886116487666, -0.41921688836322424),
+    TW(-0.6042895309481561, 0.7967648102084187), TW(0.21311031991609136, -0.9770281426577544),
+    TW(-0.9091679830905224, -0.41642956009763715), TW(-0.6006164793838693, 0.7995372691079048),
+    TW(0.2116113273692276, -0.9773539001452), TW(-0.9104412922580671, -0.4136383122384346),
+    TW(-0.5969307080621964, 0.8022927955381157), TW(0.21011183688046972, -0.9776773578245099),
+    TW(-0.9117060320054298, -0.41084317105790413), TW(-0.5932322950398001, 0.8050313311429634),
+    TW(0.20861185197826346, -0.9779985149345571), TW(-0.9129621904283982, -0.4080441628649786),
+    TW(-0.5895213186410638, 0.8077528179261905), TW(0.20711137619221856, -0.9783173707196277),
+    TW(-0.9142097557035307, -0.4052413140049899), TW(-0.5857978574564391, 0.8104571982525947),
+    TW(0.20561041305309932, -0.9786339244294231), TW(-0.9154487160882677, -0.4024346508594186),
+    TW(-0.5820619903407753, 0.8131444148492537), TW(0.204108966092817, -0.9789481753190622),
+    TW(-0.9166790599210426, -0.39962419984564707), TW(-0.5783137964116557, 0.8158144108067337),
+    TW(0.2026070388444211, -0.979260122649082), TW(-0.9179007756213905, -0.39680998741671025),
+    TW(-0.5745533550477163, 0.8184671295802983), TW(0.20110463484209196, -0.9795697656854405),
+    TW(-0.9191138516900578, -0.39399204006104815), TW(-0.5707807458869674, 0.8211025149911046),
+    TW(0.19960175762113105, -0.9798771036995176), TW(-0.9203182767091105, -0.39117038430225404),
+    TW(-0.566996048825109, 0.8237205112273911), TW(0.19809841071795373, -0.9801821359681173),
+    TW(-0.9215140393420418, -0.3883450466988266), TW(-0.5631993440138341, 0.8263210628456634),
+    TW(0.19659459767008022, -0.9804848617734694), TW(-0.9227011283338786, -0.38551605384391885),
+    TW(-0.5593907118591365, 0.8289041147718647), TW(0.19509032201612833, -0.9807852804032304),
+    TW(-0.9238795325112867, -0.3826834323650899), TW(-0.5555702330196022, 0.8314696123025452),
+    TW(0.19358558729580375, -0.9810833911504866), TW(-0.9250492407826775, -0.3798472089240514),
+    TW(-0.5517379884047077, 0.8340175011060179), TW(0.19208039704989238, -0.9813791933137546),
+    TW(-0.9262102421383114, -0.37700741021641815), TW(-0.5478940591731001, 0.8365477272235121),
+    TW(0.1905747548202528, -0.9816726861969831), TW(-0.9273625256504011, -0.37416406297145804),
+    TW(-0.5440385267308842, 0.8390602370703125), TW(0.18906866414980628, -0.9819638691095552),
+    TW(-0.9285060804732155, -0.3713171939518377), TW(-0.5401714727298927, 0.8415549774368986),
+    TW(0.18756212858252974, -0.9822527413662894), TW(-0.9296408958431812, -0.3684668299533726),
+    TW(-0.5362929790659633, 0.8440318954900663), TW(0.18605515166344663, -0.9825393022874412),
+    TW(-0.9307669610789837, -0.3656129978047738), TW(-0.5324031278771985, 0.8464909387740518),
+    TW(0.18454773693861964, -0.9828235511987052), TW(-0.931884265581668, -0.3627557243673973),
+    TW(-0.5285020015422286, 0.8489320552116396), TW(0.18303988795514106, -0.9831054874312163),
+    TW(-0.9329927988347388, -0.35989503653498833), TW(-0.5245896826784694, 0.8513551931052649),
+    TW(0.18153160826112513, -0.9833851103215512), TW(-0.9340925504042588, -0.3570309612334303),
+    TW(-0.5206662541403672, 0.8537603011381114), TW(0.18002290140569951, -0.9836624192117303),
+    TW(-0.9351835099389476, -0.3541635254204904), TW(-0.5167317990176502, 0.8561473283751942),
+    TW(0.1785137709389976, -0.9839374134492189), TW(-0.9362656671702783, -0.3512927560855672),
+    TW(-0.512786400633563, 0.8585162242644429), TW(0.17700422041214886, -0.984210092386929),
+    TW(-0.9373390119125748, -0.3484186802494348), TW(-0.5088301425431073, 0.8608669386377671),
+    TW(0.17549425337727137, -0.9844804553832209), TW(-0.9384035340631082, -0.345541324963989),
+    TW(-0.5048631085312674, 0.8631994217121243), TW(0.17398387338746385, -0.9847485018019042),
+    TW(-0.9394592236021899, -0.34266071731199443), TW(-0.500885382611241, 0.865513624090569),
+    TW(0.17247308399679603, -0.9850142310122398), TW(-0.9405060705932683, -0.339776884406827),
+    TW(-0.49689704902265436, 0.8678094967633033), TW(0.17096188876030136, -0.9852776423889412),
+    TW(-0.9415440651830207, -0.33688985339222033), TW(-0.4928981922297842, 0.8700869911087113),
+    TW(0.16945029123396793, -0.9855387353121761), TW(-0.9425731976014469, -0.3339996514420094),
+    TW(-0.4888888969197637, 0.8723460588943912), TW(0.16793829497473123, -0.9857975091675674),
+    TW(-0.9435934581619604, -0.3311063057598765), TW(-0.4848692480007912, 0.8745866522781761),
+    TW(0.16642590354046422, -0.9860539633461954), TW(-0.9446048372614801, -0.3282098435790927),
+    TW(-0.4808393306003344, 0.8768087238091454), TW(0.1649131204899701, -0.9863080972445987),
+    TW(-0.9456073253805212, -0.32531029216226326), TW(-0.47679923006332214, 0.8790122264286334),
+    TW(0.16339994938297323, -0.9865599102647754), TW(-0.9466009130832835, -0.32240767880106985),
+    TW(-0.4727490319503432, 0.8811971134712219), TW(0.16188639378011188, -0.9868094018141854),
+    TW(-0.9475855910177411, -0.3195020308160158), TW(-0.4686888220358279, 0.8833633386657316),
+    TW(0.1603724572429284, -0.987056571305751), TW(-0.9485613499157303, -0.31659337555616607),
+    TW(-0.46461868630623815, 0.8855108561361997), TW(0.1588581433338614, -0.9873014181578584),
+    TW(-0.9495281805930367, -0.3136817403988914), TW(-0.4605387109582399, 0.887639620402854),
+    TW(0.15734345561623828, -0.9875439417943592), TW(-0.9504860739494817, -0.31076715274961153),
+    TW(-0.4564489823968842, 0.8897495863830727), TW(0.15582839765426532, -0.9877841416445722),
+    TW(-0.9514350209690083, -0.30784964004153503), TW(-0.45234958723377067, 0.8918407093923428),
+    TW(0.15431297301302024, -0.9880220171432835), TW(-0.9523750127197658, -0.30492922973540265),
+    TW(-0.4482406122852201, 0.8939129451452031), TW(0.1527971852584434, -0.9882575677307495),
+    TW(-0.9533060403541939, -0.30200594931922803), TW(-0.44412214457042976, 0.8959662497561849),
+    TW(0.15128103795733025, -0.9884907928526966), TW(-0.9542280951091056, -0.29907982630804053),
+    TW(-0.43999427130963337, 0.8980005797407398), TW(0.14976453467732162, -0.9887216919603238),
+    TW(-0.9551411683057707, -0.296150888243624), TW(-0.435857079922256, 0.90001589201616),
+    TW(0.1482476789868962, -0.988950264510303), TW(-0.9560452513499963, -0.29321916269425896),
+    TW(-0.4317106580250573, 0.9020121439024932), TW(0.14673047445536175, -0.989176509964781),
+    TW(-0.9569403357322088, -0.2902846772544624), TW(-0.4275550934302825, 0.9039892931234431),
+    TW(0.14521292465284752, -0.9894004277913804), TW(-0.9578264130275329, -0.2873474595447296),
+    TW(-0.423390474143796, 0.9059472978072685), TW(0.14369503315029458, -0.9896220174632008),
+    TW(-0.9587034748958715, -0.2844075372112721), TW(-0.4192168883632243, 0.907886116487666),
+    TW(0.142176803519448, -0.9898412784588205), TW(-0.9595715130819845, -0.2814649379257579),
+    TW(-0.4150344244760815, 0.9098057081046523), TW(0.14065823933284924, -0.9900582102622971),
+    TW(-0.9604305194155658, -0.27851968938505317), TW(-0.4108431710579042, 0.9117060320054298),
+    TW(0.13913934416382628, -0.9902728123631691), TW(-0.9612804858113206, -0.2755718193109583),
+    TW(-0.4066432168703688, 0.9135870479452509), TW(0.13762012158648618, -0.990485084256457),
+    TW(-0.9621214042690415, -0.27262135544994925), TW(-0.40243465085941865, 0.9154487160882677),
+    TW(0.1361005751757062, -0.9906950254426646), TW(-0.9629532668736839, -0.2696683255729151),
+    TW(-0.39821756215337417, 0.9172909970083777), TW(0.13458070850712622, -0.99090263542778),
+    TW(-0.9637760657954398, -0.2667127574748985), TW(-0.3939920400610482, 0.9191138516900577),
+    TW(0.13306052515713918, -0.9911079137232768), TW(-0.9645897932898126, -0.26375467897483157),
+    TW(-0.38975817406985697, 0.9209172415291893), TW(0.13154002870288328, -0.9913108598461154),
+    TW(-0.9653944416976893, -0.26079411791527585), TW(-0.3855160538439189, 0.9227011283338785),
+    TW(0.13001922272223335, -0.9915114733187439), TW(-0.9661900034454125, -0.257831102162159),
+    TW(-0.38126576922216276, 0.9244654743252625), TW(0.12849811079379322, -0.9917097536690995),
+    TW(-0.9669764710448521, -0.2548656596045147), TW(-0.3770074102164182, 0.9262102421383114),
+    TW(0.12697669649688598, -0.9919057004306093), TW(-0.9677538370934754, -0.2518978181542172),
+    TW(-0.37274106700951615, 0.9279353948226177), TW(0.1254549834115462, -0.9920993131421918),
+    TW(-0.9685220942744174, -0.2489276057457201), TW(-0.3684668299533722, 0.9296408958431813),
+    TW(0.1239329751185122, -0.9922905913482574), TW(-0.9692812353565484, -0.24595505033579465),
+    TW(-0.36418478956708017, 0.9313267090811803), TW(0.12241067519921628, -0.99247953459871),
+    TW(-0.970031253194544, -0.24298017990326407), TW(-0.35989503653498794, 0.932992798834739),
+    TW(0.12088808723577722, -0.992666142448948), TW(-0.9707721407289502, -0.24000302244874178),
+    TW(-0.3555976617047841, 0.9346391298196807), TW(0.11936521481099135, -0.9928504144598651),
+    TW(-0.9715038909862518, -0.23702360599436717), TW(-0.35129275608556687, 0.9362656671702784),
+    TW(0.11784206150832502, -0.9930323501978514), TW(-0.9722264970789363, -0.2340419585835435),
+    TW(-0.3469804108459238, 0.9378723764399898), TW(0.11631863091190488, -0.9932119492347945),
+    TW(-0.9729399522055601, -0.23105810828067133), TW(-0.3426607173119949, 0.9394592236021897),
+    TW(0.11479492660651025, -0.9933892111480807), TW(-0.9736442496508119, -0.22807208317088606),
+    TW(-0.33833376696554124, 0.9410261750508893), TW(0.11327095217756436, -0.9935641355205953),
+    TW(-0.9743393827855759, -0.22508391135979283), TW(-0.3339996514420098, 0.9425731976014468),
+    TW(0.11174671121112666, -0.9937367219407246), TW(-0.9750253450669941, -0.22209362097320365),
+    TW(-0.3296584625285875, 0.9441002584912727), TW(0.11022220729388318, -0.9939069700023561),
+    TW(-0.9757021300385285, -0.21910124015687005), TW(-0.3253102921622633, 0.9456073253805212),
+    TW(0.10869744401313867, -0.9940748793048794), TW(-0.9763697313300211, -0.21610679707621944),
+    TW(-0.32095523242787516, 0.9470943663527772), TW(0.10717242495680887, -0.9942404494531879),
+    TW(-0.9770281426577544, -0.21311031991609142), TW(-0.3165933755561662, 0.9485613499157302),
+    TW(0.1056471537134107, -0.9944036800576791), TW(-0.9776773578245099, -0.2101118368804698),
+    TW(-0.3122248139218248, 0.9500082450018431), TW(0.10412163387205473, -0.9945645707342554),
+    TW(-0.9783173707196275, -0.20711137619221884), TW(-0.3078496400415351, 0.9514350209690083),
+    TW(0.10259586902243628, -0.9947231211043257), TW(-0.9789481753190622, -0.20410896609281684),
+    TW(-0.30346794657201104, 0.9528416476011987), TW(0.10106986275482788, -0.9948793307948056),
+    TW(-0.9795697656854405, -0.201104634842092), TW(-0.2990798263080406, 0.9542280951091056),
+    TW(0.09954361866006944, -0.9950331994381186), TW(-0.9801821359681173, -0.1980984107179538),
+    TW(-0.2946853721805149, 0.9555943341307709), TW(0.09801714032956077, -0.9951847266721968),
+    TW(-0.9807852804032304, -0.1950903220161286), TW(-0.29028467725446244, 0.9569403357322088),
+    TW(0.0964904313552526, -0.9953339121404823), TW(-0.9813791933137546, -0.19208039704989247),
+    TW(-0.28587783472708106, 0.9582660714080176), TW(0.09496349532963906, -0.9954807554919269),
+    TW(-0.9819638691095552, -0.18906866414980636), TW(-0.28146493792575794, 0.9595715130819845),
+    TW(0.09343633584574791, -0.9956252563809943), TW(-0.9825393022874412, -0.1860551516634469),
+    TW(-0.2770460803061003, 0.9608566331076795), TW(0.0919089564971327, -0.9957674144676598),
+    TW(-0.9831054874312163, -0.1830398879551409), TW(-0.27262135544994887, 0.9621214042690416),
+    TW(0.09038136087786501, -0.9959072294174117), TW(-0.9836624192117303, -0.18002290140569957),
+    TW(-0.2681908570634035, 0.9633657997809539), TW(0.08885355258252468, -0.996044700901252),
+    TW(-0.984210092386929, -0.17700422041214894), TW(-0.26375467897483124, 0.9645897932898128),
+    TW(0.08732553520619223, -0.9961798285956969), TW(-0.9847485018019042, -0.17398387338746413),
+    TW(-0.25931291513288646, 0.9657933588740836), TW(0.08579731234443988, -0.996312612182778),
+    TW(-0.9852776423889412, -0.17096188876030122), TW(-0.25486565960451435, 0.9669764710448522),
+    TW(0.08426888759332413, -0.9964430513500426), TW(-0.9857975091675674, -0.16793829497473128),
+    TW(-0.2504130065729654, 0.9681391047463623), TW(0.0827402645493758, -0.9965711457905548),
+    TW(-0.9863080972445986, -0.16491312048997014), TW(-0.24595505033579515, 0.9692812353565483),
+    TW(0.08121144680959239, -0.9966968952028961), TW(-0.9868094018141855, -0.16188639378011174),
+    TW(-0.2414918853028694, 0.9704028386875555), TW(0.07968243797143013, -0.9968202992911657),
+    TW(-0.9873014181578584, -0.15885814333386147), TW(-0.23702360599436767, 0.9715038909862517),
+    TW(0.07815324163279432, -0.9969413577649822), TW(-0.9877841416445722, -0.15582839765426537),
+    TW(-0.23255030703877522, 0.9725843689347322), TW(0.07662386139203162, -0.997060070339483),
+    TW(-0.9882575677307495, -0.15279718525844369), TW(-0.22807208317088612, 0.9736442496508119),
+    TW(0.07509430084792129, -0.9971764367353262), TW(-0.9887216919603238, -0.14976453467732145),
+    TW(-0.2235890292297899, 0.9746835106885107), TW(0.07356456359966745, -0.9972904566786902),
+    TW(-0.989176509964781, -0.1467304744553618), TW(-0.2191012401568701, 0.9757021300385285),
+    TW(0.07203465324688942, -0.9974021299012753), TW(-0.9896220174632008, -0.14369503315029464),
+    TW(-0.21460881099378662, 0.9767000861287118), TW(0.07050457338961401, -0.9975114561403035),
+    TW(-0.990058210262297, -0.14065823933284954), TW(-0.21011183688046986, 0.9776773578245099),
+    TW(0.06897432762826673, -0.9976184351385196), TW(-0.9904850842564571, -0.13762012158648604),
+    TW(-0.20561041305309902, 0.9786339244294232), TW(0.0674439195636641, -0.9977230666441916),
+    TW(-0.99090263542778, -0.13458070850712628), TW(-0.20110463484209207, 0.9795697656854405),
+    TW(0.06591335279700393, -0.9978253504111116), TW(-0.9913108598461154, -0.13154002870288334),
+    TW(-0.19659459767008078, 0.9804848617734693), TW(0.06438263092985741, -0.997925286198596),
+    TW(-0.9917097536690995, -0.12849811079379309), TW(-0.19208039704989252, 0.9813791933137546),
+    TW(0.06285175756416142, -0.9980228737714862), TW(-0.9920993131421918, -0.12545498341154626),
+    TW(-0.18756212858253007, 0.9822527413662894), TW(0.06132073630220865, -0.9981181129001492),
+    TW(-0.99247953459871, -0.12241067519921635), TW(-0.18303988795514095, 0.9831054874312163),
+    TW(0.05978957074664001, -0.9982110033604782), TW(-0.9928504144598651, -0.11936521481099163),
+    TW(-0.17851377093899792, 0.9839374134492188), TW(0.05825826450043573, -0.9983015449338929),
+    TW(-0.9932119492347945, -0.11631863091190471), TW(-0.17398387338746374, 0.9847485018019042),
+    TW(0.05672682116690778, -0.9983897374073402), TW(-0.9935641355205953, -0.11327095217756442),
+    TW(-0.1694502912339683, 0.9855387353121761), TW(0.05519524434969003, -0.9984755805732948),
+    TW(-0.9939069700023561, -0.11022220729388324), TW(-0.16491312048996976, 0.9863080972445987),
+    TW(0.05366353765273068, -0.9985590742297593), TW(-0.9942404494531879, -0.10717242495680916),
+    TW(-0.1603724572429285, 0.987056571305751), TW(0.05213170468028332, -0.9986402181802653),
+    TW(-0.9945645707342554, -0.10412163387205457), TW(-0.15582839765426498, 0.9877841416445722),
+    TW(0.05059974903689934, -0.9987190122338729), TW(-0.9948793307948056, -0.10106986275482793),
+    TW(-0.1512810379573304, 0.9884907928526966), TW(0.049067674327418126, -0.9987954562051724),
+    TW(-0.9951847266721968, -0.09801714032956083), TW(-0.1467304744553623, 0.9891765099647809),
+    TW(0.04753548415695926, -0.9988695499142836), TW(-0.9954807554919269, -0.09496349532963891),
+    TW(-0.14217680351944814, 0.9898412784588205), TW(0.046003182130914644, -0.9989412931868569),
+    TW(-0.9957674144676598, -0.09190895649713275), TW(-0.13762012158648654, 0.990485084256457),
+    TW(0.044470771854938744, -0.9990106858540734), TW(-0.996044700901252, -0.08885355258252475),
+    TW(-0.13306052515713906, 0.9911079137232769), TW(0.04293825693494096, -0.9990777277526454),
+    TW(-0.996312612182778, -0.08579731234444016), TW(-0.12849811079379359, 0.9917097536690995),
+    TW(0.04140564097707671, -0.9991424187248169), TW(-0.9965711457905548, -0.08274026454937564),
+    TW(-0.12393297511851209, 0.9922905913482574), TW(0.039872927587739845, -0.9992047586183639),
+    TW(-0.9968202992911657, -0.0796824379714302), TW(-0.11936521481099169, 0.9928504144598651),
+    TW(0.03834012037355279, -0.9992647472865944), TW(-0.997060070339483, -0.07662386139203169),
+    TW(-0.11479492660650993, 0.9933892111480807), TW(0.03680722294135899, -0.9993223845883495),
+    TW(-0.9972904566786902, -0.07356456359966773), TW(-0.11022220729388331, 0.9939069700023561),
+    TW(0.03527423889821395, -0.9993776703880028), TW(-0.9975114561403035, -0.07050457338961386),
+    TW(-0.10564715371341038, 0.9944036800576791), TW(0.03374117185137764, -0.9994306045554617),
+    TW(-0.9977230666441916, -0.06744391956366418), TW(-0.10106986275482799, 0.9948793307948056),
+    TW(0.032208025408304704, -0.999481186966167), TW(-0.997925286198596, -0.0643826309298577),
+    TW(-0.09649043135525316, 0.9953339121404822), TW(0.03067480317663658, -0.9995294175010931),
+    TW(-0.9981181129001492, -0.06132073630220849), TW(-0.09190895649713282, 0.9957674144676598),
+    TW(0.02914150876419374, -0.9995752960467492), TW(-0.9983015449338929, -0.058258264500435794),
+    TW(-0.08732553520619256, 0.9961798285956969), TW(0.02760814577896582, -0.9996188224951786),
+    TW(-0.9984755805732948, -0.055195244349690094), TW(-0.0827402645493757, 0.9965711457905548),
+    TW(0.02607471782910404, -0.9996599967439592), TW(-0.9986402181802652, -0.052131704680283594),
+    TW(-0.07815324163279465, 0.996941357764982), TW(0.024541228522912264, -0.9996988186962042),
+    TW(-0.9987954562051724, -0.049067674327417966), TW(-0.07356456359966736, 0.9972904566786902),
+    TW(0.02300768146883941, -0.9997352882605617), TW(-0.9989412931868569, -0.046003182130914706),
+    TW(-0.06897432762826708, 0.9976184351385196), TW(0.021474080275469605, -0.9997694053512153),
+    TW(-0.9990777277526454, -0.04293825693494102), TW(-0.06438263092985731, 0.997925286198596),
+    TW(0.019940428551514598, -0.9998011698878843), TW(-0.9992047586183639, -0.03987292758774013),
+    TW(-0.05978957074664013, 0.9982110033604782), TW(0.01840672990580482, -0.9998305817958234),
+    TW(-0.9993223845883495, -0.03680722294135883), TW(-0.05519524434968971, 0.9984755805732948),
+    TW(0.016872987947281773, -0.9998576410058239), TW(-0.9994306045554617, -0.033741171851377705),
+    TW(-0.050599749036899455, 0.9987190122338729), TW(0.01533920628498822, -0.9998823474542126),
+    TW(-0.9995294175010931, -0.030674803176636865), TW(-0.046003182130915206, 0.9989412931868569),
+    TW(0.013805388528060349, -0.9999047010828529), TW(-0.9996188224951786, -0.02760814577896566),
+    TW(-0.04140564097707684, 0.9991424187248169), TW(0.012271538285719944, -0.9999247018391445),
+    TW(-0.9996988186962042, -0.024541228522912326), TW(-0.03680722294135933, 0.9993223845883494),
+    TW(0.010737659167264572, -0.9999423496760239), TW(-0.9997694053512153, -0.021474080275469667),
+    TW(-0.0322080254083046, 0.999481186966167), TW(0.00920375478205996, -0.9999576445519639),
+    TW(-0.9998305817958234, -0.0184067299058051), TW(-0.027608145778966163, 0.9996188224951786),
+    TW(0.007669828739531077, -0.9999705864309741), TW(-0.9998823474542126, -0.01533920628498806),
+    TW(-0.02300768146883931, 0.9997352882605617), TW(0.006135884649154515, -0.9999811752826011),
+    TW(-0.9999247018391445, -0.012271538285720007), TW(-0.018406729905805164, 0.9998305817958234),
+    TW(0.004601926120448672, -0.9999894110819284), TW(-0.9999576445519639, -0.00920375478206002),
+    TW(-0.01380538852806025, 0.9999047010828529), TW(0.003067956762966138, -0.9999952938095762),
+    TW(-0.9999811752826011, -0.006135884649154799), TW(-0.009203754782060083, 0.9999576445519639),
+    TW(0.0015339801862847662, -0.9999988234517019), TW(-0.9999952938095762, -0.003067956762965977),
+    TW(-0.00460192612044835, 0.9999894110819284),
+};
+#endif
+
+static const fft_table_entry fft_table_entries[] = {
+    {128, 24, swaps_128, window_128, STAGE_TW(stage_twiddles_128)},
+    {256, 108, swaps_256, window_256, STAGE_TW(stage_twiddles_256)},
+    {512, 120, swaps_512, window_512, STAGE_TW(stage_twiddles_512)},
+    {1024, 452, swaps_1024, window_1024, STAGE_TW(stage_twiddles_1024)},
+    {2048, 480, swaps_2048, window_2048, STAGE_TW(stage_twiddles_2048)},
+    {4096, 1860, swaps_4096, window_4096, STAGE_TW(stage_twiddles_4096)},
+    {8192, 2016, swaps_8192, window_8192, STAGE_TW(stage_twiddles_8192)},
+};
+
+// returns the tables for a real FFT size, or NULL if the size has none
+const fft_table_entry *fft_table_find(int nfft)
+{
+    int i;
+    for (i = 0; i < (int)(sizeof(fft_table_entries)/sizeof(fft_table_entries[0])); i++) {
+        if (fft_table_entries[i].nfft == nfft)
+            return &fft_table_entries[i];
+    }
+    return NULL;
+}
+
+// forward real FFT config that points at the flash tables
+kiss_fftr_cfg fft_table_fftr_alloc(int nfft, void *mem, size_t *lenmem)
+{
+    const fft_table_entry *t = fft_table_find(nfft);
+    if (t == NULL)
+        return NULL;
+    return kiss_fftr_alloc_tables(nfft, fft_twiddles, FFT_TABLE_MAX_NFFT/2,
+                                  fft_super_twiddles, FFT_TABLE_MAX_NFFT,
+                                  t->swaps, t->nswaps, t->stage_twiddles, mem, lenmem);
+}
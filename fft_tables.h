@@ -0,0 +1,47 @@
+/*
+ * fft_tables.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Precomputed FFT tables in flash (generated by tools/gen_fft_tables.py, do not edit)
+ */
+
+#ifndef FFT_TABLES_H_
+#define FFT_TABLES_H_
+
+#include <stdint.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+
+#define FFT_TABLE_MIN_NFFT 128   // smallest real FFT size with tables
+#define FFT_TABLE_MAX_NFFT 8192  // largest real FFT size with tables
+
+#ifdef FIXED_POINT
+typedef int16_t fft_window_t;   // Q15 window coefficient
+#else
+typedef float fft_window_t;     // window coefficient
+#endif
+
+// tables for one real FFT size
+typedef struct {
+    int nfft;                       // real FFT size
+    int nswaps;                     // number of swap pairs of the nfft/2-point complex FFT permutation
+    const kiss_fft_index *swaps;    // swap pairs
+    const fft_window_t *window;     // first half of the symmetric Blackman window, w[nfft-1-i] = w[i]
+    const kiss_fft_cpx *stage_twiddles; // packed per-stage twiddles (KISS_FFT_STAGE_TWIDDLES builds), else NULL
+} fft_table_entry;
+
+// exp(-2*pi*i*k/(FFT_TABLE_MAX_NFFT/2)): twiddles of every complex sub-FFT, indexed with a stride
+extern const kiss_fft_cpx fft_twiddles[FFT_TABLE_MAX_NFFT/2];
+
+// -j*exp(-2*pi*i*(k+1)/FFT_TABLE_MAX_NFFT): real FFT split twiddles, indexed with a stride
+extern const kiss_fft_cpx fft_super_twiddles[FFT_TABLE_MAX_NFFT/4];
+
+// returns the tables for a real FFT size, or NULL if the size has none
+const fft_table_entry *fft_table_find(int nfft);
+
+// forward real FFT config that points at the flash tables, mem needs KISS_FFTR_CFG_TABLES_BYTES
+kiss_fftr_cfg fft_table_fftr_alloc(int nfft, void *mem, size_t *lenmem);
+
+#endif /* FFT_TABLES_H_ */
@@ -18,22 +18,38 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
  fixed or floating point complex numbers.  It also delares the kf_ internal functions.
  */
 
+#ifdef KISS_FFT_STAGE_TWIDDLES
+/* twiddle q of the current butterfly is stw[q-1], the next one starts p-1 entries later */
+# define TW_START(q,p) (stw + (q) - 1)
+# define TW_STEP(q,p) ((p) - 1)
+/* the radix-2/4 butterflies take their twiddles from stw alone */
+# define TW_UNUSED() ((void)fstride, (void)st)
+#else
+/* twiddle q of butterfly u is twiddles[q*u*fstride] */
+# define TW_START(q,p) (st->twiddles)
+# define TW_STEP(q,p) (fstride*(q))
+# define TW_UNUSED() ((void)stw)
+#endif
+
+#ifndef KISS_FFT_SIMD_DSP /* the packed DSP butterflies replace the scalar radix-2/4 ones */
 static void kf_bfly2(
         kiss_fft_cpx * Fout,
         const size_t fstride,
         const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
         int m
         )
 {
     kiss_fft_cpx * Fout2;
-    kiss_fft_cpx * tw1 = st->twiddles;
+    const kiss_fft_cpx * tw1 = TW_START(1,2);
     kiss_fft_cpx t;
+    TW_UNUSED();
     Fout2 = Fout + m;
     do{
         C_FIXDIV(*Fout,2); C_FIXDIV(*Fout2,2);
 
         C_MUL (t,  *Fout2 , *tw1);
-        tw1 += fstride;
+        tw1 += TW_STEP(1,2);
         C_SUB( *Fout2 ,  *Fout , t );
         C_ADDTO( *Fout ,  t );
         ++Fout2;
@@ -45,17 +61,21 @@ static void kf_bfly4(
         kiss_fft_cpx * Fout,
         const size_t fstride,
         const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
         const size_t m
         )
 {
-    kiss_fft_cpx *tw1,*tw2,*tw3;
+    const kiss_fft_cpx *tw1,*tw2,*tw3;
     kiss_fft_cpx scratch[6];
     size_t k=m;
     const size_t m2=2*m;
     const size_t m3=3*m;
 
 
-    tw3 = tw2 = tw1 = st->twiddles;
+    tw1 = TW_START(1,4);
+    tw2 = TW_START(2,4);
+    tw3 = TW_START(3,4);
+    TW_UNUSED();
 
     do {
         C_FIXDIV(*Fout,4); C_FIXDIV(Fout[m],4); C_FIXDIV(Fout[m2],4); C_FIXDIV(Fout[m3],4);
@@ -69,9 +89,9 @@ static void kf_bfly4(
         C_ADD( scratch[3] , scratch[0] , scratch[2] );
         C_SUB( scratch[4] , scratch[0] , scratch[2] );
         C_SUB( Fout[m2], *Fout, scratch[3] );
-        tw1 += fstride;
-        tw2 += fstride*2;
-        tw3 += fstride*3;
+        tw1 += TW_STEP(1,4);
+        tw2 += TW_STEP(2,4);
+        tw3 += TW_STEP(3,4);
         C_ADDTO( *Fout , scratch[3] );
 
         if(st->inverse) {
@@ -89,21 +109,26 @@ static void kf_bfly4(
     }while(--k);
 }
 
+#endif
+
 static void kf_bfly3(
          kiss_fft_cpx * Fout,
          const size_t fstride,
          const kiss_fft_cfg st,
+         const kiss_fft_cpx * stw,
          size_t m
          )
 {
      size_t k=m;
      const size_t m2 = 2*m;
-     kiss_fft_cpx *tw1,*tw2;
+     const kiss_fft_cpx *tw1,*tw2;
      kiss_fft_cpx scratch[5];
      kiss_fft_cpx epi3;
      epi3 = st->twiddles[fstride*m];
 
-     tw1=tw2=st->twiddles;
+     tw1=TW_START(1,3);
+     tw2=TW_START(2,3);
+     TW_UNUSED();
 
      do{
          C_FIXDIV(*Fout,3); C_FIXDIV(Fout[m],3); C_FIXDIV(Fout[m2],3);
@@ -113,8 +138,8 @@ static void kf_bfly3(
 
          C_ADD(scratch[3],scratch[1],scratch[2]);
          C_SUB(scratch[0],scratch[1],scratch[2]);
-         tw1 += fstride;
-         tw2 += fstride*2;
+         tw1 += TW_STEP(1,3);
+         tw2 += TW_STEP(2,3);
 
          Fout[m].r = Fout->r - HALF_OF(scratch[3].r);
          Fout[m].i = Fout->i - HALF_OF(scratch[3].i);
@@ -137,14 +162,15 @@ static void kf_bfly5(
         kiss_fft_cpx * Fout,
         const size_t fstride,
         const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
         int m
         )
 {
     kiss_fft_cpx *Fout0,*Fout1,*Fout2,*Fout3,*Fout4;
     int u;
     kiss_fft_cpx scratch[13];
-    kiss_fft_cpx * twiddles = st->twiddles;
-    kiss_fft_cpx *tw;
+    const kiss_fft_cpx * twiddles = st->twiddles;
+    const kiss_fft_cpx *tw1,*tw2,*tw3,*tw4;
     kiss_fft_cpx ya,yb;
     ya = twiddles[fstride*m];
     yb = twiddles[fstride*2*m];
@@ -155,15 +181,23 @@ static void kf_bfly5(
     Fout3=Fout0+3*m;
     Fout4=Fout0+4*m;
 
-    tw=st->twiddles;
+    tw1=TW_START(1,5);
+    tw2=TW_START(2,5);
+    tw3=TW_START(3,5);
+    tw4=TW_START(4,5);
+    TW_UNUSED();
     for ( u=0; u<m; ++u ) {
         C_FIXDIV( *Fout0,5); C_FIXDIV( *Fout1,5); C_FIXDIV( *Fout2,5); C_FIXDIV( *Fout3,5); C_FIXDIV( *Fout4,5);
         scratch[0] = *Fout0;
 
-        C_MUL(scratch[1] ,*Fout1, tw[u*fstride]);
-        C_MUL(scratch[2] ,*Fout2, tw[2*u*fstride]);
-        C_MUL(scratch[3] ,*Fout3, tw[3*u*fstride]);
-        C_MUL(scratch[4] ,*Fout4, tw[4*u*fstride]);
+        C_MUL(scratch[1] ,*Fout1, *tw1);
+        C_MUL(scratch[2] ,*Fout2, *tw2);
+        C_MUL(scratch[3] ,*Fout3, *tw3);
+        C_MUL(scratch[4] ,*Fout4, *tw4);
+        tw1 += TW_STEP(1,5);
+        tw2 += TW_STEP(2,5);
+        tw3 += TW_STEP(3,5);
+        tw4 += TW_STEP(4,5);
 
         C_ADD( scratch[7],scratch[1],scratch[4]);
         C_SUB( scratch[10],scratch[1],scratch[4]);
@@ -204,9 +238,9 @@ static void kf_bfly_generic(
         )
 {
     int u,k,q1,q;
-    kiss_fft_cpx * twiddles = st->twiddles;
+    const kiss_fft_cpx * twiddles = st->twiddles;
     kiss_fft_cpx t;
-    int Norig = st->nfft;
+    int Norig = st->nfft * st->twiddle_stride; /* length of the twiddle table fstride indexes */
 
     kiss_fft_cpx * scratch = (kiss_fft_cpx*)KISS_FFT_TMP_ALLOC(sizeof(kiss_fft_cpx)*p);
 
@@ -234,70 +268,118 @@ static void kf_bfly_generic(
     KISS_FFT_TMP_FREE(scratch);
 }
 
+/* vectorized radix-2/4 butterflies (KISS_FFT_SIMD_SSE, _AVX or _DSP), else the scalar ones */
+#include "_kiss_fft_simd.h"
+#ifndef KF_BFLY2
+# define KF_BFLY2 kf_bfly2
+# define KF_BFLY4 kf_bfly4
+#endif
+
+/* apply the input permutation in place as a sequence of swaps */
 static
-void kf_work(
+void kf_permute(
         kiss_fft_cpx * Fout,
-        const kiss_fft_cpx * f,
-        const size_t fstride,
-        int in_stride,
-        int * factors,
         const kiss_fft_cfg st
         )
 {
-    kiss_fft_cpx * Fout_beg=Fout;
-    const int p=*factors++; /* the radix  */
-    const int m=*factors++; /* stage's fft length/p */
-    const kiss_fft_cpx * Fout_end = Fout + p*m;
-
-#ifdef _OPENMP
-    // use openmp extensions at the 
-    // top-level (not recursive)
-    if (fstride==1 && p<=5)
-    {
-        int k;
+    const kiss_fft_index * swaps = st->swaps;
+    int k;
+    for (k=0;k<st->nswaps;++k) {
+        kiss_fft_cpx t = Fout[swaps[0]];
+        Fout[swaps[0]] = Fout[swaps[1]];
+        Fout[swaps[1]] = t;
+        swaps += 2;
+    }
+}
 
-        // execute the p different work units in different threads
-#       pragma omp parallel for
-        for (k=0;k<p;++k) 
-            kf_work( Fout +k*m, f+ fstride*in_stride*k,fstride*p,in_stride,factors,st);
-        // all threads have joined by this point
-
-        switch (p) {
-            case 2: kf_bfly2(Fout,fstride,st,m); break;
-            case 3: kf_bfly3(Fout,fstride,st,m); break; 
-            case 4: kf_bfly4(Fout,fstride,st,m); break;
-            case 5: kf_bfly5(Fout,fstride,st,m); break; 
-            default: kf_bfly_generic(Fout,fstride,st,m,p); break;
-        }
-        return;
+#ifdef KISS_FFT_STAGE_TWIDDLES
+/* number of packed stage twiddles of a radix p stage (the generic butterfly uses the full table) */
+static
+int kf_stage_twiddle_count(int p,int m)
+{
+    return (p >= 2 && p <= 5) ? (p-1)*m : 0;
+}
+
+/*
+ * Copies the twiddles each radix 2-5 stage reads into one packed table per
+ * stage, in the order kf_work_inplace runs the stages (innermost first), so
+ * the butterflies read them sequentially.  The values are copied, not
+ * recomputed, so the output is identical to the strided layout.
+ */
+static
+void kf_build_stage_twiddles(const kiss_fft_cfg st,kiss_fft_cpx * stw)
+{
+    const int * factors = st->factors;
+    int nstages = 0;
+    int s,u,q;
+
+    while (factors[2*nstages+1] > 1)
+        ++nstages;
+
+    for (s=nstages;s>=0;--s) {
+        const int p = factors[2*s];
+        const int m = factors[2*s+1];
+        const size_t fstride = (st->nfft / (p*m)) * st->twiddle_stride;
+
+        if (kf_stage_twiddle_count(p,m) == 0)
+            continue;
+        for (u=0;u<m;++u)
+            for (q=1;q<p;++q)
+                *stw++ = st->twiddles[q*u*fstride];
     }
+}
 #endif
 
-    if (m==1) {
-        do{
-            *Fout = *f;
-            f += fstride*in_stride;
-        }while(++Fout != Fout_end );
-    }else{
-        do{
-            // recursive call:
-            // DFT of size m*p performed by doing
-            // p instances of smaller DFTs of size m, 
-            // each one takes a decimated version of the input
-            kf_work( Fout , f, fstride*p, in_stride, factors,st);
-            f += fstride*in_stride;
-        }while( (Fout += m) != Fout_end );
-    }
+/*
+ * Iterative, in-place replacement for the recursive kf_work.
+ *
+ * The input must already be permuted into the order the recursion leaves it
+ * in at the leaves (kf_permute).  The stages are then combined from the
+ * innermost factor outwards, calling each butterfly on every block of p*m
+ * points with the same fstride the recursion would have used, so the
+ * arithmetic, and therefore the output, is identical to the recursive version.
+ * The outer outermost stages are skipped (0 runs the whole transform).
+ */
+static
+void kf_work_inplace(
+        kiss_fft_cpx * Fout,
+        const kiss_fft_cfg st,
+        int outer
+        )
+{
+    const int * factors = st->factors;
+    int nstages = 0;
+    int s;
+#ifdef KISS_FFT_STAGE_TWIDDLES
+    const kiss_fft_cpx * stw = st->stage_twiddles;
+#else
+    const kiss_fft_cpx * stw = NULL;
+#endif
+
+    while (factors[2*nstages+1] > 1)
+        ++nstages;
 
-    Fout=Fout_beg;
+    for (s=nstages;s>=outer;--s) {
+        const int p = factors[2*s];     /* the radix  */
+        const int m = factors[2*s+1];   /* stage's fft length/p */
+        const size_t nblocks = st->nfft / (p*m);
+        const size_t fstride = nblocks * st->twiddle_stride; /* twiddle step for this stage */
+        kiss_fft_cpx * F = Fout;
+        size_t b;
 
-    // recombine the p smaller DFTs 
-    switch (p) {
-        case 2: kf_bfly2(Fout,fstride,st,m); break;
-        case 3: kf_bfly3(Fout,fstride,st,m); break; 
-        case 4: kf_bfly4(Fout,fstride,st,m); break;
-        case 5: kf_bfly5(Fout,fstride,st,m); break; 
-        default: kf_bfly_generic(Fout,fstride,st,m,p); break;
+        for (b=0;b<nblocks;++b) {
+            switch (p) {
+                case 2: KF_BFLY2(F,fstride,st,stw,m); break;
+                case 3: kf_bfly3(F,fstride,st,stw,m); break;
+                case 4: KF_BFLY4(F,fstride,st,stw,m); break;
+                case 5: kf_bfly5(F,fstride,st,stw,m); break;
+                default: kf_bfly_generic(F,fstride,st,m,p); break;
+            }
+            F += p*m;
+        }
+#ifdef KISS_FFT_STAGE_TWIDDLES
+        stw += kf_stage_twiddle_count(p,m);
+#endif
     }
 }
 
@@ -329,6 +411,46 @@ void kf_factor(int n,int * facbuf)
     } while (n > 1);
 }
 
+/*
+ * Builds the list of swaps that puts the input in the order the recursive
+ * decomposition reads it: output slot j = q0*m0 + q1*m1 + ... holds input
+ * q0 + q1*p0 + q2*p0*p1 + ...  Each cycle of that permutation becomes a chain
+ * of swaps along the cycle.  src must hold nfft indices of scratch.
+ * Returns the number of swap pairs written to swaps (at most nfft-1).
+ */
+static
+int kf_build_swaps(int nfft,const int * factors,kiss_fft_index * src,kiss_fft_index * swaps)
+{
+    int j,nswaps=0;
+
+    for (j=0;j<nfft;++j) {
+        const int * f = factors;
+        int rem = j, idx = 0, scale = 1;
+        do {
+            const int p = *f++;
+            const int m = *f++;
+            idx += (rem / m) * scale;
+            rem %= m;
+            scale *= p;
+        } while (scale < nfft);
+        src[j] = (kiss_fft_index)idx;
+    }
+
+    for (j=0;j<nfft;++j) {
+        int cur = j;
+        while (src[cur] != j && src[cur] != cur) {
+            const int next = src[cur];
+            *swaps++ = (kiss_fft_index)cur;
+            *swaps++ = (kiss_fft_index)next;
+            ++nswaps;
+            src[cur] = (kiss_fft_index)cur; /* mark as placed */
+            cur = next;
+        }
+        src[cur] = (kiss_fft_index)cur;
+    }
+    return nswaps;
+}
+
 /*
  *
  * User-callable function to allocate all necessary storage space for the fft.
@@ -339,8 +461,10 @@ void kf_factor(int n,int * facbuf)
 kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem )
 {
     kiss_fft_cfg st=NULL;
-    size_t memneeded = sizeof(struct kiss_fft_state)
-        + sizeof(kiss_fft_cpx)*(nfft-1); /* twiddle factors*/
+    size_t memneeded = KISS_FFT_CFG_BYTES(nfft); /* twiddle factors and input permutation */
+
+    if (nfft > KISS_FFT_MAX_NFFT)
+        return NULL;
 
     if ( lenmem==NULL ) {
         st = ( kiss_fft_cfg)KISS_FFT_MALLOC( memneeded );
@@ -351,35 +475,101 @@ kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem
     }
     if (st) {
         int i;
+        kiss_fft_cpx * twiddles = (kiss_fft_cpx*)(st + 1);
+        kiss_fft_index * swaps = (kiss_fft_index*)((char*)(twiddles + nfft) + KISS_FFT_STAGE_TWIDDLE_BYTES(nfft));
+
         st->nfft=nfft;
         st->inverse = inverse_fft;
+        st->twiddles = twiddles;
+        st->twiddle_stride = 1;
+        st->codelet = NULL;
+        st->swaps = swaps;
+
+        kf_factor(nfft,st->factors);
+        /* the twiddle area is free until the twiddles are computed; use it as permutation scratch */
+        st->nswaps = kf_build_swaps(nfft,st->factors,(kiss_fft_index*)twiddles,swaps);
 
         for (i=0;i<nfft;++i) {
             const double pi=3.141592653589793238462643383279502884197169399375105820974944;
             double phase = -2*pi*i / nfft;
             if (st->inverse)
                 phase *= -1;
-            kf_cexp(st->twiddles+i, phase );
+            kf_cexp(twiddles+i, phase );
         }
+#ifdef KISS_FFT_STAGE_TWIDDLES
+        st->stage_twiddles = twiddles + nfft;
+        kf_build_stage_twiddles(st,twiddles + nfft);
+#endif
+    }
+    return st;
+}
+
+
+kiss_fft_cfg kiss_fft_alloc_tables(int nfft,const kiss_fft_cpx * twiddles,int twiddle_nfft,
+                                   const kiss_fft_index * swaps,int nswaps,
+                                   const kiss_fft_cpx * stage_twiddles,void * mem,size_t * lenmem)
+{
+    kiss_fft_cfg st=NULL;
+    size_t memneeded = KISS_FFT_CFG_TABLES_BYTES;
+
+    if (twiddle_nfft % nfft)
+        return NULL;            /* the table must contain every nfft-th root of unity */
+#ifdef KISS_FFT_STAGE_TWIDDLES
+    if (stage_twiddles == NULL)
+        return NULL;            /* the butterflies only read the packed tables */
+#else
+    (void)stage_twiddles;
+#endif
 
+    if ( lenmem==NULL ) {
+        st = ( kiss_fft_cfg)KISS_FFT_MALLOC( memneeded );
+    }else{
+        if (mem != NULL && *lenmem >= memneeded)
+            st = (kiss_fft_cfg)mem;
+        *lenmem = memneeded;
+    }
+    if (st) {
+        st->nfft=nfft;
+        st->inverse = 0;
+        st->twiddles = twiddles;
+        st->twiddle_stride = twiddle_nfft / nfft;
+        st->codelet = NULL;
+        st->swaps = swaps;
+        st->nswaps = nswaps;
+#ifdef KISS_FFT_STAGE_TWIDDLES
+        st->stage_twiddles = stage_twiddles;
+#endif
         kf_factor(nfft,st->factors);
     }
     return st;
 }
 
-
 void kiss_fft_stride(kiss_fft_cfg st,const kiss_fft_cpx *fin,kiss_fft_cpx *fout,int in_stride)
 {
-    if (fin == fout) {
-        //NOTE: this is not really an in-place FFT algorithm.
-        //It just performs an out-of-place FFT into a temp buffer
-        kiss_fft_cpx * tmpbuf = (kiss_fft_cpx*)KISS_FFT_TMP_ALLOC( sizeof(kiss_fft_cpx)*st->nfft);
-        kf_work(tmpbuf,fin,1,in_stride, st->factors,st);
-        memcpy(fout,tmpbuf,sizeof(kiss_fft_cpx)*st->nfft);
-        KISS_FFT_TMP_FREE(tmpbuf);
-    }else{
-        kf_work( fout, fin, 1,in_stride, st->factors,st );
+    /* gather the (strided) input into fout, then transform in place.
+       Ascending order never overwrites an input that is still to be read, so fin == fout is fine. */
+    if (fin != fout || in_stride != 1) {
+        int k;
+        for (k=0;k<st->nfft;++k)
+            fout[k] = fin[k*in_stride];
     }
+    kf_permute(fout,st);
+    if (st->codelet)
+        st->codelet(fout);
+    else
+        kf_work_inplace(fout,st,0);
+}
+
+void kiss_fft_set_codelet(kiss_fft_cfg st,kiss_fft_codelet codelet)
+{
+    if (!st->inverse)
+        st->codelet = codelet;
+}
+
+void kiss_fft_partial(kiss_fft_cfg st,kiss_fft_cpx *buf,int outer_stages)
+{
+    kf_permute(buf,st);
+    kf_work_inplace(buf,st,outer_stages);
 }
 
 void kiss_fft(kiss_fft_cfg cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout)
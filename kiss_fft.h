@@ -55,6 +55,15 @@ typedef struct {
 
 typedef struct kiss_fft_state* kiss_fft_cfg;
 
+/* butterfly stages of one fixed-size forward transform, run in place on the permuted input */
+typedef void (*kiss_fft_codelet)(kiss_fft_cpx *buf);
+
+/* index type of the input permutation; limits nfft to KISS_FFT_MAX_NFFT */
+#ifndef kiss_fft_index
+# define kiss_fft_index unsigned short
+# define KISS_FFT_MAX_NFFT 65536
+#endif
+
 /* 
  *  kiss_fft_alloc
  *  
@@ -80,6 +89,32 @@ typedef struct kiss_fft_state* kiss_fft_cfg;
 
 kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem); 
 
+/*
+ * kiss_fft_alloc_tables
+ *
+ * Like kiss_fft_alloc (forward only), but points the cfg at precomputed
+ * (e.g. const, in flash) tables instead of computing and copying them.
+ * twiddles holds the twiddle_nfft-th roots of unity, exp(-2*pi*i*k/twiddle_nfft),
+ * where twiddle_nfft is a multiple of nfft.  swaps/nswaps must be the input
+ * permutation kiss_fft_alloc would build for nfft.  stage_twiddles is the
+ * packed per-stage table of a KISS_FFT_STAGE_TWIDDLES build (NULL otherwise,
+ * and the call fails if it is NULL in such a build).
+ * Only the state itself is placed in mem.
+ * */
+kiss_fft_cfg kiss_fft_alloc_tables(int nfft,const kiss_fft_cpx * twiddles,int twiddle_nfft,
+                                   const kiss_fft_index * swaps,int nswaps,
+                                   const kiss_fft_cpx * stage_twiddles,void * mem,size_t * lenmem);
+
+/*
+ * kiss_fft_set_codelet
+ *
+ * Makes kiss_fft/kiss_fft_stride run codelet instead of the generic
+ * butterfly stages, after the input permutation.  codelet must compute
+ * exactly cfg's transform (e.g. the generated fft_codelets); NULL restores
+ * the generic stages.  Ignored for inverse cfgs.
+ * */
+void kiss_fft_set_codelet(kiss_fft_cfg cfg,kiss_fft_codelet codelet);
+
 /*
  * kiss_fft(cfg,in_out_buf)
  *
@@ -89,6 +124,8 @@ kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem)
  * fout will be   F[0] , F[1] , ... ,F[nfft-1]
  * Note that each element is complex and can be accessed like
     f[k].r and f[k].i
+ * fin may equal fout; the transform is then computed in place
+ * without a temporary buffer.
  * */
 void kiss_fft(kiss_fft_cfg cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout);
 
@@ -97,6 +134,17 @@ void kiss_fft(kiss_fft_cfg cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout);
  * */
 void kiss_fft_stride(kiss_fft_cfg cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout,int fin_stride);
 
+/*
+ * kiss_fft_partial(cfg,buf,outer_stages)
+ *
+ * Runs the in-place transform of buf without its outer_stages outermost
+ * stages.  With P the product of the first outer_stages factors, buf is left
+ * holding P contiguous nfft/P-point FFTs, each of a decimated subsequence
+ * f[r], f[r+P], f[r+2P], ...  (r is the mixed-radix digit reversal of the
+ * block index).  Used to compute only some outputs (transform decomposition).
+ * */
+void kiss_fft_partial(kiss_fft_cfg cfg,kiss_fft_cpx *buf,int outer_stages);
+
 /* If kiss_fft_alloc allocated a buffer, it is one contiguous 
    buffer and can be simply free()d when no longer needed*/
 #define kiss_fft_free free
@@ -0,0 +1,66 @@
+#ifndef KISS_FTR_H
+#define KISS_FTR_H
+
+#include "kiss_fft.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    
+/* 
+ 
+ Real optimized version can save about 45% cpu time vs. complex fft of a real seq.
+
+ 
+ 
+ */
+
+typedef struct kiss_fftr_state *kiss_fftr_cfg;
+
+
+kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem, size_t * lenmem);
+/*
+ nfft must be even
+
+ If you don't care to allocate space, use mem = lenmem = NULL 
+*/
+
+
+/*
+ kiss_fftr_alloc_tables
+
+ Forward-only cfg that points at precomputed (e.g. const, in flash) tables
+ instead of computing them:
+   twiddles       exp(-2*pi*i*k/twiddle_nfft), twiddle_nfft a multiple of nfft/2
+   super_twiddles -j*exp(-2*pi*i*(k+1)/super_nfft), super_nfft a multiple of nfft
+   swaps/nswaps   the input permutation of the nfft/2-point complex fft
+   stage_twiddles packed per-stage twiddles of the complex fft
+                  (KISS_FFT_STAGE_TWIDDLES builds only, else NULL)
+ Only the two small state structs are placed in mem.
+*/
+kiss_fftr_cfg kiss_fftr_alloc_tables(int nfft,const kiss_fft_cpx * twiddles,int twiddle_nfft,
+                                     const kiss_fft_cpx * super_twiddles,int super_nfft,
+                                     const kiss_fft_index * swaps,int nswaps,
+                                     const kiss_fft_cpx * stage_twiddles,void * mem,size_t * lenmem);
+
+
+void kiss_fftr(kiss_fftr_cfg cfg,const kiss_fft_scalar *timedata,kiss_fft_cpx *freqdata);
+/*
+ input timedata has nfft scalar points
+ output freqdata has nfft/2+1 complex points
+ timedata may point at freqdata for an in-place transform
+*/
+
+void kiss_fftri(kiss_fftr_cfg cfg,const kiss_fft_cpx *freqdata,kiss_fft_scalar *timedata);
+/*
+ input freqdata has  nfft/2+1 complex points
+ output timedata has nfft scalar points
+ timedata may point at freqdata for an in-place transform
+*/
+
+#define kiss_fftr_free free
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 #include "driverlib/sysctl.h"
 #include "driverlib/interrupt.h"
@@ -33,8 +34,17 @@
 #include "Crystalfontz128x128_ST7735.h"
 #include "sysctl_pll.h"
 #include "peripherals.h"
-
-#define PWM_FREQUENCY 20000 // PWM frequency = 20 kHz
+#include "spectrum.h"
+#include "zoom.h"
+#include "welch.h"
+#include "tracker.h"
+#include "waterfall.h"
+#include "analysis.h"
+#include "counter.h"
+#include "markers.h"
+#include "trigger.h"
+
+#define WATERFALL_TOP 14 // first LCD row of the waterfall, below the top line of labels
 
 // clock globals
 uint32_t gSystemClock = 120000000; // [Hz] system clock frequency
@@ -43,6 +53,16 @@ uint32_t gSystemClock = 120000000; // [Hz] system clock frequency
 tContext sContext;
 const char * const gVoltageScaleStr[] = {"100mV", "200mV", "500mV", "1V", "2V"};
 const char * const gTriggerSlopeStr[] = {"Rising", "Falling"};
+const char * const gTriggerModeStr[] = {"Auto", "Normal", "Single"};
+
+// waterfall globals
+extern waterfall gWaterfall; // spectrum history, filled by the processing task
+
+// measurement globals
+extern analysis_result gAnalysis; // distortion and noise of the last live spectrum, filled by the processing task
+extern counter_result gCounter;   // frequency counter reading of the last live spectrum, filled by the processing task
+extern marker_set gMarkers;       // markers and peak table of the last live spectrum, filled by the processing task
+extern trigger_stream gTrigger;   // trigger comparator, stopped after a single mode frame
 
 // CPU load globals
 uint32_t countUnloaded = 0;    // CPU count unloaded
@@ -52,6 +72,20 @@ float cpuLoad = 0.0;           // CPU load value
 // initialize signal source
 void signalInit(void);
 
+// formats x with 1 to 3 decimals, without floating-point printf
+static void formatDecimal(char *str, int size, float x, int decimals)
+{
+    static const long scale[] = {1, 10, 100, 1000};
+    float magnitude = fabsf(x);
+    long whole = (long)magnitude;
+    long frac = lroundf((magnitude - whole)*scale[decimals]); // the fraction alone keeps its precision
+    if (frac >= scale[decimals]) {
+        whole++;
+        frac -= scale[decimals];
+    }
+    snprintf(str, size, "%s%ld.%0*ld", x < 0 && (whole || frac) ? "-" : "", whole, decimals, frac);
+}
+
 // main function
 int main(void)
 {
@@ -86,6 +120,13 @@ void displayTask_func(UArg arg1, UArg arg2)
     char tscale_str[50];   // time string buffer for time scale
     char vscale_str[50];   // time string buffer for voltage scale
     char tslope_str[50];   // time string buffer for trigger edge
+    char rbw_str[50];      // string buffer for resolution bandwidth
+    char zoom_str[50];     // string buffer for zoom center and factor
+    char welch_str[50];    // string buffer for averaging overlap and real-time status
+    char harm_str[50];     // string buffer for the tracked PWM harmonics
+    char meas_str[50];     // string buffer for the distortion measurement
+    char num_str[2][12];   // numbers of one measurement line
+    marker_set markers;    // markers of the displayed spectrum
 
     while(true){
         Semaphore_pend(semDisplay, BIOS_WAIT_FOREVER);  // from user input
@@ -103,47 +144,203 @@ void displayTask_func(UArg arg1, UArg arg2)
         GrRectFill(&sContext, &rectFullScreen);         // fill screen with black
         GrContextForegroundSet(&sContext, ClrWhite);    // yellow text
 
-        // draw grid in blue
-        GrContextForegroundSet(&sContext, ClrBlue); // yellow text
         int i;
-        for (i = 1; i < 128; i+=21){
-            GrLineDraw(&sContext, i, 0, i, 128);
-            GrLineDraw(&sContext, 0, i, 128, i);
-        }
-
-        // draw center grid lines in dark blue
-        GrContextForegroundSet(&sContext, ClrDarkBlue); // blue
-        if (spectrumMode){
-            GrLineDraw(&sContext, 0, 22, 128, 22);
+        bool waterfall = spectrumMode && stateWaterfall; // waterfall instead of the grid and trace
+        if (waterfall) {
+            // copy the color-mapped history into the frame buffer, newest spectrum at the top
+            Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+            waterfall_blit(&gWaterfall, &Lcd_buffer[WATERFALL_TOP], WATERFALL_ROWS);
+            Semaphore_post(sem_cs);
         } else {
-            GrLineDraw(&sContext, 64, 0, 64, 128);
-            GrLineDraw(&sContext, 0, 64, 128, 64);
+            // draw grid in blue
+            GrContextForegroundSet(&sContext, ClrBlue); // yellow text
+            for (i = 1; i < 128; i+=21){
+                GrLineDraw(&sContext, i, 0, i, 128);
+                GrLineDraw(&sContext, 0, i, 128, i);
+            }
+
+            // draw center grid lines in dark blue
+            GrContextForegroundSet(&sContext, ClrDarkBlue); // blue
+            if (spectrumMode){
+                GrLineDraw(&sContext, 0, 22, 128, 22);
+            } else {
+                GrLineDraw(&sContext, 64, 0, 64, 128);
+                GrLineDraw(&sContext, 0, 64, 128, 64);
+            }
+
+            // draw waveform
+            GrContextForegroundSet(&sContext, ClrYellow); // yellow text
+            int x;
+            int y_old;
+            Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+            for (x = 0; x < LCD_HORIZONTAL_MAX - 1; x++) {
+                if (x!=0)
+                    GrLineDraw(&sContext, x-1, y_old, x, processedWaveform[x]);
+                y_old = processedWaveform[x];
+            }
+            markers = gMarkers;
+            int marker_y = markers.marker.k >= 0 ? processedWaveform[markers.marker.col] : 0;
+            int ref_y = markers.ref.k >= 0 ? processedWaveform[markers.ref.col] : 0;
+
+            Semaphore_post(sem_cs);
+
+            // markers on the trace, the delta reference in red
+            if (spectrumMode && stateMarkers) {
+                if (markers.ref.k >= 0) {
+                    GrContextForegroundSet(&sContext, ClrRed);
+                    GrCircleDraw(&sContext, markers.ref.col, ref_y, 2);
+                }
+                if (markers.marker.k >= 0) {
+                    GrContextForegroundSet(&sContext, ClrWhite);
+                    GrCircleDraw(&sContext, markers.marker.col, marker_y, 2);
+                }
+            }
         }
 
-        // draw waveform
-        GrContextForegroundSet(&sContext, ClrYellow); // yellow text
-        int x;
-        int y_old;
-        Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
-        for (x = 0; x < LCD_HORIZONTAL_MAX - 1; x++) {
-            if (x!=0)
-                GrLineDraw(&sContext, x-1, y_old, x, processedWaveform[x]);
-            y_old = processedWaveform[x];
-        }
-
-        Semaphore_post(sem_cs);
-
         // time scale, voltage scale, trigger slope and CPU load
         GrContextForegroundSet(&sContext, ClrWhite); // yellow text
         if (spectrumMode){
-            snprintf(tscale_str, sizeof(tscale_str), "20kHz");  // convert time scale to string
+            spectrum_format_hz(tscale_str, sizeof(tscale_str), gSpectrumHzPerDiv); // convert frequency scale to string
             snprintf(vscale_str, sizeof(vscale_str), "20dB");   // convert vscale to string
+
+            GrStringDraw(&sContext, gWindowNameStr[stateWindow], /*length*/ -1, /*x*/ LCD_HORIZONTAL_MAX/2 + 20, /*y*/ 5, /*opaque*/ false);
+            if (!waterfall) { // the waterfall starts below the first line
+                GrStringDraw(&sContext, gDetectorNameStr[stateDetector], /*length*/ -1, /*x*/ LCD_HORIZONTAL_MAX/2 + 20, /*y*/ 15, /*opaque*/ false);
+                GrStringDraw(&sContext, stateAnalysis ? "Meas" : stateMarkers ? "Mkr" : gTraceNameStr[stateTrace], /*length*/ -1, /*x*/ LCD_HORIZONTAL_MAX/2 + 20, /*y*/ 25, /*opaque*/ false);
+            }
+
+            if (stateTrace == TRACE_LIVE && !stateZoom && !waterfall) {
+                // frequency counter: interpolated FFT peak and amplitude, and the zero-crossing cross-check
+                counter_result count;
+                Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                count = gCounter;
+                Semaphore_post(sem_cs);
+
+                if (count.valid) {
+                    unsigned centivolts = (unsigned)lroundf(count.amplitude*(VIN_RANGE/(1 << ADC_BITS))*100);
+                    formatDecimal(num_str[0], sizeof(num_str[0]), count.fft_hz, 2);
+                    snprintf(meas_str, sizeof(meas_str), "%sHz", num_str[0]);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ 15, /*opaque*/ false);
+                    snprintf(meas_str, sizeof(meas_str), "%u.%02uV", centivolts/100, centivolts%100);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ 25, /*opaque*/ false);
+                }
+                if (count.zc_valid) {
+                    formatDecimal(num_str[0], sizeof(num_str[0]), count.zc_hz, 2);
+                    snprintf(meas_str, sizeof(meas_str), "ZC %sHz", num_str[0]);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ 35, /*opaque*/ false);
+                }
+            }
+
+            spectrum_format_hz(rbw_str, sizeof(rbw_str), gSpectrumRbwHz); // convert resolution bandwidth to string
+            GrStringDraw(&sContext, "RBW", /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 10, /*opaque*/ false);
+            GrStringDraw(&sContext, rbw_str, /*length*/ -1, /*x*/ 31, /*y*/ LCD_VERTICAL_MAX - 10, /*opaque*/ false);
+
+            if (stateZoom) {
+                spectrum_format_hz(zoom_str, sizeof(zoom_str), gZoomCenterHz); // convert zoom center to string
+                GrStringDraw(&sContext, "CF", /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ waterfall);
+                GrStringDraw(&sContext, zoom_str, /*length*/ -1, /*x*/ 31, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ waterfall);
+                snprintf(zoom_str, sizeof(zoom_str), "x%u", (unsigned)(ZOOM_FACTOR_MIN << (stateZoom - 1))); // zoom factor
+                GrStringDraw(&sContext, zoom_str, /*length*/ -1, /*x*/ LCD_HORIZONTAL_MAX/2 + 20, /*y*/ LCD_VERTICAL_MAX - 10, /*opaque*/ false);
+            } else if (stateTrace != TRACE_LIVE) {
+                // segment overlap and whether the averaging keeps up with the ADC
+                int32_t drop = gWelchDropPct;
+                if (drop < 0)
+                    snprintf(welch_str, sizeof(welch_str), "RT ...");
+                else if (drop == 0)
+                    snprintf(welch_str, sizeof(welch_str), "RT ok");
+                else
+                    snprintf(welch_str, sizeof(welch_str), "Drop %d%%", (int)drop);
+                GrStringDraw(&sContext, welch_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ false);
+                snprintf(welch_str, sizeof(welch_str), "Ov %s", gOverlapNameStr[stateOverlap]);
+                GrStringDraw(&sContext, welch_str, /*length*/ -1, /*x*/ LCD_HORIZONTAL_MAX/2 + 20, /*y*/ LCD_VERTICAL_MAX - 10, /*opaque*/ false);
+            } else if (stateAnalysis && !waterfall) {
+                // fundamental, distortion and noise of the live spectrum
+                analysis_result meas;
+                Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                meas = gAnalysis;
+                Semaphore_post(sem_cs);
+
+                if (meas.valid) {
+                    unsigned centivolts = (unsigned)lroundf(meas.amplitude*(VIN_RANGE/(1 << ADC_BITS))*100);
+                    spectrum_format_hz(num_str[0], sizeof(num_str[0]), (uint32_t)lroundf(meas.f0_hz));
+                    snprintf(meas_str, sizeof(meas_str), "F0 %s %u.%02uV", num_str[0], centivolts/100, centivolts%100);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 50, /*opaque*/ false);
+                    formatDecimal(num_str[0], sizeof(num_str[0]), meas.thd_db, 1);
+                    formatDecimal(num_str[1], sizeof(num_str[1]), meas.sfdr_db, 1);
+                    snprintf(meas_str, sizeof(meas_str), "THD %s SFDR %s", num_str[0], num_str[1]);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 40, /*opaque*/ false);
+                    if (meas.noise_valid) {
+                        formatDecimal(num_str[0], sizeof(num_str[0]), meas.snr_db, 1);
+                        formatDecimal(num_str[1], sizeof(num_str[1]), meas.sinad_db, 1);
+                    } else { // noise floor below the FFT's resolution, no noise figures
+                        snprintf(num_str[0], sizeof(num_str[0]), "--");
+                        snprintf(num_str[1], sizeof(num_str[1]), "--");
+                    }
+                    snprintf(meas_str, sizeof(meas_str), "SNR %s SINAD %s", num_str[0], num_str[1]);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 30, /*opaque*/ false);
+                    if (meas.noise_valid)
+                        formatDecimal(num_str[0], sizeof(num_str[0]), meas.enob, 1);
+                    snprintf(meas_str, sizeof(meas_str), "ENOB %s", num_str[0]);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ false);
+                } else {
+                    GrStringDraw(&sContext, "No signal", /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ false);
+                }
+            } else if (stateMarkers && !waterfall) {
+                // strongest peaks, then the marker and its offset from the delta reference
+                for (i = 0; i < markers.npeaks; i++) {
+                    formatDecimal(num_str[0], sizeof(num_str[0]), markers.peaks[i].hz/1000, 1);
+                    formatDecimal(num_str[1], sizeof(num_str[1]), markers.peaks[i].db, 1);
+                    snprintf(meas_str, sizeof(meas_str), "%d %skHz %sdB", i + 1, num_str[0], num_str[1]);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ 45 + 10*i, /*opaque*/ false);
+                }
+                if (markers.marker.k >= 0) {
+                    formatDecimal(num_str[0], sizeof(num_str[0]), markers.marker.hz/1000, 1);
+                    formatDecimal(num_str[1], sizeof(num_str[1]), markers.marker.db, 1);
+                    snprintf(meas_str, sizeof(meas_str), "M %skHz %sdB", num_str[0], num_str[1]);
+                    GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 30, /*opaque*/ false);
+                    if (markers.ref.k >= 0) {
+                        float ddb = markers.marker.db - markers.ref.db;
+                        formatDecimal(num_str[0], sizeof(num_str[0]), (markers.marker.hz - markers.ref.hz)/1000, 1);
+                        formatDecimal(num_str[1], sizeof(num_str[1]), ddb, 1);
+                        snprintf(meas_str, sizeof(meas_str), "D %skHz %s%sdB", num_str[0], ddb >= 0 ? "+" : "", num_str[1]);
+                        GrStringDraw(&sContext, meas_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ false);
+                    }
+                } else {
+                    GrStringDraw(&sContext, "No peak", /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ false);
+                }
+            }
         } else {
             snprintf(tscale_str, sizeof(tscale_str), "20us");                           // convert time scale to string
             snprintf(vscale_str, sizeof(vscale_str), gVoltageScaleStr[stateVperDiv]);   // convert vscale to string
             snprintf(tslope_str, sizeof(tslope_str), gTriggerSlopeStr[risingSlope]);    // convert slope to string
 
             GrStringDraw(&sContext, tslope_str, /*length*/ -1, /*x*/ LCD_HORIZONTAL_MAX/2 + 20, /*y*/ 5, /*opaque*/ false);
+            GrStringDraw(&sContext, stateTriggerMode == TRIGGER_SINGLE && gTrigger.stopped ? "Stop" : gTriggerModeStr[stateTriggerMode],
+                         /*length*/ -1, /*x*/ LCD_HORIZONTAL_MAX/2 + 20, /*y*/ 15, /*opaque*/ false);
+
+            // trigger column and level in red
+            GrContextForegroundSet(&sContext, ClrRed);
+            GrCircleDraw(&sContext, stateTriggerPre, ADC_TRIGGER_SIZE/2, 2);
+            GrContextForegroundSet(&sContext, ClrWhite);
+
+            // peak-to-peak and mean levels of the latest samples, from the ADC block summary
+            formatDecimal(num_str[0], sizeof(num_str[0]), gScopeVpp, 2);
+            formatDecimal(num_str[1], sizeof(num_str[1]), gScopeMean, 2);
+            snprintf(harm_str, sizeof(harm_str), "Vpp %sV Avg %sV", num_str[0], num_str[1]);
+            GrStringDraw(&sContext, harm_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 30, /*opaque*/ false);
+
+            // PWM fundamental amplitude and the harmonics relative to it, from the frequency tracker
+            float fundamental = gHarmonicVolts[0];
+            unsigned centivolts = (unsigned)lroundf(fundamental*100);
+            snprintf(harm_str, sizeof(harm_str), "%ukHz %u.%02uV", (unsigned)(PWM_FREQUENCY/1000), centivolts/100, centivolts%100);
+            GrStringDraw(&sContext, harm_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 20, /*opaque*/ false);
+            int len = 0;
+            for (i = 1; i < HARMONIC_COUNT; i++) {
+                float ratio = fundamental > 0 ? gHarmonicVolts[i]/fundamental : 0;
+                int db = ratio > 1e-5f ? (int)lroundf(20*log10f(ratio)) : -99;
+                len += snprintf(harm_str + len, sizeof(harm_str) - len, "H%d%d ", i + 1, db);
+            }
+            GrStringDraw(&sContext, harm_str, /*length*/ -1, /*x*/ 7, /*y*/ LCD_VERTICAL_MAX - 10, /*opaque*/ false);
         }
 
         GrStringDraw(&sContext, tscale_str, /*length*/ -1, /*x*/ 7, /*y*/ 5, /*opaque*/ false);
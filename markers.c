@@ -0,0 +1,257 @@
+/*
+ * markers.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Spectrum markers: peak search, next peak left/right, a delta marker
+ * and a table of the strongest peaks
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "spectrum.h"
+#include "markers.h"
+
+#define MARKER_FLOOR_PASSES 3   // passes of the clipped mean estimating the noise floor
+#define MARKER_FLOOR_CLIP 10.0f // bins above this many times the last estimate are left out of the next
+
+// |bin k|^2
+static float bin_power(const kiss_fft_cpx *bins, int k)
+{
+    float re = bins[k].r, im = bins[k].i;
+    return re*re + im*im;
+}
+
+// noise floor of the view clear of dc: a mean that leaves out the tones and their skirts pass by pass
+static float noise_floor(const kiss_fft_cpx *bins, const spectrum_view *v, int lobe)
+{
+    float floor = -1; // no clip on the first pass
+    int pass, k;
+
+    for (pass = 0; pass < MARKER_FLOOR_PASSES; pass++) {
+        float sum = 0, clip = floor*MARKER_FLOOR_CLIP;
+        int n = 0;
+        for (k = v->kmin > lobe ? v->kmin : lobe + 1; k <= v->kmax; k++) {
+            float p = bin_power(bins, k);
+            if (floor < 0 || p < clip) {
+                sum += p;
+                n++;
+            }
+        }
+        if (n == 0)
+            break; // keeps the last estimate
+        floor = sum/n;
+    }
+    return floor > 0 ? floor : 0;
+}
+
+// whether bin k is a peak: clear of dc, above the threshold, above its lower neighbour, and the largest within
+// a main-lobe width (2*lobe bins) either side, which also keeps the first sidelobes of a stronger tone out
+static bool is_peak(const kiss_fft_cpx *bins, const spectrum_view *v, int lobe, float threshold, int k)
+{
+    float p = bin_power(bins, k);
+    int lo = k - 2*lobe > v->kmin ? k - 2*lobe : v->kmin;
+    int hi = k + 2*lobe < v->kmax ? k + 2*lobe : v->kmax;
+    int i;
+
+    if (k <= lobe || p <= threshold)
+        return false; // what is left of the offset after the dc removal, or noise
+    if (k > v->kmin && bin_power(bins, k - 1) >= p)
+        return false; // quick reject, most bins are on a slope
+    for (i = lo; i <= hi; i++)
+        if (i != k && (bin_power(bins, i) > p || (i < k && bin_power(bins, i) == p)))
+            return false; // a flat top is one peak, at its lowest bin
+    return true;
+}
+
+// strongest peak of the view, -1 if there is none
+static int peak_search(const kiss_fft_cpx *bins, const spectrum_view *v, int lobe, float threshold)
+{
+    float best = 0;
+    int k, kbest = -1;
+
+    for (k = v->kmin; k <= v->kmax; k++) {
+        float p = bin_power(bins, k);
+        if (p > best && is_peak(bins, v, lobe, threshold, k)) {
+            best = p;
+            kbest = k;
+        }
+    }
+    return kbest;
+}
+
+// nearest peak from bin k in direction dir (+1 or -1), k itself if there is none
+static int peak_next(const kiss_fft_cpx *bins, const spectrum_view *v, int lobe, float threshold, int k, int dir)
+{
+    int i;
+    for (i = k + dir; i >= v->kmin && i <= v->kmax; i += dir)
+        if (is_peak(bins, v, lobe, threshold, i))
+            return i;
+    return k;
+}
+
+// follows the peak near bin k uphill, -1 if no peak is within MARKER_TRACK_STEPS
+static int peak_track(const kiss_fft_cpx *bins, const spectrum_view *v, int lobe, float threshold, int k)
+{
+    int steps;
+
+    if (k < v->kmin || k > v->kmax)
+        return -1;
+    for (steps = 0; steps < MARKER_TRACK_STEPS; steps++) {
+        float p = bin_power(bins, k);
+        if (k > v->kmin && bin_power(bins, k - 1) > p)
+            k--;
+        else if (k < v->kmax && bin_power(bins, k + 1) > p)
+            k++;
+        else
+            break;
+    }
+    return is_peak(bins, v, lobe, threshold, k) ? k : -1; // a local bump of noise is not the peak
+}
+
+// display column of bin k
+static int bin_column(const spectrum_view *v, int k)
+{
+    int lo = 0, hi = v->cols - 1;
+    while (lo < hi) { // last column starting at or before k
+        int mid = (lo + hi + 1)/2;
+        if (v->col_bin[mid] <= k)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// position and level of bin k
+static void point_set(marker_point *pt, const kiss_fft_cpx *bins, const spectrum_view *v, uint32_t fs, float power_scale, int k)
+{
+    float p = bin_power(bins, k)*power_scale;
+    pt->k = k;
+    pt->col = bin_column(v, k);
+    pt->hz = (float)k*fs/v->nfft;
+    pt->db = p > 0 ? 10*log10f(p) : 0;
+}
+
+// restores the heap order from index i down, the weakest peak at the root
+static void heap_down(int *heap, float *power, int n, int i)
+{
+    while (true) {
+        int c = 2*i + 1, j = i; // first child, and the weakest of the three
+        if (c < n && power[c] < power[j])
+            j = c;
+        if (c + 1 < n && power[c + 1] < power[j])
+            j = c + 1;
+        if (j == i)
+            return;
+
+        int k = heap[i];
+        float p = power[i];
+        heap[i] = heap[j];
+        power[i] = power[j];
+        heap[j] = k;
+        power[j] = p;
+        i = j;
+    }
+}
+
+// clears the markers
+void marker_reset(marker_set *m)
+{
+    m->marker.k = -1;
+    m->ref.k = -1;
+    m->npeaks = 0;
+    m->searches = 0;
+    m->floor = -1;
+}
+
+// moves the markers and fills the table
+void marker_update(marker_set *m, marker_command command, const kiss_fft_cpx *bins, const spectrum_view *v,
+                   uint32_t fs, int lobe, float power_scale, bool table)
+{
+    int k = m->marker.k;
+
+    // a following marker reuses the floor of the last frame, a search or the table refresh it
+    if (table || command != MARKER_NONE || m->floor < 0)
+        m->floor = noise_floor(bins, v, lobe);
+    float threshold = m->floor*powf(10, MARKER_THRESHOLD_DB/10.0f);
+
+    switch (command) {
+    case MARKER_PEAK:
+        k = -1;
+        break;
+    case MARKER_LEFT:
+    case MARKER_RIGHT:
+        if (k >= 0)
+            k = peak_next(bins, v, lobe, threshold, k < v->kmin ? v->kmin : k > v->kmax ? v->kmax : k, command == MARKER_RIGHT ? 1 : -1);
+        break;
+    case MARKER_DELTA:
+        if (m->ref.k < 0 && k >= 0) {
+            m->ref = m->marker; // frozen where the marker is now
+        } else {
+            m->ref.k = -1;
+            k = -1;
+        }
+        break;
+    default:
+        break;
+    }
+
+    if (k >= 0)
+        k = peak_track(bins, v, lobe, threshold, k);
+    if (k < 0) {
+        if (!table && command == MARKER_NONE) { // lost: the floor of an earlier frame may be stale
+            m->floor = noise_floor(bins, v, lobe);
+            threshold = m->floor*powf(10, MARKER_THRESHOLD_DB/10.0f);
+        }
+        k = peak_search(bins, v, lobe, threshold);
+        m->searches++;
+    }
+    if (k >= 0)
+        point_set(&m->marker, bins, v, fs, power_scale, k);
+    else
+        m->marker.k = -1;
+
+    if (!table) {
+        m->npeaks = 0;
+        return;
+    }
+
+    // one pass keeping the MARKER_PEAKS strongest peaks in a min-heap, the weakest at the root
+    int heap[MARKER_PEAKS], n = 0, i;
+    float power[MARKER_PEAKS];
+    for (k = v->kmin; k <= v->kmax; k++) {
+        float p = bin_power(bins, k);
+        if ((n == MARKER_PEAKS && p <= power[0]) || !is_peak(bins, v, lobe, threshold, k))
+            continue; // weaker than the whole table, or not a peak
+        if (n < MARKER_PEAKS) { // fill, then heapify once full
+            heap[n] = k;
+            power[n++] = p;
+            if (n == MARKER_PEAKS)
+                for (i = MARKER_PEAKS/2 - 1; i >= 0; i--)
+                    heap_down(heap, power, n, i);
+        } else { // replace the weakest
+            heap[0] = k;
+            power[0] = p;
+            heap_down(heap, power, n, 0);
+        }
+    }
+
+    // strongest first, equal powers by frequency: insertion sort of the few entries
+    for (i = 1; i < n; i++) {
+        int j = i, kk = heap[i];
+        float p = power[i];
+        for (; j > 0 && (power[j - 1] < p || (power[j - 1] == p && heap[j - 1] > kk)); j--) {
+            heap[j] = heap[j - 1];
+            power[j] = power[j - 1];
+        }
+        heap[j] = kk;
+        power[j] = p;
+    }
+    for (i = 0; i < n; i++)
+        point_set(&m->peaks[i], bins, v, fs, power_scale, heap[i]);
+    m->npeaks = n;
+}
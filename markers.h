@@ -0,0 +1,63 @@
+/*
+ * markers.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Spectrum markers: peak search, next peak left/right, a delta marker
+ * and a table of the strongest peaks
+ */
+
+#ifndef MARKERS_H_
+#define MARKERS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "kiss_fft.h"
+#include "spectrum.h"
+
+#define MARKER_PEAKS 5          // peaks in the table
+#define MARKER_TRACK_STEPS 8    // [bins] farthest a marker climbs after its peak before a full search
+#define MARKER_THRESHOLD_DB 10  // [dB] a peak clears the noise floor by this much
+
+// marker operations requested by the user
+typedef enum {
+    MARKER_NONE,    // keep following the peak
+    MARKER_PEAK,    // to the strongest peak
+    MARKER_LEFT,    // to the next peak at a lower frequency
+    MARKER_RIGHT,   // to the next peak at a higher frequency
+    MARKER_DELTA,   // freeze a delta reference at the marker, or drop it and go to the strongest peak
+    MARKER_COMMAND_COUNT
+} marker_command;
+
+// a marker or table position
+typedef struct {
+    int k;          // bin, -1 for none
+    int col;        // display column of the bin
+    float hz;       // [Hz] frequency of the bin
+    float db;       // [dB] level on the display scale, 10*log10(|X|^2) of the windowed ADC counts
+} marker_point;
+
+// markers and peak table of one spectrum
+typedef struct {
+    marker_point marker;                // follows its peak from frame to frame
+    marker_point ref;                   // delta reference, frozen when set, k = -1 when off
+    int npeaks;                         // peaks in the table
+    marker_point peaks[MARKER_PEAKS];   // strongest peaks, strongest first
+    float floor;                        // [|bin|^2] noise floor of the last search or table, < 0 before the first
+    uint32_t searches;                  // full peak searches, e.g. after the followed peak was lost
+} marker_set;
+
+// clears the markers, the next update searches the strongest peak
+void marker_reset(marker_set *m);
+
+// applies command, then moves the marker to its peak in bins v->kmin to v->kmax of an nfft-point real FFT at
+// sampling rate fs: it climbs from the last position, so a peak that stayed put costs a few bins, and only a
+// lost peak costs a full search. a peak is a bin clear of dc that is the largest within 2*lobe bins (the
+// main-lobe width of the window) either side, so one tone is one peak, and MARKER_THRESHOLD_DB above the noise
+// floor, so noise and far sidelobes are not. with table, also fills the peak table in one pass with a bounded heap.
+// power_scale turns |bin|^2 into |DFT of the windowed ADC counts|^2 (1 in the float build)
+void marker_update(marker_set *m, marker_command command, const kiss_fft_cpx *bins, const spectrum_view *v,
+                   uint32_t fs, int lobe, float power_scale, bool table);
+
+#endif /* MARKERS_H_ */
@@ -35,9 +35,12 @@
 #define JOYSTICK_LOWER_RELEASE_THRESHOLD 1000   // above this ADC value, button is released
 
 #define ADC_SAMPLING_RATE 1000000   // [samples/sec] desired ADC sampling rate
+#define PWM_FREQUENCY 20000         // [Hz] PWM test signal frequency
+#define HARMONIC_COUNT 4            // PWM harmonics tracked in oscilloscope mode, fundamental included
 #define CRYSTAL_FREQUENCY 25000000  // [Hz] crystal oscillator frequency used to calculate clock rates
 
-#define ADC_BUFFER_SIZE 2048                                // size must be a power of 2
+#define ADC_BUFFER_SIZE 16384                               // size must be a power of 2, twice the largest FFT length
+#define ADC_SEARCH_SIZE 2048                                // latest samples searched for the trigger and DC level
 #define ADC_TRIGGER_SIZE 128                                // size must be a power of 2
 #define ADC_BUFFER_WRAP(i) ((i) & (ADC_BUFFER_SIZE - 1))    // index wrapping macro
 
@@ -56,8 +59,31 @@ extern volatile int16_t processedWaveform[ADC_TRIGGER_SIZE];
 extern uint32_t gJoystick[2];           // joystick coordinates
 extern uint32_t gADCSamplingRate;       // [Hz] actual ADC sampling rate
 extern volatile bool risingSlope;       // a boolean that determines whether the slope is rising or falling
+extern volatile uint32_t stateTriggerMode; // trigger mode (auto, normal or single)
+extern volatile uint32_t stateTriggerPre; // [samples] before the trigger in a frame, its display column
+extern volatile bool stateTriggerArm;   // take a single mode frame again
 extern volatile bool spectrumMode;      // whether waveform is in spectrum mode or sine mode
 extern volatile uint32_t trigger_value; // equivalent to the ADC offset
+extern volatile uint32_t stateWindow;   // selected FFT window type
+extern const char * const gWindowNameStr[]; // short window names for the display
+extern volatile uint32_t stateSpan;     // displayed span is Nyquist/2^stateSpan
+extern volatile uint32_t stateDetector; // spectrum column detector
+extern volatile uint32_t gSpectrumHzPerDiv; // [Hz] frequency per division of the displayed span
+extern volatile uint32_t stateNfft;     // selected FFT length
+extern volatile uint32_t gSpectrumRbwHz; // [Hz] resolution bandwidth
+extern volatile uint32_t stateZoom;     // zoom factor index, 0 = full span
+extern volatile uint32_t stateZoomCenter; // zoom center frequency in NCO steps
+extern volatile uint32_t gZoomCenterHz; // [Hz] zoom center frequency
+extern volatile uint32_t stateTrace;    // displayed spectrum trace (live, average, max or min hold)
+extern volatile uint32_t stateOverlap;  // overlap of the averaged segments
+extern volatile int32_t gWelchDropPct;  // [%] samples the averaging skipped in the last second, -1 before the first report
+extern volatile float gHarmonicVolts[HARMONIC_COUNT]; // [V] peak amplitude of the PWM fundamental and its harmonics
+extern volatile float gScopeVpp;     // [V] peak-to-peak voltage of the latest ADC_SEARCH_SIZE samples
+extern volatile float gScopeMean;    // [V] mean voltage of the latest ADC_SEARCH_SIZE samples
+extern volatile bool stateWaterfall;    // spectrum shown as a waterfall of past spectra
+extern volatile bool stateAnalysis;     // distortion and noise measured on the live spectrum
+extern volatile bool stateMarkers;      // markers and peak table on the live spectrum
+extern volatile uint32_t stateMarkerCommand; // marker_command for the next live frame
 
 // initialize all button and joystick handling hardware
 void ButtonInit(void);
@@ -78,7 +104,7 @@ uint32_t cpuLoadCount(void);
 // initialize ADC hardware
 void ADC_Init(void);
 
-// initialize all button and joystick handling hardware
+// copy the latest frame the trigger comparator located into trigger_samples
 void triggerSearch(void);
 
 // put data into FIFO data structure
@@ -87,7 +113,10 @@ int fifoPut(char data);
 // get data from FIFO data structure
 int fifoGet(char *data);
 
-// get zero crossing point
+// get zero crossing point, midway between the min and max of the latest samples, and update gScopeVpp and gScopeMean
 uint32_t zeroCrossPoint(void);
 
+// select the FFT window, length, zoom factor index and zoom center
+void spectrumSelect(uint32_t type, uint32_t nfft, uint32_t zoom, uint32_t center);
+
 #endif /* PERIPHERALS_H_ */
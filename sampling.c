@@ -11,6 +11,7 @@
 // XDCtools Header files
 #include <xdc/std.h>
 #include <xdc/runtime/System.h>
+#include <xdc/runtime/Timestamp.h>
 #include <xdc/cfg/global.h>
 
 // BIOS Header files
@@ -39,24 +40,117 @@
 // KISS FFT header files
 #include <math.h>
 #include "kiss_fft.h"
+#include "kiss_fftr.h"
 #include "_kiss_fft_guts.h"
+#include "dsp_math.h"
+#include "fft_tables.h"
+#include "window.h"
+#include "spectrum.h"
+#include "fft_prune.h"
+#include "fft_plan.h"
+#include "zoom.h"
+#include "welch.h"
+#include "tracker.h"
+#include "waterfall.h"
+#include "analysis.h"
+#include "counter.h"
+#include "markers.h"
+#include "adc_block.h"
+#include "adc_summary.h"
+#include "trigger.h"
 
 // KISS FFT constants
-#define PI 3.14159265358979f
-#define NFFT 1024 // FFT length
-#define KISS_FFT_CFG_SIZE (sizeof(struct kiss_fft_state)+sizeof(kiss_fft_cpx)*(NFFT-1))
+#define NFFT_DEFAULT 1024               // FFT length at startup
+#define NFFT_MAX FFT_PLAN_MAX_NFFT      // largest FFT length
+#define NFFT_BINS_MAX (NFFT_MAX/2+1)    // number of unique bins of the largest real-input FFT
+
+#define PIXEL_DB_OFFSET 128 // pixel row of 0 dB
+#define ZOOM_CENTER_DEFAULT 20 // [NCO steps] zoom center at startup, about the 20 kHz PWM test signal
+#define WELCH_MAX_SEGMENTS 16 // most segments averaged per display frame
+#define WELCH_MAX_LAG (ADC_BUFFER_SIZE - ADC_BUFFER_SIZE/4) // [samples] oldest segment start read from gADCBuffer
+#define TRACKER_MAX_LAG 4096 // [samples] longest catch-up of the harmonic tracker per frame, it restarts beyond
+#define COUNTER_CROSS_CHECK 1 // also time zero crossings of the ADC samples, to cross-check the FFT frequency counter
+#define COUNTER_SAMPLES (ADC_BUFFER_SIZE/2) // [samples] latest samples timed by the zero-crossing counter
+#define COUNTER_HYSTERESIS 20 // [ADC counts] below trigger_value by this much before the next rising crossing counts
+#define TRIGGER_HYSTERESIS 20 // [ADC counts] beyond trigger_value by this much before the next crossing triggers
+#define TRIGGER_HOLDOFF 0 // [samples] after a trigger before the next one counts
+#define TRIGGER_AUTO_TIMEOUT 20000 // [samples] without a trigger before auto mode shows an untriggered frame (20 ms)
+#define ADC_READ_ATTEMPTS 2 // reads of a spectrum frame from gADCBuffer before an overwritten one is used anyway
 
 // ADC globals
 uint32_t gADCSamplingRate;                              // [Hz] actual ADC sampling rate
 volatile uint16_t gADCBuffer[ADC_BUFFER_SIZE];          // circular buffer
-volatile uint32_t gADCErrors;                           // number of missed ADC deadlines
-volatile int32_t gADCBufferIndex = ADC_BUFFER_SIZE - 1; // latest sample index
+adc_block_ring gADCRing;                                // gADCBuffer in blocks: gADCRing.count samples written so far,
+                                                        // sample n is at gADCBuffer[ADC_BUFFER_WRAP(n)]
+adc_summary gADCSummary;                                // min, max and sum of every 64 samples of gADCRing, kept by
+                                                        // the ADC interrupt, for windowed levels without a scan
+volatile uint32_t gADCOverruns;                         // reads of gADCBuffer the ADC overwrote before they finished
 
 // waveform globals
 volatile uint32_t trigger_value;
 volatile uint16_t trigger_samples[ADC_TRIGGER_SIZE];
 volatile int16_t processedWaveform[ADC_TRIGGER_SIZE];
-volatile uint16_t fft_samples[NFFT];
+trigger_stream gTrigger;                                // trigger comparator on every ADC block and its events
+volatile uint32_t stateTriggerMode = TRIGGER_AUTO;      // trigger_mode
+volatile uint32_t stateTriggerPre = ADC_TRIGGER_SIZE - 1; // [samples] before the trigger in a frame, its display column
+volatile bool stateTriggerArm = false;                  // take a single mode frame again
+
+// spectrum globals
+static kiss_fft_cpx fft_buffer[NFFT_BINS_MAX];  // windowed real input, then spectrum bins 0 to nfft/2 (in place)
+static int fft_block_shift;                     // block floating-point shift of fft_buffer (fixed-point build)
+static fft_plan *frame_plan;                    // plan of the frame in fft_buffer
+static uint32_t spectrum_generation;            // incremented by every spectrumSelect()
+static uint32_t frame_generation;               // spectrum_generation of the frame in fft_buffer
+volatile uint32_t stateNfft = NFFT_DEFAULT;     // selected FFT length
+volatile uint32_t gSpectrumRbwHz;               // [Hz] resolution bandwidth, window ENBW times the bin width
+
+// window globals
+volatile uint32_t stateWindow = WINDOW_BLACKMAN;    // selected window type
+static window_table windows[2];                     // window in use and the one being built
+static fft_window_t window_ram[2][NFFT_MAX/2];      // computed window tables (first halves)
+static volatile int window_active = 0;              // index into windows[] of the window in use
+static fft_plan *plan_active;                       // FFT plan matching windows[window_active]
+
+// span globals
+volatile uint32_t stateSpan = 0;                    // displayed span is Nyquist/2^stateSpan
+volatile uint32_t stateDetector = DETECTOR_PEAK;    // column detector
+volatile uint32_t gSpectrumHzPerDiv;                // [Hz] frequency per division of the displayed span
+
+// zoom globals
+volatile uint32_t stateZoom = 0;                                // zoom factor ZOOM_FACTOR_MIN << (stateZoom - 1), 0 = full span
+volatile uint32_t stateZoomCenter = ZOOM_CENTER_DEFAULT;        // zoom center frequency in steps of fs/ZOOM_NCO_SIZE
+volatile uint32_t gZoomCenterHz;                                // [Hz] zoom center frequency
+static zoom_plan zooms[2];                                      // zoom plans, paired with windows[]
+static zoom_plan *zoom_active;                                  // zoom plan matching windows[window_active], NULL for the full span
+static int frame_zoom;                                          // zoom factor of the frame in fft_buffer, 0 for a full-span frame
+
+// averaging globals
+volatile uint32_t stateTrace = TRACE_LIVE;          // displayed trace
+volatile uint32_t stateOverlap = WELCH_OVERLAP_50;  // overlap of the averaged segments
+volatile int32_t gWelchDropPct = -1;                // [%] samples the averaging skipped in the last second, -1 before the first report
+static uint32_t frame_trace;                        // stateTrace of the frame, fft_buffer is not windowed when full-span averaging
+
+// harmonic tracker globals
+static tracker harmonics;                           // sliding DFT bins of the PWM fundamental and harmonics
+volatile float gHarmonicVolts[HARMONIC_COUNT];      // [V] peak amplitude of the PWM fundamental and its harmonics
+
+// level globals
+volatile float gScopeVpp;                           // [V] peak-to-peak voltage of the latest ADC_SEARCH_SIZE samples
+volatile float gScopeMean;                          // [V] mean voltage of the latest ADC_SEARCH_SIZE samples
+
+// waterfall globals
+volatile bool stateWaterfall = false;               // spectrum shown as a waterfall of past spectra
+waterfall gWaterfall;                               // color-mapped spectrum history, blitted by the display task
+
+// measurement globals
+volatile bool stateAnalysis = false;                // distortion and noise measured on the live spectrum
+analysis_result gAnalysis;                          // measurement of the last live frame, copied under sem_cs
+counter_result gCounter;                            // frequency counter reading of the last live frame, copied under sem_cs
+
+// marker globals
+volatile bool stateMarkers = false;                 // markers and peak table on the live spectrum
+volatile uint32_t stateMarkerCommand = MARKER_NONE; // marker_command of the next live frame, cleared when taken
+marker_set gMarkers;                                // markers of the last live frame, copied under sem_cs
 
 // state globals
 volatile bool spectrumMode = false;             // determines the mode of the oscilloscope
@@ -66,96 +160,118 @@ float fScale;
 // initialize ADC hardware
 void ADC_Init(void)
 {
-    // GPIO setup for analog input AIN3
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
-    GPIOPinTypeADC(GPIO_PORTE_BASE, GPIO_PIN_0);
-
-    // initialize ADC1 peripheral
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC1);
-    uint32_t pll_frequency = SysCtlFrequencyGet(CRYSTAL_FREQUENCY);
-    uint32_t pll_divisor = (pll_frequency - 1) / (16 * ADC_SAMPLING_RATE) + 1;  // round divisor up
-    gADCSamplingRate = pll_frequency / (16 * pll_divisor);                      // actual sampling rate may differ from ADC_SAMPLING_RATE
-    ADCClockConfigSet(ADC1_BASE, ADC_CLOCK_SRC_PLL | ADC_CLOCK_RATE_FULL, pll_divisor);
-
-    // initialize ADC1 sampling sequence
-    ADCSequenceDisable(ADC1_BASE, 0);                                                   // choose ADC1 sequence 0; disable before configuring
-    ADCSequenceConfigure(ADC1_BASE, 0, ADC_TRIGGER_ALWAYS, 0);                          // specify the "timer" trigger
-    ADCSequenceStepConfigure(ADC1_BASE, 0, 0, ADC_CTL_IE | ADC_CTL_END | ADC_CTL_CH3);  // in the 0th step, sample channel 3 (AIN3)
-
-    // enable interrupt, and make it the end of sequence
-    ADCSequenceEnable(ADC1_BASE, 0);    // enable the sequence.  it is now sampling
-    ADCIntEnable(ADC1_BASE, 0);         // enable sequence 0 interrupt in the ADC1 peripheral
+    gADCSamplingRate = adc_driver_init(&gADCRing, gADCBuffer, ADC_BUFFER_SIZE); // starts filling gADCBuffer block by block
+    adc_summary_attach(&gADCSummary, &gADCRing); // interrupts stay off until the waveform task runs
+
+    gTrigger.level = 1 << (ADC_BITS - 1); // until zeroCrossPoint() finds the signal offset
+    gTrigger.hysteresis = TRIGGER_HYSTERESIS;
+    gTrigger.rising = risingSlope;
+    gTrigger.mode = stateTriggerMode;
+    gTrigger.pre = stateTriggerPre;
+    gTrigger.post = ADC_TRIGGER_SIZE - 1 - stateTriggerPre;
+    gTrigger.holdoff = TRIGGER_HOLDOFF;
+    gTrigger.auto_timeout = TRIGGER_AUTO_TIMEOUT;
+    trigger_stream_attach(&gTrigger, &gADCRing);
 }
 
-// ADC interrupt service routine
-void ADC_ISR(void)
-{
-    ADC1_ISC_R = ADC_ISC_IN0;           // clears ADC interrupt flag
-
-    if (ADC1_OSTAT_R & ADC_OSTAT_OV0) { // check for ADC FIFO overflow
-        gADCErrors++;                   // count errors
-        ADC1_OSTAT_R = ADC_OSTAT_OV0;   // clear overflow condition
-    }
-
-    gADCBuffer[
-               gADCBufferIndex = ADC_BUFFER_WRAP(gADCBufferIndex + 1)
-               ] = ADC1_SSFIFO0_R;          // read sample from the ADC1 sequence 0 FIFO
-}
-
-// search for sample trigger
+// copy the latest frame the trigger comparator located
 void triggerSearch(void)
 {
-    int32_t trigger_index;
+    static uint16_t samples[ADC_TRIGGER_SIZE + 1];  // snapshot of the frame and the sample after it
+    static uint16_t resampled[ADC_TRIGGER_SIZE];    // the snapshot shifted by the trigger fraction
+    trigger_event e;
     int32_t i;
 
-    // goes backwards through the whole gADCBuffer array, and finds the zero-crossing point index and shifts it
-    trigger_index = gADCBufferIndex - LCD_HORIZONTAL_MAX/2;
-
-    if (risingSlope) { // rising slope trigger search
-        for (i = 0; i < ADC_BUFFER_SIZE/2; i++, trigger_index--) {
-            if (gADCBuffer[ADC_BUFFER_WRAP(trigger_index)] <= trigger_value &&
-                    gADCBuffer[ADC_BUFFER_WRAP(trigger_index + 1)] > trigger_value) {
-                break; // if found, stop looking
-            }
-        }
-    }
-    else { // falling slope trigger search
-        for (i = 0; i < ADC_BUFFER_SIZE/2; i++, trigger_index--) {
-            if (gADCBuffer[ADC_BUFFER_WRAP(trigger_index)] >= trigger_value &&
-                    gADCBuffer[ADC_BUFFER_WRAP(trigger_index + 1)] < trigger_value) {
-                break; // if found, stop looking
-            }
-        }
+    // settings of the comparator for the next blocks
+    gTrigger.level = trigger_value;
+    gTrigger.rising = risingSlope;
+    gTrigger.mode = stateTriggerMode;
+    gTrigger.pre = stateTriggerPre;
+    gTrigger.post = ADC_TRIGGER_SIZE - 1 - stateTriggerPre;
+    if (stateTriggerArm) {
+        stateTriggerArm = false;
+        trigger_stream_arm(&gTrigger);
     }
 
-    if (i == ADC_BUFFER_SIZE/2) { // if trigger not found, set to previous value
-        trigger_index = gADCBufferIndex - LCD_HORIZONTAL_MAX/2;
-    }
+    if (!trigger_stream_latest(&gTrigger, adc_block_sequence(&gADCRing), &e))
+        return; // no new frame, keep the last waveform
 
-    // local buffer retrieves 128 samples of the gADCBuffer from the trigger_index previously found
+    // copy the 128 samples of the gADCBuffer around the trigger, and the one after them, without holding sem_cs,
+    // and keep the last waveform if the ADC overwrote them meanwhile
+    if (!adc_block_snapshot(&gADCRing, e.index + gTrigger.post + 2, ADC_TRIGGER_SIZE + 1, samples)) {
+        gADCOverruns++;
+        return;
+    }
+    trigger_resample(samples, ADC_TRIGGER_SIZE, e.frac, resampled); // the crossing on column stateTriggerPre exactly
+    Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
     for (i = 0; i < ADC_TRIGGER_SIZE; i++){
-        trigger_samples[i] = gADCBuffer[ADC_BUFFER_WRAP(trigger_index - (ADC_TRIGGER_SIZE - 1) + i)];
+        trigger_samples[i] = resampled[i];
     }
+    Semaphore_post(sem_cs);
 }
 
-// returns zero-crossing point of the ADC waveform by finding the max and min points, averaging them
+// returns zero-crossing point of the ADC waveform by finding the max and min points, averaging them. they come from
+// the summary of the latest ADC_SEARCH_SIZE samples in O(log n), along with the peak-to-peak and mean levels
 uint32_t zeroCrossPoint(void)
 {
-    int max = 0;
-    int min = 10000;
+    static uint32_t level = 1 << (ADC_BITS - 1); // last midpoint, kept while the samples are overwritten or too few
+    adc_window w;
 
-    int i;
-    for (i = 0; i < ADC_BUFFER_SIZE; i++){
-        if (gADCBuffer[i] > max){
-            max = gADCBuffer[i];
-        }
-
-        if (gADCBuffer[i] < min){
-            min = gADCBuffer[i];
-        }
+    if (!adc_summary_window(&gADCSummary, &gADCRing, adc_block_sequence(&gADCRing), ADC_SEARCH_SIZE, &w)) {
+        gADCOverruns++;
+        return level;
     }
+    if (w.n > 0) {
+        level = (w.max + w.min)/2;
+        gScopeVpp = (w.max - w.min)*(VIN_RANGE/(1 << ADC_BITS));
+        gScopeMean = w.mean*(VIN_RANGE/(1 << ADC_BITS));
+    }
+    return level;
+}
+
+// dB of display row 0 for column powers of an nfft-point frame whose true power is power*2^(log2_scale_q16/2^16)
+static int32_t spectrumRef(int nfft, int32_t log2_scale_q16)
+{
+#ifdef FIXED_POINT
+    // fixed-point FFT output is scaled by 1/nfft and the input by 2^(WINDOW_Q - block shift),
+    // so |X|^2 = |out|^2 * nfft^2 * 2^(2*block shift - 2*WINDOW_Q), the block shift being in log2_scale_q16
+    int log2_nfft = dsp_bits32(nfft) - 1;
+    log2_scale_q16 += (2*log2_nfft - 2*WINDOW_Q) << 16;
+#else
+    (void)nfft;
+#endif
+    return (PIXEL_DB_OFFSET << 16) - log2_q16_to_db_q16(log2_scale_q16);
+}
+
+// factor turning |bin|^2 of an nfft-point frame into |X|^2 of the windowed ADC counts
+static float spectrumPowerScale(int nfft, int block_shift)
+{
+#ifdef FIXED_POINT
+    return ldexpf((float)nfft*nfft, 2*block_shift - 2*WINDOW_Q); // as in spectrumRef()
+#else
+    (void)nfft;
+    (void)block_shift;
+    return 1;
+#endif
+}
+
+// free-running TI-RTOS timestamp counter, times the pruned FFT modes
+static uint32_t timestamp(void)
+{
+    return Timestamp_get32();
+}
 
-    return (max+min)/2;
+// sets up the tracker on the PWM fundamental and its harmonics, over whole periods of the PWM
+static void harmonicsInit(void)
+{
+    uint32_t fs = gADCSamplingRate;
+    int n = tracker_period_length(fs, PWM_FREQUENCY);
+    int h;
+
+    tracker_init(&harmonics, n);
+    for (h = 1; h <= HARMONIC_COUNT; h++)
+        tracker_add(&harmonics, (int)(((uint64_t)h*PWM_FREQUENCY*n + fs/2)/fs)); // bin nearest h*PWM_FREQUENCY
+    tracker_reset(&harmonics, gADCRing.count);
 }
 
 // TI-RTOS processing task function
@@ -163,43 +279,214 @@ void processingTask_func(UArg arg1, UArg arg2)
 {
     IntMasterEnable(); // enable interrupts
 
-    static char kiss_fft_cfg_buffer[KISS_FFT_CFG_SIZE];                 // KISS FFT config memory
-    size_t buffer_size = KISS_FFT_CFG_SIZE;                             // KISS FFT buffer size
-    kiss_fft_cfg cfg;                                                   // KISS FFT config
-    static kiss_fft_cpx in[NFFT], out[NFFT];                            // complex waveform and spectrum buffers
-    cfg = kiss_fft_alloc(NFFT, 0, kiss_fft_cfg_buffer, &buffer_size);   // init Kiss FFT
+    kiss_fft_cpx *out = fft_buffer;                                     // spectrum, bins 0 to nfft/2
+    static int16_t column_rows[ADC_TRIGGER_SIZE - 1];                   // display rows of the spectrum
+    static spectrum_sum column_power[ADC_TRIGGER_SIZE - 1];             // detected power of each display column
+    static int16_t bin_rows[ADC_TRIGGER_SIZE - 1];                      // display row of each bin, narrow live spans
+    static spectrum_view view;                                          // bin to column map of the span
+    static welch_stream stream;                                         // segment schedule of the full-span average
+    static welch_traces traces;                                         // averaged and held column powers
+    static analysis_result analysis;                                    // measurement of the frame
+    static counter_result counter;                                      // frequency counter reading of the frame
+    static marker_set markers;                                          // markers following their peaks frame to frame
+    uint32_t view_span = ~0u, view_detector = ~0u;                      // span and detector the view was built for
+    int view_zoom = -1;                                                 // zoom factor the view was built for
+    bool traces_valid = false;                                          // traces hold segments of the current view and settings
+    uint32_t traces_generation = 0, traces_overlap = 0;                 // spectrumSelect() generation and overlap of the traces
+    bool waterfall_valid = false;                                       // waterfall rows are of the current view and settings
+    uint32_t waterfall_generation = 0;                                  // spectrumSelect() generation of the waterfall rows
+    bool markers_valid = false;                                         // markers are on peaks of the current view and settings
+    uint32_t markers_generation = 0;                                    // spectrumSelect() generation of the markers
     int i;
 
-    static float w[NFFT]; // window function
-    for (i = 0; i < NFFT; i++) {
-        // blackman window
-        w[i] = (0.42f - 0.5f * cosf(2*PI*i/(NFFT-1)) + 0.08f * cosf(4*PI*i/(NFFT-1)));
-    }
+    harmonicsInit();
+    waterfall_init(&gWaterfall);
 
     while(true){
         Semaphore_pend(semProcessing, BIOS_WAIT_FOREVER); // from waveform
 
         if (spectrumMode){
-            Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
-
-            for (i = 0; i < NFFT; i++) { // generate an input waveform
-                in[i].r = ((float)fft_samples[i] - trigger_value) * w[i];   // real part of waveform
-                in[i].i = 0;                                                // imaginary part of waveform
+            fft_plan *plan = frame_plan;                    // plan the waveform task windowed fft_buffer for
+            int zoom = frame_zoom;                          // or its zoom factor, for a zoom frame
+            uint32_t trace = frame_trace;                   // displayed trace
+            uint32_t generation = frame_generation;         // spectrumSelect() generation of the frame
+            int nfft = zoom ? ZOOM_NFFT : plan->nfft;       // FFT length of the frame
+            int32_t log2_scale_q16;                         // log2 scale of the column powers
+            const spectrum_sum *power = column_power;       // column powers to display
+            bool per_bin = false;                           // at most one bin per column: display the bins themselves
+
+            analysis.valid = false; // until measured
+            counter.valid = counter.zc_valid = false;
+            if (!stateMarkers || zoom || trace != TRACE_LIVE)
+                markers_valid = false; // back to the strongest peak when the markers return
+
+            // rebuild the bin to column map only when the span, detector, zoom or FFT length changes
+            if (view_span != stateSpan || view_detector != stateDetector || view_zoom != zoom || view.nfft != nfft) {
+                view_span = stateSpan;
+                view_detector = stateDetector;
+                view_zoom = zoom;
+                if (zoom) // the zoomed band without the FIR transition bands at its edges
+                    spectrum_view_init_bins(&view, ZOOM_NFFT, gADCSamplingRate/zoom, ZOOM_GUARD, ZOOM_NFFT - 1 - ZOOM_GUARD,
+                                            (spectrum_detector)view_detector, ADC_TRIGGER_SIZE - 1, PIXELS_PER_DIV);
+                else
+                    spectrum_view_init(&view, nfft, gADCSamplingRate, view_span, (spectrum_detector)view_detector,
+                                       ADC_TRIGGER_SIZE - 1, PIXELS_PER_DIV);
+                gSpectrumHzPerDiv = view.hz_per_div;
+                traces_valid = false;
+                waterfall_valid = false;
+                markers_valid = false;
             }
 
-            Semaphore_post(sem_cs);
-
-            kiss_fft(cfg, in, out); // compute FFT
-
-            // convert first 128 bins of out[] to dB for display
-            Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+            // each FFT length keeps its own plan, the next frames time its modes
+            if (!zoom && (plan->prune->kmin != view.kmin || plan->prune->kmax != view.kmax))
+                fft_prune_plan_init(plan->prune, plan->cfg, view.kmin, view.kmax, timestamp);
+
+            if (trace != TRACE_LIVE) {
+                // restart the traces and the segment schedule after any change of what they measure
+                if (!traces_valid || traces_generation != generation || traces_overlap != stateOverlap) {
+                    traces_valid = true;
+                    traces_generation = generation;
+                    traces_overlap = stateOverlap;
+                    welch_traces_reset(&traces, view.cols);
+                    welch_stream_init(&stream, nfft, (welch_overlap)traces_overlap, WELCH_MAX_LAG, gADCRing.count);
+                }
+            } else {
+                traces_valid = false;
+            }
 
-            for (i = 0; i < ADC_TRIGGER_SIZE - 1; i++) {
-                processedWaveform[i] = (int)roundf(128 - 10*log10f(out[i].r*out[i].r +out[i].i*out[i].i));
+            if (zoom) {
+                // fft_buffer holds the windowed, down-converted samples
+                zoom_execute(fft_buffer); // complex FFT in place, lowest frequency first
+                spectrum_detect(&view, out, column_power);
+                log2_scale_q16 = (2*fft_block_shift) << 16;
+                if (trace != TRACE_LIVE) // one segment per zoom frame
+                    welch_traces_add(&traces, column_power, 2*fft_block_shift);
+            } else if (trace == TRACE_LIVE) {
+                // fft_buffer was windowed by the waveform task
+                fft_prune_execute(plan->prune, plan->cfg, fft_buffer); // compute the real-input FFT in place, only bins of the span
+                per_bin = view.kmax - view.kmin < view.cols; // every detector gives the one bin of its column
+                if (!per_bin)
+                    spectrum_detect(&view, out, column_power);
+                log2_scale_q16 = (2*fft_block_shift) << 16;
+
+                window_table window;    // window of the frame
+                bool current;           // the window in use is still the one of the frame
+                marker_command command; // marker operation the user asked for
+
+                Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                current = spectrum_generation == generation;
+                window = windows[window_active];
+                command = (marker_command)stateMarkerCommand;
+                stateMarkerCommand = MARKER_NONE;
+                Semaphore_post(sem_cs);
+
+                if (current) {
+                    float power_scale = spectrumPowerScale(nfft, fft_block_shift);
+                    // strongest peak of the span, interpolated between bins
+                    counter_fft(&counter, out, view.kmin, view.kmax, nfft, gADCSamplingRate, &window, power_scale);
+                    if (stateAnalysis) // distortion and noise over the bins of the span
+                        analysis_run(&analysis, out, view.kmin, view.kmax, nfft, gADCSamplingRate, &window, power_scale);
+                    if (stateMarkers) {
+                        // start over after any change of the bins they point at
+                        if (!markers_valid || markers_generation != generation) {
+                            markers_valid = true;
+                            markers_generation = generation;
+                            marker_reset(&markers);
+                        }
+                        marker_update(&markers, command, out, &view, gADCSamplingRate, window_lobe_bins(&window),
+                                      power_scale, true);
+                    }
+
+                    // the window table is read outside sem_cs: a second spectrumSelect() meanwhile may have rebuilt
+                    // it, so drop the frame rather than show its measurements
+                    Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                    current = spectrum_generation == generation;
+                    Semaphore_post(sem_cs);
+                    if (!current) {
+                        markers_valid = false;
+                        power = NULL;
+                    }
+                }
+#if COUNTER_CROSS_CHECK
+                counter_zero_cross(&counter, gADCBuffer, ADC_BUFFER_SIZE, gADCRing.count - COUNTER_SAMPLES, COUNTER_SAMPLES,
+                                   trigger_value, COUNTER_HYSTERESIS, gADCSamplingRate);
+#endif
+            } else {
+                // average every segment of the stream since the last frame, straight from gADCBuffer
+                uint64_t sequence = adc_block_sequence(&gADCRing);
+                const window_table *window; // window of the frame
+                bool current;               // the window in use is still the one of the frame
+                uint32_t first;
+                int segments;
+
+                Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                current = spectrum_generation == generation;
+                window = &windows[window_active];
+                Semaphore_post(sem_cs);
+
+                for (segments = 0; current && segments < WELCH_MAX_SEGMENTS && welch_stream_next(&stream, (uint32_t)sequence, &first); segments++) {
+                    uint64_t first_sequence = sequence - (uint32_t)((uint32_t)sequence - first); // back to 64 bits
+                    int block_shift = window_apply(window, gADCBuffer, ADC_BUFFER_SIZE, (int32_t)first, trigger_value,
+                                                   (kiss_fft_scalar *)fft_buffer);
+
+                    // a spectrumSelect() while windowing may have rebuilt the window: restart next frame
+                    Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                    current = spectrum_generation == generation;
+                    Semaphore_post(sem_cs);
+                    if (!current)
+                        break;
+                    if (!adc_block_valid(&gADCRing, first_sequence)) {
+                        gADCOverruns++; // overwritten while windowed, leave the segment out
+                        continue;
+                    }
+
+                    fft_prune_execute(plan->prune, plan->cfg, fft_buffer);
+                    spectrum_detect(&view, out, column_power);
+                    welch_traces_add(&traces, column_power, 2*block_shift);
+                }
+                gWelchDropPct = stream.drop_pct;
             }
 
-            Semaphore_post(sem_cs);
+            if (trace != TRACE_LIVE)
+                power = welch_traces_get(&traces, (welch_trace)trace, &log2_scale_q16);
+
+            // convert the column powers to display rows, in dB
+            if (power != NULL) {
+                int32_t ref_db_q16 = spectrumRef(nfft, log2_scale_q16);
+                if (per_bin) {
+                    // convert each bin once, straight from the FFT output, then repeat its row over its columns
+                    power_to_db(&out[view.kmin], bin_rows, view.kmax - view.kmin + 1, ref_db_q16);
+                    for (i = 0; i < view.cols; i++)
+                        column_rows[i] = bin_rows[view.col_bin[i] - view.kmin];
+                } else {
+                    spectrum_rows(&view, power, column_rows, ref_db_q16);
+                }
+                if (!markers_valid)
+                    marker_reset(&markers); // no markers on this frame
+
+                Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                for (i = 0; i < ADC_TRIGGER_SIZE - 1; i++) {
+                    processedWaveform[i] = column_rows[i];
+                }
+                gAnalysis = analysis;
+                gCounter = counter;
+                gMarkers = markers;
+                if (stateWaterfall) {
+                    // start over after any change of the frequency axis or scale
+                    if (!waterfall_valid || waterfall_generation != generation) {
+                        waterfall_valid = true;
+                        waterfall_generation = generation;
+                        waterfall_clear(&gWaterfall);
+                    }
+                    waterfall_push(&gWaterfall, column_rows, ADC_TRIGGER_SIZE - 1); // one row, one lookup per pixel
+                } else {
+                    waterfall_valid = false;
+                }
+                Semaphore_post(sem_cs);
+            }
         } else {
+            traces_valid = false; // restart the averaging on the return to spectrum mode
+
             // determines fScale
             fScale = (VIN_RANGE/(1 << ADC_BITS))*(PIXELS_PER_DIV/fVoltsPerDiv[stateVperDiv]);
             int i;
@@ -211,6 +498,11 @@ void processingTask_func(UArg arg1, UArg arg2)
             }
 
             Semaphore_post(sem_cs);
+
+            // follow the PWM harmonics sample by sample since the last frame
+            tracker_update(&harmonics, gADCBuffer, ADC_BUFFER_SIZE, gADCRing.count, TRACKER_MAX_LAG);
+            for (i = 0; i < HARMONIC_COUNT; i++)
+                gHarmonicVolts[i] = tracker_amplitude(&harmonics, i)*(VIN_RANGE/(1 << ADC_BITS));
         }
 
         Semaphore_post(semWaveform);    // to waveform
@@ -218,31 +510,99 @@ void processingTask_func(UArg arg1, UArg arg2)
     }
 }
 
+// select the FFT window, length and zoom; builds the window, the zoom plan and, on first use of the length,
+// its plan outside the critical section, then swaps them in
+void spectrumSelect(uint32_t type, uint32_t nfft, uint32_t zoom, uint32_t center)
+{
+    size_t arena_used = fft_plan_arena_used();
+    fft_plan *plan = fft_plan_get(nfft); // cached after the first use of nfft
+    if (plan == NULL)
+        return; // unsupported length
+    if (fft_plan_arena_used() != arena_used) // a new plan, starting with the warm-up: report the arena high-water mark
+        System_printf("FFT plan arena: %d of %d bytes\n", (int)fft_plan_arena_used(), (int)fft_plan_arena_size());
+
+    int next = !window_active;              // the window and zoom plan not in use
+    int length = nfft;                      // window length
+    uint32_t fs = gADCSamplingRate;         // [Hz] sampling rate of the FFT input
+    if (zoom) {
+        if (!zoom_init(&zooms[next], ZOOM_FACTOR_MIN << (zoom - 1), center))
+            return; // unsupported zoom or center
+        length = ZOOM_NFFT;
+        fs /= zooms[next].factor;
+    }
+    window_init(&windows[next], (window_type)type, WINDOW_KAISER_BETA, length, window_ram[next]);
+    uint32_t rbw = (uint32_t)(windows[next].enbw*fs/length + 0.5f);
+    uint32_t center_hz = zoom ? zoom_center_hz(&zooms[next], gADCSamplingRate) : 0;
+
+    Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+    window_active = next;
+    plan_active = plan;
+    zoom_active = zoom ? &zooms[next] : NULL;
+    stateWindow = type;
+    stateNfft = nfft;
+    stateZoom = zoom;
+    stateZoomCenter = center;
+    spectrum_generation++;
+    gSpectrumRbwHz = rbw;
+    gZoomCenterHz = center_hz;
+    Semaphore_post(sem_cs);
+}
+
 // TI-RTOS waveform task function
 void waveformTask_func(UArg arg1, UArg arg2)
 {
     IntMasterEnable(); // enable interrupts
 
+    spectrumSelect(stateWindow, stateNfft, stateZoom, stateZoomCenter); // warm up the plan of the startup FFT length
+
     while(true){
         Semaphore_pend(semWaveform, BIOS_WAIT_FOREVER); // from processing
 
         trigger_value = zeroCrossPoint(); // Dynamically finds the ADC_OFFSET
         if (spectrumMode){
-            int i;
-            int buffer_ind = gADCBufferIndex;
-
-            Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
-            for (i = 0; i < NFFT; i++){
-                fft_samples[i] = gADCBuffer[ADC_BUFFER_WRAP(buffer_ind - NFFT + i)];
+            int attempt;
+            for (attempt = 0; attempt < ADC_READ_ATTEMPTS; attempt++) {
+                uint64_t latest = adc_block_sequence(&gADCRing) - 1;  // sequence number of the latest sample
+                int buffer_ind = (int32_t)latest;
+                uint64_t first = latest;                                // sequence number of the first sample read
+                const window_table *window;                             // window of the frame
+                const zoom_plan *zoom;                                  // zoom plan of the frame, NULL for the full span
+
+                // take the settings of the frame under sem_cs. the window and zoom plan stay as they are while
+                // they are read: spectrumSelect() only rebuilds the ones not in use, and its task cannot run
+                // before this one is done
+                Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
+                frame_plan = plan_active;
+                frame_trace = stateTrace;
+                frame_generation = spectrum_generation;
+                window = &windows[window_active];
+                zoom = zoom_active;
+                Semaphore_post(sem_cs);
+
+                // read the latest nfft samples straight from gADCBuffer without holding sem_cs, remove DC and
+                // window them into the FFT input, then check the ADC did not overwrite them meanwhile
+                if (zoom != NULL) {
+                    // down-convert and decimate the latest samples around the zoom center instead
+                    frame_zoom = zoom->factor;
+                    first = latest - zoom_input_size(zoom);
+                    fft_block_shift = zoom_apply(zoom, window, gADCBuffer, ADC_BUFFER_SIZE,
+                                                 buffer_ind - zoom_input_size(zoom), trigger_value, fft_buffer);
+                } else if (frame_trace != TRACE_LIVE) {
+                    frame_zoom = 0; // the processing task reads and windows the averaged segments itself
+                } else {
+                    frame_zoom = 0;
+                    first = latest - frame_plan->nfft;
+                    fft_block_shift = window_apply(window, gADCBuffer, ADC_BUFFER_SIZE,
+                                                   buffer_ind - frame_plan->nfft, trigger_value, (kiss_fft_scalar *)fft_buffer);
+                }
+
+                if (adc_block_valid(&gADCRing, first))
+                    break;
+                gADCOverruns++; // the frame mixed old and new samples, read the latest ones again
             }
-            Semaphore_post(sem_cs);
 
         } else {
-            Semaphore_pend(sem_cs, BIOS_WAIT_FOREVER); // protect critical section
-
-            triggerSearch(); // searches for trigger
-
-            Semaphore_post(sem_cs);
+            triggerSearch(); // copies the latest triggered frame, takes sem_cs only to publish trigger_samples
         }
 
         Semaphore_post(semProcessing); // to processing
@@ -0,0 +1,127 @@
+/*
+ * spectrum.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Spectrum span model and bin to display column aggregation
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "kiss_fft.h"
+#include "dsp_math.h"
+#include "spectrum.h"
+
+// bin power in the build's scalar type, column power sums are spectrum_sum (spectrum.h)
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define POWER_SHIFT 6             // Q31 power is pre-shifted so 64 bins can be summed in 64 bits
+typedef uint64_t spectrum_power;
+#  define BIN_POWER(c) (((uint64_t)((int64_t)(c).r*(c).r) + (uint64_t)((int64_t)(c).i*(c).i)) >> POWER_SHIFT)
+#  define POWER_LOG2_Q16(p) (ilog2_q16_u64(p) + (POWER_SHIFT << 16))
+# else
+typedef uint32_t spectrum_power;
+#  define BIN_POWER(c) ((uint32_t)((int32_t)(c).r*(c).r) + (uint32_t)((int32_t)(c).i*(c).i))
+#  define POWER_LOG2_Q16(p) ilog2_q16_u64(p)
+# endif
+#else
+typedef float spectrum_power;
+# define BIN_POWER(c) ((c).r*(c).r + (c).i*(c).i)
+# define POWER_LOG2_Q16(p) fast_log2_q16(p)
+#endif
+
+const char * const gDetectorNameStr[DETECTOR_COUNT] = {"Peak", "Min", "Sample", "Avg"};
+
+// maps the span onto the display columns
+void spectrum_view_init(spectrum_view *v, int nfft, uint32_t fs, int span, spectrum_detector detector,
+                        int cols, int pixels_per_div)
+{
+    spectrum_view_init_bins(v, nfft, fs, 0, (nfft/2) >> span, detector, cols, pixels_per_div); // Nyquist/2^span
+}
+
+// maps a bin range onto the display columns
+void spectrum_view_init_bins(spectrum_view *v, int nfft, uint32_t fs, int kmin, int kmax, spectrum_detector detector,
+                             int cols, int pixels_per_div)
+{
+    int c;
+
+    if (cols > SPECTRUM_MAX_COLS)
+        cols = SPECTRUM_MAX_COLS;
+
+    v->nfft = nfft;
+    v->kmin = kmin;
+    v->kmax = kmax;
+    v->cols = cols;
+    v->detector = detector;
+
+    // spread the bins evenly; on narrow spans a bin repeats over several columns
+    int nbins = v->kmax - v->kmin + 1;
+    for (c = 0; c <= cols; c++)
+        v->col_bin[c] = (uint16_t)(v->kmin + c*nbins/cols);
+
+    // bins per column * bin width * columns per division
+    v->hz_per_div = (uint32_t)(((uint64_t)fs*nbins*pixels_per_div + (uint64_t)nfft*cols/2)/((uint64_t)nfft*cols));
+}
+
+// applies the detector per column
+void spectrum_detect(const spectrum_view *v, const kiss_fft_cpx *bins, spectrum_sum *power)
+{
+    int c, k;
+
+    for (c = 0; c < v->cols; c++) {
+        int first = v->col_bin[c], end = v->col_bin[c + 1];
+        if (end <= first)
+            end = first + 1; // column within a repeated bin
+
+        spectrum_power p = BIN_POWER(bins[first]);
+        spectrum_sum sum = p;
+
+        switch (v->detector) {
+        case DETECTOR_PEAK:
+            for (k = first + 1; k < end; k++) {
+                spectrum_power q = BIN_POWER(bins[k]);
+                if (q > p) p = q;
+            }
+            break;
+        case DETECTOR_MIN:
+            for (k = first + 1; k < end; k++) {
+                spectrum_power q = BIN_POWER(bins[k]);
+                if (q < p) p = q;
+            }
+            break;
+        case DETECTOR_AVERAGE:
+            for (k = first + 1; k < end; k++)
+                sum += BIN_POWER(bins[k]);
+            p = (spectrum_power)(sum/(end - first));
+            break;
+        default: // DETECTOR_SAMPLE
+            break;
+        }
+
+        power[c] = p;
+    }
+}
+
+// converts column powers to display rows
+void spectrum_rows(const spectrum_view *v, const spectrum_sum *power, int16_t *rows, int32_t ref_db_q16)
+{
+    int c;
+    int32_t ref = ref_db_q16 + (1 << 15); // round to nearest row
+
+    for (c = 0; c < v->cols; c++)
+        rows[c] = (int16_t)((ref - log2_q16_to_db_q16(POWER_LOG2_Q16(power[c]))) >> 16);
+}
+
+// formats the frequency per division
+void spectrum_format_hz(char *str, int size, uint32_t hz)
+{
+    uint32_t tenths = (hz + 50)/100; // [0.1 kHz]
+
+    if (hz >= 9950)
+        snprintf(str, size, "%ukHz", (unsigned)((hz + 500)/1000));
+    else if (hz >= 1000)
+        snprintf(str, size, "%u.%ukHz", (unsigned)(tenths/10), (unsigned)(tenths % 10));
+    else
+        snprintf(str, size, "%uHz", (unsigned)hz);
+}
@@ -0,0 +1,68 @@
+/*
+ * spectrum.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Spectrum span model and bin to display column aggregation
+ */
+
+#ifndef SPECTRUM_H_
+#define SPECTRUM_H_
+
+#include <stdint.h>
+#include "kiss_fft.h"
+
+#define SPECTRUM_MAX_COLS 128   // largest number of display columns
+#define SPECTRUM_SPAN_COUNT 6   // spans of Nyquist/1, /2, /4, /8, /16 and /32, starting at 0 Hz
+
+// column power: detected bin power, or a sum of bin powers
+#ifdef FIXED_POINT
+typedef uint64_t spectrum_sum;
+#else
+typedef float spectrum_sum;
+#endif
+
+typedef enum {
+    DETECTOR_PEAK,      // largest bin power in the column, keeps narrow spurs visible
+    DETECTOR_MIN,       // smallest bin power in the column
+    DETECTOR_SAMPLE,    // power of the first bin in the column
+    DETECTOR_AVERAGE,   // mean bin power in the column (RMS)
+    DETECTOR_COUNT
+} spectrum_detector;
+
+// frequency span mapped onto the display columns
+typedef struct {
+    int nfft;                                   // FFT size the bins come from
+    int kmin, kmax;                             // displayed bin range, inclusive
+    int cols;                                   // number of display columns
+    spectrum_detector detector;                 // column detector
+    uint16_t col_bin[SPECTRUM_MAX_COLS + 1];    // column c covers bins col_bin[c] to col_bin[c+1]-1, at least one
+    uint32_t hz_per_div;                        // [Hz] frequency per display division
+} spectrum_view;
+
+extern const char * const gDetectorNameStr[DETECTOR_COUNT]; // short detector names for the display
+
+// maps the span from 0 Hz to Nyquist/2^span onto cols display columns with pixels_per_div columns per division,
+// fs is the sampling rate. only needed when the span, detector or FFT size change
+void spectrum_view_init(spectrum_view *v, int nfft, uint32_t fs, int span, spectrum_detector detector,
+                        int cols, int pixels_per_div);
+
+// maps bins kmin to kmax of an nfft-point FFT at sampling rate fs onto the display columns, e.g. the
+// reordered bins of a complex zoom FFT
+void spectrum_view_init_bins(spectrum_view *v, int nfft, uint32_t fs, int kmin, int kmax, spectrum_detector detector,
+                             int cols, int pixels_per_div);
+
+// one pass over the bins of the view (at most 64 bins per column in the Q31 build): applies the detector per
+// column, one power per display column in the units of the bin power (|bin|^2, pre-shifted right by 6 bits in the
+// Q31 build)
+void spectrum_detect(const spectrum_view *v, const kiss_fft_cpx *bins, spectrum_sum *power);
+
+// converts column powers to display rows: rows[c] = round(ref_db_q16/2^16 - 10*log10(power[c])), for
+// powers from spectrum_detect() or sums of them (fold any scale of the sums into ref_db_q16)
+void spectrum_rows(const spectrum_view *v, const spectrum_sum *power, int16_t *rows, int32_t ref_db_q16);
+
+// formats the frequency per division for the display, e.g. "20kHz" or "2.4kHz"
+void spectrum_format_hz(char *str, int size, uint32_t hz);
+
+#endif /* SPECTRUM_H_ */
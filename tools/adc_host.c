@@ -0,0 +1,108 @@
+/*
+ * adc_host.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host stand-in for the ADC acquisition driver: streams synthetic samples
+ * into an adc_block_ring in blocks, for running the consumers on Linux.
+ * Not part of the firmware build; compile it with adc_block.c, adc_summary.c,
+ * trigger.c and the consumers, e.g.
+ * gcc -std=c99 -I. tools/adc_host.c adc_block.c adc_summary.c trigger.c ... -lm
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+#include "adc_block.h"
+#include "adc_host.h"
+
+#define ADC_HOST_PI 3.14159265358979323846
+
+static adc_block_ring *ring;                            // ring being filled
+static uint32_t block_size = 1024;                      // block size of the next adc_driver_init()
+static adc_host_signal source = {2048, 0, {0}, {0}, 0, false};
+static uint32_t written;                                // samples of the block being filled already written
+static uint64_t rng = 88172645463325252ull;             // xorshift state of the noise
+static const uint16_t *recording;                       // samples replayed instead of the signal, NULL for none
+static uint32_t recording_len, recording_pos;           // its length and the next sample replayed
+
+// uniform in (0, 1)
+static double uniform(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return ((rng >> 11) + 0.5)/9007199254740992.0;
+}
+
+// sample n of the signal
+static uint16_t sample(uint32_t n)
+{
+    double x = source.offset;
+    int i;
+
+    if (recording != NULL) {
+        uint16_t recorded = recording[recording_pos];
+        recording_pos = recording_pos + 1 < recording_len ? recording_pos + 1 : 0;
+        return recorded;
+    }
+    if (source.ramp)
+        return (uint16_t)n;
+    for (i = 0; i < source.tones; i++) // whole cycles taken out before the cosine, so the phase stays precise
+        x += source.amplitude[i]*cos(2*ADC_HOST_PI*fmod(source.hz[i]*n, ADC_HOST_RATE)/ADC_HOST_RATE);
+    if (source.noise_rms > 0) // Box-Muller
+        x += source.noise_rms*sqrt(-2*log(uniform()))*cos(2*ADC_HOST_PI*uniform());
+    x = floor(x + 0.5);
+    return (uint16_t)(x < 0 ? 0 : x > 4095 ? 4095 : x); // the ADC saturates
+}
+
+// the ring is empty, sampling at the nominal rate
+uint32_t adc_driver_init(adc_block_ring *r, volatile uint16_t *buffer, uint32_t size)
+{
+    ring = r;
+    written = 0;
+    adc_block_init(r, buffer, size, block_size);
+    return ADC_HOST_RATE;
+}
+
+// block size of the next ring
+void adc_host_block(uint32_t block)
+{
+    block_size = block;
+}
+
+// signal of the next blocks
+void adc_host_signal_set(const adc_host_signal *s)
+{
+    source = *s;
+}
+
+// a recording from its start
+void adc_host_replay(const uint16_t *samples, uint32_t n)
+{
+    recording = n > 0 ? samples : NULL;
+    recording_len = n;
+    recording_pos = 0;
+}
+
+// whole blocks
+void adc_host_run(uint32_t blocks)
+{
+    while (blocks--) {
+        adc_host_partial(ring->block - written);
+        written = 0;
+        adc_block_publish(ring);
+    }
+}
+
+// part of the block being filled
+void adc_host_partial(uint32_t samples)
+{
+    volatile uint16_t *dest = adc_block_dest(ring, 0);
+    uint32_t end = written + samples < ring->block ? written + samples : ring->block;
+
+    for (; written < end; written++)
+        dest[written] = sample(ring->count + written);
+}
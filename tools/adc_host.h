@@ -0,0 +1,47 @@
+/*
+ * adc_host.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host stand-in for the ADC acquisition driver: streams synthetic samples
+ * into an adc_block_ring in blocks, for running the consumers on Linux
+ */
+
+#ifndef ADC_HOST_H_
+#define ADC_HOST_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ADC_HOST_RATE 1000000   // [Hz] sampling rate reported by adc_driver_init()
+#define ADC_HOST_TONES 4        // most tones in the synthetic signal
+
+// synthetic signal, in ADC counts and clipped to 12 bits like the ADC
+typedef struct {
+    double offset;                      // [ADC counts] dc level
+    int tones;                          // tones used
+    double hz[ADC_HOST_TONES];          // [Hz] tone frequencies
+    double amplitude[ADC_HOST_TONES];   // [ADC counts] tone peak amplitudes
+    double noise_rms;                   // [ADC counts] white gaussian noise
+    bool ramp;                          // instead of the above, sample n reads n mod 65536 (beyond 12 bits), to check
+                                        // which samples are read and whether they were overwritten
+} adc_host_signal;
+
+// block size adc_driver_init() gives the ring, a power of 2 (default 1024, the uDMA block on the target)
+void adc_host_block(uint32_t block);
+
+// signal of the following blocks, a 2048-count offset alone before the first call
+void adc_host_signal_set(const adc_host_signal *signal);
+
+// replays n recorded samples, over and over, instead of the signal from the next sample written on (n = 0 goes
+// back to the signal)
+void adc_host_replay(const uint16_t *samples, uint32_t n);
+
+// writes and publishes blocks blocks, as the interrupt would
+void adc_host_run(uint32_t blocks);
+
+// writes the first samples of the block being filled without publishing it, like a uDMA transfer in progress
+void adc_host_partial(uint32_t samples);
+
+#endif /* ADC_HOST_H_ */
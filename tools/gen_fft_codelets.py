@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+#
+# gen_fft_codelets.py
+#
+# ECE 3849 Lab 2
+# Adam Grabowski, Michael Rideout
+#
+# Generates fft_codelets.c/h: size-specific forward complex FFT codelets for
+# the sub-FFT sizes of the real FFT plans, used in place of kiss_fft's
+# generic stage loop (kiss_fft_set_codelet).
+#
+# usage: python3 tools/gen_fft_codelets.py [output directory]
+#
+# Each codelet runs the same butterflies as kiss_fft's iterative engine in the
+# same order, with the same twiddle values as fft_tables.c, so its output is
+# identical to kiss_fft with the flash tables.  The innermost 32 or 64 points
+# (the first three stages) are fully unrolled with constant indexes and
+# twiddles; the remaining outer stages are loops with constant bounds.
+# Fully unrolling a 2048-point transform would take hundreds of KB of flash
+# and gain nothing on a core without an instruction cache.
+
+import os
+import sys
+
+from gen_fft_tables import MIN_NFFT, MAX_NFFT, TW_MACROS, kf_factor, rows, twiddle
+
+LEAF_TW = 64        # leaf twiddles are the 64th roots of unity
+
+
+def stages(n):
+    # (p, m) of every kiss_fft stage of an n-point transform, innermost first
+    return list(reversed(kf_factor(n)))
+
+
+def leaf_size(n):
+    # points covered by the three innermost stages: 64 (4*4*4) or 32 (2*4*4)
+    p = 1
+    for f, m in stages(n)[:3]:
+        p *= f
+    return p
+
+
+def leaf_twiddle(q, u, p, m):
+    # index into leaf_tw of twiddle q*u*fstride of a stage of p*m points
+    return q * u * LEAF_TW // (p * m)
+
+
+def gen_leaf(n):
+    body = []
+    for p, m in stages(n):
+        for base in range(0, n, p * m):
+            for u in range(m):
+                idx = [base + u + q * m for q in range(p)]
+                tw = [leaf_twiddle(q, u, p, m) for q in range(1, p)]
+                if u == 0:
+                    body.append('    BFLY%d_W0(%s);' % (p, ', '.join(map(str, idx))))
+                else:
+                    body.append('    BFLY%d(%s, %s);' % (p, ', '.join(map(str, idx)), ', '.join('leaf_tw[%d]' % t for t in tw)))
+    return '''// %d-point leaf: the stages %s unrolled
+static void leaf_%d(kiss_fft_cpx *F)
+{
+    kiss_fft_cpx s0, s1, s2, s3, s4, s5;
+%s
+}
+''' % (n, ', '.join('%d' % p for p, m in stages(n)), n, '\n'.join(body))
+
+
+def gen_codelet(n):
+    leaf = leaf_size(n)
+    if leaf == n:
+        return '''// %d-point forward FFT of the permuted input
+static void codelet_%d(kiss_fft_cpx *F)
+{
+    leaf_%d(F);
+}
+''' % (n, n, n)
+    outer = ['    stage4(F, %d, %d);' % (n, m) for p, m in stages(n)[3:]]
+    return '''// %d-point forward FFT of the permuted input
+static void codelet_%d(kiss_fft_cpx *F)
+{
+    int b;
+    for (b = 0; b < %d; b += %d)
+        leaf_%d(F + b);
+%s
+}
+''' % (n, n, n, leaf, leaf, '\n'.join(outer))
+
+
+def sizes():
+    n = MIN_NFFT // 2
+    while n <= MAX_NFFT // 2:
+        yield n
+        n *= 2
+
+
+def gen_header():
+    return '''/*
+ * fft_codelets.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Size-specific complex FFT codelets (generated by tools/gen_fft_codelets.py, do not edit)
+ */
+
+#ifndef FFT_CODELETS_H_
+#define FFT_CODELETS_H_
+
+#include "kiss_fft.h"
+
+#define FFT_CODELET_MIN_NFFT %d // smallest complex FFT size with a codelet
+#define FFT_CODELET_MAX_NFFT %d // largest complex FFT size with a codelet
+
+// returns the forward codelet of a complex FFT size for kiss_fft_set_codelet, or NULL if there is none.
+// the codelets use the flash twiddles and match a config from the flash tables exactly
+kiss_fft_codelet fft_codelet_find(int ncfft);
+
+#endif /* FFT_CODELETS_H_ */
+''' % (MIN_NFFT // 2, MAX_NFFT // 2)
+
+
+def gen_source():
+    leaf_tw = [twiddle(k * (MAX_NFFT // 2) // LEAF_TW) for k in range(LEAF_TW)]
+    out = ['''/*
+ * fft_codelets.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Size-specific complex FFT codelets (generated by tools/gen_fft_codelets.py, do not edit)
+ */
+
+#include <stdint.h>
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "fft_codelets.h"
+
+''' + TW_MACROS + '''
+// exp(-2*pi*i*k/%d), the same values as fft_twiddles[k*(FFT_TABLE_MAX_NFFT/2)/%d]
+static const kiss_fft_cpx leaf_tw[%d] = {
+%s
+};
+
+#ifdef FIXED_POINT
+# define C_MUL_W0(m, a) C_MUL(m, a, leaf_tw[0])  // rounds like kiss_fft's multiply by 1
+#else
+# define C_MUL_W0(m, a) ((m) = (a))              // a*(1 + 0i)
+#endif
+
+// forward kf_bfly4 on F[a], F[b], F[c], F[d], given the three twiddle products
+#define BFLY4_MUL(a, b, c, d, MUL1, MUL2, MUL3) do { \\
+        C_FIXDIV(F[a], 4); C_FIXDIV(F[b], 4); C_FIXDIV(F[c], 4); C_FIXDIV(F[d], 4); \\
+        MUL1; MUL2; MUL3; \\
+        C_SUB(s5, F[a], s1); \\
+        C_ADDTO(F[a], s1); \\
+        C_ADD(s3, s0, s2); \\
+        C_SUB(s4, s0, s2); \\
+        C_SUB(F[c], F[a], s3); \\
+        C_ADDTO(F[a], s3); \\
+        F[b].r = s5.r + s4.i; \\
+        F[b].i = s5.i - s4.r; \\
+        F[d].r = s5.r - s4.i; \\
+        F[d].i = s5.i + s4.r; \\
+    } while (0)
+#define BFLY4(a, b, c, d, w1, w2, w3) \\
+    BFLY4_MUL(a, b, c, d, C_MUL(s0, F[b], w1), C_MUL(s1, F[c], w2), C_MUL(s2, F[d], w3))
+#define BFLY4_W0(a, b, c, d) \\
+    BFLY4_MUL(a, b, c, d, C_MUL_W0(s0, F[b]), C_MUL_W0(s1, F[c]), C_MUL_W0(s2, F[d]))
+
+// kf_bfly2 on F[a], F[b], given the twiddle product
+#define BFLY2_MUL(a, b, MUL) do { \\
+        C_FIXDIV(F[a], 2); C_FIXDIV(F[b], 2); \\
+        MUL; \\
+        C_SUB(F[b], F[a], s0); \\
+        C_ADDTO(F[a], s0); \\
+    } while (0)
+#define BFLY2(a, b, w) BFLY2_MUL(a, b, C_MUL(s0, F[b], w))
+#define BFLY2_W0(a, b) BFLY2_MUL(a, b, C_MUL_W0(s0, F[b]))
+
+// forward kf_bfly4 over every 4*m-point block of n points, twiddles from the flash table
+static inline void stage4(kiss_fft_cpx *F, int n, int m)
+{
+    const int fstride = (FFT_TABLE_MAX_NFFT/2)/(4*m);
+    kiss_fft_cpx s0, s1, s2, s3, s4, s5;
+    int b, u;
+
+    for (b = 0; b < n; b += 4*m) {
+        const kiss_fft_cpx *tw1 = fft_twiddles, *tw2 = fft_twiddles, *tw3 = fft_twiddles;
+        for (u = b; u < b + m; u++) {
+            BFLY4(u, u + m, u + 2*m, u + 3*m, *tw1, *tw2, *tw3);
+            tw1 += fstride;
+            tw2 += 2*fstride;
+            tw3 += 3*fstride;
+        }
+    }
+}
+''' % (LEAF_TW, LEAF_TW, LEAF_TW, rows(leaf_tw, 2))]
+
+    for n in sorted(set(leaf_size(n) for n in sizes())):
+        out.append(gen_leaf(n))
+    for n in sizes():
+        out.append(gen_codelet(n))
+
+    out.append('''static const struct {
+    int nfft;
+    kiss_fft_codelet codelet;
+} codelets[] = {
+%s
+};
+
+// returns the forward codelet of a complex FFT size, or NULL
+kiss_fft_codelet fft_codelet_find(int ncfft)
+{
+    int i;
+    for (i = 0; i < (int)(sizeof(codelets)/sizeof(codelets[0])); i++) {
+        if (codelets[i].nfft == ncfft)
+            return codelets[i].codelet;
+    }
+    return NULL;
+}
+''' % '\n'.join('    {%d, codelet_%d},' % (n, n) for n in sizes()))
+    return '\n'.join(out)
+
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    with open(os.path.join(outdir, 'fft_codelets.h'), 'w') as f:
+        f.write(gen_header())
+    with open(os.path.join(outdir, 'fft_codelets.c'), 'w') as f:
+        f.write(gen_source())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+#
+# gen_fft_tables.py
+#
+# ECE 3849 Lab 2
+# Adam Grabowski, Michael Rideout
+#
+# Generates fft_tables.c/h: const twiddle, input permutation and window tables
+# for every supported real FFT size (and the per-stage packed twiddles of
+# KISS_FFT_STAGE_TWIDDLES builds), so the FFT configs can point into flash
+# instead of computing the tables into RAM at task start.
+#
+# usage: python3 tools/gen_fft_tables.py [output directory]
+#
+# The values are computed with the same double-precision expressions as
+# kiss_fft_alloc/kiss_fftr_alloc, and the permutation with the same algorithm
+# as kf_factor/kf_build_swaps, so table-backed and runtime configs agree.
+
+import math
+import os
+import sys
+
+MIN_NFFT = 128      # smallest supported real FFT size
+MAX_NFFT = 8192     # largest supported real FFT size
+
+
+# table values are exact doubles; TW() converts them the way kiss_fft_alloc does
+TW_MACROS = '''// table values are exact doubles; convert them the way kiss_fft_alloc does for the build's scalar type
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define TW_FIX(x) ((kiss_fft_scalar)((long long)(0.5 + 2147483647.0*(x) + 4294967296.0) - 4294967296LL))
+# else
+#  define TW_FIX(x) ((kiss_fft_scalar)((long)(0.5 + 32767.0*(x) + 65536.0) - 65536L))
+# endif
+# define TW(c, s) {TW_FIX(c), TW_FIX(s)}          // floor(.5 + SAMP_MAX*x), as KISS_FFT_COS/SIN
+# define WIN(x) ((fft_window_t)(32767.0*(x) + 0.5)) // Q15, x >= 0
+#else
+# define TW(c, s) {(kiss_fft_scalar)(c), (kiss_fft_scalar)(s)}
+# define WIN(x) ((fft_window_t)(x))
+#endif
+'''
+
+PI = 3.141592653589793238462643383279502884197169399375105820974944
+
+
+def twiddle(k):
+    # entry k of fft_twiddles, exp(-2*pi*i*k/(MAX_NFFT/2))
+    phase = -2 * PI * k / (MAX_NFFT // 2)
+    return 'TW(%r, %r)' % (math.cos(phase), math.sin(phase))
+
+
+def kf_factor(n):
+    # same factorization as kf_factor() in kiss_fft.c: powers of 4, then 2, then odd primes
+    factors = []
+    p = 4
+    floor_sqrt = math.floor(math.sqrt(n))
+    while True:
+        while n % p:
+            if p == 4:
+                p = 2
+            elif p == 2:
+                p = 3
+            else:
+                p += 2
+            if p > floor_sqrt:
+                p = n
+        n //= p
+        factors.append((p, n))
+        if n <= 1:
+            break
+    return factors
+
+
+def kf_build_swaps(nfft):
+    # same permutation as kf_build_swaps() in kiss_fft.c
+    factors = kf_factor(nfft)
+    src = []
+    for j in range(nfft):
+        rem, idx, scale = j, 0, 1
+        for p, m in factors:
+            idx += (rem // m) * scale
+            rem %= m
+            scale *= p
+        src.append(idx)
+
+    swaps = []
+    for j in range(nfft):
+        cur = j
+        while src[cur] != j and src[cur] != cur:
+            nxt = src[cur]
+            swaps.append((cur, nxt))
+            src[cur] = cur
+            cur = nxt
+        src[cur] = cur
+    return swaps
+
+
+def stage_twiddle_indexes(nfft, stride):
+    # same order as kf_build_stage_twiddles() in kiss_fft.c: innermost stage first,
+    # then u major, q = 1..p-1; indexes into a table of nfft*stride roots of unity
+    idx = []
+    for p, m in reversed(kf_factor(nfft)):
+        if p > 5:
+            continue    # generic butterfly, reads the full table
+        fstride = nfft // (p * m) * stride
+        for u in range(m):
+            for q in range(1, p):
+                idx.append(q * u * fstride)
+    return idx
+
+
+def blackman(i, n):
+    return 0.42 - 0.5 * math.cos(2 * math.pi * i / (n - 1)) + 0.08 * math.cos(4 * math.pi * i / (n - 1))
+
+
+def sizes():
+    n = MIN_NFFT
+    while n <= MAX_NFFT:
+        yield n
+        n *= 2
+
+
+def rows(items, per_line, indent='    '):
+    out = []
+    for i in range(0, len(items), per_line):
+        out.append(indent + ', '.join(items[i:i + per_line]) + ',')
+    return '\n'.join(out)
+
+
+def gen_header():
+    return '''/*
+ * fft_tables.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Precomputed FFT tables in flash (generated by tools/gen_fft_tables.py, do not edit)
+ */
+
+#ifndef FFT_TABLES_H_
+#define FFT_TABLES_H_
+
+#include <stdint.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+
+#define FFT_TABLE_MIN_NFFT %d   // smallest real FFT size with tables
+#define FFT_TABLE_MAX_NFFT %d  // largest real FFT size with tables
+
+#ifdef FIXED_POINT
+typedef int16_t fft_window_t;   // Q15 window coefficient
+#else
+typedef float fft_window_t;     // window coefficient
+#endif
+
+// tables for one real FFT size
+typedef struct {
+    int nfft;                       // real FFT size
+    int nswaps;                     // number of swap pairs of the nfft/2-point complex FFT permutation
+    const kiss_fft_index *swaps;    // swap pairs
+    const fft_window_t *window;     // first half of the symmetric Blackman window, w[nfft-1-i] = w[i]
+    const kiss_fft_cpx *stage_twiddles; // packed per-stage twiddles (KISS_FFT_STAGE_TWIDDLES builds), else NULL
+} fft_table_entry;
+
+// exp(-2*pi*i*k/(FFT_TABLE_MAX_NFFT/2)): twiddles of every complex sub-FFT, indexed with a stride
+extern const kiss_fft_cpx fft_twiddles[FFT_TABLE_MAX_NFFT/2];
+
+// -j*exp(-2*pi*i*(k+1)/FFT_TABLE_MAX_NFFT): real FFT split twiddles, indexed with a stride
+extern const kiss_fft_cpx fft_super_twiddles[FFT_TABLE_MAX_NFFT/4];
+
+// returns the tables for a real FFT size, or NULL if the size has none
+const fft_table_entry *fft_table_find(int nfft);
+
+// forward real FFT config that points at the flash tables, mem needs KISS_FFTR_CFG_TABLES_BYTES
+kiss_fftr_cfg fft_table_fftr_alloc(int nfft, void *mem, size_t *lenmem);
+
+#endif /* FFT_TABLES_H_ */
+''' % (MIN_NFFT, MAX_NFFT)
+
+
+def gen_source():
+    out = ['''/*
+ * fft_tables.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Precomputed FFT tables in flash (generated by tools/gen_fft_tables.py, do not edit)
+ */
+
+#include <stdint.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "fft_tables.h"
+
+''' + TW_MACROS + '''
+#ifdef KISS_FFT_STAGE_TWIDDLES
+# define STAGE_TW(t) (t)
+#else
+# define STAGE_TW(t) NULL   // the packed tables are only built with KISS_FFT_STAGE_TWIDDLES
+#endif
+''']
+
+    m = MAX_NFFT // 2
+    tw = [twiddle(k) for k in range(m)]
+    out.append('const kiss_fft_cpx fft_twiddles[FFT_TABLE_MAX_NFFT/2] = {\n%s\n};\n' % rows(tw, 2))
+
+    ncfft = MAX_NFFT // 2
+    sup = []
+    for i in range(MAX_NFFT // 4):
+        phase = -3.14159265358979323846264338327 * ((i + 1) / ncfft + .5)
+        sup.append('TW(%r, %r)' % (math.cos(phase), math.sin(phase)))
+    out.append('const kiss_fft_cpx fft_super_twiddles[FFT_TABLE_MAX_NFFT/4] = {\n%s\n};\n' % rows(sup, 2))
+
+    entries = []
+    for n in sizes():
+        swaps = kf_build_swaps(n // 2)
+        flat = ['%d' % v for pair in swaps for v in pair]
+        out.append('static const kiss_fft_index swaps_%d[%d] = {\n%s\n};\n' % (n, max(len(flat), 1), rows(flat or ['0'], 16)))
+        win = ['WIN(%r)' % blackman(i, n) for i in range(n // 2)]
+        out.append('static const fft_window_t window_%d[%d] = {\n%s\n};\n' % (n, n // 2, rows(win, 4)))
+        stage = [tw[k] for k in stage_twiddle_indexes(n // 2, m // (n // 2))]
+        out.append('#ifdef KISS_FFT_STAGE_TWIDDLES\nstatic const kiss_fft_cpx stage_twiddles_%d[%d] = {\n%s\n};\n#endif\n'
+                   % (n, len(stage), rows(stage, 2)))
+        entries.append('    {%d, %d, swaps_%d, window_%d, STAGE_TW(stage_twiddles_%d)},' % (n, len(swaps), n, n, n))
+
+    out.append('''static const fft_table_entry fft_table_entries[] = {
+%s
+};
+
+// returns the tables for a real FFT size, or NULL if the size has none
+const fft_table_entry *fft_table_find(int nfft)
+{
+    int i;
+    for (i = 0; i < (int)(sizeof(fft_table_entries)/sizeof(fft_table_entries[0])); i++) {
+        if (fft_table_entries[i].nfft == nfft)
+            return &fft_table_entries[i];
+    }
+    return NULL;
+}
+
+// forward real FFT config that points at the flash tables
+kiss_fftr_cfg fft_table_fftr_alloc(int nfft, void *mem, size_t *lenmem)
+{
+    const fft_table_entry *t = fft_table_find(nfft);
+    if (t == NULL)
+        return NULL;
+    return kiss_fftr_alloc_tables(nfft, fft_twiddles, FFT_TABLE_MAX_NFFT/2,
+                                  fft_super_twiddles, FFT_TABLE_MAX_NFFT,
+                                  t->swaps, t->nswaps, t->stage_twiddles, mem, lenmem);
+}
+''' % '\n'.join(entries))
+    return '\n'.join(out)
+
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    with open(os.path.join(outdir, 'fft_tables.h'), 'w') as f:
+        f.write(gen_header())
+    with open(os.path.join(outdir, 'fft_tables.c'), 'w') as f:
+        f.write(gen_source())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,88 @@
+/*
+ * host_test.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Helpers shared by the host tests and benchmarks in tools/: a seeded
+ * random source, a cycle counter and failure bookkeeping
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define HOST_PI 3.14159265358979323846
+
+static uint64_t host_rng = 88172645463325252ull;   // xorshift state, the same sequence every run
+static int host_failures;                           // failed checks so far
+
+// the random sequence from seed
+static inline void host_seed(uint64_t seed)
+{
+    host_rng = seed ? seed : 88172645463325252ull;
+}
+
+// 64 random bits
+static inline uint64_t host_rand(void)
+{
+    host_rng ^= host_rng << 13;
+    host_rng ^= host_rng >> 7;
+    host_rng ^= host_rng << 17;
+    return host_rng;
+}
+
+// uniform in [0, n)
+static inline uint32_t host_rand_below(uint32_t n)
+{
+    return (uint32_t)((host_rand() >> 32)*n >> 32);
+}
+
+// uniform in [0, 1)
+static inline double host_uniform(void)
+{
+    return (host_rand() >> 11)*(1.0/9007199254740992.0);
+}
+
+// timestamp in cycles (the TSC on x86, otherwise nanoseconds)
+static inline uint64_t host_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec*1000000000u + t.tv_nsec;
+#endif
+}
+
+// counts a failure and prints why when ok is false
+static inline void host_check(int ok, const char *format, ...)
+{
+    va_list args;
+
+    if (ok)
+        return;
+    host_failures++;
+    printf("FAIL: ");
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+}
+
+// prints the verdict of the test, returns the exit status
+static inline int host_result(const char *name)
+{
+    printf("%s: %s (%d failed checks)\n", name, host_failures ? "FAIL" : "pass", host_failures);
+    return host_failures ? 1 : 0;
+}
+
+#endif /* HOST_TEST_H_ */
@@ -0,0 +1,165 @@
+/*
+ * test_adc_block.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host stress test of the block ADC ring: a pthread producer streams a ramp
+ * through adc_host.c as fast as it can while the consumer snapshots and
+ * borrows random spans at random depths behind the sequence, and the 64-bit
+ * sequence crosses 2^32. Every read reported intact must hold exactly the
+ * samples asked for, every read of samples already overwritten or not yet
+ * published must be refused. The cycles of the uncontended reads are printed
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include "adc_block.h"
+#include "adc_host.h"
+#include "host_test.h"
+
+#define RING_SIZE 16384         // ADC ring
+#define READS 200000            // snapshots and borrows per block size
+#define MAX_READ 8192           // [samples] longest read
+#define SLOW_SPIN 20000         // busy loop inside every SLOW_EVERY-th borrow, a consumer the ring laps
+#define SLOW_EVERY 7
+#define WRAP_BLOCKS 64          // blocks the producer starts before the low word of the sequence wraps
+#define BENCH_RUNS 100000
+
+static volatile uint16_t buffer[RING_SIZE];
+static uint16_t dest[MAX_READ];
+static adc_block_ring ring;
+static volatile int stop;       // set by the consumer to end the producer
+
+// the driver interrupt at full speed: a block in two parts, yielding now and then
+static void *producer(void *arg)
+{
+    uint32_t blocks = 0;
+
+    (void)arg;
+    while (!stop) {
+        adc_host_partial(97); // a transfer in progress
+        adc_host_run(1);
+        if ((++blocks & 7) == 0)
+            sched_yield();
+    }
+    return NULL;
+}
+
+// index of the first sample of the n read from first on that is not the ramp, n if all are
+static uint32_t ramp_check(const volatile uint16_t *x, uint32_t n, uint64_t first)
+{
+    uint32_t i;
+    for (i = 0; i < n; i++)
+        if (x[i] != (uint16_t)(first + i))
+            break;
+    return i;
+}
+
+// whether sample first is already beyond the reach of the reads at sequence
+static bool overwritten(uint64_t first, uint64_t sequence)
+{
+    return first + RING_SIZE < sequence + ADC_BLOCKS_IN_FLIGHT*ring.block;
+}
+
+// READS random reads against the producer thread with blocks of block samples
+static void stress(uint32_t block)
+{
+    static const adc_host_signal ramp = {0, 0, {0}, {0}, 0, true};
+    long intact = 0, refused = 0, late = 0, lapped = 0;
+    uint64_t start, last;
+    pthread_t thread;
+    int i;
+
+    adc_host_block(block);
+    adc_driver_init(&ring, buffer, RING_SIZE);
+    adc_host_signal_set(&ramp);
+    ring.count = 0u - WRAP_BLOCKS*block; // the low word wraps early in the run
+    start = last = adc_block_sequence(&ring);
+    stop = 0;
+    host_check(pthread_create(&thread, NULL, producer, NULL) == 0, "pthread_create failed");
+    while (adc_block_sequence(&ring) < start + RING_SIZE)
+        sched_yield();
+
+    for (i = 0; i < READS; i++) {
+        uint64_t sequence = adc_block_sequence(&ring), end;
+        uint32_t n = 1 + host_rand_below(MAX_READ), depth = host_rand_below(RING_SIZE + 2*block);
+        bool ok;
+
+        host_check(sequence >= last && sequence % block == 0, "block %u: sequence %llu after %llu", block,
+                   (unsigned long long)sequence, (unsigned long long)last);
+        last = sequence;
+        end = sequence + block - depth; // up to a block not yet published, down to well overwritten
+        if (end < start + n)
+            continue;
+        if (i & 1) {
+            ok = adc_block_snapshot(&ring, end, n, dest);
+            if (ok)
+                host_check(ramp_check(dest, n, end - n) == n, "block %u: snapshot of %u before %llu reported "
+                           "intact, sample %u wrong", block, n, (unsigned long long)end, ramp_check(dest, n, end - n));
+        } else {
+            adc_span span;
+            uint32_t good = 0;
+
+            ok = adc_block_borrow(&ring, end, n, &span);
+            if (ok) {
+                good = ramp_check(span.part[0], span.len[0], span.first);
+                if (good == span.len[0])
+                    good += ramp_check(span.part[1], span.len[1], span.first + span.len[0]);
+                if (i % SLOW_EVERY == 0) {
+                    volatile int spin;
+                    for (spin = 0; spin < SLOW_SPIN; spin++)
+                        ;
+                }
+                ok = adc_block_release(&ring, &span);
+                lapped += !ok;
+                host_check(!ok || good == n, "block %u: borrow of %u before %llu released intact, sample %u wrong",
+                           block, n, (unsigned long long)end, good);
+            }
+        }
+        // refused the reads it had to: overwritten before the read began, or still unpublished after it
+        host_check(!ok || (!overwritten(end - n, sequence) && end <= adc_block_sequence(&ring)), "block %u: read of "
+                   "%u before %llu accepted at sequence %llu", block, n, (unsigned long long)end,
+                   (unsigned long long)sequence);
+        intact += ok;
+        refused += !ok && end <= sequence;
+        late += !ok && end > sequence;
+    }
+    stop = 1;
+    pthread_join(thread, NULL);
+
+    last = adc_block_sequence(&ring);
+    printf("%6u %12llu %10ld %10ld %10ld %10ld\n", block, (unsigned long long)(last - start), intact, refused, late,
+           lapped);
+    host_check(last >> 32 == 1 && ring.count_hi == 1, "block %u: sequence %llu did not cross 2^32", block,
+               (unsigned long long)last);
+}
+
+int main(void)
+{
+    static const uint32_t blocks[] = {8, 64, 1024};
+    uint64_t sequence, t0, t1, t2;
+    unsigned b;
+    int i, valid = 0, copied = 0;
+
+    printf("%6s %12s %10s %10s %10s %10s\n", "block", "samples", "intact", "refused", "unpublished", "lapped");
+    for (b = 0; b < sizeof(blocks)/sizeof(blocks[0]); b++)
+        stress(blocks[b]);
+
+    // cycles of one validate and one 1024-sample snapshot with no producer running
+    sequence = adc_block_sequence(&ring);
+    t0 = host_cycles();
+    for (i = 0; i < BENCH_RUNS; i++)
+        valid += adc_block_valid(&ring, sequence - 1024);
+    t1 = host_cycles();
+    for (i = 0; i < BENCH_RUNS; i++)
+        copied += adc_block_snapshot(&ring, sequence, 1024, dest);
+    t2 = host_cycles();
+    host_check(valid == BENCH_RUNS && copied == BENCH_RUNS, "uncontended reads refused");
+    printf("cycles: adc_block_valid %.1f, adc_block_snapshot of 1024 samples %.0f\n", (double)(t1 - t0)/BENCH_RUNS,
+           (double)(t2 - t1)/BENCH_RUNS);
+    return host_result("test_adc_block");
+}
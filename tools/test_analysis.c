@@ -0,0 +1,153 @@
+/*
+ * test_analysis.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the dynamic-performance measurement: synthetic ADC captures of
+ * a tone with known harmonics and Gaussian noise through window_apply,
+ * kiss_fftr and analysis_run, against the THD, SNR, SINAD, SFDR and ENOB the
+ * signal was built with, for several windows and sizes. Built once per number
+ * format; the Q15 FFT rounds a noise floor this far below full scale away, so
+ * that build checks the larger harmonics only and that the noise figures of
+ * the captures with the quietest floors are reported as not measured
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "fft_tables.h"
+#include "window.h"
+#include "analysis.h"
+#include "host_test.h"
+
+#define RING_SIZE 16384         // ADC ring
+#define ADC_RATE 1000000        // [Hz]
+#define BENCH_RUNS 2000
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+#  define TOLERANCE 0.5         // [dB] of THD, SNR and SINAD, 1 dB more for SFDR
+#  define MIN_THD -200          // [dBc] captures with less THD are not checked for it
+#  define MAX_SNR 200           // [dB] captures with more SNR have their noise rounded away
+# else
+#  define FORMAT "Q15"
+#  define TOLERANCE 1.5
+#  define MIN_THD -46           // the Q15 FFT rounds smaller harmonics of a 4096-point frame away
+#  define MAX_SNR 55            // and the noise of these 4096- and 8192-point captures, not of the 1024-point ones
+# endif
+#else
+# define FORMAT "float"
+# define TOLERANCE 0.5
+# define MIN_THD -200
+# define MAX_SNR 200
+#endif
+
+// one synthetic capture: fundamental, its 2nd and 3rd harmonics and noise
+typedef struct {
+    int nfft;
+    window_type window;
+    double f0;                  // [Hz]
+    double amplitude;           // [ADC counts]
+    double h2_dbc, h3_dbc;      // [dBc]
+    double sigma;               // [ADC counts] rms of the Gaussian noise
+} capture;
+
+static uint16_t ring[RING_SIZE];
+static kiss_fft_cpx buf[FFT_TABLE_MAX_NFFT/2 + 1];
+static fft_window_t ram[FFT_TABLE_MAX_NFFT/2];
+
+// fills the ring with capture c, returns the variance of noise plus ADC rounding over the frame
+static double signal_make(const capture *c)
+{
+    double a2 = c->amplitude*pow(10, c->h2_dbc/20), a3 = c->amplitude*pow(10, c->h3_dbc/20), noise = 0;
+    int i;
+    for (i = 0; i < RING_SIZE; i++) {
+        double t = (double)i/ADC_RATE;
+        double s = c->amplitude*cos(2*HOST_PI*c->f0*t + 0.3) + a2*cos(2*HOST_PI*2*c->f0*t + 1.1) +
+                   a3*cos(2*HOST_PI*3*c->f0*t + 2.0);
+        double g = sqrt(-2*log(1 - host_uniform()))*cos(2*HOST_PI*host_uniform());
+        ring[i] = (uint16_t)floor(2048 + s + c->sigma*g + 0.5);
+        if (i < c->nfft)
+            noise += (ring[i] - 2048 - s)*(ring[i] - 2048 - s);
+    }
+    return noise/c->nfft;
+}
+
+// window, FFT and analysis_run of the frame at the start of the ring
+static void measure(const capture *c, analysis_result *r, window_table *wt)
+{
+    kiss_fftr_cfg cfg = kiss_fftr_alloc(c->nfft, 0, NULL, NULL);
+    float scale = 1;
+    int shift;
+
+    window_init(wt, c->window, WINDOW_KAISER_BETA, c->nfft, ram);
+    shift = window_apply(wt, ring, RING_SIZE, 0, 2048, (kiss_fft_scalar *)buf);
+    kiss_fftr(cfg, (kiss_fft_scalar *)buf, buf);
+#ifdef FIXED_POINT
+    scale = ldexpf((float)c->nfft*c->nfft, 2*shift - 2*WINDOW_Q); // as spectrumPowerScale() in sampling.c
+#else
+    (void)shift;
+#endif
+    analysis_run(r, buf, 0, c->nfft/2, c->nfft, ADC_RATE, wt, scale);
+    free(cfg);
+}
+
+int main(void)
+{
+    static const window_type windows[] = {WINDOW_BLACKMAN, WINDOW_BLACKMAN_HARRIS, WINDOW_FLATTOP, WINDOW_KAISER};
+    capture captures[3*4 + 1];
+    analysis_result r;
+    window_table wt;
+    int n = 0, i, w;
+
+    for (w = 0; w < 4; w++) {
+        captures[n++] = (capture){4096, windows[w], 20312.7, 1500, -50, -60, 1.0};
+        captures[n++] = (capture){4096, windows[w], 310734.1, 1500, -45, -55, 1.0}; // harmonics alias below fs/2
+        captures[n++] = (capture){1024, windows[w], 50000, 1000, -40, -70, 2.0};    // on a bin
+    }
+    captures[n++] = (capture){8192, WINDOW_BLACKMAN_HARRIS, 20001.3, 1800, -60, -66, 0.5};
+
+    printf("%s build, measured (expected)\n%5s %-8s %9s %15s %15s %15s %15s %13s\n", FORMAT, "nfft", "window", "f0",
+           "THD dBc", "SNR dB", "SINAD dB", "SFDR dB", "ENOB");
+    for (i = 0; i < n; i++) {
+        const capture *c = &captures[i];
+        double noise = 2*signal_make(c); // relative to the fundamental power A^2/2
+        double harmonics = pow(10, c->h2_dbc/10) + pow(10, c->h3_dbc/10);
+        double thd = 10*log10(harmonics), snr = 10*log10(c->amplitude*c->amplitude/noise);
+        double sinad = -10*log10(harmonics + noise/(c->amplitude*c->amplitude));
+        double sfdr = -fmax(c->h2_dbc, c->h3_dbc), enob = (sinad - 1.76)/6.02;
+
+        measure(c, &r, &wt);
+        printf("%5d %-8s %9.1f %6.2f (%6.2f) %6.2f (%6.2f) %6.2f (%6.2f) %6.2f (%6.2f) %5.2f (%5.2f)\n", c->nfft,
+               gWindowNameStr[c->window], r.f0_hz, r.thd_db, thd, r.snr_db, snr, r.sinad_db, sinad, r.sfdr_db, sfdr,
+               r.enob, enob);
+        host_check(r.valid, "nfft %d %s: no fundamental", c->nfft, gWindowNameStr[c->window]);
+        host_check(fabs(r.f0_hz - c->f0) <= 0.05*ADC_RATE/c->nfft &&
+                   fabs(r.amplitude - c->amplitude) <= 0.01*c->amplitude, "nfft %d %s: fundamental %.1f Hz %.2f counts",
+                   c->nfft, gWindowNameStr[c->window], r.f0_hz, r.amplitude);
+        host_check(thd < MIN_THD || fabs(r.thd_db - thd) <= TOLERANCE, "nfft %d %s: THD off by %.2f dB",
+                   c->nfft, gWindowNameStr[c->window], r.thd_db - thd);
+        if (snr < MAX_SNR) {
+            host_check(r.noise_valid && fabs(r.snr_db - snr) <= TOLERANCE + 0.5 &&
+                       fabs(r.sinad_db - sinad) <= TOLERANCE && fabs(r.sfdr_db - sfdr) <= TOLERANCE + 1 &&
+                       fabs(r.enob - enob) <= TOLERANCE/6, "nfft %d %s: noise figures off", c->nfft,
+                       gWindowNameStr[c->window]);
+        } else { // nothing left of the noise to measure: no figures rather than an SNR of 200 dB
+            host_check(!r.noise_valid && r.snr_db == ANALYSIS_DB_NONE && r.sinad_db == ANALYSIS_DB_NONE &&
+                       r.enob == ANALYSIS_DB_NONE && r.noise_dbc_hz == ANALYSIS_DB_NONE,
+                       "nfft %d %s: noise below the FFT rounding reported as SNR %.2f dB", c->nfft,
+                       gWindowNameStr[c->window], r.snr_db);
+        }
+    }
+
+    // cycles of one analysis of 2049 bins
+    uint64_t t0 = host_cycles();
+    for (i = 0; i < BENCH_RUNS; i++)
+        analysis_run(&r, buf, 0, 4096/2, 4096, ADC_RATE, &wt, 1);
+    printf("analysis_run of 2049 bins: %.0f cycles\n", (double)(host_cycles() - t0)/BENCH_RUNS);
+    return host_result("test_analysis " FORMAT);
+}
@@ -0,0 +1,108 @@
+/*
+ * test_codelets.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the generated FFT codelets: every sub-FFT size of the flash
+ * tables with and without its codelet installed, as the plan cache sets it
+ * up, for the complex sub-FFT and the real FFT around it. Both must give
+ * bit-identical output; the cycles of both are printed
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "fft_codelets.h"
+#include "host_test.h"
+
+#define TRIALS 20               // random inputs per size
+#define BENCH_SAMPLES 2000000   // [samples] transformed per size and path
+#define BENCH_TRIES 5           // the best of these is printed
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+# else
+#  define FORMAT "Q15"
+# endif
+#else
+# define FORMAT "float"
+#endif
+
+static kiss_fft_cpx in[FFT_CODELET_MAX_NFFT];
+static kiss_fft_cpx out_generic[FFT_CODELET_MAX_NFFT + 1], out_codelet[FFT_CODELET_MAX_NFFT + 1];
+
+// random input of n complex points, or 2n real samples
+static void input_make(int n)
+{
+    int k;
+    for (k = 0; k < n; k++) {
+#ifdef FIXED_POINT
+        in[k].r = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+        in[k].i = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+#else
+        in[k].r = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+        in[k].i = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+#endif
+    }
+}
+
+// best cycles per complex transform of cfg
+static double bench(kiss_fft_cfg cfg, int n)
+{
+    int t, r, runs = BENCH_SAMPLES/n;
+    double best = 0;
+    for (t = 0; t < BENCH_TRIES; t++) {
+        uint64_t t0 = host_cycles();
+        for (r = 0; r < runs; r++)
+            kiss_fft(cfg, in, out_generic);
+        double c = (double)(host_cycles() - t0)/runs;
+        best = (t == 0 || c < best) ? c : best;
+    }
+    return best;
+}
+
+int main(void)
+{
+    static char mem_generic[KISS_FFTR_CFG_TABLES_BYTES], mem_codelet[KISS_FFTR_CFG_TABLES_BYTES];
+    int n, t;
+
+    printf("%s build\n%6s %12s %12s %8s\n", FORMAT, "ncfft", "generic cyc", "codelet cyc", "speedup");
+    for (n = FFT_CODELET_MIN_NFFT; n <= FFT_CODELET_MAX_NFFT; n *= 2) {
+        size_t len = sizeof(mem_generic);
+        kiss_fftr_cfg generic = fft_table_fftr_alloc(2*n, mem_generic, &len);
+        len = sizeof(mem_codelet);
+        kiss_fftr_cfg codelet = fft_table_fftr_alloc(2*n, mem_codelet, &len);
+        kiss_fft_codelet c = fft_codelet_find(n);
+        int complex_same = 1, real_same = 1;
+        double cycles_generic, cycles_codelet;
+
+        host_check(generic != NULL && codelet != NULL && c != NULL, "ncfft %d: no flash tables or codelet", n);
+        if (generic == NULL || codelet == NULL || c == NULL)
+            continue;
+        kiss_fft_set_codelet(codelet->substate, c); // as fft_plan_get() installs it
+
+        for (t = 0; t < TRIALS; t++) {
+            input_make(n);
+            kiss_fft(generic->substate, in, out_generic);
+            kiss_fft(codelet->substate, in, out_codelet);
+            complex_same = complex_same && memcmp(out_generic, out_codelet, n*sizeof(kiss_fft_cpx)) == 0;
+            kiss_fftr(generic, (const kiss_fft_scalar *)in, out_generic);
+            kiss_fftr(codelet, (const kiss_fft_scalar *)in, out_codelet);
+            real_same = real_same && memcmp(out_generic, out_codelet, (n + 1)*sizeof(kiss_fft_cpx)) == 0;
+        }
+        host_check(complex_same, "ncfft %d: the codelet changes the complex FFT", n);
+        host_check(real_same, "nfft %d: the codelet changes the real FFT", 2*n);
+
+        cycles_generic = bench(generic->substate, n);
+        cycles_codelet = bench(codelet->substate, n);
+        printf("%6d %12.0f %12.0f %7.2fx\n", n, cycles_generic, cycles_codelet, cycles_generic/cycles_codelet);
+    }
+    host_check(fft_codelet_find(FFT_CODELET_MIN_NFFT/2) == NULL && fft_codelet_find(FFT_CODELET_MAX_NFFT*2) == NULL &&
+               fft_codelet_find(FFT_CODELET_MIN_NFFT + 1) == NULL, "fft_codelet_find: codelet for an unsupported size");
+    return host_result("test_codelets " FORMAT);
+}
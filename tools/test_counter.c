@@ -0,0 +1,154 @@
+/*
+ * test_counter.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the frequency counter: counter_fft on random tones across the
+ * band for every window and several sizes, against the frequency and
+ * amplitude they were built with; counter_zero_cross on random tones and a
+ * filtered square wave. Built once per number format
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "fft_tables.h"
+#include "window.h"
+#include "counter.h"
+#include "host_test.h"
+
+#define RING_SIZE 16384         // ADC ring
+#define ADC_RATE 1000000        // [Hz]
+#define NOISE 1.0               // [ADC counts] rms of the Gaussian noise
+#define TONES 40                // random tones per window and size
+#define ZC_TONES 100            // random tones for the zero-crossing counter
+#define ZC_SAMPLES 8192
+#define ZC_HYSTERESIS 20        // [ADC counts]
+#define MAX_ZC_ERROR 1.0        // [Hz]
+#define MAX_AMPLITUDE_ERROR 0.005 // relative, counter_fft amplitude
+#define SQUARE_HZ 20000.37
+#define BENCH_RUNS 2000
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+#  define MAX_BIN_ERROR 0.005   // [bins] counter_fft frequency
+# else
+#  define FORMAT "Q15"
+#  define MAX_BIN_ERROR 0.01
+# endif
+#else
+# define FORMAT "float"
+# define MAX_BIN_ERROR 0.005
+#endif
+
+static uint16_t ring[RING_SIZE];
+static kiss_fft_cpx buf[FFT_TABLE_MAX_NFFT/2 + 1];
+static fft_window_t ram[FFT_TABLE_MAX_NFFT/2];
+
+// Gaussian noise of NOISE counts rms
+static double noise(void)
+{
+    return NOISE*sqrt(-2*log(1 - host_uniform()))*cos(2*HOST_PI*host_uniform());
+}
+
+// fills the ring with a tone, continuous from ring index first on around the end of the ring
+static void tone_make(double f, double amplitude, double phase, uint32_t first)
+{
+    int i;
+    for (i = 0; i < RING_SIZE; i++)
+        ring[(first + i) & (RING_SIZE - 1)] =
+            (uint16_t)floor(2048 + amplitude*cos(2*HOST_PI*f*i/ADC_RATE + phase) + noise() + 0.5);
+}
+
+// window and FFT of the frame at first, then counter_fft over the whole band
+static void fft_count(counter_result *r, kiss_fftr_cfg cfg, const window_table *wt, int nfft, uint32_t first)
+{
+    int shift = window_apply(wt, ring, RING_SIZE, (int32_t)first, 2048, (kiss_fft_scalar *)buf);
+    float scale = 1;
+    kiss_fftr(cfg, (kiss_fft_scalar *)buf, buf);
+#ifdef FIXED_POINT
+    scale = ldexpf((float)nfft*nfft, 2*shift - 2*WINDOW_Q); // as spectrumPowerScale() in sampling.c
+#else
+    (void)shift;
+#endif
+    counter_fft(r, buf, 0, nfft/2, nfft, ADC_RATE, wt, scale);
+}
+
+int main(void)
+{
+    static const int sizes[] = {1024, 4096, 8192};
+    counter_result r;
+    window_table wt;
+    double zc_error = 0;
+    int w, s, t, h, i;
+
+    printf("%s build\n%-9s %5s %14s %16s\n", FORMAT, "window", "nfft", "worst bins", "worst amplitude");
+    for (w = 0; w < WINDOW_COUNT; w++) {
+        for (s = 0; s < (int)(sizeof(sizes)/sizeof(sizes[0])); s++) {
+            int nfft = sizes[s];
+            kiss_fftr_cfg cfg = kiss_fftr_alloc(nfft, 0, NULL, NULL);
+            double bin_error = 0, amplitude_error = 0;
+
+            window_init(&wt, (window_type)w, WINDOW_KAISER_BETA, nfft, ram);
+            for (t = 0; t < TONES; t++) {
+                double f = (10 + host_uniform()*(nfft/2 - 20))*ADC_RATE/nfft; // clear of dc and fs/2
+                double amplitude = 300 + host_uniform()*1500;
+                tone_make(f, amplitude, 2*HOST_PI*host_uniform(), 0);
+                fft_count(&r, cfg, &wt, nfft, 0);
+                host_check(r.valid, "%s nfft %d: no peak for %.1f Hz", gWindowNameStr[w], nfft, f);
+                bin_error = fmax(bin_error, fabs(r.fft_hz - f)*nfft/ADC_RATE);
+                amplitude_error = fmax(amplitude_error, fabs(r.amplitude - amplitude)/amplitude);
+            }
+            printf("%-9s %5d %14.5f %15.3f%%\n", gWindowNameStr[w], nfft, bin_error, 100*amplitude_error);
+            host_check(bin_error <= MAX_BIN_ERROR, "%s nfft %d: frequency off by %.4f bins", gWindowNameStr[w], nfft,
+                       bin_error);
+            host_check(amplitude_error <= MAX_AMPLITUDE_ERROR, "%s nfft %d: amplitude off by %.3f%%",
+                       gWindowNameStr[w], nfft, 100*amplitude_error);
+            free(cfg);
+        }
+    }
+
+    // zero crossings of random tones, the frame wraps around the end of the ring
+    for (t = 0; t < ZC_TONES; t++) {
+        double f = 500 + host_uniform()*(100000 - 500);
+        tone_make(f, 300 + host_uniform()*1500, 2*HOST_PI*host_uniform(), RING_SIZE - ZC_SAMPLES/2);
+        counter_zero_cross(&r, ring, RING_SIZE, RING_SIZE - ZC_SAMPLES/2, ZC_SAMPLES, 2048, ZC_HYSTERESIS, ADC_RATE);
+        host_check(r.zc_valid, "zero crossings: nothing timed at %.1f Hz", f);
+        zc_error = fmax(zc_error, fabs(r.zc_hz - f));
+    }
+    printf("zero crossings over %d samples, 0.5 to 100 kHz: worst %.4f Hz\n", ZC_SAMPLES, zc_error);
+    host_check(zc_error <= MAX_ZC_ERROR, "zero crossings off by %.4f Hz", zc_error);
+
+    // a square wave through a lowpass: both methods on the fundamental
+    for (i = 0; i < RING_SIZE; i++) {
+        double x = 0;
+        for (h = 1; h*SQUARE_HZ < ADC_RATE/2; h += 2)
+            x += 4/HOST_PI*1000/h*sin(2*HOST_PI*h*SQUARE_HZ*i/ADC_RATE)/(1 + h*h*0.01);
+        ring[i] = (uint16_t)floor(2048 + x + noise() + 0.5);
+    }
+    kiss_fftr_cfg cfg = kiss_fftr_alloc(FFT_TABLE_MAX_NFFT, 0, NULL, NULL);
+    window_init(&wt, WINDOW_BLACKMAN_HARRIS, WINDOW_KAISER_BETA, FFT_TABLE_MAX_NFFT, ram);
+    fft_count(&r, cfg, &wt, FFT_TABLE_MAX_NFFT, RING_SIZE - FFT_TABLE_MAX_NFFT);
+    counter_zero_cross(&r, ring, RING_SIZE, RING_SIZE - ZC_SAMPLES, ZC_SAMPLES, 2048, ZC_HYSTERESIS, ADC_RATE);
+    printf("square wave %.2f Hz: FFT %.3f Hz, zero crossings %.3f Hz over %d periods\n", SQUARE_HZ, r.fft_hz, r.zc_hz,
+           r.zc_periods);
+    host_check(fabs(r.fft_hz - SQUARE_HZ) <= MAX_ZC_ERROR && fabs(r.zc_hz - SQUARE_HZ) <= MAX_ZC_ERROR,
+               "square wave: FFT %.3f Hz, zero crossings %.3f Hz", r.fft_hz, r.zc_hz);
+
+    // cycles of one reading each
+    uint64_t t0 = host_cycles(), t1, t2;
+    for (i = 0; i < BENCH_RUNS; i++)
+        counter_fft(&r, buf, 0, FFT_TABLE_MAX_NFFT/2, FFT_TABLE_MAX_NFFT, ADC_RATE, &wt, 1);
+    t1 = host_cycles();
+    for (i = 0; i < BENCH_RUNS; i++)
+        counter_zero_cross(&r, ring, RING_SIZE, RING_SIZE - ZC_SAMPLES, ZC_SAMPLES, 2048, ZC_HYSTERESIS, ADC_RATE);
+    t2 = host_cycles();
+    printf("cycles: counter_fft of %d bins %.0f, counter_zero_cross of %d samples %.0f\n", FFT_TABLE_MAX_NFFT/2 + 1,
+           (double)(t1 - t0)/BENCH_RUNS, ZC_SAMPLES, (double)(t2 - t1)/BENCH_RUNS);
+    free(cfg);
+    return host_result("test_counter " FORMAT);
+}
@@ -0,0 +1,132 @@
+/*
+ * test_czt.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the chirp-z transform (float build only): bins of bands of
+ * any start and spacing, complex and real input, against a direct DFT in
+ * double precision; the any-length DFT against kiss_fft, and the cycles of
+ * both
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "czt.h"
+#include "host_test.h"
+
+#define TOLERANCE 1e-5          // largest bin error relative to the rms of the input times sqrt(n)
+#define RANDOM_BANDS 40
+#define MAX_RANDOM_N 1024       // largest random band, the direct DFT costs n*m
+#define BENCH_TRIES 20          // the best of these is printed
+
+static char mem[1 << 18];
+static kiss_fft_cpx x[CZT_MAX_L], X[CZT_MAX_L], Y[CZT_MAX_L];
+static kiss_fft_scalar xr[CZT_MAX_L];
+
+// largest error of out against the direct DFT of in (or of xr for real input) at f_start + k*f_step, relative
+static double compare_dft(int n, int m, double f_start, double f_step, const kiss_fft_cpx *out, int real)
+{
+    double diff = 0, rms = 0;
+    int i, k;
+
+    for (i = 0; i < n; i++)
+        rms += real ? (double)xr[i]*xr[i] : (double)x[i].r*x[i].r + (double)x[i].i*x[i].i;
+    for (k = 0; k < m; k++) {
+        double f = f_start + k*f_step, re = 0, im = 0;
+        for (i = 0; i < n; i++) {
+            double phase = -2*HOST_PI*fmod(f*i, 1.0);
+            double a = real ? xr[i] : x[i].r, b = real ? 0 : x[i].i;
+            re += a*cos(phase) - b*sin(phase);
+            im += a*sin(phase) + b*cos(phase);
+        }
+        diff = fmax(diff, hypot(out[k].r - re, out[k].i - im));
+    }
+    return diff/sqrt(rms);
+}
+
+// random complex samples in x and real ones in xr
+static void input_make(int n)
+{
+    int i;
+    for (i = 0; i < n; i++) {
+        x[i].r = (float)(host_uniform() - 0.5);
+        x[i].i = (float)(host_uniform() - 0.5);
+        xr[i] = (float)(host_uniform() - 0.5);
+    }
+}
+
+// one band through czt_execute and czt_execute_real
+static void check_band(const czt_plan *p, const char *what)
+{
+    double d;
+    input_make(p->n);
+    czt_execute(p, x, X);
+    d = compare_dft(p->n, p->m, p->f_start, p->f_step, X, 0);
+    host_check(d <= TOLERANCE, "%s n %d m %d f %g + k*%g: off by %g", what, p->n, p->m, p->f_start, p->f_step, d);
+    czt_execute_real(p, xr, X);
+    d = compare_dft(p->n, p->m, p->f_start, p->f_step, X, 1);
+    host_check(d <= TOLERANCE, "%s real n %d m %d f %g + k*%g: off by %g", what, p->n, p->m, p->f_start, p->f_step,
+               d);
+}
+
+int main(void)
+{
+    static const struct { int n, m; double f_start, f_step; } bands[] = {
+        {1, 1, 0, 0}, {3, 7, 0.25, 0.1}, {100, 50, 0.1, 0.001}, {1000, 3000, -0.5, 1.0/3000},
+        {4000, 97, 0.3, 1e-5}, {2048, 256, 0.015, 0.01/255}};
+    static const int dft_sizes[] = {777, 1000, 1021, 2039, 2048};
+    czt_plan p;
+    int i;
+
+    // fixed and random bands
+    for (i = 0; i < (int)(sizeof(bands)/sizeof(bands[0])); i++) {
+        int ok = czt_init(&p, bands[i].n, bands[i].m, bands[i].f_start, bands[i].f_step, mem, sizeof(mem));
+        host_check(ok, "czt_init n %d m %d failed", bands[i].n, bands[i].m);
+        if (ok)
+            check_band(&p, "czt_init");
+    }
+    for (i = 0; i < RANDOM_BANDS; i++) {
+        int n = 1 + host_rand_below(MAX_RANDOM_N), m = 1 + host_rand_below(MAX_RANDOM_N);
+        double fs = 1e6, f_lo = host_uniform()*fs/2, f_hi = f_lo + host_uniform()*(fs/2 - f_lo);
+        int ok = czt_init_span(&p, n, m, (float)fs, (float)f_lo, (float)f_hi, mem, sizeof(mem));
+        host_check(ok, "czt_init_span n %d m %d failed", n, m);
+        if (ok)
+            check_band(&p, "czt_init_span");
+    }
+    host_check(czt_mem_size(4000, 98) == 0 && !czt_init(&p, 4000, 98, 0, 0, mem, sizeof(mem)),
+               "n + m - 1 > CZT_MAX_L accepted");
+    host_check(!czt_init(&p, 100, 50, 0, 0.01, mem, czt_mem_size(100, 50) - 1), "too small mem accepted");
+
+    // any-length DFT against kiss_fft, which runs the generic radix for the prime factors
+    printf("%6s %10s %12s %12s\n", "n", "max diff", "kiss cyc", "czt cyc");
+    for (i = 0; i < (int)(sizeof(dft_sizes)/sizeof(dft_sizes[0])); i++) {
+        int n = dft_sizes[i], k, t;
+        kiss_fft_cfg cfg = kiss_fft_alloc(n, 0, NULL, NULL);
+        double diff = 0, peak = 0, kiss = 0, czt = 0;
+
+        host_check(czt_init_dft(&p, n, mem, sizeof(mem)), "czt_init_dft %d failed", n);
+        input_make(n);
+        kiss_fft(cfg, x, X);
+        czt_execute(&p, x, Y);
+        for (k = 0; k < n; k++) {
+            diff = fmax(diff, hypot(X[k].r - Y[k].r, X[k].i - Y[k].i));
+            peak = fmax(peak, hypot(X[k].r, X[k].i));
+        }
+        host_check(diff <= TOLERANCE*peak, "czt_init_dft %d: off by %g of the peak bin", n, diff/peak);
+        for (t = 0; t < BENCH_TRIES; t++) {
+            uint64_t t0 = host_cycles(), t1, t2;
+            kiss_fft(cfg, x, X);
+            t1 = host_cycles();
+            czt_execute(&p, x, Y);
+            t2 = host_cycles();
+            kiss = (t == 0 || t1 - t0 < kiss) ? (double)(t1 - t0) : kiss;
+            czt = (t == 0 || t2 - t1 < czt) ? (double)(t2 - t1) : czt;
+        }
+        printf("%6d %10.3g %12.0f %12.0f\n", n, diff/peak, kiss, czt);
+        free(cfg);
+    }
+    return host_result("test_czt");
+}
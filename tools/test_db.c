@@ -0,0 +1,228 @@
+/*
+ * test_db.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the log2/dB and magnitude kernels of dsp_math: ilog2_q16,
+ * ilog2_q16_u64, fast_log2_q16 and fast_db swept over their input range
+ * against log2() and 10*log10(), power_to_db on bins of every magnitude of
+ * the build's format against 10*log10(), and amb_mag/amb_magf against
+ * hypot(). Built once per number format; the cycles of fast_log2_q16 and
+ * power_to_db against log10f are printed
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "_kiss_fft_guts.h"
+#include "dsp_math.h"
+#include "host_test.h"
+
+#define MAX_LOG2_ERROR (1.0/4096)   // the |error| < 2^-12 dsp_math.h promises
+#define MAX_DB_ERROR 0.002          // [dB] 2^-12 of log2 is 0.0008 dB, DB_PER_LOG2_Q16 adds 2e-6 of the value
+#define MAX_FAST_DB_ERROR 0.001     // [dB] the fast_db() bound of dsp_math.h
+#define MAX_AMB_ERROR 0.0397        // relative error of amb_magf, 3.96% in dsp_math.h
+#define MAX_AMB_Q15_ERROR 0.04      // of amb_mag with the Q15 constants, plus 1 count of truncation
+#define FLOAT_STEP 97               // float bit patterns skipped per sample of the sweep
+#define U32_STEP 251                // 32-bit arguments skipped per sample above 2^16
+#define U64_SAMPLES 4000000         // random 64-bit arguments
+#define BIN_SAMPLES 2000000         // random bins through power_to_db
+#define MAG_ANGLES 100000           // angles of the magnitude sweeps, each at a random magnitude
+#define BENCH_VALUES 1024
+#define BENCH_RUNS 20000
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+# else
+#  define FORMAT "Q15"
+# endif
+#else
+# define FORMAT "float"
+#endif
+
+static double max_log2_error, max_db_error;     // over the current sweep
+static double worst;                            // argument of the largest log2 error
+
+// one argument: Q16 log2 q of x against log2(x), and the dB it converts to against 10*log10(x)
+static void compare(int32_t q, double x)
+{
+    double e = fabs(q/65536.0 - log2(x));
+    double d = fabs(log2_q16_to_db_q16(q)/65536.0 - 10*log10(x));
+
+    if (e > max_log2_error) {
+        max_log2_error = e;
+        worst = x;
+    }
+    max_db_error = fmax(max_db_error, d);
+}
+
+// checks and prints the errors of one sweep, then starts the next
+static void sweep_done(const char *what)
+{
+    printf("%-14s max error %.3g (log2) %.5f dB\n", what, max_log2_error, max_db_error);
+    host_check(max_log2_error < MAX_LOG2_ERROR, "%s: log2 off by %g at %.9g", what, max_log2_error, worst);
+    host_check(max_db_error < MAX_DB_ERROR, "%s: dB off by %g", what, max_db_error);
+    max_log2_error = max_db_error = 0;
+}
+
+// a bin of random magnitude, from the smallest nonzero value of the format up to full scale, at a random angle
+static kiss_fft_cpx bin_make(void)
+{
+    double a = 2*HOST_PI*host_uniform();
+    kiss_fft_cpx b;
+#ifdef FIXED_POINT
+    double m = ldexp(1 + host_uniform(), -(int)host_rand_below(8*sizeof(kiss_fft_scalar))); // below 2, of full scale
+    double full = -(double)SAMP_MIN; // full scale, -SAMP_MIN fits both parts at once
+    b.r = (kiss_fft_scalar)fmax(SAMP_MIN, fmin(SAMP_MAX, floor(m/2*full*cos(a) + 0.5)));
+    b.i = (kiss_fft_scalar)fmax(SAMP_MIN, fmin(SAMP_MAX, floor(m/2*full*sin(a) + 0.5)));
+#else
+    double m = ldexp(1 + host_uniform(), (int)host_rand_below(120) - 60); // |bin|^2 stays a normal float
+    b.r = (float)(m*cos(a));
+    b.i = (float)(m*sin(a));
+#endif
+    return b;
+}
+
+// power_to_db of BIN_SAMPLES random bins of the format against round(ref - 10*log10(|bin|^2)): off by at most
+// half a row plus the dB error, so only at rounding boundaries
+static void power_to_db_check(void)
+{
+    static kiss_fft_cpx bins[BENCH_VALUES];
+    static int16_t rows[BENCH_VALUES];
+    double worst_row = 0;
+    int i, j;
+
+    for (i = 0; i < BIN_SAMPLES/BENCH_VALUES; i++) {
+        int32_t ref = (int32_t)host_rand_below(400 << 16) - (200 << 16); // -200 to 200 dB on row 0
+        for (j = 0; j < BENCH_VALUES; j++)
+            bins[j] = bin_make();
+        power_to_db(bins, rows, BENCH_VALUES, ref);
+        for (j = 0; j < BENCH_VALUES; j++) {
+            double p = (double)bins[j].r*bins[j].r + (double)bins[j].i*bins[j].i;
+            if (p == 0)
+                continue;
+            worst_row = fmax(worst_row, fabs(rows[j] - (ref/65536.0 - 10*log10(p))));
+        }
+    }
+    printf("%-14s max error %.5f rows\n", "power_to_db", worst_row);
+    host_check(worst_row <= 0.5 + MAX_DB_ERROR, "power_to_db: row off by %g", worst_row);
+
+    // a zero bin lands below the row of the smallest nonzero one
+    memset(bins, 0, 2*sizeof(bins[0]));
+    bins[1].r = 1; // 1 LSB in the fixed-point builds
+#ifndef FIXED_POINT
+    bins[1].r = 1e-18f;
+#endif
+    power_to_db(bins, rows, 2, 0);
+    host_check(rows[0] > rows[1], "power_to_db: zero bin on row %d, smallest bin on row %d", rows[0], rows[1]);
+}
+
+// amb_magf at random magnitudes over the full float range and amb_mag over the full int32 range, every angle
+static void magnitude_check(void)
+{
+    double worst_f = 0, worst_i = 0;
+    int i;
+
+    for (i = 0; i < MAG_ANGLES; i++) {
+        double a = 2*HOST_PI*i/MAG_ANGLES;
+        double mf = ldexp(1 + host_uniform(), (int)host_rand_below(240) - 120);
+        float re = (float)(mf*cos(a)), im = (float)(mf*sin(a));
+        worst_f = fmax(worst_f, fabs(amb_magf(re, im)/hypot(re, im) - 1));
+
+        double mi = ldexp(1 + host_uniform(), -(int)host_rand_below(31)); // up to full scale of the int32 range
+        int32_t ri = (int32_t)fmax(INT32_MIN, fmin(INT32_MAX, floor(mi*1073741824.0*cos(a) + 0.5)));
+        int32_t ii = (int32_t)fmax(INT32_MIN, fmin(INT32_MAX, floor(mi*1073741824.0*sin(a) + 0.5)));
+        double h = hypot(ri, ii);
+        if (h > 0)
+            worst_i = fmax(worst_i, (fabs(amb_mag(ri, ii) - h) - 1)/h);
+    }
+    host_check(amb_mag(INT32_MIN, INT32_MIN) <= (uint32_t)(1.04*hypot(INT32_MIN, INT32_MIN)) &&
+               amb_mag(INT32_MIN, 0) == (uint32_t)(((uint64_t)1 << 31)*AMB_ALPHA_Q15 >> 15),
+               "amb_mag of the most negative int32 wrong");
+    printf("%-14s max error %.4f\n%-14s max error %.4f\n", "amb_magf", worst_f, "amb_mag", worst_i);
+    host_check(worst_f <= MAX_AMB_ERROR, "amb_magf off by %.4f", worst_f);
+    host_check(worst_i <= MAX_AMB_Q15_ERROR, "amb_mag off by %.4f", worst_i);
+}
+
+int main(void)
+{
+    static float values[BENCH_VALUES];
+    static int32_t out[BENCH_VALUES];
+    static kiss_fft_cpx bins[BENCH_VALUES];
+    static int16_t rows[BENCH_VALUES];
+    volatile int32_t sink = 0;
+    double fast_db_error = 0;
+    uint64_t u, t0, t1, t2, t3, t4;
+    int i, r;
+
+    // every normal float, the power values of the float build
+    for (u = 0x00800000u; u < 0x7f800000u; u += FLOAT_STEP) {
+        uint32_t bits = (uint32_t)u;
+        float x;
+        memcpy(&x, &bits, sizeof(x));
+        compare(fast_log2_q16(x), x);
+        fast_db_error = fmax(fast_db_error, fabs(fast_db(x) - 10*log10(x)));
+    }
+    host_check(fast_log2_q16(0.0f) == LOG2_Q16_ZERO_F && fast_log2_q16(1e-40f) == LOG2_Q16_ZERO_F &&
+               fast_log2_q16(-1.0f) == LOG2_Q16_ZERO_F, "fast_log2_q16: 0, denormal or negative not LOG2_Q16_ZERO_F");
+    sweep_done("fast_log2_q16");
+    printf("%-14s max error %.5f dB\n", "fast_db", fast_db_error);
+    host_check(fast_db_error < MAX_FAST_DB_ERROR, "fast_db: off by %g dB", fast_db_error);
+
+    // every 32-bit argument up to 2^16, then a sweep to 2^32, the Q15 build power values
+    for (u = 1; u < 0x100000000ull; u += u < 0x10000 ? 1 : U32_STEP)
+        compare(ilog2_q16((uint32_t)u), (double)u);
+    host_check(ilog2_q16(0) == LOG2_Q16_ZERO, "ilog2_q16(0) not LOG2_Q16_ZERO");
+    sweep_done("ilog2_q16");
+
+    // random 64-bit arguments of every length, the Q31 build power values
+    for (i = 0; i < U64_SAMPLES; i++) {
+        uint64_t x = host_rand() >> host_rand_below(64);
+        if (x)
+            compare(ilog2_q16_u64(x), (double)x);
+    }
+    host_check(ilog2_q16_u64(0) == LOG2_Q16_ZERO, "ilog2_q16_u64(0) not LOG2_Q16_ZERO");
+    sweep_done("ilog2_q16_u64");
+
+    power_to_db_check();
+    magnitude_check();
+
+    // cycles per value, against the log10f the dB conversion replaced
+    for (i = 0; i < BENCH_VALUES; i++)
+        values[i] = ldexpf((float)host_uniform() + 0.5f, (int)host_rand_below(60) - 10);
+    t0 = host_cycles();
+    for (r = 0; r < BENCH_RUNS; r++) {
+        for (i = 0; i < BENCH_VALUES; i++)
+            out[i] = log2_q16_to_db_q16(fast_log2_q16(values[i]));
+        sink += out[r % BENCH_VALUES];
+    }
+    t1 = host_cycles();
+    for (r = 0; r < BENCH_RUNS; r++) {
+        for (i = 0; i < BENCH_VALUES; i++)
+            out[i] = (int32_t)(10*log10f(values[i])*65536);
+        sink += out[r % BENCH_VALUES];
+    }
+    t2 = host_cycles();
+
+    // cycles per bin of the display rows, against rounding 10*log10f of the power
+    for (i = 0; i < BENCH_VALUES; i++)
+        bins[i] = bin_make();
+    for (r = 0; r < BENCH_RUNS; r++) {
+        power_to_db(bins, rows, BENCH_VALUES, 128 << 16);
+        sink += rows[r % BENCH_VALUES];
+    }
+    t3 = host_cycles();
+    for (r = 0; r < BENCH_RUNS; r++) {
+        for (i = 0; i < BENCH_VALUES; i++)
+            rows[i] = (int16_t)lroundf(128 - 10*log10f((float)bins[i].r*bins[i].r + (float)bins[i].i*bins[i].i));
+        sink += rows[r % BENCH_VALUES];
+    }
+    t4 = host_cycles();
+    printf("cycles per value: fast_log2_q16 %.1f, log10f %.1f\n", (double)(t1 - t0)/BENCH_RUNS/BENCH_VALUES,
+           (double)(t2 - t1)/BENCH_RUNS/BENCH_VALUES);
+    printf("cycles per bin: power_to_db %.1f, 10*log10f %.1f\n", (double)(t3 - t2)/BENCH_RUNS/BENCH_VALUES,
+           (double)(t4 - t3)/BENCH_RUNS/BENCH_VALUES);
+    return host_result("test_db " FORMAT);
+}
@@ -0,0 +1,70 @@
+/*
+ * test_fftr.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the real-input FFT: bins 0 to nfft/2 of kiss_fftr against a
+ * full complex kiss_fft of the same samples with zero imaginary parts, and
+ * the cycles of both
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "host_test.h"
+
+#define MIN_NFFT 128
+#define MAX_NFFT 8192
+#define TOLERANCE 1e-5      // largest bin difference relative to the largest bin
+#define BENCH_SAMPLES 4000000 // [samples] transformed per size and path
+
+int main(void)
+{
+    static kiss_fft_cpx cin[MAX_NFFT], cout[MAX_NFFT], rout[MAX_NFFT/2 + 1];
+    static kiss_fft_scalar rin[MAX_NFFT];
+    int nfft, i, k, r;
+
+    printf("%6s %12s %12s %10s %8s\n", "nfft", "max diff", "complex cyc", "real cyc", "speedup");
+    for (nfft = MIN_NFFT; nfft <= MAX_NFFT; nfft *= 2) {
+        kiss_fft_cfg ccfg = kiss_fft_alloc(nfft, 0, NULL, NULL);
+        kiss_fftr_cfg rcfg = kiss_fftr_alloc(nfft, 0, NULL, NULL);
+        double diff = 0, peak = 0;
+        int runs = BENCH_SAMPLES/nfft;
+        uint64_t t0, t1, t2;
+
+        // ADC-like samples: a tone, a second weaker one and noise, DC removed
+        for (i = 0; i < nfft; i++) {
+            rin[i] = (kiss_fft_scalar)(1500*sin(2*HOST_PI*0.1234*i) + 30*sin(2*HOST_PI*0.31*i) +
+                                       200*(host_uniform() - 0.5));
+            cin[i].r = rin[i];
+            cin[i].i = 0;
+        }
+
+        kiss_fft(ccfg, cin, cout);
+        kiss_fftr(rcfg, rin, rout);
+        for (k = 0; k <= nfft/2; k++) {
+            double d = hypot(rout[k].r - cout[k].r, rout[k].i - cout[k].i);
+            double m = hypot(cout[k].r, cout[k].i);
+            diff = d > diff ? d : diff;
+            peak = m > peak ? m : peak;
+        }
+        host_check(diff <= TOLERANCE*peak, "nfft %d: real FFT off by %g of the peak bin", nfft, diff/peak);
+
+        t0 = host_cycles();
+        for (r = 0; r < runs; r++)
+            kiss_fft(ccfg, cin, cout);
+        t1 = host_cycles();
+        for (r = 0; r < runs; r++)
+            kiss_fftr(rcfg, rin, rout);
+        t2 = host_cycles();
+        printf("%6d %12.3g %12.0f %10.0f %7.2fx\n", nfft, diff/peak, (double)(t1 - t0)/runs,
+               (double)(t2 - t1)/runs, (double)(t1 - t0)/(t2 - t1));
+
+        free(ccfg);
+        free(rcfg);
+    }
+    return host_result("test_fftr");
+}
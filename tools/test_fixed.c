@@ -0,0 +1,177 @@
+/*
+ * test_fixed.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the spectrum pipeline from ADC codes to display rows, built
+ * once per number format (float, FIXED_POINT=16, FIXED_POINT=32): the SNR of
+ * the bins and the dynamic range lost against a double-precision reference,
+ * and the display rows against the rows of the reference
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "dsp_math.h"
+#include "fft_tables.h"
+#include "window.h"
+#include "spectrum.h"
+#include "host_test.h"
+
+#define RING_SIZE 8192          // ADC ring, the frames wrap around its end
+#define ADC_RATE 1000000        // [Hz]
+#define COLS 127                // display columns
+#define PIXELS_PER_DIV 20       // display columns per division
+#define PIXEL_DB_OFFSET 128     // pixel row of 0 dB, as in sampling.c
+#define ROW_SLACK 1             // [rows] display rows may differ from the reference rows by this much
+#define TONE1 0.1234            // [cycles/sample] strong tone
+#define TONE2 0.3210            // [cycles/sample] tone 60 dB below it
+#define LEAKAGE 8               // [bins] either side of a tone or DC left out of the noise floor
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+#  define MIN_SNR 85            // [dB] the Q15 window table alone limits it to about 90 dB
+#  define MAX_LOSS 0.1          // [dB]
+# else
+#  define FORMAT "Q15"
+#  define MIN_SNR 40
+#  define MAX_LOSS 1
+# endif
+#else
+# define FORMAT "float"
+# define MIN_SNR 120
+# define MAX_LOSS 0.1
+#endif
+
+static uint16_t ring[RING_SIZE];
+
+// ADC codes: a strong tone, one 60 dB below it and half an LSB of noise, around mid-scale
+static void signal_make(void)
+{
+    int n;
+    for (n = 0; n < RING_SIZE; n++) {
+        double x = 2048 + 1800*sin(2*HOST_PI*TONE1*n) + 1.8*sin(2*HOST_PI*TONE2*n) +
+                   0.5*sqrt(-2*log(1 - host_uniform()))*cos(2*HOST_PI*host_uniform());
+        ring[n] = (uint16_t)floor(x + 0.5);
+    }
+}
+
+// X[k] of the DC-removed, windowed frame in double precision, bins 0 to nfft/2
+static void reference(int nfft, uint32_t first, int32_t dc, double *bin_re, double *bin_im)
+{
+    double *x = malloc(nfft*sizeof(double));
+    int n, k;
+
+    for (n = 0; n < nfft; n++) {
+        double w = 0.42 - 0.5*cos(2*HOST_PI*n/(nfft - 1)) + 0.08*cos(4*HOST_PI*n/(nfft - 1));
+        x[n] = ((int32_t)ring[(first + n) & (RING_SIZE - 1)] - dc)*w;
+    }
+    for (k = 0; k <= nfft/2; k++) {
+        double re = 0, im = 0;
+        uint32_t step = k, phase = 0; // the phase advances k/nfft turns per sample
+        for (n = 0; n < nfft; n++) {
+            re += x[n]*cos(2*HOST_PI*phase/nfft);
+            im -= x[n]*sin(2*HOST_PI*phase/nfft);
+            phase = (phase + step) % nfft;
+        }
+        bin_re[k] = re;
+        bin_im[k] = im;
+    }
+    free(x);
+}
+
+// bins of the noise floor, away from DC and the tones
+static int floor_bin(int k, int nfft)
+{
+    return k > LEAKAGE && fabs(k - TONE1*nfft) > LEAKAGE && fabs(k - TONE2*nfft) > LEAKAGE;
+}
+
+int main(void)
+{
+    static kiss_fft_cpx buf[FFT_TABLE_MAX_NFFT/2 + 1];
+    static fft_window_t ram[FFT_TABLE_MAX_NFFT/2];
+    static double ref_re[FFT_TABLE_MAX_NFFT/2 + 1], ref_im[FFT_TABLE_MAX_NFFT/2 + 1];
+    static const int sizes[] = {256, 1024, 4096};
+    int32_t dc = 2048;
+    int s, k, c;
+
+    signal_make();
+    // ref range: peak bin over the floor of the ADC codes; own range: over the error the pipeline adds alone;
+    // range: over both, lost: ref range - range
+    printf("%s build\n%6s %8s %12s %12s %10s %10s %9s\n", FORMAT, "nfft", "SNR dB", "ref range dB", "own range dB",
+           "range dB", "lost dB", "row diff");
+    for (s = 0; s < (int)(sizeof(sizes)/sizeof(sizes[0])); s++) {
+        int nfft = sizes[s];
+        uint32_t first = RING_SIZE - nfft/3; // wraps
+        kiss_fftr_cfg cfg = kiss_fftr_alloc(nfft, 0, NULL, NULL);
+        window_table wt;
+        spectrum_view view;
+        spectrum_sum power[COLS];
+        int16_t rows[COLS];
+        double signal = 0, noise = 0, peak = 0, scale;
+        double ref_floor = 0, added = 0;    // mean power of the floor bins, and of the error the pipeline adds there
+        int floor_bins = 0;
+        int row_diff = 0;
+
+        window_init(&wt, WINDOW_BLACKMAN, WINDOW_KAISER_BETA, nfft, ram);
+        int shift = window_apply(&wt, ring, RING_SIZE, (int32_t)first, dc, (kiss_fft_scalar *)buf);
+        kiss_fftr(cfg, (kiss_fft_scalar *)buf, buf);
+#ifdef FIXED_POINT
+        scale = ldexp((double)nfft*nfft, 2*shift - 2*WINDOW_Q); // as spectrumPowerScale() in sampling.c
+#else
+        scale = 1;
+#endif
+        reference(nfft, first, dc, ref_re, ref_im);
+
+        for (k = 0; k <= nfft/2; k++) {
+            double re = (double)buf[k].r*sqrt(scale), im = (double)buf[k].i*sqrt(scale);
+            double p = ref_re[k]*ref_re[k] + ref_im[k]*ref_im[k];
+            double e = (re - ref_re[k])*(re - ref_re[k]) + (im - ref_im[k])*(im - ref_im[k]);
+            signal += p;
+            noise += e;
+            peak = p > peak ? p : peak;
+            if (floor_bin(k, nfft)) {
+                ref_floor += p;
+                added += e;
+                floor_bins++;
+            }
+        }
+        ref_floor /= floor_bins;
+        added /= floor_bins;
+
+        // display rows of the whole span against the rows of the reference, as sampling.c converts them
+        spectrum_view_init(&view, nfft, ADC_RATE, 0, DETECTOR_PEAK, COLS, PIXELS_PER_DIV);
+        spectrum_detect(&view, buf, power);
+        int32_t log2_scale_q16 = (2*shift) << 16;
+#ifdef FIXED_POINT
+        log2_scale_q16 += (2*(dsp_bits32(nfft) - 1) - 2*WINDOW_Q) << 16; // as spectrumRef() in sampling.c
+#endif
+        spectrum_rows(&view, power, rows, (PIXEL_DB_OFFSET << 16) - log2_q16_to_db_q16(log2_scale_q16));
+        double floor_db = 10*log10(ref_floor + added); // floor of the pipeline output, the rows below it are noise
+        for (c = 0; c < COLS; c++) {
+            int end = view.col_bin[c + 1] > view.col_bin[c] ? view.col_bin[c + 1] : view.col_bin[c] + 1;
+            double p = 0;
+            for (k = view.col_bin[c]; k < end; k++) // the peak detector of the reference bins
+                p = fmax(p, ref_re[k]*ref_re[k] + ref_im[k]*ref_im[k]);
+            if (10*log10(p) < floor_db + 20)
+                continue;
+            int d = abs(rows[c] - (int)floor(PIXEL_DB_OFFSET - 10*log10(p) + 0.5));
+            row_diff = d > row_diff ? d : row_diff;
+        }
+
+        double ref_range = 10*log10(peak/ref_floor);
+        double range = 10*log10(peak/(ref_floor + added));
+        double snr = 10*log10(signal/noise);
+        printf("%6d %8.1f %12.1f %12.1f %10.1f %10.2f %9d\n", nfft, snr, ref_range, 10*log10(peak/added), range,
+               ref_range - range, row_diff);
+        host_check(snr >= MIN_SNR, "nfft %d: SNR %.1f dB below %d dB", nfft, snr, MIN_SNR);
+        host_check(ref_range - range <= MAX_LOSS, "nfft %d: %.1f dB of dynamic range lost", nfft, ref_range - range);
+        host_check(row_diff <= ROW_SLACK, "nfft %d: display rows off by %d", nfft, row_diff);
+        free(cfg);
+    }
+    return host_result("test_fixed " FORMAT);
+}
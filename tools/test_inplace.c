@@ -0,0 +1,107 @@
+/*
+ * test_inplace.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the iterative in-place kiss_fft engine: randomized sizes and
+ * inputs against the original recursive, out-of-place kf_work, which must
+ * give bit-identical output. Built once per number format; includes
+ * kiss_fft.c to reach its butterflies
+ */
+
+#include "../kiss_fft.c"
+#include "host_test.h"
+
+#define RANDOM_SIZES 300        // random FFT sizes tried, beside every power of 2
+#define MAX_RANDOM_NFFT 2500    // largest random FFT size, the prime ones cost O(n^2)
+#define MAX_NFFT 65536          // largest power of 2 tried
+
+#ifdef FIXED_POINT
+# define FORMAT (FIXED_POINT == 32 ? "Q31" : "Q15")
+#else
+# define FORMAT "float"
+#endif
+
+// the recursive kf_work kiss_fft had before the in-place engine: f read with stride fstride, output to Fout
+static void reference_work(kiss_fft_cpx *Fout, const kiss_fft_cpx *f, const size_t fstride, const int *factors,
+                           const kiss_fft_cfg st)
+{
+    kiss_fft_cpx *Fout_beg = Fout;
+    const int p = *factors++; // the radix
+    const int m = *factors++; // stage's fft length/p
+    const kiss_fft_cpx *Fout_end = Fout + p*m;
+    const size_t tstride = fstride*st->twiddle_stride;
+
+    if (m == 1) {
+        do {
+            *Fout = *f;
+            f += fstride;
+        } while (++Fout != Fout_end);
+    } else {
+        do {
+            reference_work(Fout, f, fstride*p, factors, st);
+            f += fstride;
+        } while ((Fout += m) != Fout_end);
+    }
+
+    Fout = Fout_beg;
+    switch (p) {
+    case 2: KF_BFLY2(Fout, tstride, st, NULL, m); break;
+    case 3: kf_bfly3(Fout, tstride, st, NULL, m); break;
+    case 4: KF_BFLY4(Fout, tstride, st, NULL, m); break;
+    case 5: kf_bfly5(Fout, tstride, st, NULL, m); break;
+    default: kf_bfly_generic(Fout, tstride, st, m, p); break;
+    }
+}
+
+// one size: random input through both engines, in place and out of place; false on any difference
+static int compare(int nfft)
+{
+    kiss_fft_cfg cfg = kiss_fft_alloc(nfft, 0, NULL, NULL);
+    kiss_fft_cpx *in = malloc(nfft*sizeof(kiss_fft_cpx));
+    kiss_fft_cpx *ref = malloc(nfft*sizeof(kiss_fft_cpx));
+    kiss_fft_cpx *out = malloc(nfft*sizeof(kiss_fft_cpx));
+    int k, same;
+
+    for (k = 0; k < nfft; k++) {
+#ifdef FIXED_POINT
+        in[k].r = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+        in[k].i = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+#else
+        in[k].r = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+        in[k].i = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+#endif
+    }
+
+    reference_work(ref, in, 1, cfg->factors, cfg);
+    kiss_fft(cfg, in, out);
+    same = memcmp(ref, out, nfft*sizeof(kiss_fft_cpx)) == 0;
+    memcpy(out, in, nfft*sizeof(kiss_fft_cpx));
+    kiss_fft(cfg, out, out); // fin == fout, no temporary buffer any more
+    same = same && memcmp(ref, out, nfft*sizeof(kiss_fft_cpx)) == 0;
+
+    free(cfg);
+    free(in);
+    free(ref);
+    free(out);
+    return same;
+}
+
+int main(void)
+{
+    int nfft, i, sizes = 0;
+
+    for (nfft = 2; nfft <= MAX_NFFT; nfft *= 2, sizes++)
+        host_check(compare(nfft), "%s nfft %d differs from the recursive kf_work", FORMAT, nfft);
+    for (i = 0; i < RANDOM_SIZES; i++, sizes++) {
+        nfft = 2 + host_rand_below(MAX_RANDOM_NFFT - 1); // mixed radix, primes and all
+        host_check(compare(nfft), "%s nfft %d differs from the recursive kf_work", FORMAT, nfft);
+    }
+    printf("%s: %d sizes bit-identical to the recursive kf_work, in place and out of place\n", FORMAT, sizes);
+
+    // RAM: the spectrum path transforms fft_buffer in place, where the old one kept separate in and out arrays
+    printf("RAM freed at nfft 1024: %u bytes of a separate output array, no recursion and no KISS_FFT_TMP_ALLOC "
+           "copy for fin == fout\n", (unsigned)(1024*sizeof(kiss_fft_cpx)));
+    return host_result("test_inplace");
+}
@@ -0,0 +1,169 @@
+/*
+ * test_prune.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the output-pruned real FFT: the bins of several spans from
+ * every mode fft_prune_plan_init allows against a full kiss_fftr of the same
+ * frame, and the mode the plan settles on after timing the candidates, which
+ * must be no slower than the full FFT
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "fft_prune.h"
+#include "host_test.h"
+
+#define SPANS 7
+#define BENCH_SAMPLES 2000000   // [samples] transformed per span and mode
+#define BENCH_SLACK 1.1         // a pruned mode may measure this much slower than the full FFT, timing noise
+#define SETTLE_ATTEMPTS 3       // plans timed per span before a slower pruned mode counts as a failure
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+#  define TOLERANCE 1e-6        // largest bin difference relative to the largest bin of the span
+#  define GOERTZEL_TOLERANCE 1e-3 // the recursion accumulates the rounding of nfft samples, -60 dB
+# else
+#  define FORMAT "Q15"
+#  define TOLERANCE 2e-2        // a few LSB of the scaled-down bins
+#  define GOERTZEL_TOLERANCE 2e-2
+# endif
+#else
+# define FORMAT "float"
+# define TOLERANCE 1e-5
+# define GOERTZEL_TOLERANCE 1e-3
+#endif
+
+static const char *const mode_name[FFT_PRUNE_MODE_COUNT] = {"full", "decomp", "goertzel"};
+
+static kiss_fft_cpx frame[FFT_TABLE_MAX_NFFT/2 + 1], ref[FFT_TABLE_MAX_NFFT/2 + 1], buf[FFT_TABLE_MAX_NFFT/2 + 1];
+
+// tones at both ends of bins kmin to kmax and some noise, as nfft real samples in frame
+static void signal_make(int nfft, int kmin, int kmax)
+{
+    kiss_fft_scalar *x = (kiss_fft_scalar *)frame;
+    int i;
+    for (i = 0; i < nfft; i++) {
+        double v = 0.4*sin(2*HOST_PI*(kmin + 0.3)*i/nfft) + 0.3*cos(2*HOST_PI*(kmax - 0.2)*i/nfft) +
+                   0.05*(2*host_uniform() - 1);
+#ifdef FIXED_POINT
+        x[i] = (kiss_fft_scalar)(v*SAMP_MAX);
+#else
+        x[i] = (kiss_fft_scalar)v;
+#endif
+    }
+}
+
+// largest difference of bins kmin to kmax of buf from ref, relative to the largest bin of ref there
+static double bins_diff(int kmin, int kmax)
+{
+    double diff = 0, peak = 0;
+    int k;
+    for (k = kmin; k <= kmax; k++) {
+        diff = fmax(diff, hypot((double)buf[k].r - ref[k].r, (double)buf[k].i - ref[k].i));
+        peak = fmax(peak, hypot(ref[k].r, ref[k].i));
+    }
+    return diff/peak;
+}
+
+// host cycle counter for timing the modes
+static uint32_t clock32(void)
+{
+    return (uint32_t)host_cycles();
+}
+
+// cycles of one transform of mode
+static double bench_once(fft_prune_plan *plan, kiss_fftr_cfg cfg, int nfft, fft_prune_mode mode)
+{
+    plan->mode = mode;
+    memcpy(buf, frame, nfft*sizeof(kiss_fft_scalar)); // the transform is in place
+    uint64_t t0 = host_cycles();
+    fft_prune_execute(plan, cfg, buf);
+    return (double)(host_cycles() - t0);
+}
+
+// cycles per transform of the chosen mode and of the full FFT: the fastest of many, taken in turns so both
+// see the same load and neither counts the time the host took the core away
+static void bench(fft_prune_plan *plan, kiss_fftr_cfg cfg, int nfft, fft_prune_mode chosen, double *cycles,
+                  double *full)
+{
+    int r, runs = BENCH_SAMPLES/nfft;
+    *cycles = *full = HUGE_VAL;
+    for (r = 0; r < runs; r++) {
+        *cycles = fmin(*cycles, bench_once(plan, cfg, nfft, chosen));
+        *full = fmin(*full, bench_once(plan, cfg, nfft, FFT_PRUNE_FULL));
+    }
+    plan->mode = chosen;
+}
+
+int main(void)
+{
+    static char mem[KISS_FFTR_CFG_TABLES_BYTES];
+    static fft_prune_plan plan;
+    int nfft, s, k, mode, attempt;
+
+    printf("%s build\n%6s %11s %9s %10s %10s %10s %8s\n", FORMAT, "nfft", "bins", "mode", "max diff", "cycles",
+           "full cyc", "settled");
+    for (nfft = 256; nfft <= FFT_TABLE_MAX_NFFT; nfft *= 2) {
+        size_t len = sizeof(mem);
+        kiss_fftr_cfg cfg = fft_table_fftr_alloc(nfft, mem, &len);
+        const int spans[SPANS][2] = {{0, nfft/64}, {0, nfft/128}, {3, 5}, {7, 7}, {nfft/4 - 2, nfft/4 + 2},
+                                     {nfft/2 - FFT_PRUNE_MAX_BINS + 1, nfft/2}, {0, FFT_PRUNE_MAX_BINS - 1}};
+
+        for (s = 0; s < SPANS; s++) {
+            int kmin = spans[s][0], kmax = spans[s][1];
+            fft_prune_mode chosen;
+            double full = 0, cycles = 0, diffs[FFT_PRUNE_MODE_COUNT] = {0};
+
+            fft_prune_plan_init(&plan, cfg, kmin, kmax, NULL);
+            signal_make(nfft, kmin, kmax);
+            memcpy(buf, frame, nfft*sizeof(kiss_fft_scalar));
+            kiss_fftr(cfg, (kiss_fft_scalar *)buf, ref);
+
+            // every mode the plan allows must give the bins of the full FFT
+            for (mode = 0; mode < FFT_PRUNE_MODE_COUNT; mode++) {
+                if (mode != FFT_PRUNE_FULL && plan.cost[mode] == 0)
+                    continue;
+                plan.mode = (fft_prune_mode)mode;
+                memcpy(buf, frame, nfft*sizeof(kiss_fft_scalar));
+                fft_prune_execute(&plan, cfg, buf);
+                diffs[mode] = bins_diff(kmin, kmax);
+                host_check(diffs[mode] <= (mode == FFT_PRUNE_GOERTZEL ? GOERTZEL_TOLERANCE : TOLERANCE),
+                           "nfft %d bins %d-%d: %s off by %g of the peak bin", nfft, kmin, kmax, mode_name[mode],
+                           diffs[mode]);
+            }
+
+            // the transforms timing the candidates give the bins too, then the mode settles. the host shares its
+            // core, so modes close in cost may swap places: a pruned mode slower than the full FFT is timed again
+            for (attempt = 0; attempt < SETTLE_ATTEMPTS; attempt++) {
+                fft_prune_plan_init(&plan, cfg, kmin, kmax, clock32);
+                for (k = 0; !fft_prune_plan_settled(&plan) && k <= FFT_PRUNE_MODE_COUNT*(FFT_PRUNE_TRIALS + 1); k++) {
+                    memcpy(buf, frame, nfft*sizeof(kiss_fft_scalar));
+                    fft_prune_execute(&plan, cfg, buf);
+                    host_check(bins_diff(kmin, kmax) <= GOERTZEL_TOLERANCE, "nfft %d bins %d-%d: timed transform %d "
+                               "off", nfft, kmin, kmax, k);
+                }
+                host_check(fft_prune_plan_settled(&plan), "nfft %d bins %d-%d: not settled after %d transforms", nfft,
+                           kmin, kmax, k);
+                chosen = plan.mode;
+
+                // the chosen mode against the full FFT
+                bench(&plan, cfg, nfft, chosen, &cycles, &full);
+                if (chosen == FFT_PRUNE_FULL || cycles <= BENCH_SLACK*full)
+                    break;
+            }
+            printf("%6d %5d-%-5d %9s %10.3g %10.0f %10.0f %8d\n", nfft, kmin, kmax, mode_name[chosen], diffs[chosen],
+                   cycles, full, attempt + 1);
+            host_check(attempt < SETTLE_ATTEMPTS, "nfft %d bins %d-%d: %s chosen, %.0f cycles against %.0f of the full "
+                       "FFT", nfft, kmin, kmax, mode_name[chosen], cycles, full);
+        }
+    }
+    return host_result("test_prune " FORMAT);
+}
@@ -0,0 +1,132 @@
+/*
+ * test_simd.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the vectorized butterflies of _kiss_fft_simd.h: kiss_fft.c
+ * built a second time with one backend (included below under simd_ names)
+ * against the scalar build linked beside it. Every backend must give output
+ * identical to the scalar butterflies; the cycles of both are printed.
+ * Built once per backend: SIMD_SSE and SIMD_AVX (float), SIMD_DSP (Q15, the
+ * Cortex-M4 instructions emulated in C)
+ */
+
+#if defined(SIMD_SSE)
+# define KISS_FFT_SIMD_SSE
+# define BACKEND "SSE3"
+#elif defined(SIMD_AVX)
+# define KISS_FFT_SIMD_AVX
+# define BACKEND "AVX"
+#elif defined(SIMD_DSP)
+# define KISS_FFT_SIMD_DSP
+# define BACKEND "DSP"
+#else
+# error "build with one of SIMD_SSE, SIMD_AVX and SIMD_DSP"
+#endif
+
+#define kiss_fft simd_kiss_fft
+#define kiss_fft_alloc simd_kiss_fft_alloc
+#define kiss_fft_alloc_tables simd_kiss_fft_alloc_tables
+#define kiss_fft_set_codelet simd_kiss_fft_set_codelet
+#define kiss_fft_stride simd_kiss_fft_stride
+#define kiss_fft_partial simd_kiss_fft_partial
+#define kiss_fft_cleanup simd_kiss_fft_cleanup
+#define kiss_fft_next_fast_size simd_kiss_fft_next_fast_size
+#include "../kiss_fft.c"
+#undef kiss_fft
+#undef kiss_fft_alloc
+
+#include "host_test.h"
+
+// the scalar build of kiss_fft.c, its configs are only passed back to it
+kiss_fft_cfg kiss_fft_alloc(int nfft, int inverse_fft, void *mem, size_t *lenmem);
+void kiss_fft(kiss_fft_cfg cfg, const kiss_fft_cpx *fin, kiss_fft_cpx *fout);
+
+#define MIN_NFFT 64
+#define MAX_NFFT 65536
+#define RANDOM_SIZES 200        // random mixed-radix sizes, beside the powers of 2
+#define MAX_RANDOM_NFFT 4096
+#define BENCH_SAMPLES 1000000   // [samples] transformed per size and build
+#define BENCH_TRIES 5           // the best of these is printed
+
+static kiss_fft_cpx in[MAX_NFFT], out_scalar[MAX_NFFT], out_simd[MAX_NFFT];
+
+// random input of nfft points
+static void input_make(int nfft)
+{
+    int k;
+    for (k = 0; k < nfft; k++) {
+#ifdef FIXED_POINT
+        in[k].r = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+        in[k].i = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+#else
+        in[k].r = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+        in[k].i = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+#endif
+    }
+}
+
+// one size through both builds, out of place and in place; false on any difference
+static int compare(int nfft, kiss_fft_cfg a, kiss_fft_cfg b)
+{
+    int same;
+    input_make(nfft);
+    kiss_fft(a, in, out_scalar);
+    simd_kiss_fft(b, in, out_simd);
+    same = memcmp(out_scalar, out_simd, nfft*sizeof(kiss_fft_cpx)) == 0;
+    memcpy(out_simd, in, nfft*sizeof(kiss_fft_cpx));
+    simd_kiss_fft(b, out_simd, out_simd);
+    return same && memcmp(out_scalar, out_simd, nfft*sizeof(kiss_fft_cpx)) == 0;
+}
+
+// best cycles per transform of one build
+static double bench(void (*fft)(kiss_fft_cfg, const kiss_fft_cpx *, kiss_fft_cpx *), kiss_fft_cfg cfg, int nfft)
+{
+    int t, r, runs = BENCH_SAMPLES/nfft;
+    double best = 0;
+    for (t = 0; t < BENCH_TRIES; t++) {
+        uint64_t t0 = host_cycles();
+        for (r = 0; r < runs; r++)
+            fft(cfg, in, out_scalar);
+        double c = (double)(host_cycles() - t0)/runs;
+        best = (t == 0 || c < best) ? c : best;
+    }
+    return best;
+}
+
+int main(void)
+{
+    int nfft, i;
+
+#if defined(SIMD_AVX) && defined(__GNUC__)
+    if (!__builtin_cpu_supports("avx")) {
+        printf("no AVX on this host, skipped\n");
+        return 0;
+    }
+#endif
+    printf("%s backend\n%6s %12s %12s %8s\n", BACKEND, "nfft", "scalar cyc", "simd cyc", "speedup");
+    for (nfft = MIN_NFFT; nfft <= MAX_NFFT; nfft *= 2) {
+        kiss_fft_cfg a = kiss_fft_alloc(nfft, 0, NULL, NULL);
+        kiss_fft_cfg b = simd_kiss_fft_alloc(nfft, 0, NULL, NULL);
+        double scalar, simd;
+
+        host_check(compare(nfft, a, b), "nfft %d: %s butterflies change the output", nfft, BACKEND);
+        scalar = bench(kiss_fft, a, nfft);
+        simd = bench(simd_kiss_fft, b, nfft);
+        printf("%6d %12.0f %12.0f %7.2fx\n", nfft, scalar, simd, scalar/simd);
+        free(a);
+        free(b);
+    }
+
+    // stages whose length is not a multiple of the vector width fall back to the scalar butterfly
+    for (i = 0; i < RANDOM_SIZES; i++) {
+        nfft = 2 + host_rand_below(MAX_RANDOM_NFFT - 1);
+        kiss_fft_cfg a = kiss_fft_alloc(nfft, 0, NULL, NULL);
+        kiss_fft_cfg b = simd_kiss_fft_alloc(nfft, 0, NULL, NULL);
+        host_check(compare(nfft, a, b), "nfft %d: %s butterflies change the output", nfft, BACKEND);
+        free(a);
+        free(b);
+    }
+    return host_result("test_simd " BACKEND);
+}
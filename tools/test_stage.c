@@ -0,0 +1,118 @@
+/*
+ * test_stage.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of KISS_FFT_STAGE_TWIDDLES: kiss_fft.c built a second time with
+ * the packed per-stage twiddle tables (included below under stage_ names)
+ * against the default build linked beside it. Both must give bit-identical
+ * output; the cycles of both are printed from 1K to 64K points
+ */
+
+#define KISS_FFT_STAGE_TWIDDLES
+#define kiss_fft stage_kiss_fft
+#define kiss_fft_alloc stage_kiss_fft_alloc
+#define kiss_fft_alloc_tables stage_kiss_fft_alloc_tables
+#define kiss_fft_set_codelet stage_kiss_fft_set_codelet
+#define kiss_fft_stride stage_kiss_fft_stride
+#define kiss_fft_partial stage_kiss_fft_partial
+#define kiss_fft_cleanup stage_kiss_fft_cleanup
+#define kiss_fft_next_fast_size stage_kiss_fft_next_fast_size
+#include "../kiss_fft.c"
+#undef kiss_fft
+#undef kiss_fft_alloc
+
+#include "host_test.h"
+
+// the default build of kiss_fft.c, its configs are only passed back to it
+kiss_fft_cfg kiss_fft_alloc(int nfft, int inverse_fft, void *mem, size_t *lenmem);
+void kiss_fft(kiss_fft_cfg cfg, const kiss_fft_cpx *fin, kiss_fft_cpx *fout);
+
+#define MIN_NFFT 1024
+#define MAX_NFFT 65536
+#define RANDOM_SIZES 200        // random mixed-radix sizes, beside the powers of 2
+#define MAX_RANDOM_NFFT 4096
+#define BENCH_SAMPLES 1000000   // [samples] transformed per size and build
+#define BENCH_TRIES 5           // the best of these is printed
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+# else
+#  define FORMAT "Q15"
+# endif
+#else
+# define FORMAT "float"
+#endif
+
+static kiss_fft_cpx in[MAX_NFFT], out_default[MAX_NFFT], out_stage[MAX_NFFT];
+
+// random input of nfft points
+static void input_make(int nfft)
+{
+    int k;
+    for (k = 0; k < nfft; k++) {
+#ifdef FIXED_POINT
+        in[k].r = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+        in[k].i = (kiss_fft_scalar)((int64_t)host_rand() >> (64 - 8*sizeof(kiss_fft_scalar) + 1));
+#else
+        in[k].r = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+        in[k].i = (kiss_fft_scalar)(host_uniform()*4096 - 2048);
+#endif
+    }
+}
+
+// one size through both builds; false on any difference
+static int compare(int nfft, kiss_fft_cfg a, kiss_fft_cfg b)
+{
+    input_make(nfft);
+    kiss_fft(a, in, out_default);
+    stage_kiss_fft(b, in, out_stage);
+    return memcmp(out_default, out_stage, nfft*sizeof(kiss_fft_cpx)) == 0;
+}
+
+// best cycles per transform of one build
+static double bench(void (*fft)(kiss_fft_cfg, const kiss_fft_cpx *, kiss_fft_cpx *), kiss_fft_cfg cfg, int nfft)
+{
+    int t, r, runs = BENCH_SAMPLES/nfft;
+    double best = 0;
+    for (t = 0; t < BENCH_TRIES; t++) {
+        uint64_t t0 = host_cycles();
+        for (r = 0; r < runs; r++)
+            fft(cfg, in, out_default);
+        double c = (double)(host_cycles() - t0)/runs;
+        best = (t == 0 || c < best) ? c : best;
+    }
+    return best;
+}
+
+int main(void)
+{
+    int nfft, i;
+
+    printf("%s build\n%6s %14s %12s %8s\n", FORMAT, "nfft", "strided cyc", "stage cyc", "speedup");
+    for (nfft = MIN_NFFT; nfft <= MAX_NFFT; nfft *= 2) {
+        kiss_fft_cfg a = kiss_fft_alloc(nfft, 0, NULL, NULL);
+        kiss_fft_cfg b = stage_kiss_fft_alloc(nfft, 0, NULL, NULL);
+        double strided, stage;
+
+        host_check(compare(nfft, a, b), "nfft %d: stage twiddles change the output", nfft);
+        strided = bench(kiss_fft, a, nfft);
+        stage = bench(stage_kiss_fft, b, nfft);
+        printf("%6d %14.0f %12.0f %7.2fx\n", nfft, strided, stage, strided/stage);
+        free(a);
+        free(b);
+    }
+
+    // radix 3 and 5 stages and the generic butterfly, which has no packed table
+    for (i = 0; i < RANDOM_SIZES; i++) {
+        nfft = 2 + host_rand_below(MAX_RANDOM_NFFT - 1);
+        kiss_fft_cfg a = kiss_fft_alloc(nfft, 0, NULL, NULL);
+        kiss_fft_cfg b = stage_kiss_fft_alloc(nfft, 0, NULL, NULL);
+        host_check(compare(nfft, a, b), "nfft %d: stage twiddles change the output", nfft);
+        free(a);
+        free(b);
+    }
+    return host_result("test_stage " FORMAT);
+}
@@ -0,0 +1,117 @@
+/*
+ * test_tables.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the generated flash tables: twiddles, split twiddles, input
+ * permutation and packed stage twiddles of every supported size against the
+ * ones kiss_fftr_alloc computes at runtime, the FFT output of both configs,
+ * and the Blackman window against the runtime formula it replaced
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "host_test.h"
+
+#ifdef FIXED_POINT
+# define FORMAT (FIXED_POINT == 32 ? "Q31" : "Q15")
+# define WINDOW_TOLERANCE 1     // [LSB] against the float formula rounded to Q15
+#else
+# define FORMAT "float"
+# define WINDOW_TOLERANCE 1e-6
+#endif
+
+// twiddles of the packed stage tables of a complex FFT config, as kf_stage_twiddle_count() sums them
+static int stage_twiddle_count(const struct kiss_fft_state *st)
+{
+    int s, count = 0;
+    for (s = 0; st->factors[2*s + 1] >= 1; s++) {
+        int p = st->factors[2*s], m = st->factors[2*s + 1];
+        if (p >= 2 && p <= 5)
+            count += (p - 1)*m;
+        if (m == 1)
+            break;
+    }
+    return count;
+}
+
+int main(void)
+{
+    static char mem[KISS_FFTR_CFG_TABLES_BYTES];
+    static kiss_fft_scalar x[FFT_TABLE_MAX_NFFT];
+    static kiss_fft_cpx y_runtime[FFT_TABLE_MAX_NFFT/2 + 1], y_flash[FFT_TABLE_MAX_NFFT/2 + 1];
+    int nfft, i, k;
+
+    printf("%s build\n%6s %14s %12s %10s\n", FORMAT, "nfft", "runtime bytes", "flash bytes", "SRAM saved");
+    for (nfft = FFT_TABLE_MIN_NFFT; nfft <= FFT_TABLE_MAX_NFFT; nfft *= 2) {
+        kiss_fftr_cfg runtime = kiss_fftr_alloc(nfft, 0, NULL, NULL);
+        size_t len = sizeof(mem);
+        kiss_fftr_cfg flash = fft_table_fftr_alloc(nfft, mem, &len);
+        const fft_table_entry *t = fft_table_find(nfft);
+        const struct kiss_fft_state *a, *b;
+        double window_diff = 0;
+
+        host_check(flash != NULL && t != NULL, "nfft %d: no flash tables", nfft);
+        if (flash == NULL || t == NULL)
+            continue;
+        a = runtime->substate;
+        b = flash->substate;
+
+        // tables
+        host_check(a->nswaps == b->nswaps && memcmp(a->swaps, b->swaps, 2*a->nswaps*sizeof(kiss_fft_index)) == 0,
+                   "nfft %d: input permutation differs", nfft);
+        for (k = 0; k < nfft/2; k++) {
+            if (memcmp(&a->twiddles[k], &b->twiddles[k*b->twiddle_stride], sizeof(kiss_fft_cpx))) {
+                host_check(0, "nfft %d: twiddle %d differs", nfft, k);
+                break;
+            }
+        }
+        for (k = 1; k <= nfft/4; k++) {
+            if (memcmp(&runtime->super_twiddles[k*runtime->super_stride - 1],
+                       &flash->super_twiddles[k*flash->super_stride - 1], sizeof(kiss_fft_cpx))) {
+                host_check(0, "nfft %d: split twiddle %d differs", nfft, k);
+                break;
+            }
+        }
+#ifdef KISS_FFT_STAGE_TWIDDLES
+        host_check(memcmp(a->stage_twiddles, b->stage_twiddles, stage_twiddle_count(a)*sizeof(kiss_fft_cpx)) == 0,
+                   "nfft %d: stage twiddles differ", nfft);
+#else
+        (void)stage_twiddle_count;
+#endif
+
+        // transforms
+        for (i = 0; i < nfft; i++)
+            x[i] = (kiss_fft_scalar)((int)host_rand_below(4000) - 2000);
+        kiss_fftr(runtime, x, y_runtime);
+        kiss_fftr(flash, x, y_flash);
+        host_check(memcmp(y_runtime, y_flash, (nfft/2 + 1)*sizeof(kiss_fft_cpx)) == 0,
+                   "nfft %d: output of the flash config differs", nfft);
+
+        // window, against the formula processingTask computed at startup
+        for (i = 0; i < nfft/2; i++) {
+            float w = 0.42f - 0.5f*cosf(2*(float)HOST_PI*i/(nfft - 1)) + 0.08f*cosf(4*(float)HOST_PI*i/(nfft - 1));
+#ifdef FIXED_POINT
+            double d = fabs(t->window[i] - floorf(w*32767 + 0.5f));
+#else
+            double d = fabs(t->window[i] - w);
+#endif
+            window_diff = d > window_diff ? d : window_diff;
+        }
+        host_check(window_diff <= WINDOW_TOLERANCE, "nfft %d: window off by %g", nfft, window_diff);
+
+        // SRAM: runtime config and window array against the flash config, whose tables stay in flash
+        size_t ram_runtime = KISS_FFTR_CFG_BYTES(nfft) + nfft*sizeof(fft_window_t);
+        printf("%6d %14u %12u %10u\n", nfft, (unsigned)ram_runtime, (unsigned)KISS_FFTR_CFG_TABLES_BYTES,
+               (unsigned)(ram_runtime - KISS_FFTR_CFG_TABLES_BYTES));
+        free(runtime);
+    }
+    return host_result("test_tables");
+}
@@ -0,0 +1,176 @@
+/*
+ * test_tracker.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the frequency tracker: the harmonics of a square wave tracked
+ * over millions of samples in random blocks (the sample counter wraps), folded
+ * onto their common period, and bins with no short common period beside them,
+ * with the integer accumulators against the direct sum over the last window, the
+ * amplitudes and phases against a double-precision DFT, the restart after
+ * falling behind and tracker_push against tracker_update. The cycles of
+ * keeping the bins current must beat a full real FFT of the window
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+#include "tracker.h"
+#include "host_test.h"
+
+#define RING_SIZE 16384         // ADC ring
+#define ADC_RATE 1000000        // [Hz]
+#define FUNDAMENTAL 20000       // [Hz] square wave, 40% duty
+#define HARMONICS 6             // tracked beside DC
+#define ODD_BINS 3              // bins of the second bank, whose twiddles share no period shorter than a block
+#define RUN_SAMPLES 20000000    // samples tracked in random blocks
+#define MAX_BLOCK 3000          // largest block of new samples per update
+#define MAX_AMPLITUDE_ERROR 2e-4 // relative to the amplitude, or 1 count
+#define MAX_PHASE_ERROR 2e-4    // [rad] of the bins above 5 counts
+#define PUSHED 5000             // samples added one at a time
+#define BENCH_HOP 1000          // [samples] between two readings of the bins
+#define BENCH_SAMPLES 20000000  // samples tracked for the cycle count
+
+static uint16_t ring[RING_SIZE];
+
+// ADC code of sample a: the square wave and a few counts of noise
+static uint16_t sample(uint32_t a)
+{
+    double phase = fmod(a*((double)FUNDAMENTAL/ADC_RATE) + 0.13, 1.0);
+    return (uint16_t)floor(2048 + (phase < 0.4 ? 900 : -600) + 6*(host_uniform() - 0.5) + 0.5);
+}
+
+// writes samples from to to - 1 into the ring
+static void write_samples(uint32_t from, uint32_t to)
+{
+    uint32_t a;
+    for (a = from; a != to; a++)
+        ring[a & (RING_SIZE - 1)] = sample(a);
+}
+
+// true if the accumulators of every bin equal the direct sum over the n samples before count
+static int accumulators_exact(const tracker *t, uint32_t count)
+{
+    int b, m;
+    for (b = 0; b < t->nbins; b++) {
+        const tracker_bin *bin = &t->bins[b];
+        int64_t re = 0, im = 0;
+        for (m = 1; m <= t->n; m++) {
+            int idx = (int)(((int64_t)bin->idx - (int64_t)bin->k*m) % t->n); // twiddle index of sample count - m
+            int32_t x = ring[(count - m) & (RING_SIZE - 1)];
+            idx += idx < 0 ? t->n : 0;
+            re += (int64_t)x*t->tw[2*idx];
+            im -= (int64_t)x*t->tw[2*idx + 1];
+        }
+        if (re != bin->re || im != bin->im)
+            return 0;
+    }
+    return 1;
+}
+
+int main(void)
+{
+    static const int odd_bins[ODD_BINS] = {1, 7, 333};
+    static tracker t, u, v;
+    static kiss_fft_scalar frame[TRACKER_MAX_N];
+    static kiss_fft_cpx bins[TRACKER_MAX_N/2 + 1];
+    int n = tracker_period_length(ADC_RATE, FUNDAMENTAL), h, b;
+    uint32_t count = 0xfff00000u; // the sample counter wraps during the run
+    double amplitude_error = 0, phase_error = 0;
+    long s;
+
+    host_check(n % (ADC_RATE/FUNDAMENTAL) == 0, "window %d not a whole number of periods", n);
+    tracker_init(&t, n);
+    tracker_init(&u, n);
+    tracker_init(&v, n);
+    for (h = 0; h <= HARMONICS; h++) {
+        tracker_add(&t, h*n/(ADC_RATE/FUNDAMENTAL));
+        tracker_add(&u, h*n/(ADC_RATE/FUNDAMENTAL));
+    }
+    for (b = 0; b < ODD_BINS; b++)
+        tracker_add(&v, odd_bins[b]);
+    host_check(t.period == ADC_RATE/FUNDAMENTAL && v.period == n, "common periods %d and %d", t.period, v.period);
+
+    // long run in random blocks, the bank never falls behind
+    write_samples(count - n, count);
+    tracker_reset(&t, count);
+    tracker_reset(&v, count);
+    for (s = 0; s < RUN_SAMPLES; ) {
+        uint32_t block = 1 + host_rand_below(MAX_BLOCK);
+        write_samples(count, count + block);
+        count += block;
+        s += block;
+        tracker_update(&t, ring, RING_SIZE, count, RING_SIZE);
+        tracker_update(&v, ring, RING_SIZE, count, RING_SIZE);
+    }
+    host_check(t.restarts == 0 && v.restarts == 0, "%u restarts while keeping up", t.restarts + v.restarts);
+    host_check(accumulators_exact(&t, count), "accumulators drifted from the direct sum after %d samples",
+               RUN_SAMPLES);
+    host_check(accumulators_exact(&v, count), "accumulators of the bins without a common period drifted");
+
+    // amplitude and phase against a double DFT of the last window
+    printf("window %d samples\n%9s %5s %12s %10s %12s %10s\n", n, "harmonic", "bin", "amplitude", "phase", "DFT ampl",
+           "DFT phase");
+    for (b = 0; b < t.nbins; b++) {
+        int k = t.bins[b].k, m;
+        double re = 0, im = 0, a, p;
+        for (m = 0; m < n; m++) {
+            double x = ring[(count - n + m) & (RING_SIZE - 1)];
+            re += x*cos(2*HOST_PI*k*m/n);
+            im -= x*sin(2*HOST_PI*k*m/n);
+        }
+        a = hypot(re, im)*(k ? 2.0 : 1.0)/n;
+        p = atan2(im, re);
+        printf("%9d %5d %12.2f %+10.4f %12.2f %+10.4f\n", b, k, tracker_amplitude(&t, b), tracker_phase(&t, b), a, p);
+        amplitude_error = fmax(amplitude_error, fabs(tracker_amplitude(&t, b) - a)/fmax(a, 1));
+        if (a > 5)
+            phase_error = fmax(phase_error, fabs(remainder(tracker_phase(&t, b) - p, 2*HOST_PI)));
+    }
+    host_check(amplitude_error <= MAX_AMPLITUDE_ERROR, "amplitude off by %g", amplitude_error);
+    host_check(phase_error <= MAX_PHASE_ERROR, "phase off by %g rad", phase_error);
+
+    // a gap longer than the ring restarts with the latest window
+    write_samples(count, count + 3*RING_SIZE);
+    count += 3*RING_SIZE;
+    tracker_update(&t, ring, RING_SIZE, count, RING_SIZE);
+    host_check(t.restarts == 1 && t.fill == n, "after a gap: %u restarts, window of %d", t.restarts, t.fill);
+    host_check(accumulators_exact(&t, count), "accumulators wrong after the restart");
+
+    // the per-sample form gives the same accumulators as the block update
+    tracker_reset(&t, count);
+    tracker_update(&t, ring, RING_SIZE, count, RING_SIZE);
+    tracker_reset(&u, 0);
+    for (s = 0; s < n; s++)
+        tracker_push(&u, ring[(count - n + s) & (RING_SIZE - 1)], 0);
+    for (s = 0; s < PUSHED; s++, count++) {
+        write_samples(count, count + 1);
+        tracker_push(&u, ring[count & (RING_SIZE - 1)], ring[(count - n) & (RING_SIZE - 1)]);
+    }
+    tracker_update(&t, ring, RING_SIZE, count, RING_SIZE);
+    for (b = 0; b < t.nbins; b++)
+        host_check(t.bins[b].re == u.bins[b].re && t.bins[b].im == u.bins[b].im && t.bins[b].idx == u.bins[b].idx,
+                   "bin %d: tracker_push differs from tracker_update", t.bins[b].k);
+
+    // cycles per reading every BENCH_HOP samples: the bins kept current against a full FFT of the window
+    kiss_fftr_cfg cfg = kiss_fftr_alloc(TRACKER_MAX_N, 0, NULL, NULL);
+    uint64_t t0 = host_cycles(), t1, t2;
+    for (s = 0; s < BENCH_SAMPLES; s += BENCH_HOP) {
+        count += BENCH_HOP;
+        tracker_update(&t, ring, RING_SIZE, count, RING_SIZE);
+    }
+    t1 = host_cycles();
+    for (s = 0; s < BENCH_SAMPLES; s += BENCH_HOP) {
+        for (b = 0; b < TRACKER_MAX_N; b++)
+            frame[b] = (kiss_fft_scalar)ring[(s + b) & (RING_SIZE - 1)];
+        kiss_fftr(cfg, frame, bins);
+    }
+    t2 = host_cycles();
+    printf("cycles per reading every %d samples: %d bins tracked %.0f, %d-point real FFT %.0f\n", BENCH_HOP, t.nbins,
+           (double)(t1 - t0)*BENCH_HOP/BENCH_SAMPLES, TRACKER_MAX_N, (double)(t2 - t1)*BENCH_HOP/BENCH_SAMPLES);
+    host_check(t1 - t0 < t2 - t1, "tracking %d bins slower than the FFT", t.nbins);
+    free(cfg);
+    return host_result("test_tracker");
+}
@@ -0,0 +1,458 @@
+/*
+ * test_trigger.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the trigger comparator: random signals, levels, hysteresis,
+ * slopes and holdoffs streamed through the ADC ring by adc_host.c in blocks of
+ * several sizes while the sequence crosses 2^32 and the ring wraps, and cut
+ * into random unaligned runs fed to trigger_stream_block() directly, against
+ * a one-sample-at-a-time reference comparator; trigger_resample() against
+ * the interpolation in double precision. Recorded streams replayed through
+ * adc_host_replay() drive the consumer side: trigger_stream_latest() against
+ * the newest ready event of the reference, the frames it locates snapshot and
+ * resampled with the crossing on their trigger column, and the auto and single
+ * modes. The packed comparator must take no more cycles per block than the
+ * reference on a flat signal, noise at the level and pulses
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "adc_block.h"
+#include "trigger.h"
+#include "adc_host.h"
+#include "host_test.h"
+
+#define RING_SIZE 16384         // ADC ring
+#define TRIALS 20               // random settings per block size
+#define TRIAL_SAMPLES 131072    // samples streamed per trial
+#define MAX_RUN 300             // [samples] longest run fed to trigger_stream_block() directly
+#define RESAMPLE_RUNS 2000      // random frames through trigger_resample()
+#define RECORDING 40000         // [samples] replayed over and over, not a whole number of blocks
+#define GLITCH_PERIOD 10000     // [samples] between the 3-sample glitches of the glitch recording
+#define FRAME 128               // [samples] displayed frame, as ADC_TRIGGER_SIZE in sampling.c
+#define LATEST_RUNS 3000        // consumer reads per trial
+#define AUTO_TIMEOUT 20000      // [samples]
+#define BENCH_BLOCKS 20000
+#define BENCH_SHAPES (RING_SIZE/1024) // different 1024-sample blocks of the benchmark signal
+#define BENCH_SLACK 1.05        // the packed comparator may measure this much slower, timing noise of the host
+
+static volatile uint16_t buffer[RING_SIZE] __attribute__((aligned(16)));
+static uint16_t stream[TRIAL_SAMPLES + 8];
+static uint16_t recording[RECORDING];
+static trigger_event expected[TRIAL_SAMPLES];
+static adc_block_ring ring;
+static trigger_stream ts;
+
+// one sample at a time, as the comparator is specified
+typedef struct {
+    int32_t level, low;         // mirrored for a falling trigger
+    bool rising, armed;
+    int32_t prev;
+    uint64_t holdoff_end;
+    int events;                 // events in expected[]
+} reference;
+
+// reference comparator with the settings of ts, no crossing into the first sample
+static void reference_init(reference *r)
+{
+    r->rising = ts.rising;
+    r->level = r->rising ? ts.level : 0x7fff - ts.level;
+    r->low = r->level - ts.hysteresis;
+    r->armed = false;
+    r->prev = r->level;
+    r->holdoff_end = 0;
+    r->events = 0;
+}
+
+// sample x with sequence number number through the reference
+static void reference_step(reference *r, int32_t x, uint64_t number)
+{
+    x = r->rising ? x : 0x7fff - x;
+    if (x < r->low) {
+        r->armed = true;
+    } else if (r->armed && r->prev <= r->level && x > r->level) {
+        r->armed = false;
+        if (number >= r->holdoff_end) {
+            expected[r->events].index = number - 1;
+            expected[r->events].frac = (float)(r->level - r->prev)/(x - r->prev);
+            r->events++;
+            r->holdoff_end = number + ts.holdoff;
+        }
+    }
+    r->prev = x;
+}
+
+// random comparator settings for a signal around offset, normal mode
+static void settings_make(int32_t offset)
+{
+    memset(&ts, 0, sizeof(ts));
+    ts.level = offset - 300 + (int32_t)host_rand_below(601);
+    ts.hysteresis = host_rand_below(3) ? (int32_t)host_rand_below(200) : 0;
+    ts.rising = host_rand_below(2);
+    ts.mode = TRIGGER_NORMAL;
+    ts.holdoff = host_rand_below(2) ? host_rand_below(3000) : 0;
+}
+
+// random signal of one or two tones and noise for adc_host.c, clipped by the ADC now and then
+static void signal_make(adc_host_signal *s)
+{
+    int i;
+
+    memset(s, 0, sizeof(*s));
+    s->offset = 1024 + host_rand_below(2048);
+    s->tones = 1 + host_rand_below(2);
+    for (i = 0; i < s->tones; i++) {
+        s->hz[i] = 100 + host_uniform()*100000;
+        s->amplitude[i] = host_uniform()*1500;
+    }
+    s->noise_rms = host_uniform()*host_uniform()*200;
+}
+
+// the events recorded since seen against expected[], the ones the queue has overwritten skipped
+static void events_check(const char *what, uint32_t *seen, const reference *r)
+{
+    uint32_t head = ts.head, e;
+
+    host_check(head == (uint32_t)r->events, "%s: %u events, %d expected", what, head, r->events);
+    if (head - *seen > TRIGGER_QUEUE_SIZE)
+        *seen = head - TRIGGER_QUEUE_SIZE;
+    for (e = *seen; e < head && e < (uint32_t)r->events; e++) {
+        const trigger_event *q = &ts.queue[e & (TRIGGER_QUEUE_SIZE - 1)];
+        host_check(q->index == expected[e].index && q->frac == expected[e].frac && !q->forced,
+                   "%s: event %u at %llu + %.4f, expected %llu + %.4f", what, e, (unsigned long long)q->index, q->frac,
+                   (unsigned long long)expected[e].index, expected[e].frac);
+    }
+    *seen = head;
+}
+
+// publishes one block and runs the reference on it
+static void publish(reference *r)
+{
+    uint64_t end;
+    uint32_t i;
+
+    adc_host_run(1);
+    end = adc_block_sequence(&ring);
+    for (i = 0; i < ring.block; i++)
+        reference_step(r, buffer[(uint32_t)(end - ring.block + i) & (RING_SIZE - 1)], end - ring.block + i);
+}
+
+// the comparator on the blocks of the ring as adc_block_publish() runs it, the sequence crossing 2^32
+static long ring_trials(uint32_t block)
+{
+    long events = 0;
+    int trial;
+
+    for (trial = 0; trial < TRIALS; trial++) {
+        adc_host_signal s;
+        reference r;
+        uint32_t k, seen = 0;
+        char what[64];
+
+        signal_make(&s);
+        settings_make((int32_t)s.offset);
+        adc_host_block(block);
+        adc_driver_init(&ring, buffer, RING_SIZE);
+        adc_host_signal_set(&s);
+        ring.count = 0u - block*(1 + host_rand_below(TRIAL_SAMPLES/block)); // the low word wraps in the trial
+        reference_init(&r);
+        trigger_stream_attach(&ts, &ring);
+        snprintf(what, sizeof(what), "block %u trial %d", block, trial);
+        for (k = 0; k < TRIAL_SAMPLES/block; k++) {
+            publish(&r);
+            events_check(what, &seen, &r);
+        }
+        host_check(ring.count_hi == 1, "%s: the sequence did not cross 2^32", what);
+        events += r.events;
+    }
+    return events;
+}
+
+// the comparator on random runs of a stream at any alignment, the numbering crossing 2^32
+static long run_trials(void)
+{
+    long events = 0;
+    int trial;
+
+    for (trial = 0; trial < TRIALS; trial++) {
+        uint64_t base = 0xffffffffull - host_rand_below(TRIAL_SAMPLES);
+        uint32_t offset = host_rand_below(8), seen = 0, i, n;
+        double phase = 0, hz = 100 + host_uniform()*100000, amplitude = host_uniform()*1500;
+        double noise = host_uniform()*200;
+        int32_t mean = 1024 + (int32_t)host_rand_below(2048);
+        reference r;
+        char what[64];
+
+        for (i = 0; i < TRIAL_SAMPLES; i++) { // odd starts put the lanes across the word boundaries
+            double x = mean + amplitude*cos(phase) + noise*(host_uniform() - 0.5);
+            stream[offset + i] = (uint16_t)(x < 0 ? 0 : x > 4095 ? 4095 : floor(x + 0.5));
+            phase = fmod(phase + 2*HOST_PI*hz/ADC_HOST_RATE, 2*HOST_PI);
+        }
+        settings_make(mean);
+        adc_driver_init(&ring, buffer, RING_SIZE);
+        trigger_stream_attach(&ts, &ring);
+        reference_init(&r);
+        snprintf(what, sizeof(what), "runs trial %d", trial);
+        for (i = 0; i < TRIAL_SAMPLES; i += n) {
+            uint32_t j;
+            n = 1 + host_rand_below(MAX_RUN);
+            n = n < TRIAL_SAMPLES - i ? n : TRIAL_SAMPLES - i;
+            trigger_stream_block(&ts, &stream[offset + i], base + i, n);
+            for (j = i; j < i + n; j++)
+                reference_step(&r, stream[offset + j], base + j);
+            events_check(what, &seen, &r);
+        }
+        events += r.events;
+    }
+    return events;
+}
+
+// trigger_resample() of random frames against the interpolation in double precision, 1/2 count of rounding and the
+// fraction in Q16
+static void resample_check(void)
+{
+    static uint16_t x[129], y[128];
+    double worst = 0;
+    int t, i;
+
+    for (t = 0; t < RESAMPLE_RUNS; t++) {
+        float frac = t == 0 ? 0 : (float)host_uniform();
+        for (i = 0; i < 129; i++)
+            x[i] = (uint16_t)host_rand_below(4096);
+        trigger_resample(x, 128, frac, y);
+        for (i = 0; i < 128; i++) {
+            double exact = x[i] + ((double)x[i + 1] - x[i])*frac;
+            double slack = 0.5 + fabs((double)x[i + 1] - x[i])/65536;
+            worst = fmax(worst, fabs(y[i] - exact) - slack);
+            host_check(t > 0 || y[i] == x[i], "trigger_resample with frac 0 changed sample %d", i);
+        }
+    }
+    host_check(worst <= 1e-9, "trigger_resample off by %g counts beyond rounding", worst);
+}
+
+// recording of kind 0: 20 kHz pulses, 1: a slow sine, 2: white noise, 3: flat with a glitch every GLITCH_PERIOD
+static void recording_make(int kind)
+{
+    int i;
+    for (i = 0; i < RECORDING; i++) {
+        double x = kind == 0 ? 2048 + 1200*(i % 50 < 20 ? 1 : -1) + 80*(host_uniform() - 0.5) :
+                   kind == 1 ? 2048 + 600*sin(2*HOST_PI*i/1234.5) + 60*(host_uniform() - 0.5) :
+                   kind == 2 ? 4096*host_uniform() :
+                   1000 + 10*(host_uniform() - 0.5) + (i % GLITCH_PERIOD < 3 ? 2500 : 0);
+        recording[i] = (uint16_t)(x < 0 ? 0 : x > 4095 ? 4095 : floor(x));
+    }
+}
+
+// settings of the waveform task for a frame with pre samples before the trigger
+static void frame_settings(trigger_mode mode, uint32_t pre)
+{
+    memset(&ts, 0, sizeof(ts));
+    ts.level = 2048;
+    ts.hysteresis = 20;
+    ts.rising = host_rand_below(2);
+    ts.mode = mode;
+    ts.pre = pre;
+    ts.post = FRAME - 1 - pre;
+    ts.auto_timeout = AUTO_TIMEOUT;
+}
+
+// the frame of event e as triggerSearch() in sampling.c copies it: false if the snapshot was refused, otherwise
+// checks that resampling puts the crossing on column pre
+static bool frame_check(const char *what, const trigger_event *e)
+{
+    uint16_t x[FRAME + 1], y[FRAME];
+    int32_t level = ts.rising ? ts.level : 0x7fff - ts.level, a, b, c;
+
+    if (!adc_block_snapshot(&ring, e->index + ts.post + 2, FRAME + 1, x))
+        return false;
+    trigger_resample(x, FRAME, e->frac, y);
+    a = ts.rising ? x[ts.pre] : 0x7fff - x[ts.pre];
+    b = ts.rising ? x[ts.pre + 1] : 0x7fff - x[ts.pre + 1];
+    c = ts.rising ? y[ts.pre] : 0x7fff - y[ts.pre];
+    host_check(a <= level && b > level && abs(c - level) <= 1, "%s: event at %llu, samples %d %d and column %d of "
+               "level %d", what, (unsigned long long)e->index, a, b, c, level);
+    return true;
+}
+
+// trigger_stream_latest() of a consumer reading after random numbers of blocks, against the newest event of the
+// reference whose frame is published and which is newer than the last one taken
+static void latest_trials(int kind, uint32_t block)
+{
+    uint32_t tail = 0, taken = 0, k;
+    reference r;
+    char what[64];
+    int t;
+
+    recording_make(kind);
+    adc_host_block(block);
+    adc_driver_init(&ring, buffer, RING_SIZE);
+    adc_host_replay(recording, RECORDING);
+    ring.count = 0u - block*(1 + host_rand_below(LATEST_RUNS)); // the low word wraps in the trial
+    frame_settings(TRIGGER_NORMAL, host_rand_below(FRAME));
+    ts.holdoff = host_rand_below(2) ? host_rand_below(3000) : 0;
+    reference_init(&r);
+    trigger_stream_attach(&ts, &ring);
+    snprintf(what, sizeof(what), "recording %d block %u", kind, block);
+    for (t = 0; t < LATEST_RUNS; t++) {
+        uint64_t published;
+        uint32_t want = 0, i;
+        trigger_event e;
+        bool ok;
+
+        for (k = 1 + host_rand_below(3*1024/block); k > 0; k--)
+            publish(&r);
+        published = adc_block_sequence(&ring);
+        if ((uint32_t)r.events - tail > TRIGGER_QUEUE_SIZE)
+            tail = r.events - TRIGGER_QUEUE_SIZE;
+        for (i = r.events; i > tail && !want; i--)
+            if (expected[i - 1].index + ts.post + 2 <= published)
+                want = i;
+        ok = trigger_stream_latest(&ts, published, &e);
+        host_check(ok == (want != 0), "%s: trigger_stream_latest %s a frame", what, ok ? "found" : "missed");
+        if (!ok || !want)
+            continue;
+        tail = want;
+        host_check(e.index == expected[want - 1].index && e.frac == expected[want - 1].frac && !e.forced,
+                   "%s: took the event at %llu, not the newest ready at %llu", what, (unsigned long long)e.index,
+                   (unsigned long long)expected[want - 1].index);
+        host_check(frame_check(what, &e), "%s: snapshot of the frame at %llu refused", what,
+                   (unsigned long long)e.index);
+        taken++;
+    }
+    printf("recording %d, blocks of %4u: %5d events, %4u frames taken\n", kind, block, r.events, taken);
+}
+
+// auto mode on a flat signal forces a frame every auto timeout, real triggers on the pulses; single mode takes one
+// frame, then none until trigger_stream_arm(); normal mode catches every glitch of the glitch recording
+static void mode_checks(void)
+{
+    static const adc_host_signal flat = {1000, 0, {0}, {0}, 0, false};
+    uint32_t i, forced = 0, head;
+    uint64_t last = 0, armed_at;
+    trigger_event e;
+
+    adc_host_block(1024);
+    adc_driver_init(&ring, buffer, RING_SIZE);
+    adc_host_replay(NULL, 0);
+    adc_host_signal_set(&flat);
+    frame_settings(TRIGGER_AUTO, 64);
+    trigger_stream_attach(&ts, &ring);
+    for (i = 0; i < 1000; i++) {
+        head = ts.head;
+        adc_host_run(1);
+        if (ts.head == head)
+            continue;
+        e = ts.queue[head & (TRIGGER_QUEUE_SIZE - 1)];
+        host_check(ts.head == head + 1 && e.forced && e.index + ts.post + 2 == adc_block_sequence(&ring),
+                   "auto, flat: event at %llu not a forced frame of the latest samples", (unsigned long long)e.index);
+        host_check(forced == 0 || (e.index - last > AUTO_TIMEOUT && e.index - last <= AUTO_TIMEOUT + 1024),
+                   "auto, flat: forced frames %llu samples apart", (unsigned long long)(e.index - last));
+        last = e.index;
+        forced++;
+    }
+    host_check(trigger_stream_latest(&ts, adc_block_sequence(&ring), &e) && e.forced && e.index == last,
+               "auto, flat: the last forced frame not taken");
+
+    recording_make(0);
+    adc_host_replay(recording, RECORDING);
+    head = ts.head;
+    adc_host_run(100);
+    for (i = head + 1; i < ts.head; i++) // the first may still be forced before the pulses arrive
+        host_check(!ts.queue[i & (TRIGGER_QUEUE_SIZE - 1)].forced, "auto, pulses: a frame forced");
+    printf("auto: %u forced frames on a flat signal, %u triggers on the pulses\n", forced, ts.head - head);
+
+    ts.mode = TRIGGER_SINGLE;
+    head = ts.head;
+    adc_host_run(100);
+    host_check(ts.head == head + 1 && ts.stopped, "single: %u frames, stopped %d", ts.head - head, ts.stopped);
+    armed_at = adc_block_sequence(&ring);
+    trigger_stream_arm(&ts);
+    for (i = 0; i < 100 && ts.head == head + 1; i++)
+        adc_host_run(1);
+    host_check(trigger_stream_latest(&ts, adc_block_sequence(&ring), &e) && e.index + 1 >= armed_at &&
+               frame_check("single", &e), "single: the frame after arming at %llu wrong", (unsigned long long)armed_at);
+    adc_host_run(100);
+    host_check(ts.head == head + 2 && ts.stopped, "single, armed again: %u frames", ts.head - head - 1);
+
+    recording_make(3);
+    adc_driver_init(&ring, buffer, RING_SIZE);
+    adc_host_replay(recording, RECORDING);
+    frame_settings(TRIGGER_NORMAL, 64);
+    ts.rising = true;
+    trigger_stream_attach(&ts, &ring);
+    adc_host_run(2000);
+    host_check(ts.head == 2000*1024/GLITCH_PERIOD, "normal, glitches: %u of %u caught", ts.head,
+               2000*1024/GLITCH_PERIOD); // not the one in the first samples, the comparator is not armed yet
+    printf("normal: %u of %u glitches caught over %d samples\n", ts.head, 2000*1024/GLITCH_PERIOD, 2000*1024);
+}
+
+// cycles per 1024-sample block of the comparator, and of the reference, on a signal around the level: the
+// fastest of the repeats of each of the BENCH_SHAPES blocks, taken in turns so both see the same load
+static void bench(const char *name, double amplitude, double noise)
+{
+    double packed[BENCH_SHAPES], scalar[BENCH_SHAPES], packed_sum = 0, scalar_sum = 0;
+    reference r;
+    uint64_t t0, t1, t2;
+    uint32_t i;
+    int k;
+
+    for (i = 0; i < RING_SIZE; i++) {
+        double x = 2048 + amplitude*(i % 50 < 20 ? 1 : -1) + noise*(host_uniform() - 0.5); // 20 kHz 40% pulses
+        buffer[i] = (uint16_t)(x < 0 ? 0 : x > 4095 ? 4095 : floor(x + 0.5));
+    }
+    memset(&ts, 0, sizeof(ts));
+    ts.level = 2048;
+    ts.hysteresis = 20;
+    ts.rising = true;
+    ts.mode = TRIGGER_NORMAL;
+    adc_driver_init(&ring, buffer, RING_SIZE);
+    trigger_stream_attach(&ts, &ring);
+    reference_init(&r);
+    for (k = 0; k < BENCH_SHAPES; k++)
+        packed[k] = scalar[k] = HUGE_VAL;
+    for (k = 0; k < BENCH_BLOCKS; k++) {
+        const volatile uint16_t *x = &buffer[(k % BENCH_SHAPES)*1024];
+        t0 = host_cycles();
+        trigger_stream_block(&ts, x, (uint64_t)k*1024, 1024);
+        t1 = host_cycles();
+        for (i = 0; i < 1024; i++)
+            reference_step(&r, x[i], (uint64_t)k*1024 + i);
+        t2 = host_cycles();
+        r.events = 0;
+        packed[k % BENCH_SHAPES] = fmin(packed[k % BENCH_SHAPES], (double)(t1 - t0));
+        scalar[k % BENCH_SHAPES] = fmin(scalar[k % BENCH_SHAPES], (double)(t2 - t1));
+    }
+    for (k = 0; k < BENCH_SHAPES; k++) {
+        packed_sum += packed[k]/BENCH_SHAPES;
+        scalar_sum += scalar[k]/BENCH_SHAPES;
+    }
+    printf("%-16s %10.0f %10.0f\n", name, packed_sum, scalar_sum);
+    host_check(packed_sum <= BENCH_SLACK*scalar_sum, "%s: packed comparator %.0f cycles per block, reference %.0f",
+               name, packed_sum, scalar_sum);
+}
+
+int main(void)
+{
+    static const uint32_t blocks[] = {1, 2, 8, 64, 1024};
+    unsigned b;
+
+    for (b = 0; b < sizeof(blocks)/sizeof(blocks[0]); b++)
+        printf("blocks of %4u: %ld events checked\n", blocks[b], ring_trials(blocks[b]));
+    printf("random runs:    %ld events checked\n", run_trials());
+    resample_check();
+    for (b = 0; b < 4*3; b++)
+        latest_trials(b/3, blocks[2 + b % 3]);
+    mode_checks();
+
+    printf("cycles per 1024-sample block\n%-16s %10s %10s\n", "signal", "packed", "reference");
+    bench("flat", 0, 0);
+    bench("noise at level", 0, 60);
+    bench("20 kHz pulses", 1200, 80);
+    return host_result("test_trigger");
+}
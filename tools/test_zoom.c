@@ -0,0 +1,120 @@
+/*
+ * test_zoom.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Host test of the zoom FFT: two tones a few zoomed bins apart, too close for
+ * the full-span FFT, through zoom_apply and zoom_execute at every zoom factor
+ * and several center frequencies. Both must show up as separate peaks at their
+ * bins with the right level difference, the rest of the displayed band below
+ * a spur limit. Built once per number format
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "window.h"
+#include "zoom.h"
+#include "host_test.h"
+
+#define RING_SIZE 16384         // ADC ring, the frames wrap around its end
+#define ADC_RATE 1000000.0      // [Hz]
+#define TONE1_BIN 10.3          // [zoomed bins] first tone above the center frequency
+#define TONE2_BIN 16.7          // second tone, 6.4 bins further: one full-span bin at factor 32 is 8 zoomed bins
+#define TONE1_AMPLITUDE 1500    // [ADC counts]
+#define TONE2_DB -20            // [dB] level of the second tone
+#define LEVEL_SLACK 1.0         // [dB] measured level difference against TONE2_DB
+#define MIN_DIP 10              // [dB] the spectrum between the tones drops this far below the weaker one
+#define LEAKAGE 5               // [bins] either side of a tone or its image left out of the spur check
+#define MAX_SPUR -60            // [dB] largest other bin relative to the first tone, the ADC noise is about -65 dB
+
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define FORMAT "Q31"
+# else
+#  define FORMAT "Q15"
+# endif
+#else
+# define FORMAT "float"
+#endif
+
+static uint16_t ring[RING_SIZE];
+static kiss_fft_cpx buf[ZOOM_NFFT];
+
+// true if bin k is within LEAKAGE of a tone at offset bins above the center, or of its image at -f (the signal is
+// real, low centers put it in the displayed band)
+static int near_tone(int k, double offset, double center_bins)
+{
+    double image = ZOOM_NFFT/2 - 2*center_bins - offset;
+    return fabs(k - (ZOOM_NFFT/2 + offset)) <= LEAKAGE || fabs(k - image) <= LEAKAGE;
+}
+
+// largest bin magnitude in dB between bins lo and hi, and its bin
+static double peak_db(const double *db, int lo, int hi, int *at)
+{
+    int k;
+    *at = lo;
+    for (k = lo; k <= hi; k++)
+        if (db[k] > db[*at])
+            *at = k;
+    return db[*at];
+}
+
+int main(void)
+{
+    static const uint32_t centers[] = {20, 100, 256, 400};
+    static fft_window_t ram[ZOOM_NFFT/2];
+    window_table wt;
+    int factor, c, k;
+
+    window_init(&wt, WINDOW_BLACKMAN, WINDOW_KAISER_BETA, ZOOM_NFFT, ram);
+    printf("%s build\n%6s %8s %10s %10s %9s %9s\n", FORMAT, "factor", "center", "level dB", "dip dB", "spur dB",
+           "peaks");
+    for (factor = ZOOM_FACTOR_MIN; factor <= ZOOM_FACTOR_MAX; factor *= 2) {
+        for (c = 0; c < (int)(sizeof(centers)/sizeof(centers[0])); c++) {
+            zoom_plan z;
+            double bin_hz = ADC_RATE/factor/ZOOM_NFFT, db[ZOOM_NFFT], spur = -200, dip = 0;
+            double center_hz, f1, f2, p1, p2;
+            int k1, k2, first = RING_SIZE - 1000, n, shift; // wraps
+            int expect1 = ZOOM_NFFT/2 + (int)floor(TONE1_BIN + 0.5);
+            int expect2 = ZOOM_NFFT/2 + (int)floor(TONE2_BIN + 0.5);
+
+            host_check(zoom_init(&z, factor, centers[c]), "zoom_init factor %d center %u failed", factor, centers[c]);
+            center_hz = centers[c]*ADC_RATE/ZOOM_NCO_SIZE;
+            f1 = center_hz + TONE1_BIN*bin_hz;
+            f2 = center_hz + TONE2_BIN*bin_hz;
+            for (n = 0; n < RING_SIZE; n++) {
+                int i = (n - first + RING_SIZE) & (RING_SIZE - 1); // sample index of the frame
+                double x = 2048 + TONE1_AMPLITUDE*cos(2*HOST_PI*f1*i/ADC_RATE) + host_uniform() - 0.5 +
+                           TONE1_AMPLITUDE*pow(10, TONE2_DB/20.0)*cos(2*HOST_PI*f2*i/ADC_RATE + 1);
+                ring[n] = (uint16_t)floor(x + 0.5);
+            }
+
+            shift = zoom_apply(&z, &wt, ring, RING_SIZE, first, 2048, buf);
+            (void)shift; // levels are relative, the block exponent cancels
+            zoom_execute(buf);
+            for (k = 0; k < ZOOM_NFFT; k++)
+                db[k] = 10*log10((double)buf[k].r*buf[k].r + (double)buf[k].i*buf[k].i + 1e-30);
+
+            // the two tones, each the peak of its half of the gap between them
+            p1 = peak_db(db, expect1 - 3, (expect1 + expect2)/2, &k1);
+            p2 = peak_db(db, (expect1 + expect2)/2 + 1, expect2 + 3, &k2);
+            for (k = k1; k <= k2; k++)
+                dip = fmax(dip, p2 - db[k]);
+            for (k = ZOOM_GUARD; k < ZOOM_NFFT - ZOOM_GUARD; k++)
+                if (!near_tone(k, TONE1_BIN, center_hz/bin_hz) && !near_tone(k, TONE2_BIN, center_hz/bin_hz))
+                    spur = fmax(spur, db[k] - p1);
+
+            printf("%6d %7.0fk %10.2f %10.1f %9.1f %4d %4d\n", factor, center_hz/1000, p2 - p1, dip, spur, k1, k2);
+            host_check(abs(k1 - expect1) <= 1 && abs(k2 - expect2) <= 1, "factor %d center %u: peaks at %d and %d, "
+                       "not %d and %d", factor, centers[c], k1, k2, expect1, expect2);
+            host_check(fabs(p2 - p1 - TONE2_DB) <= LEVEL_SLACK, "factor %d center %u: level difference %.2f dB",
+                       factor, centers[c], p2 - p1);
+            host_check(dip >= MIN_DIP, "factor %d center %u: tones not resolved, dip %.1f dB", factor, centers[c], dip);
+            host_check(spur <= MAX_SPUR, "factor %d center %u: spur at %.1f dB", factor, centers[c], spur);
+        }
+    }
+    return host_result("test_zoom " FORMAT);
+}
@@ -0,0 +1,190 @@
+/*
+ * tracker.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Frequency tracker: a bank of sliding DFT bins updated sample by sample
+ * from the ADC ring buffer, for watching a few frequencies without an FFT
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "tracker.h"
+
+#define PI 3.14159265358979323846
+#define TW_ONE 32767.0f // Q15 twiddle magnitude
+
+// the recursion is the modulated sliding DFT: each sample is multiplied by its own twiddle and added, and
+// the sample n older is multiplied by the same twiddle (the twiddles repeat every n samples) and subtracted.
+// there is no feedback multiply, and the integer products cancel exactly, so the bins never drift
+
+// builds the twiddle table
+bool tracker_init(tracker *t, int n)
+{
+    int m;
+
+    if (n < 2 || n > TRACKER_MAX_N)
+        return false;
+
+    t->n = n;
+    t->nbins = 0;
+    t->period = 1; // no bins, nothing turns
+    t->restarts = 0;
+    for (m = 0; m < n; m++) {
+        t->tw[2*m] = (int16_t)floor(TW_ONE*cos(2*PI*m/n) + 0.5);
+        t->tw[2*m + 1] = (int16_t)floor(TW_ONE*sin(2*PI*m/n) + 0.5);
+    }
+    tracker_reset(t, 0);
+    return true;
+}
+
+// longest window of whole periods of f0
+int tracker_period_length(uint32_t fs, uint32_t f0)
+{
+    if (f0 == 0 || fs % f0 != 0 || fs/f0 > TRACKER_MAX_N)
+        return TRACKER_MAX_N;
+    uint32_t period = fs/f0;
+    return (int)(period*(TRACKER_MAX_N/period));
+}
+
+// greatest common divisor, gcd(a, 0) = a
+static int gcd(int a, int b)
+{
+    while (b) {
+        int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+// adds a bin
+int tracker_add(tracker *t, int k)
+{
+    if (t->nbins >= TRACKER_MAX_BINS || k < 0 || k > t->n/2)
+        return -1;
+
+    // W^(k*m) repeats every n/gcd(n, k) samples, the bank every n/gcd(n, k of every bin)
+    t->period = t->n/gcd(gcd(t->n, t->n/t->period), k);
+
+    tracker_bin *bin = &t->bins[t->nbins];
+    bin->k = k;
+    bin->idx = 0;
+    bin->re = bin->im = 0;
+    return t->nbins++;
+}
+
+// empties the windows
+void tracker_reset(tracker *t, uint32_t count)
+{
+    int b;
+
+    for (b = 0; b < t->nbins; b++) {
+        t->bins[b].idx = 0; // the phase origin is the first sample of the window
+        t->bins[b].re = t->bins[b].im = 0;
+    }
+    t->fill = 0;
+    t->next = count - t->n;
+}
+
+// adds len sample differences to one bin
+static void bin_update(tracker_bin *bin, const int16_t *tw, int n, const int32_t *d, int len)
+{
+    int64_t re = bin->re, im = bin->im;
+    int idx = bin->idx, k = bin->k, i;
+
+    for (i = 0; i < len; i++) {
+        re += (int64_t)d[i]*tw[2*idx];      // x*W^idx, W = exp(-2*pi*j/n)
+        im -= (int64_t)d[i]*tw[2*idx + 1];
+        idx += k;
+        if (idx >= n)
+            idx -= n;
+    }
+
+    bin->re = re;
+    bin->im = im;
+    bin->idx = idx;
+}
+
+// adds the new samples of the ring buffer
+void tracker_update(tracker *t, const volatile uint16_t *ring, uint32_t ring_size, uint32_t count, uint32_t max_lag)
+{
+    int32_t d[TRACKER_BLOCK]; // new sample minus the sample it replaces
+    uint32_t mask = ring_size - 1;
+    int b, i;
+
+    // the oldest sample read is n before the next one, and must not be overwritten while it is read
+    if (count - t->next > max_lag || count - t->next + (uint32_t)t->n > ring_size - ring_size/4) {
+        tracker_reset(t, count);
+        t->restarts++;
+    }
+
+    while (t->next != count) {
+        int len = count - t->next < TRACKER_BLOCK ? (int)(count - t->next) : TRACKER_BLOCK;
+
+        for (i = 0; i < len; i++) {
+            uint32_t a = t->next + i;
+            d[i] = ring[a & mask] - (t->fill + i < t->n ? 0 : ring[(a - t->n) & mask]);
+        }
+        if (t->period < len) {
+            // the twiddles repeat every period: sum the samples that share one, then weigh the period sums
+            int p = t->period, r = 0;
+            for (i = p; i < len; i++) {
+                d[r] += d[i];
+                r = r + 1 < p ? r + 1 : 0;
+            }
+            for (b = 0; b < t->nbins; b++) {
+                tracker_bin *bin = &t->bins[b];
+                bin_update(bin, t->tw, t->n, d, p); // k*p is a multiple of n, this leaves idx where it was
+                bin->idx = (bin->idx + bin->k*len) % t->n;
+            }
+        } else {
+            for (b = 0; b < t->nbins; b++)
+                bin_update(&t->bins[b], t->tw, t->n, d, len);
+        }
+
+        t->next += len;
+        t->fill = t->fill + len < t->n ? t->fill + len : t->n;
+    }
+}
+
+// adds one sample
+void tracker_push(tracker *t, int32_t x, int32_t x_old)
+{
+    int32_t d = t->fill < t->n ? x : x - x_old;
+    int b;
+
+    for (b = 0; b < t->nbins; b++)
+        bin_update(&t->bins[b], t->tw, t->n, &d, 1);
+
+    t->next++;
+    if (t->fill < t->n)
+        t->fill++;
+}
+
+// peak amplitude of bin i
+float tracker_amplitude(const tracker *t, int i)
+{
+    const tracker_bin *bin = &t->bins[i];
+    float re = (float)bin->re, im = (float)bin->im;
+
+    if (t->fill == 0)
+        return 0;
+    return sqrtf(re*re + im*im)*(bin->k && 2*bin->k != t->n ? 2.0f : 1.0f)/(t->fill*TW_ONE); // one-sided
+}
+
+// phase of bin i
+float tracker_phase(const tracker *t, int i)
+{
+    const tracker_bin *bin = &t->bins[i];
+
+    // rotate from the phase origin to the first sample of the window, k*(next - fill - origin) mod n
+    int r = bin->idx - (int)(((int64_t)bin->k*t->fill) % t->n);
+    if (r < 0)
+        r += t->n;
+    float c = t->tw[2*r], s = t->tw[2*r + 1];
+    float re = (float)bin->re, im = (float)bin->im;
+    return atan2f(re*s + im*c, re*c - im*s); // the sum times W^-r
+}
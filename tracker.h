@@ -0,0 +1,74 @@
+/*
+ * tracker.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Frequency tracker: a bank of sliding DFT bins updated sample by sample
+ * from the ADC ring buffer, for watching a few frequencies without an FFT
+ */
+
+#ifndef TRACKER_H_
+#define TRACKER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRACKER_MAX_N 1024      // longest window, bins are fs/n apart
+#define TRACKER_MAX_BINS 8      // largest number of tracked bins
+#define TRACKER_BLOCK 256       // samples per inner pass of tracker_update()
+
+// one tracked bin. acc is the DFT of the window with the phase of its sample k*(phase origin)
+// still applied, so adding a sample and dropping the one n samples older is exact in integers
+typedef struct {
+    int k;                      // bin, frequency k*fs/n
+    int idx;                    // twiddle index of the next sample, k*(sample - origin) mod n
+    int64_t re, im;             // accumulated sum of x*W^(k*(sample - origin)), ADC counts times Q15
+} tracker_bin;
+
+// a bank of bins over one window length, reading samples from a circular buffer by absolute sample number
+typedef struct {
+    int n;                          // window length, any length up to TRACKER_MAX_N
+    int nbins;                      // tracked bins
+    int period;                     // [samples] common period of the twiddles of the bins, n/gcd(n, every k)
+    int fill;                       // samples in the window, n once it is full
+    uint32_t next;                  // absolute number of the next sample to add
+    uint32_t restarts;              // times the window was refilled after falling behind
+    tracker_bin bins[TRACKER_MAX_BINS];
+    int16_t tw[2*TRACKER_MAX_N];    // Q15 cos and sin of 2*pi*m/n, interleaved
+} tracker;
+
+// sets up an empty bank with an n-point window, not meant for the per-frame path
+bool tracker_init(tracker *t, int n);
+
+// window length that holds a whole number of periods of f0 at the sampling rate fs (harmonics of f0 then
+// fall exactly on bins and do not leak), the longest one up to TRACKER_MAX_N; TRACKER_MAX_N if fs/f0 is not an integer
+int tracker_period_length(uint32_t fs, uint32_t f0);
+
+// adds bin k (0 to n/2) to the bank, returns its index or -1 if the bank is full. add the bins before
+// tracker_reset(), a bin added to a running bank has only part of the window
+int tracker_add(tracker *t, int k);
+
+// empties the windows, the next update starts with the n samples before sample count
+void tracker_reset(tracker *t, uint32_t count);
+
+// adds every sample before sample count from a circular buffer of ring_size (a power of 2), where sample
+// a is at ring[a & (ring_size - 1)]. each sample costs two multiply-accumulates per bin; when the twiddles of
+// all bins repeat within a block of TRACKER_BLOCK samples (e.g. harmonics over whole periods), the block is
+// folded onto one period first and costs an add per sample plus two multiply-accumulates per bin and period
+// sample. when the bank is more than max_lag samples behind, or too far behind for the samples n older to
+// still be in the ring, it restarts with the latest window instead, which bounds the work of one call to
+// about max(max_lag, n) samples
+void tracker_update(tracker *t, const volatile uint16_t *ring, uint32_t ring_size, uint32_t count, uint32_t max_lag);
+
+// adds one sample x, and drops x_old, the sample n earlier (ignored until the window is full). the per-sample
+// form of tracker_update(), e.g. for an ISR; the sample numbers are not tracked, so do not mix the two
+void tracker_push(tracker *t, int32_t x, int32_t x_old);
+
+// [ADC counts] peak amplitude of the tone on bin i over the window (the mean for bin 0, the same for n/2)
+float tracker_amplitude(const tracker *t, int i);
+
+// [rad] phase of bin i relative to a cosine starting at the first sample of the window
+float tracker_phase(const tracker *t, int i);
+
+#endif /* TRACKER_H_ */
@@ -0,0 +1,236 @@
+/*
+ * trigger.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Oscilloscope trigger: an edge comparator with hysteresis and holdoff run on
+ * every ADC block as it is published, several samples per word, queueing the
+ * crossings it finds for the waveform task
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_block.h"
+#include "trigger.h"
+
+#define TRIGGER_MIRROR 0x7fff   // a falling comparator runs as a rising one on TRIGGER_MIRROR - sample
+
+// samples compared at once, as 16-bit lanes of a word (lane 0 at the lowest address)
+#if UINTPTR_MAX > 0xffffffffu
+typedef uint64_t trigger_word;
+#else
+typedef uint32_t trigger_word;
+#endif
+#if defined(__GNUC__)
+typedef trigger_word __attribute__((may_alias)) trigger_word_alias; // read through the uint16_t ring
+#else
+typedef trigger_word trigger_word_alias;
+#endif
+#define TRIGGER_LANES ((int)(sizeof(trigger_word)/2))
+#define TRIGGER_TOP ((trigger_word)0x8000800080008000ull) // top bit of every lane
+#define TRIGGER_RUN_WORDS 32    // most words compared one sample at a time before the packed compare is tried again
+
+// comparator of one block, in locals the word reads cannot alias
+typedef struct {
+    int32_t level, low;         // crossing level and arming level, mirrored for a falling trigger
+    bool mirror;                // falling trigger
+    bool armed;                 // as in trigger_stream
+    int32_t prev;               // as in trigger_stream
+    uint64_t holdoff_end;       // as in trigger_stream
+} trigger_state;
+
+// v in every lane
+static trigger_word splat(uint32_t v)
+{
+    trigger_word w = 0;
+    int i;
+    for (i = 0; i < TRIGGER_LANES; i++)
+        w = w << 16 | v;
+    return w;
+}
+
+// a sample as the comparator sees it
+static int32_t sample(const trigger_state *c, int32_t x)
+{
+    return c->mirror ? TRIGGER_MIRROR - x : x;
+}
+
+// an event for the waveform task, overwriting the oldest
+static void record(trigger_stream *ts, uint64_t index, float frac, bool forced)
+{
+    trigger_event *e = &ts->queue[ts->head & (TRIGGER_QUEUE_SIZE - 1)];
+
+    e->index = index;
+    e->frac = frac;
+    e->forced = forced;
+    ts->last = index;
+    ADC_BLOCK_RELEASE(); // the event is in place before the waveform task can see it
+    ts->head++;
+}
+
+// samples j to end - 1 one at a time, with the state in registers. returns the sample after the last one
+// compared, which is end unless a single mode trigger stopped the comparator after the one before
+static uint32_t run(trigger_stream *ts, trigger_state *c, const volatile uint16_t *x, uint64_t first, uint32_t j,
+                    uint32_t end, bool single)
+{
+    const int32_t level = c->level, low = c->low;
+    const int32_t base = c->mirror ? TRIGGER_MIRROR : 0, sign = c->mirror ? -1 : 1;
+    int32_t prev = c->prev;
+    bool armed = c->armed;
+
+    while (j < end) {
+        int32_t v = base + sign*x[j++];
+        if (v < low) {
+            armed = true; // beyond the hysteresis
+        } else if (armed && prev <= level && v > level) { // crossing between the last sample and this one
+            armed = false; // a crossing in the holdoff also needs the hysteresis again
+            uint64_t number = first + j - 1;
+            if (number >= c->holdoff_end) {
+                record(ts, number - 1, (float)(level - prev)/(v - prev), false);
+                c->holdoff_end = number + ts->holdoff;
+                if (single) {
+                    ts->stopped = true;
+                    prev = v;
+                    break;
+                }
+            }
+        }
+        prev = v;
+    }
+    c->prev = prev;
+    c->armed = armed;
+    return j;
+}
+
+// comparator state and queue empty
+void trigger_stream_attach(trigger_stream *ts, adc_block_ring *r)
+{
+    ts->stopped = false;
+    ts->armed = false;
+    ts->mirrored = !ts->rising;
+    ts->prev = ts->mirrored ? TRIGGER_MIRROR - ts->level : ts->level; // no crossing into the first sample
+    ts->holdoff_end = 0;
+    ts->last = adc_block_sequence(r);
+    ts->head = 0;
+    ts->tail = 0;
+    ADC_BLOCK_BARRIER(); // the comparator is set up before the interrupt can see it
+    r->trigger = ts;
+}
+
+// forwards through the block: single samples up to a word boundary, then whole words, skipping the ones without an
+// arming sample (or without a crossing once armed), then single samples left. a word that cannot be skipped goes
+// one sample at a time, and so do twice as many words after each further one up to TRIGGER_RUN_WORDS: a signal
+// that stays near the level, such as noise, gains nothing from the packed compare, which only adds to its cost
+void trigger_stream_block(trigger_stream *ts, const volatile uint16_t *x, uint64_t first, uint32_t n)
+{
+    trigger_state c;
+    bool single = ts->mode == TRIGGER_SINGLE;
+    uint32_t j = 0, end;
+
+    c.mirror = !ts->rising;
+    c.level = c.mirror ? TRIGGER_MIRROR - ts->level : ts->level;
+    c.low = c.level - ts->hysteresis;
+    c.armed = ts->armed;
+    c.prev = ts->prev;
+    c.holdoff_end = ts->holdoff_end;
+    if (c.mirror != ts->mirrored) { // the slope changed, start over
+        c.prev = TRIGGER_MIRROR - c.prev;
+        c.armed = false;
+    }
+
+    if (!(single && ts->stopped)) { // else a single mode frame was taken
+        trigger_word levels = splat((uint32_t)(c.level + 1));                  // level + 1 in every lane
+        trigger_word lows = splat((uint32_t)(c.low > 0 ? c.low : 0));           // low in every lane
+        trigger_word mirror = c.mirror ? splat(TRIGGER_MIRROR) : 0;
+        int words = 1; // words to compare one sample at a time after one that cannot be skipped
+
+        for (end = 0; end < n && ((uintptr_t)&x[end] & (sizeof(trigger_word) - 1)); end++)
+            ;
+        j = run(ts, &c, x, first, 0, end, single);
+        while (j == end && j + TRIGGER_LANES <= n) {
+            uint32_t k = j;
+            if (c.armed) {
+                trigger_word last = c.prev > c.level ? 0x8000 : 0; // top bit of the lane before, > level
+                for (; k + TRIGGER_LANES <= n; k += TRIGGER_LANES) {
+                    trigger_word w = *(const trigger_word_alias *)(const void *)&x[k];
+                    if (mirror)
+                        w = mirror - w; // no borrow between lanes, the samples fit 15 bits
+                    trigger_word above = ((w | TRIGGER_TOP) - levels) & TRIGGER_TOP;  // lane > level
+                    if (above & ~(above << 16 | last))
+                        break; // a crossing
+                    last = above >> 16*(TRIGGER_LANES - 1);
+                }
+            } else {
+                for (; k + TRIGGER_LANES <= n; k += TRIGGER_LANES) {
+                    trigger_word w = *(const trigger_word_alias *)(const void *)&x[k];
+                    if (mirror)
+                        w = mirror - w;
+                    if (~((w | TRIGGER_TOP) - lows) & TRIGGER_TOP)
+                        break; // a lane < low
+                }
+            }
+            if (k != j) { // words skipped
+                c.prev = sample(&c, x[k - 1]);
+                words = 1;
+            }
+            j = end = k;
+            if (k + TRIGGER_LANES > n)
+                break;
+            end = k + words*TRIGGER_LANES <= n ? k + words*TRIGGER_LANES : k + (n - k)/TRIGGER_LANES*TRIGGER_LANES;
+            j = run(ts, &c, x, first, k, end, single);
+            words = words < TRIGGER_RUN_WORDS ? 2*words : TRIGGER_RUN_WORDS;
+        }
+        if (j == end)
+            j = run(ts, &c, x, first, j, n, single);
+        if (j < n) // stopped
+            c.prev = sample(&c, x[n - 1]);
+    }
+
+    // an untriggered frame ending at the last sample when auto mode waited long enough
+    if (ts->mode == TRIGGER_AUTO && first + n > ts->last + ts->auto_timeout + ts->post + 2)
+        record(ts, first + n - 2 - ts->post, 0, true);
+
+    ts->armed = c.armed;
+    ts->mirrored = c.mirror;
+    ts->prev = c.prev;
+    ts->holdoff_end = c.holdoff_end;
+}
+
+// newest first
+bool trigger_stream_latest(trigger_stream *ts, uint64_t published, trigger_event *e)
+{
+    uint32_t head = ts->head;
+    uint32_t i;
+
+    ADC_BLOCK_BARRIER(); // the events up to head are in place
+    if (head - ts->tail > TRIGGER_QUEUE_SIZE)
+        ts->tail = head - TRIGGER_QUEUE_SIZE; // the older ones were overwritten
+    for (i = head; i != ts->tail; i--) {
+        trigger_event event = ts->queue[(i - 1) & (TRIGGER_QUEUE_SIZE - 1)];
+        ADC_BLOCK_BARRIER();
+        if (ts->head - (i - 1) > TRIGGER_QUEUE_SIZE)
+            break; // overwritten while read, and the older ones too
+        if (event.index + ts->post + 2 <= published) {
+            *e = event;
+            ts->tail = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// the next trigger takes a frame
+void trigger_stream_arm(trigger_stream *ts)
+{
+    ts->stopped = false;
+}
+
+// linear interpolation at a fixed fraction, in Q16
+void trigger_resample(const uint16_t *x, int n, float frac, uint16_t *y)
+{
+    int32_t f = (int32_t)(frac*65536.0f + 0.5f);
+    int i;
+    for (i = 0; i < n; i++)
+        y[i] = (uint16_t)(x[i] + (((x[i + 1] - x[i])*f + 32768) >> 16));
+}
@@ -0,0 +1,79 @@
+/*
+ * trigger.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Oscilloscope trigger: an edge comparator with hysteresis and holdoff run on
+ * every ADC block as it is published, several samples per word, queueing the
+ * crossings it finds for the waveform task
+ */
+
+#ifndef TRIGGER_H_
+#define TRIGGER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_block.h"
+
+#define TRIGGER_QUEUE_SIZE 8 // trigger events kept, a power of 2
+
+// trigger modes
+typedef enum {
+    TRIGGER_AUTO,   // a frame on every trigger, and an untriggered one when none came for auto_timeout samples
+    TRIGGER_NORMAL, // a frame on every trigger only
+    TRIGGER_SINGLE, // one frame on the next trigger, then stopped until trigger_stream_arm()
+    TRIGGER_MODE_COUNT
+} trigger_mode;
+
+// a trigger the comparator found
+typedef struct {
+    uint64_t index;     // sequence number of the last sample before the crossing
+    float frac;         // [samples] crossing of the level past index, 0 to 1, by linear interpolation
+    bool forced;        // no trigger, an auto mode frame ending at the latest samples
+} trigger_event;
+
+// comparator and event queue. the settings are written by the tasks and read by the comparator once per block
+typedef struct trigger_stream {
+    volatile int32_t level;         // [ADC counts] trigger level
+    volatile int32_t hysteresis;    // [ADC counts] beyond level by this much on the far side before a crossing counts
+    volatile bool rising;           // rising or falling edge
+    volatile uint32_t mode;         // trigger_mode
+    volatile uint32_t pre, post;    // [samples] before and after the trigger in a frame
+    volatile uint32_t holdoff;      // [samples] after a trigger before the next one counts
+    volatile uint32_t auto_timeout; // [samples] without a trigger before an auto mode frame is forced
+    volatile bool stopped;          // a single mode frame was taken, no more until trigger_stream_arm()
+
+    // comparator state, driver interrupt only
+    bool armed;                     // the signal was beyond the hysteresis, the next crossing counts
+    bool mirrored;                  // prev is of a falling comparator
+    int32_t prev;                   // last sample, mirrored for a falling comparator
+    uint64_t holdoff_end;           // sequence number of the first sample a crossing may trigger at
+    uint64_t last;                  // sequence number of the last event
+
+    // events, newest at queue[(head - 1) & (TRIGGER_QUEUE_SIZE - 1)], oldest overwritten first
+    trigger_event queue[TRIGGER_QUEUE_SIZE];
+    volatile uint32_t head;         // events recorded
+    uint32_t tail;                  // events taken or passed over by the waveform task
+} trigger_stream;
+
+// starts comparing the blocks of r from the next one on, with the settings already in ts, before the driver
+// interrupt runs
+void trigger_stream_attach(trigger_stream *ts, adc_block_ring *r);
+
+// compares the n samples x of a block starting at sequence number first (x does not wrap), from
+// adc_block_publish() before the sequence moves past them
+void trigger_stream_block(trigger_stream *ts, const volatile uint16_t *x, uint64_t first, uint32_t n);
+
+// takes the latest event whose frame (pre samples before it, post after, and one more for trigger_resample())
+// is published by sequence number published, passing over the older ones. false when there is none yet
+bool trigger_stream_latest(trigger_stream *ts, uint64_t published, trigger_event *e);
+
+// takes a single mode frame again
+void trigger_stream_arm(trigger_stream *ts);
+
+// resamples n samples, each frac of the way to the one after it (n + 1 samples read), so a trigger found between
+// samples lands on a whole display column and the trace does not jitter
+void trigger_resample(const uint16_t *x, int n, float frac, uint16_t *y);
+
+#endif /* TRIGGER_H_ */
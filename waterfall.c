@@ -0,0 +1,87 @@
+/*
+ * waterfall.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Spectrogram (waterfall) history: color-mapped spectrum rows in a ring,
+ * blitted newest first into the LCD frame buffer
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "waterfall.h"
+
+// colormap anchors from the weakest level to the strongest, 24-bit RGB
+static const uint32_t palette[] = {0x000000, 0x0000c0, 0x00c0ff, 0xffff00, 0xff0000, 0xffffff};
+#define PALETTE_SIZE (sizeof(palette)/sizeof(palette[0]))
+
+// 24-bit RGB to the byte-swapped RGB565 of Lcd_buffer, like Crystalfontz128x128_ColorTranslate()
+static uint16_t rgb565(uint32_t rgb)
+{
+    uint32_t c = ((rgb & 0x00f80000) >> 8) | ((rgb & 0x0000fc00) >> 5) | ((rgb & 0x000000f8) >> 3);
+    return (uint16_t)((c >> 8) | ((c << 8) & 0xff00));
+}
+
+// builds the colormap
+void waterfall_init(waterfall *w)
+{
+    int i;
+
+    for (i = 0; i < WATERFALL_LEVELS; i++) {
+        // level i is display row i, so the strongest (row 0) gets the last anchor
+        int pos = (WATERFALL_LEVELS - 1 - i)*(int)(PALETTE_SIZE - 1)*256/(WATERFALL_LEVELS - 1); // 8 fraction bits
+        int a = pos >> 8, f = pos & 255, ch;
+        uint32_t lo = palette[a], hi = palette[a < (int)PALETTE_SIZE - 1 ? a + 1 : a], rgb = 0;
+        for (ch = 0; ch < 24; ch += 8) { // interpolate each channel
+            int x = (lo >> ch) & 255, y = (hi >> ch) & 255;
+            rgb |= (uint32_t)(x + (y - x)*f/256) << ch;
+        }
+        w->lut[i] = rgb565(rgb);
+    }
+    waterfall_clear(w);
+}
+
+// clears the history
+void waterfall_clear(waterfall *w)
+{
+    memset(w->rows, 0, sizeof(w->rows)); // black in any byte order
+    w->head = 0;
+    w->count = 0;
+}
+
+// adds the newest row
+void waterfall_push(waterfall *w, const int16_t *levels, int n)
+{
+    int c;
+
+    w->head = w->head ? w->head - 1 : WATERFALL_ROWS - 1; // newest first
+    uint16_t *row = w->rows[w->head];
+    if (n > WATERFALL_COLS)
+        n = WATERFALL_COLS;
+
+    for (c = 0; c < n; c++) {
+        int level = levels[c];
+        if (level < 0) level = 0;
+        if (level > WATERFALL_LEVELS - 1) level = WATERFALL_LEVELS - 1;
+        row[c] = w->lut[level];
+    }
+    for (; c < WATERFALL_COLS; c++)
+        row[c] = 0;
+
+    if (w->count < WATERFALL_ROWS)
+        w->count++;
+}
+
+// copies the history newest first
+void waterfall_blit(const waterfall *w, uint16_t (*dst)[WATERFALL_COLS], int rows)
+{
+    int shown = rows < w->count ? rows : w->count;
+    int run = WATERFALL_ROWS - w->head; // rows from head to the end of the ring
+
+    if (run > shown)
+        run = shown;
+    memcpy(dst, w->rows[w->head], run*sizeof(w->rows[0]));
+    memcpy(dst + run, w->rows[0], (shown - run)*sizeof(w->rows[0])); // the rest wraps to the start
+    memset(dst + shown, 0, (rows - shown)*sizeof(w->rows[0]));
+}
@@ -0,0 +1,42 @@
+/*
+ * waterfall.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Spectrogram (waterfall) history: color-mapped spectrum rows in a ring,
+ * blitted newest first into the LCD frame buffer
+ */
+
+#ifndef WATERFALL_H_
+#define WATERFALL_H_
+
+#include <stdint.h>
+
+#define WATERFALL_ROWS 104      // spectra kept and shown
+#define WATERFALL_COLS 128      // pixels per row, the LCD width
+#define WATERFALL_LEVELS 128    // colormap entries, one per display row (1 dB at 20 dB per 20-pixel division)
+
+// history ring, stored newest first from head so the screen order is two contiguous runs
+typedef struct {
+    int head;                                       // ring index of the newest row
+    int count;                                      // rows pushed since the last clear, up to WATERFALL_ROWS
+    uint16_t lut[WATERFALL_LEVELS];                 // level -> RGB565 in the byte order of Lcd_buffer
+    uint16_t rows[WATERFALL_ROWS][WATERFALL_COLS];  // color-mapped spectra
+} waterfall;
+
+// builds the colormap (black through blue, cyan, yellow and red to white as the level rises) and clears the history
+void waterfall_init(waterfall *w);
+
+// clears the history, e.g. when the frequency axis changes
+void waterfall_clear(waterfall *w);
+
+// adds one spectrum as the newest row: levels[c] is the display row of column c (0 at the top, the strongest),
+// clamped to the colormap. one table lookup per pixel, columns past n are black
+void waterfall_push(waterfall *w, const int16_t *levels, int n);
+
+// copies the history into rows consecutive frame buffer rows starting at dst, newest at the top,
+// black below the oldest row. only copies, the rows are not mapped again
+void waterfall_blit(const waterfall *w, uint16_t (*dst)[WATERFALL_COLS], int rows);
+
+#endif /* WATERFALL_H_ */
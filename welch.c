@@ -0,0 +1,167 @@
+/*
+ * welch.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Welch PSD averaging: gap-free scheduling of overlapped FFT segments over the
+ * ADC stream, and average/max-hold/min-hold traces of the column powers
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "dsp_math.h"
+#include "spectrum.h"
+#include "welch.h"
+
+// headroom of the stored fixed-point powers: the right shifts of a renormalization keep this many more bits
+#ifdef FIXED_POINT
+# if (FIXED_POINT == 32)
+#  define TRACE_SHIFT 1     // Q31 column power < 2^57, WELCH_AVERAGES of them < 2^62
+# else
+#  define TRACE_SHIFT 27    // Q15 column power < 2^32, WELCH_AVERAGES of them < 2^63
+# endif
+#endif
+
+const char * const gOverlapNameStr[WELCH_OVERLAP_COUNT] = {"0%", "50%", "75%"};
+const char * const gTraceNameStr[TRACE_COUNT] = {"Live", "Aver", "MaxH", "MinH"};
+
+// starts the schedule at the latest complete segment
+void welch_stream_init(welch_stream *s, int nfft, welch_overlap overlap, uint32_t max_lag, uint32_t count)
+{
+    s->nfft = nfft;
+    s->hop = nfft >> (overlap == WELCH_OVERLAP_75 ? 2 : overlap == WELCH_OVERLAP_50 ? 1 : 0);
+    s->max_lag = max_lag;
+    s->next = count - nfft;
+    s->covered = s->next;
+    s->report_start = count;
+    s->dropped = 0;
+    s->drop_pct = -1;
+}
+
+// hands out the next complete segment
+bool welch_stream_next(welch_stream *s, uint32_t count, uint32_t *first)
+{
+    // next never passes count, so the unsigned differences are the lags
+    if (count - s->next > s->max_lag) { // fell behind: skip to the latest segment
+        uint32_t start = count - s->nfft;
+        if ((int32_t)(start - s->covered) > 0)
+            s->dropped += start - s->covered; // samples no segment will cover
+        s->next = start;
+    }
+
+    if (count - s->report_start >= WELCH_REPORT_SAMPLES) {
+        uint32_t span = count - s->report_start;
+        s->drop_pct = (int32_t)(((uint64_t)s->dropped*100 + span - 1)/span); // rounded up, any drop shows
+        s->report_start = count;
+        s->dropped = 0;
+    }
+
+    if (count - s->next < (uint32_t)s->nfft)
+        return false; // not complete yet
+
+    *first = s->next;
+    s->covered = s->next + s->nfft;
+    s->next += s->hop;
+    return true;
+}
+
+// clears the traces
+void welch_traces_reset(welch_traces *t, int cols)
+{
+    t->cols = cols;
+    t->count = 0;
+    t->exp = 0;
+}
+
+#ifdef FIXED_POINT
+// shifts the stored values right by d bits
+static void traces_renormalize(welch_traces *t, int d)
+{
+    int c;
+    if (d >= 64) {
+        for (c = 0; c < t->cols; c++)
+            t->avg[c] = t->max[c] = t->min[c] = 0;
+        return;
+    }
+    for (c = 0; c < t->cols; c++) {
+        t->avg[c] >>= d;
+        t->max[c] >>= d;
+        t->min[c] >>= d;
+    }
+}
+#endif
+
+// adds one segment
+void welch_traces_add(welch_traces *t, const spectrum_sum *power, int exp)
+{
+    int c;
+
+#ifdef FIXED_POINT
+    int d = 0;
+
+    // bring the segment and the traces to the larger of the two scales
+    if (t->count == 0) {
+        t->exp = exp;
+    } else if (exp > t->exp) {
+        traces_renormalize(t, exp - t->exp);
+        t->exp = exp;
+    } else {
+        d = t->exp - exp;
+    }
+#else
+    (void)exp;
+#endif
+
+    for (c = 0; c < t->cols; c++) {
+#ifdef FIXED_POINT
+        spectrum_sum v = d < 64 ? (power[c] << TRACE_SHIFT) >> d : 0;
+#else
+        spectrum_sum v = power[c];
+#endif
+        if (t->count == 0) {
+            t->avg[c] = t->max[c] = t->min[c] = v;
+            continue;
+        }
+
+        if (t->count < WELCH_AVERAGES)
+            t->avg[c] += v; // block average until WELCH_AVERAGES segments are in
+        else
+#ifdef FIXED_POINT
+            t->avg[c] = t->avg[c] - (t->avg[c] >> WELCH_AVERAGES_LOG2) + v;
+#else
+            t->avg[c] += v - t->avg[c]*(1.0f/WELCH_AVERAGES);
+#endif
+        if (v > t->max[c]) t->max[c] = v;
+        if (v < t->min[c]) t->min[c] = v;
+    }
+
+    if (t->count < WELCH_AVERAGES)
+        t->count++;
+}
+
+// column powers of a trace and their scale
+const spectrum_sum *welch_traces_get(const welch_traces *t, welch_trace trace, int32_t *log2_scale_q16)
+{
+    if (t->count == 0)
+        return NULL;
+
+#ifdef FIXED_POINT
+    int32_t scale = (t->exp - TRACE_SHIFT) << 16;
+#else
+    int32_t scale = 0;
+#endif
+
+    switch (trace) {
+    case TRACE_MAX_HOLD:
+        *log2_scale_q16 = scale;
+        return t->max;
+    case TRACE_MIN_HOLD:
+        *log2_scale_q16 = scale;
+        return t->min;
+    default: // TRACE_AVERAGE
+        *log2_scale_q16 = scale - ilog2_q16(t->count); // the sum of count segments
+        return t->avg;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * welch.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Welch PSD averaging: gap-free scheduling of overlapped FFT segments over the
+ * ADC stream, and average/max-hold/min-hold traces of the column powers
+ */
+
+#ifndef WELCH_H_
+#define WELCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "spectrum.h"
+
+#define WELCH_AVERAGES 16           // segments in the average, a power of 2
+#define WELCH_AVERAGES_LOG2 4       // log2(WELCH_AVERAGES)
+#define WELCH_REPORT_SAMPLES 1048576 // [samples] drop fraction reporting interval, about 1 s at 1 Msps
+
+typedef enum {
+    WELCH_OVERLAP_0,    // segments back to back
+    WELCH_OVERLAP_50,   // hop of nfft/2
+    WELCH_OVERLAP_75,   // hop of nfft/4
+    WELCH_OVERLAP_COUNT
+} welch_overlap;
+
+typedef enum {
+    TRACE_LIVE,         // latest frame only, no averaging
+    TRACE_AVERAGE,      // linear power average of the last WELCH_AVERAGES segments (exponential once full)
+    TRACE_MAX_HOLD,     // largest power of every segment since the reset
+    TRACE_MIN_HOLD,     // smallest power of every segment since the reset
+    TRACE_COUNT
+} welch_trace;
+
+extern const char * const gOverlapNameStr[WELCH_OVERLAP_COUNT]; // overlap labels for the display
+extern const char * const gTraceNameStr[TRACE_COUNT];           // short trace names for the display
+
+// segment schedule over a free-running sample counter (absolute sample numbers, wrapping at 2^32)
+typedef struct {
+    int nfft;               // segment length
+    int hop;                // samples between segment starts
+    uint32_t max_lag;       // oldest segment start still safe to read, in samples behind the counter
+    uint32_t next;          // start of the next segment
+    uint32_t covered;       // end of the last segment handed out, every sample before it was analyzed
+    uint32_t report_start;  // start of the current reporting interval
+    uint32_t dropped;       // samples skipped in the current reporting interval
+    int32_t drop_pct;       // percentage of samples skipped in the last full interval, -1 before the first
+} welch_stream;
+
+// traces of one column layout, accumulated in linear power
+typedef struct {
+    int cols;                           // columns per trace
+    int count;                          // segments accumulated, saturates at WELCH_AVERAGES
+    int exp;                            // log2 power scale shared by the stored values (fixed-point build)
+    spectrum_sum avg[SPECTRUM_MAX_COLS]; // sum of count segments, then WELCH_AVERAGES times the exponential average
+    spectrum_sum max[SPECTRUM_MAX_COLS];
+    spectrum_sum min[SPECTRUM_MAX_COLS];
+} welch_traces;
+
+// starts a schedule of nfft-sample segments with the given overlap at the latest nfft samples before
+// sample count. max_lag must leave the time to read a segment before the ring buffer overwrites it
+void welch_stream_init(welch_stream *s, int nfft, welch_overlap overlap, uint32_t max_lag, uint32_t count);
+
+// hands out the next segment that is complete before sample count in *first, false if it is not complete yet.
+// when the schedule falls more than max_lag behind it skips to the latest segment and counts the skipped samples
+bool welch_stream_next(welch_stream *s, uint32_t count, uint32_t *first);
+
+// clears the traces of cols columns
+void welch_traces_reset(welch_traces *t, int cols);
+
+// adds the column powers of one segment from spectrum_detect(), whose true power is power*2^exp
+// (twice the block floating-point shift of the segment, ignored in the float build)
+void welch_traces_add(welch_traces *t, const spectrum_sum *power, int exp);
+
+// column powers of a trace (not TRACE_LIVE) for spectrum_rows(), whose true power is power*2^(*log2_scale_q16/2^16).
+// NULL before the first segment
+const spectrum_sum *welch_traces_get(const welch_traces *t, welch_trace trace, int32_t *log2_scale_q16);
+
+#endif /* WELCH_H_ */
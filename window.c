@@ -0,0 +1,238 @@
+/*
+ * window.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * FFT window functions and the fused ADC -> windowed FFT input kernel
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "dsp_math.h"
+#include "window.h"
+
+#define PI 3.14159265358979f
+
+const char * const gWindowNameStr[WINDOW_COUNT] = {"Hann", "Hamming", "Blackman", "B-Harris", "Flattop", "Kaiser"};
+
+// cosine-sum window coefficients a0 - a1*cos(x) + a2*cos(2x) - a3*cos(3x) + a4*cos(4x)
+static const float cosine_sum[WINDOW_KAISER][5] = {
+    {0.5f, 0.5f, 0.0f, 0.0f, 0.0f},                                 // Hann
+    {0.54f, 0.46f, 0.0f, 0.0f, 0.0f},                               // Hamming
+    {0.42f, 0.5f, 0.08f, 0.0f, 0.0f},                               // Blackman
+    {0.35875f, 0.48829f, 0.14128f, 0.01168f, 0.0f},                 // Blackman-Harris (4-term)
+    {0.21557895f, 0.41663158f, 0.277263158f, 0.083578947f, 0.006947368f}, // flat-top
+};
+
+// zeroth-order modified Bessel function of the first kind, power series
+static float bessel_i0(float x)
+{
+    float term = 1.0f, sum = 1.0f, q = x*x/4;
+    int k;
+    for (k = 1; k < 50 && term > 1e-8f*sum; k++) {
+        term *= q/((float)k*k);
+        sum += term;
+    }
+    return sum;
+}
+
+// value of window type at point i of n
+static float window_value(window_type type, float beta, int i, int n)
+{
+    if (type == WINDOW_KAISER) {
+        float r = 2.0f*i/(n - 1) - 1.0f;
+        return bessel_i0(beta*sqrtf(1.0f - r*r))/bessel_i0(beta);
+    }
+
+    const float *a = cosine_sum[type];
+    float x = 2*PI*i/(n - 1);
+    return a[0] - a[1]*cosf(x) + a[2]*cosf(2*x) - a[3]*cosf(3*x) + a[4]*cosf(4*x);
+}
+
+// converts a window value to the table type
+static fft_window_t window_quantize(float w)
+{
+#ifdef FIXED_POINT
+    float q = roundf(w*((1 << WINDOW_Q) - 1));
+    if (q > 32767) q = 32767;
+    if (q < -32767) q = -32767;
+    return (fft_window_t)q;
+#else
+    return w;
+#endif
+}
+
+// builds the window table and its metadata
+void window_init(window_table *wt, window_type type, float beta, int nfft, fft_window_t *ram)
+{
+    const fft_table_entry *flash = fft_table_find(nfft);
+    int i;
+
+    wt->type = type;
+    wt->beta = beta;
+    wt->nfft = nfft;
+
+    if (type == WINDOW_BLACKMAN && flash != NULL) {
+        wt->table = flash->window; // precomputed in flash
+    } else {
+        for (i = 0; i < nfft/2; i++)
+            ram[i] = window_quantize(window_value(type, beta, i, nfft));
+        wt->table = ram;
+    }
+
+    // metadata from the table actually used, both halves
+    float sum = 0, sum2 = 0;
+    for (i = 0; i < nfft/2; i++) {
+#ifdef FIXED_POINT
+        float w = (float)wt->table[i]/((1 << WINDOW_Q) - 1);
+#else
+        float w = wt->table[i];
+#endif
+        sum += 2*w;
+        sum2 += 2*w*w;
+    }
+    wt->coherent_gain = sum/nfft;
+    wt->enbw = nfft*sum2/(sum*sum);
+}
+
+// half-width of the main lobe
+int window_lobe_bins(const window_table *wt)
+{
+    switch (wt->type) {
+    case WINDOW_HANN:
+    case WINDOW_HAMMING:
+        return 2;
+    case WINDOW_BLACKMAN:
+        return 3;
+    case WINDOW_BLACKMAN_HARRIS:
+        return 4;
+    case WINDOW_FLATTOP:
+        return 5;
+    default: // Kaiser, first null at sqrt(1 + (beta/pi)^2) bins
+        return (int)ceilf(sqrtf(1.0f + wt->beta*wt->beta/(PI*PI)));
+    }
+}
+
+// sin(pi*x)/(pi*x)
+static float sinc(float x)
+{
+    if (fabsf(x) < 1e-4f)
+        return 1.0f;
+    return sinf(PI*x)/(PI*x);
+}
+
+// Kaiser transform shape sinh(sqrt(beta^2 - (pi*u)^2))/sqrt(beta^2 - (pi*u)^2), a sin past the main lobe
+static float kaiser_transform(float beta, float u)
+{
+    float d = beta*beta - PI*PI*u*u;
+    if (fabsf(d) < 1e-6f)
+        return 1.0f;
+    if (d > 0) {
+        float r = sqrtf(d);
+        return sinhf(r)/r;
+    }
+    float r = sqrtf(-d);
+    return sinf(r)/r;
+}
+
+// spectrum magnitude u bins from a tone
+float window_response(const window_table *wt, float u)
+{
+    u *= (float)(wt->nfft - 1)/wt->nfft; // the symmetric window spans nfft - 1 sample intervals
+
+    if (wt->type == WINDOW_KAISER)
+        return fabsf(kaiser_transform(wt->beta, u)/kaiser_transform(wt->beta, 0));
+
+    // each cosine term is a pair of sincs m bins either side
+    const float *a = cosine_sum[wt->type];
+    float sum = a[0]*sinc(u);
+    int m;
+    for (m = 1; m < 5; m++)
+        sum += a[m]/2*(sinc(u - m) + sinc(u + m));
+    return fabsf(sum/a[0]);
+}
+
+// one contiguous piece of the ring buffer and the window
+typedef struct {
+    const volatile uint16_t *src;   // first sample
+    const fft_window_t *w;          // window coefficient of the first sample
+    int wstep;                      // +1 in the first half of the window, -1 in the second
+    int count;                      // number of samples
+    kiss_fft_scalar *dst;           // first output
+} window_span;
+
+// splits the read into spans that are contiguous in both the ring buffer and the half table
+static int window_spans(const window_table *wt, const volatile uint16_t *ring, uint32_t ring_size,
+                        int32_t first, kiss_fft_scalar *dst, window_span spans[3])
+{
+    int n = wt->nfft, half = n/2;
+    int i = 0, count = 0;
+
+    while (i < n) {
+        uint32_t r = (uint32_t)(first + i) & (ring_size - 1);
+        int end = i < half ? half : n;              // window midpoint
+        if (i + (int)(ring_size - r) < end)         // ring wrap
+            end = i + (int)(ring_size - r);
+
+        spans[count].src = &ring[r];
+        spans[count].w = i < half ? &wt->table[i] : &wt->table[n - 1 - i];
+        spans[count].wstep = i < half ? 1 : -1;
+        spans[count].count = end - i;
+        spans[count].dst = &dst[i];
+        count++;
+        i = end;
+    }
+    return count;
+}
+
+// fused read, DC removal and windowing of one FFT frame
+int window_apply(const window_table *wt, const volatile uint16_t *ring, uint32_t ring_size,
+                 int32_t first, int32_t dc, kiss_fft_scalar *dst)
+{
+    window_span spans[3];
+    int nspans = window_spans(wt, ring, ring_size, first, dst, spans);
+    int s, k;
+
+#ifdef FIXED_POINT
+    // block floating point: find the largest windowed sample, then scale the block to full range
+    int32_t peak = 0;
+    for (s = 0; s < nspans; s++) {
+        const volatile uint16_t *src = spans[s].src;
+        const fft_window_t *w = spans[s].w;
+        for (k = 0; k < spans[s].count; k++, w += spans[s].wstep) {
+            int32_t p = ((int32_t)src[k] - dc) * *w;
+            if (p < 0) p = -p;
+            if (p > peak) peak = p;
+        }
+    }
+    int block_shift = dsp_bits32(peak) - FRACBITS; // right shift (negative = left shift) to full scale
+
+    for (s = 0; s < nspans; s++) {
+        const volatile uint16_t *src = spans[s].src;
+        const fft_window_t *w = spans[s].w;
+        kiss_fft_scalar *out = spans[s].dst;
+        if (block_shift >= 0) {
+            for (k = 0; k < spans[s].count; k++, w += spans[s].wstep)
+                out[k] = (kiss_fft_scalar)((((int32_t)src[k] - dc) * *w) >> block_shift);
+        } else {
+            for (k = 0; k < spans[s].count; k++, w += spans[s].wstep)
+                out[k] = (kiss_fft_scalar)((((int32_t)src[k] - dc) * *w) * (1 << -block_shift));
+        }
+    }
+    return block_shift;
+#else
+    for (s = 0; s < nspans; s++) {
+        const volatile uint16_t *src = spans[s].src;
+        const fft_window_t *w = spans[s].w;
+        kiss_fft_scalar *out = spans[s].dst;
+        for (k = 0; k < spans[s].count; k++, w += spans[s].wstep)
+            out[k] = (float)((int32_t)src[k] - dc) * *w;
+    }
+    return 0;
+#endif
+}
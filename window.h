@@ -0,0 +1,60 @@
+/*
+ * window.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * FFT window functions and the fused ADC -> windowed FFT input kernel
+ */
+
+#ifndef WINDOW_H_
+#define WINDOW_H_
+
+#include <stdint.h>
+#include "kiss_fft.h"
+#include "fft_tables.h"
+
+#define WINDOW_KAISER_BETA 8.0f // default Kaiser window shape parameter
+#define WINDOW_Q 15             // fixed-point window coefficients are Q15
+
+typedef enum {
+    WINDOW_HANN,
+    WINDOW_HAMMING,
+    WINDOW_BLACKMAN,
+    WINDOW_BLACKMAN_HARRIS,
+    WINDOW_FLATTOP,
+    WINDOW_KAISER,
+    WINDOW_COUNT
+} window_type;
+
+// a window of one FFT size and its amplitude/noise metadata
+typedef struct {
+    window_type type;
+    float beta;                 // Kaiser shape parameter (unused by the other windows)
+    int nfft;                   // window length
+    const fft_window_t *table;  // first half of the symmetric window, w[nfft-1-i] = w[i]
+    float coherent_gain;        // sum(w)/N, amplitude gain for a bin-centered tone
+    float enbw;                 // equivalent noise bandwidth in bins, N*sum(w^2)/sum(w)^2
+} window_table;
+
+extern const char * const gWindowNameStr[WINDOW_COUNT]; // short window names for the display
+
+// builds the window of type/beta for nfft points: points wt at the flash table when one exists,
+// otherwise computes the first half into ram[nfft/2]. not meant for the per-frame path.
+void window_init(window_table *wt, window_type type, float beta, int nfft, fft_window_t *ram);
+
+// [bins] half-width of the main lobe of the window, rounded up: the leakage of one tone between bins
+// reaches about this far either side of its peak bin before the sidelobes
+int window_lobe_bins(const window_table *wt);
+
+// magnitude of the window's spectrum u bins from a tone, relative to the tone's bin (1 at u = 0), from the
+// continuous transform of the window shape. for interpolating between bins, not for the per-bin path
+float window_response(const window_table *wt, float u);
+
+// fused kernel: reads wt->nfft samples starting at ring index first from a circular buffer of ring_size
+// (a power of 2), removes dc, applies the window and writes the FFT input to dst in one pass.
+// returns the block floating-point right shift applied to the Q15 products (0 in the float build)
+int window_apply(const window_table *wt, const volatile uint16_t *ring, uint32_t ring_size,
+                 int32_t first, int32_t dc, kiss_fft_scalar *dst);
+
+#endif /* WINDOW_H_ */
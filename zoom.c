@@ -0,0 +1,246 @@
+/*
+ * zoom.c
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Zoom FFT: digital down-conversion of the ADC ring buffer (NCO mixer, CIC and
+ * compensating FIR decimation) and a complex FFT of the decimated stream
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "fft_tables.h"
+#include "fft_codelets.h"
+#include "dsp_math.h"
+#include "window.h"
+#include "zoom.h"
+
+#define PI 3.14159265358979f
+
+// FIR band edges in cycles per CIC output sample. the passband is the displayed part of the zoomed band;
+// above the stopband edge everything would alias onto it. decimating by 4 in the FIR keeps the passband
+// at a tenth of the CIC output rate, where the CIC images around its nulls stay about 80 dB down
+#define FIR_PASS ((0.5f - (float)ZOOM_GUARD/ZOOM_NFFT)/ZOOM_FIR_DECIM)
+#define FIR_STOP ((0.5f + (float)ZOOM_GUARD/ZOOM_NFFT)/ZOOM_FIR_DECIM)
+#define FIR_GRID 256        // frequency points of the FIR design integral
+#define MIX_ROUND (1 << (14 - ZOOM_FRAC)) // rounds the mixer products to ZOOM_FRAC fractional bits
+#define IQ_MAX 65535        // decimated samples saturate here so the Q15 window products fit in 32 bits
+
+static int16_t nco_cos[ZOOM_NCO_SIZE];          // Q15 cos(2*pi*i/ZOOM_NCO_SIZE), -sin is a quarter turn ahead
+static uint64_t cfg_mem[(KISS_FFT_CFG_TABLES_BYTES + 7)/8]; // complex FFT state, tables in flash
+static kiss_fft_cfg zoom_cfg;                   // ZOOM_NFFT-point forward FFT, NULL until the first zoom_init
+static int16_t cic_out[2][ZOOM_CIC_OUTPUTS];    // CIC output I and Q of the frame
+static int32_t fir_out[2][ZOOM_NFFT];           // decimated I and Q of the frame
+
+// builds the NCO table and the FFT config on first use
+static bool zoom_tables(void)
+{
+    int i;
+
+    if (zoom_cfg != NULL)
+        return true;
+
+    for (i = 0; i < ZOOM_NCO_SIZE; i++)
+        nco_cos[i] = (int16_t)lrintf(32767*cosf(2*PI*i/ZOOM_NCO_SIZE));
+
+    const fft_table_entry *t = fft_table_find(2*ZOOM_NFFT); // tables of the ZOOM_NFFT-point complex sub-FFT
+    size_t len = sizeof(cfg_mem);
+    kiss_fft_cfg cfg = kiss_fft_alloc_tables(ZOOM_NFFT, fft_twiddles, FFT_TABLE_MAX_NFFT/2, t->swaps, t->nswaps,
+                                             t->stage_twiddles, cfg_mem, &len);
+    if (cfg == NULL)
+        return false;
+    kiss_fft_set_codelet(cfg, fft_codelet_find(ZOOM_NFFT));
+    zoom_cfg = cfg;
+    return true;
+}
+
+// CIC magnitude response at f cycles per CIC output sample, normalized to 1 at DC
+static float cic_response(float f, int rate)
+{
+    float g = sinf(PI*f)/(rate*sinf(PI*f/rate));
+    return powf(fabsf(g), ZOOM_CIC_ORDER);
+}
+
+// frequency-sampling design of the decimating FIR: 1/CIC response up to FIR_PASS, a raised cosine
+// transition to 0 at FIR_STOP, Blackman windowed and normalized to unity gain at DC
+static void zoom_fir_design(int16_t *fir, int rate)
+{
+    static float h[ZOOM_FIR_TAPS]; // too large for the task stacks
+    float dc = 0;
+    int c = (ZOOM_FIR_TAPS - 1)/2;
+    int n, g;
+
+    for (n = 0; n <= c; n++) {
+        float sum = 0;
+        for (g = 0; g < FIR_GRID; g++) {
+            float f = (g + 0.5f)*0.5f/FIR_GRID;
+            float d = 1.0f/cic_response(f, rate);
+            if (f >= FIR_STOP)
+                break;
+            if (f > FIR_PASS)
+                d *= 0.5f*(1.0f + cosf(PI*(f - FIR_PASS)/(FIR_STOP - FIR_PASS)));
+            sum += d*cosf(2*PI*f*n);
+        }
+        float w = 0.42f + 0.5f*cosf(PI*n/(c + 1)) + 0.08f*cosf(2*PI*n/(c + 1));
+        h[c - n] = h[c + n] = sum/FIR_GRID*w; // 2*integral from 0 to 1/2 of d(f)*cos(2*pi*f*n)
+    }
+
+    for (n = 0; n < ZOOM_FIR_TAPS; n++)
+        dc += h[n];
+    for (n = 0; n < ZOOM_FIR_TAPS; n++) {
+        float q = roundf(h[n]/dc*32768);
+        fir[n] = (int16_t)(q > 32767 ? 32767 : q < -32767 ? -32767 : q);
+    }
+}
+
+// builds the plan of a zoom factor and center
+bool zoom_init(zoom_plan *z, int factor, uint32_t center_step)
+{
+    if (factor < ZOOM_FACTOR_MIN || factor > ZOOM_FACTOR_MAX || (factor & (factor - 1)) ||
+            center_step > ZOOM_NCO_SIZE/2)
+        return false;
+    if (!zoom_tables())
+        return false;
+
+    z->factor = factor;
+    z->cic_rate = factor/ZOOM_FIR_DECIM;
+    z->cic_shift = ZOOM_CIC_ORDER*(dsp_bits32(z->cic_rate) - 1);
+    z->center_step = center_step;
+    zoom_fir_design(z->fir, z->cic_rate);
+    return true;
+}
+
+// ADC samples one frame reads
+int32_t zoom_input_size(const zoom_plan *z)
+{
+    return ZOOM_CIC_OUTPUTS*z->cic_rate;
+}
+
+// mixes the samples down by the center frequency and decimates them through the CIC into cic_out
+static void zoom_cic(const zoom_plan *z, const volatile uint16_t *ring, uint32_t ring_size, int32_t first, int32_t dc)
+{
+    // integrators run at the ADC rate and wrap modulo 2^32, the combs undo the wrap exactly
+    uint32_t int_i[ZOOM_CIC_ORDER] = {0}, int_q[ZOOM_CIC_ORDER] = {0};
+    uint32_t comb_i[ZOOM_CIC_ORDER] = {0}, comb_q[ZOOM_CIC_ORDER] = {0};
+    uint32_t mask = ring_size - 1, r = (uint32_t)first;
+    uint32_t ph = 0, step = z->center_step;
+    int32_t round = (1 << z->cic_shift) >> 1;
+    int j, k, s;
+
+    for (j = 0; j < ZOOM_CIC_OUTPUTS; j++) {
+        for (k = 0; k < z->cic_rate; k++) {
+            int32_t x = (int32_t)ring[r++ & mask] - dc;
+            // x*exp(-j*phase) with ZOOM_FRAC fractional bits, at most 15 bits for a 12-bit x. rounded, since
+            // a truncation bias would show up as a tone at the center frequency
+            uint32_t vi = (uint32_t)((x*nco_cos[ph] + MIX_ROUND) >> (15 - ZOOM_FRAC));
+            uint32_t vq = (uint32_t)((x*nco_cos[(ph + ZOOM_NCO_SIZE/4) & (ZOOM_NCO_SIZE - 1)] + MIX_ROUND) >> (15 - ZOOM_FRAC));
+            ph = (ph + step) & (ZOOM_NCO_SIZE - 1);
+            for (s = 0; s < ZOOM_CIC_ORDER; s++) {
+                vi = int_i[s] += vi;
+                vq = int_q[s] += vq;
+            }
+        }
+
+        uint32_t yi = int_i[ZOOM_CIC_ORDER - 1], yq = int_q[ZOOM_CIC_ORDER - 1];
+        for (s = 0; s < ZOOM_CIC_ORDER; s++) {
+            uint32_t ti = yi, tq = yq;
+            yi -= comb_i[s];
+            yq -= comb_q[s];
+            comb_i[s] = ti;
+            comb_q[s] = tq;
+        }
+        // the CIC gain is 2^cic_shift, so the output is back in the 15-bit input range
+        cic_out[0][j] = (int16_t)(((int32_t)yi + round) >> z->cic_shift);
+        cic_out[1][j] = (int16_t)(((int32_t)yq + round) >> z->cic_shift);
+    }
+}
+
+// compensating FIR over cic_out, keeping every ZOOM_FIR_DECIM-th output, into fir_out
+static void zoom_fir(const zoom_plan *z)
+{
+    const int16_t *ci = &cic_out[0][ZOOM_CIC_ORDER], *cq = &cic_out[1][ZOOM_CIC_ORDER]; // skip the CIC start-up
+    const int c = (ZOOM_FIR_TAPS - 1)/2;
+    int n, t;
+
+    for (n = 0; n < ZOOM_NFFT; n++, ci += ZOOM_FIR_DECIM, cq += ZOOM_FIR_DECIM) {
+        int64_t ai = 1 << 14, aq = 1 << 14; // round the Q15 taps
+        for (t = 0; t < c; t++) { // symmetric taps: one multiply per pair
+            ai += (int64_t)z->fir[t]*(ci[t] + ci[ZOOM_FIR_TAPS - 1 - t]);
+            aq += (int64_t)z->fir[t]*(cq[t] + cq[ZOOM_FIR_TAPS - 1 - t]);
+        }
+        ai += (int32_t)z->fir[c]*ci[c];
+        aq += (int32_t)z->fir[c]*cq[c];
+        ai >>= 15;
+        aq >>= 15;
+        fir_out[0][n] = (int32_t)(ai > IQ_MAX ? IQ_MAX : ai < -IQ_MAX ? -IQ_MAX : ai);
+        fir_out[1][n] = (int32_t)(aq > IQ_MAX ? IQ_MAX : aq < -IQ_MAX ? -IQ_MAX : aq);
+    }
+}
+
+// down-conversion, decimation and windowing of one zoom frame
+int zoom_apply(const zoom_plan *z, const window_table *wt, const volatile uint16_t *ring, uint32_t ring_size,
+               int32_t first, int32_t dc, kiss_fft_cpx *dst)
+{
+    const int32_t *xi = fir_out[0], *xq = fir_out[1];
+    int i;
+
+    zoom_cic(z, ring, ring_size, first, dc);
+    zoom_fir(z);
+
+#ifdef FIXED_POINT
+    // block floating point like window_apply(): find the largest windowed sample, then scale to full range
+    int32_t peak = 0;
+    for (i = 0; i < ZOOM_NFFT; i++) {
+        int32_t w = i < ZOOM_NFFT/2 ? wt->table[i] : wt->table[ZOOM_NFFT - 1 - i];
+        int32_t pi = xi[i]*w, pq = xq[i]*w;
+        if (pi < 0) pi = -pi;
+        if (pq < 0) pq = -pq;
+        if (pi > peak) peak = pi;
+        if (pq > peak) peak = pq;
+    }
+    int block_shift = dsp_bits32(peak) - FRACBITS;
+
+    for (i = 0; i < ZOOM_NFFT; i++) {
+        int32_t w = i < ZOOM_NFFT/2 ? wt->table[i] : wt->table[ZOOM_NFFT - 1 - i];
+        if (block_shift >= 0) {
+            dst[i].r = (kiss_fft_scalar)((xi[i]*w) >> block_shift);
+            dst[i].i = (kiss_fft_scalar)((xq[i]*w) >> block_shift);
+        } else {
+            dst[i].r = (kiss_fft_scalar)((xi[i]*w) * (1 << -block_shift));
+            dst[i].i = (kiss_fft_scalar)((xq[i]*w) * (1 << -block_shift));
+        }
+    }
+    return block_shift - ZOOM_FRAC; // the samples carry ZOOM_FRAC more bits than ADC counts
+#else
+    for (i = 0; i < ZOOM_NFFT; i++) {
+        float w = (i < ZOOM_NFFT/2 ? wt->table[i] : wt->table[ZOOM_NFFT - 1 - i])*(1.0f/(1 << ZOOM_FRAC));
+        dst[i].r = (float)xi[i]*w;
+        dst[i].i = (float)xq[i]*w;
+    }
+    return 0;
+#endif
+}
+
+// complex FFT with the negative frequencies moved in front
+void zoom_execute(kiss_fft_cpx *buf)
+{
+    int k;
+
+    kiss_fft(zoom_cfg, buf, buf);
+    for (k = 0; k < ZOOM_NFFT/2; k++) {
+        kiss_fft_cpx t = buf[k];
+        buf[k] = buf[k + ZOOM_NFFT/2];
+        buf[k + ZOOM_NFFT/2] = t;
+    }
+}
+
+// [Hz] center frequency
+uint32_t zoom_center_hz(const zoom_plan *z, uint32_t fs)
+{
+    return (uint32_t)(((uint64_t)z->center_step*fs + ZOOM_NCO_SIZE/2)/ZOOM_NCO_SIZE);
+}
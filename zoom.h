@@ -0,0 +1,64 @@
+/*
+ * zoom.h
+ *
+ * ECE 3849 Lab 2
+ * Adam Grabowski, Michael Rideout
+ *
+ * Zoom FFT: digital down-conversion of the ADC ring buffer (NCO mixer, CIC and
+ * compensating FIR decimation) and a complex FFT of the decimated stream
+ */
+
+#ifndef ZOOM_H_
+#define ZOOM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "kiss_fft.h"
+#include "window.h"
+
+#define ZOOM_NFFT 256               // complex FFT length of the decimated stream
+#define ZOOM_GUARD (ZOOM_NFFT/8)    // bins at each band edge in the FIR transition band, not displayed
+#define ZOOM_NCO_SIZE 1024          // NCO table length, the center frequency step is fs/ZOOM_NCO_SIZE
+#define ZOOM_CIC_ORDER 4            // CIC integrator/comb pairs
+#define ZOOM_FIR_DECIM 4            // decimation of the compensating FIR, the CIC does the rest
+#define ZOOM_FIR_TAPS 127           // compensating FIR length (odd, linear phase)
+#define ZOOM_FRAC 3                 // fractional bits of the mixed and decimated samples, in ADC counts
+#define ZOOM_FACTOR_MIN 4           // smallest zoom (total decimation), CIC rate 1
+#define ZOOM_FACTOR_MAX 32          // largest zoom, CIC rate 8
+#define ZOOM_FACTOR_COUNT 4         // zoom factors 4, 8, 16 and 32
+
+// samples of the CIC output one frame needs: each FIR output takes ZOOM_FIR_TAPS of them and
+// each CIC output depends on ZOOM_CIC_ORDER earlier ones
+#define ZOOM_CIC_OUTPUTS (ZOOM_FIR_DECIM*ZOOM_NFFT + ZOOM_FIR_TAPS - 1 + ZOOM_CIC_ORDER)
+
+// down-conversion of one center frequency and zoom factor
+typedef struct {
+    int factor;                     // total decimation, the displayed band is fs/factor wide
+    int cic_rate;                   // CIC decimation, factor/ZOOM_FIR_DECIM
+    int cic_shift;                  // log2(cic_rate^ZOOM_CIC_ORDER), removes the CIC gain
+    uint32_t center_step;           // NCO table step per sample, center frequency = center_step*fs/ZOOM_NCO_SIZE
+    int16_t fir[ZOOM_FIR_TAPS];     // Q15 lowpass with the inverse CIC droop in its passband
+} zoom_plan;
+
+// builds the plan of a zoom factor (ZOOM_FACTOR_MIN to ZOOM_FACTOR_MAX, a power of 2) centered at
+// center_step (0 to ZOOM_NCO_SIZE/2). designs the FIR, so not meant for the per-frame path
+bool zoom_init(zoom_plan *z, int factor, uint32_t center_step);
+
+// ADC samples one frame reads
+int32_t zoom_input_size(const zoom_plan *z);
+
+// reads zoom_input_size() samples starting at ring index first from a circular buffer of ring_size
+// (a power of 2), removes dc, down-converts and decimates them to ZOOM_NFFT complex samples and applies
+// the window (wt->nfft == ZOOM_NFFT) into dst. returns the block floating-point right shift of dst
+// relative to ADC counts times the Q15 window, like window_apply() (0 in the float build)
+int zoom_apply(const zoom_plan *z, const window_table *wt, const volatile uint16_t *ring, uint32_t ring_size,
+               int32_t first, int32_t dc, kiss_fft_cpx *dst);
+
+// complex FFT of the zoom_apply() output in place, reordered so bin k is at the center frequency
+// plus (k - ZOOM_NFFT/2)*fs/(factor*ZOOM_NFFT)
+void zoom_execute(kiss_fft_cpx *buf);
+
+// [Hz] center frequency for the sampling rate fs
+uint32_t zoom_center_hz(const zoom_plan *z, uint32_t fs);
+
+#endif /* ZOOM_H_ */